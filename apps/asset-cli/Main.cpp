@@ -1,6 +1,6 @@
 // asset-cli: headless command-line surface for the asset library.
 //
-// Commands: list, search, inspect, validate, render. Everything is
+// Commands: list, search, inspect, validate, render, bake. Everything is
 // machine-readable with --json. No window and no debug server, so many
 // invocations can run in parallel (agent loops, CI matrices).
 
@@ -22,7 +22,9 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdio>
+#include <filesystem>
 #include <iostream>
 #include <optional>
 #include <stdexcept>
@@ -48,7 +50,8 @@ namespace {
 		"  search <query> [--json]\n"
 		"  inspect <defName> [--json]\n"
 		"  validate [--json] [--render-smoke]\n"
-		"  render <defName> --out <file.png> [--size WxH] [--bg r,g,b,a] [--seed N] [--samples N]\n";
+		"  render <defName> --out <file.png> [--size WxH] [--bg r,g,b,a] [--seed N] [--samples N]\n"
+		"  bake [--out <file.pack>] [--json]   (default out: <assets>/baked/assets.pack)\n";
 
 	// --- argument helpers ---
 
@@ -456,6 +459,50 @@ namespace {
 		return ok ? kOk : kFailure;
 	}
 
+	// Precompute every definition's template mesh and collision into a binary
+	// pack the game maps at startup (see AssetPack.h). Always generates live:
+	// no existing pack is attached, so a stale pack can never bake into itself.
+	int cmdBake(const std::vector<std::string>& args) {
+		if (!loadLibrary()) {
+			return kFailure;
+		}
+		const bool asJson = hasFlag(args, "--json");
+
+		std::string out;
+		if (const auto outArg = flagValue(args, "--out")) {
+			out = *outArg;
+		} else {
+			// Beside assets/world, where the game's startup lookup finds it.
+			const std::filesystem::path assetsRoot = Foundation::findResourceString("assets/world");
+			out = (assetsRoot.parent_path() / engine::assets::kBakedPackRelativePath).string();
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		const engine::assets::BakeResult result = AssetRegistry::Get().bakePack(out);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		if (!result.ok) {
+			std::cerr << "error: could not write " << out << "\n";
+			return kFailure;
+		}
+
+		std::error_code ec;
+		const auto		bytes = std::filesystem::file_size(out, ec);
+		if (asJson) {
+			std::cout << json{{"out", out}, {"entries", result.entries}, {"meshes", result.meshes}, {"bytes", ec ? 0 : bytes}, {"seconds", seconds}}
+							 .dump(2)
+					  << "\n";
+		} else {
+			std::cout << "wrote " << out << ": " << result.entries << " definitions, " << result.meshes << " meshes";
+			if (!ec) {
+				std::cout << ", " << bytes << " bytes";
+			}
+			std::cout << " (" << seconds << " s)\n";
+		}
+		// A def that produced no mesh is baked collision-only and regenerates live
+		// (and fails again) in the game; surface that as a failure for CI.
+		return result.meshes == result.entries ? kOk : kFailure;
+	}
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -490,6 +537,9 @@ int main(int argc, char** argv) {
 	if (command == "render") {
 		return cmdRender(args);
 	}
+	if (command == "bake") {
+		return cmdBake(args);
+	}
 
 	std::cerr << "error: unknown command '" << command << "'\n\n" << kUsageText;
 	return kUsage;
@@ -0,0 +1,819 @@
+// sim-bench: headless colony simulation runner and throughput benchmark.
+//
+// Builds the colony simulation with no window (see SimHarness.h), spawns N
+// colonists plus scripted craft and build orders, and steps a fixed timestep
+// as fast as the CPU allows. One run per colonist count in the sweep.
+//
+// Usage:
+//   sim-bench [--colonists 10 | --sweep 10,100,1000] [--ticks 1800]
+//             [--warmup 120] [--dt 0.0166667] [--seed 12345] [--ai-seed 42]
+//             [--ai-budget-us 0] [--ai-serial]
+//             [--stations 1] [--craft-jobs 2] [--foundations 1]
+//             [--planet <file.wsplanet> --lat <deg> --lon <deg>]
+//             [--out <file.json>] [--baseline <file.json> --max-regression 0.1]
+//             [--save]
+//   sim-bench --record <journal.json> [scenario options] [--inject "<tick> <verb> k=v ..."]...
+//             [--hash-every 1]
+//   sim-bench --replay <journal.json> [--out <file.json>]
+//
+// Output (JSON, stdout or --out): per run, ticks/sec, tick-time mean/p50/p95/max,
+// per-system mean/max ms from World::getSystemTimings(), entity/chunk counts,
+// and peak RSS (process-wide high-water mark, so monotone across a sweep).
+// An "ai" block reports AIDecisionSystem evaluations per tick, time per
+// evaluation and evaluations deferred by --ai-budget-us.
+// --save adds a "save" block per run: main-thread capture, encode-to-bytes and
+// load times for a full colony save taken after the measured ticks.
+//
+// --baseline compares ticks/sec against a previous report, matched by colonist
+// count, and fails when any run is more than --max-regression slower.
+//
+// --record runs one scenario (a single colonist count) deterministically: navmesh
+// swaps block instead of racing the worker, and every --inject command (the dev
+// verbs SimHarness::applyCommand supports) is applied at the start of its tick.
+// Warmup and measured ticks are both journaled, numbered from 0. The journal
+// (see replay/Journal.h) keeps the scenario, the commands and a per-part state
+// hash every --hash-every ticks. --replay rebuilds the scenario from a journal,
+// re-applies its commands at max speed and checks each recorded hash, stopping at
+// the first tick and part (component pool, goals, ...) that differs.
+//
+// Exit codes: 0 ok, 1 setup failed, 2 regression vs baseline, 3 bad arguments,
+//             4 output error, 5 replay diverged from the journal.
+
+#include "SimHarness.h"
+
+#include <assets/AssetRegistry.h>
+#include <assets/placement/PlacementExecutor.h>
+#include <ecs/systems/AIDecisionSystem.h>
+#include <ecs/systems/TimeSystem.h>
+#include <metrics/SystemResources.h>
+#include <replay/Journal.h>
+#include <save/SaveGame.h>
+#include <utils/Log.h>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+	enum ExitCode { kOk = 0, kSetupFailed = 1, kRegression = 2, kBadArgs = 3, kOutputError = 4, kDiverged = 5 };
+
+	struct CliArgs {
+		std::vector<uint32_t> colonistCounts{10};
+		uint32_t			  ticks = 1800; // 30 s of game time at 60 Hz
+		uint32_t			  warmup = 120; // unmeasured ticks after the navmesh is up
+		float				  dt = 1.0F / 60.0F;
+		sim_bench::SimConfig  scenario;
+		std::string			  outPath;
+		std::string			  baselinePath;
+		double				  maxRegression = 0.10;
+		bool				  saveBench = false;
+		std::string			  recordPath;
+		std::string			  replayPath;
+		std::vector<engine::replay::Command> injections; // --record only, ascending tick
+		uint32_t			  hashEvery = 1;
+		bool				  help = false;
+	};
+
+	void printUsage(std::FILE* stream) {
+		std::fprintf(
+			stream,
+			"Usage: sim-bench [options]\n"
+			"  --colonists <int>      colonists in a single run (default 10)\n"
+			"  --sweep <list>         comma list of colonist counts, one run each\n"
+			"  --ticks <int>          measured ticks per run (default 1800)\n"
+			"  --warmup <int>         unmeasured ticks before measuring (default 120)\n"
+			"  --dt <float>           fixed timestep in seconds (default 1/60)\n"
+			"  --seed <uint64>        mock world seed (default 12345)\n"
+			"  --ai-seed <uint32>     AIDecisionSystem RNG seed (default 42)\n"
+			"  --ai-budget-us <int>   AI evaluation budget per tick in microseconds (default 0 = none)\n"
+			"  --ai-serial            score AI options on the main thread only (default: JobSystem workers)\n"
+			"  --stations <int>       CraftingSpot stations with queued jobs (default 1)\n"
+			"  --craft-jobs <int>     recipes queued per station (default 2)\n"
+			"  --foundations <int>    Wood foundation blueprints (default 1)\n"
+			"  --planet <path>        sample a .wsplanet instead of the mock world\n"
+			"  --lat/--lon <deg>      landing site on --planet (default 0, 0)\n"
+			"  --out <file>           write the JSON report here (default stdout)\n"
+			"  --baseline <file>      previous report to gate ticks/sec against\n"
+			"  --max-regression <f>   allowed ticks/sec drop vs baseline (default 0.1)\n"
+			"  --save                 also time a full save and load after each run\n"
+			"  --record <file>        deterministic run, journaling inputs and state hashes\n"
+			"  --inject <command>     with --record: \"<tick> <verb> key=value ...\" (repeatable)\n"
+			"  --hash-every <int>     with --record: ticks between state hashes (default 1)\n"
+			"  --replay <file>        re-run a journal, reporting the first divergent tick\n"
+		);
+	}
+
+	/// Whole-string unsigned decimal: no sign, no trailing text, no overflow.
+	bool parseUnsigned(const char* v, uint64_t max, uint64_t& out) {
+		if (*v < '0' || *v > '9') {
+			return false; // strtoull would skip spaces and wrap a leading '-'
+		}
+		errno = 0;
+		char*					 end = nullptr;
+		const unsigned long long x = std::strtoull(v, &end, 10);
+		if (*end != '\0' || errno == ERANGE || x > max) {
+			return false;
+		}
+		out = x;
+		return true;
+	}
+
+	bool parseU32(const char* v, uint32_t& out) {
+		uint64_t x = 0;
+		if (!parseUnsigned(v, UINT32_MAX, x)) {
+			return false;
+		}
+		out = static_cast<uint32_t>(x);
+		return true;
+	}
+
+	/// Whole-string finite real number.
+	bool parseReal(const char* v, double& out) {
+		errno = 0;
+		char*		 end = nullptr;
+		const double x = std::strtod(v, &end);
+		if (end == v || *end != '\0' || errno == ERANGE || !std::isfinite(x)) {
+			return false;
+		}
+		out = x;
+		return true;
+	}
+
+	bool parseCounts(const char* v, std::vector<uint32_t>& out) {
+		out.clear();
+		const char* p = v;
+		while (*p != '\0') {
+			if (*p < '0' || *p > '9') {
+				return false;
+			}
+			errno = 0;
+			char*				end = nullptr;
+			const unsigned long long x = std::strtoull(p, &end, 10);
+			if (x == 0 || x > UINT32_MAX || errno == ERANGE) {
+				return false;
+			}
+			out.push_back(static_cast<uint32_t>(x));
+			if (*end == ',') {
+				p = end + 1;
+			} else if (*end == '\0') {
+				p = end;
+			} else {
+				return false;
+			}
+		}
+		return !out.empty();
+	}
+
+	bool parseArgs(int argc, char** argv, CliArgs& out) {
+		for (int i = 1; i < argc; ++i) {
+			auto eq = [&](const char* flag) { return std::strcmp(argv[i], flag) == 0; };
+			auto next = [&]() -> const char* {
+				if (i + 1 >= argc) {
+					std::fprintf(stderr, "Missing value for %s\n", argv[i]);
+					return nullptr;
+				}
+				return argv[++i];
+			};
+			// Numeric values must parse whole: "10x" or "-1" is an error, not 10 or 4294967295
+			auto bad = [&](const char* what) {
+				std::fprintf(stderr, "%s expects %s, got \"%s\"\n", argv[i - 1], what, argv[i]);
+				return false;
+			};
+			auto u32 = [&](uint32_t& field) {
+				const char* v = next();
+				return v != nullptr && (parseU32(v, field) || bad("a non-negative integer"));
+			};
+			auto real = [&](double& field) {
+				const char* v = next();
+				return v != nullptr && (parseReal(v, field) || bad("a number"));
+			};
+
+			const char* v = nullptr;
+			if (eq("--help") || eq("-h")) {
+				out.help = true;
+				return true;
+			}
+			if (eq("--colonists") || eq("--sweep")) {
+				if ((v = next()) == nullptr || !parseCounts(v, out.colonistCounts)) {
+					std::fprintf(stderr, "%s expects positive counts (e.g. 10,100,1000)\n", argv[i - 1]);
+					return false;
+				}
+			} else if (eq("--ticks")) {
+				if (!u32(out.ticks)) return false;
+			} else if (eq("--warmup")) {
+				if (!u32(out.warmup)) return false;
+			} else if (eq("--dt")) {
+				double dt = 0.0;
+				if (!real(dt)) return false;
+				out.dt = static_cast<float>(dt);
+			} else if (eq("--seed")) {
+				if ((v = next()) == nullptr) return false;
+				if (!parseUnsigned(v, UINT64_MAX, out.scenario.worldSeed)) return bad("a non-negative integer");
+			} else if (eq("--ai-seed")) {
+				if (!u32(out.scenario.aiSeed)) return false;
+			} else if (eq("--ai-budget-us")) {
+				if (!u32(out.scenario.aiBudgetMicros)) return false;
+			} else if (eq("--ai-serial")) {
+				out.scenario.parallelAIScoring = false;
+			} else if (eq("--stations")) {
+				if (!u32(out.scenario.stations)) return false;
+			} else if (eq("--craft-jobs")) {
+				if (!u32(out.scenario.craftJobs)) return false;
+			} else if (eq("--foundations")) {
+				if (!u32(out.scenario.foundations)) return false;
+			} else if (eq("--planet")) {
+				if ((v = next()) == nullptr) return false;
+				out.scenario.planetPath = v;
+			} else if (eq("--lat")) {
+				if (!real(out.scenario.landingLatDeg)) return false;
+			} else if (eq("--lon")) {
+				if (!real(out.scenario.landingLonDeg)) return false;
+			} else if (eq("--out")) {
+				if ((v = next()) == nullptr) return false;
+				out.outPath = v;
+			} else if (eq("--baseline")) {
+				if ((v = next()) == nullptr) return false;
+				out.baselinePath = v;
+			} else if (eq("--max-regression")) {
+				if (!real(out.maxRegression)) return false;
+			} else if (eq("--save")) {
+				out.saveBench = true;
+			} else if (eq("--record")) {
+				if ((v = next()) == nullptr) return false;
+				out.recordPath = v;
+			} else if (eq("--replay")) {
+				if ((v = next()) == nullptr) return false;
+				out.replayPath = v;
+			} else if (eq("--inject")) {
+				if ((v = next()) == nullptr) return false;
+				auto command = engine::replay::parseCommand(v);
+				if (!command) {
+					std::fprintf(stderr, "--inject expects \"<tick> <verb> key=value ...\", got \"%s\"\n", v);
+					return false;
+				}
+				out.injections.push_back(std::move(*command));
+			} else if (eq("--hash-every")) {
+				if (!u32(out.hashEvery)) return false;
+			} else {
+				std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+				return false;
+			}
+		}
+		if (out.ticks == 0 || out.dt <= 0.0F) {
+			std::fprintf(stderr, "--ticks and --dt must be positive\n");
+			return false;
+		}
+		if (!out.recordPath.empty() || !out.replayPath.empty()) {
+			if (!out.recordPath.empty() && !out.replayPath.empty()) {
+				std::fprintf(stderr, "--record and --replay are exclusive\n");
+				return false;
+			}
+			if (out.colonistCounts.size() != 1 || !out.baselinePath.empty() || out.saveBench) {
+				std::fprintf(stderr, "--record/--replay take a single --colonists count, without --baseline or --save\n");
+				return false;
+			}
+			if (out.scenario.aiBudgetMicros != 0) {
+				// Which evaluations fit the budget depends on wall-clock time.
+				std::fprintf(stderr, "--ai-budget-us is not deterministic; it can't be recorded or replayed\n");
+				return false;
+			}
+			if (out.hashEvery == 0) {
+				std::fprintf(stderr, "--hash-every must be positive\n");
+				return false;
+			}
+		}
+		if (!out.injections.empty()) {
+			if (out.recordPath.empty()) {
+				std::fprintf(stderr, "--inject needs --record\n");
+				return false;
+			}
+			std::stable_sort(out.injections.begin(), out.injections.end(), [](const auto& a, const auto& b) {
+				return a.tick < b.tick;
+			});
+			if (out.injections.back().tick >= static_cast<uint64_t>(out.warmup) + out.ticks) {
+				std::fprintf(stderr, "--inject tick %" PRIu64 " is past the last tick\n", out.injections.back().tick);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// Per-system accumulator over the measured ticks.
+	struct SystemStats {
+		double	 totalMs = 0.0;
+		float	 maxMs = 0.0F;
+		uint32_t samples = 0;
+	};
+
+	/// AIDecisionSystem evaluation accumulator over the measured ticks.
+	struct AIStats {
+		uint64_t evaluations = 0;
+		uint32_t maxPerTick = 0;
+		uint64_t deferred = 0;
+		double	 totalMicros = 0.0;
+		float	 maxMicros = 0.0F;
+	};
+
+	double percentile(std::vector<float> sorted, double p) {
+		if (sorted.empty()) {
+			return 0.0;
+		}
+		std::sort(sorted.begin(), sorted.end());
+		const auto idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+		return sorted[std::min(idx, sorted.size() - 1)];
+	}
+
+	/// Save the harness state to memory and load it into a fresh world, timing each
+	/// stage. Loading replaces the GoalTaskRegistry singleton's contents, so this
+	/// runs last, after the harness has finished stepping.
+	bool benchSave(const sim_bench::SimHarness& harness, json& out) {
+		using Clock = std::chrono::steady_clock;
+
+		const engine::save::Snapshot snapshot =
+			engine::save::captureSnapshot(harness.ecsWorld(), harness.construction(), harness.placement());
+
+		std::ostringstream encoded(std::ios::binary);
+		const auto		   writeStart = Clock::now();
+		if (!engine::save::writeSnapshot(snapshot, encoded)) {
+			std::fprintf(stderr, "sim-bench: save failed\n");
+			return false;
+		}
+		const double writeMs = std::chrono::duration<double, std::milli>(Clock::now() - writeStart).count();
+		const std::string bytes = encoded.str();
+
+		ecs::World world;
+		world.registerSystem<ecs::TimeSystem>();
+		engine::construction::ConstructionWorld construction;
+		engine::assets::PlacementExecutor		placement(engine::assets::AssetRegistry::Get());
+		std::istringstream						in(bytes, std::ios::binary);
+		const engine::save::LoadResult			loaded = engine::save::loadSave(in, world, construction, &placement);
+		if (!loaded.ok) {
+			std::fprintf(stderr, "sim-bench: load failed: %s\n", loaded.error.c_str());
+			return false;
+		}
+
+		out = {
+			{"bytes", bytes.size()},
+			{"entities", snapshot.entities},
+			{"captureMs", snapshot.captureMs},
+			{"writeMs", writeMs},
+			{"loadMs", loaded.loadMs},
+		};
+		std::fprintf(
+			stderr,
+			"sim-bench: %4u colonists  save %.2f ms capture + %.2f ms write (%zu KB)  load %.2f ms\n",
+			harness.colonistCount(),
+			static_cast<double>(snapshot.captureMs),
+			writeMs,
+			bytes.size() / 1024,
+			static_cast<double>(loaded.loadMs)
+		);
+		return true;
+	}
+
+	/// One run: build the scenario, warm up, then time `ticks` fixed steps.
+	bool runOne(const CliArgs& args, uint32_t colonists, json& out) {
+		using Clock = std::chrono::steady_clock;
+
+		sim_bench::SimConfig scenario = args.scenario;
+		scenario.colonists = colonists;
+
+		const auto				setupStart = Clock::now();
+		sim_bench::SimHarness	harness;
+		std::string				error;
+		if (!harness.setup(scenario, error)) {
+			std::fprintf(stderr, "sim-bench: setup failed: %s\n", error.c_str());
+			return false;
+		}
+		const bool navReady = harness.waitForNavigation();
+		const double setupSeconds = std::chrono::duration<double>(Clock::now() - setupStart).count();
+		if (!navReady) {
+			std::fprintf(stderr, "sim-bench: warning: no navmesh after setup; colonists will hold in place\n");
+		}
+
+		for (uint32_t t = 0; t < args.warmup; ++t) {
+			harness.step(args.dt);
+		}
+
+		std::vector<float>					tickMs;
+		std::map<std::string, SystemStats>	systems;
+		std::vector<std::string>			systemOrder;
+		AIStats								ai;
+		tickMs.reserve(args.ticks);
+		const auto& aiSystem = harness.ecsWorld().getSystem<ecs::AIDecisionSystem>();
+
+		const auto runStart = Clock::now();
+		for (uint32_t t = 0; t < args.ticks; ++t) {
+			const auto tickStart = Clock::now();
+			harness.step(args.dt);
+			tickMs.push_back(std::chrono::duration<float, std::milli>(Clock::now() - tickStart).count());
+
+			for (const auto& timing : harness.ecsWorld().getSystemTimings()) {
+				auto [it, inserted] = systems.try_emplace(timing.name);
+				if (inserted) {
+					systemOrder.emplace_back(timing.name);
+				}
+				it->second.totalMs += timing.durationMs;
+				it->second.maxMs = std::max(it->second.maxMs, timing.durationMs);
+				++it->second.samples;
+			}
+
+			const auto& evals = aiSystem.lastEvaluationStats();
+			ai.evaluations += evals.evaluated;
+			ai.maxPerTick = std::max(ai.maxPerTick, evals.evaluated);
+			ai.deferred += evals.deferred;
+			ai.totalMicros += evals.totalMicros;
+			ai.maxMicros = std::max(ai.maxMicros, evals.maxMicros);
+		}
+		const double runSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+
+		double totalTickMs = 0.0;
+		for (float ms : tickMs) {
+			totalTickMs += ms;
+		}
+
+		json systemsJson = json::array();
+		for (const auto& name : systemOrder) {
+			const SystemStats& s = systems[name];
+			systemsJson.push_back({
+				{"name", name},
+				{"meanMs", s.samples > 0 ? s.totalMs / s.samples : 0.0},
+				{"maxMs", s.maxMs},
+				{"totalMs", s.totalMs},
+			});
+		}
+
+		const auto	 mem = Foundation::SystemResources::sampleMemory();
+		const double mb = 1024.0 * 1024.0;
+		out = {
+			{"colonists", harness.colonistCount()},
+			{"requestedColonists", colonists},
+			{"ticks", args.ticks},
+			{"dt", args.dt},
+			{"setupSeconds", setupSeconds},
+			{"navReady", navReady},
+			{"wallSeconds", runSeconds},
+			{"ticksPerSecond", runSeconds > 0.0 ? static_cast<double>(args.ticks) / runSeconds : 0.0},
+			{"simSecondsPerSecond", runSeconds > 0.0 ? static_cast<double>(args.ticks) * args.dt / runSeconds : 0.0},
+			{"tickMs",
+			 {{"mean", totalTickMs / static_cast<double>(tickMs.size())},
+			  {"p50", percentile(tickMs, 0.50)},
+			  {"p95", percentile(tickMs, 0.95)},
+			  {"max", percentile(tickMs, 1.0)}}},
+			{"systems", systemsJson},
+			{"ai",
+			 {{"budgetMicros", scenario.aiBudgetMicros},
+			  {"parallelScoring", scenario.parallelAIScoring},
+			  {"evaluationsPerTick", static_cast<double>(ai.evaluations) / static_cast<double>(args.ticks)},
+			  {"maxEvaluationsPerTick", ai.maxPerTick},
+			  {"meanEvaluationMicros", ai.evaluations > 0 ? ai.totalMicros / static_cast<double>(ai.evaluations) : 0.0},
+			  {"maxEvaluationMicros", ai.maxMicros},
+			  {"deferred", ai.deferred}}},
+			{"entities", harness.entityCount()},
+			{"chunks", harness.loadedChunkCount()},
+			{"rssMB", static_cast<double>(mem.memoryUsedBytes) / mb},
+			{"peakRssMB", static_cast<double>(mem.memoryPeakBytes) / mb},
+		};
+
+		std::fprintf(
+			stderr,
+			"sim-bench: %4u colonists  %8.1f ticks/s  p95 %.2f ms  peak RSS %.0f MB\n",
+			harness.colonistCount(),
+			out["ticksPerSecond"].get<double>(),
+			out["tickMs"]["p95"].get<double>(),
+			out["peakRssMB"].get<double>()
+		);
+
+		if (args.saveBench) {
+			json save;
+			if (!benchSave(harness, save)) {
+				return false;
+			}
+			out["save"] = std::move(save);
+		}
+		return true;
+	}
+
+	// --- Record / replay -------------------------------------------------------
+
+	/// Scenario settings a replay needs to rebuild the recorded run exactly.
+	void describeScenario(const CliArgs& args, engine::replay::Journal& journal) {
+		const sim_bench::SimConfig& sc = args.scenario;
+		auto						real = [](const char* format, double value) {
+			char buf[64];
+			std::snprintf(buf, sizeof(buf), format, value);
+			return std::string(buf);
+		};
+		journal.setMeta("tool", "sim-bench");
+		journal.setMeta("worldSeed", std::to_string(sc.worldSeed));
+		journal.setMeta("planet", sc.planetPath);
+		journal.setMeta("lat", real("%.17g", sc.landingLatDeg));
+		journal.setMeta("lon", real("%.17g", sc.landingLonDeg));
+		journal.setMeta("aiSeed", std::to_string(sc.aiSeed));
+		journal.setMeta("actionSeed", std::to_string(sc.actionSeed));
+		journal.setMeta("colonists", std::to_string(args.colonistCounts.front()));
+		journal.setMeta("stations", std::to_string(sc.stations));
+		journal.setMeta("craftJobs", std::to_string(sc.craftJobs));
+		journal.setMeta("foundations", std::to_string(sc.foundations));
+		journal.setMeta("chunkLoadRadius", std::to_string(sc.chunkLoadRadius));
+		journal.setMeta("dt", real("%.9g", static_cast<double>(args.dt))); // round-trips a float exactly
+		journal.setMeta("warmup", std::to_string(args.warmup));
+		journal.setMeta("ticks", std::to_string(args.ticks));
+		journal.setMeta("hashEvery", std::to_string(args.hashEvery));
+	}
+
+	/// Inverse of describeScenario.
+	bool scenarioFromJournal(const engine::replay::Journal& journal, CliArgs& args) {
+		if (journal.metaValue("tool") != "sim-bench") {
+			return false;
+		}
+		auto u32 = [&](const char* key) { return static_cast<uint32_t>(std::strtoul(journal.metaValue(key).c_str(), nullptr, 10)); };
+		sim_bench::SimConfig& sc = args.scenario;
+		sc.worldSeed = std::strtoull(journal.metaValue("worldSeed").c_str(), nullptr, 10);
+		sc.planetPath = journal.metaValue("planet");
+		sc.landingLatDeg = std::strtod(journal.metaValue("lat").c_str(), nullptr);
+		sc.landingLonDeg = std::strtod(journal.metaValue("lon").c_str(), nullptr);
+		sc.aiSeed = u32("aiSeed");
+		sc.actionSeed = u32("actionSeed");
+		sc.stations = u32("stations");
+		sc.craftJobs = u32("craftJobs");
+		sc.foundations = u32("foundations");
+		sc.chunkLoadRadius = static_cast<int32_t>(std::strtol(journal.metaValue("chunkLoadRadius").c_str(), nullptr, 10));
+		args.colonistCounts = {u32("colonists")};
+		args.dt = std::strtof(journal.metaValue("dt").c_str(), nullptr);
+		args.warmup = u32("warmup");
+		args.ticks = u32("ticks");
+		args.hashEvery = u32("hashEvery");
+		return args.colonistCounts.front() > 0 && args.dt > 0.0F && args.ticks > 0 && args.hashEvery > 0;
+	}
+
+	/// Record or replay one deterministic run. Returns an ExitCode; `out` gets the
+	/// report whenever the run got past setup.
+	int runJournal(CliArgs args, json& out) {
+		using Clock = std::chrono::steady_clock;
+		namespace replay = engine::replay;
+
+		const bool		replaying = !args.replayPath.empty();
+		const std::string& path = replaying ? args.replayPath : args.recordPath;
+		replay::Journal journal;
+		if (replaying) {
+			std::string error;
+			if (!replay::readJournal(std::filesystem::path(path), journal, error)) {
+				std::fprintf(stderr, "sim-bench: %s: %s\n", path.c_str(), error.c_str());
+				return kBadArgs;
+			}
+			if (!scenarioFromJournal(journal, args)) {
+				std::fprintf(stderr, "sim-bench: %s was not recorded by sim-bench\n", path.c_str());
+				return kBadArgs;
+			}
+		} else {
+			describeScenario(args, journal);
+			journal.commands = args.injections;
+		}
+
+		sim_bench::SimConfig scenario = args.scenario;
+		scenario.colonists = args.colonistCounts.front();
+		scenario.blockingNavBuilds = true;
+
+		sim_bench::SimHarness harness;
+		std::string			  error;
+		if (!harness.setup(scenario, error)) {
+			std::fprintf(stderr, "sim-bench: setup failed: %s\n", error.c_str());
+			return kSetupFailed;
+		}
+		const bool navReady = harness.waitForNavigation();
+
+		const uint64_t					 totalTicks = static_cast<uint64_t>(args.warmup) + args.ticks;
+		size_t							 nextCommand = 0;
+		size_t							 nextHash = 0;
+		double							 hashMs = 0.0;
+		std::optional<replay::Divergence> divergence;
+
+		const auto runStart = Clock::now();
+		for (uint64_t tick = 0; tick < totalTicks && !divergence; ++tick) {
+			for (; nextCommand < journal.commands.size() && journal.commands[nextCommand].tick == tick; ++nextCommand) {
+				const replay::Command& command = journal.commands[nextCommand];
+				if (!harness.applyCommand(command, error)) {
+					std::fprintf(stderr, "sim-bench: command \"%s\" failed: %s\n", command.toString().c_str(), error.c_str());
+					if (!replaying) {
+						return kBadArgs; // the journal only keeps commands that applied
+					}
+					divergence = replay::Divergence{tick, "command " + command.verb, 0, 0};
+					break;
+				}
+			}
+			if (divergence) {
+				break;
+			}
+			harness.step(args.dt);
+
+			const bool hashDue = replaying ? nextHash < journal.ticks.size() && journal.ticks[nextHash].tick == tick
+										   : (tick + 1) % args.hashEvery == 0 || tick + 1 == totalTicks;
+			if (hashDue) {
+				const auto hashStart = Clock::now();
+				const auto state = engine::save::hashState(harness.ecsWorld(), harness.construction());
+				hashMs += std::chrono::duration<double, std::milli>(Clock::now() - hashStart).count();
+				if (replaying) {
+					divergence = journal.compare(nextHash++, state);
+				} else {
+					journal.recordHashes(tick, state);
+				}
+			}
+		}
+		const double runSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+
+		if (!replaying && !replay::writeJournal(journal, std::filesystem::path(path))) {
+			std::fprintf(stderr, "sim-bench: cannot write %s\n", path.c_str());
+			return kOutputError;
+		}
+
+		out = {
+			{"tool", "sim-bench"},
+			{"mode", replaying ? "replay" : "record"},
+			{"journal", path},
+			{"colonists", harness.colonistCount()},
+			{"ticks", totalTicks},
+			{"dt", args.dt},
+			{"navReady", navReady},
+			{"commands", journal.commands.size()},
+			{"hashedTicks", replaying ? nextHash : journal.ticks.size()},
+			{"hashMs", hashMs},
+			{"wallSeconds", runSeconds},
+			{"ticksPerSecond", runSeconds > 0.0 ? static_cast<double>(totalTicks) / runSeconds : 0.0},
+			{"diverged", nullptr},
+		};
+
+		if (divergence) {
+			out["diverged"] = {
+				{"tick", divergence->tick},
+				{"part", divergence->part},
+				{"expected", divergence->expected},
+				{"actual", divergence->actual},
+			};
+			std::fprintf(
+				stderr,
+				"sim-bench: replay diverged at tick %" PRIu64 " in %s (expected %016" PRIx64 ", got %016" PRIx64 ")\n",
+				divergence->tick,
+				divergence->part.c_str(),
+				divergence->expected,
+				divergence->actual
+			);
+			return kDiverged;
+		}
+		if (replaying && nextHash != journal.ticks.size()) {
+			std::fprintf(stderr, "sim-bench: replay ended before the journal's last hashed tick\n");
+			return kDiverged;
+		}
+		std::fprintf(
+			stderr,
+			"sim-bench: %s %" PRIu64 " ticks, %zu commands, %.1f ticks/s (%.1f ms hashing)\n",
+			replaying ? "replayed" : "recorded",
+			totalTicks,
+			journal.commands.size(),
+			out["ticksPerSecond"].get<double>(),
+			hashMs
+		);
+		return kOk;
+	}
+
+	/// Compare ticks/sec per colonist count against a previous report.
+	bool checkBaseline(const CliArgs& args, const json& report) {
+		std::ifstream in(args.baselinePath);
+		if (!in) {
+			std::fprintf(stderr, "sim-bench: cannot read baseline %s\n", args.baselinePath.c_str());
+			return false;
+		}
+		const json baseline = json::parse(in, nullptr, /*allow_exceptions=*/false);
+		if (baseline.is_discarded() || !baseline.contains("runs")) {
+			std::fprintf(stderr, "sim-bench: %s is not a sim-bench report\n", args.baselinePath.c_str());
+			return false;
+		}
+
+		bool ok = true;
+		for (const auto& run : report["runs"]) {
+			for (const auto& base : baseline["runs"]) {
+				if (base.value("requestedColonists", 0U) != run["requestedColonists"].get<uint32_t>()) {
+					continue;
+				}
+				const double was = base.value("ticksPerSecond", 0.0);
+				const double now = run["ticksPerSecond"].get<double>();
+				const double floor = was * (1.0 - args.maxRegression);
+				const bool	 pass = now >= floor;
+				std::fprintf(
+					stderr,
+					"sim-bench: %4u colonists  %8.1f ticks/s vs baseline %8.1f  %s\n",
+					run["requestedColonists"].get<uint32_t>(),
+					now,
+					was,
+					pass ? "ok" : "REGRESSED"
+				);
+				ok = ok && pass;
+			}
+		}
+		return ok;
+	}
+
+	/// Everything after argument parsing; main() brackets it with the logger's lifetime.
+	int runBench(const CliArgs& args) {
+		std::string error;
+		if (!sim_bench::loadGameData(error)) {
+			std::fprintf(stderr, "sim-bench: %s\n", error.c_str());
+			return kSetupFailed;
+		}
+
+		if (!args.recordPath.empty() || !args.replayPath.empty()) {
+			json	  report;
+			const int code = runJournal(args, report);
+			if (!report.is_null()) {
+				if (args.outPath.empty()) {
+					std::cout << report.dump(2) << "\n";
+				} else {
+					std::ofstream file(args.outPath);
+					if (!file || !(file << report.dump(2) << "\n")) {
+						std::fprintf(stderr, "sim-bench: cannot write %s\n", args.outPath.c_str());
+						return kOutputError;
+					}
+				}
+			}
+			return code;
+		}
+
+		json runs = json::array();
+		for (uint32_t colonists : args.colonistCounts) {
+			json run;
+			if (!runOne(args, colonists, run)) {
+				return kSetupFailed;
+			}
+			runs.push_back(std::move(run));
+		}
+
+		const json report = {
+			{"tool", "sim-bench"},
+			{"worldSeed", args.scenario.planetPath.empty() ? json(args.scenario.worldSeed) : json(nullptr)},
+			{"planet", args.scenario.planetPath},
+			{"aiSeed", args.scenario.aiSeed},
+			{"stations", args.scenario.stations},
+			{"craftJobs", args.scenario.craftJobs},
+			{"foundations", args.scenario.foundations},
+			{"runs", runs},
+		};
+
+		if (args.outPath.empty()) {
+			std::cout << report.dump(2) << "\n";
+		} else {
+			std::ofstream file(args.outPath);
+			if (!file || !(file << report.dump(2) << "\n")) {
+				std::fprintf(stderr, "sim-bench: cannot write %s\n", args.outPath.c_str());
+				return kOutputError;
+			}
+		}
+
+		if (!args.baselinePath.empty() && !checkBaseline(args, report)) {
+			return kRegression;
+		}
+		return kOk;
+	}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	CliArgs args;
+	if (!parseArgs(argc, argv, args)) {
+		printUsage(stderr);
+		return kBadArgs;
+	}
+	if (args.help) {
+		printUsage(stdout);
+		return kOk;
+	}
+
+	// Keep the report clean: the logger writes to stdout, and the systems log
+	// every spawn and decision at Info.
+	foundation::Logger::initialize();
+	for (int c = 0; c < static_cast<int>(foundation::LogCategory::Count); ++c) {
+		foundation::Logger::setLevel(static_cast<foundation::LogCategory>(c), foundation::LogLevel::Error);
+	}
+
+	const int code = runBench(args);
+	foundation::Logger::shutdown();
+	return code;
+}
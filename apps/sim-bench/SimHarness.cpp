@@ -0,0 +1,366 @@
+#include "SimHarness.h"
+
+#include <assets/ActionTypeRegistry.h>
+#include <assets/AssetRegistry.h>
+#include <assets/ConfigValidator.h>
+#include <assets/ConstructionRegistry.h>
+#include <assets/PriorityConfig.h>
+#include <assets/RecipeRegistry.h>
+#include <assets/TaskChainRegistry.h>
+#include <assets/WorkTypeRegistry.h>
+#include <assets/placement/AsyncChunkProcessor.h>
+#include <assets/placement/PlacementExecutor.h>
+
+#include <ecs/GoalTaskRegistry.h>
+#include <ecs/components/Transform.h>
+#include <ecs/components/WorkQueue.h>
+#include <ecs/systems/AIDecisionSystem.h>
+#include <ecs/systems/ActionSystem.h>
+#include <ecs/systems/ConstructionSystem.h>
+#include <ecs/systems/NavigationSystem.h>
+
+#include <replay/Journal.h>
+#include <replay/SimCommands.h>
+#include <utils/Log.h>
+#include <utils/ResourcePath.h>
+#include <world/Biome.h>
+#include <world/chunk/Chunk.h>
+#include <world/chunk/ChunkManager.h>
+#include <world/chunk/GeneratedWorldSampler.h>
+#include <world/chunk/MockWorldSampler.h>
+#include <worldgen/io/PlanetIO.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <utility>
+
+namespace sim_bench {
+
+	namespace {
+
+		constexpr float kGoldenAngle = 2.39996323F; // ~137.5 deg, spreads spiral points evenly
+		constexpr float kColonistSpacing = 1.5F;	// meters between neighboring spawn points
+
+		/// Point i of a golden-angle (sunflower) spiral: an even disc fill whose radius
+		/// grows with sqrt(i), so the colony stays compact at any size.
+		glm::vec2 spiralPoint(glm::vec2 center, uint32_t i, float spacing) {
+			const float r = spacing * std::sqrt(static_cast<float>(i) + 0.5F);
+			const float a = static_cast<float>(i) * kGoldenAngle;
+			return center + glm::vec2{r * std::cos(a), r * std::sin(a)};
+		}
+
+	} // namespace
+
+	bool loadGameData(std::string& error) {
+		using namespace engine::assets;
+
+		const std::string assetsRoot = Foundation::findResourceString("assets/world");
+		if (assetsRoot.empty()) {
+			error = "could not locate assets/world (run next to the staged exe or from the repo root)";
+			return false;
+		}
+		const std::string shared = Foundation::findResourceString("assets/shared/scripts");
+		if (!shared.empty()) {
+			AssetRegistry::Get().setSharedScriptsPath(shared);
+		}
+		AssetRegistry::Get().loadDefinitionsFromFolder(assetsRoot);
+
+		const std::string recipes = Foundation::findResourceString("assets/recipes");
+		if (!recipes.empty()) {
+			RecipeRegistry::Get().loadRecipesFromFolder(recipes);
+		}
+
+		// Same files, order and validation as GameLoadingScene::loadWorkConfigs.
+		const std::string configRoot = Foundation::findResourceString("assets/config");
+		if (configRoot.empty()) {
+			error = "could not locate assets/config";
+			return false;
+		}
+		const std::string base = configRoot + "/";
+		ConfigValidator::clearErrors();
+		ecs::GoalTaskRegistry::Get().clear();
+		if (!ActionTypeRegistry::Get().loadFromFile(base + "actions/action-types.xml")) {
+			error = "failed to load action-types.xml";
+			return false;
+		}
+		if (!TaskChainRegistry::Get().loadFromFile(base + "work/task-chains.xml")) {
+			error = "failed to load task-chains.xml";
+			return false;
+		}
+		if (!WorkTypeRegistry::Get().loadFromFile(base + "work/work-types.xml")) {
+			error = "failed to load work-types.xml";
+			return false;
+		}
+		if (!PriorityConfig::Get().loadFromFile(base + "work/priority-tuning.xml")) {
+			error = "failed to load priority-tuning.xml";
+			return false;
+		}
+		if (!ConstructionRegistry::Get().load(base + "construction")) {
+			error = "failed to load construction config";
+			return false;
+		}
+		if (!ConfigValidator::validateAll()) {
+			error = "config validation failed";
+			return false;
+		}
+		return true;
+	}
+
+	SimHarness::SimHarness() = default;
+
+	SimHarness::~SimHarness() {
+		// Systems hold raw pointers into the chunk manager and placement data.
+		world.reset();
+		ecs::GoalTaskRegistry::Get().clear();
+	}
+
+	bool SimHarness::setup(const SimConfig& config, std::string& error) {
+		// Goals are a process-wide registry; a previous harness's goals must not leak in.
+		ecs::GoalTaskRegistry::Get().clear();
+
+		std::unique_ptr<engine::world::IWorldSampler> sampler;
+		if (config.planetPath.empty()) {
+			sampler = std::make_unique<engine::world::MockWorldSampler>(config.worldSeed);
+		} else {
+			auto planet = worldgen::loadPlanet(config.planetPath);
+			if (!planet) {
+				error = "could not load planet " + config.planetPath;
+				return false;
+			}
+			// The landing site maps to the 2D world origin.
+			sampler = std::make_unique<engine::world::GeneratedWorldSampler>(
+				std::move(planet), config.landingLatDeg, config.landingLonDeg
+			);
+		}
+		const uint64_t placementSeed = sampler->getWorldSeed();
+		chunkManager = std::make_unique<engine::world::ChunkManager>(std::move(sampler));
+
+		placementExecutor = std::make_unique<engine::assets::PlacementExecutor>(engine::assets::AssetRegistry::Get());
+		placementExecutor->initialize();
+
+		if (!loadChunks(config.chunkLoadRadius, error)) {
+			return false;
+		}
+
+		// Flora placement, synchronously and in coordinate order (the game's async
+		// processor completes in whatever order the workers finish).
+		std::vector<const engine::world::Chunk*> chunks = std::as_const(*chunkManager).getLoadedChunks();
+		std::sort(chunks.begin(), chunks.end(), [](const engine::world::Chunk* a, const engine::world::Chunk* b) {
+			const auto ca = a->coordinate();
+			const auto cb = b->coordinate();
+			return ca.y != cb.y ? ca.y < cb.y : ca.x < cb.x;
+		});
+		for (const engine::world::Chunk* chunk : chunks) {
+			const auto				  snapshot = engine::assets::captureChunkData(chunk);
+			engine::assets::ChunkPlacementContext ctx;
+			ctx.coord = snapshot.coord;
+			ctx.worldSeed = placementSeed;
+			ctx.getBiome = [&snapshot](uint16_t x, uint16_t y) { return snapshot.biomes[y * engine::world::kChunkSize + x]; };
+			ctx.getSurface = [&snapshot](uint16_t x, uint16_t y) {
+				return engine::world::surfaceToString(snapshot.surfaces[y * engine::world::kChunkSize + x]);
+			};
+			placementExecutor->storeChunkResult(placementExecutor->computeChunkEntities(ctx, placementExecutor.get()));
+			processedChunks.insert(snapshot.coord);
+		}
+
+		origin = nearestLand({0.0F, 0.0F});
+
+		world = std::make_unique<ecs::World>();
+		registerSystems(config);
+		wireCallbacks();
+		spawnScenario(config);
+		drainDeferred();
+		return true;
+	}
+
+	bool SimHarness::loadChunks(int32_t radius, std::string& error) {
+		chunkManager->setLoadRadius(radius);
+		chunkManager->setUnloadRadius(radius + 2);
+
+		// Tile generation runs on workers; wait for every loaded chunk.
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+		while (std::chrono::steady_clock::now() < deadline) {
+			chunkManager->update({0.0F, 0.0F});
+			const auto loaded = std::as_const(*chunkManager).getLoadedChunks();
+			const bool ready = std::all_of(loaded.begin(), loaded.end(), [](const engine::world::Chunk* c) { return c->isReady(); });
+			if (!loaded.empty() && ready) {
+				return true;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		error = "timed out generating chunks";
+		return false;
+	}
+
+	void SimHarness::registerSystems(const SimConfig& config) {
+		// GameScene::initializeECS builds its world through the same calls, plus the render system
+		ecs::registerColonySystems(
+			*world,
+			{chunkManager.get(), placementExecutor.get(), &processedChunks},
+			{config.aiSeed, config.actionSeed, config.aiBudgetMicros}
+		);
+		ecs::setColonyConstructionWorld(*world, &constructionWorld);
+
+		world->getSystem<ecs::NavigationSystem>().setBlockingBuilds(config.blockingNavBuilds);
+		auto& ai = world->getSystem<ecs::AIDecisionSystem>();
+		ai.setColonyOrigin(origin);
+		ai.setParallelScoring(config.parallelAIScoring);
+	}
+
+	void SimHarness::wireCallbacks() {
+		// Spawns and removals from inside a system's view loop are queued in `deferred`
+		// and applied by drainDeferred, as in GameScene; only its toasts are missing here.
+		ecs::wireColonyCallbacks(*world, *placementExecutor, deferred);
+
+		auto& actions = world->getSystem<ecs::ActionSystem>();
+		auto& construction = world->getSystem<ecs::ConstructionSystem>();
+		auto  structureCompleted = [this](ecs::EntityID blueprintEntity) {
+			 ecs::completeStructure(*world, constructionWorld, blueprintEntity);
+		};
+		actions.setStructureCompletedCallback(structureCompleted);
+		construction.setStructureCompletedCallback(structureCompleted);
+
+		auto structureDeconstructed = [this](ecs::EntityID blueprintEntity) {
+			ecs::tearDownStructure(*world, constructionWorld, blueprintEntity, deferred);
+		};
+		actions.setStructureDeconstructedCallback(structureDeconstructed);
+		construction.setStructureDeconstructedCallback(structureDeconstructed);
+	}
+
+	void SimHarness::spawnScenario(const SimConfig& config) {
+		// Colonists fill a spiral around the origin, skipping water.
+		uint32_t slot = 0;
+		const uint32_t maxSlots = config.colonists * 8 + 64;
+		while (spawnedColonists < config.colonists && slot < maxSlots) {
+			const glm::vec2 at = spiralPoint(origin, slot++, kColonistSpacing);
+			if (isWaterAt(at)) {
+				continue;
+			}
+			ecs::spawnColonist(*world, at, "Colonist " + std::to_string(spawnedColonists + 1));
+			++spawnedColonists;
+		}
+
+		// Orders sit on a ring just outside the colonists, so workers walk to them.
+		const float ringRadius = kColonistSpacing * std::sqrt(static_cast<float>(config.colonists) + 1.0F) + 8.0F;
+
+		const auto recipes = engine::assets::RecipeRegistry::Get().getRecipesForStation("CraftingSpot");
+		for (uint32_t i = 0; i < config.stations; ++i) {
+			const float		angle = static_cast<float>(i) * kGoldenAngle;
+			const glm::vec2 at = nearestLand(origin + ringRadius * glm::vec2{std::cos(angle), std::sin(angle)});
+			const ecs::EntityID station = ecs::spawnPlacedEntity(*world, placementExecutor.get(), "CraftingSpot", at);
+			if (auto* queue = world->getComponent<ecs::WorkQueue>(station); queue != nullptr && !recipes.empty()) {
+				for (uint32_t j = 0; j < config.craftJobs; ++j) {
+					queue->addJob(recipes[(i + j) % recipes.size()]->defName, 1);
+				}
+			}
+		}
+
+		constexpr float kFoundationSize = 4.0F;
+		for (uint32_t i = 0; i < config.foundations; ++i) {
+			const float		angle = static_cast<float>(i) * kGoldenAngle + 1.0F;
+			const glm::vec2 at = nearestLand(origin + (ringRadius + 6.0F) * glm::vec2{std::cos(angle), std::sin(angle)});
+			spawnFoundation(at, kFoundationSize, "Wood");
+		}
+	}
+
+	bool SimHarness::waitForNavigation(int maxMs) {
+		auto&	   nav = world->getSystem<ecs::NavigationSystem>();
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(maxMs);
+		while (std::chrono::steady_clock::now() < deadline) {
+			step(0.0F);
+			if (nav.hasMesh()) {
+				return true;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		return nav.hasMesh();
+	}
+
+	void SimHarness::step(float dt) {
+		// A fixed "viewport" over the colony stands in for GameScene's camera rect;
+		// NavigationSystem also tracks every colonist on its own.
+		constexpr float kViewHalfExtent = 48.0F;
+		world->getSystem<ecs::NavigationSystem>().setViewportRect(origin, {kViewHalfExtent, kViewHalfExtent});
+
+		world->update(dt);
+		drainDeferred();
+	}
+
+	void SimHarness::drainDeferred() {
+		ecs::drainDeferredEntityChanges(*world, placementExecutor.get(), deferred);
+	}
+
+	size_t SimHarness::loadedChunkCount() const {
+		return chunkManager ? chunkManager->loadedChunkCount() : 0;
+	}
+
+	bool SimHarness::applyCommand(const engine::replay::Command& command, std::string& error) {
+		// The same verbs, parsing and checks DevCommandHandler applies in the live game
+		const engine::replay::SimCommandResult result = engine::replay::applySimCommand(*world, command);
+		if (!result.ok) {
+			error = result.message;
+			return false;
+		}
+		if (command.verb == "complete") {
+			drainDeferred(); // the completion callbacks queue spawns and removals
+		}
+		return true;
+	}
+
+	size_t SimHarness::entityCount() const {
+		return world ? world->getRegistry().getLivingCount() : 0;
+	}
+
+	bool SimHarness::isWaterAt(glm::vec2 worldMeters) const {
+		const engine::world::WorldPosition	 pos{worldMeters.x, worldMeters.y};
+		const engine::world::Chunk*			 chunk = chunkManager->getChunk(engine::world::worldToChunk(pos));
+		if (chunk == nullptr || !chunk->isReady()) {
+			return true;
+		}
+		const auto [localX, localY] = engine::world::worldToLocalTile(pos);
+		const engine::world::TileData& tile = chunk->getTile(localX, localY);
+		return tile.surface == engine::world::Surface::Water || engine::world::isWater(tile.primaryBiome);
+	}
+
+	glm::vec2 SimHarness::nearestLand(glm::vec2 worldMeters) const {
+		// Tile-sized rings out to 64 m, like GameScene's spawn search.
+		if (!isWaterAt(worldMeters)) {
+			return worldMeters;
+		}
+		for (int ring = 1; ring <= 64; ++ring) {
+			for (int dy = -ring; dy <= ring; ++dy) {
+				for (int dx = -ring; dx <= ring; ++dx) {
+					if (std::max(std::abs(dx), std::abs(dy)) != ring) {
+						continue;
+					}
+					const glm::vec2 p = worldMeters + glm::vec2{static_cast<float>(dx), static_cast<float>(dy)};
+					if (!isWaterAt(p)) {
+						return p;
+					}
+				}
+			}
+		}
+		return worldMeters;
+	}
+
+	ecs::EntityID SimHarness::spawnFoundation(glm::vec2 corner, float sizeMeters, const std::string& material) {
+		// As DevCommandHandler::devFoundation: commit the footprint, then mirror it as a
+		// Clearing-phase blueprint (ecs::spawnFoundationBlueprint) at its centre.
+		const std::vector<Foundation::Vec2> pts = {
+			{corner.x, corner.y},
+			{corner.x + sizeMeters, corner.y},
+			{corner.x + sizeMeters, corner.y + sizeMeters},
+			{corner.x, corner.y + sizeMeters},
+		};
+		const auto commit = constructionWorld.commitFoundation(pts, material);
+		if (!commit.ok()) {
+			LOG_WARNING(Game, "sim-bench: foundation at (%.1f, %.1f) rejected", corner.x, corner.y);
+			return ecs::kInvalidEntity;
+		}
+
+		return ecs::spawnFoundationBlueprint(*world, constructionWorld, commit.id, corner + glm::vec2{0.5F * sizeMeters}, material);
+	}
+
+} // namespace sim_bench
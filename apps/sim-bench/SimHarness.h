@@ -0,0 +1,121 @@
+#pragma once
+
+// SimHarness - the colony simulation without a window.
+//
+// Owns what GameScene wires around ecs::World that the simulation itself reads
+// (chunks, flora placement, the ConstructionWorld topology) and builds the world
+// through the same ecs/ColonySetup calls: the same systems in the same order,
+// minus DynamicEntityRenderSystem, and the same cross-layer callbacks with the UI
+// toasts dropped. Spawns and removals requested from inside a system's view loop
+// are queued and drained after World::update().
+//
+// Everything is seeded (world sampler, AI and action RNGs, colonist attributes)
+// and flora placement runs synchronously, so two harnesses built from the same
+// SimConfig start from the same state. The navmesh still builds on a worker; call
+// waitForNavigation() before measuring. With blockingNavBuilds the mesh swaps
+// land on fixed ticks too, so a run is reproducible tick for tick (replays).
+
+#include <construction/ConstructionWorld.h>
+#include <ecs/ColonySetup.h>
+#include <ecs/World.h>
+#include <world/chunk/ChunkCoordinate.h>
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+namespace engine::assets {
+	class PlacementExecutor;
+}
+
+namespace engine::world {
+	class ChunkManager;
+}
+
+namespace engine::replay {
+	struct Command;
+}
+
+namespace sim_bench {
+
+	/// Scenario for one harness: world, colony size and the scripted orders.
+	struct SimConfig {
+		uint64_t	worldSeed = 12345;	  // MockWorldSampler seed (ignored with planetPath)
+		std::string planetPath;			  // .wsplanet to sample instead of the mock world
+		double		landingLatDeg = 0.0;  // landing site on planetPath (maps to the origin)
+		double		landingLonDeg = 0.0;
+		uint32_t	aiSeed = 42;		  // AIDecisionSystem RNG seed
+		uint32_t	actionSeed = 7;		  // ActionSystem RNG seed
+		uint32_t	colonists = 10;
+		uint32_t	stations = 1;		  // CraftingSpot stations, each with craftJobs queued
+		uint32_t	craftJobs = 2;
+		uint32_t	foundations = 1;	  // 4x4 m Wood foundation blueprints
+		int32_t		chunkLoadRadius = 1;  // chunks loaded around the colony origin
+		bool		blockingNavBuilds = false; // NavigationSystem::setBlockingBuilds (replays)
+		uint32_t	aiBudgetMicros = 0;	  // AIDecisionSystem::setEvaluationBudget (0 = unbounded)
+		bool		parallelAIScoring = true; // AIDecisionSystem::setParallelScoring
+	};
+
+	/// Load the asset library, recipes and work/construction configs into their
+	/// registries (process-wide singletons; call once). Returns false with `error` set.
+	bool loadGameData(std::string& error);
+
+	class SimHarness {
+	  public:
+		SimHarness();
+		~SimHarness();
+
+		SimHarness(const SimHarness&) = delete;
+		SimHarness& operator=(const SimHarness&) = delete;
+
+		/// Build the world: load and populate chunks, register and wire the systems,
+		/// spawn colonists and scripted orders. Returns false with `error` set.
+		bool setup(const SimConfig& config, std::string& error);
+
+		/// Pump zero-dt ticks until the navmesh around the colony exists (or maxMs
+		/// elapses). Returns whether a mesh is available.
+		bool waitForNavigation(int maxMs = 30000);
+
+		/// Advance the simulation by one tick of dt seconds.
+		void step(float dt);
+
+		/// Apply a journaled input between ticks through engine::replay::applySimCommand
+		/// (need, time, teleport, kill, complete), the code DevCommandHandler runs for
+		/// the same verbs. Returns false with `error` set if it can't be applied.
+		bool applyCommand(const engine::replay::Command& command, std::string& error);
+
+		[[nodiscard]] ecs::World&		ecsWorld() { return *world; }
+		[[nodiscard]] const ecs::World& ecsWorld() const { return *world; }
+		[[nodiscard]] const engine::construction::ConstructionWorld& construction() const { return constructionWorld; }
+		[[nodiscard]] const engine::assets::PlacementExecutor*		 placement() const { return placementExecutor.get(); }
+		[[nodiscard]] uint32_t			colonistCount() const { return spawnedColonists; }
+		[[nodiscard]] size_t			loadedChunkCount() const;
+		[[nodiscard]] size_t			entityCount() const;
+
+	  private:
+		std::unique_ptr<engine::world::ChunkManager>		chunkManager;
+		std::unique_ptr<engine::assets::PlacementExecutor>	placementExecutor;
+		std::unordered_set<engine::world::ChunkCoordinate>	processedChunks;
+		engine::construction::ConstructionWorld				constructionWorld;
+		std::unique_ptr<ecs::World>							world;
+
+		ecs::DeferredEntityChanges deferred;
+		uint32_t				   spawnedColonists = 0;
+		glm::vec2				   origin{0.0F, 0.0F};
+
+		bool loadChunks(int32_t radius, std::string& error);
+		void registerSystems(const SimConfig& config);
+		void wireCallbacks();
+		void spawnScenario(const SimConfig& config);
+		void drainDeferred();
+
+		[[nodiscard]] bool		isWaterAt(glm::vec2 worldMeters) const;
+		[[nodiscard]] glm::vec2 nearestLand(glm::vec2 worldMeters) const;
+
+		ecs::EntityID spawnFoundation(glm::vec2 corner, float sizeMeters, const std::string& material);
+	};
+
+} // namespace sim_bench
@@ -46,52 +46,29 @@
 #include <assets/placement/PlacementExecutor.h>
 
 // ECS
+#include <ecs/ColonySetup.h>
+#include <ecs/SimulationClock.h>
 #include <ecs/World.h>
-#include <ecs/components/Action.h>
-#include <ecs/components/AnimationState.h>
-#include <ecs/components/Appearance.h>
-#include <ecs/components/Attributes.h>
-#include <ecs/components/Colonist.h>
 #include <ecs/components/Colony.h>
-#include <ecs/components/DecisionTrace.h>
-#include <ecs/components/FacingDirection.h>
-#include <ecs/components/Inventory.h>
-#include <ecs/components/Knowledge.h>
-#include <ecs/components/Memory.h>
-#include <ecs/components/Movement.h>
-#include <ecs/components/Needs.h>
 #include <ecs/components/Packaged.h>
-#include <ecs/components/AgentRadius.h>
 #include <ecs/components/Room.h>
-#include <ecs/components/ResourceStack.h>
-#include <ecs/components/Skills.h>
 #include <ecs/components/Structure.h>
 #include <ecs/components/StructureBlueprint.h>
-#include <ecs/components/StructureHealth.h>
-#include <ecs/components/Task.h>
 #include <ecs/components/Transform.h>
 #include <ecs/components/WorkQueue.h>
 #include <ecs/systems/AIDecisionSystem.h>
 #include <ecs/systems/ActionSystem.h>
-#include <ecs/systems/BuildGoalSystem.h>
-#include <ecs/systems/CollisionSystem.h>
 #include <ecs/systems/ConstructionSystem.h>
-#include <ecs/systems/CraftingGoalSystem.h>
 #include <ecs/systems/DynamicEntityRenderSystem.h>
-#include <ecs/systems/MovementSystem.h>
 #include <ecs/systems/NavigationSystem.h>
-#include <ecs/systems/NeedsDecaySystem.h>
-#include <ecs/systems/PhysicsSystem.h>
 #include <ecs/systems/RoomDetectionSystem.h>
-#include <ecs/systems/StorageGoalSystem.h>
 #include <ecs/systems/TimeSystem.h>
-#include <ecs/systems/StaticRectCollisionSystem.h>
 #include <ecs/systems/VisionSystem.h>
-#include <ecs/systems/WallCollisionSystem.h>
+
+#include <save/SaveGame.h>
 
 #include <cstdlib>
 #include <memory>
-#include <random>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -349,134 +326,56 @@ namespace {
 			// the cross-layer signal (same pattern as ActionSystem's other callbacks).
 			{
 				auto& constructionSystem = ecsWorld->getSystem<ecs::ConstructionSystem>();
-				constructionSystem.setConstructionWorld(&m_drawingSystem->world());
-
-				// NavigationSystem reads the same ConstructionWorld (walls/doors) to build
-				// its navmesh input; wired here for the same reason ConstructionSystem is.
-				ecsWorld->getSystem<ecs::NavigationSystem>().setConstructionWorld(&m_drawingSystem->world());
-
-				// VisionSystem reads the same ConstructionWorld so walls occlude sight:
-				// its GeometryIndex turns built walls into opaque occluders and gates
-				// discovery by a per-observer visibility polygon.
-				ecsWorld->getSystem<ecs::VisionSystem>().setConstructionWorld(&m_drawingSystem->world());
-
-				// WallCollisionSystem reads the same store for its built-wall safety net.
-				ecsWorld->getSystem<ecs::WallCollisionSystem>().setConstructionWorld(&m_drawingSystem->world());
-
 				auto& actionSys = ecsWorld->getSystem<ecs::ActionSystem>();
 
+				// ConstructionSystem, NavigationSystem (walls/doors in the navmesh input),
+				// VisionSystem (built walls occlude sight), WallCollisionSystem and
+				// RoomDetectionSystem all read this one store.
+				ecs::setColonyConstructionWorld(*ecsWorld, &m_drawingSystem->world());
+
 				// Build complete: flip the structure to Built (bumps ConstructionWorld version,
-				// so the render picks up the new style next frame) and toast the player. Walls
-				// and foundations share this callback; the Structure kind selects which topology
-				// mutator to call. The SAME callback is given to both ActionSystem (normal builds)
-				// and ConstructionSystem (DEV free-build), so a free-built structure flips state
+				// so the render picks up the new style next frame) and toast the player. The
+				// SAME callback is given to both ActionSystem (normal builds) and
+				// ConstructionSystem (DEV free-build), so a free-built structure flips state
 				// and renders identically to a normally-built one.
 				auto structureCompleted = [this](ecs::EntityID blueprintEntity) {
-					const auto* structure = ecsWorld->getComponent<ecs::Structure>(blueprintEntity);
-					if (structure == nullptr || structure->graphId == 0) {
+					const ecs::Structure* structure = ecs::completeStructure(*ecsWorld, m_drawingSystem->world(), blueprintEntity);
+					if (structure == nullptr) {
 						LOG_WARNING(Game, "Structure-completed: entity %u has no topology link", static_cast<uint32_t>(blueprintEntity));
 						return;
 					}
-					if (structure->kind == ecs::StructureKind::Wall) {
-						m_drawingSystem->world().setSegmentState(structure->graphId, engine::construction::FoundationState::Built);
-						gameUI->pushNotification("Construction complete", "Wall built", UI::ToastSeverity::Info);
-						LOG_INFO(Game, "Wall segment #%llu built (entity %u)", static_cast<unsigned long long>(structure->graphId), static_cast<uint32_t>(blueprintEntity));
-						return;
-					}
-					if (structure->kind == ecs::StructureKind::Opening) {
-						m_drawingSystem->world().setOpeningState(structure->graphId, engine::construction::FoundationState::Built);
-						gameUI->pushNotification("Construction complete", "Opening built", UI::ToastSeverity::Info);
-						LOG_INFO(
-							Game,
-							"Opening #%llu built (entity %u)",
-							static_cast<unsigned long long>(structure->graphId),
-							static_cast<uint32_t>(blueprintEntity)
-						);
-						return;
-					}
-					m_drawingSystem->world().setState(structure->graphId, engine::construction::FoundationState::Built);
-					gameUI->pushNotification("Construction complete", "Foundation built", UI::ToastSeverity::Info);
-					LOG_INFO(Game, "Foundation #%llu built (entity %u)", static_cast<unsigned long long>(structure->graphId), static_cast<uint32_t>(blueprintEntity));
+					const char* what = structure->kind == ecs::StructureKind::Wall		? "Wall"
+									   : structure->kind == ecs::StructureKind::Opening ? "Opening"
+																						: "Foundation";
+					gameUI->pushNotification("Construction complete", std::string(what) + " built", UI::ToastSeverity::Info);
+					LOG_INFO(
+						Game,
+						"%s #%llu built (entity %u)",
+						what,
+						static_cast<unsigned long long>(structure->graphId),
+						static_cast<uint32_t>(blueprintEntity)
+					);
 				};
 				actionSys.setStructureCompletedCallback(structureCompleted);
 				constructionSystem.setStructureCompletedCallback(structureCompleted);
 
-				// Deconstruct complete: drop the topology record now (the Structure kind selects
-				// which mutator; a wall surfaces its openings' entities too) and DEFER the entity
-				// destruction. This callback fires from inside ActionSystem::update's live view
-				// iteration; destroying here would swap-and-pop the shared component pools and corrupt
-				// that iteration, so entities go on the queue drained after ecsWorld->update() (see
-				// update()). This is the SINGLE removal path: the demolish buttons only mark
-				// structures; the work-driven deconstruct lands here. The SAME lambda is wired to
-				// ConstructionSystem for the no-work edge case (a marked blueprint with workDone <= 0
-				// is removed immediately through here). Material return splits by path: a built teardown
-				// salvages refundPercent% of its delivered[] HERE at completion (below); a no-work cancel
-				// dumps 100% at order-time inside ConstructionSystem and clears delivered[] (so the salvage
-				// below reads empty for it).
+				// Deconstruct complete: salvage, drop the topology record and queue the entity
+				// (ecs::tearDownStructure). This callback fires from inside ActionSystem::update's
+				// live view iteration, so the salvage piles and the destroy both go through
+				// m_deferredChanges, drained after the simulation tick. This is the SINGLE removal
+				// path: the demolish buttons only mark structures; the work-driven deconstruct
+				// lands here. The SAME lambda is wired to ConstructionSystem for the no-work edge
+				// case (a marked blueprint with workDone <= 0 is removed immediately through here),
+				// whose materials were already dumped in full at order time.
 				auto structureDeconstructed = [this](ecs::EntityID blueprintEntity) {
-					// Salvage refundPercent% of a BUILT structure's delivered[] manifest as loose piles HERE,
-					// at tear-down completion (the structure is gone), not at the demolish-order tick when it
-					// was still standing. The entity is still alive (destruction is deferred to the queue), so
-					// delivered[] and Position read fine. A no-work cancel already dumped 100% and cleared
-					// delivered[] at order-time in ConstructionSystem, so this reads empty for it and drops
-					// nothing -- no double-dump.
-					if (const auto* blueprint = ecsWorld->getComponent<ecs::StructureBlueprint>(blueprintEntity);
-						blueprint != nullptr && !blueprint->delivered.empty()) {
-						const float		refundPercent = engine::assets::ConstructionRegistry::Get().constraints().refundPercent;
-						const auto*		position = ecsWorld->getComponent<ecs::Position>(blueprintEntity);
-						const glm::vec2 dropPos = position != nullptr ? position->value : glm::vec2{0.0F, 0.0F};
-						for (const auto& [defName, qty] : blueprint->delivered) {
-							const auto salvageQty =
-								static_cast<uint32_t>(std::floor(static_cast<float>(qty) * refundPercent / 100.0F));
-							if (salvageQty > 0) {
-								dropResourcePiles(defName, dropPos.x, dropPos.y, salvageQty);
-							}
-						}
-					}
-
-					const auto* structure = ecsWorld->getComponent<ecs::Structure>(blueprintEntity);
-					if (structure != nullptr && structure->graphId != 0) {
-						auto& constructionWorld = m_drawingSystem->world();
-						switch (structure->kind) {
-							case ecs::StructureKind::Opening:
-								constructionWorld.removeOpening(structure->graphId);
-								LOG_INFO(
-									Game,
-									"Opening #%llu deconstructed (entity %u)",
-									static_cast<unsigned long long>(structure->graphId),
-									static_cast<uint32_t>(blueprintEntity)
-								);
-								break;
-							case ecs::StructureKind::Wall: {
-								// removeSegment hands back any openings still on the wall; queue
-								// their mirror entities too (the cascade should have torn them down
-								// first, but this keeps removal leak-free if one survives).
-								std::vector<ecs::EntityID> removedOpeningEntities;
-								constructionWorld.removeSegment(structure->graphId, &removedOpeningEntities);
-								for (const ecs::EntityID openingEntity : removedOpeningEntities) {
-									m_pendingEntityRemoval.push_back(openingEntity);
-								}
-								LOG_INFO(
-									Game,
-									"Wall segment #%llu deconstructed (entity %u)",
-									static_cast<unsigned long long>(structure->graphId),
-									static_cast<uint32_t>(blueprintEntity)
-								);
-								break;
-							}
-							case ecs::StructureKind::Foundation:
-							case ecs::StructureKind::Room:
-								constructionWorld.removeFoundation(structure->graphId);
-								LOG_INFO(
-									Game,
-									"Foundation #%llu deconstructed (entity %u)",
-									static_cast<unsigned long long>(structure->graphId),
-									static_cast<uint32_t>(blueprintEntity)
-								);
-								break;
-						}
+					const std::optional<ecs::StructureKind> kind =
+						ecs::tearDownStructure(*ecsWorld, m_drawingSystem->world(), blueprintEntity, m_deferredChanges);
+					if (kind.has_value()) {
+						const char* what = *kind == ecs::StructureKind::Wall	   ? "Wall segment"
+										   : *kind == ecs::StructureKind::Opening ? "Opening"
+																				  : "Foundation";
+						LOG_INFO(Game, "%s deconstructed (entity %u)", what, static_cast<uint32_t>(blueprintEntity));
 					}
-					m_pendingEntityRemoval.push_back(blueprintEntity);
 				};
 				actionSys.setStructureDeconstructedCallback(structureDeconstructed);
 				constructionSystem.setStructureDeconstructedCallback(structureDeconstructed);
@@ -484,9 +383,8 @@ namespace {
 				// Room detection watches the same ConstructionWorld: when a closed loop of
 				// built walls forms, it spawns a room entity and toasts the player. Identity
 				// (id/name) persists across edits inside the system; here we only feed it the
-				// topology handle and the room-formed seam (engine lib can't touch UI).
+				// room-formed seam (engine lib can't touch UI); the topology handle was wired above.
 				auto& roomSystem = ecsWorld->getSystem<ecs::RoomDetectionSystem>();
-				roomSystem.setConstructionWorld(&m_drawingSystem->world());
 				roomSystem.setRoomFormedCallback([this](ecs::EntityID room) {
 					const auto* roomComp = ecsWorld->getComponent<ecs::Room>(room);
 					gameUI->pushNotification("Room formed", roomComp != nullptr ? roomComp->name : "New room", UI::ToastSeverity::Info);
@@ -503,6 +401,13 @@ namespace {
 				.placementExecutor = m_placementExecutor.get(),
 				.constructionWorld = &m_drawingSystem->world(),
 				.callbacks = {.onSelectionChanged = [this](const world_sim::Selection& sel) {
+					// The task list only ever shows the selected colonist, so that's the one
+					// decision trace the AI keeps in full.
+					const auto* colonistSel = std::get_if<world_sim::ColonistSelection>(&sel);
+					ecsWorld->getSystem<ecs::AIDecisionSystem>().setWatchedColonist(
+						colonistSel != nullptr ? colonistSel->entityId : ecs::kInvalidEntity
+					);
+
 					// Control is bound to selection: when the selection moves off the controlled
 					// colonist (deselect, or selecting something else), release control and cancel
 					// any pending move marker. Re-selecting the colonist later starts fresh via the
@@ -510,7 +415,6 @@ namespace {
 					if (m_controlledColonist == 0) {
 						return;
 					}
-					const auto* colonistSel = std::get_if<world_sim::ColonistSelection>(&sel);
 					if (colonistSel == nullptr || colonistSel->entityId != m_controlledColonist) {
 						ecsWorld->getSystem<ecs::AIDecisionSystem>().releaseControl(m_controlledColonist);
 						m_controlledColonist = 0;
@@ -720,6 +624,14 @@ namespace {
 				gameUI->toggleDecisionInspector();
 			}
 
+			// Quick save (written in the background; same file as the autosave). The
+			// toast waits for the write to finish, see the poll() after the autosave.
+			// Saves load through sim-bench and engine::save::loadSave for now; there is
+			// no in-game load until the scene can tear down and rebuild its world.
+			if (input.isKeyPressed(engine::Key::F5)) {
+				m_autosaver.saveNow(*ecsWorld, m_drawingSystem->world(), m_placementExecutor.get());
+			}
+
 			// Handle time controls
 			auto& timeSystem = ecsWorld->getSystem<ecs::TimeSystem>();
 			if (input.isKeyPressed(engine::Key::Space)) {
@@ -734,6 +646,9 @@ namespace {
 			if (input.isKeyPressed(engine::Key::Num3)) {
 				timeSystem.setSpeed(ecs::GameSpeed::VeryFast);
 			}
+			if (input.isKeyPressed(engine::Key::Num4)) {
+				timeSystem.setSpeed(ecs::GameSpeed::Max);
+			}
 
 			// Zoom reset
 			if (input.isKeyPressed(engine::Key::Home)) {
@@ -778,7 +693,7 @@ namespace {
 				// readback. DebugServer is domain-agnostic and only queues generic
 				// DevCommands / state requests; DevCommandHandler owns the game context and
 				// interprets them. Both run on the game thread (the HTTP thread must never
-				// touch the ECS) and BEFORE ecsWorld->update() so a command takes effect the
+				// touch the ECS) and BEFORE the simulation ticks so a command takes effect the
 				// same frame. Dev builds only (the debug server is dev-only).
 				std::vector<Foundation::DevCommand> devCommands;
 				if (debugServer->consumeDevCommands(devCommands)) {
@@ -853,55 +768,23 @@ namespace {
 			// Unload placement data for chunks that were unloaded
 			cleanupUnloadedChunks();
 
-			// Update ECS world (movement, physics, render system)
-			ecsWorld->update(dt);
-
-			// Drain deferred entity removals AFTER the ECS update. Systems (e.g.
-			// ActionSystem on a completed Deconstruct) and input handlers queue
-			// destroys here instead of calling destroyEntity mid-iteration, which
-			// would swap-and-pop the component pools out from under a live view.
-			if (!m_pendingEntityRemoval.empty()) {
-				for (ecs::EntityID entity : m_pendingEntityRemoval) {
-					// Drop control if the controlled colonist is being destroyed, so a recycled
-					// entity index can't later resolve m_controlledColonist to a different live entity.
-					if (entity == m_controlledColonist) {
-						m_controlledColonist = 0;
-						m_moveMarkerTtl = 0.0F;
-					}
-					ecsWorld->destroyEntity(entity);
-				}
-				m_pendingEntityRemoval.clear();
-			}
-
-			// Drain deferred drops AFTER the ECS update, for the same reason as the removals above:
-			// spawnEntity grows the component pools and a synchronous spawn from inside a system's
-			// view loop (a colonist freeing its hands, a fell's uncarried remainder) would reallocate
-			// and dangle that view's bound refs. A packaged item spawns one entity with a Packaged
-			// tag; a resource pile routes through dropResourcePiles (stack-capped split).
-			if (!m_pendingSpawns.empty()) {
-				for (const PendingSpawn& spawn : m_pendingSpawns) {
-					if (spawn.packaged) {
-						// Spawn AT the resolved target (when one is set) so the box never overlaps
-						// the station: the colonist walks over and installs it via PlacePackaged.
-						// targetPosition wired here -> BuildGoalSystem raises the place goal next
-						// frame. nullopt -> spawn in place, await the player's [Place] click.
-						const glm::vec2 spawnAt =
-							spawn.targetPosition.has_value() ? *spawn.targetPosition : glm::vec2{spawn.x, spawn.y};
-						auto entity = m_placementSystem->spawnEntity(spawn.defName, spawnAt);
-						ecs::Packaged packaged;
-						packaged.targetPosition = spawn.targetPosition;
-						ecsWorld->addComponent<ecs::Packaged>(entity, packaged);
-						if (spawn.targetPosition.has_value()) {
-							LOG_INFO(Game, "Spawned packaged '%s' at (%.1f, %.1f) - auto-placing", spawn.defName.c_str(),
-									 spawnAt.x, spawnAt.y);
-						} else {
-							LOG_INFO(Game, "Spawned packaged '%s' - awaiting placement", spawn.defName.c_str());
-						}
-					} else {
-						dropResourcePiles(spawn.defName, spawn.x, spawn.y, spawn.quantity);
-					}
+			// Advance the simulation in fixed ticks (see SimulationClock): the game speed
+			// picks how many ticks this frame runs, each followed by drainPendingEntityChanges().
+			// Input handlers above may have queued removals/spawns too; drain those first so
+			// they land even on a frame that runs no tick (paused).
+			drainPendingEntityChanges();
+			m_simClock.advance(*ecsWorld, dt);
+
+			// Autosave between ticks, so the snapshot never sees a half-applied tick.
+			// Capture runs here; the file write happens on a worker.
+			m_autosaver.update(dt, *ecsWorld, m_drawingSystem->world(), m_placementExecutor.get());
+			if (auto done = m_autosaver.poll()) {
+				const std::string file = m_autosaver.savePath().filename().string();
+				if (!done->ok) {
+					gameUI->pushNotification("Save failed", file, UI::ToastSeverity::Critical);
+				} else if (done->manual) {
+					gameUI->pushNotification("Game saved", file, UI::ToastSeverity::Info);
 				}
-				m_pendingSpawns.clear();
 			}
 
 			// Feed the current selection's room id to the overlay so it can draw the
@@ -1035,6 +918,10 @@ namespace {
 		void onExit() override {
 			LOG_INFO(Game, "GameScene - Exiting");
 
+			// Let an in-flight save finish; it owns its snapshot, but a half-written
+			// temp file would be left behind if the process exited under it.
+			m_autosaver.wait();
+
 			// Wait for all pending async tasks to complete before destroying executor
 			if (m_asyncProcessor) {
 				m_asyncProcessor->clear();
@@ -1069,67 +956,31 @@ namespace {
 			LOG_INFO(Game, "Initializing ECS World");
 
 			ecsWorld = std::make_unique<ecs::World>();
-
-			// Register systems in priority order (lower = runs first)
-			auto& assetRegistry = engine::assets::AssetRegistry::Get();
-			auto& recipeRegistry = engine::assets::RecipeRegistry::Get();
-			ecsWorld->registerSystem<ecs::TimeSystem>();									// Priority 10 - runs first
-			ecsWorld->registerSystem<ecs::VisionSystem>();									// Priority 45
-			ecsWorld->registerSystem<ecs::NeedsDecaySystem>();								// Priority 50
-			ecsWorld->registerSystem<ecs::StorageGoalSystem>();								// Priority 55 - goals before AI
-			ecsWorld->registerSystem<ecs::CraftingGoalSystem>();							// Priority 56 - goals before AI
-			ecsWorld->registerSystem<ecs::BuildGoalSystem>();								// Priority 57 - goals before AI
-			ecsWorld->registerSystem<ecs::ConstructionSystem>();							// Priority 58 - foundation lifecycle goals
-			ecsWorld->registerSystem<ecs::RoomDetectionSystem>();							// Priority 59 - derive rooms from built walls
-			ecsWorld->registerSystem<ecs::NavigationSystem>();								// Priority 51 - cached navmesh + path queries
-			ecsWorld->registerSystem<ecs::AIDecisionSystem>(assetRegistry, recipeRegistry); // Priority 60
-			ecsWorld->registerSystem<ecs::MovementSystem>();								// Priority 100
-			ecsWorld->registerSystem<ecs::PhysicsSystem>();									// Priority 200
-			ecsWorld->registerSystem<ecs::CollisionSystem>();								// Priority 250 - positional separation after physics
-			ecsWorld->registerSystem<ecs::WallCollisionSystem>();							// Priority 260 - wall safety-net after agent separation
-			ecsWorld->registerSystem<ecs::StaticRectCollisionSystem>();						// Priority 270 - flora-rect safety-net after wall collision
-			ecsWorld->registerSystem<ecs::ActionSystem>();									// Priority 350
-			ecsWorld->registerSystem<ecs::DynamicEntityRenderSystem>();						// Priority 900
-
-			// Wire up VisionSystem with placement data for entity queries
-			auto& visionSystem = ecsWorld->getSystem<ecs::VisionSystem>();
-			visionSystem.setPlacementData(m_placementExecutor.get(), &m_processedChunks);
-			visionSystem.setChunkManager(m_chunkManager.get());
+			m_simClock.reset();
+			m_simClock.setAfterTick([this]() { drainPendingEntityChanges(); });
+			m_autosaver.setPath(std::filesystem::path("saves") / "autosave.wssv");
+
+			// The simulation systems, their data sources and the drop/removal callbacks are
+			// shared with sim-bench's headless harness (ecs/ColonySetup); only the render
+			// system and the UI callbacks are GameScene's own.
+			//
+			// Cap AI evaluations at ~2 ms of a 16.6 ms frame: a large colony spreads its
+			// re-evaluations over a few ticks instead of spiking one frame. Critical needs
+			// are always evaluated immediately.
+			constexpr uint32_t kAIEvaluationBudgetMicros = 2000;
+			ecs::registerColonySystems(
+				*ecsWorld,
+				{m_chunkManager.get(), m_placementExecutor.get(), &m_processedChunks},
+				{.aiBudgetMicros = kAIEvaluationBudgetMicros}
+			);
+			ecsWorld->registerSystem<ecs::DynamicEntityRenderSystem>(); // Priority 900
 
 			// Wire up "Aha!" notification callback for recipe discoveries
-			visionSystem.setRecipeDiscoveryCallback([this](const std::string& recipeLabel) {
+			ecsWorld->getSystem<ecs::VisionSystem>().setRecipeDiscoveryCallback([this](const std::string& recipeLabel) {
 				gameUI->pushNotification("Aha!", "Discovered: " + recipeLabel, UI::ToastSeverity::Info);
 				LOG_INFO(Game, "Recipe discovered: %s", recipeLabel.c_str());
 			});
 
-			// Wire NavigationSystem resources (same data VisionSystem consumes). The
-			// ConstructionWorld pointer is wired after DrawingSystem is created, back in
-			// initialize(), exactly like ConstructionSystem. The simulation area itself
-			// is pushed per-frame in update() via setSimulationArea (GameScene owns the
-			// camera and viewport dimensions needed to compute it).
-			auto& navSystem = ecsWorld->getSystem<ecs::NavigationSystem>();
-			navSystem.setChunkManager(m_chunkManager.get());
-			navSystem.setPlacementData(m_placementExecutor.get(), &m_processedChunks);
-
-			// Tier-3 flora-rect safety net gathers placed rects locally each frame.
-			auto& staticRectCollisionSystem = ecsWorld->getSystem<ecs::StaticRectCollisionSystem>();
-			staticRectCollisionSystem.setPlacementData(m_placementExecutor.get());
-
-			// Wire up AIDecisionSystem with chunk manager for toilet location queries
-			auto& aiDecisionSystem = ecsWorld->getSystem<ecs::AIDecisionSystem>();
-			aiDecisionSystem.setChunkManager(m_chunkManager.get());
-
-			// AI resolves a navmesh route for every move; with no route possible the colonist holds
-			// (pre-mesh / off-area) or stops (believed wall), and an off-mesh colonist snaps to
-			// valid ground. There is no straight-line beeline in the running game.
-			aiDecisionSystem.setNavigationSystem(&navSystem);
-
-			// Wire ConstructionSystem with placement data for footprint-clearing queries. The
-			// ConstructionWorld pointer and completion callbacks are wired after DrawingSystem
-			// (which owns the ConstructionWorld) is created, back in initialize().
-			auto& constructionSystem = ecsWorld->getSystem<ecs::ConstructionSystem>();
-			constructionSystem.setPlacementData(m_placementExecutor.get(), &m_processedChunks);
-
 			// Wire up ActionSystem for "item crafted" notifications
 			auto& actionSystem = ecsWorld->getSystem<ecs::ActionSystem>();
 			actionSystem.setItemCraftedCallback([this](const std::string& itemLabel) {
@@ -1137,115 +988,12 @@ namespace {
 				LOG_INFO(Game, "Item crafted notification: %s", itemLabel.c_str());
 			});
 
-			// Every ground drop -- a felled tree's uncarried remainder, craft overflow, a stowed
-			// tool, a cancelled build site's salvage -- snaps to a walkable nav point before it
-			// lands, so a drop whose raw origin sits in a river / off-mesh (a tree felled on a
-			// bank) ends up on solid ground instead of in the water. findValidPositionNear is the
-			// one primitive for this; the snap lives here, at the two drop funnels (loose pile,
-			// packaged item), so no upstream drop site needs its own nav check (One-Path). It is
-			// deterministic (no RNG, canonical +X bias) and returns nullopt only when no mesh
-			// covers the origin -- then we keep the raw origin so a drop never hard-fails.
-			auto snapDropToGround = [&navSystem](float x, float y) -> glm::vec2 {
-				const std::optional<glm::vec2> onGround = navSystem.findValidPositionNear({x, y}, 1.0F);
-				return onGround.value_or(glm::vec2{x, y});
-			};
-
-			// Wire up ActionSystem to drop non-backpackable items on the ground as packaged.
-			// These callbacks fire from inside the ActionSystem view loop, so they only ENQUEUE;
-			// the real spawnEntity runs at the pending-spawn drain after ecsWorld->update() (see
-			// m_pendingSpawns) to avoid reallocating component pools out from under the live view.
-			actionSystem.setDropItemCallback([this, snapDropToGround](const std::string& defName, float x, float y) {
-				const glm::vec2 at = snapDropToGround(x, y);
-				m_pendingSpawns.push_back({defName, at.x, at.y, 0, /*packaged=*/true, std::nullopt});
-			});
-
-			// Crafted FURNITURE comes out PACKAGED and auto-installs a short distance off the
-			// station via the existing PlacePackaged flow (it must not seat in the colonist's
-			// hands or stack on the station). Resolve a walkable spot >= 1 m away; the aim rotates
-			// by the golden angle each spawn so a queued run of boxes FANS OUT instead of stacking
-			// on one target. If no mesh covers the station (findValidPositionNear -> nullopt), fall
-			// back to the manual packaged drop (spawn beside the station, await a [Place] click) so
-			// crafting never hard-fails. ENQUEUE only -- fires from inside the ActionSystem view loop.
-			actionSystem.setSpawnPackagedAtCallback([this, &navSystem](const std::string& defName, glm::vec2 stationPos) {
-				constexpr float kGoldenAngle = 2.39996323F; // ~137.5 deg, spreads successive aims evenly
-				const float		angle		 = static_cast<float>(m_packagedSpawnSeq++) * kGoldenAngle;
-				const glm::vec2 aim{std::cos(angle), std::sin(angle)};
-				const std::optional<glm::vec2> target = navSystem.findValidPositionNear(stationPos, 1.0F, aim);
-				if (target.has_value()) {
-					m_pendingSpawns.push_back({defName, target->x, target->y, 0, /*packaged=*/true, target});
-				} else {
-					// No mesh at the station: fall back to the player-driven packaged drop, nudged
-					// ~2 m off the station (no mesh to snap to) so the box doesn't stack on it.
-					m_pendingSpawns.push_back({defName, stationPos.x + 2.0F, stationPos.y, 0, /*packaged=*/true, std::nullopt});
-				}
-			});
-
-			// Drop a loose, haulable resource pile (felling remainder, or a cancelled build site's
-			// staged materials). Unlike the crafting drop above, this pile is NOT packaged: a
-			// per-entity ResourceStack holds the count and it is immediately haulable. Both the
-			// ActionSystem fell-remainder drop and the ConstructionSystem cancelled-site drop fire
-			// from inside their system's view loop, so both ENQUEUE; the drain runs dropResourcePiles
-			// (the single pile-split spawn path) after ecsWorld->update().
-			auto enqueueResourceDrop = [this, snapDropToGround](const std::string& defName, float x, float y, uint32_t quantity) {
-				const glm::vec2 at = snapDropToGround(x, y);
-				m_pendingSpawns.push_back({defName, at.x, at.y, quantity, /*packaged=*/false});
-			};
-			actionSystem.setDropResourceCallback(enqueueResourceDrop);
-			constructionSystem.setDropResourceCallback(enqueueResourceDrop);
-
-			// Wire up ActionSystem to remove harvested entities (destructive harvest)
-			actionSystem.setRemoveEntityCallback([this](const std::string& defName, float x, float y) {
-				auto coord = engine::world::worldToChunk({x, y});
-				bool removedFromIndex = m_placementExecutor->removeEntity(coord, {x, y}, defName);
-
-				// World-gen flora live only in the placement index (above). Runtime-spawned
-				// harvestables (dev spawns, future saplings) are ECS entities that VisionSystem
-				// Pass 2 sees by Appearance; the index removal misses them, so a depleted one
-				// would linger and get re-discovered forever. Find the matching ECS entity and
-				// queue it for the deferred drain (never destroy mid-view-iteration).
-				bool			queuedEcs = false;
-				constexpr float kMatchEps = 0.25F;
-				for (auto [ent, entPos, appearance] : ecsWorld->view<ecs::Position, ecs::Appearance>()) {
-					if (appearance.defName != defName) {
-						continue;
-					}
-					const float ddx = entPos.value.x - x;
-					const float ddy = entPos.value.y - y;
-					if (ddx * ddx + ddy * ddy <= kMatchEps * kMatchEps) {
-						m_pendingEntityRemoval.push_back(ent);
-						queuedEcs = true;
-						break;
-					}
-				}
-
-				if (!removedFromIndex && !queuedEcs) {
-					LOG_WARNING(Game, "Failed to remove harvested entity %s at (%.1f, %.1f)", defName.c_str(), x, y);
-				}
-			});
-
-			// Wire up ActionSystem to remove a specific entity by id (a loose pile drained to
-			// zero). The system already holds the exact entity, so there is no position scan to
-			// alias between two same-material piles. Queue for the deferred drain like the others.
-			actionSystem.setRemoveEntityByIdCallback([this](ecs::EntityID entity) {
-				m_pendingEntityRemoval.push_back(entity);
-			});
-
-			// Wire up ActionSystem to set cooldown on harvested entities (regrowth)
-			actionSystem.setEntityCooldownCallback([this](const std::string& defName, float x, float y, float cooldownSeconds) {
-				auto coord = engine::world::worldToChunk({x, y});
-				m_placementExecutor->setEntityCooldown(coord, {x, y}, defName, cooldownSeconds);
-			});
-
-			// Wire up ActionSystem to withdraw from harvestable resource pools. Returns how much
-			// was actually taken plus whether the pool is now empty (so the tree gets removed).
-			actionSystem.setDecrementResourceCallback(
-				[this](const std::string& defName, float x, float y, uint32_t requested) -> ecs::ActionSystem::ResourceDraw {
-					auto		   coord = engine::world::worldToChunk({x, y});
-					const uint32_t removed = m_placementExecutor->decrementResourceCount(coord, {x, y}, defName, requested);
-					const bool	   depleted = !m_placementExecutor->getResourceCount(coord, {x, y}, defName).has_value();
-					return {removed, depleted};
-				}
-			);
+			// Drops, harvest removals and resource-pool draws. These fire from inside system view
+			// loops, so spawns and removals only ENQUEUE into m_deferredChanges; the real spawn
+			// and destroy run in drainPendingEntityChanges() after the simulation tick. The
+			// ConstructionWorld pointer and the structure callbacks are wired after DrawingSystem
+			// (which owns the ConstructionWorld) is created, back in initialize().
+			ecs::wireColonyCallbacks(*ecsWorld, *m_placementExecutor, m_deferredChanges);
 
 			// The drop point picked in GameLoadingScene comes from the 2D river-channel
 			// model, which can disagree with the runtime tile classification the navmesh
@@ -1416,48 +1164,10 @@ namespace {
 					 removed, radius, center.x, center.y, touchedChunks.size());
 		}
 
-		/// Spawn a new colonist entity at the given position.
+		/// Spawn a new colonist entity at the given position (ecs::spawnColonist: the same
+		/// component set and attribute roll sim-bench spawns).
 		ecs::EntityID spawnColonist(glm::vec2 newPosition, const std::string& newName) {
-			auto entity = ecsWorld->createEntity();
-
-			ecsWorld->addComponent<ecs::Position>(entity, ecs::Position{newPosition});
-			ecsWorld->addComponent<ecs::Rotation>(entity, ecs::Rotation{0.0F});
-			ecsWorld->addComponent<ecs::Velocity>(entity, ecs::Velocity{{0.0F, 0.0F}});
-			ecsWorld->addComponent<ecs::MovementTarget>(entity, ecs::MovementTarget{{0.0F, 0.0F}, 2.0F, false});
-			ecsWorld->addComponent<ecs::FacingDirection>(entity, ecs::FacingDirection{}); // Default: Down
-			ecsWorld->addComponent<ecs::AnimationState>(entity, ecs::AnimationState{});	 // Walk-cycle phase
-			ecsWorld->addComponent<ecs::Appearance>(entity, ecs::Appearance{"Colonist", 1.0F, {1.0F, 1.0F, 1.0F, 1.0F}});
-			ecsWorld->addComponent<ecs::Colonist>(entity, ecs::Colonist{newName});
-			ecsWorld->addComponent<ecs::NeedsComponent>(entity, ecs::NeedsComponent::createDefault());
-
-			// Roll static attributes (0-20), seeded per-entity so colonists vary
-			// deterministically. Only Strength is consumed today: it sets hand-carry
-			// capacity. The other attributes are placeholders for upcoming systems.
-			ecs::Attributes attributes;
-			std::mt19937   attrRng(static_cast<uint32_t>(entity));
-			attributes.strength = std::uniform_real_distribution<float>(6.0F, 14.0F)(attrRng);
-			ecsWorld->addComponent<ecs::Attributes>(entity, attributes);
-
-			// Carry weight scales with Strength (an average colonist lands at the prior 35kg).
-			auto inventory = ecs::Inventory::createForColonist();
-			inventory.carryCapacityKg = ecs::Attributes::carryCapacityKg(attributes.strength);
-			ecsWorld->addComponent<ecs::Inventory>(entity, std::move(inventory));
-			ecsWorld->addComponent<ecs::Knowledge>(entity, ecs::Knowledge{});
-			ecsWorld->addComponent<ecs::Memory>(entity, ecs::Memory{.owner = entity});
-			ecsWorld->addComponent<ecs::Task>(entity, ecs::Task{});
-			ecsWorld->addComponent<ecs::DecisionTrace>(entity, ecs::DecisionTrace{});
-			ecsWorld->addComponent<ecs::Action>(entity, ecs::Action{});
-			ecsWorld->addComponent<ecs::AgentRadius>(entity, ecs::AgentRadius{});
-
-			// Add skills with default starting values
-			// Skills range 0-20 (see SkillLevels in Skills.h)
-			ecs::Skills skills;
-			skills.setLevel("Farming", 3.0F);	   // Novice farmer
-			skills.setLevel("Crafting", 2.0F);	   // Novice crafter
-			skills.setLevel("Construction", 1.0F); // Barely trained builder
-			// Medicine: 0 (untrained) - omitted from map
-			ecsWorld->addComponent<ecs::Skills>(entity, std::move(skills));
-
+			const ecs::EntityID entity = ecs::spawnColonist(*ecsWorld, newPosition, newName);
 			LOG_INFO(Game, "Spawned colonist '%s' at (%.1f, %.1f)", newName.c_str(), newPosition.x, newPosition.y);
 			return entity;
 		}
@@ -1613,22 +1323,22 @@ namespace {
 			LOG_INFO(Game, "Canceled job '%s' at station '%s'", recipeDefName.c_str(), stationSel->defName.c_str());
 		}
 
-		/// Spawn a loose, haulable resource pile of `quantity` x `defName` at (x, y). A pile is capped
-		/// at the item's own stackSize, so an over-cap drop splits into several piles scattered to
-		/// distinct spots (within the 0.25 m pickup epsilon two piles would alias). No def / no
-		/// itemProperties means unbounded -> a single pile. Each pile is a ResourceStack entity (not
-		/// Packaged): immediately haulable. The SINGLE ground-pile drop path; ActionSystem (felling
-		/// remainder) and ConstructionSystem (cancelled-site materials) both route through it.
-		void dropResourcePiles(const std::string& defName, float x, float y, uint32_t quantity) {
-			const auto*	   def = engine::assets::AssetRegistry::Get().getDefinition(defName);
-			const uint32_t cap =
-				(def != nullptr && def->itemProperties.has_value()) ? def->itemProperties->stackSize : UINT32_MAX;
-			const auto piles = ecs::resourcePileDrops(cap, quantity, {x, y});
-			for (const auto& [pos, qty] : piles) {
-				auto entity = m_placementSystem->spawnEntity(defName, {pos.x, pos.y});
-				ecsWorld->addComponent<ecs::ResourceStack>(entity, ecs::ResourceStack{qty});
-			}
-			LOG_INFO(Game, "Dropped %u x '%s' as %zu stacks at (%.1f, %.1f)", quantity, defName.c_str(), piles.size(), x, y);
+		/// Apply the removals and spawns that systems and input handlers queued. Runs after
+		/// every simulation tick (SimulationClock after-tick hook) and once per frame before ticking.
+		void drainPendingEntityChanges() {
+			// Systems (e.g. ActionSystem on a completed Deconstruct) and input handlers queue
+			// destroys and drops in m_deferredChanges instead of touching the component pools
+			// mid-iteration, which would swap-and-pop or reallocate them out from under a live
+			// view. Drop control first if the controlled colonist is being destroyed, so a
+			// recycled entity index can't later resolve m_controlledColonist to a different
+			// live entity.
+			for (ecs::EntityID entity : m_deferredChanges.removals) {
+				if (entity == m_controlledColonist) {
+					m_controlledColonist = 0;
+					m_moveMarkerTtl = 0.0F;
+				}
+			}
+			ecs::drainDeferredEntityChanges(*ecsWorld, m_placementExecutor.get(), m_deferredChanges);
 		}
 
 		/// Mark a structure's ECS blueprint for deconstruction. ConstructionSystem then emits a
@@ -1883,6 +1593,12 @@ namespace {
 		// ECS World containing all dynamic entities
 		std::unique_ptr<ecs::World> ecsWorld;
 
+		// Fixed-timestep driver for ecsWorld (catch-up ticks, frame budget, interpolation)
+		ecs::SimulationClock m_simClock;
+
+		// Periodic background autosave (and F5 quick save) of the colony state.
+		engine::save::Autosaver m_autosaver;
+
 		// Async chunk processor (shared implementation with GameLoadingScene)
 		std::unique_ptr<engine::assets::AsyncChunkProcessor> m_asyncProcessor;
 
@@ -1914,33 +1630,12 @@ namespace {
 		// constructed after the systems above exist.
 		std::unique_ptr<world_sim::DevCommandHandler> m_devHandler;
 
-		// Entities queued for destruction, drained after ecsWorld->update() so we
-		// never destroyEntity mid-view-iteration (deconstruct callback, demolish).
-		std::vector<ecs::EntityID> m_pendingEntityRemoval;
-
-		// Drops requested from inside the ActionSystem view loop (a colonist stows a held tool to
-		// free its hands, or a fell drops its uncarried remainder). spawnEntity grows the component
-		// pools, which would reallocate and dangle the live view's bound refs -- so the drop
-		// callbacks ENQUEUE here and the real spawn happens at the drain below, after
-		// ecsWorld->update(), next to the removal drain. `packaged` items spawn one entity with a
-		// Packaged tag; resource piles route through dropResourcePiles (stack-capped split).
-		struct PendingSpawn {
-			std::string defName;
-			float		x = 0.0F;
-			float		y = 0.0F;
-			uint32_t	quantity = 0; // resource-pile count; unused for packaged items
-			bool		packaged = false;
-			// Auto-place target for a packaged spawn (a crafted furniture box). When set, the
-			// entity spawns AT this point with Packaged.targetPosition wired, so BuildGoalSystem
-			// raises the place goal immediately (no manual [Place]). nullopt -> the player-driven
-			// path (spawn in place, await a [Place] click) for a manually dropped packaged item.
-			std::optional<glm::vec2> targetPosition;
-		};
-		std::vector<PendingSpawn> m_pendingSpawns;
-
-		// Monotonic counter rotating the placement aim for crafted furniture so a run of boxes
-		// from one station fans out (golden-angle stepped) instead of stacking on a single spot.
-		std::uint32_t m_packagedSpawnSeq = 0;
+		// Destroys and drops requested from inside a system's view loop (a deconstruct, a colonist
+		// stowing a held tool, a fell's uncarried remainder) or by input handlers. Spawning or
+		// destroying there would reallocate or swap-and-pop the component pools under the live
+		// view, so they queue here and drainPendingEntityChanges() applies them after each
+		// simulation tick.
+		ecs::DeferredEntityChanges m_deferredChanges;
 	};
 
 } // namespace
@@ -16,6 +16,7 @@
 
 #include <debug/DebugServer.h> // Foundation::DevCommand
 
+#include <ecs/ColonySetup.h>
 #include <ecs/InventoryMass.h>
 #include <ecs/World.h>
 #include <ecs/components/Action.h>
@@ -26,15 +27,16 @@
 #include <ecs/components/Needs.h>
 #include <ecs/components/Packaged.h>
 #include <ecs/components/StorageConfiguration.h>
-#include <ecs/components/Structure.h>
 #include <ecs/components/StructureBlueprint.h>
-#include <ecs/components/StructureHealth.h>
 #include <ecs/components/Transform.h>
 #include <ecs/components/WorkQueue.h>
 #include <ecs/systems/ConstructionSystem.h>
 #include <ecs/systems/NavigationSystem.h>
+#include <ecs/systems/ResourceLedgerSystem.h>
 #include <ecs/systems/TimeSystem.h>
 
+#include <replay/SimCommands.h>
+
 #include <assets/RecipeRegistry.h>
 
 #include <utils/Log.h>
@@ -61,18 +63,12 @@ namespace world_sim {
 			devSpawn(cmd);
 		} else if (cmd.verb == "colonist") {
 			devColonist(cmd);
-		} else if (cmd.verb == "need") {
-			devNeed(cmd);
-		} else if (cmd.verb == "time") {
-			devTime(cmd);
-		} else if (cmd.verb == "teleport") {
-			devTeleport(cmd);
+		} else if (cmd.verb == "need" || cmd.verb == "time" || cmd.verb == "teleport" || cmd.verb == "complete") {
+			applySimVerb(cmd);
 		} else if (cmd.verb == "select") {
 			devSelect(cmd);
 		} else if (cmd.verb == "kill") {
 			devKill(cmd);
-		} else if (cmd.verb == "complete") {
-			devComplete(cmd);
 		} else if (cmd.verb == "foundation") {
 			devFoundation(cmd);
 		} else if (cmd.verb == "walls") {
@@ -303,16 +299,6 @@ namespace world_sim {
 		return static_cast<ecs::EntityID>(std::strtoull(spec.c_str(), nullptr, 10));
 	}
 
-	bool DevCommandHandler::parseNeedType(const std::string& name, ecs::NeedType& out) {
-		for (size_t i = 0; i < ecs::kNeedLabels.size(); ++i) {
-			if (equalsIgnoreCase(name, ecs::kNeedLabels[i])) {
-				out = static_cast<ecs::NeedType>(i);
-				return true;
-			}
-		}
-		return false;
-	}
-
 	bool DevCommandHandler::equalsIgnoreCase(const std::string& a, const char* b) {
 		size_t i = 0;
 		for (; i < a.size() && b[i] != '\0'; ++i) {
@@ -323,96 +309,6 @@ namespace world_sim {
 		return i == a.size() && b[i] == '\0';
 	}
 
-	float DevCommandHandler::parseClock(const std::string& spec) {
-		const float h = std::strtof(spec.c_str(), nullptr);
-		float		m = 0.0F;
-		const auto	colon = spec.find(':');
-		if (colon != std::string::npos) {
-			m = std::strtof(spec.c_str() + colon + 1, nullptr);
-		}
-		return h + m / 60.0F;
-	}
-
-	float DevCommandHandler::parseDuration(const std::string& spec) {
-		char*		end = nullptr;
-		const float v = std::strtof(spec.c_str(), &end);
-		if (end != nullptr && (*end == 'h' || *end == 'H')) {
-			return v * 60.0F;
-		}
-		return v;
-	}
-
-	void DevCommandHandler::devNeed(const Foundation::DevCommand& cmd) {
-		const ecs::EntityID id = parseEntity(cmd.param("colonist"));
-		auto*				needs = m_ctx.world->getComponent<ecs::NeedsComponent>(id);
-		if (needs == nullptr) {
-			LOG_WARNING(Game, "[DevAPI] need: no colonist #%llu", static_cast<unsigned long long>(id));
-			m_ctx.ui->pushNotification("Dev", "No such colonist", UI::ToastSeverity::Warning);
-			return;
-		}
-		ecs::NeedType type{};
-		if (!parseNeedType(cmd.param("need"), type)) {
-			LOG_WARNING(Game, "[DevAPI] need: unknown need '%s'", cmd.param("need").c_str());
-			m_ctx.ui->pushNotification("Dev", "Unknown need", UI::ToastSeverity::Warning);
-			return;
-		}
-		float value = std::strtof(cmd.param("value", "100").c_str(), nullptr);
-		value = value < 0.0F ? 0.0F : (value > 100.0F ? 100.0F : value);
-		needs->get(type).value = value;
-		LOG_INFO(Game, "[DevAPI] need: %s=%.1f on #%llu", ecs::needLabel(type), static_cast<double>(value), static_cast<unsigned long long>(id));
-		m_ctx.ui->pushNotification("Dev", std::string(ecs::needLabel(type)) + " set", UI::ToastSeverity::Info);
-	}
-
-	void DevCommandHandler::devTime(const Foundation::DevCommand& cmd) {
-		auto& timeSystem = m_ctx.world->getSystem<ecs::TimeSystem>();
-		bool  acted = false;
-
-		if (cmd.hasParam("speed")) {
-			const long s = std::strtol(cmd.param("speed").c_str(), nullptr, 10);
-			if (s >= 0 && s <= 3) {
-				timeSystem.setSpeed(static_cast<ecs::GameSpeed>(s));
-				acted = true;
-			} else {
-				LOG_WARNING(Game, "[DevAPI] time: speed must be 0..3");
-			}
-		}
-		if (cmd.hasParam("set")) {
-			timeSystem.setTimeOfDay(parseClock(cmd.param("set")));
-			acted = true;
-		}
-		if (cmd.hasParam("skip")) {
-			timeSystem.skipTime(parseDuration(cmd.param("skip")));
-			acted = true;
-		}
-
-		const auto snap = timeSystem.snapshot();
-		LOG_INFO(Game, "[DevAPI] time: day %d, %.2fh, speed %d", snap.day, static_cast<double>(snap.timeOfDay), static_cast<int>(snap.speed));
-		m_ctx.ui->pushNotification("Dev", acted ? "Time updated" : "time: speed|set|skip", acted ? UI::ToastSeverity::Info : UI::ToastSeverity::Warning);
-	}
-
-	void DevCommandHandler::devTeleport(const Foundation::DevCommand& cmd) {
-		const ecs::EntityID id = parseEntity(cmd.param("colonist"));
-		auto*				pos = m_ctx.world->getComponent<ecs::Position>(id);
-		if (pos == nullptr) {
-			LOG_WARNING(Game, "[DevAPI] teleport: no entity #%llu", static_cast<unsigned long long>(id));
-			m_ctx.ui->pushNotification("Dev", "No such entity", UI::ToastSeverity::Warning);
-			return;
-		}
-		const Foundation::Vec2 to = parsePoint(cmd.param("to"));
-		if (!requireValidPosition(to, "teleport")) {
-			return;
-		}
-		pos->value = {to.x, to.y};
-		if (auto* target = m_ctx.world->getComponent<ecs::MovementTarget>(id)) {
-			target->active = false;
-		}
-		if (auto* vel = m_ctx.world->getComponent<ecs::Velocity>(id)) {
-			vel->value = {0.0F, 0.0F};
-		}
-		LOG_INFO(Game, "[DevAPI] teleport: #%llu -> (%.1f, %.1f)", static_cast<unsigned long long>(id), to.x, to.y);
-		m_ctx.ui->pushNotification("Dev", "Teleported", UI::ToastSeverity::Info);
-	}
-
 	void DevCommandHandler::devSelect(const Foundation::DevCommand& cmd) {
 		ecs::EntityID id = ecs::kInvalidEntity;
 		if (cmd.hasParam("colonist")) {
@@ -433,30 +329,27 @@ namespace world_sim {
 	}
 
 	void DevCommandHandler::devKill(const Foundation::DevCommand& cmd) {
-		const ecs::EntityID id = parseEntity(cmd.param("colonist"));
-		if (!m_ctx.world->isAlive(id)) {
-			LOG_WARNING(Game, "[DevAPI] kill: no entity #%llu", static_cast<unsigned long long>(id));
-			m_ctx.ui->pushNotification("Dev", "No such entity", UI::ToastSeverity::Warning);
+		if (!applySimVerb(cmd)) {
 			return;
 		}
+		// Don't leave the inspector pointing at the removed colonist
 		const auto* colonistSel = std::get_if<world_sim::ColonistSelection>(&m_ctx.selection->current());
-		if (colonistSel != nullptr && colonistSel->entityId == id) {
+		if (colonistSel != nullptr && !m_ctx.world->isAlive(colonistSel->entityId)) {
 			m_ctx.selection->clearSelection();
 		}
-		m_ctx.world->destroyEntity(id);
-		LOG_INFO(Game, "[DevAPI] kill: removed #%llu", static_cast<unsigned long long>(id));
-		m_ctx.ui->pushNotification("Dev", "Colonist removed", UI::ToastSeverity::Info);
 	}
 
-	void DevCommandHandler::devComplete(const Foundation::DevCommand& cmd) {
-		const ecs::EntityID id = parseEntity(cmd.param("id"));
-		if (m_ctx.world->getSystem<ecs::ConstructionSystem>().forceCompleteBlueprint(id)) {
-			LOG_INFO(Game, "[DevAPI] complete: built blueprint #%llu", static_cast<unsigned long long>(id));
-			m_ctx.ui->pushNotification("Dev", "Blueprint built", UI::ToastSeverity::Info);
+	bool DevCommandHandler::applySimVerb(const Foundation::DevCommand& cmd) {
+		// Same code path sim-bench replays journaled commands through
+		const engine::replay::SimCommandResult result =
+			engine::replay::applySimCommand(*m_ctx.world, engine::replay::Command{0, cmd.verb, cmd.params});
+		if (result.ok) {
+			LOG_INFO(Game, "[DevAPI] %s", result.message.c_str());
 		} else {
-			LOG_WARNING(Game, "[DevAPI] complete: #%llu is not a buildable blueprint", static_cast<unsigned long long>(id));
-			m_ctx.ui->pushNotification("Dev", "Not a blueprint", UI::ToastSeverity::Warning);
+			LOG_WARNING(Game, "[DevAPI] %s", result.message.c_str());
 		}
+		m_ctx.ui->pushNotification("Dev", result.message, result.ok ? UI::ToastSeverity::Info : UI::ToastSeverity::Warning);
+		return result.ok;
 	}
 
 	void DevCommandHandler::devFoundation(const Foundation::DevCommand& cmd) {
@@ -481,7 +374,14 @@ namespace world_sim {
 			return;
 		}
 
-		const ecs::EntityID entity = spawnFoundationBlueprintEntity(commit.id, pts, material);
+		// Centroid (average of vertices) keeps the transform inside the footprint.
+		Foundation::Vec2 centroid{0.0F, 0.0F};
+		for (const auto& p : pts) {
+			centroid += p;
+		}
+		centroid /= static_cast<float>(pts.size());
+		const ecs::EntityID entity =
+			ecs::spawnFoundationBlueprint(*m_ctx.world, constructionWorld, commit.id, {centroid.x, centroid.y}, material);
 		if (entity == ecs::kInvalidEntity) {
 			LOG_WARNING(Game, "[DevAPI] foundation: spawn failed for #%llu", static_cast<unsigned long long>(commit.id));
 			return;
@@ -756,55 +656,6 @@ namespace world_sim {
 		return pts;
 	}
 
-	ecs::EntityID DevCommandHandler::spawnFoundationBlueprintEntity(
-		engine::construction::FoundationId id, const std::vector<Foundation::Vec2>& pts, const std::string& material
-	) {
-		auto& constructionWorld = m_ctx.drawing->world();
-		if (constructionWorld.get(id) == nullptr) {
-			return ecs::kInvalidEntity;
-		}
-
-		const float area = constructionWorld.areaSquareMeters(id);
-
-		const auto& registry = engine::assets::ConstructionRegistry::Get();
-		const auto* mat = registry.getMaterial(material);
-		float		costRate = 0.0F;
-		float		workRate = 0.0F;
-		float		hpRate = 0.0F;
-		if (mat != nullptr) {
-			costRate = mat->costRatePerSquareMeter;
-			workRate = mat->workRatePerSquareMeter;
-			hpRate = mat->hp;
-		}
-
-		auto entity = m_ctx.world->createEntity();
-
-		// Centroid (average of vertices) keeps the transform inside the footprint.
-		Foundation::Vec2 centroid{0.0F, 0.0F};
-		for (const auto& p : pts) {
-			centroid += p;
-		}
-		centroid /= static_cast<float>(pts.size());
-		m_ctx.world->addComponent<ecs::Position>(entity, ecs::Position{{centroid.x, centroid.y}});
-
-		m_ctx.world->addComponent<ecs::Structure>(entity, ecs::Structure{ecs::StructureKind::Foundation, id});
-
-		ecs::StructureBlueprint blueprint;
-		blueprint.phase = ecs::StructureBlueprint::BuildPhase::Clearing;
-		const auto requiredQty = static_cast<uint32_t>(std::ceil(static_cast<double>(area) * static_cast<double>(costRate)));
-		if (requiredQty > 0) {
-			blueprint.required.emplace_back(material, requiredQty);
-		}
-		blueprint.workTotal = area * workRate;
-		m_ctx.world->addComponent<ecs::StructureBlueprint>(entity, std::move(blueprint));
-
-		const float maxHp = area * hpRate;
-		m_ctx.world->addComponent<ecs::StructureHealth>(entity, ecs::StructureHealth{maxHp, maxHp});
-
-		constructionWorld.setEntity(id, entity);
-		return entity;
-	}
-
 	// ===================================================================== STATE READBACK
 
 	std::string DevCommandHandler::serializeState(const std::string& what) {
@@ -847,16 +698,16 @@ namespace world_sim {
 				std::unordered_map<std::string, uint32_t> totals;
 				auto add = [&](const std::optional<ecs::ItemStack>& hand) {
 					if (hand.has_value()) {
-						totals[hand->defName] += hand->quantity;
+						totals[hand->defName()] += hand->quantity;
 					}
 				};
 				add(inv->leftHand);
 				// Two-handed items mirror in both hands; don't double-count.
-				if (!(inv->leftHand.has_value() && inv->rightHand.has_value() && inv->leftHand->defName == inv->rightHand->defName)) {
+				if (!(inv->leftHand.has_value() && inv->rightHand.has_value() && inv->leftHand->defNameId == inv->rightHand->defNameId)) {
 					add(inv->rightHand);
 				}
 				for (const auto& stack : inv->items) {
-					totals[stack.defName] += stack.quantity;
+					totals[stack.defName()] += stack.quantity;
 				}
 				out << ",\"inventory\":{";
 				bool firstItem = true;
@@ -872,7 +723,7 @@ namespace world_sim {
 				// the single logical stack.
 				auto handJson = [&](const std::optional<ecs::ItemStack>& hand) {
 					if (hand.has_value()) {
-						out << "{\"" << jsonEscape(hand->defName) << "\":" << hand->quantity << "}";
+						out << "{\"" << jsonEscape(hand->defName()) << "\":" << hand->quantity << "}";
 					} else {
 						out << "null";
 					}
@@ -885,7 +736,7 @@ namespace world_sim {
 				bool firstBelt = true;
 				for (const auto& slot : inv->belt) {
 					if (slot.has_value()) {
-						out << (firstBelt ? "" : ",") << "\"" << jsonEscape(slot->defName) << "\"";
+						out << (firstBelt ? "" : ",") << "\"" << jsonEscape(slot->defName()) << "\"";
 						firstBelt = false;
 					}
 				}
@@ -999,7 +850,7 @@ namespace world_sim {
 				out << ",\"store\":{";
 				bool firstItem = true;
 				for (const auto& stack : inv->items) {
-					out << (firstItem ? "" : ",") << "\"" << jsonEscape(stack.defName) << "\":" << stack.quantity;
+					out << (firstItem ? "" : ",") << "\"" << jsonEscape(stack.defName()) << "\":" << stack.quantity;
 					firstItem = false;
 				}
 				out << "}";
@@ -1030,7 +881,7 @@ namespace world_sim {
 			out << ",\"inventory\":{";
 			bool firstItem = true;
 			for (const auto& stack : inventory.getAllItems()) {
-				out << (firstItem ? "" : ",") << "\"" << jsonEscape(stack.defName) << "\":" << stack.quantity;
+				out << (firstItem ? "" : ",") << "\"" << jsonEscape(stack.defName()) << "\":" << stack.quantity;
 				firstItem = false;
 			}
 			out << "},\"slots\":" << inventory.getSlotCount() << ",\"maxSlots\":" << inventory.maxCapacity;
@@ -1055,7 +906,21 @@ namespace world_sim {
 			}
 			out << "]}";
 		}
-		out << "]}";
+		out << "]";
+
+		// Colony-wide totals from the ledger: units held, and how many the boxes' minimums keep back
+		if (const auto* ledger = m_ctx.world->tryGetSystem<ecs::ResourceLedgerSystem>()) {
+			const auto& registry = engine::assets::AssetRegistry::Get();
+			out << ",\"totals\":{";
+			bool firstTotal = true;
+			ledger->forEachTotal([&](uint32_t defNameId, uint32_t total, uint32_t reserved) {
+				out << (firstTotal ? "" : ",") << "\"" << jsonEscape(registry.getDefName(defNameId)) << "\":{\"total\":" << total
+					<< ",\"reserved\":" << reserved << "}";
+				firstTotal = false;
+			});
+			out << "}";
+		}
+		out << "}";
 	}
 
 	void DevCommandHandler::serializeTime(std::ostringstream& out) {
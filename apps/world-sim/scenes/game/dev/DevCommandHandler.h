@@ -29,7 +29,6 @@ namespace ecs {
 	class World;
 	class NavigationSystem;
 	struct Inventory;
-	enum class NeedType : std::uint8_t;
 }
 namespace engine::world {
 	class ChunkManager;
@@ -88,18 +87,18 @@ namespace world_sim {
 		void devGive(const Foundation::DevCommand& cmd);
 		void devSpawn(const Foundation::DevCommand& cmd);
 		void devColonist(const Foundation::DevCommand& cmd);
-		void devNeed(const Foundation::DevCommand& cmd);
-		void devTime(const Foundation::DevCommand& cmd);
-		void devTeleport(const Foundation::DevCommand& cmd);
 		void devSelect(const Foundation::DevCommand& cmd);
 		void devKill(const Foundation::DevCommand& cmd);
-		void devComplete(const Foundation::DevCommand& cmd);
 		void devFoundation(const Foundation::DevCommand& cmd);
 		void devWalls(const Foundation::DevCommand& cmd);
 		void devOpening(const Foundation::DevCommand& cmd);
 		void devCraft(const Foundation::DevCommand& cmd);
 		void devStorage(const Foundation::DevCommand& cmd);
 
+		// need/time/teleport/kill/complete go through engine::replay::applySimCommand, shared
+		// with headless replays. Logs and toasts the outcome; returns whether it applied.
+		bool applySimVerb(const Foundation::DevCommand& cmd);
+
 		// --- world-position validity (single gate for every placing/moving verb) ---
 		// True when `at` is on an active walkable nav face. On false, logs+toasts the
 		// refusal in the standard rejection style and the caller creates/moves NOTHING.
@@ -124,9 +123,6 @@ namespace world_sim {
 		ecs::Inventory* nearestColonistInventory(Foundation::Vec2 at);
 		ecs::Inventory* nearestStorageInventory(Foundation::Vec2 at);
 		ecs::EntityID	nearestStorageEntity(Foundation::Vec2 at);
-		ecs::EntityID	spawnFoundationBlueprintEntity(
-			  engine::construction::FoundationId id, const std::vector<Foundation::Vec2>& pts, const std::string& material
-		  );
 
 		// --- state serialization ---
 		void serializeColonists(std::ostringstream& out);
@@ -139,10 +135,7 @@ namespace world_sim {
 
 		// --- pure parsing helpers ---
 		static ecs::EntityID				 parseEntity(const std::string& spec);
-		static bool							 parseNeedType(const std::string& name, ecs::NeedType& out);
 		static bool							 equalsIgnoreCase(const std::string& a, const char* b);
-		static float						 parseClock(const std::string& spec);
-		static float						 parseDuration(const std::string& spec);
 		static Foundation::Vec2				 parsePoint(const std::string& spec);
 		static Foundation::Vec2				 spreadOffset(long i, long n, float radius);
 		static std::vector<Foundation::Vec2> parsePointList(const std::string& spec);
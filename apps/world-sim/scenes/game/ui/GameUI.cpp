@@ -250,6 +250,13 @@ namespace world_sim {
 	}
 
 	bool GameUI::dispatchEvent(UI::InputEvent& event) {
+		// Pointer input can change hover/press states inside cached panels, even
+		// when a panel above consumes the event
+		topBarLayer.observe(event);
+		zoomControlLayer.observe(event);
+		colonistListLayer.observe(event);
+		resourcesLayer.observe(event);
+
 		// Dispatch to UI children in z-order (highest first)
 		// Panels that can overlap get priority
 
@@ -492,8 +499,25 @@ namespace world_sim {
 	}
 
 	void GameUI::render() {
-		// Render top bar (date/time and speed controls)
+		// Re-render stale cached panels first: each re-render is an offscreen pass
+		// that flushes the batch, so they must all happen before any on-screen UI
+		// is emitted. Below, cached panels draw as a single textured quad each.
 		if (topBar) {
+			topBarLayer.refresh(*topBar, topBar->getBarBounds());
+		}
+		if (zoomControlPanel) {
+			zoomControlLayer.refresh(*zoomControlPanel, zoomControlPanel->getControlBounds());
+		}
+		if (colonistList &&
+			colonistListLayer.refresh(colonistList->getBounds(), colonistList->isRenderDirty(), [this]() { colonistList->render(); })) {
+			colonistList->clearRenderDirty();
+		}
+		if (resourcesPanel) {
+			resourcesLayer.refresh(*resourcesPanel, resourcesPanel->getBounds());
+		}
+
+		// Render top bar (date/time and speed controls)
+		if (topBar && !topBarLayer.composite()) {
 			topBar->render();
 		}
 
@@ -503,7 +527,7 @@ namespace world_sim {
 		}
 
 		// Render zoom control panel
-		if (zoomControlPanel) {
+		if (zoomControlPanel && !zoomControlLayer.composite()) {
 			zoomControlPanel->render();
 		}
 
@@ -523,7 +547,7 @@ namespace world_sim {
 		}
 
 		// Render colonist list
-		if (colonistList) {
+		if (colonistList && !colonistListLayer.composite()) {
 			colonistList->render();
 		}
 
@@ -538,7 +562,7 @@ namespace world_sim {
 		}
 
 		// Render resources panel (top-right)
-		if (resourcesPanel) {
+		if (resourcesPanel && !resourcesLayer.composite()) {
 			resourcesPanel->render();
 		}
 
@@ -38,6 +38,7 @@
 #include <ecs/systems/TimeSystem.h>
 
 #include <input/InputEvent.h>
+#include <layer/LayerCache.h>
 
 #include <assets/AssetRegistry.h>
 #include <assets/RecipeRegistry.h>
@@ -218,6 +219,13 @@ class GameUI {
 	std::unique_ptr<CraftingDialog> craftingDialog;
 	std::unique_ptr<StorageConfigDialog> storageConfigDialog;
 
+	// Retained offscreen renders of the panels that only change on data or
+	// pointer input (see UI::LayerCache); idle frames draw each as one quad
+	UI::LayerCache topBarLayer;
+	UI::LayerCache zoomControlLayer;
+	UI::LayerCache colonistListLayer;
+	UI::LayerCache resourcesLayer;
+
 	// ViewModels (own data + change detection)
 	TimeModel timeModel;
 	ColonistListModel colonistListModel;
@@ -80,7 +80,7 @@ std::unordered_set<uint32_t> collectInventorySources(
 			if (stack.quantity == 0) {
 				continue;
 			}
-			const uint32_t id = registry.getDefNameId(stack.defName);
+			const uint32_t id = stack.defNameId;
 			if (id != 0) {
 				obtainable.insert(id);
 			}
@@ -88,7 +88,7 @@ std::unordered_set<uint32_t> collectInventorySources(
 		if (!inventory.carryingPackagedEntity.has_value()) {
 			for (const ecs::ItemStack* hand : {inventory.getLeftHand(), inventory.getRightHand()}) {
 				if (hand != nullptr && hand->quantity > 0) {
-					const uint32_t id = registry.getDefNameId(hand->defName);
+					const uint32_t id = hand->defNameId;
 					if (id != 0) {
 						obtainable.insert(id);
 					}
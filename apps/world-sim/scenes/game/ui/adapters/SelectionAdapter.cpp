@@ -278,15 +278,15 @@ namespace world_sim {
 			bool hasLeft = inventory->leftHand.has_value();
 			bool hasRight = inventory->rightHand.has_value();
 
-			if (hasLeft && hasRight && inventory->leftHand->defName == inventory->rightHand->defName) {
+			if (hasLeft && hasRight && inventory->leftHand->defNameId == inventory->rightHand->defNameId) {
 				// Same item in both hands (2-handed carry)
-				gearItems.push_back("[Holding] " + inventory->leftHand->defName);
+				gearItems.push_back("[Holding] " + inventory->leftHand->defName());
 			} else if (hasLeft || hasRight) {
 				if (hasLeft) {
-					gearItems.push_back("[L] " + inventory->leftHand->defName);
+					gearItems.push_back("[L] " + inventory->leftHand->defName());
 				}
 				if (hasRight) {
-					gearItems.push_back("[R] " + inventory->rightHand->defName);
+					gearItems.push_back("[R] " + inventory->rightHand->defName());
 				}
 			}
 		}
@@ -295,7 +295,7 @@ namespace world_sim {
 		auto backpackItems = inventory ? inventory->getAllItems() : std::vector<ecs::ItemStack>{};
 		for (const auto& item : backpackItems) {
 			std::ostringstream oss;
-			oss << item.defName;
+			oss << item.defName();
 			if (item.quantity > 1) {
 				oss << " x" << item.quantity;
 			}
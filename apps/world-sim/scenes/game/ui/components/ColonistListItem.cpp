@@ -15,6 +15,8 @@ namespace {
 	constexpr float kAvatar = 30.0F;
 	constexpr float kPad = 8.0F;
 	float textScale(float px) { return px / 16.0F; }
+	// Whole percent as drawn on the card (mood label, activity meter)
+	int shownPercent(float ratio) { return static_cast<int>(std::clamp(ratio, 0.0F, 1.0F) * 100.0F); }
 }  // namespace
 
 ColonistListItem::ColonistListItem(const Args& args)
@@ -36,6 +38,35 @@ std::string ColonistListItem::firstNameOf(const std::string& full) {
 	return space == std::string::npos ? full : full.substr(0, space);
 }
 
+void ColonistListItem::setSelected(bool newSelected) {
+	if (selected != newSelected) {
+		selected = newSelected;
+		invalidate();
+	}
+}
+
+void ColonistListItem::setControlled(bool newControlled) {
+	if (controlled != newControlled) {
+		controlled = newControlled;
+		invalidate();
+	}
+}
+
+void ColonistListItem::setMood(float newMood) {
+	if (shownPercent(newMood / 100.0F) != shownPercent(mood / 100.0F)) {
+		invalidate();
+	}
+	mood = newMood;
+}
+
+void ColonistListItem::setActivity(const std::string& label, float progress) {
+	if (label != activity || (progress >= 0.0F) != (activityProgress >= 0.0F) || shownPercent(progress) != shownPercent(activityProgress)) {
+		activity = label;
+		invalidate();
+	}
+	activityProgress = progress;
+}
+
 void ColonistListItem::setColonistData(const adapters::ColonistData& data) {
 	entityId = data.id;
 	name = data.name;
@@ -44,6 +75,7 @@ void ColonistListItem::setColonistData(const adapters::ColonistData& data) {
 	activity = data.activity;
 	activityProgress = data.activityProgress;
 	controlled = data.playerControlled;
+	invalidate();
 }
 
 void ColonistListItem::render() {
@@ -43,13 +43,12 @@ class ColonistListItem : public UI::Component {
 	bool containsPoint(Foundation::Vec2 point) const override;
 
 	// Data updates
-	void setSelected(bool newSelected) { selected = newSelected; }
-	void setControlled(bool newControlled) { controlled = newControlled; }
-	void setMood(float newMood) { mood = newMood; }
-	void setActivity(const std::string& label, float progress) {
-		activity = label;
-		activityProgress = progress;
-	}
+	// Data updates (pushed every frame; each invalidates the cached roster only
+	// when what the card shows changes)
+	void setSelected(bool newSelected);
+	void setControlled(bool newControlled);
+	void setMood(float newMood);
+	void setActivity(const std::string& label, float progress);
 	void setColonistData(const adapters::ColonistData& data);
 
 	// Accessors
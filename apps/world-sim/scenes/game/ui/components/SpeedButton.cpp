@@ -48,6 +48,7 @@ void SpeedButton::setActive(bool newActive) {
 	}
 	active = newActive;
 	updateAppearance();
+	invalidate();
 }
 
 void SpeedButton::setPosition(float x, float y) {
@@ -61,6 +61,7 @@ void ZoomControl::setZoomPercent(int percent) {
 	if (zoomPercent != percent) {
 		zoomPercent = percent;
 		updateZoomText();
+		invalidate();
 	}
 }
 
@@ -168,7 +168,9 @@ void ColonistDetailsModel::extractBioData(const ecs::World& world, ecs::EntityID
 							dest = "crafting station";
 							break;
 						case ecs::TaskType::Haul:
-							dest = task->haulItemDefName.empty() ? "storage" : task->haulItemDefName;
+							dest = (task->haulItemDefNameId != 0)
+								? engine::assets::AssetRegistry::Get().getDefName(task->haulItemDefNameId)
+								: "storage";
 							break;
 						case ecs::TaskType::Build:
 							dest = "build site";
@@ -205,7 +207,9 @@ void ColonistDetailsModel::extractBioData(const ecs::World& world, ecs::EntityID
 					bioData.currentTaskColor = UI::status_ok;
 					break;
 				case ecs::TaskType::Haul:
-					bioData.currentTask = "Hauling " + (task->haulItemDefName.empty() ? "item" : task->haulItemDefName);
+					bioData.currentTask = (task->haulItemDefNameId != 0)
+						? "Hauling " + engine::assets::AssetRegistry::Get().getDefName(task->haulItemDefNameId)
+						: "Hauling item";
 					bioData.currentTaskColor = UI::status_ok;
 					break;
 				case ecs::TaskType::Build:
@@ -347,7 +347,7 @@ void StorageConfigDialogModel::updateInventoryCounts(const ecs::World& world) {
 	if (inventory != nullptr) {
 		for (const auto& stack : inventory->items) {
 			for (auto& item : items) {
-				if (item.defName == stack.defName) {
+				if (item.defName == stack.defName()) {
 					item.currentCount = stack.quantity;
 					break;
 				}
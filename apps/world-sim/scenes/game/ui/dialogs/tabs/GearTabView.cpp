@@ -112,14 +112,14 @@ namespace world_sim {
 			if (!hasLeft && !hasRight) {
 				text->text = "(empty)";
 				text->style.color = mutedColor();
-			} else if (hasLeft && hasRight && gear.leftHand->defName == gear.rightHand->defName) {
+			} else if (hasLeft && hasRight && gear.leftHand->defNameId == gear.rightHand->defNameId) {
 				// Same item in both hands: a two-hand armful (counted once)
-				text->text = gear.leftHand->defName + " x" + std::to_string(gear.leftHand->quantity) + " (both hands)";
+				text->text = gear.leftHand->defName() + " x" + std::to_string(gear.leftHand->quantity) + " (both hands)";
 				text->style.color = bodyColor();
 			} else {
 				std::ostringstream ss;
-				ss << "L: " << (hasLeft ? gear.leftHand->defName : "(empty)");
-				ss << "  R: " << (hasRight ? gear.rightHand->defName : "(empty)");
+				ss << "L: " << (hasLeft ? gear.leftHand->defName() : "(empty)");
+				ss << "  R: " << (hasRight ? gear.rightHand->defName() : "(empty)");
 				text->text = ss.str();
 				text->style.color = bodyColor();
 			}
@@ -134,7 +134,7 @@ namespace world_sim {
 					if (any) {
 						ss << ", ";
 					}
-					ss << slot->defName;
+					ss << slot->defName();
 					any = true;
 				}
 			}
@@ -163,7 +163,7 @@ namespace world_sim {
 			} else {
 				std::ostringstream ss;
 				for (const auto& item : gear.items) {
-					ss << item.defName << " x" << item.quantity << "\n";
+					ss << item.defName() << " x" << item.quantity << "\n";
 				}
 				text->text = ss.str();
 			}
@@ -1,5 +1,7 @@
 #include "ColonistListModel.h"
 
+#include <ecs/components/Colonist.h>
+
 #include <cmath>
 
 namespace world_sim {
@@ -17,45 +19,36 @@ namespace world_sim {
 	} // namespace
 
 	bool ColonistListModel::refresh(ecs::World& world) {
+		// Roster membership, order and names only move when a Colonist component is
+		// added, removed or rewritten, so one O(1) pool check replaces the per-entry
+		// id/name comparison.
+		if (world.changeEpoch() != lastSeenEpoch) {
+			lastSeenEpoch = world.changeEpoch();
+			lastSeenTick = 0; // ticks from the old world mean nothing here
+		}
+		const ecs::ChangeTick now = world.takeChangeTick();
+		const bool rosterChanged = lastSeenTick == 0 || world.anyChangedSince<ecs::Colonist>(lastSeenTick);
+		lastSeenTick = now;
+
 		auto newData = adapters::getColonists(world);
 
-		// `changed` gates a full tile rebuild (roster size / identity / mood crossing the
-		// flicker threshold). Activity progress, however, ticks every frame: store the
-		// fresh data unconditionally so the always-run value pass animates the meters,
-		// while only signalling a rebuild on a structural change.
-		const bool changed = isFirstRefresh || hasChanged(newData);
-		isFirstRefresh = false;
+		// `changed` gates a full tile rebuild (roster change / mood crossing the flicker
+		// threshold). Activity progress, however, ticks every frame: store the fresh data
+		// unconditionally so the always-run value pass animates the meters, while only
+		// signalling a rebuild on a structural change.
+		const bool changed = rosterChanged || moodsChanged(newData);
 		colonistsData = std::move(newData);
 		return changed;
 	}
 
-	bool ColonistListModel::hasChanged(const std::vector<ColonistData>& newData) const {
-		// Structural change: different number of colonists
-		if (newData.size() != colonistsData.size()) {
-			return true;
-		}
-
-		// Value changes: check each colonist
+	bool ColonistListModel::moodsChanged(const std::vector<ColonistData>& newData) const {
+		// Needs decay every tick, so mood is a continuous value: diff it against the
+		// threshold rather than tracking writes
 		for (size_t i = 0; i < newData.size(); ++i) {
-			const auto& oldCol = colonistsData[i];
-			const auto& newCol = newData[i];
-
-			// Different entity (reordering or replacement)
-			if (oldCol.id != newCol.id) {
-				return true;
-			}
-
-			// Name changed (unlikely but possible)
-			if (oldCol.name != newCol.name) {
-				return true;
-			}
-
-			// Mood changed significantly
-			if (moodChanged(oldCol.mood, newCol.mood)) {
+			if (moodChanged(colonistsData[i].mood, newData[i].mood)) {
 				return true;
 			}
 		}
-
 		return false;
 	}
 
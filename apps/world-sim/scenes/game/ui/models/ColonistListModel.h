@@ -4,7 +4,8 @@
 //
 // This model:
 // - Caches colonist data from the ECS world
-// - Detects changes between frames to avoid unnecessary UI rebuilds
+// - Detects changes between frames to avoid unnecessary UI rebuilds: roster
+//   changes come from ECS change tracking on Colonist, mood from a value diff
 // - Owns UI-only state (selected ID) that doesn't belong in ECS
 //
 // Usage:
@@ -19,6 +20,7 @@
 #include <ecs/EntityID.h>
 #include <ecs/World.h>
 
+#include <cstdint>
 #include <vector>
 
 namespace world_sim {
@@ -44,8 +46,8 @@ class ColonistListModel {
 	[[nodiscard]] bool hasSelectedColonist() const { return selectedIdValue != ecs::EntityID{0}; }
 
   private:
-	/// Compare new data with cached data
-	[[nodiscard]] bool hasChanged(const std::vector<ColonistData>& newData) const;
+	/// Compare new moods with cached data (same roster, same order)
+	[[nodiscard]] bool moodsChanged(const std::vector<ColonistData>& newData) const;
 
 	/// Cached colonist data from last refresh
 	std::vector<ColonistData> colonistsData;
@@ -53,8 +55,11 @@ class ColonistListModel {
 	/// Currently selected colonist (UI-only state, not stored in ECS)
 	ecs::EntityID selectedIdValue{0};
 
-	/// Track if this is the first refresh (always return true on first call)
-	bool isFirstRefresh = true;
+	/// Change tick of the last refresh (0 before the first, which always reports a change)
+	ecs::ChangeTick lastSeenTick = 0;
+
+	/// World the tick belongs to; a replaced world starts over from a full refresh
+	uint64_t lastSeenEpoch = 0;
 };
 
 } // namespace world_sim
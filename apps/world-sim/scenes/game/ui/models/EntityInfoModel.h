@@ -11,6 +11,11 @@
 // - Visibility: show/hide panel
 // - Structure: full relayout (different entity selected)
 // - Values: just update progress bars (same entity, values changed)
+//
+// Content is regenerated every frame rather than gated on ECS change ticks: the
+// panels read needs, inventories and work queues that are written in place
+// without markChanged(), plus ConstructionWorld and room records, which are not
+// component pools at all.
 
 #include "scenes/game/ui/components/InfoSlot.h"
 #include "scenes/game/world/selection/SelectionTypes.h"
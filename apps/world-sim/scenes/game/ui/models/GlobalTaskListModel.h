@@ -5,7 +5,9 @@
 // This model:
 // - Caches task data from GoalTaskRegistry via GlobalTaskAdapter
 // - Throttles refresh rate to 5Hz (every 0.2s) to reduce cost
-// - Detects changes between refreshes to avoid unnecessary UI rebuilds
+// - Detects changes between refreshes to avoid unnecessary UI rebuilds. This is a
+//   value diff, not ECS change tracking: goals live in GoalTaskRegistry rather than
+//   a component pool, and distances move with the camera
 // - Tracks total task count for collapsed panel display
 //
 // Usage:
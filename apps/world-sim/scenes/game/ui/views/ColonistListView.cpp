@@ -167,6 +167,16 @@ void ColonistListView::render() {
 	}
 }
 
+bool ColonistListView::isRenderDirty() const {
+	return itemLayout != nullptr && itemLayout->isRenderDirty();
+}
+
+void ColonistListView::clearRenderDirty() {
+	if (itemLayout) {
+		itemLayout->clearRenderDirty();
+	}
+}
+
 Foundation::Rect ColonistListView::getBounds() const {
 	float itemsHeight = static_cast<float>(itemHandles.size()) * itemHeight;
 	float panelHeight = kPadding * 2 + itemsHeight;
@@ -53,6 +53,10 @@ class ColonistListView {
 	/// Get panel bounds for layout calculations
 	[[nodiscard]] Foundation::Rect getBounds() const;
 
+	/// True if any card changed appearance since clearRenderDirty() (drives the cached layer)
+	[[nodiscard]] bool isRenderDirty() const;
+	void clearRenderDirty();
+
   private:
 	/// Rebuild all UI elements from model data
 	void rebuildUI(const std::vector<adapters::ColonistData>& colonists);
@@ -78,6 +78,7 @@ void ResourcesPanel::toggle() {
 	expanded = !expanded;
 	updateChevron();
 	updateLayout();
+	invalidate();
 }
 
 void ResourcesPanel::updateChevron() {
@@ -1,5 +1,6 @@
 #include "TaskListView.h"
 
+#include <assets/AssetRegistry.h>
 #include <ecs/components/Action.h>
 #include <ecs/components/Colonist.h>
 #include <ecs/components/DecisionTrace.h>
@@ -201,12 +202,13 @@ namespace world_sim {
 		});
 
 		// --- Selection summary (why the winning option won) ---
+		const auto& assetRegistry = engine::assets::AssetRegistry::Get();
 		if (auto* trace = world.getComponent<ecs::DecisionTrace>(colonistId)) {
-			if (!trace->selectionSummary.empty()) {
+			if (std::string summary = ecs::describeSelection(*trace, assetRegistry); !summary.empty()) {
 				m_contentLayout->addChild(
 					UI::StatusTextLine(
 						UI::StatusTextLine::Args{
-							.text = trace->selectionSummary,
+							.text = std::move(summary),
 							.status = UI::LineStatus::Active,
 							.fontSize = kTextFontSize,
 							.margin = kLineSpacing * 0.5F,
@@ -306,7 +308,7 @@ namespace world_sim {
 				// Primary line: "[T4 Work order] reason - score N"
 				std::string primaryText =
 					"[T" + std::to_string(option.tier) + " " + tierLabel(option.tier) + "] " +
-					option.reason +
+					ecs::describeOption(option, assetRegistry) +
 					" - score " + std::to_string(static_cast<int>(option.score));
 
 				m_contentLayout->addChild(
@@ -9,6 +9,7 @@
 #include <cctype>
 #include <cstdio>
 #include <string>
+#include <utility>
 
 namespace world_sim {
 
@@ -62,21 +63,32 @@ void TopBar::layout(const Foundation::Rect& newBounds) {
 void TopBar::updateData(const TimeModel& timeModel, int survivorCount) {
 	const auto& d = timeModel.data();
 
-	dayStr = "Day " + std::to_string(d.day);
+	std::string newDay = "Day " + std::to_string(d.day);
 
-	seasonStr = d.season;
-	for (char& c : seasonStr) {
+	std::string newSeason = d.season;
+	for (char& c : newSeason) {
 		c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
 	}
 
 	char buf[8];
 	std::snprintf(buf, sizeof(buf), "%02d:%02d", d.hour, d.minute);
-	timeStr = buf;
+	std::string newTime = buf;
 
 	// Split the sub-line so the middot separator can be drawn as a vector dot
 	// (symbols are iconography, not font glyphs).
-	survivorPart = std::to_string(survivorCount) + (survivorCount == 1 ? " survivor" : " survivors");
-	solPart = "Sol " + std::to_string(d.day);
+	std::string newSurvivors = std::to_string(survivorCount) + (survivorCount == 1 ? " survivor" : " survivors");
+	std::string newSol = "Sol " + std::to_string(d.day);
+
+	// Called every frame, but the text only changes once per game minute; only
+	// then does the cached bar need re-rendering
+	if (newDay != dayStr || newSeason != seasonStr || newTime != timeStr || newSurvivors != survivorPart || newSol != solPart) {
+		dayStr = std::move(newDay);
+		seasonStr = std::move(newSeason);
+		timeStr = std::move(newTime);
+		survivorPart = std::move(newSurvivors);
+		solPart = std::move(newSol);
+		invalidate();
+	}
 
 	updateSpeedButtonStates(d.speed);
 	positionElements();
@@ -53,6 +53,9 @@ class TopBar : public UI::Component {
 	/// Get height of the top bar
 	[[nodiscard]] float getHeight() const override { return kBarHeight; }
 
+	/// Screen rect the bar paints into
+	[[nodiscard]] Foundation::Rect getBarBounds() const { return {bounds.x, bounds.y, bounds.width, kBarHeight}; }
+
   private:
 	// Layout constants
 	static constexpr float kBarHeight = 52.0F;
@@ -16,12 +16,19 @@ void ZoomControlPanel::layout(const Foundation::Rect& newBounds) {
 
 	if (auto* control = getChild<ZoomControl>(zoomControlHandle)) {
 		// Position on right side of viewport
-		float zoomX = newBounds.x + newBounds.width - kRightMargin - kControlWidth;
-		float zoomY = newBounds.y + newBounds.height - kBottomMargin - kControlHeight;
-		control->setPosition(zoomX, zoomY);
+		const Foundation::Rect controlBounds = getControlBounds();
+		control->setPosition(controlBounds.x, controlBounds.y);
 	}
 }
 
+Foundation::Rect ZoomControlPanel::getControlBounds() const {
+	return {
+		bounds.x + bounds.width - kRightMargin - kControlWidth,
+		bounds.y + bounds.height - kBottomMargin - kControlHeight,
+		kControlWidth,
+		kControlHeight};
+}
+
 void ZoomControlPanel::setZoomPercent(int percent) {
 	if (auto* control = getChild<ZoomControl>(zoomControlHandle)) {
 		control->setZoomPercent(percent);
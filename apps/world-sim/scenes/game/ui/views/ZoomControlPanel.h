@@ -38,6 +38,9 @@ class ZoomControlPanel : public UI::Component {
 	/// Handle input events - delegates to children via dispatchEvent
 	bool handleEvent(UI::InputEvent& event) override;
 
+	/// Screen rect of the zoom control (the panel itself spans the viewport)
+	[[nodiscard]] Foundation::Rect getControlBounds() const;
+
 	// render() inherited from Component - auto-renders children
 
   private:
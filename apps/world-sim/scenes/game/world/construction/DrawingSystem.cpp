@@ -4,6 +4,7 @@
 
 #include <assets/ConstructionRegistry.h>
 #include <construction/OpeningGeometry.h>
+#include <ecs/ColonySetup.h>
 #include <ecs/components/Structure.h>
 #include <ecs/components/StructureBlueprint.h>
 #include <ecs/components/StructureHealth.h>
@@ -491,59 +492,24 @@ namespace world_sim {
 			return ecs::EntityID{0};
 		}
 
-		const auto* foundation = constructionWorld_.get(id);
-		if (foundation == nullptr) {
+		if (constructionWorld_.get(id) == nullptr) {
 			return ecs::EntityID{0};
 		}
 
-		const float area = constructionWorld_.areaSquareMeters(id);
-
-		// Material-driven manifest, work, and HP. Invariant: the manifest defName IS
-		// the material name; construction config keys materials by name and the haul
-		// chain resolves items by that same name, so the two stay aligned by design.
-		const auto& registry = ConstructionRegistry::Get();
-		const auto* material = registry.getMaterial(activeMaterial_);
-		float		costRate = 0.0F;
-		float		workRate = 0.0F;
-		float		hpRate = 0.0F;
-		if (material != nullptr) {
-			costRate = material->costRatePerSquareMeter;
-			workRate = material->workRatePerSquareMeter;
-			hpRate = material->hp;
-		}
-
-		auto entity = ecsWorld_->createEntity();
-
 		// Position at the polygon centroid (world meters). Centroid keeps the
 		// entity's transform inside its own footprint for concave shapes too.
 		const Foundation::Vec2 centroid = polygonCentroid(points_);
-		ecsWorld_->addComponent<ecs::Position>(entity, ecs::Position{{centroid.x, centroid.y}});
-
-		ecsWorld_->addComponent<ecs::Structure>(entity, ecs::Structure{ecs::StructureKind::Foundation, id});
-
-		ecs::StructureBlueprint blueprint;
-		blueprint.phase = ecs::StructureBlueprint::BuildPhase::Clearing;
-		const auto requiredQty = static_cast<uint32_t>(std::ceil(static_cast<double>(area) * static_cast<double>(costRate)));
-		if (requiredQty > 0) {
-			blueprint.required.emplace_back(activeMaterial_, requiredQty);
-		}
-		blueprint.workTotal = area * workRate;
-		ecsWorld_->addComponent<ecs::StructureBlueprint>(entity, std::move(blueprint));
-
-		// HP scales with area; full HP is only meaningful once built but the
-		// component exists from creation (architecture: avoid a later migration).
-		const float maxHp = area * hpRate;
-		ecsWorld_->addComponent<ecs::StructureHealth>(entity, ecs::StructureHealth{maxHp, maxHp});
-
-		constructionWorld_.setEntity(id, entity);
+		const ecs::EntityID	   entity =
+			ecs::spawnFoundationBlueprint(*ecsWorld_, constructionWorld_, id, {centroid.x, centroid.y}, activeMaterial_);
 
+		const auto& blueprint = *ecsWorld_->getComponent<ecs::StructureBlueprint>(entity);
 		LOG_INFO(
 			Game,
 			"Foundation #%llu spawned: %.1f m^2, %s, %u materials, %.0f work, entity %u",
 			static_cast<unsigned long long>(id),
-			static_cast<double>(area),
+			static_cast<double>(constructionWorld_.areaSquareMeters(id)),
 			activeMaterial_.c_str(),
-			requiredQty,
+			blueprint.required.empty() ? 0U : blueprint.required.front().second,
 			static_cast<double>(blueprint.workTotal),
 			static_cast<uint32_t>(entity)
 		);
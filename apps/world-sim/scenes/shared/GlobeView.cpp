@@ -32,6 +32,7 @@ void GlobeView::setWorld(std::shared_ptr<const worldgen::GeneratedWorld> world)
 		uint32_t subdiv = currentWorld->grid->subdivision();
 		mesh.build(subdiv, *currentWorld->grid);
 		colorizer.init(subdiv);
+		detail.init(subdiv, colorizer.baseSize());
 		chooseMinDistance(subdiv);
 		builtGrid = currentWorld->grid.get();
 
@@ -53,6 +54,7 @@ void GlobeView::setWorld(std::shared_ptr<const worldgen::GeneratedWorld> world)
 void GlobeView::refreshColors() {
 	if (currentWorld && colorizer.isReady()) {
 		colorizer.requestBake(currentWorld, mode, pool);
+		detail.setSource(currentWorld, mode);
 	}
 }
 
@@ -86,12 +88,14 @@ void GlobeView::render(const Foundation::Rect& rect, float logicalW, float logic
 	int ph = static_cast<int>(rect.height * sy);
 	if (pw <= 0 || ph <= 0) return;
 
-	// Pump async base-tier color uploads for the current view.
+	// Pump async base-tier color uploads, then stream detail pages for the
+	// current view.
 	colorizer.uploadPending();
+	detail.update(camera, pw, ph);
 
 	renderer.render(mesh, colorizer,
 	                currentWorld ? currentWorld->grid->subdivision() : 0,
-	                camera, pw, ph);
+	                camera, pw, ph, &detail);
 
 	// GL viewport origin is bottom-left; UI rect origin is top-left
 	glViewport(px, vp[3] - py - ph, pw, ph);
@@ -10,6 +10,7 @@
 
 #include <planet-view/OrbitCamera.h>
 #include <planet-view/PlanetColorizer.h>
+#include <planet-view/PlanetDetailTier.h>
 #include <planet-view/PlanetMesh.h>
 #include <planet-view/PlanetPicker.h>
 #include <planet-view/PlanetRenderer.h>
@@ -74,6 +75,7 @@ class GlobeView {
 	foundation::TaskPool        pool;
 	planetview::PlanetMesh      mesh;
 	planetview::PlanetColorizer colorizer;
+	planetview::PlanetDetailTier detail; // exact tile colors where zoomed in (n > base size)
 	planetview::PlanetRenderer  renderer;
 	planetview::OrbitCamera     camera;
 
@@ -39,6 +39,7 @@ namespace {
 			LOG_INFO(Game, "SplashScene - Entering");
 			m_timer = 0.0F;
 			m_lastShownCount = -1;
+			m_lastShownBuilt = -1;
 			m_failed = false;
 			m_errorLines.clear();
 			m_phase = "Initializing";
@@ -60,9 +61,12 @@ namespace {
 			}
 
 			const int loaded = progress.defsLoaded.load();
-			if (loaded != m_lastShownCount) {
+			const int built = progress.templatesBuilt.load();
+			if (loaded != m_lastShownCount || built != m_lastShownBuilt) {
 				m_lastShownCount = loaded;
-				m_phase = "Mounting salvage manifest - " + std::to_string(loaded) + " defs";
+				m_lastShownBuilt = built;
+				m_phase = built > 0 ? "Fabricating templates - " + std::to_string(built) + "/" + std::to_string(loaded)
+									: "Mounting salvage manifest - " + std::to_string(loaded) + " defs";
 			}
 
 			if (!registry.isLoadComplete()) {
@@ -220,6 +224,7 @@ namespace {
 
 		float					 m_timer = 0.0F;
 		int						 m_lastShownCount = -1;
+		int						 m_lastShownBuilt = -1;
 		bool					 m_failed = false;
 		float					 m_progress = 0.0F;
 		std::string				 m_phase;
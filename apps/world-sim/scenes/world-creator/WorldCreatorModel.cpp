@@ -7,6 +7,7 @@ namespace world_sim {
 
 WorldCreatorModel::WorldCreatorModel() {
 	params = worldgen::PlanetParams::preset(worldgen::Preset::EarthLike);
+	generator.setProgressive(true);
 }
 
 void WorldCreatorModel::setPreset(worldgen::Preset preset) {
@@ -12,6 +12,8 @@
 //
 // Three states: Configuring (parameter editing), Generating (background thread),
 // Reviewing (results visible). The scene polls this model each frame.
+// The generator runs in progressive mode, so a low-resolution preview of the
+// planet is available (getPreview) long before the full-resolution result.
 
 namespace world_sim {
 
@@ -55,6 +57,12 @@ class WorldCreatorModel {
 	WorldCreatorState getState() const { return state; }
 	const worldgen::PlanetParams& getParams() const { return params; }
 
+	// Display-only preview of the in-flight generation (nullptr until the
+	// preview pass finishes). Never landed on or saved.
+	std::shared_ptr<const worldgen::GeneratedWorld> getPreview() const {
+		return state == WorldCreatorState::Generating ? generator.preview() : nullptr;
+	}
+
 	// Latest completed world (valid when state == Reviewing)
 	std::shared_ptr<const worldgen::GeneratedWorld> getResult() const { return result; }
 
@@ -1,7 +1,8 @@
 // World Creator Scene
-// Three states: Configuring (parameter panel), Generating (progress only -- the
-// globe is hidden so the half-built sphere never shows), Reviewing (final globe;
-// click a land tile to inspect it, then Land to drop the colony there).
+// Three states: Configuring (parameter panel), Generating (progress plus the
+// coarse preview globe once it arrives -- per-stage half-built snapshots never
+// show), Reviewing (final globe; click a land tile to inspect it, then Land to
+// drop the colony there).
 
 #include "GameStartConfig.h"
 #include "SceneTypes.h"
@@ -157,7 +158,13 @@ class WorldCreatorScene : public engine::IScene {
 					          static_cast<int>(prog.state));
 				}
 				onStateChanged(newState);
+			} else if (auto preview = model.getPreview(); preview && preview != shownPreview) {
+				// Progressive preview arrived: show it while the full-resolution
+				// run continues. Orbit keys work; picking waits for the result.
+				shownPreview = preview;
+				globe.setWorld(preview);
 			}
+			if (shownPreview) handleCameraKeys(dt);
 		} else if (state == world_sim::WorldCreatorState::Reviewing) {
 			handleCameraKeys(dt);
 		}
@@ -177,10 +184,13 @@ class WorldCreatorScene : public engine::IScene {
 		Foundation::Rect rect = mainRect();
 		auto state = model.getState();
 
-		// The globe exists on screen only once generation completes; while
-		// configuring or generating we show a placeholder, never the sphere.
+		// The globe exists on screen once generation completes, or while
+		// generating once the coarse preview has been handed to it; otherwise
+		// we show a placeholder, never a half-built sphere.
 		const bool showGlobe =
-			state == world_sim::WorldCreatorState::Reviewing && globe.isReady();
+			(state == world_sim::WorldCreatorState::Reviewing ||
+			 (state == world_sim::WorldCreatorState::Generating && shownPreview)) &&
+			globe.isReady();
 
 		// 3D pass first: Primitives batches flush after the scene, so all 2D
 		// UI composites on top of the blitted globe.
@@ -234,6 +244,10 @@ class WorldCreatorScene : public engine::IScene {
 	world_sim::GlobeView globe;
 	std::string errorText;
 
+	// Preview world currently on the globe while Generating (nullptr when none).
+	// Cleared on every state change so a new run starts from the placeholder.
+	std::shared_ptr<const worldgen::GeneratedWorld> shownPreview;
+
 	// Landing selection (Reviewing only). The site auto-suggests on completion
 	// and updates on each land-tile click.
 	planetview::LatLon                 selectedSite{};
@@ -367,6 +381,7 @@ class WorldCreatorScene : public engine::IScene {
 		errorText.clear();
 		siteValid = false;
 		pickHint.clear();
+		shownPreview.reset();
 
 		model.startGeneration();
 		if (panel) panel->setGenerating(true);
@@ -376,6 +391,7 @@ class WorldCreatorScene : public engine::IScene {
 	}
 
 	void onStateChanged(world_sim::WorldCreatorState newState) {
+		shownPreview.reset();
 		if (newState == world_sim::WorldCreatorState::Reviewing) {
 			if (panel)       panel->setGenerating(false);
 			if (progressBar) progressBar->visible = false;
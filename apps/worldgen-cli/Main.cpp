@@ -4,10 +4,18 @@
 //   worldgen-cli --out <dir> [--n 256] [--seed 42] [--water 0.7]
 //                [--plates 12] [--age 4.5e9] [--threads N]
 //                [--verify-threads a,b]
+//   worldgen-cli --out <dir> --batch [--seeds a-b] [--sweep-n ..]
+//                [--sweep-plates ..] [--sweep-water ..] [--sweep-age ..]
+//                [--jobs J] [--threads N]
 //
 // Outputs:
 //   <dir>/<mode>.bmp  — equirectangular BMP for every debug mode
 //   <dir>/stats.json  — WorldStats as JSON (hand-written, no deps)
+//   <dir>/profile.json — per-stage wall/CPU time, TaskPool slab histograms and
+//                       idle time, RSS deltas, WorldData bytes per field
+//   <dir>/batch.json, <dir>/batch.csv — batch mode: one row per planet
+//                       (params, worldHash, stage wall/CPU/idle time, peak RSS,
+//                       WorldStats scalars); no BMPs
 //
 // Exit codes: 0 ok, 1 generation failed, 2 thread-determinism mismatch,
 //             3 bad arguments, 4 output error.
@@ -24,6 +32,8 @@
 #include "worldgen/tectonics/PlateSim.h"
 #include "worldgen/tectonics/TectonicHistory.h"
 
+#include <metrics/SystemResources.h>
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -32,6 +42,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -56,8 +69,41 @@ struct CliArgs {
     bool     hasExpectHash{false}; // --expect-hash <hex>: gate worldHash
     uint64_t expectHash{0};        // expected worldHash (exit 5 on mismatch)
     std::string savePlanetPath;    // --save-planet <path>: write .wsplanet, skip BMP/stats
+
+    // Batch mode: the cross product of the seed range and every sweep list.
+    // An empty sweep list means "the single-run value" (--n, --plates, ...).
+    bool     batch{false};
+    uint64_t seedFirst{0};         // --seeds a-b (inclusive); unset = --seed only
+    uint64_t seedLast{0};
+    bool     hasSeedRange{false};
+    std::vector<double> sweepN;
+    std::vector<double> sweepPlates;
+    std::vector<double> sweepWater;
+    std::vector<double> sweepAge;
+    int      jobs{0};              // --jobs: planets in flight (0 = auto)
 };
 
+// Parse a comma-separated number list ("8,12,16"). Returns false on an empty
+// or malformed entry.
+static bool parseList(const char* v, std::vector<double>& out) {
+    out.clear();
+    const char* p = v;
+    while (*p != '\0') {
+        char* end = nullptr;
+        double x = std::strtod(p, &end);
+        if (end == p) return false;
+        out.push_back(x);
+        if (*end == ',') {
+            p = end + 1;
+        } else if (*end == '\0') {
+            p = end;
+        } else {
+            return false;
+        }
+    }
+    return !out.empty();
+}
+
 static void printUsage() {
     std::fprintf(stderr,
         "Usage: worldgen-cli --out <dir> [options]\n"
@@ -77,6 +123,16 @@ static void printUsage() {
         "                        dump plateId + crustAge frames + final boundaryType\n"
         "  --n-coarse <int>      sim-only coarse subdivision (default 128)\n"
         "  --frame-every <int>   sim-only: dump a frame every N steps (default 10)\n"
+        "  --batch               generate many planets in one process; writes\n"
+        "                        batch.json + batch.csv to --out (no BMPs)\n"
+        "  --seeds <a>-<b>       batch: inclusive seed range (default: --seed)\n"
+        "  --sweep-n <list>      batch: comma list of n values (default: --n)\n"
+        "  --sweep-plates <list> batch: comma list of plate counts\n"
+        "  --sweep-water <list>  batch: comma list of water fractions\n"
+        "  --sweep-age <list>    batch: comma list of planet ages\n"
+        "  --jobs <int>          batch: planets generated concurrently; the\n"
+        "                        --threads budget is split between them\n"
+        "                        (default: one per ~4 threads of the budget)\n"
     );
 }
 
@@ -126,6 +182,45 @@ static bool parseArgs(int argc, char** argv, CliArgs& out) {
         } else if (eq("--save-planet")) {
             const char* v = next(); if (!v) return false;
             out.savePlanetPath = v;
+        } else if (eq("--batch")) {
+            out.batch = true;
+        } else if (eq("--seeds")) {
+            const char* v = next(); if (!v) return false;
+            char* end = nullptr;
+            out.seedFirst = std::strtoull(v, &end, 10);
+            if (end == v || *end != '-') {
+                std::fprintf(stderr, "--seeds expects a-b\n");
+                return false;
+            }
+            const char* second = end + 1;
+            out.seedLast = std::strtoull(second, &end, 10);
+            if (end == second || *end != '\0' || out.seedLast < out.seedFirst) {
+                std::fprintf(stderr, "--seeds expects a-b with a <= b\n");
+                return false;
+            }
+            out.hasSeedRange = true;
+        } else if (eq("--sweep-n") || eq("--sweep-plates") ||
+                   eq("--sweep-water") || eq("--sweep-age")) {
+            const char* flag = argv[i];
+            const char* v = next(); if (!v) return false;
+            std::vector<double>& dst =
+                std::strcmp(flag, "--sweep-n") == 0      ? out.sweepN
+              : std::strcmp(flag, "--sweep-plates") == 0 ? out.sweepPlates
+              : std::strcmp(flag, "--sweep-water") == 0  ? out.sweepWater
+                                                         : out.sweepAge;
+            if (!parseList(v, dst)) {
+                std::fprintf(stderr, "%s expects a comma-separated number list\n", flag);
+                return false;
+            }
+        } else if (eq("--jobs")) {
+            const char* v = next(); if (!v) return false;
+            char* end = nullptr;
+            const long jobs = std::strtol(v, &end, 10);
+            if (end == v || *end != '\0' || jobs <= 0 || jobs > std::numeric_limits<int>::max()) {
+                std::fprintf(stderr, "--jobs expects a positive integer, got \"%s\"\n", v);
+                return false;
+            }
+            out.jobs = static_cast<int>(jobs);
         } else if (eq("--sim-only")) {
             out.simOnly = true;
         } else if (eq("--n-coarse")) {
@@ -170,7 +265,8 @@ using Clock = std::chrono::steady_clock;
 struct RunResult {
     std::shared_ptr<const worldgen::GeneratedWorld> world;
     double wallSeconds{};
-    std::vector<double> stageSeconds; // one per stage, in order (best-effort)
+    std::vector<double> stageSeconds; // one per executed stage, in order
+    worldgen::GenerationProfile profile;
 };
 
 static RunResult runGeneration(const worldgen::PlanetParams& params, int threadCount) {
@@ -180,22 +276,16 @@ static RunResult runGeneration(const worldgen::PlanetParams& params, int threadC
     auto t0 = Clock::now();
     gen.start(params);
 
-    // Poll ~once/second: print stage progress to stdout.
+    // Poll: print stage progress to stdout. Timing comes from the generator's
+    // own per-stage record, not from this loop's poll cadence.
     int lastStage = -1;
-    auto stageStart = t0;
-    std::vector<double> stageTimes;
 
     while (true) {
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
         auto prog = gen.progress();
 
         if (prog.stageIndex != lastStage && prog.stageIndex >= 0) {
-            if (lastStage >= 0) {
-                double elapsed = std::chrono::duration<double>(Clock::now() - stageStart).count();
-                stageTimes.push_back(elapsed);
-            }
-            stageStart = Clock::now();
-            lastStage  = prog.stageIndex;
+            lastStage = prog.stageIndex;
             std::printf("  stage %d: %s\n",
                         prog.stageIndex + 1,
                         prog.stageName ? prog.stageName : "?");
@@ -206,17 +296,16 @@ static RunResult runGeneration(const worldgen::PlanetParams& params, int threadC
         if (prog.state == State::Complete ||
             prog.state == State::Failed   ||
             prog.state == State::Cancelled) {
-            if (lastStage >= 0) {
-                double elapsed = std::chrono::duration<double>(Clock::now() - stageStart).count();
-                stageTimes.push_back(elapsed);
-            }
             break;
         }
     }
 
     res.world       = gen.takeResult();
     res.wallSeconds = std::chrono::duration<double>(Clock::now() - t0).count();
-    res.stageSeconds = std::move(stageTimes);
+    res.profile     = gen.profile();
+    for (const auto& st : res.profile.stages) {
+        res.stageSeconds.push_back(st.wallSeconds);
+    }
     return res;
 }
 
@@ -407,6 +496,75 @@ static void writeStatsJson(const std::string& path,
     std::fclose(fp);
 }
 
+// profile.json: one run's GenerationProfile. Key order and units are fixed so
+// two files diff cleanly and a script can compare stage-by-stage across runs.
+// Process-wide figures (CPU, RSS) assume nothing else ran in the process.
+static void writeProfileJson(const std::string& path,
+                             const worldgen::GeneratedWorld& world,
+                             const worldgen::GenerationProfile& p) {
+    std::FILE* fp = std::fopen(path.c_str(), "w");
+    if (!fp) {
+        std::fprintf(stderr, "Cannot write %s\n", path.c_str());
+        return;
+    }
+    const double mb = 1024.0 * 1024.0;
+    auto deltaMB = [&](uint64_t after, uint64_t before) {
+        return (static_cast<double>(after) - static_cast<double>(before)) / mb;
+    };
+
+    std::fprintf(fp, "{\n");
+    std::fprintf(fp, "  \"n\": %u,\n", world.params.gridSubdivision);
+    std::fprintf(fp, "  \"seed\": %llu,\n", static_cast<unsigned long long>(world.params.seed));
+    std::fprintf(fp, "  \"worldHash\": \"0x%016llx\",\n",
+                 static_cast<unsigned long long>(world.worldHash));
+    std::fprintf(fp, "  \"tileCount\": %u,\n", p.tileCount);
+    std::fprintf(fp, "  \"poolThreads\": %u,\n", p.poolThreads);
+    std::fprintf(fp, "  \"wallSeconds\": %.4f,\n", p.wallSeconds);
+    std::fprintf(fp, "  \"cpuSeconds\": %.4f,\n", p.cpuSeconds);
+    std::fprintf(fp, "  \"previewWallSeconds\": %.4f,\n", p.previewWallSeconds);
+    std::fprintf(fp, "  \"peakRssStartMB\": %.1f,\n", static_cast<double>(p.peakRssStartBytes) / mb);
+    std::fprintf(fp, "  \"peakRssEndMB\": %.1f,\n", static_cast<double>(p.peakRssEndBytes) / mb);
+
+    uint64_t totalBytes = 0;
+    std::fprintf(fp, "  \"worldDataBytes\": {");
+    for (size_t i = 0; i < p.fieldBytes.size(); ++i) {
+        totalBytes += p.fieldBytes[i].bytes;
+        std::fprintf(fp, "%s\"%s\": %llu", i > 0 ? ", " : "", p.fieldBytes[i].name,
+                     static_cast<unsigned long long>(p.fieldBytes[i].bytes));
+    }
+    std::fprintf(fp, "},\n");
+    std::fprintf(fp, "  \"worldDataTotalBytes\": %llu,\n",
+                 static_cast<unsigned long long>(totalBytes));
+
+    // slabHistogramUs[k] counts slabs of [2^k, 2^(k+1)) microseconds.
+    std::fprintf(fp, "  \"stages\": [\n");
+    for (size_t i = 0; i < p.stages.size(); ++i) {
+        const worldgen::StageProfile& st = p.stages[i];
+        std::fprintf(fp, "    {\"name\": \"%s\", \"iceFeedback\": %s, \"wallSeconds\": %.4f, "
+                         "\"cpuSeconds\": %.4f,\n",
+                     st.stageName ? st.stageName : "?", st.iceFeedback ? "true" : "false",
+                     st.wallSeconds, st.cpuSeconds);
+        std::fprintf(fp, "     \"rssBeforeMB\": %.1f, \"rssDeltaMB\": %.1f, \"peakRssDeltaMB\": %.1f,\n",
+                     static_cast<double>(st.rssBeforeBytes) / mb,
+                     deltaMB(st.rssAfterBytes, st.rssBeforeBytes),
+                     static_cast<double>(st.peakRssDeltaBytes) / mb);
+        std::fprintf(fp, "     \"parallelFor\": {\"calls\": %llu, \"slabs\": %llu, "
+                         "\"wallSeconds\": %.4f, \"busySeconds\": %.4f, \"idleSeconds\": %.4f, "
+                         "\"slabHistogramUs\": [",
+                     static_cast<unsigned long long>(st.pool.calls),
+                     static_cast<unsigned long long>(st.pool.slabs),
+                     st.pool.wallSeconds, st.pool.busySeconds, st.pool.idleSeconds);
+        for (size_t k = 0; k < st.pool.slabHistogram.size(); ++k) {
+            std::fprintf(fp, "%s%llu", k > 0 ? "," : "",
+                         static_cast<unsigned long long>(st.pool.slabHistogram[k]));
+        }
+        std::fprintf(fp, "]}}%s\n", i + 1 < p.stages.size() ? "," : "");
+    }
+    std::fprintf(fp, "  ]\n");
+    std::fprintf(fp, "}\n");
+    std::fclose(fp);
+}
+
 // ============================================================================
 // Human summary table
 // ============================================================================
@@ -868,6 +1026,318 @@ static int runSimOnly(const CliArgs& args) {
 // main
 // ============================================================================
 
+// ============================================================================
+// --batch mode: many planets per process, one consolidated report
+// ============================================================================
+
+// One planet of a batch: its inputs and everything measured about it. The
+// GeneratedWorld itself is dropped as soon as its stats are taken so a long
+// sweep holds at most `jobs` worlds in memory.
+struct BatchEntry {
+    worldgen::PlanetParams params;
+    bool     ok{false};
+    uint64_t worldHash{};
+    double   wallSeconds{};
+    worldgen::GenerationProfile profile;
+    // Process-wide VmHWM when this planet finished, NOT this planet's own peak:
+    // the high-water mark never falls and concurrent jobs share it, so it only
+    // bounds what the batch had reached by then.
+    uint64_t processPeakRssBytes{};
+    uint64_t worldDataBytes{};   // sum of WorldData array capacities
+    worldgen::WorldStats stats;
+    worldgen::WorldSummary summary;
+};
+
+static uint64_t worldDataBytes(const worldgen::WorldData& d) {
+    uint64_t bytes = 0;
+    worldgen::forEachFieldArray(d, [&](worldgen::WorldField, const auto& arr) {
+        bytes += static_cast<uint64_t>(arr.capacity()) * sizeof(arr[0]);
+    });
+    return bytes;
+}
+
+// Expand the seed range x sweep lists into the planet list, in a fixed nested
+// order (n, plates, water, age, seed) so row order is reproducible.
+static std::vector<worldgen::PlanetParams> expandBatch(const CliArgs& args) {
+    auto orSingle = [](const std::vector<double>& v, double single) {
+        return v.empty() ? std::vector<double>{single} : v;
+    };
+    const auto ns     = orSingle(args.sweepN, static_cast<double>(args.n));
+    const auto plates = orSingle(args.sweepPlates, static_cast<double>(args.plates));
+    const auto waters = orSingle(args.sweepWater, args.water);
+    const auto ages   = orSingle(args.sweepAge, args.age);
+    const uint64_t seedFirst = args.hasSeedRange ? args.seedFirst : args.seed;
+    const uint64_t seedLast  = args.hasSeedRange ? args.seedLast : args.seed;
+
+    std::vector<worldgen::PlanetParams> out;
+    for (double n : ns) {
+        for (double pc : plates) {
+            for (double w : waters) {
+                for (double a : ages) {
+                    for (uint64_t seed = seedFirst;; ++seed) {
+                        worldgen::PlanetParams p =
+                            worldgen::PlanetParams::preset(worldgen::Preset::EarthLike);
+                        p.gridSubdivision    = static_cast<uint32_t>(n);
+                        p.tectonicPlateCount = static_cast<int>(pc);
+                        p.waterAmount        = w;
+                        p.planetAge          = a;
+                        p.seed               = seed;
+                        out.push_back(p);
+                        if (seed == seedLast) break;
+                    }
+                }
+            }
+        }
+    }
+    return out;
+}
+
+static void writeBatchJson(const std::string& path,
+                           const std::vector<BatchEntry>& entries,
+                           int jobs, unsigned poolThreads,
+                           double totalSeconds, uint64_t processPeakRss) {
+    std::FILE* fp = std::fopen(path.c_str(), "w");
+    if (!fp) {
+        std::fprintf(stderr, "Cannot write %s\n", path.c_str());
+        return;
+    }
+    const double mb = 1024.0 * 1024.0;
+    std::fprintf(fp, "{\n");
+    std::fprintf(fp, "  \"planetCount\": %zu,\n", entries.size());
+    std::fprintf(fp, "  \"jobs\": %d,\n", jobs);
+    std::fprintf(fp, "  \"poolThreadsPerPlanet\": %u,\n", poolThreads);
+    std::fprintf(fp, "  \"totalWallSeconds\": %.3f,\n", totalSeconds);
+    std::fprintf(fp, "  \"planetsPerMinute\": %.3f,\n",
+                 totalSeconds > 0.0 ? 60.0 * static_cast<double>(entries.size()) / totalSeconds : 0.0);
+    std::fprintf(fp, "  \"processPeakRssMB\": %.1f,\n", static_cast<double>(processPeakRss) / mb);
+    std::fprintf(fp, "  \"planets\": [\n");
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const BatchEntry& e = entries[i];
+        const worldgen::WorldStats& st = e.stats;
+        std::fprintf(fp, "    {\"seed\": %llu, \"n\": %u, \"plates\": %d, \"water\": %.3f, "
+                         "\"age\": %.4g, \"ok\": %s, \"worldHash\": \"0x%016llx\",\n",
+                     static_cast<unsigned long long>(e.params.seed),
+                     e.params.gridSubdivision, e.params.tectonicPlateCount,
+                     e.params.waterAmount, e.params.planetAge,
+                     e.ok ? "true" : "false",
+                     static_cast<unsigned long long>(e.worldHash));
+        std::fprintf(fp, "     \"wallSeconds\": %.3f, \"processPeakRssMB\": %.1f, \"worldDataMB\": %.1f,\n",
+                     e.wallSeconds,
+                     static_cast<double>(e.processPeakRssBytes) / mb,
+                     static_cast<double>(e.worldDataBytes) / mb);
+        std::fprintf(fp, "     \"cpuSeconds\": %.3f,\n", e.profile.cpuSeconds);
+        std::fprintf(fp, "     \"stages\": [");
+        const auto& stages = e.profile.stages;
+        for (size_t k = 0; k < stages.size(); ++k) {
+            if (k > 0) std::fprintf(fp, ", ");
+            std::fprintf(fp, "{\"name\": \"%s\", \"iceFeedback\": %s, \"seconds\": %.4f, "
+                             "\"cpuSeconds\": %.4f, \"poolIdleSeconds\": %.4f}",
+                         stages[k].stageName ? stages[k].stageName : "?",
+                         stages[k].iceFeedback ? "true" : "false",
+                         stages[k].wallSeconds, stages[k].cpuSeconds,
+                         stages[k].pool.idleSeconds);
+        }
+        std::fprintf(fp, "],\n");
+        std::fprintf(fp, "     \"stats\": {\"tileCount\": %u, \"oceanFraction\": %.6f, "
+                         "\"plateRatio\": %.3f, \"beltCount\": %zu, "
+                         "\"tileWeightedMedianAspectRatio\": %.3f, \"continentCount\": %zu, "
+                         "\"medianIsoperimetric\": %.3f, \"riverTileFraction\": %.6f, "
+                         "\"lakeTileFraction\": %.6f, \"glacierLandFraction\": %.6f, "
+                         "\"seaIceFractionOfOcean\": %.6f, \"hypsometricIntegral\": %.4f, "
+                         "\"meanLocalReliefM\": %.1f, \"meanTemperatureC\": %.2f, "
+                         "\"habitability\": %.4f}}%s\n",
+                     st.tileCount, static_cast<double>(st.oceanFraction),
+                     static_cast<double>(st.plates.largestToSmallestRatio), st.belts.size(),
+                     static_cast<double>(st.tileWeightedMedianAspectRatio), st.continents.size(),
+                     static_cast<double>(st.medianIsoperimetric),
+                     static_cast<double>(st.riverTileFraction),
+                     static_cast<double>(st.lakeTileFraction),
+                     static_cast<double>(st.glacierLandFraction),
+                     static_cast<double>(st.seaIceFractionOfOcean),
+                     static_cast<double>(st.hypsometricIntegral),
+                     static_cast<double>(st.meanLocalReliefM),
+                     static_cast<double>(e.summary.meanTemperatureC),
+                     static_cast<double>(e.summary.habitability),
+                     i + 1 < entries.size() ? "," : "");
+    }
+    std::fprintf(fp, "  ]\n");
+    std::fprintf(fp, "}\n");
+    std::fclose(fp);
+}
+
+// CSV: one row per planet. Stage columns are the pass-1 stage names (taken from
+// the first successful planet); the optional ice-feedback tail is summed into
+// a single feedbackSeconds column so every row has the same shape.
+static void writeBatchCsv(const std::string& path, const std::vector<BatchEntry>& entries) {
+    std::FILE* fp = std::fopen(path.c_str(), "w");
+    if (!fp) {
+        std::fprintf(stderr, "Cannot write %s\n", path.c_str());
+        return;
+    }
+    std::vector<const char*> stageNames;
+    for (const BatchEntry& e : entries) {
+        if (!e.ok) continue;
+        for (const auto& st : e.profile.stages) {
+            if (!st.iceFeedback) stageNames.push_back(st.stageName);
+        }
+        break;
+    }
+
+    std::fprintf(fp, "seed,n,plates,water,age,ok,worldHash,wallSeconds,cpuSeconds,"
+                     "poolIdleSeconds,processPeakRssMB,worldDataMB");
+    for (const char* name : stageNames) std::fprintf(fp, ",%sSeconds", name);
+    std::fprintf(fp, ",feedbackSeconds,tileCount,oceanFraction,plateRatio,beltCount,"
+                     "tileWeightedMedianAspectRatio,continentCount,medianIsoperimetric,"
+                     "riverTileFraction,lakeTileFraction,glacierLandFraction,"
+                     "seaIceFractionOfOcean,hypsometricIntegral,meanLocalReliefM,"
+                     "meanTemperatureC,habitability\n");
+
+    const double mb = 1024.0 * 1024.0;
+    for (const BatchEntry& e : entries) {
+        const worldgen::WorldStats& st = e.stats;
+        double poolIdle = 0.0;
+        for (const auto& t : e.profile.stages) poolIdle += t.pool.idleSeconds;
+        std::fprintf(fp, "%llu,%u,%d,%.3f,%.4g,%d,0x%016llx,%.3f,%.3f,%.3f,%.1f,%.1f",
+                     static_cast<unsigned long long>(e.params.seed),
+                     e.params.gridSubdivision, e.params.tectonicPlateCount,
+                     e.params.waterAmount, e.params.planetAge, e.ok ? 1 : 0,
+                     static_cast<unsigned long long>(e.worldHash), e.wallSeconds,
+                     e.profile.cpuSeconds, poolIdle,
+                     static_cast<double>(e.processPeakRssBytes) / mb,
+                     static_cast<double>(e.worldDataBytes) / mb);
+        std::vector<double> pass1;
+        double feedback = 0.0;
+        for (const auto& t : e.profile.stages) {
+            if (t.iceFeedback) {
+                feedback += t.wallSeconds;
+            } else {
+                pass1.push_back(t.wallSeconds);
+            }
+        }
+        for (size_t k = 0; k < stageNames.size(); ++k) {
+            std::fprintf(fp, ",%.4f", k < pass1.size() ? pass1[k] : 0.0);
+        }
+        std::fprintf(fp, ",%.4f,%u,%.6f,%.3f,%zu,%.3f,%zu,%.3f,%.6f,%.6f,%.6f,%.6f,%.4f,%.1f,%.2f,%.4f\n",
+                     feedback, st.tileCount, static_cast<double>(st.oceanFraction),
+                     static_cast<double>(st.plates.largestToSmallestRatio), st.belts.size(),
+                     static_cast<double>(st.tileWeightedMedianAspectRatio), st.continents.size(),
+                     static_cast<double>(st.medianIsoperimetric),
+                     static_cast<double>(st.riverTileFraction),
+                     static_cast<double>(st.lakeTileFraction),
+                     static_cast<double>(st.glacierLandFraction),
+                     static_cast<double>(st.seaIceFractionOfOcean),
+                     static_cast<double>(st.hypsometricIntegral),
+                     static_cast<double>(st.meanLocalReliefM),
+                     static_cast<double>(e.summary.meanTemperatureC),
+                     static_cast<double>(e.summary.habitability));
+    }
+    std::fclose(fp);
+}
+
+static int runBatch(const CliArgs& args) {
+    const std::vector<worldgen::PlanetParams> planets = expandBatch(args);
+    for (const auto& p : planets) {
+        if (auto err = p.validate()) {
+            std::fprintf(stderr, "Invalid batch entry (seed %llu, n %u): %s\n",
+                         static_cast<unsigned long long>(p.seed), p.gridSubdivision,
+                         err->c_str());
+            return 3;
+        }
+    }
+
+    // Thread budget: --threads (0 = hardware) split across `jobs` concurrent
+    // planets. Each planet runs on its generator's worker thread, which also
+    // joins its own TaskPool's parallelFor, so a planet's share s is served by
+    // one worker plus s-1 pool threads (a pool needs at least one). The auto
+    // job count keeps ~4 threads per planet: the serial tectonic-history sim
+    // dominates small n, so planet-level parallelism scales better than wide
+    // intra-planet pools.
+    const unsigned hw     = std::max(1u, std::thread::hardware_concurrency());
+    const unsigned budget = args.threads > 0 ? static_cast<unsigned>(args.threads) : hw;
+    unsigned jobs = args.jobs > 0 ? static_cast<unsigned>(args.jobs) : std::max(1u, budget / 4);
+    jobs = std::min<unsigned>(jobs, static_cast<unsigned>(planets.size()));
+    const unsigned share       = std::max(1u, budget / jobs);
+    const unsigned poolThreads = share > 1 ? share - 1 : 1;
+
+    std::printf("worldgen-cli batch  planets=%zu  jobs=%u  pool threads/planet=%u  budget=%u\n",
+                planets.size(), jobs, poolThreads, budget);
+    std::fflush(stdout);
+
+    // One SphereGrid per distinct n, shared read-only by every planet at that n.
+    std::map<uint32_t, std::shared_ptr<const worldgen::SphereGrid>> grids;
+    for (const auto& p : planets) {
+        if (!grids.count(p.gridSubdivision)) {
+            grids[p.gridSubdivision] = std::make_shared<worldgen::SphereGrid>(p.gridSubdivision);
+        }
+    }
+
+    std::vector<BatchEntry> entries(planets.size());
+    std::atomic<size_t> nextPlanet{0};
+    std::atomic<size_t> doneCount{0};
+    std::mutex printMutex;
+
+    auto t0 = Clock::now();
+    auto jobLoop = [&]() {
+        // One generator (and TaskPool) per job, reused across its planets.
+        worldgen::PlanetGenerator gen(poolThreads);
+        size_t idx{};
+        while ((idx = nextPlanet.fetch_add(1)) < planets.size()) {
+            BatchEntry& e = entries[idx];
+            e.params = planets[idx];
+
+            auto ts = Clock::now();
+            gen.start(e.params, grids.at(e.params.gridSubdivision));
+            using State = worldgen::GenerationProgress::State;
+            while (gen.progress().state == State::Running) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            auto world    = gen.takeResult();
+            e.wallSeconds = std::chrono::duration<double>(Clock::now() - ts).count();
+            e.profile     = gen.profile();
+            if (world) {
+                e.ok             = true;
+                e.worldHash      = world->worldHash;
+                e.worldDataBytes = worldDataBytes(world->data);
+                e.summary        = world->summary;
+                e.stats          = worldgen::computeWorldStats(*world);
+            }
+            // sampleMemory(), not sample(): the latter's CPU bookkeeping is
+            // shared state and the jobs sample concurrently.
+            e.processPeakRssBytes = Foundation::SystemResources::sampleMemory().memoryPeakBytes;
+
+            std::lock_guard<std::mutex> lock(printMutex);
+            std::printf("  [%zu/%zu] seed=%llu n=%u plates=%d water=%.2f  %s  %.2f s  0x%016llx\n",
+                        doneCount.fetch_add(1) + 1, planets.size(),
+                        static_cast<unsigned long long>(e.params.seed),
+                        e.params.gridSubdivision, e.params.tectonicPlateCount,
+                        e.params.waterAmount, e.ok ? "ok" : "FAILED", e.wallSeconds,
+                        static_cast<unsigned long long>(e.worldHash));
+            std::fflush(stdout);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(jobs);
+    for (unsigned j = 0; j < jobs; ++j) workers.emplace_back(jobLoop);
+    for (auto& w : workers) w.join();
+    const double totalSeconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    const uint64_t peakRss = Foundation::SystemResources::sampleMemory().memoryPeakBytes;
+
+    writeBatchJson(args.outDir + "/batch.json", entries, static_cast<int>(jobs), poolThreads,
+                   totalSeconds, peakRss);
+    writeBatchCsv(args.outDir + "/batch.csv", entries);
+    std::printf("  wrote batch.json, batch.csv\n");
+
+    const size_t failed = static_cast<size_t>(std::count_if(
+        entries.begin(), entries.end(), [](const BatchEntry& e) { return !e.ok; }));
+    std::printf("\nBatch complete: %zu planets in %.2f s (%.2f planets/min), "
+                "%zu failed, peak RSS %.1f MB\n",
+                entries.size(), totalSeconds,
+                totalSeconds > 0.0 ? 60.0 * static_cast<double>(entries.size()) / totalSeconds : 0.0,
+                failed, static_cast<double>(peakRss) / (1024.0 * 1024.0));
+    return failed == 0 ? 0 : 1;
+}
+
 int main(int argc, char** argv) {
     CliArgs args;
     if (!parseArgs(argc, argv, args)) {
@@ -893,6 +1363,10 @@ int main(int argc, char** argv) {
         return runSimOnly(args);
     }
 
+    if (args.batch) {
+        return runBatch(args);
+    }
+
     worldgen::PlanetParams params = worldgen::PlanetParams::preset(worldgen::Preset::EarthLike);
     params.gridSubdivision    = args.n;
     params.seed               = args.seed;
@@ -945,7 +1419,8 @@ int main(int argc, char** argv) {
     // Write JSON.
     std::string jsonPath = args.outDir + "/stats.json";
     writeStatsJson(jsonPath, stats, res.wallSeconds, res.stageSeconds);
-    std::printf("  wrote stats.json\n");
+    writeProfileJson(args.outDir + "/profile.json", *res.world, res.profile);
+    std::printf("  wrote stats.json, profile.json\n");
 
     // Print human summary.
     printSummary(stats, res.wallSeconds, res.world->worldHash);
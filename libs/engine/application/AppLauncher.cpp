@@ -236,6 +236,14 @@ namespace engine {
 				LOG_INFO(Engine, "Set shared scripts path: %s", sharedPath.c_str());
 			}
 
+			// Baked pack (asset-cli bake): precomputed templates and collision, used
+			// for every def whose sources still match. Optional; absent = live generation.
+			const std::string packPath =
+				Foundation::findResourceString(std::string("assets/") + engine::assets::kBakedPackRelativePath);
+			if (!packPath.empty()) {
+				engine::assets::AssetRegistry::Get().attachBakedPack(packPath);
+			}
+
 			// Load all asset definitions from the root folder.
 			// Item properties are now part of unified entity definitions (itemProperties section).
 			if (async) {
@@ -465,6 +473,7 @@ namespace engine {
 			if (g_metrics) {
 				auto renderStats = Renderer::Primitives::getStats();
 				g_metrics->setRenderStats(renderStats.drawCalls, renderStats.vertexCount, renderStats.triangleCount);
+				g_metrics->setUploadStats(renderStats.uploadBytes, renderStats.uploadStalls);
 
 				// Get main loop timing breakdown from Application
 				if (g_app) {
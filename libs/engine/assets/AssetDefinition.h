@@ -360,6 +360,7 @@ namespace engine::assets {
 		std::string			  svgPath;			  // For Simple assets: path to SVG file
 		std::string			  motionPath;		  // Optional motion (animation clips) file; @shared/ or relative to baseFolder
 		std::filesystem::path baseFolder;		  // Folder containing this asset's definition (for relative path resolution)
+		std::filesystem::path sourceXmlPath;	  // XML file this definition was parsed from (baked-pack source hash)
 		float				  worldHeight = 1.0F; // World height in meters (for SVG normalization)
 		// Half-range of random placement rotation, in radians. 0 = upright (default): placed
 		// assets are upright billboards (trees, grass, bushes) and look wrong tilted. Opt-in (>0)
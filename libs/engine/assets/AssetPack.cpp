@@ -0,0 +1,477 @@
+#include "assets/AssetPack.h"
+
+#include <utils/Log.h>
+#include <utils/WorldHash.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::endian::native == std::endian::little, "Asset pack format is little-endian; big-endian targets are unsupported");
+static_assert(std::numeric_limits<float>::is_iec559 && sizeof(float) == 4, "Asset pack format requires IEEE-754 binary32 float");
+// Vertex and color arrays are stored as raw float runs.
+static_assert(sizeof(Foundation::Vec2) == 2 * sizeof(float) && std::is_trivially_copyable_v<Foundation::Vec2>);
+static_assert(sizeof(Foundation::Color) == 4 * sizeof(float) && std::is_trivially_copyable_v<Foundation::Color>);
+
+namespace engine::assets {
+
+	namespace {
+
+		constexpr char	   kMagic[4] = {'W', 'S', 'A', 'P'};
+		constexpr size_t   kHeaderSize = sizeof(kMagic) + 2 * sizeof(uint32_t);
+		constexpr uint32_t kMaxNameLength = 4096;
+
+		// AssetPack::m_recordState values
+		constexpr uint8_t kUnchecked = 0;
+		constexpr uint8_t kIntact = 1;
+		constexpr uint8_t kCorrupt = 2;
+
+		// Appends little-endian fields to a byte buffer.
+		struct Writer {
+			std::vector<uint8_t>& out;
+
+			template <typename T>
+			void scalar(T v) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				bytes(&v, sizeof(T));
+			}
+
+			void bytes(const void* data, size_t len) {
+				const auto* p = static_cast<const uint8_t*>(data);
+				out.insert(out.end(), p, p + len); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+
+			void string(const std::string& s) {
+				scalar(static_cast<uint32_t>(s.size()));
+				bytes(s.data(), s.size());
+			}
+
+			template <typename T>
+			void span(const std::vector<T>& v) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				bytes(v.data(), v.size() * sizeof(T));
+			}
+		};
+
+		// Bounds-checked reads from a mapped byte range. Any overrun latches
+		// ok = false and further reads return zeros, so callers check once at the end.
+		struct Cursor {
+			const uint8_t* pos;
+			const uint8_t* end;
+			bool		   ok = true;
+
+			bool take(void* dst, size_t len) {
+				if (!ok || static_cast<size_t>(end - pos) < len) {
+					ok = false;
+					return false;
+				}
+				std::memcpy(dst, pos, len);
+				pos += len; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				return true;
+			}
+
+			template <typename T>
+			T scalar() {
+				static_assert(std::is_trivially_copyable_v<T>);
+				T v{};
+				take(&v, sizeof(T));
+				return v;
+			}
+
+			std::string string() {
+				const auto len = scalar<uint32_t>();
+				if (!ok || len > kMaxNameLength || static_cast<size_t>(end - pos) < len) {
+					ok = false;
+					return {};
+				}
+				std::string s(reinterpret_cast<const char*>(pos), len);
+				pos += len; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				return s;
+			}
+
+			template <typename T>
+			void span(std::vector<T>& v, uint32_t count) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				if (!ok || static_cast<size_t>(end - pos) / sizeof(T) < count) {
+					ok = false;
+					return;
+				}
+				v.resize(count);
+				take(v.data(), count * sizeof(T));
+			}
+		};
+
+		// hasMesh flag, then (if set) the mesh arrays.
+		void writeMesh(Writer& w, bool hasMesh, const renderer::TessellatedMesh& m) {
+			w.scalar(static_cast<uint8_t>(hasMesh ? 1 : 0));
+			if (!hasMesh) {
+				return;
+			}
+			w.scalar(static_cast<uint32_t>(m.vertices.size()));
+			w.scalar(static_cast<uint32_t>(m.indices.size()));
+			w.scalar(static_cast<uint32_t>(m.colors.size()));
+			w.scalar(static_cast<uint32_t>(m.parts.size()));
+			w.span(m.vertices);
+			w.span(m.indices);
+			w.span(m.colors);
+			for (const auto& part : m.parts) {
+				w.string(part.name);
+				w.scalar(part.vertexStart);
+				w.scalar(part.vertexCount);
+			}
+		}
+
+		void writeRecord(Writer& w, const BakedAsset& asset) {
+			const CollisionShape& c = asset.collision;
+			w.scalar(static_cast<uint8_t>(c.type));
+			w.scalar(c.offsetMeters.x);
+			w.scalar(c.offsetMeters.y);
+			w.scalar(c.halfExtentsMeters.x);
+			w.scalar(c.halfExtentsMeters.y);
+			w.scalar(static_cast<uint32_t>(c.pointsMeters.size()));
+			for (const auto& p : c.pointsMeters) {
+				w.scalar(p.x);
+				w.scalar(p.y);
+			}
+			writeMesh(w, asset.hasMesh, asset.mesh);
+			for (const auto& variant : asset.variants) {
+				writeMesh(w, !variant.vertices.empty(), variant);
+			}
+		}
+
+		// Decode one mesh; with out == nullptr, skip over it. Returns its hasMesh flag.
+		bool readMeshFields(Cursor& in, renderer::TessellatedMesh* out) {
+			if (in.scalar<uint8_t>() == 0 || !in.ok) {
+				return false;
+			}
+			const auto vertexCount = in.scalar<uint32_t>();
+			const auto indexCount = in.scalar<uint32_t>();
+			const auto colorCount = in.scalar<uint32_t>();
+			const auto partCount = in.scalar<uint32_t>();
+			renderer::TessellatedMesh scratch;
+			renderer::TessellatedMesh& m = out != nullptr ? *out : scratch;
+			m.clear();
+			in.span(m.vertices, vertexCount);
+			in.span(m.indices, indexCount);
+			in.span(m.colors, colorCount);
+			if (in.ok && static_cast<size_t>(in.end - in.pos) / (3 * sizeof(uint32_t)) < partCount) {
+				in.ok = false;
+			}
+			for (uint32_t i = 0; i < partCount && in.ok; ++i) {
+				renderer::MeshPart part;
+				part.name = in.string();
+				part.vertexStart = in.scalar<uint32_t>();
+				part.vertexCount = in.scalar<uint32_t>();
+				m.parts.push_back(std::move(part));
+			}
+			return in.ok;
+		}
+
+		// Collision fields sit at the front of every record.
+		void readCollisionFields(Cursor& in, CollisionShape& out) {
+			const auto type = in.scalar<uint8_t>();
+			out.type = type <= static_cast<uint8_t>(CollisionShapeType::Polygon) ? static_cast<CollisionShapeType>(type)
+																				 : CollisionShapeType::None;
+			out.offsetMeters.x = in.scalar<float>();
+			out.offsetMeters.y = in.scalar<float>();
+			out.halfExtentsMeters.x = in.scalar<float>();
+			out.halfExtentsMeters.y = in.scalar<float>();
+			const auto pointCount = in.scalar<uint32_t>();
+			out.pointsMeters.clear();
+			if (!in.ok || static_cast<size_t>(in.end - in.pos) / (2 * sizeof(float)) < pointCount) {
+				in.ok = false;
+				return;
+			}
+			out.pointsMeters.reserve(pointCount);
+			for (uint32_t i = 0; i < pointCount; ++i) {
+				const float x = in.scalar<float>();
+				const float y = in.scalar<float>();
+				out.pointsMeters.emplace_back(x, y);
+			}
+		}
+
+	} // namespace
+
+	bool writeAssetPack(const std::vector<BakedAsset>& assets, const std::filesystem::path& path) {
+		// Serialize records first: the index needs their sizes and hashes.
+		std::vector<std::vector<uint8_t>> records(assets.size());
+		for (size_t i = 0; i < assets.size(); ++i) {
+			Writer rw{records[i]};
+			writeRecord(rw, assets[i]);
+		}
+
+		size_t indexSize = 0;
+		for (const auto& asset : assets) {
+			indexSize += sizeof(uint32_t) + asset.defName.size() + 4 * sizeof(uint64_t) + sizeof(uint32_t);
+		}
+
+		std::vector<uint8_t> file;
+		Writer				 w{file};
+		w.bytes(kMagic, sizeof(kMagic));
+		w.scalar(kAssetPackVersion);
+		w.scalar(static_cast<uint32_t>(assets.size()));
+		uint64_t offset = kHeaderSize + indexSize;
+		for (size_t i = 0; i < assets.size(); ++i) {
+			w.string(assets[i].defName);
+			w.scalar(assets[i].sourceHash);
+			w.scalar(offset);
+			w.scalar(static_cast<uint64_t>(records[i].size()));
+			w.scalar(foundation::hashBytes(records[i].data(), records[i].size()));
+			w.scalar(static_cast<uint32_t>(assets[i].variants.size()));
+			offset += records[i].size();
+		}
+		for (const auto& record : records) {
+			w.bytes(record.data(), record.size());
+		}
+
+		std::error_code ec;
+		if (path.has_parent_path()) {
+			std::filesystem::create_directories(path.parent_path(), ec);
+			if (ec) {
+				LOG_ERROR(Engine, "writeAssetPack: cannot create directory %s: %s", path.parent_path().string().c_str(), ec.message().c_str());
+				return false;
+			}
+		}
+
+		// Temp file + rename, so a running game never maps a half-written pack.
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+		{
+			std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+			if (!out) {
+				LOG_ERROR(Engine, "writeAssetPack: cannot open %s for writing", tempPath.string().c_str());
+				return false;
+			}
+			out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+			if (!out) {
+				LOG_ERROR(Engine, "writeAssetPack: write failed for %s", tempPath.string().c_str());
+				return false;
+			}
+		}
+		std::filesystem::rename(tempPath, path, ec);
+		if (ec) {
+			LOG_ERROR(Engine, "writeAssetPack: cannot rename %s -> %s: %s", tempPath.string().c_str(), path.string().c_str(), ec.message().c_str());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
+	uint64_t hashFileContents(const std::filesystem::path& path, uint64_t seed) {
+		std::ifstream in(path, std::ios::binary);
+		if (!in) {
+			constexpr char kMissing[] = "<missing>";
+			return foundation::hashBytes(kMissing, sizeof(kMissing), seed);
+		}
+		uint64_t h = seed;
+		char	 buf[16384];
+		while (in.read(buf, sizeof(buf)) || in.gcount() > 0) {
+			h = foundation::hashBytes(buf, static_cast<size_t>(in.gcount()), h);
+		}
+		return h;
+	}
+
+	uint64_t hashDirectoryContents(const std::filesystem::path& dir, uint64_t seed) {
+		namespace fs = std::filesystem;
+		std::vector<fs::path> files;
+		std::error_code		  ec;
+		for (fs::recursive_directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+			if (it->is_regular_file(ec)) {
+				files.push_back(it->path().lexically_relative(dir));
+			}
+		}
+		std::sort(files.begin(), files.end());
+
+		uint64_t h = seed;
+		for (const auto& rel : files) {
+			const std::string name = rel.generic_string();
+			h = foundation::hashBytes(name.data(), name.size(), h);
+			h = hashFileContents(dir / rel, h);
+		}
+		return h;
+	}
+
+	std::unique_ptr<AssetPack> AssetPack::open(const std::filesystem::path& path) {
+		std::unique_ptr<AssetPack> pack(new AssetPack());
+
+#ifdef _WIN32
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			LOG_INFO(Engine, "No baked asset pack at %s", path.string().c_str());
+			return nullptr;
+		}
+		pack->m_fileHandle = file;
+		LARGE_INTEGER size{};
+		if (GetFileSizeEx(file, &size) == 0 || size.QuadPart < static_cast<LONGLONG>(kHeaderSize)) {
+			LOG_WARNING(Engine, "Baked asset pack %s is truncated; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr) {
+			LOG_WARNING(Engine, "Cannot map baked asset pack %s; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		pack->m_mappingHandle = mapping;
+		const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr) {
+			LOG_WARNING(Engine, "Cannot map baked asset pack %s; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		pack->m_data = static_cast<const uint8_t*>(view);
+		pack->m_size = static_cast<size_t>(size.QuadPart);
+#else
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			LOG_INFO(Engine, "No baked asset pack at %s", path.string().c_str());
+			return nullptr;
+		}
+		struct stat st {};
+		if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kHeaderSize)) {
+			::close(fd);
+			LOG_WARNING(Engine, "Baked asset pack %s is truncated; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd); // the mapping keeps the file referenced
+		if (view == MAP_FAILED) {
+			LOG_WARNING(Engine, "Cannot map baked asset pack %s; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		pack->m_data = static_cast<const uint8_t*>(view);
+		pack->m_size = static_cast<size_t>(st.st_size);
+#endif
+
+		Cursor in{pack->m_data, pack->m_data + pack->m_size}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		char   magic[4] = {};
+		in.take(magic, sizeof(magic));
+		const auto version = in.scalar<uint32_t>();
+		const auto entryCount = in.scalar<uint32_t>();
+		if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+			LOG_WARNING(Engine, "Baked asset pack %s has bad magic; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		if (version != kAssetPackVersion) {
+			LOG_WARNING(
+				Engine, "Baked asset pack %s is version %u (expected %u); ignoring, rebake with asset-cli bake", path.string().c_str(),
+				version, kAssetPackVersion
+			);
+			return nullptr;
+		}
+
+		pack->m_index.reserve(entryCount);
+		for (uint32_t i = 0; i < entryCount && in.ok; ++i) {
+			std::string name = in.string();
+			Entry		entry;
+			entry.sourceHash = in.scalar<uint64_t>();
+			entry.recordOffset = in.scalar<uint64_t>();
+			entry.recordSize = in.scalar<uint64_t>();
+			entry.recordHash = in.scalar<uint64_t>();
+			entry.variantCount = in.scalar<uint32_t>();
+			entry.slot = i;
+			if (entry.recordOffset > pack->m_size || entry.recordSize > pack->m_size - entry.recordOffset) {
+				in.ok = false;
+				break;
+			}
+			pack->m_index.emplace(std::move(name), entry);
+		}
+		if (!in.ok) {
+			LOG_WARNING(Engine, "Baked asset pack %s has a malformed index; ignoring", path.string().c_str());
+			return nullptr;
+		}
+		pack->m_recordState = std::make_unique<std::atomic<uint8_t>[]>(entryCount);
+
+		LOG_INFO(Engine, "Mapped baked asset pack %s: %zu entries, %zu bytes", path.string().c_str(), pack->m_index.size(), pack->m_size);
+		return pack;
+	}
+
+	AssetPack::~AssetPack() {
+#ifdef _WIN32
+		if (m_data != nullptr) {
+			UnmapViewOfFile(m_data);
+		}
+		if (m_mappingHandle != nullptr) {
+			CloseHandle(m_mappingHandle);
+		}
+		if (m_fileHandle != nullptr) {
+			CloseHandle(m_fileHandle);
+		}
+#else
+		if (m_data != nullptr) {
+			::munmap(const_cast<uint8_t*>(m_data), m_size);
+		}
+#endif
+	}
+
+	const AssetPack::Entry* AssetPack::find(const std::string& defName) const {
+		auto it = m_index.find(defName);
+		return it != m_index.end() ? &it->second : nullptr;
+	}
+
+	bool AssetPack::verifyRecord(const Entry& entry) const {
+		std::atomic<uint8_t>& state = m_recordState[entry.slot];
+		uint8_t				  known = state.load(std::memory_order_acquire);
+		if (known == kUnchecked) {
+			// Two threads may both hash a fresh record; they store the same verdict
+			const uint8_t* record = m_data + entry.recordOffset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			known = foundation::hashBytes(record, entry.recordSize) == entry.recordHash ? kIntact : kCorrupt;
+			state.store(known, std::memory_order_release);
+		}
+		return known == kIntact;
+	}
+
+	bool AssetPack::readCollision(const Entry& entry, CollisionShape& out) const {
+		if (!verifyRecord(entry)) {
+			return false;
+		}
+		const uint8_t* record = m_data + entry.recordOffset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		Cursor in{record, record + entry.recordSize}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		readCollisionFields(in, out);
+		return in.ok;
+	}
+
+	bool AssetPack::readMesh(const Entry& entry, renderer::TessellatedMesh& out) const {
+		return readRecordMesh(entry, 0, out);
+	}
+
+	bool AssetPack::readVariant(const Entry& entry, uint32_t seed, renderer::TessellatedMesh& out) const {
+		return seed < entry.variantCount && readRecordMesh(entry, 1 + seed, out);
+	}
+
+	bool AssetPack::readRecordMesh(const Entry& entry, uint32_t meshIndex, renderer::TessellatedMesh& out) const {
+		if (!verifyRecord(entry)) {
+			return false;
+		}
+		const uint8_t* record = m_data + entry.recordOffset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		Cursor		   in{record, record + entry.recordSize}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		CollisionShape skipped;
+		readCollisionFields(in, skipped);
+		for (uint32_t i = 0; i < meshIndex && in.ok; ++i) {
+			readMeshFields(in, nullptr);
+		}
+		if (!in.ok || !readMeshFields(in, &out)) {
+			out.clear();
+			return false;
+		}
+		return true;
+	}
+
+} // namespace engine::assets
@@ -0,0 +1,147 @@
+#pragma once
+
+// Baked asset pack ("WSAP"): the expensive, deterministic outputs of asset
+// loading, precomputed offline by `asset-cli bake` so the game does not pay for
+// SVG parsing, curve flattening, tessellation and Lua generation at startup or
+// on first sight of an asset.
+//
+// Per definition the pack stores the final collision shape (after the XML /
+// SVG-metadata / Lua-emitted precedence the loader applies), the template
+// mesh getTemplate would build, and for groundcover the per-seed variant
+// meshes buildMesh produces for GroundcoverRenderer (seeds
+// 0..variantCount-1). Definitions themselves are still parsed from XML: they
+// are cheap, and the XML is needed anyway to decide whether a baked entry is
+// still current.
+//
+// Staleness: each entry carries the source hash it was baked from
+// (AssetRegistry::computeSourceHash: the def's XML file, its SVG or Lua
+// script, and the shared scripts folder for Lua assets). AssetRegistry serves
+// an entry only when that hash matches the files on disk; anything else falls
+// back to live generation. Changes to generator/tessellator CODE are not
+// visible to the hash: bump kAssetPackVersion when they change baked output.
+//
+// Layout (little-endian, sequential):
+//   magic         char[4]  "WSAP"
+//   version       uint32   = kAssetPackVersion
+//   entryCount    uint32
+//   --- index, entryCount times ---
+//   nameLength    uint32, name bytes
+//   sourceHash    uint64
+//   recordOffset  uint64   from the start of the file
+//   recordSize    uint64
+//   recordHash    uint64   FNV-1a over the record's bytes
+//   variantCount  uint32
+//   --- records ---
+//   collision     type uint8, offset f32x2, halfExtents f32x2,
+//                 pointCount uint32, points f32x2 x pointCount
+//   template      mesh (below)
+//   variants      mesh x variantCount (seed order)
+//   mesh:         hasMesh uint8; if set: vertexCount, indexCount, colorCount,
+//                 partCount (uint32 each), vertices f32x2, indices uint16,
+//                 colors f32x4, per part: nameLength uint32, name bytes,
+//                 vertexStart uint32, vertexCount uint32
+//
+// The file is memory-mapped; opening it reads only the header and index. A
+// record's bytes are touched only when the loader or getTemplate first asks
+// for them, and checked against its recordHash once: later reads of the same
+// record (each variant seed) reuse the verdict.
+
+#include "assets/AssetDefinition.h"
+
+#include <vector/Types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::assets {
+
+	inline constexpr uint32_t kAssetPackVersion = 1;
+
+	/// Where `asset-cli bake` writes the pack by default and the game looks for
+	/// it, relative to the assets/ root.
+	inline constexpr const char* kBakedPackRelativePath = "baked/assets.pack";
+
+	/// One definition's baked outputs, as written by writeAssetPack.
+	struct BakedAsset {
+		std::string				  defName;
+		uint64_t				  sourceHash = 0;
+		CollisionShape			  collision;
+		bool					  hasMesh = false; // false: generation failed at bake time
+		renderer::TessellatedMesh mesh;
+		// buildMesh(defName, seed) for seed = index; an empty mesh is a failed seed.
+		std::vector<renderer::TessellatedMesh> variants;
+	};
+
+	/// Write a pack (temp file + rename, like savePlanet). Returns false (with
+	/// LOG_ERROR) on I/O failure.
+	bool writeAssetPack(const std::vector<BakedAsset>& assets, const std::filesystem::path& path);
+
+	/// FNV-1a over a file's bytes, chained from seed. A missing file hashes as
+	/// its absence, so deleting a source also invalidates.
+	[[nodiscard]] uint64_t hashFileContents(const std::filesystem::path& path, uint64_t seed);
+
+	/// hashFileContents over every regular file under dir, in sorted relative-path
+	/// order (names are hashed too, so a rename invalidates).
+	[[nodiscard]] uint64_t hashDirectoryContents(const std::filesystem::path& dir, uint64_t seed);
+
+	/// Read-only view of a memory-mapped pack.
+	class AssetPack {
+	  public:
+		struct Entry {
+			uint64_t sourceHash = 0;
+			uint64_t recordOffset = 0;
+			uint64_t recordSize = 0;
+			uint64_t recordHash = 0;
+			uint32_t variantCount = 0;
+			uint32_t slot = 0; // index into the pack's per-record verification state
+		};
+
+		/// Map and index a pack. Returns nullptr (with a log line) when the file
+		/// is missing, has the wrong magic/version, or a malformed index.
+		static std::unique_ptr<AssetPack> open(const std::filesystem::path& path);
+
+		~AssetPack();
+		AssetPack(const AssetPack&) = delete;
+		AssetPack& operator=(const AssetPack&) = delete;
+
+		[[nodiscard]] size_t size() const { return m_index.size(); }
+
+		/// nullptr if the pack has no entry for defName.
+		[[nodiscard]] const Entry* find(const std::string& defName) const;
+
+		/// Decode an entry's collision / template mesh / variant mesh. False on a
+		/// corrupt or malformed record, or when that mesh was not baked (failed
+		/// generation, or seed >= variantCount).
+		bool readCollision(const Entry& entry, CollisionShape& out) const;
+		bool readMesh(const Entry& entry, renderer::TessellatedMesh& out) const;
+		bool readVariant(const Entry& entry, uint32_t seed, renderer::TessellatedMesh& out) const;
+
+	  private:
+		AssetPack() = default;
+
+		/// Decode mesh `meshIndex` of a record (0 = template, 1 + seed = variant).
+		bool readRecordMesh(const Entry& entry, uint32_t meshIndex, renderer::TessellatedMesh& out) const;
+
+		/// Hash a record against its recordHash on first use; later calls return
+		/// the cached verdict. Safe to call from the loader's worker threads.
+		bool verifyRecord(const Entry& entry) const;
+
+		const uint8_t* m_data = nullptr;
+		size_t		   m_size = 0;
+#ifdef _WIN32
+		void* m_fileHandle = nullptr;
+		void* m_mappingHandle = nullptr;
+#endif
+		std::unordered_map<std::string, Entry> m_index;
+
+		// Per entry slot: kUnchecked, kIntact or kCorrupt
+		mutable std::unique_ptr<std::atomic<uint8_t>[]> m_recordState;
+	};
+
+} // namespace engine::assets
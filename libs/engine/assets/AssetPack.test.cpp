@@ -0,0 +1,206 @@
+// Tests for the baked asset pack: format round trip, corruption handling, and
+// AssetRegistry serving current entries / falling back on stale sources.
+
+#include "assets/AssetPack.h"
+#include "assets/AssetRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace engine::assets;
+
+namespace {
+
+	namespace fs = std::filesystem;
+
+	struct TempDir {
+		fs::path root;
+
+		TempDir() {
+			static std::atomic<int> counter{0};
+			const std::string		token =
+				std::to_string(reinterpret_cast<uintptr_t>(&counter)) + "_" + std::to_string(counter++);
+			root = fs::temp_directory_path() / ("asset_pack_test_" + token);
+			fs::create_directories(root);
+		}
+
+		~TempDir() {
+			std::error_code ec;
+			fs::remove_all(root, ec);
+		}
+
+		TempDir(const TempDir&)			   = delete;
+		TempDir& operator=(const TempDir&) = delete;
+
+		void writeFile(const fs::path& rel, const std::string& body) const {
+			fs::create_directories((root / rel).parent_path());
+			std::ofstream(root / rel) << body;
+		}
+	};
+
+	BakedAsset makeMeshAsset() {
+		BakedAsset a;
+		a.defName = "Tree_Test";
+		a.sourceHash = 0x1234'5678'9ABC'DEF0ULL;
+		a.collision.type = CollisionShapeType::Polygon;
+		a.collision.pointsMeters = {{0.0F, 0.0F}, {1.0F, 0.0F}, {0.5F, 1.0F}};
+		a.hasMesh = true;
+		a.mesh.vertices = {{0.0F, 0.0F}, {1.0F, 0.0F}, {0.5F, 2.0F}, {0.25F, 1.0F}};
+		a.mesh.indices = {0, 1, 2, 0, 2, 3};
+		a.mesh.colors = {{1, 0, 0, 1}, {0, 1, 0, 1}, {0, 0, 1, 1}, {1, 1, 1, 0.5F}};
+		a.mesh.parts = {{"trunk", 0, 2}, {"", 2, 2}};
+		a.variants.resize(2);
+		a.variants[0].vertices = {{0.0F, 0.0F}, {3.0F, 0.0F}, {0.0F, 3.0F}};
+		a.variants[0].indices = {0, 1, 2};
+		// variants[1] stays empty: a seed that failed at bake time
+		return a;
+	}
+
+	std::string simpleDefXml(const std::string& svgFile) {
+		return "<?xml version=\"1.0\"?><AssetDefinitions><AssetDef>"
+			   "<defName>PackAsset</defName>"
+			   "<assetType>simple</assetType>"
+			   "<svgPath>" + svgFile + "</svgPath>"
+			   "<worldHeight>2.0</worldHeight>"
+			   "<collision><rect minX=\"-0.5\" minY=\"0.0\" maxX=\"0.5\" maxY=\"0.4\"/></collision>"
+			   "</AssetDef></AssetDefinitions>";
+	}
+
+	std::string svgRect(int x1, int y1) {
+		return "<?xml version=\"1.0\"?>"
+			   "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 200 200\" width=\"200\" height=\"200\">"
+			   "<path d=\"M0,0 L" + std::to_string(x1) + ",0 L" + std::to_string(x1) + "," + std::to_string(y1) +
+			   " L0," + std::to_string(y1) + " Z\" fill=\"#777777\"/></svg>";
+	}
+
+} // namespace
+
+TEST(AssetPackTest, RoundTripsCollisionAndMesh) {
+	TempDir			 t;
+	const fs::path	 path = t.root / "test.pack";
+	const BakedAsset tree = makeMeshAsset();
+	BakedAsset		 meshless;
+	meshless.defName = "Broken_Test";
+	meshless.sourceHash = 7;
+	ASSERT_TRUE(writeAssetPack({tree, meshless}, path));
+
+	auto pack = AssetPack::open(path);
+	ASSERT_NE(pack, nullptr);
+	EXPECT_EQ(pack->size(), 2u);
+	EXPECT_EQ(pack->find("Nope"), nullptr);
+
+	const AssetPack::Entry* entry = pack->find("Tree_Test");
+	ASSERT_NE(entry, nullptr);
+	EXPECT_EQ(entry->sourceHash, tree.sourceHash);
+
+	CollisionShape collision;
+	ASSERT_TRUE(pack->readCollision(*entry, collision));
+	EXPECT_EQ(collision.type, CollisionShapeType::Polygon);
+	EXPECT_EQ(collision.pointsMeters, tree.collision.pointsMeters);
+
+	renderer::TessellatedMesh mesh;
+	ASSERT_TRUE(pack->readMesh(*entry, mesh));
+	EXPECT_EQ(mesh.vertices, tree.mesh.vertices);
+	EXPECT_EQ(mesh.indices, tree.mesh.indices);
+	ASSERT_EQ(mesh.colors.size(), tree.mesh.colors.size());
+	EXPECT_FLOAT_EQ(mesh.colors[3].a, 0.5F);
+	ASSERT_EQ(mesh.parts.size(), 2u);
+	EXPECT_EQ(mesh.parts[0].name, "trunk");
+	EXPECT_EQ(mesh.parts[1].vertexStart, 2u);
+
+	EXPECT_EQ(entry->variantCount, 2u);
+	ASSERT_TRUE(pack->readVariant(*entry, 0, mesh));
+	EXPECT_EQ(mesh.vertices, tree.variants[0].vertices);
+	EXPECT_FALSE(pack->readVariant(*entry, 1, mesh)) << "failed seed is not served";
+	EXPECT_FALSE(pack->readVariant(*entry, 2, mesh)) << "seed beyond variantCount";
+	ASSERT_TRUE(pack->readMesh(*entry, mesh)) << "template still decodes after variants";
+	EXPECT_EQ(mesh.vertices, tree.mesh.vertices);
+
+	const AssetPack::Entry* broken = pack->find("Broken_Test");
+	ASSERT_NE(broken, nullptr);
+	EXPECT_TRUE(pack->readCollision(*broken, collision));
+	EXPECT_EQ(collision.type, CollisionShapeType::None);
+	EXPECT_FALSE(pack->readMesh(*broken, mesh)) << "baked without a mesh";
+}
+
+TEST(AssetPackTest, RejectsWrongVersionAndCorruptRecords) {
+	TempDir		   t;
+	const fs::path path = t.root / "test.pack";
+	ASSERT_TRUE(writeAssetPack({makeMeshAsset()}, path));
+
+	std::vector<char> bytes(fs::file_size(path));
+	std::ifstream(path, std::ios::binary).read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	auto writeBytes = [&](const std::vector<char>& b) {
+		std::ofstream(path, std::ios::binary | std::ios::trunc).write(b.data(), static_cast<std::streamsize>(b.size()));
+	};
+
+	// Flip the last byte (inside the only record): the index still opens, but
+	// the record fails its hash and is never decoded.
+	std::vector<char> corrupt = bytes;
+	corrupt.back() ^= 0x5A;
+	writeBytes(corrupt);
+	auto pack = AssetPack::open(path);
+	ASSERT_NE(pack, nullptr);
+	renderer::TessellatedMesh mesh;
+	EXPECT_FALSE(pack->readMesh(*pack->find("Tree_Test"), mesh));
+	CollisionShape shape;
+	EXPECT_FALSE(pack->readCollision(*pack->find("Tree_Test"), shape)) << "the cached verdict is reused";
+	pack.reset();
+
+	std::vector<char> wrongVersion = bytes;
+	wrongVersion[4] = static_cast<char>(kAssetPackVersion + 1);
+	writeBytes(wrongVersion);
+	EXPECT_EQ(AssetPack::open(path), nullptr);
+
+	EXPECT_EQ(AssetPack::open(t.root / "missing.pack"), nullptr);
+}
+
+TEST(AssetPackTest, RegistryServesCurrentEntriesAndRegeneratesStaleOnes) {
+	auto&	reg = AssetRegistry::Get();
+	TempDir t;
+	t.writeFile("defs/PackAsset/PackAsset.xml", simpleDefXml("shape.svg"));
+	t.writeFile("defs/PackAsset/shape.svg", svgRect(100, 200));
+	const std::string defsRoot = (t.root / "defs").string();
+	const fs::path	  packPath = t.root / "assets.pack";
+
+	// Bake from live generation.
+	reg.detachBakedPack();
+	reg.clearDefinitions();
+	reg.loadDefinitionsFromFolder(defsRoot);
+	const BakeResult baked = reg.bakePack(packPath);
+	ASSERT_TRUE(baked.ok);
+	EXPECT_EQ(baked.entries, 1u);
+	EXPECT_EQ(baked.meshes, 1u);
+	const renderer::TessellatedMesh* live = reg.getTemplate("PackAsset");
+	ASSERT_NE(live, nullptr);
+	const std::vector<Foundation::Vec2> liveVertices = live->vertices;
+	const CollisionShape				liveCollision = reg.getDefinition("PackAsset")->collision;
+
+	// Reload with the pack attached: served from the pack, identical outputs.
+	ASSERT_TRUE(reg.attachBakedPack(packPath));
+	reg.clearDefinitions();
+	reg.loadDefinitionsFromFolder(defsRoot);
+	EXPECT_EQ(reg.bakedDefinitionCount(), 1u);
+	EXPECT_EQ(reg.getDefinition("PackAsset")->collision.type, liveCollision.type);
+	EXPECT_EQ(reg.getDefinition("PackAsset")->collision.halfExtentsMeters, liveCollision.halfExtentsMeters);
+	const renderer::TessellatedMesh* fromPack = reg.getTemplate("PackAsset");
+	ASSERT_NE(fromPack, nullptr);
+	EXPECT_EQ(fromPack->vertices, liveVertices);
+
+	// Edit the SVG: the entry is stale, so the template is regenerated live.
+	t.writeFile("defs/PackAsset/shape.svg", svgRect(200, 200));
+	reg.clearDefinitions();
+	reg.loadDefinitionsFromFolder(defsRoot);
+	EXPECT_EQ(reg.bakedDefinitionCount(), 0u);
+	const renderer::TessellatedMesh* regenerated = reg.getTemplate("PackAsset");
+	ASSERT_NE(regenerated, nullptr);
+	EXPECT_NE(regenerated->vertices, liveVertices);
+
+	reg.detachBakedPack();
+	reg.clearDefinitions();
+}
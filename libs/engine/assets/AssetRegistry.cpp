@@ -5,12 +5,16 @@
 #include "assets/SvgPathNodes.h"
 #include "assets/lua/LuaGenerator.h"
 
+#include <threading/JobSystem.h>
 #include <utils/Log.h>
+#include <utils/WorldHash.h>
 #include <vector/SVGLoader.h>
 #include <vector/Tessellator.h>
 
 #include <pugixml.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <filesystem>
@@ -573,10 +577,89 @@ namespace engine::assets {
 
 	void AssetRegistry::setSharedScriptsPath(const std::filesystem::path& path) {
 		m_sharedScriptsPath = path;
+		m_sharedScriptsHash.reset();
 		LOG_DEBUG(Engine, "Set shared scripts path: %s", path.string().c_str());
 	}
 
-	bool AssetRegistry::loadDefinitions(const std::string& xmlPath) {
+	bool AssetRegistry::attachBakedPack(const std::filesystem::path& packPath) {
+		m_bakedEntries.clear();
+		m_bakedPack = AssetPack::open(packPath);
+		return m_bakedPack != nullptr;
+	}
+
+	void AssetRegistry::detachBakedPack() {
+		m_bakedEntries.clear();
+		m_bakedPack.reset();
+	}
+
+	uint64_t AssetRegistry::computeSourceHash(const std::string& defName) const {
+		const AssetDefinition* def = getDefinition(defName);
+		if (def == nullptr) {
+			return 0;
+		}
+		// The format version seeds the hash, so a rebake is forced whenever the
+		// pack layout (or, by convention, the generation code) changes.
+		uint64_t h = foundation::hashCombine(foundation::kFnvOffset, kAssetPackVersion);
+		h = foundation::hashBytes(def->defName.data(), def->defName.size(), h);
+		h = hashFileContents(def->sourceXmlPath, h);
+		if (!def->svgPath.empty()) {
+			h = hashFileContents(def->resolvePath(def->svgPath), h);
+		}
+		if (def->isLuaGenerator()) {
+			h = hashFileContents(resolveScriptPath(*def), h);
+			// Scripts may require() anything under the shared folder.
+			h = foundation::hashCombine(h, sharedScriptsHash());
+		}
+		return h;
+	}
+
+	uint64_t AssetRegistry::sharedScriptsHash() const {
+		if (!m_sharedScriptsHash) {
+			m_sharedScriptsHash =
+				m_sharedScriptsPath.empty() ? foundation::kFnvOffset : hashDirectoryContents(m_sharedScriptsPath, foundation::kFnvOffset);
+		}
+		return *m_sharedScriptsHash;
+	}
+
+	BakeResult AssetRegistry::bakePack(const std::filesystem::path& packPath) {
+		auto names = getDefinitionNames();
+		std::sort(names.begin(), names.end()); // stable pack bytes for identical sources
+
+		// Generate everything in parallel first; the serial loop below then only
+		// copies meshes out of the caches.
+		pregenerateTemplates();
+
+		std::vector<BakedAsset> baked;
+		baked.reserve(names.size());
+		BakeResult result;
+		for (const auto& name : names) {
+			const AssetDefinition* def = getDefinition(name);
+			BakedAsset			   asset;
+			asset.defName = name;
+			asset.sourceHash = computeSourceHash(name);
+			asset.collision = def->collision;
+			if (const renderer::TessellatedMesh* mesh = getTemplate(name)) {
+				asset.hasMesh = true;
+				asset.mesh = *mesh;
+				++result.meshes;
+			}
+			// GroundcoverRenderer's per-seed tufts (see ensureGroundcoverVariants).
+			if (def->role == AssetRole::Groundcover && def->assetType == AssetType::Procedural) {
+				asset.variants.resize(std::max<uint32_t>(1, def->variantCount));
+				for (uint32_t seed = 0; seed < asset.variants.size(); ++seed) {
+					if (!buildMesh(name, seed, asset.variants[seed])) {
+						asset.variants[seed].clear();
+					}
+				}
+			}
+			baked.push_back(std::move(asset));
+		}
+		result.entries = baked.size();
+		result.ok = writeAssetPack(baked, packPath);
+		return result;
+	}
+
+	bool AssetRegistry::parseDefinitionFile(const std::string& xmlPath, std::vector<AssetDefinition>& out) {
 		namespace fs = std::filesystem;
 
 		pugi::xml_document	   doc;
@@ -597,8 +680,6 @@ namespace engine::assets {
 			return false;
 		}
 
-		int loadedCount = 0;
-		std::vector<std::string> loadedNames;
 		for (pugi::xml_node defNode : root.children("AssetDef")) {
 			AssetDefinition def;
 
@@ -1010,11 +1091,71 @@ namespace engine::assets {
 
 			// Store base folder for relative path resolution
 			def.baseFolder = baseFolder;
+			def.sourceXmlPath = fs::absolute(xmlPath);
+
+			out.push_back(std::move(def));
+		}
+		return true;
+	}
+
+	bool AssetRegistry::loadDefinitions(const std::string& xmlPath) {
+		std::vector<AssetDefinition> parsed;
+		if (!parseDefinitionFile(xmlPath, parsed)) {
+			return false;
+		}
 
-			// Store definition
+		std::vector<std::string> loadedNames;
+		loadedNames.reserve(parsed.size());
+		for (AssetDefinition& def : parsed) {
 			loadedNames.push_back(def.defName);
 			definitions[def.defName] = std::move(def);
-			loadedCount++;
+		}
+		finishLoadingDefinitions(loadedNames);
+
+		LOG_DEBUG(Engine, "Loaded %zu asset definitions from %s", loadedNames.size(), xmlPath.c_str());
+		return !loadedNames.empty();
+	}
+
+	void AssetRegistry::finishLoadingDefinitions(std::vector<std::string> loadedNames) {
+		// A name overridden by a later file is finished once, against its final def.
+		std::sort(loadedNames.begin(), loadedNames.end());
+		loadedNames.erase(std::unique(loadedNames.begin(), loadedNames.end()), loadedNames.end());
+
+		// Each pass below is independent per def, so the expensive part (hashing
+		// sources, running scripts, parsing SVGs) fans out over the JobSystem into
+		// per-def slots; results are applied to `definitions` serially afterwards.
+		// Workers only read `definitions` while a pass runs.
+		auto& jobs = foundation::JobSystem::shared();
+
+		// Baked pack: a def whose entry matches its current sources takes its final
+		// collision from the pack and skips the eager captures below (no Lua run,
+		// no SVG parse); getTemplate later serves its mesh from the pack too.
+		for (const std::string& name : loadedNames) {
+			m_bakedEntries.erase(name);
+		}
+		if (m_bakedPack) {
+			(void)sharedScriptsHash(); // lazily cached; compute it before the workers read it
+			std::vector<const AssetPack::Entry*> matched(loadedNames.size(), nullptr);
+			std::vector<CollisionShape>			 shapes(loadedNames.size());
+			jobs.parallelFor(0, loadedNames.size(), 1, [&](size_t begin, size_t end) {
+				for (size_t i = begin; i < end; ++i) {
+					const AssetPack::Entry* entry = m_bakedPack->find(loadedNames[i]);
+					if (entry == nullptr || entry->sourceHash != computeSourceHash(loadedNames[i])) {
+						continue;
+					}
+					if (!m_bakedPack->readCollision(*entry, shapes[i])) {
+						LOG_WARNING(Engine, "Baked pack entry for '%s' is corrupt; generating live", loadedNames[i].c_str());
+						continue;
+					}
+					matched[i] = entry;
+				}
+			});
+			for (size_t i = 0; i < loadedNames.size(); ++i) {
+				if (matched[i] != nullptr) {
+					definitions[loadedNames[i]].collision = std::move(shapes[i]);
+					m_bakedEntries[loadedNames[i]] = matched[i];
+				}
+			}
 		}
 
 		// Eager collision capture: procedural generators can emit their collision
@@ -1022,44 +1163,45 @@ namespace engine::assets {
 		// runs. Run each such script once now (generateAsset does NOT tessellate, so
 		// this is cheap) so nav/collision see the rect at load instead of racing the
 		// first lazy render. XML <collision> always wins; skip capture when set.
+		// Also for simple assets: SVG-metadata collision capture. An SVG-backed asset
+		// may author its collider in <metadata>; this wins over any XML <collision>
+		// (documented precedence: SVG metadata is the authoritative home for SVG
+		// assets). loadCollisionFromSvgMetadata bails cheaply when there's no
+		// metadata, so assets without a collider pay only a file open + parse.
+		std::vector<AssetDefinition*> captured;
 		for (const std::string& name : loadedNames) {
 			auto it = definitions.find(name);
-			if (it == definitions.end()) {
-				continue;
-			}
-			AssetDefinition& def = it->second;
-			if (def.collision.blocks() || def.assetType != AssetType::Procedural) {
-				continue;
-			}
-			GeneratedAsset tmp;
-			if (!generateAsset(name, 0, tmp)) {
-				LOG_WARNING(Engine, "Eager collision capture: generateAsset failed for '%s'; leaving collision None", name.c_str());
+			if (it == definitions.end() || m_bakedEntries.count(name) != 0) {
 				continue;
 			}
-			if (tmp.emittedCollision.has_value()) {
-				def.collision = *tmp.emittedCollision;
+			const AssetDefinition& def = it->second;
+			const bool			   script = def.assetType == AssetType::Procedural && !def.collision.blocks();
+			const bool			   svg = def.assetType == AssetType::Simple && !def.svgPath.empty();
+			if (script || svg) {
+				captured.push_back(&it->second);
 			}
 		}
-
-		// SVG-metadata collision capture (simple assets). An SVG-backed asset may
-		// author its collider in <metadata>; this wins over any XML <collision> for
-		// simple assets (documented precedence: SVG metadata is the authoritative
-		// home for SVG assets). Runs eagerly at load so nav, which reads collision
-		// without forcing a render, sees the collider before the first lazy
-		// getTemplate. loadCollisionFromSvgMetadata bails cheaply when there's no
-		// metadata, so assets without a collider pay only a file open + parse.
-		for (const std::string& name : loadedNames) {
-			auto it = definitions.find(name);
-			if (it == definitions.end()) {
-				continue;
-			}
-			AssetDefinition& def = it->second;
-			if (def.assetType != AssetType::Simple || def.svgPath.empty()) {
-				continue;
+		std::vector<std::optional<CollisionShape>> captures(captured.size());
+		jobs.parallelFor(0, captured.size(), 1, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				const AssetDefinition& def = *captured[i];
+				if (def.assetType == AssetType::Simple) {
+					captures[i] = loadCollisionFromSvgMetadata(def.resolvePath(def.svgPath).string(), def.worldHeight);
+					continue;
+				}
+				GeneratedAsset tmp;
+				if (!generateAsset(def.defName, 0, tmp)) {
+					LOG_WARNING(
+						Engine, "Eager collision capture: generateAsset failed for '%s'; leaving collision None", def.defName.c_str()
+					);
+					continue;
+				}
+				captures[i] = tmp.emittedCollision;
 			}
-			std::string resolvedSvgPath = def.resolvePath(def.svgPath).string();
-			if (auto shape = loadCollisionFromSvgMetadata(resolvedSvgPath, def.worldHeight)) {
-				def.collision = *shape;
+		});
+		for (size_t i = 0; i < captured.size(); ++i) {
+			if (captures[i].has_value()) {
+				captured[i]->collision = *captures[i];
 			}
 		}
 
@@ -1071,9 +1213,6 @@ namespace engine::assets {
 				getMotion(name);
 			}
 		}
-
-		LOG_DEBUG(Engine, "Loaded %d asset definitions from %s", loadedCount, xmlPath.c_str());
-		return loadedCount > 0;
 	}
 
 	size_t AssetRegistry::loadDefinitionsFromFolder(const std::string& folderPath, const std::function<void(int)>& onProgress) {
@@ -1096,11 +1235,10 @@ namespace engine::assets {
 			return 0;
 		}
 
-		size_t totalLoaded = 0;
-		size_t filesProcessed = 0;
-
-		// Recursively iterate through all files in the folder
-		// Only load "primary" XML files that match the FolderName/FolderName.xml pattern
+		// Collect the primary XML files first, sorted so definition override
+		// order (a defName declared twice: the later file wins) does not depend
+		// on directory iteration order.
+		std::vector<fs::path> files;
 		try {
 			for (const auto& entry : fs::recursive_directory_iterator(folderPath)) {
 				if (!entry.is_regular_file()) {
@@ -1127,28 +1265,63 @@ namespace engine::assets {
 					continue;
 				}
 
-				filesProcessed++;
-				size_t beforeCount = definitions.size();
-
-				if (loadDefinitions(entry.path().string())) {
-					size_t loaded = definitions.size() - beforeCount;
-					totalLoaded += loaded;
-					LOG_DEBUG(Engine, "Loaded %zu definitions from %s", loaded, entry.path().string().c_str());
-					if (onProgress) {
-						onProgress(static_cast<int>(definitions.size()));
-					}
-				}
+				files.push_back(entry.path());
 			}
 		} catch (const fs::filesystem_error& e) {
 			LOG_ERROR(Engine, "Filesystem error scanning '%s': %s", folderPath.c_str(), e.what());
 			m_validationReport.issues.clear();
 			m_validationReport.add(Severity::Error, "", "", std::string("Filesystem error scanning assets: ") + e.what(), folderPath);
-			return totalLoaded;
+			return 0;
+		}
+		std::sort(files.begin(), files.end());
+
+		// Parse in parallel (XML -> AssetDefinition touches no registry state),
+		// then commit serially in file order. Progress is reported as files parse;
+		// the mutex keeps onProgress calls serialized and their counts increasing.
+		std::vector<std::vector<AssetDefinition>> parsed(files.size());
+		std::vector<uint8_t>					  parsedOk(files.size(), 0);
+		std::mutex								  progressMutex;
+		int										  progressCount = static_cast<int>(definitions.size());
+		foundation::JobSystem::shared().parallelFor(0, files.size(), 1, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				parsedOk[i] = parseDefinitionFile(files[i].string(), parsed[i]) ? 1 : 0;
+				if (parsedOk[i] != 0 && onProgress) {
+					std::lock_guard<std::mutex> lock(progressMutex);
+					progressCount += static_cast<int>(parsed[i].size());
+					onProgress(progressCount);
+				}
+			}
+		});
+
+		size_t					 totalLoaded = 0;
+		std::vector<std::string> loadedNames;
+		for (size_t i = 0; i < files.size(); ++i) {
+			if (parsedOk[i] == 0 || parsed[i].empty()) {
+				continue;
+			}
+			const size_t beforeCount = definitions.size();
+			for (AssetDefinition& def : parsed[i]) {
+				loadedNames.push_back(def.defName);
+				definitions[def.defName] = std::move(def);
+			}
+			const size_t loaded = definitions.size() - beforeCount;
+			totalLoaded += loaded;
+			LOG_DEBUG(Engine, "Loaded %zu definitions from %s", loaded, files[i].string().c_str());
+		}
+		finishLoadingDefinitions(std::move(loadedNames));
+		if (onProgress) {
+			onProgress(static_cast<int>(definitions.size()));
 		}
 
 		LOG_INFO(
-			Engine, "Asset folder scan complete: %zu definitions from %zu XML files in %s", totalLoaded, filesProcessed, folderPath.c_str()
+			Engine, "Asset folder scan complete: %zu definitions from %zu XML files in %s", totalLoaded, files.size(), folderPath.c_str()
 		);
+		if (m_bakedPack) {
+			LOG_INFO(
+				Engine, "Baked asset pack: %zu of %zu definitions current (the rest generate live)", m_bakedEntries.size(),
+				definitions.size()
+			);
+		}
 
 		// Build group index from loaded definitions
 		buildGroupIndex();
@@ -1171,11 +1344,15 @@ namespace engine::assets {
 			m_loadThread.join();
 		}
 		m_loadProgress.defsLoaded.store(0);
+		m_loadProgress.templatesBuilt.store(0);
 		m_loadProgress.done.store(false);
 		m_loadProgress.started.store(true, std::memory_order_release);
 
 		m_loadThread = std::thread([this, folderPath]() {
 			loadDefinitionsFromFolder(folderPath, [this](int loaded) { m_loadProgress.defsLoaded.store(loaded); });
+			// Generate meshes behind the splash, across the JobSystem, rather than
+			// one at a time on the render thread as assets first come into view.
+			pregenerateTemplates();
 			// Release so a reader that observes done (acquire) sees all the writes
 			// the worker made to definitions, indices, and the validation report.
 			m_loadProgress.done.store(true, std::memory_order_release);
@@ -1198,13 +1375,16 @@ namespace engine::assets {
 
 	const renderer::TessellatedMesh* AssetRegistry::getTemplate(const std::string& defName) {
 		// Guard the lazy tessellation cache: chunk workers baking entity meshes
-		// call this concurrently with the render thread
-		std::lock_guard<std::mutex> lock(templateCacheMutex);
-
-		// Check cache first
-		auto cacheIt = templateCache.find(defName);
-		if (cacheIt != templateCache.end()) {
-			return &cacheIt->second;
+		// call this concurrently with the render thread (and pregenerateTemplates
+		// with both). The build itself runs unlocked so different templates
+		// generate in parallel; two callers racing on the same def both build it
+		// (deterministically) and the first insert wins.
+		{
+			std::lock_guard<std::mutex> lock(templateCacheMutex);
+			auto						cacheIt = templateCache.find(defName);
+			if (cacheIt != templateCache.end()) {
+				return &cacheIt->second;
+			}
 		}
 
 		// Get definition
@@ -1215,31 +1395,52 @@ namespace engine::assets {
 		}
 
 		renderer::TessellatedMesh mesh;
+		if (!buildTemplate(*def, mesh)) {
+			return nullptr;
+		}
 
-		if (def->assetType == AssetType::Simple) {
+		// Cache and return
+		std::lock_guard<std::mutex> lock(templateCacheMutex);
+		return &templateCache.try_emplace(defName, std::move(mesh)).first->second;
+	}
+
+	bool AssetRegistry::buildTemplate(const AssetDefinition& def, renderer::TessellatedMesh& mesh) {
+		const std::string& defName = def.defName;
+
+		// Baked pack: copy the precomputed mesh out of the mapping instead of
+		// parsing/generating and tessellating. Entries baked without a mesh (or
+		// found corrupt) fall through to live generation.
+		if (auto baked = m_bakedEntries.find(defName); baked != m_bakedEntries.end()) {
+			if (m_bakedPack->readMesh(*baked->second, mesh)) {
+				return true;
+			}
+			mesh.clear();
+		}
+
+		if (def.assetType == AssetType::Simple) {
 			// Load SVG and tessellate directly
-			if (def->svgPath.empty()) {
+			if (def.svgPath.empty()) {
 				LOG_ERROR(Engine, "Simple asset %s has no svgPath", defName.c_str());
-				return nullptr;
+				return false;
 			}
 
 			// Resolve SVG path relative to asset folder
-			std::string resolvedSvgPath = def->resolvePath(def->svgPath).string();
-			LOG_DEBUG(Engine, "Resolved SVG path: %s -> %s", def->svgPath.c_str(), resolvedSvgPath.c_str());
+			std::string resolvedSvgPath = def.resolvePath(def.svgPath).string();
+			LOG_DEBUG(Engine, "Resolved SVG path: %s -> %s", def.svgPath.c_str(), resolvedSvgPath.c_str());
 
 			std::vector<renderer::LoadedSVGShape> shapes;
 			if (!renderer::loadSVG(resolvedSvgPath, kSvgCurveTolerance, shapes)) {
-				LOG_ERROR(Engine, "Failed to load SVG: %s (resolved from %s)", resolvedSvgPath.c_str(), def->svgPath.c_str());
-				return nullptr;
+				LOG_ERROR(Engine, "Failed to load SVG: %s (resolved from %s)", resolvedSvgPath.c_str(), def.svgPath.c_str());
+				return false;
 			}
 
-			const SvgMeterFrame frame		= computeSvgMeterFrame(shapes, def->worldHeight);
+			const SvgMeterFrame frame		= computeSvgMeterFrame(shapes, def.worldHeight);
 			const float			scaleFactor = frame.valid ? frame.scaleFactor : 1.0F;
 			LOG_INFO(
 				Engine,
 				"SVG '%s': worldHeight=%.2f, scaleFactor=%.4f",
 				defName.c_str(),
-				def->worldHeight,
+				def.worldHeight,
 				scaleFactor
 			);
 
@@ -1255,25 +1456,23 @@ namespace engine::assets {
 
 			if (mesh.vertices.empty()) {
 				LOG_ERROR(Engine, "Failed to tessellate SVG asset: %s", defName.c_str());
-				return nullptr;
+				return false;
 			}
 		} else {
 			// Generate procedural asset
 			GeneratedAsset asset;
 			if (!generateAsset(defName, 42, asset)) { // Use fixed seed for template
 				LOG_ERROR(Engine, "Failed to generate asset: %s", defName.c_str());
-				return nullptr;
+				return false;
 			}
 
 			if (!tessellateAsset(asset, mesh)) {
 				LOG_ERROR(Engine, "Failed to tessellate asset: %s", defName.c_str());
-				return nullptr;
+				return false;
 			}
 		}
 
-		// Cache and return
-		templateCache[defName] = std::move(mesh);
-		return &templateCache[defName];
+		return true;
 	}
 
 	const MotionDef* AssetRegistry::getMotion(const std::string& defName) {
@@ -1396,22 +1595,10 @@ namespace engine::assets {
 		// Check if this is a Lua script generator
 		if (def->isLuaGenerator()) {
 			try {
-				// Resolve script path - check for @shared/ prefix
-				std::string		  resolvedScriptPath;
-				const std::string kSharedPrefix = "@shared/";
-				if (def->scriptPath.compare(0, kSharedPrefix.size(), kSharedPrefix) == 0) {
-					// Script is in shared folder - resolve using shared scripts path
-					if (m_sharedScriptsPath.empty()) {
-						LOG_ERROR(Engine, "Shared scripts path not configured, but @shared/ prefix used in: %s", def->scriptPath.c_str());
-						return false;
-					}
-					std::string relativePath = def->scriptPath.substr(kSharedPrefix.size());
-					resolvedScriptPath = (m_sharedScriptsPath / relativePath).string();
-					LOG_DEBUG(Engine, "Resolved shared script: %s -> %s", def->scriptPath.c_str(), resolvedScriptPath.c_str());
-				} else {
-					// Script is local to asset folder
-					resolvedScriptPath = def->resolvePath(def->scriptPath).string();
-					LOG_DEBUG(Engine, "Resolved local script: %s -> %s", def->scriptPath.c_str(), resolvedScriptPath.c_str());
+				const std::string resolvedScriptPath = resolveScriptPath(*def);
+				if (resolvedScriptPath.empty()) {
+					LOG_ERROR(Engine, "Shared scripts path not configured, but @shared/ prefix used in: %s", def->scriptPath.c_str());
+					return false;
 				}
 
 				LuaGenerator luaGen(resolvedScriptPath);
@@ -1432,6 +1619,23 @@ namespace engine::assets {
 		return generator->generate(ctx, def->params, outAsset);
 	}
 
+	std::string AssetRegistry::resolveScriptPath(const AssetDefinition& def) const {
+		const std::string kSharedPrefix = "@shared/";
+		if (def.scriptPath.compare(0, kSharedPrefix.size(), kSharedPrefix) == 0) {
+			// Script is in shared folder - resolve using shared scripts path
+			if (m_sharedScriptsPath.empty()) {
+				return {};
+			}
+			std::string resolved = (m_sharedScriptsPath / def.scriptPath.substr(kSharedPrefix.size())).string();
+			LOG_DEBUG(Engine, "Resolved shared script: %s -> %s", def.scriptPath.c_str(), resolved.c_str());
+			return resolved;
+		}
+		// Script is local to asset folder
+		std::string resolved = def.resolvePath(def.scriptPath).string();
+		LOG_DEBUG(Engine, "Resolved local script: %s -> %s", def.scriptPath.c_str(), resolved.c_str());
+		return resolved;
+	}
+
 	bool AssetRegistry::tessellateAsset(const GeneratedAsset& asset, renderer::TessellatedMesh& outMesh) {
 		outMesh.clear();
 
@@ -1485,6 +1689,24 @@ namespace engine::assets {
 			return !outMesh.vertices.empty();
 		}
 
+		// Groundcover variants pre-generated at load (see pregenerateTemplates).
+		{
+			std::lock_guard<std::mutex> lock(templateCacheMutex);
+			auto						it = m_variantCache.find(defName);
+			if (it != m_variantCache.end() && seed < it->second.size() && !it->second[seed].vertices.empty()) {
+				outMesh = it->second[seed];
+				return true;
+			}
+		}
+
+		// Baked groundcover variants (seeds 0..variantCount-1) come from the pack.
+		if (auto baked = m_bakedEntries.find(defName); baked != m_bakedEntries.end()) {
+			if (m_bakedPack->readVariant(*baked->second, seed, outMesh)) {
+				return true;
+			}
+			outMesh.clear();
+		}
+
 		// Procedural assets: generate this seed's form fresh (uncached) and tessellate.
 		GeneratedAsset asset;
 		if (!generateAsset(defName, seed, asset)) {
@@ -1493,6 +1715,40 @@ namespace engine::assets {
 		return tessellateAsset(asset, outMesh);
 	}
 
+	void AssetRegistry::pregenerateTemplates() {
+		const std::vector<std::string> names = getDefinitionNames();
+		auto&						   jobs = foundation::JobSystem::shared();
+		std::atomic<int>			   built{0};
+
+		jobs.parallelFor(0, names.size(), 1, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				const std::string&	   name = names[i];
+				const AssetDefinition* def = getDefinition(name);
+				if (def == nullptr) {
+					continue;
+				}
+				(void)getTemplate(name);
+
+				// GroundcoverRenderer uploads one mesh per seed on first sight of the
+				// def; generate them here so the render thread only copies them out.
+				if (def->role == AssetRole::Groundcover && def->assetType == AssetType::Procedural) {
+					std::vector<renderer::TessellatedMesh> variants(std::max<uint32_t>(1, def->variantCount));
+					jobs.parallelFor(0, variants.size(), 1, [&](size_t seedBegin, size_t seedEnd) {
+						for (size_t seed = seedBegin; seed < seedEnd; ++seed) {
+							if (!buildMesh(name, static_cast<uint32_t>(seed), variants[seed])) {
+								variants[seed].clear();
+							}
+						}
+					});
+					std::lock_guard<std::mutex> lock(templateCacheMutex);
+					m_variantCache.try_emplace(name, std::move(variants));
+				}
+				m_loadProgress.templatesBuilt.store(built.fetch_add(1) + 1);
+			}
+		});
+		LOG_INFO(Engine, "Pre-generated templates for %zu asset definitions", names.size());
+	}
+
 	void AssetRegistry::clear() {
 		// Finish any in-flight async load before tearing down the data it writes.
 		if (m_loadThread.joinable()) {
@@ -1500,6 +1756,7 @@ namespace engine::assets {
 		}
 		definitions.clear();
 		templateCache.clear();
+		m_variantCache.clear();
 		{
 			std::lock_guard<std::mutex> lk(m_motionCacheMutex);
 			m_motionCache.clear();
@@ -1510,10 +1767,13 @@ namespace engine::assets {
 		m_defNameToId.clear();
 		m_idToDefName.clear();
 		m_capabilityMasks.clear();
+		m_definitionsById.clear();
 		m_validationReport.issues.clear();
+		m_bakedEntries.clear();
 		m_loadProgress.started.store(false);
 		m_loadProgress.done.store(false);
 		m_loadProgress.defsLoaded.store(0);
+		m_loadProgress.templatesBuilt.store(0);
 	}
 
 	std::vector<std::string> AssetRegistry::getDefinitionNames() const {
@@ -1572,18 +1832,16 @@ namespace engine::assets {
 		m_defNameToId.clear();
 		m_idToDefName.clear();
 		m_capabilityMasks.clear();
+		m_definitionsById.clear();
 
 		// Reserve ID 0 as "invalid"
-		m_idToDefName.push_back("");
+		m_idToDefName.emplace_back();
 		m_capabilityMasks.push_back(0);
+		m_definitionsById.push_back(nullptr);
 
 		// Build ID mapping for all definitions
-		uint32_t nextId = 1;
 		for (const auto& [defName, def] : definitions) {
-			m_defNameToId[defName] = nextId;
-			m_idToDefName.push_back(defName);
-			m_capabilityMasks.push_back(computeCapabilityMask(def));
-			nextId++;
+			appendDefNameId(defName, computeCapabilityMask(def), &def);
 		}
 
 		LOG_DEBUG(Engine, "Built defName index: %zu entries", m_idToDefName.size() - 1);
@@ -1597,6 +1855,35 @@ namespace engine::assets {
 		return 0; // Invalid ID
 	}
 
+	uint32_t AssetRegistry::appendDefNameId(const std::string& defName, uint16_t capabilityMask, const AssetDefinition* def) {
+		if (m_idToDefName.empty()) {
+			m_idToDefName.emplace_back();
+			m_capabilityMasks.push_back(0);
+			m_definitionsById.push_back(nullptr);
+		}
+		const auto newId = static_cast<uint32_t>(m_idToDefName.size());
+		m_defNameToId[defName] = newId;
+		m_idToDefName.push_back(defName);
+		m_capabilityMasks.push_back(capabilityMask);
+		m_definitionsById.push_back(def);
+		return newId;
+	}
+
+	uint32_t AssetRegistry::internDefName(const std::string& defName) {
+		if (defName.empty()) {
+			return 0;
+		}
+		auto it = m_defNameToId.find(defName);
+		if (it != m_defNameToId.end()) {
+			return it->second;
+		}
+		return appendDefNameId(defName, 0, getDefinition(defName));
+	}
+
+	const AssetDefinition* AssetRegistry::getDefinition(uint32_t id) const {
+		return id < m_definitionsById.size() ? m_definitionsById[id] : nullptr;
+	}
+
 	const std::string& AssetRegistry::getDefName(uint32_t id) const {
 		if (id < m_idToDefName.size()) {
 			return m_idToDefName[id];
@@ -1625,9 +1912,16 @@ namespace engine::assets {
 		return 1.0F;
 	}
 
+	float AssetRegistry::getItemMassKg(uint32_t id) const {
+		const auto* def = getDefinition(id);
+		if (def != nullptr && def->itemProperties.has_value()) {
+			return def->itemProperties->massKg;
+		}
+		return 1.0F;
+	}
+
 	const std::string& AssetRegistry::getToolType(uint32_t id) const {
-		const auto& defName = getDefName(id);
-		const auto* def = getDefinition(defName);
+		const auto* def = getDefinition(id);
 		if (def != nullptr) {
 			return def->toolType;
 		}
@@ -1643,10 +1937,7 @@ namespace engine::assets {
 		}
 
 		// Assign new ID
-		auto newId = static_cast<uint32_t>(m_idToDefName.size());
-		m_defNameToId[defName] = newId;
-		m_idToDefName.push_back(defName);
-		m_capabilityMasks.push_back(capabilityMask);
+		const uint32_t newId = appendDefNameId(defName, capabilityMask, getDefinition(defName));
 
 		LOG_DEBUG(Engine, "Registered synthetic definition '%s' with ID %u, capabilities 0x%04X", defName.c_str(), newId, capabilityMask);
 
@@ -1661,26 +1952,23 @@ namespace engine::assets {
 		std::string defName = def.defName;
 		const uint16_t mask = computeCapabilityMask(def);
 		definitions[defName] = std::move(def);
+		m_bakedEntries.erase(defName); // a test def never matches baked sources
 
 		// Assign the interning id by APPENDING, never by rebuilding the whole index. A full rebuild
 		// iterates the unordered definitions map, so every prior id could be reshuffled when the map
 		// rehashes -- making a defNameId captured between two registrations silently come to name a
 		// different definition (it stayed put on MSVC, reordered on libstdc++, surfacing as a CI-only
 		// AIDecisionSystem failure). Appending keeps already-issued ids stable across registrations.
-		if (m_idToDefName.empty()) {
-			// First registration: seat the reserved invalid id 0 (mirrors buildDefNameIndex).
-			m_idToDefName.push_back("");
-			m_capabilityMasks.push_back(0);
-		}
-		auto existing = m_defNameToId.find(defName);
+		// The first registration also seats the reserved invalid id 0 (mirrors buildDefNameIndex).
+		const AssetDefinition* stored = &definitions.at(defName);
+		auto				   existing = m_defNameToId.find(defName);
 		if (existing != m_defNameToId.end()) {
-			// Re-registration of the same name updates its mask in place; id is unchanged.
+			// Re-registration of the same name (or a name interned before its definition
+			// existed) updates its entry in place; id is unchanged.
 			m_capabilityMasks[existing->second] = mask;
+			m_definitionsById[existing->second] = stored;
 		} else {
-			const auto newId = static_cast<uint32_t>(m_idToDefName.size());
-			m_defNameToId[defName] = newId;
-			m_idToDefName.push_back(defName);
-			m_capabilityMasks.push_back(mask);
+			appendDefNameId(defName, mask, stored);
 		}
 
 		LOG_DEBUG(Engine, "Registered test definition: %s", defName.c_str());
@@ -1689,6 +1977,7 @@ namespace engine::assets {
 	void AssetRegistry::clearDefinitions() {
 		definitions.clear();
 		templateCache.clear();
+		m_variantCache.clear();
 		{
 			std::lock_guard<std::mutex> lk(m_motionCacheMutex);
 			m_motionCache.clear();
@@ -1697,6 +1986,8 @@ namespace engine::assets {
 		m_defNameToId.clear();
 		m_idToDefName.clear();
 		m_capabilityMasks.clear();
+		m_definitionsById.clear();
+		m_bakedEntries.clear();
 		LOG_DEBUG(Engine, "Cleared all definitions");
 	}
 
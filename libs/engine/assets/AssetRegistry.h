@@ -5,6 +5,7 @@
 // Handles definition loading, generator invocation, and template caching.
 
 #include "assets/AssetDefinition.h"
+#include "assets/AssetPack.h"
 #include "assets/AssetValidator.h"
 #include "assets/IAssetGenerator.h"
 #include "assets/MotionDef.h"
@@ -12,6 +13,7 @@
 #include <vector/Types.h>
 
 #include <atomic>
+#include <deque>
 #include <filesystem>
 #include <functional>
 #include <memory>
@@ -29,6 +31,14 @@ namespace engine::assets {
 		std::atomic<bool> started{false};
 		std::atomic<bool> done{false};
 		std::atomic<int>  defsLoaded{0};
+		std::atomic<int>  templatesBuilt{0}; // pregenerateTemplates, after definitions load
+	};
+
+	/// Outcome of AssetRegistry::bakePack.
+	struct BakeResult {
+		bool   ok = false;
+		size_t entries = 0; // definitions written
+		size_t meshes = 0;	// of those, with a template mesh (the rest failed to generate)
 	};
 
 	/// Central registry for asset definitions and generated templates.
@@ -46,8 +56,11 @@ namespace engine::assets {
 		/// Load all asset definitions from a folder recursively
 		/// Scans for all *.xml files in the folder and subfolders.
 		/// @param folderPath Path to the definitions folder
+		/// Files are parsed in parallel on the JobSystem and committed in sorted
+		/// path order, so a defName declared twice resolves the same way every run.
 		/// @param onProgress Optional callback invoked with the running definition
-		///        count as files load (used by the async loader to drive the splash)
+		///        count as files load (used by the async loader to drive the splash).
+		///        Called from JobSystem workers, one call at a time.
 		/// @return Number of definitions loaded (0 if folder not found)
 		size_t loadDefinitionsFromFolder(const std::string& folderPath, const std::function<void(int)>& onProgress = {});
 
@@ -56,6 +69,10 @@ namespace engine::assets {
 		/// @return Pointer to definition, or nullptr if not found
 		const AssetDefinition* getDefinition(const std::string& defName) const;
 
+		/// Get an asset definition by interned ID (no string hashing)
+		/// @return Pointer to definition, or nullptr for 0, unknown IDs and interned-only names
+		[[nodiscard]] const AssetDefinition* getDefinition(uint32_t id) const;
+
 		/// Generate or retrieve a cached tessellated mesh template for an asset.
 		/// For instanced assets (grass), this returns the single template.
 		/// For complex assets, this returns the default variant.
@@ -76,6 +93,13 @@ namespace engine::assets {
 		/// @return true if generation succeeded
 		bool generateAsset(const std::string& defName, uint32_t seed, GeneratedAsset& outAsset);
 
+		/// Generate every loaded definition's template, plus each procedural
+		/// groundcover def's per-seed variants (seeds 0..variantCount-1, served by
+		/// buildMesh from then on), in parallel on the JobSystem. Each worker runs
+		/// Lua on its own VM; output is identical to lazy generation.
+		/// beginLoadAsync calls this after loading definitions.
+		void pregenerateTemplates();
+
 		/// Build an uncached tessellated mesh for an asset at a given seed.
 		/// Simple assets ignore the seed (one drawing); procedural assets use it to
 		/// select a form (vary the seed to sample the generator's range).
@@ -111,7 +135,8 @@ namespace engine::assets {
 
 		// --- Asynchronous loading (for a non-blocking splash) ---
 
-		/// Load the asset folder on a background worker thread. Definitions are not
+		/// Load the asset folder (and pregenerateTemplates) on a background worker
+		/// thread, which fans the work out over the JobSystem. Definitions are not
 		/// safe to read until isLoadComplete() returns true. Only one async load may
 		/// run at a time; a prior one is joined first.
 		void beginLoadAsync(const std::string& folderPath);
@@ -138,6 +163,31 @@ namespace engine::assets {
 		/// @return true if any asset declares membership in this group
 		[[nodiscard]] bool hasGroup(const std::string& groupName) const;
 
+		// --- Baked asset pack (see AssetPack.h) ---
+
+		/// Map a pack written by bakePack / `asset-cli bake`. Call before loading
+		/// definitions (like setSharedScriptsPath): entries are matched against
+		/// source hashes as definitions load, and a matching entry supplies the
+		/// def's collision at load and its template on first getTemplate.
+		/// @return false if the pack is missing or unusable (live generation only)
+		bool attachBakedPack(const std::filesystem::path& packPath);
+
+		/// Unmap the pack. Already-cached templates stay; definitions loaded
+		/// afterwards generate live.
+		void detachBakedPack();
+
+		/// Number of loaded definitions currently served from the baked pack.
+		[[nodiscard]] size_t bakedDefinitionCount() const { return m_bakedEntries.size(); }
+
+		/// Hash of every source a def's baked outputs depend on: its XML file, its
+		/// SVG or Lua script, and (Lua only) the shared scripts folder.
+		/// @return 0 if defName is not loaded
+		[[nodiscard]] uint64_t computeSourceHash(const std::string& defName) const;
+
+		/// Generate every loaded definition's template (and groundcover variants)
+		/// and write them, with the defs' final collision shapes, to a pack at packPath.
+		BakeResult bakePack(const std::filesystem::path& packPath);
+
 		/// Set the path to shared scripts folder (for @shared/ prefix resolution)
 		/// @param path Path to the shared scripts folder (should be absolute for reliable resolution)
 		void setSharedScriptsPath(const std::filesystem::path& path);
@@ -151,9 +201,16 @@ namespace engine::assets {
 
 		/// Get the defName string for a numeric ID
 		/// @param id The ID returned by getDefNameId
-		/// @return Reference to the defName string, or empty string if invalid
+		/// @return Reference to the defName string, or empty string if invalid. Stays valid
+		///         until the index is cleared or rebuilt (interning never moves existing names).
 		[[nodiscard]] const std::string& getDefName(uint32_t id) const;
 
+		/// Get the ID for a defName, assigning one (no capabilities, no definition) if the
+		/// name has none yet. This is how names that reach components without a loaded
+		/// definition (bare-defName tests, dev commands, saves from other builds) get an ID.
+		/// Empty names map to 0. Not thread-safe: call from the simulation thread only.
+		uint32_t internDefName(const std::string& defName);
+
 		/// Get all capability types for a defName by ID (for capability indexing)
 		/// Returns a bitmask where bit N is set if capability N is present. 16-bit because there are
 		/// 9 capability types (Edible..Storage); Storage is bit 8, which overflows a uint8_t.
@@ -167,6 +224,7 @@ namespace engine::assets {
 		/// Mass of one unit of an item, in kilograms. Returns 1.0 for unknown/non-item defs
 		/// so carry-weight math always has a sane positive divisor.
 		[[nodiscard]] float getItemMassKg(const std::string& defName) const;
+		[[nodiscard]] float getItemMassKg(uint32_t id) const;
 
 		/// Tool type an item provides (e.g. "Axe"), or empty if it is not a tool.
 		[[nodiscard]] const std::string& getToolType(uint32_t id) const;
@@ -194,9 +252,28 @@ namespace engine::assets {
 		AssetRegistry() = default;
 		~AssetRegistry();
 
+		/// Parse one XML definitions file. Touches no registry state, so files
+		/// parse concurrently. False (with LOG_ERROR) if the file is unreadable.
+		static bool parseDefinitionFile(const std::string& xmlPath, std::vector<AssetDefinition>& out);
+
+		/// Post-parse passes over just-stored definitions: baked-pack matching,
+		/// eager Lua / SVG-metadata collision capture, motion resolution.
+		void finishLoadingDefinitions(std::vector<std::string> loadedNames);
+
+		/// Build a def's template mesh (baked pack, SVG, or generator). Uncached
+		/// and lock-free; getTemplate caches the result.
+		bool buildTemplate(const AssetDefinition& def, renderer::TessellatedMesh& mesh);
+
+		/// Hash of the shared scripts folder, computed once (see computeSourceHash).
+		[[nodiscard]] uint64_t sharedScriptsHash() const;
+
 		/// Tessellate a generated asset into a mesh
 		bool tessellateAsset(const GeneratedAsset& asset, renderer::TessellatedMesh& outMesh);
 
+		/// Resolve a Lua def's scriptPath (@shared/ or relative to its folder).
+		/// Empty if it uses @shared/ and no shared scripts path is configured.
+		[[nodiscard]] std::string resolveScriptPath(const AssetDefinition& def) const;
+
 		/// Build group index from loaded definitions
 		void buildGroupIndex();
 
@@ -211,23 +288,44 @@ namespace engine::assets {
 		mutable std::mutex						   m_motionCacheMutex;
 
 		// getTemplate lazily tessellates into templateCache and is called from
-		// chunk worker threads (entity mesh baking) as well as the render thread
+		// chunk worker threads (entity mesh baking) as well as the render thread.
+		// Also guards m_variantCache.
 		mutable std::mutex templateCacheMutex;
 
+		// Procedural groundcover variant meshes by seed, from pregenerateTemplates
+		std::unordered_map<std::string, std::vector<renderer::TessellatedMesh>> m_variantCache;
+
 		// Group index: group name → list of defNames that belong to it
 		std::unordered_map<std::string, std::vector<std::string>> groupIndex;
 
 		// String interning: defName ↔ ID mapping for memory-efficient storage
 		// ID 0 is reserved as "invalid/not found"
 		std::unordered_map<std::string, uint32_t> m_defNameToId;
-		std::vector<std::string>				  m_idToDefName; // Index 0 = empty string (invalid)
+		std::deque<std::string>					  m_idToDefName; // Index 0 = empty string (invalid); deque so references survive appends
 
 		// Pre-computed capability masks by ID (for O(1) capability checks). 16-bit: 9 capability types.
 		std::vector<uint16_t> m_capabilityMasks;
 
+		// Definition by ID, parallel to m_capabilityMasks (null for 0 and interned-only names).
+		// Points into `definitions`, whose nodes stay put until they are erased.
+		std::vector<const AssetDefinition*> m_definitionsById;
+
+		/// Append a new ID for `defName` (seating the reserved ID 0 first if the index is empty)
+		uint32_t appendDefNameId(const std::string& defName, uint16_t capabilityMask, const AssetDefinition* def);
+
 		// Path to shared scripts folder (for @shared/ prefix resolution)
 		std::filesystem::path m_sharedScriptsPath;
 
+		// Baked pack and the loaded defs whose entry matched their source hash.
+		// Written only while definitions load (or are cleared); after that the map
+		// and the entries it points at are immutable, so buildTemplate and
+		// buildMesh read them without templateCacheMutex. The pack's own lazy
+		// record checks are atomic (see AssetPack).
+		std::unique_ptr<AssetPack>								 m_bakedPack;
+		std::unordered_map<std::string, const AssetPack::Entry*> m_bakedEntries;
+		// Lazily computed hash of the shared scripts folder (load/bake time only).
+		mutable std::optional<uint64_t> m_sharedScriptsHash;
+
 		// Validation report from the most recent loadDefinitionsFromFolder
 		ValidationReport m_validationReport;
 
@@ -4,9 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace engine::assets;
 
@@ -18,6 +22,29 @@ namespace {
 		return p.parent_path().parent_path().parent_path().parent_path();
 	}
 
+	struct TempDefs {
+		std::filesystem::path root;
+
+		TempDefs() {
+			static std::atomic<int> counter{0};
+			root = std::filesystem::temp_directory_path() / ("asset_registry_parallel_test_" + std::to_string(counter++));
+			std::filesystem::remove_all(root);
+		}
+
+		~TempDefs() {
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+		}
+
+		TempDefs(const TempDefs&)			 = delete;
+		TempDefs& operator=(const TempDefs&) = delete;
+
+		void write(const std::string& rel, const std::string& body) const {
+			std::filesystem::create_directories((root / rel).parent_path());
+			std::ofstream(root / rel) << body;
+		}
+	};
+
 } // namespace
 
 TEST(AssetRegistryAsyncTest, BeginLoadAsyncPopulatesRegistry) {
@@ -63,6 +90,75 @@ TEST(AssetRegistryAsyncTest, MissingFolderRecordsValidationError) {
 	reg.clear();
 }
 
+// Files parse in parallel, but commit in sorted path order: a defName declared
+// twice always resolves to the later file, however the directory iterates.
+TEST(AssetRegistryAsyncTest, DuplicateDefNameResolvesInPathOrder) {
+	auto&	 reg = AssetRegistry::Get();
+	TempDefs t;
+	auto	 defXml = [](const std::string& label) {
+		return "<?xml version=\"1.0\"?><AssetDefinitions><AssetDef><defName>Test_Dup</defName><label>" + label +
+			   "</label><assetType>simple</assetType></AssetDef></AssetDefinitions>";
+	};
+	t.write("B_Dup/B_Dup.xml", defXml("second"));
+	t.write("A_Dup/A_Dup.xml", defXml("first"));
+	for (int i = 0; i < 8; ++i) {
+		t.write("Filler" + std::to_string(i) + "/Filler" + std::to_string(i) + ".xml", defXml("filler"));
+	}
+
+	for (int run = 0; run < 3; ++run) {
+		reg.clearDefinitions();
+		reg.loadDefinitionsFromFolder(t.root.string());
+		const AssetDefinition* def = reg.getDefinition("Test_Dup");
+		ASSERT_NE(def, nullptr);
+		EXPECT_EQ(def->label, "second") << "run " << run;
+	}
+	reg.clearDefinitions();
+}
+
+// Pre-generated groundcover variants (worker-thread Lua VMs) must equal what a
+// lazy buildMesh produces on this thread's VM, and a script's globals must not
+// carry from one run into the next.
+TEST(AssetRegistryAsyncTest, PregeneratedVariantsMatchLiveGeneration) {
+	auto&	 reg = AssetRegistry::Get();
+	TempDefs t;
+	t.write(
+		"Test_Tuft/Test_Tuft.xml",
+		"<?xml version=\"1.0\"?><AssetDefinitions><AssetDef><defName>Test_Tuft</defName>"
+		"<assetType>procedural</assetType><role>groundcover</role><variantCount>6</variantCount>"
+		"<generator><scriptPath>tuft.lua</scriptPath></generator></AssetDef></AssetDefinitions>"
+	);
+	t.write(
+		"Test_Tuft/tuft.lua",
+		"runs = (runs or 0) + 1\n" // a global: leaks into the next run unless runs are isolated
+		"local size = 1 + seed * 0.5 + math.random() + runs\n"
+		"local path = asset:createPath()\n"
+		"path:addVertex(0, 0)\n"
+		"path:addVertex(size, 0)\n"
+		"path:addVertex(0, size)\n"
+		"path:close()\n"
+	);
+
+	reg.clearDefinitions();
+	reg.loadDefinitionsFromFolder(t.root.string());
+	reg.pregenerateTemplates();
+	std::vector<std::vector<Foundation::Vec2>> pregenerated;
+	for (uint32_t seed = 0; seed < 6; ++seed) {
+		renderer::TessellatedMesh mesh;
+		ASSERT_TRUE(reg.buildMesh("Test_Tuft", seed, mesh)) << "seed " << seed;
+		pregenerated.push_back(mesh.vertices);
+	}
+	EXPECT_NE(pregenerated[0], pregenerated[1]) << "the seed drives the form";
+
+	reg.clearDefinitions(); // drops the caches; buildMesh now generates live, serially
+	reg.loadDefinitionsFromFolder(t.root.string());
+	for (uint32_t seed = 0; seed < 6; ++seed) {
+		renderer::TessellatedMesh mesh;
+		ASSERT_TRUE(reg.buildMesh("Test_Tuft", seed, mesh)) << "seed " << seed;
+		EXPECT_EQ(mesh.vertices, pregenerated[seed]) << "seed " << seed;
+	}
+	reg.clearDefinitions();
+}
+
 // Capability bitmask must cover ALL 9 capability types, including Storage at bit 8 and Craftable
 // at bit 7 -- both overflow a uint8_t and were dropped before the mask widened to uint16_t and
 // kCapabilityTypeCount went 7 -> 9. This guards the widening directly: if getCapabilityMask ever
@@ -12,14 +12,42 @@
 
 #include <fstream>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
 
 namespace engine::assets {
 
+	struct LuaEngine::ScriptCache {
+		struct Entry {
+			std::string				source;
+			sol::protected_function chunk;
+		};
+		std::unordered_map<std::string, Entry> byPath;
+	};
+
 	LuaEngine::LuaEngine() = default;
-	LuaEngine::~LuaEngine() = default;
+	LuaEngine::~LuaEngine() = default; // m_scripts (declared after m_lua) unrefs its chunks first
 
 	LuaEngine::LuaEngine(LuaEngine&&) noexcept = default;
-	LuaEngine& LuaEngine::operator=(LuaEngine&&) noexcept = default;
+
+	LuaEngine& LuaEngine::operator=(LuaEngine&& other) noexcept {
+		if (this != &other) {
+			m_scripts.reset(); // references into the old state; drop them before it closes
+			m_lua = std::move(other.m_lua);
+			m_scripts = std::move(other.m_scripts);
+			m_initialized = std::exchange(other.m_initialized, false);
+			m_lastError = std::move(other.m_lastError);
+		}
+		return *this;
+	}
+
+	LuaEngine& LuaEngine::forCurrentThread() {
+		thread_local LuaEngine engine;
+		if (!engine.isInitialized()) {
+			engine.initialize();
+		}
+		return engine;
+	}
 
 	bool LuaEngine::initialize() {
 		if (m_initialized) {
@@ -29,6 +57,7 @@ namespace engine::assets {
 		try {
 			m_lua = std::make_unique<sol::state>();
 			m_lua->open_libraries(sol::lib::base, sol::lib::math, sol::lib::string, sol::lib::table);
+			m_scripts = std::make_unique<ScriptCache>();
 
 			registerBindings();
 			setupSandbox();
@@ -224,7 +253,8 @@ namespace engine::assets {
 		}
 
 		try {
-			// Read the script file
+			// Reads the file every call (so edited scripts are picked up) but only
+			// recompiles when its text changed.
 			std::ifstream file(scriptPath);
 			if (!file.is_open()) {
 				m_lastError = "Failed to open script: " + scriptPath;
@@ -236,28 +266,49 @@ namespace engine::assets {
 			buffer << file.rdbuf();
 			std::string script = buffer.str();
 
+			auto& cached = m_scripts->byPath[scriptPath];
+			if (!cached.chunk.valid() || cached.source != script) {
+				sol::load_result loaded = m_lua->load(script, "@" + scriptPath);
+				if (!loaded.valid()) {
+					sol::error err = loaded;
+					m_scripts->byPath.erase(scriptPath);
+					m_lastError = std::string("Script compilation failed: ") + err.what();
+					LOG_ERROR(Engine, "%s", m_lastError.c_str());
+					return false;
+				}
+				cached.chunk = loaded.get<sol::protected_function>();
+				cached.source = std::move(script);
+			}
+
+			// Run in a fresh environment that falls back to the sandboxed globals:
+			// whatever the script assigns to globals is dropped with the environment,
+			// so one run cannot leak state into the next on this (shared per-thread) VM.
+			sol::environment env(*m_lua, sol::create, m_lua->globals());
+
 			// Set up the context for this execution
-			(*m_lua)["seed"] = ctx.seed;
-			(*m_lua)["variantIndex"] = ctx.variantIndex;
+			env["seed"] = ctx.seed;
+			env["variantIndex"] = ctx.variantIndex;
 
 			// Seed the random number generator using sol2's type-safe method
-			// (avoids string concatenation which could be a code injection risk)
+			// (avoids string concatenation which could be a code injection risk).
+			// math.random's state belongs to the VM, so reseeding every run is what
+			// keeps output a function of the seed alone.
 			(*m_lua)["math"]["randomseed"](ctx.seed + ctx.variantIndex);
 
 			// Create helper functions to access params
 			// NOTE: These lambdas capture `params` and `outAsset` by reference. This is safe
 			// because scripts execute synchronously within this function call. If the execution
 			// model changes to async/deferred, these captures would need to be reconsidered.
-			(*m_lua)["getFloat"] = [&params](const std::string& key, float defaultVal) {
+			env["getFloat"] = [&params](const std::string& key, float defaultVal) {
 				return params.getFloat(key.c_str(), defaultVal);
 			};
-			(*m_lua)["getString"] = [&params](const std::string& key, const std::string& defaultVal) {
+			env["getString"] = [&params](const std::string& key, const std::string& defaultVal) {
 				return params.getString(key.c_str(), defaultVal);
 			};
-			(*m_lua)["getInt"] = [&params](const std::string& key, int32_t defaultVal) {
+			env["getInt"] = [&params](const std::string& key, int32_t defaultVal) {
 				return params.getInt(key.c_str(), defaultVal);
 			};
-			(*m_lua)["getFloatRange"] = [&params](const std::string& key, float defaultMin, float defaultMax) {
+			env["getFloatRange"] = [&params](const std::string& key, float defaultMin, float defaultMax) {
 				float min = 0;
 				float max = 0;
 				params.getFloatRange(key.c_str(), min, max, defaultMin, defaultMax);
@@ -266,10 +317,11 @@ namespace engine::assets {
 
 			// Clear and expose the output asset
 			outAsset.clear();
-			(*m_lua)["asset"] = &outAsset;
+			env["asset"] = &outAsset;
 
 			// Execute the script
-			auto result = m_lua->script(script, [](lua_State*, sol::protected_function_result pfr) { return pfr; });
+			sol::set_environment(env, cached.chunk);
+			sol::protected_function_result result = cached.chunk();
 
 			if (!result.valid()) {
 				sol::error err = result;
@@ -3,6 +3,12 @@
 // Lua Scripting Engine
 // Manages Lua state, API bindings, and script execution for procedural asset generation.
 // Uses sol2 for C++ <-> Lua bindings.
+//
+// A sol::state is not thread-safe, so generation uses one engine per thread
+// (forCurrentThread): asset loading and template pre-generation fan out over
+// JobSystem workers, each with its own sandboxed VM. Every script run gets a
+// fresh environment and a reseeded math.random, so the output depends only on
+// (script, params, seed) -- not on which worker ran it or what ran before.
 
 #include "assets/IAssetGenerator.h"
 
@@ -31,6 +37,10 @@ class LuaEngine {
 	LuaEngine(LuaEngine&&) noexcept;
 	LuaEngine& operator=(LuaEngine&&) noexcept;
 
+	/// The calling thread's engine, created and initialized on first use and
+	/// destroyed when the thread exits. Check isInitialized() before use.
+	static LuaEngine& forCurrentThread();
+
 	/// Initialize the Lua state and register API bindings
 	/// @return true if initialization succeeded
 	bool initialize();
@@ -61,7 +71,12 @@ class LuaEngine {
 	/// Set up a sandboxed environment for script execution
 	void setupSandbox();
 
+	// Compiled chunks by script path, reused while the file's text is unchanged
+	// (defined in the .cpp to keep sol2 out of this header)
+	struct ScriptCache;
+
 	std::unique_ptr<sol::state> m_lua;
+	std::unique_ptr<ScriptCache> m_scripts;
 	bool m_initialized = false;
 	std::string m_lastError;
 };
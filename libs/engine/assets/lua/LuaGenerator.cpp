@@ -17,18 +17,15 @@ LuaGenerator::LuaGenerator(std::string scriptPath)
 }
 
 bool LuaGenerator::generate(const GenerationContext& ctx, const GeneratorParams& params, GeneratedAsset& out) {
-	// Lazy initialization of Lua engine
-	if (!m_initialized) {
-		if (!m_engine.initialize()) {
-			LOG_ERROR(Engine, "Failed to initialize Lua engine for generator: %s", m_name.c_str());
-			return false;
-		}
-		m_initialized = true;
+	LuaEngine& engine = LuaEngine::forCurrentThread();
+	if (!engine.isInitialized()) {
+		LOG_ERROR(Engine, "Failed to initialize Lua engine for generator: %s", m_name.c_str());
+		return false;
 	}
 
 	// Execute the script
-	if (!m_engine.executeGenerator(m_scriptPath, ctx, params, out)) {
-		LOG_ERROR(Engine, "Lua script execution failed: %s - %s", m_scriptPath.c_str(), m_engine.getLastError().c_str());
+	if (!engine.executeGenerator(m_scriptPath, ctx, params, out)) {
+		LOG_ERROR(Engine, "Lua script execution failed: %s - %s", m_scriptPath.c_str(), engine.getLastError().c_str());
 		return false;
 	}
 
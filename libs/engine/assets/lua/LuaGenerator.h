@@ -12,7 +12,9 @@
 namespace engine::assets {
 
 /// Generator that executes Lua scripts for procedural asset generation.
-/// Each LuaGenerator instance is associated with a specific script path.
+/// Each LuaGenerator instance is associated with a specific script path and is
+/// cheap to construct: scripts run on the calling thread's LuaEngine
+/// (LuaEngine::forCurrentThread), so generators may be used from any thread.
 class LuaGenerator : public IAssetGenerator {
   public:
 	/// Create a Lua generator for a specific script
@@ -20,14 +22,6 @@ class LuaGenerator : public IAssetGenerator {
 	explicit LuaGenerator(std::string scriptPath);
 	~LuaGenerator() override = default;
 
-	// Non-copyable (owns LuaEngine)
-	LuaGenerator(const LuaGenerator&) = delete;
-	LuaGenerator& operator=(const LuaGenerator&) = delete;
-
-	// Movable
-	LuaGenerator(LuaGenerator&&) noexcept = default;
-	LuaGenerator& operator=(LuaGenerator&&) noexcept = default;
-
 	/// Generate an asset by executing the Lua script
 	bool generate(const GenerationContext& ctx, const GeneratorParams& params, GeneratedAsset& out) override;
 
@@ -46,8 +40,6 @@ class LuaGenerator : public IAssetGenerator {
   private:
 	std::string m_scriptPath;
 	std::string m_name;
-	LuaEngine m_engine;
-	bool m_initialized = false;
 };
 
 /// Factory function type for creating Lua generators
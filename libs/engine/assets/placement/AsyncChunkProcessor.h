@@ -12,6 +12,7 @@
 
 #include <assets/AssetRegistry.h>
 
+#include <threading/JobSystem.h>
 #include <utils/Log.h>
 #include <world/chunk/Chunk.h>
 #include <world/chunk/ChunkCoordinate.h>
@@ -76,6 +77,19 @@ namespace engine::assets {
 			  m_worldSeed(worldSeed),
 			  m_processedChunks(processedChunks) {}
 
+		/// Blocks until in-flight tasks finish: they reference m_executor, and
+		/// JobSystem futures (unlike std::async's) do not block on destruction.
+		~AsyncChunkProcessor() {
+			for (auto& [coord, future] : m_pendingFutures) {
+				if (future.valid()) {
+					future.wait();
+				}
+			}
+		}
+
+		AsyncChunkProcessor(const AsyncChunkProcessor&) = delete;
+		AsyncChunkProcessor& operator=(const AsyncChunkProcessor&) = delete;
+
 		/// Launch an async task for a single chunk
 		/// @param chunk The chunk to process
 		void launchTask(const world::Chunk* chunk) {
@@ -103,40 +117,44 @@ namespace engine::assets {
 			auto*	 executor = &m_executor;
 			uint64_t seed = m_worldSeed;
 
-			auto future = std::async(std::launch::async, [executor, seed, chunkData = std::move(chunkData)]() {
-				ChunkPlacementContext ctx;
-				ctx.coord = chunkData.coord;
-				ctx.worldSeed = seed;
-				ctx.getBiome = [&chunkData](uint16_t x, uint16_t y) {
-					return chunkData.biomes[y * world::kChunkSize + x];
-				};
-				ctx.getSurface = [&chunkData](uint16_t x, uint16_t y) {
-					return world::surfaceToString(chunkData.surfaces[y * world::kChunkSize + x]);
-				};
-
-				ChunkTaskResult result;
-				result.placement = executor->computeChunkEntities(ctx, executor);
-
-				// Bake the entity meshes here on the worker: the entity list is
-				// task-local and AssetRegistry::getTemplate is thread-safe, so the
-				// render thread only has to upload the finished arrays.
-				std::vector<const PlacedEntity*> entityPtrs;
-				entityPtrs.reserve(result.placement.entities.size());
-				for (const auto& entity : result.placement.entities) {
-					entityPtrs.push_back(&entity);
-				}
-				result.bakedMesh = world::bakeChunkEntities(
-					entityPtrs, chunkData.coord,
-					[](const std::string& defName) -> const renderer::TessellatedMesh* {
-						if (world::isGroundcoverDef(defName)) {
-							return nullptr; // groundcover renders via the instanced path, not baking
-						}
-						return AssetRegistry::Get().getTemplate(defName);
+			// Background: tiles (High) should land before their decorations.
+			auto future = foundation::JobSystem::shared().submit(
+				[executor, seed, chunkData = std::move(chunkData)]() {
+					ChunkPlacementContext ctx;
+					ctx.coord = chunkData.coord;
+					ctx.worldSeed = seed;
+					ctx.getBiome = [&chunkData](uint16_t x, uint16_t y) {
+						return chunkData.biomes[y * world::kChunkSize + x];
+					};
+					ctx.getSurface = [&chunkData](uint16_t x, uint16_t y) {
+						return world::surfaceToString(chunkData.surfaces[y * world::kChunkSize + x]);
+					};
+
+					ChunkTaskResult result;
+					result.placement = executor->computeChunkEntities(ctx, executor);
+
+					// Bake the entity meshes here on the worker: the entity list is
+					// task-local and AssetRegistry::getTemplate is thread-safe, so the
+					// render thread only has to upload the finished arrays.
+					std::vector<const PlacedEntity*> entityPtrs;
+					entityPtrs.reserve(result.placement.entities.size());
+					for (const auto& entity : result.placement.entities) {
+						entityPtrs.push_back(&entity);
 					}
-				);
+					result.bakedMesh = world::bakeChunkEntities(
+						entityPtrs, chunkData.coord,
+						[](const std::string& defName) -> const renderer::TessellatedMesh* {
+							if (world::isGroundcoverDef(defName)) {
+								return nullptr; // groundcover renders via the instanced path, not baking
+							}
+							return AssetRegistry::Get().getTemplate(defName);
+						}
+					);
 
-				return result;
-			});
+					return result;
+				},
+				foundation::JobPriority::Background
+			);
 
 			m_pendingFutures.emplace_back(coord, std::move(future));
 		}
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <tuple>
 
 namespace engine::assets {
 
@@ -818,6 +819,28 @@ namespace engine::assets {
 		}
 	}
 
+	std::vector<PlacementExecutor::CooldownRecord> PlacementExecutor::exportCooldowns() const {
+		std::vector<CooldownRecord> records;
+		records.reserve(m_cooldowns.size());
+		for (const auto& [key, remaining] : m_cooldowns) {
+			records.push_back(CooldownRecord{key.coord, key.tileX, key.tileY, key.defName, remaining});
+		}
+		std::sort(records.begin(), records.end(), [](const CooldownRecord& a, const CooldownRecord& b) {
+			return std::tie(a.coord.x, a.coord.y, a.tileX, a.tileY, a.defName) <
+				   std::tie(b.coord.x, b.coord.y, b.tileX, b.tileY, b.defName);
+		});
+		return records;
+	}
+
+	void PlacementExecutor::restoreCooldowns(const std::vector<CooldownRecord>& records) {
+		m_cooldowns.clear();
+		for (const auto& record : records) {
+			if (record.remainingSeconds > 0.0F) {
+				m_cooldowns[CooldownKey{record.coord, record.tileX, record.tileY, record.defName}] = record.remainingSeconds;
+			}
+		}
+	}
+
 	void PlacementExecutor::initResourceCount(world::ChunkCoordinate coord, glm::vec2 position,
 											  const std::string& defName, uint32_t count) {
 		auto key = makeCooldownKey(coord, position, defName);
@@ -175,6 +175,22 @@ namespace engine::assets {
 		/// @param deltaTime Time elapsed since last update
 		void updateCooldowns(float deltaTime);
 
+		/// A running regrowth cooldown, as saved to disk. Position is already
+		/// quantized to the tile the cooldown is keyed on.
+		struct CooldownRecord {
+			world::ChunkCoordinate coord;
+			int32_t				   tileX = 0;
+			int32_t				   tileY = 0;
+			std::string			   defName;
+			float				   remainingSeconds = 0.0F;
+		};
+
+		/// All running cooldowns, in a stable order (chunk, tile, defName)
+		[[nodiscard]] std::vector<CooldownRecord> exportCooldowns() const;
+
+		/// Replace the running cooldowns with saved ones (expired entries are skipped)
+		void restoreCooldowns(const std::vector<CooldownRecord>& records);
+
 		/// Initialize resource count for an entity (called during spawn)
 		/// @param coord Chunk coordinate containing the entity
 		/// @param position World position of the entity
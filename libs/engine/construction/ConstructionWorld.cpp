@@ -790,6 +790,45 @@ namespace engine::construction {
 		return true;
 	}
 
+	ConstructionTables ConstructionWorld::exportTables() const {
+		ConstructionTables tables;
+		tables.foundations = foundations_;
+		tables.vertices = vertices_;
+		tables.segments = segments_;
+		tables.openings = openings_;
+		tables.nextFoundationId = nextFoundationId_;
+		tables.nextVertexId = nextVertexId_;
+		tables.nextSegmentId = nextSegmentId_;
+		tables.nextOpeningId = nextOpeningId_;
+		return tables;
+	}
+
+	void ConstructionWorld::restoreTables(ConstructionTables tables) {
+		// A hand-edited or truncated save must not hand out a live id again.
+		for (const auto& foundation : tables.foundations) {
+			tables.nextFoundationId = std::max(tables.nextFoundationId, foundation.id + 1);
+		}
+		for (const auto& vertex : tables.vertices) {
+			tables.nextVertexId = std::max(tables.nextVertexId, vertex.id + 1);
+		}
+		for (const auto& segment : tables.segments) {
+			tables.nextSegmentId = std::max(tables.nextSegmentId, segment.id + 1);
+		}
+		for (const auto& opening : tables.openings) {
+			tables.nextOpeningId = std::max(tables.nextOpeningId, opening.id + 1);
+		}
+
+		foundations_ = std::move(tables.foundations);
+		vertices_ = std::move(tables.vertices);
+		segments_ = std::move(tables.segments);
+		openings_ = std::move(tables.openings);
+		nextFoundationId_ = tables.nextFoundationId;
+		nextVertexId_ = tables.nextVertexId;
+		nextSegmentId_ = tables.nextSegmentId;
+		nextOpeningId_ = tables.nextOpeningId;
+		++version_;
+	}
+
 	Foundation* ConstructionWorld::find(FoundationId id) {
 		const auto it = std::find_if(foundations_.begin(), foundations_.end(), [id](const Foundation& f) { return f.id == id; });
 		return it == foundations_.end() ? nullptr : &*it;
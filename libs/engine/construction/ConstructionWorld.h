@@ -184,6 +184,20 @@ namespace engine::construction {
 		bool ok() const { return status == SegmentStatus::Ok; }
 	};
 
+	// The whole store as plain tables, for save/load: every record in its
+	// stable order plus the id counters, so ids issued after a load never
+	// collide with saved ones.
+	struct ConstructionTables {
+		std::vector<Foundation>	 foundations;
+		std::vector<Vertex>		 vertices;
+		std::vector<WallSegment> segments;
+		std::vector<Opening>	 openings;
+		FoundationId			 nextFoundationId = 1;
+		VertexId				 nextVertexId = 1;
+		SegmentId				 nextSegmentId = 1;
+		OpeningId				 nextOpeningId = 1;
+	};
+
 	class ConstructionWorld {
 	  public:
 		// --- Construction ---------------------------------------------------
@@ -354,6 +368,16 @@ namespace engine::construction {
 		// it and rebuild when it moves. Pure queries never bump it.
 		std::uint64_t version() const { return version_; }
 
+		// --- Save/load ------------------------------------------------------
+
+		ConstructionTables exportTables() const;
+
+		// Replace the whole store with saved tables. The records were validated
+		// when first committed, so they are adopted as-is; only the counters are
+		// raised past the largest id present. Bumps the version, which is what
+		// makes nav, rooms and rendering rebuild against the loaded topology.
+		void restoreTables(ConstructionTables tables);
+
 	  private:
 		Foundation*		  find(FoundationId id);
 		const Foundation* find(FoundationId id) const;
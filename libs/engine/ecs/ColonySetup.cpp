@@ -0,0 +1,402 @@
+#include "ColonySetup.h"
+
+#include "World.h"
+#include "components/Action.h"
+#include "components/AgentRadius.h"
+#include "components/AnimationState.h"
+#include "components/Appearance.h"
+#include "components/Attributes.h"
+#include "components/Colonist.h"
+#include "components/DecisionTrace.h"
+#include "components/FacingDirection.h"
+#include "components/Inventory.h"
+#include "components/Knowledge.h"
+#include "components/Memory.h"
+#include "components/Movement.h"
+#include "components/Needs.h"
+#include "components/Packaged.h"
+#include "components/ResourceStack.h"
+#include "components/Skills.h"
+#include "components/StorageConfiguration.h"
+#include "components/StructureBlueprint.h"
+#include "components/StructureHealth.h"
+#include "components/Task.h"
+#include "components/Transform.h"
+#include "components/WorkQueue.h"
+#include "systems/AIDecisionSystem.h"
+#include "systems/ActionSystem.h"
+#include "systems/BuildGoalSystem.h"
+#include "systems/CollisionSystem.h"
+#include "systems/ConstructionSystem.h"
+#include "systems/CraftingGoalSystem.h"
+#include "systems/MovementSystem.h"
+#include "systems/NavigationSystem.h"
+#include "systems/NeedsDecaySystem.h"
+#include "systems/PhysicsSystem.h"
+#include "systems/ResourceLedgerSystem.h"
+#include "systems/RoomDetectionSystem.h"
+#include "systems/StaticRectCollisionSystem.h"
+#include "systems/StorageGoalSystem.h"
+#include "systems/TimeSystem.h"
+#include "systems/VisionSystem.h"
+#include "systems/WallCollisionSystem.h"
+
+#include <assets/AssetRegistry.h>
+#include <assets/ConstructionRegistry.h>
+#include <assets/RecipeRegistry.h>
+#include <assets/placement/PlacementExecutor.h>
+#include <construction/ConstructionWorld.h>
+#include <utils/Log.h>
+#include <world/chunk/ChunkCoordinate.h>
+
+#include <bit>
+#include <cmath>
+#include <random>
+#include <utility>
+
+namespace ecs {
+
+	namespace {
+		constexpr float kGoldenAngle = 2.39996323F; // ~137.5 deg, spreads successive aims evenly
+	}
+
+	void registerColonySystems(World& world, const ColonyWorldData& data, const ColonySystemOptions& options) {
+		auto& assetRegistry = engine::assets::AssetRegistry::Get();
+		auto& recipeRegistry = engine::assets::RecipeRegistry::Get();
+
+		// Registration order; each system's priority decides the run order
+		world.registerSystem<TimeSystem>();											   // 10 - runs first
+		world.registerSystem<VisionSystem>();										   // 45
+		world.registerSystem<NeedsDecaySystem>();									   // 50
+		world.registerSystem<ResourceLedgerSystem>();								   // 54 - storage counts for goals and AI
+		world.registerSystem<StorageGoalSystem>();									   // 55 - goals before AI
+		world.registerSystem<CraftingGoalSystem>();									   // 56 - goals before AI
+		world.registerSystem<BuildGoalSystem>();									   // 57 - goals before AI
+		world.registerSystem<ConstructionSystem>();									   // 58 - foundation lifecycle goals
+		world.registerSystem<RoomDetectionSystem>();								   // 59 - derive rooms from built walls
+		world.registerSystem<NavigationSystem>();									   // 51 - cached navmesh + path queries
+		world.registerSystem<AIDecisionSystem>(assetRegistry, recipeRegistry, options.aiSeed); // 60
+		world.registerSystem<MovementSystem>();										   // 100
+		world.registerSystem<PhysicsSystem>();										   // 200
+		world.registerSystem<CollisionSystem>();									   // 250 - positional separation after physics
+		world.registerSystem<WallCollisionSystem>();								   // 260 - wall safety-net after agent separation
+		world.registerSystem<StaticRectCollisionSystem>();							   // 270 - flora-rect safety-net after wall collision
+		world.registerSystem<ActionSystem>(options.actionSeed);						   // 350
+
+		auto& vision = world.getSystem<VisionSystem>();
+		vision.setPlacementData(data.placementExecutor, data.processedChunks);
+		vision.setChunkManager(data.chunkManager);
+
+		// The simulation area is pushed per frame by the caller (it owns the camera or stand-in)
+		auto& nav = world.getSystem<NavigationSystem>();
+		nav.setChunkManager(data.chunkManager);
+		nav.setPlacementData(data.placementExecutor, data.processedChunks);
+
+		world.getSystem<StaticRectCollisionSystem>().setPlacementData(data.placementExecutor);
+		world.getSystem<ConstructionSystem>().setPlacementData(data.placementExecutor, data.processedChunks);
+
+		// AI resolves a navmesh route for every move; with no route the colonist holds or stops.
+		// Only a selected colonist's full option list is ever displayed, so keep just the winner.
+		auto& ai = world.getSystem<AIDecisionSystem>();
+		ai.setChunkManager(data.chunkManager);
+		ai.setNavigationSystem(&nav);
+		ai.setEvaluationBudget(options.aiBudgetMicros);
+		ai.setFullTraces(false);
+	}
+
+	void setColonyConstructionWorld(World& world, engine::construction::ConstructionWorld* constructionWorld) {
+		world.getSystem<ConstructionSystem>().setConstructionWorld(constructionWorld);
+		world.getSystem<NavigationSystem>().setConstructionWorld(constructionWorld);
+		world.getSystem<VisionSystem>().setConstructionWorld(constructionWorld);
+		world.getSystem<WallCollisionSystem>().setConstructionWorld(constructionWorld);
+		world.getSystem<RoomDetectionSystem>().setConstructionWorld(constructionWorld);
+	}
+
+	void wireColonyCallbacks(World& world, engine::assets::PlacementExecutor& placement, DeferredEntityChanges& deferred) {
+		auto& nav = world.getSystem<NavigationSystem>();
+		auto& actions = world.getSystem<ActionSystem>();
+		auto& construction = world.getSystem<ConstructionSystem>();
+
+		// Every ground drop snaps to a walkable nav point, so a drop whose raw origin sits in a
+		// river or off-mesh lands on solid ground. No mesh over the origin -> keep the origin,
+		// so a drop never hard-fails.
+		auto snapDropToGround = [&nav](float x, float y) {
+			return nav.findValidPositionNear({x, y}, 1.0F).value_or(glm::vec2{x, y});
+		};
+
+		actions.setDropItemCallback([&deferred, snapDropToGround](const std::string& defName, float x, float y) {
+			deferred.spawns.push_back({defName, snapDropToGround(x, y), 0, /*packaged=*/true, std::nullopt});
+		});
+
+		// Crafted furniture comes out packaged and auto-installs >= 1 m off the station; the aim
+		// turns by the golden angle per spawn so a queued run of boxes fans out. With no mesh at
+		// the station it falls back to a manual packaged drop ~2 m off the station.
+		actions.setSpawnPackagedAtCallback([&deferred, &nav](const std::string& defName, glm::vec2 stationPos) {
+			const float					   angle = static_cast<float>(deferred.packagedSpawnSeq++) * kGoldenAngle;
+			const std::optional<glm::vec2> target = nav.findValidPositionNear(stationPos, 1.0F, {std::cos(angle), std::sin(angle)});
+			if (target.has_value()) {
+				deferred.spawns.push_back({defName, *target, 0, /*packaged=*/true, target});
+			} else {
+				deferred.spawns.push_back({defName, stationPos + glm::vec2{2.0F, 0.0F}, 0, /*packaged=*/true, std::nullopt});
+			}
+		});
+
+		// Loose, immediately haulable piles: a fell's uncarried remainder, a cancelled site's materials
+		auto enqueueResourceDrop = [&deferred, snapDropToGround](const std::string& defName, float x, float y, uint32_t quantity) {
+			deferred.spawns.push_back({defName, snapDropToGround(x, y), quantity, /*packaged=*/false, std::nullopt});
+		};
+		actions.setDropResourceCallback(enqueueResourceDrop);
+		construction.setDropResourceCallback(enqueueResourceDrop);
+
+		// Destructive harvest. World-gen flora live only in the placement index; runtime-spawned
+		// harvestables are ECS entities the index misses, so the matching one is queued as well.
+		actions.setRemoveEntityCallback([&world, &placement, &deferred](const std::string& defName, float x, float y) {
+			const bool removedFromIndex = placement.removeEntity(engine::world::worldToChunk({x, y}), {x, y}, defName);
+
+			constexpr float kMatchEps = 0.25F;
+			for (auto [entity, position, appearance] : world.view<Position, Appearance>()) {
+				const glm::vec2 d = position.value - glm::vec2{x, y};
+				if (appearance.defName == defName && d.x * d.x + d.y * d.y <= kMatchEps * kMatchEps) {
+					deferred.removals.push_back(entity);
+					return;
+				}
+			}
+			if (!removedFromIndex) {
+				LOG_WARNING(Engine, "Failed to remove harvested entity %s at (%.1f, %.1f)", defName.c_str(), x, y);
+			}
+		});
+		actions.setRemoveEntityByIdCallback([&deferred](EntityID entity) { deferred.removals.push_back(entity); });
+
+		actions.setEntityCooldownCallback([&placement](const std::string& defName, float x, float y, float cooldownSeconds) {
+			placement.setEntityCooldown(engine::world::worldToChunk({x, y}), {x, y}, defName, cooldownSeconds);
+		});
+
+		// Withdraw from a harvestable's pool: how much was taken, and whether it is now empty
+		actions.setDecrementResourceCallback(
+			[&placement](const std::string& defName, float x, float y, uint32_t requested) -> ActionSystem::ResourceDraw {
+				const auto	   coord = engine::world::worldToChunk({x, y});
+				const uint32_t removed = placement.decrementResourceCount(coord, {x, y}, defName, requested);
+				const bool	   depleted = !placement.getResourceCount(coord, {x, y}, defName).has_value();
+				return {removed, depleted};
+			}
+		);
+	}
+
+	const Structure* completeStructure(World& world, engine::construction::ConstructionWorld& constructionWorld, EntityID blueprintEntity) {
+		const auto* structure = world.getComponent<Structure>(blueprintEntity);
+		if (structure == nullptr || structure->graphId == 0) {
+			return nullptr;
+		}
+		switch (structure->kind) {
+			case StructureKind::Wall:
+				constructionWorld.setSegmentState(structure->graphId, engine::construction::FoundationState::Built);
+				break;
+			case StructureKind::Opening:
+				constructionWorld.setOpeningState(structure->graphId, engine::construction::FoundationState::Built);
+				break;
+			case StructureKind::Foundation:
+			case StructureKind::Room:
+				constructionWorld.setState(structure->graphId, engine::construction::FoundationState::Built);
+				break;
+		}
+		return structure;
+	}
+
+	std::optional<StructureKind> tearDownStructure(
+		World& world, engine::construction::ConstructionWorld& constructionWorld, EntityID blueprintEntity, DeferredEntityChanges& deferred
+	) {
+		// Salvage a built structure's manifest. A no-work cancel already dumped 100% and cleared
+		// delivered[] at order time in ConstructionSystem, so it drops nothing here.
+		if (const auto* blueprint = world.getComponent<StructureBlueprint>(blueprintEntity);
+			blueprint != nullptr && !blueprint->delivered.empty()) {
+			const float		refundPercent = engine::assets::ConstructionRegistry::Get().constraints().refundPercent;
+			const auto*		position = world.getComponent<Position>(blueprintEntity);
+			const glm::vec2 dropPos = position != nullptr ? position->value : glm::vec2{0.0F, 0.0F};
+			for (const auto& [defName, qty] : blueprint->delivered) {
+				const auto salvageQty = static_cast<uint32_t>(std::floor(static_cast<float>(qty) * refundPercent / 100.0F));
+				if (salvageQty > 0) {
+					deferred.spawns.push_back({defName, dropPos, salvageQty, /*packaged=*/false, std::nullopt});
+				}
+			}
+		}
+
+		std::optional<StructureKind> kind;
+		if (const auto* structure = world.getComponent<Structure>(blueprintEntity); structure != nullptr && structure->graphId != 0) {
+			kind = structure->kind;
+			switch (structure->kind) {
+				case StructureKind::Opening:
+					constructionWorld.removeOpening(structure->graphId);
+					break;
+				case StructureKind::Wall: {
+					// The cascade should have torn the wall's openings down first; any survivor's
+					// mirror entity is queued too so removal stays leak-free.
+					std::vector<EntityID> removedOpeningEntities;
+					constructionWorld.removeSegment(structure->graphId, &removedOpeningEntities);
+					deferred.removals.insert(deferred.removals.end(), removedOpeningEntities.begin(), removedOpeningEntities.end());
+					break;
+				}
+				case StructureKind::Foundation:
+				case StructureKind::Room:
+					constructionWorld.removeFoundation(structure->graphId);
+					break;
+			}
+		}
+		deferred.removals.push_back(blueprintEntity);
+		return kind;
+	}
+
+	void drainDeferredEntityChanges(World& world, engine::assets::PlacementExecutor* placement, DeferredEntityChanges& deferred) {
+		for (EntityID entity : deferred.removals) {
+			world.destroyEntity(entity);
+		}
+		deferred.removals.clear();
+
+		// Swap out first: a spawn never re-enters the callbacks, but keep the loop safe anyway
+		std::vector<DeferredEntityChanges::Spawn> spawns;
+		spawns.swap(deferred.spawns);
+		for (const auto& spawn : spawns) {
+			if (spawn.packaged) {
+				const EntityID entity = spawnPlacedEntity(world, placement, spawn.defName, spawn.targetPosition.value_or(spawn.at));
+				Packaged	   packaged;
+				packaged.targetPosition = spawn.targetPosition;
+				world.addComponent<Packaged>(entity, packaged);
+			} else {
+				dropResourcePiles(world, placement, spawn.defName, spawn.at, spawn.quantity);
+			}
+		}
+	}
+
+	EntityID spawnColonist(World& world, glm::vec2 position, const std::string& name) {
+		const EntityID entity = world.createEntity();
+		world.addComponent<Position>(entity, Position{position});
+		world.addComponent<Rotation>(entity, Rotation{0.0F});
+		world.addComponent<Velocity>(entity, Velocity{{0.0F, 0.0F}});
+		world.addComponent<MovementTarget>(entity, MovementTarget{{0.0F, 0.0F}, 2.0F, false});
+		world.addComponent<FacingDirection>(entity, FacingDirection{}); // Default: Down
+		world.addComponent<AnimationState>(entity, AnimationState{});	 // Walk-cycle phase
+		world.addComponent<Appearance>(entity, Appearance{"Colonist", 1.0F, {1.0F, 1.0F, 1.0F, 1.0F}});
+		world.addComponent<Colonist>(entity, Colonist{name});
+		world.addComponent<NeedsComponent>(entity, NeedsComponent::createDefault());
+
+		// Static attributes (0-20), seeded per entity so colonists vary deterministically. Only
+		// Strength is consumed today: it sets hand-carry capacity.
+		Attributes	 attributes;
+		std::mt19937 attrRng(static_cast<uint32_t>(entity));
+		attributes.strength = std::uniform_real_distribution<float>(6.0F, 14.0F)(attrRng);
+		world.addComponent<Attributes>(entity, attributes);
+
+		// Carry weight scales with Strength (an average colonist lands at 35 kg)
+		auto inventory = Inventory::createForColonist();
+		inventory.carryCapacityKg = Attributes::carryCapacityKg(attributes.strength);
+		world.addComponent<Inventory>(entity, std::move(inventory));
+		world.addComponent<Knowledge>(entity, Knowledge{});
+		world.addComponent<Memory>(entity, Memory{.owner = entity});
+		world.addComponent<Task>(entity, Task{});
+		world.addComponent<DecisionTrace>(entity, DecisionTrace{});
+		world.addComponent<Action>(entity, Action{});
+		world.addComponent<AgentRadius>(entity, AgentRadius{});
+
+		// Starting skills (0-20, see SkillLevels); Medicine stays untrained
+		Skills skills;
+		skills.setLevel("Farming", 3.0F);
+		skills.setLevel("Crafting", 2.0F);
+		skills.setLevel("Construction", 1.0F);
+		world.addComponent<Skills>(entity, std::move(skills));
+		return entity;
+	}
+
+	EntityID spawnPlacedEntity(World& world, engine::assets::PlacementExecutor* placement, const std::string& defName, glm::vec2 position) {
+		const EntityID entity = world.createEntity();
+		world.addComponent<Position>(entity, Position{position});
+		world.addComponent<Rotation>(entity, Rotation{0.0F});
+		world.addComponent<Appearance>(entity, Appearance{defName, 1.0F, {1.0F, 1.0F, 1.0F, 1.0F}});
+
+		const auto* def = engine::assets::AssetRegistry::Get().getDefinition(defName);
+		if (def == nullptr) {
+			return entity;
+		}
+		if (def->capabilities.craftable.has_value()) {
+			// A station: colonists haul recipe inputs into its material store, the Craft action consumes them
+			world.addComponent<WorkQueue>(entity, WorkQueue{});
+			world.addComponent<Inventory>(entity, Inventory::createForStorage());
+		} else if (def->capabilities.storage.has_value()) {
+			// A container accepts every category it supports (empty list = everything)
+			const auto& storageCap = def->capabilities.storage.value();
+			Inventory	inventory{};
+			inventory.maxCapacity = storageCap.maxCapacity; // slot count; per-stack cap is each item's own stackSize
+			world.addComponent<Inventory>(entity, inventory);
+			world.addComponent<StorageConfiguration>(
+				entity,
+				storageCap.acceptedCategories.empty() ? StorageConfiguration::createAcceptEverything()
+													  : StorageConfiguration::createAcceptAll(storageCap.acceptedCategories)
+			);
+		}
+
+		// Seed a harvestable's resource pool like chunk placement does. Position-seeded from the
+		// raw IEEE-754 bits (std::hash<float> is implementation-defined), so a spot rolls the
+		// same amount on every run and platform.
+		if (placement != nullptr && def->capabilities.harvestable.has_value()) {
+			const auto& harv = def->capabilities.harvestable.value();
+			if (harv.totalResourceMin > 0 && harv.totalResourceMax > 0) {
+				const uint32_t bx = std::bit_cast<uint32_t>(position.x);
+				const uint32_t by = std::bit_cast<uint32_t>(position.y);
+				std::mt19937   rng((bx * 0x9E3779B9U) ^ (by + 0x85EBCA6BU + (bx << 6) + (bx >> 2)));
+				std::uniform_int_distribution<uint32_t> dist(harv.totalResourceMin, harv.totalResourceMax);
+				placement->initResourceCount(engine::world::worldToChunk({position.x, position.y}), position, defName, dist(rng));
+			}
+		}
+		return entity;
+	}
+
+	void dropResourcePiles(
+		World& world, engine::assets::PlacementExecutor* placement, const std::string& defName, glm::vec2 at, uint32_t quantity
+	) {
+		const auto*	   def = engine::assets::AssetRegistry::Get().getDefinition(defName);
+		const uint32_t cap = (def != nullptr && def->itemProperties.has_value()) ? def->itemProperties->stackSize : UINT32_MAX;
+		for (const auto& [pos, qty] : resourcePileDrops(cap, quantity, at)) {
+			const EntityID entity = spawnPlacedEntity(world, placement, defName, pos);
+			world.addComponent<ResourceStack>(entity, ResourceStack{qty});
+		}
+	}
+
+	EntityID spawnFoundationBlueprint(
+		World&									 world,
+		engine::construction::ConstructionWorld& constructionWorld,
+		uint64_t								 foundationId,
+		glm::vec2								 position,
+		const std::string&						 material
+	) {
+		if (constructionWorld.get(foundationId) == nullptr) {
+			return kInvalidEntity;
+		}
+		const float area = constructionWorld.areaSquareMeters(foundationId);
+
+		// The manifest defName IS the material name: construction config keys materials by
+		// name and the haul chain resolves items by that same name.
+		const auto* mat = engine::assets::ConstructionRegistry::Get().getMaterial(material);
+		const float costRate = mat != nullptr ? mat->costRatePerSquareMeter : 0.0F;
+		const float workRate = mat != nullptr ? mat->workRatePerSquareMeter : 0.0F;
+		const float hpRate = mat != nullptr ? mat->hp : 0.0F;
+
+		const EntityID entity = world.createEntity();
+		world.addComponent<Position>(entity, Position{position});
+		world.addComponent<Structure>(entity, Structure{StructureKind::Foundation, foundationId});
+
+		StructureBlueprint blueprint;
+		blueprint.phase = StructureBlueprint::BuildPhase::Clearing;
+		const auto requiredQty = static_cast<uint32_t>(std::ceil(static_cast<double>(area) * static_cast<double>(costRate)));
+		if (requiredQty > 0) {
+			blueprint.required.emplace_back(material, requiredQty);
+		}
+		blueprint.workTotal = area * workRate;
+		world.addComponent<StructureBlueprint>(entity, std::move(blueprint));
+
+		// HP scales with area; the component exists from creation, full HP matters once built
+		const float maxHp = area * hpRate;
+		world.addComponent<StructureHealth>(entity, StructureHealth{maxHp, maxHp});
+
+		constructionWorld.setEntity(foundationId, entity);
+		return entity;
+	}
+
+} // namespace ecs
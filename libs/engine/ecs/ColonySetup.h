@@ -0,0 +1,130 @@
+#pragma once
+
+// ColonySetup - the one place a colony ecs::World is assembled.
+//
+// GameScene (the live game) and sim-bench's SimHarness (headless benchmarks and
+// replays) both build their world through these functions, so the systems, their
+// order, the cross-system callbacks and the spawned component sets cannot drift
+// apart between the two. What stays with each caller is what only it has: render
+// systems, UI toasts and logging, selection and camera state.
+//
+// Spawns and removals requested from inside a system's view loop never touch the
+// component pools there: the wired callbacks queue them in DeferredEntityChanges,
+// and the caller drains the queue after each tick (drainDeferredEntityChanges).
+
+#include "EntityID.h"
+#include "components/Structure.h"
+
+#include <world/chunk/ChunkCoordinate.h>
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace engine::assets {
+	class PlacementExecutor;
+}
+
+namespace engine::construction {
+	class ConstructionWorld;
+}
+
+namespace engine::world {
+	class ChunkManager;
+}
+
+namespace ecs {
+
+	class World;
+
+	/// Caller-owned data the colony systems read besides the World itself.
+	struct ColonyWorldData {
+		engine::world::ChunkManager*							  chunkManager = nullptr;
+		engine::assets::PlacementExecutor*						  placementExecutor = nullptr;
+		const std::unordered_set<engine::world::ChunkCoordinate>* processedChunks = nullptr;
+	};
+
+	struct ColonySystemOptions {
+		std::optional<uint32_t> aiSeed;			 // AIDecisionSystem RNG (nullopt = random_device)
+		std::optional<uint32_t> actionSeed;		 // ActionSystem RNG (nullopt = random_device)
+		uint32_t				aiBudgetMicros = 0; // AIDecisionSystem::setEvaluationBudget (0 = unbounded)
+	};
+
+	/// Drops and removals queued by the wired callbacks, applied after the tick.
+	struct DeferredEntityChanges {
+		struct Spawn {
+			std::string defName;
+			glm::vec2	at{0.0F, 0.0F};
+			uint32_t	quantity = 0; // resource-pile count; unused for packaged items
+			bool		packaged = false;
+			// Auto-place target for a packaged spawn (a crafted furniture box): the entity
+			// spawns here with Packaged.targetPosition set, so BuildGoalSystem raises the
+			// place goal at once. nullopt -> spawn at `at` and await a [Place] click.
+			std::optional<glm::vec2> targetPosition;
+		};
+
+		std::vector<Spawn>	  spawns;
+		std::vector<EntityID> removals;
+		uint32_t			  packagedSpawnSeq = 0; // rotates the aim so a run of crafted boxes fans out
+	};
+
+	/// Register the simulation systems in priority order and wire their placement,
+	/// chunk and AI settings. Render systems are left to the caller.
+	void registerColonySystems(World& world, const ColonyWorldData& data, const ColonySystemOptions& options = {});
+
+	/// Hand the topology store to every system that reads it: vision occlusion, the
+	/// navmesh input, wall collision, blueprint lifecycle and room detection.
+	void setColonyConstructionWorld(World& world, engine::construction::ConstructionWorld* constructionWorld);
+
+	/// Wire ActionSystem's and ConstructionSystem's drop, removal and resource-pool
+	/// callbacks. Every drop snaps to walkable ground first; spawns and removals are
+	/// queued in `deferred`. The structure lifecycle callbacks stay with the caller
+	/// (see completeStructure / tearDownStructure).
+	void wireColonyCallbacks(World& world, engine::assets::PlacementExecutor& placement, DeferredEntityChanges& deferred);
+
+	/// Flip a finished blueprint's topology record to Built. Returns the structure, or
+	/// nullptr if the entity has no topology link.
+	const Structure* completeStructure(World& world, engine::construction::ConstructionWorld& constructionWorld, EntityID blueprintEntity);
+
+	/// Finish a deconstruction: queue refundPercent% of a built structure's delivered
+	/// materials as piles, drop the topology record (a wall's surviving openings are
+	/// queued for removal too) and queue the entity itself. Returns the structure kind,
+	/// or nullopt if the entity had no topology link.
+	std::optional<StructureKind> tearDownStructure(
+		World& world, engine::construction::ConstructionWorld& constructionWorld, EntityID blueprintEntity, DeferredEntityChanges& deferred
+	);
+
+	/// Destroy the queued removals, then spawn the queued drops. Call after each tick.
+	void drainDeferredEntityChanges(World& world, engine::assets::PlacementExecutor* placement, DeferredEntityChanges& deferred);
+
+	/// A colonist with the full component set: needs, inventory sized by a Strength
+	/// roll seeded from the entity id, memory, AI task/action state and starting skills.
+	EntityID spawnColonist(World& world, glm::vec2 position, const std::string& name);
+
+	/// A placed asset: Appearance plus the components its definition's capabilities
+	/// call for (a station's WorkQueue and material store, a container's Inventory and
+	/// StorageConfiguration). A harvestable's resource pool is seeded from its position.
+	EntityID spawnPlacedEntity(World& world, engine::assets::PlacementExecutor* placement, const std::string& defName, glm::vec2 position);
+
+	/// Loose, haulable ResourceStack piles, split at the item's stackSize (resourcePileDrops).
+	void dropResourcePiles(
+		World& world, engine::assets::PlacementExecutor* placement, const std::string& defName, glm::vec2 at, uint32_t quantity
+	);
+
+	/// The Clearing-phase blueprint for a committed foundation footprint: its Structure link,
+	/// a manifest, work and HP priced from the material's per-m2 rates, and the topology
+	/// record pointed back at the entity. `position` should sit inside the footprint (the
+	/// centroid). Returns kInvalidEntity if `foundationId` isn't in the store.
+	EntityID spawnFoundationBlueprint(
+		World&									 world,
+		engine::construction::ConstructionWorld& constructionWorld,
+		uint64_t								 foundationId,
+		glm::vec2								 position,
+		const std::string&						 material
+	);
+
+} // namespace ecs
@@ -0,0 +1,143 @@
+// Tests for ColonySetup's spawn helpers and the deferred drop/removal drain that
+// GameScene and sim-bench both run after each tick.
+
+#include "ColonySetup.h"
+
+#include "World.h"
+#include "components/Appearance.h"
+#include "components/Inventory.h"
+#include "components/Packaged.h"
+#include "components/ResourceStack.h"
+#include "components/StorageConfiguration.h"
+#include "components/Structure.h"
+#include "components/StructureBlueprint.h"
+#include "components/StructureHealth.h"
+#include "components/Transform.h"
+
+#include <assets/AssetRegistry.h>
+#include <construction/ConstructionWorld.h>
+
+#include <gtest/gtest.h>
+
+namespace ecs::test {
+
+	class ColonySetupTest : public ::testing::Test {
+	  protected:
+		void SetUp() override {
+			auto& registry = engine::assets::AssetRegistry::Get();
+
+			engine::assets::AssetDefinition stone;
+			stone.defName = "Stone";
+			stone.label = "Stone";
+			stone.category = engine::assets::ItemCategory::RawMaterial;
+			stone.itemProperties = engine::assets::ItemProperties{};
+			stone.itemProperties->stackSize = 10;
+			registry.registerTestDefinition(std::move(stone));
+
+			engine::assets::AssetDefinition crate;
+			crate.defName = "Crate";
+			crate.label = "Crate";
+			crate.capabilities.storage = engine::assets::StorageCapability{};
+			crate.capabilities.storage->maxCapacity = 4;
+			registry.registerTestDefinition(std::move(crate));
+
+			world = std::make_unique<World>();
+		}
+
+		void TearDown() override {
+			world.reset();
+			engine::assets::AssetRegistry::Get().clearDefinitions();
+		}
+
+		size_t countWith(const std::string& defName) {
+			size_t count = 0;
+			for (auto [entity, appearance] : world->view<Appearance>()) {
+				count += appearance.defName == defName ? 1U : 0U;
+			}
+			return count;
+		}
+
+		std::unique_ptr<World> world;
+	};
+
+	TEST_F(ColonySetupTest, ColonistAttributesAreSeededByEntity) {
+		const EntityID a = spawnColonist(*world, {0.0F, 0.0F}, "A");
+		const EntityID b = spawnColonist(*world, {1.0F, 0.0F}, "B");
+		ASSERT_NE(world->getComponent<Inventory>(a), nullptr);
+		EXPECT_EQ(world->getComponent<Position>(b)->value, glm::vec2(1.0F, 0.0F));
+
+		// A fresh world hands out the same ids, so the same carry capacities
+		const float capacityA = world->getComponent<Inventory>(a)->carryCapacityKg;
+		world = std::make_unique<World>();
+		const EntityID again = spawnColonist(*world, {0.0F, 0.0F}, "A");
+		ASSERT_EQ(again, a);
+		EXPECT_FLOAT_EQ(world->getComponent<Inventory>(again)->carryCapacityKg, capacityA);
+	}
+
+	TEST_F(ColonySetupTest, StorageAssetGetsInventoryAndConfig) {
+		const EntityID crate = spawnPlacedEntity(*world, nullptr, "Crate", {2.0F, 3.0F});
+		ASSERT_NE(world->getComponent<Inventory>(crate), nullptr);
+		EXPECT_EQ(world->getComponent<Inventory>(crate)->maxCapacity, 4U);
+		EXPECT_NE(world->getComponent<StorageConfiguration>(crate), nullptr);
+
+		const EntityID unknown = spawnPlacedEntity(*world, nullptr, "NoSuchDef", {0.0F, 0.0F});
+		EXPECT_EQ(world->getComponent<Inventory>(unknown), nullptr);
+	}
+
+	TEST_F(ColonySetupTest, DrainDestroysRemovalsThenSpawnsDrops) {
+		const EntityID doomed = spawnPlacedEntity(*world, nullptr, "Crate", {0.0F, 0.0F});
+
+		DeferredEntityChanges deferred;
+		deferred.removals.push_back(doomed);
+		deferred.spawns.push_back({"Stone", {5.0F, 5.0F}, 25, /*packaged=*/false, std::nullopt});
+		deferred.spawns.push_back({"Crate", {1.0F, 1.0F}, 0, /*packaged=*/true, glm::vec2{8.0F, 8.0F}});
+
+		drainDeferredEntityChanges(*world, nullptr, deferred);
+		EXPECT_TRUE(deferred.spawns.empty());
+		EXPECT_TRUE(deferred.removals.empty());
+		EXPECT_FALSE(world->isAlive(doomed));
+
+		// 25 stone at a stack size of 10: three piles
+		uint32_t piles = 0;
+		uint32_t total = 0;
+		for (auto [entity, stack] : world->view<ResourceStack>()) {
+			++piles;
+			total += stack.quantity;
+		}
+		EXPECT_EQ(piles, 3U);
+		EXPECT_EQ(total, 25U);
+
+		// The packaged crate spawns at its auto-place target, with the target kept
+		ASSERT_EQ(countWith("Crate"), 1U);
+		for (auto [entity, packaged, position] : world->view<Packaged, Position>()) {
+			EXPECT_EQ(position.value, glm::vec2(8.0F, 8.0F));
+			ASSERT_TRUE(packaged.targetPosition.has_value());
+			EXPECT_EQ(*packaged.targetPosition, glm::vec2(8.0F, 8.0F));
+		}
+	}
+
+	TEST_F(ColonySetupTest, FoundationBlueprintLinksBothWays) {
+		engine::construction::ConstructionWorld topology;
+		const std::vector<Foundation::Vec2> square = {{0.0F, 0.0F}, {4.0F, 0.0F}, {4.0F, 4.0F}, {0.0F, 4.0F}};
+		const auto							commit = topology.commitFoundation(square, "NoSuchMaterial");
+		ASSERT_TRUE(commit.ok());
+
+		const EntityID entity = spawnFoundationBlueprint(*world, topology, commit.id, {2.0F, 2.0F}, "NoSuchMaterial");
+		ASSERT_NE(entity, kInvalidEntity);
+		EXPECT_EQ(world->getComponent<Position>(entity)->value, glm::vec2(2.0F, 2.0F));
+		ASSERT_NE(world->getComponent<Structure>(entity), nullptr);
+		EXPECT_EQ(world->getComponent<Structure>(entity)->kind, StructureKind::Foundation);
+		EXPECT_EQ(world->getComponent<Structure>(entity)->graphId, commit.id);
+		EXPECT_EQ(topology.get(commit.id)->entity, entity);
+
+		// An unknown material prices to nothing rather than failing the spawn
+		const auto* blueprint = world->getComponent<StructureBlueprint>(entity);
+		ASSERT_NE(blueprint, nullptr);
+		EXPECT_EQ(blueprint->phase, StructureBlueprint::BuildPhase::Clearing);
+		EXPECT_TRUE(blueprint->required.empty());
+		EXPECT_NE(world->getComponent<StructureHealth>(entity), nullptr);
+
+		EXPECT_EQ(spawnFoundationBlueprint(*world, topology, commit.id + 100, {0.0F, 0.0F}, "Wood"), kInvalidEntity);
+	}
+
+} // namespace ecs::test
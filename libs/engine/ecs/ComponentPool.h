@@ -2,31 +2,47 @@
 
 #include "EntityID.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <typeindex>
 #include <vector>
 
 namespace ecs {
 
+	/// Logical clock for component change tracking. Writes are stamped with the
+	/// Registry's current tick; a consumer remembers the tick it last processed
+	/// and asks for everything stamped later. Tick 0 means "never".
+	using ChangeTick = uint32_t;
+
 	/// Type-erased base class for component storage
 	class IComponentPool {
 	  public:
 		virtual ~IComponentPool() = default;
-		virtual void				 remove(EntityID entity) = 0;
+		virtual void				 remove(EntityID entity, ChangeTick tick) = 0;
 		[[nodiscard]] virtual bool	 has(EntityID entity) const = 0;
 		[[nodiscard]] virtual size_t size() const = 0;
 	};
 
 	/// Sparse set component storage with O(1) add/remove/has operations.
 	/// Uses dense array for cache-friendly iteration.
+	///
+	/// Each dense slot carries the ticks it was added and last written at, and
+	/// removals are kept in a bounded log, so consumers can process only what
+	/// changed since they last looked. Adds and replacements stamp themselves;
+	/// in-place writes through a reference are only visible once marked with
+	/// markChanged().
 	template <typename T>
 	class ComponentPool : public IComponentPool {
 	  public:
-		/// Add component to entity, returning reference to the new component
+		/// Removal log entries kept before the oldest half is dropped
+		static constexpr size_t kMaxRemovedLog = 1024;
+
+		/// Add component to entity at `tick`, returning reference to the new component
 		template <typename... Args>
-		T& add(EntityID entity, Args&&... args) {
+		T& add(EntityID entity, ChangeTick tick, Args&&... args) {
 			uint32_t index = getIndex(entity);
 
 			// Ensure sparse array is large enough
@@ -34,21 +50,37 @@ namespace ecs {
 				sparseArray.resize(index + 1, kInvalidIndex);
 			}
 
+			lastWrite = tick;
+
 			// Check if entity already has component
 			if (sparseArray[index] != kInvalidIndex) {
-				// Replace existing component
-				denseArray[sparseArray[index]].component = T{std::forward<Args>(args)...};
-				return denseArray[sparseArray[index]].component;
+				// Replace existing component (a write, not an add)
+				DenseEntry& entry = denseArray[sparseArray[index]];
+				entry.component = T{std::forward<Args>(args)...};
+				entry.changedTick = tick;
+				return entry.component;
 			}
 
 			// Add new entry
 			size_t denseIndex = denseArray.size();
 			sparseArray[index] = static_cast<uint32_t>(denseIndex);
-			denseArray.push_back({entity, T{std::forward<Args>(args)...}});
+			denseArray.push_back({entity, T{std::forward<Args>(args)...}, tick, tick});
 
 			return denseArray.back().component;
 		}
 
+		/// Stamp an in-place write to the entity's component.
+		/// Returns false if the entity has no component in this pool.
+		bool markChanged(EntityID entity, ChangeTick tick) {
+			uint32_t index = getIndex(entity);
+			if (index >= sparseArray.size() || sparseArray[index] == kInvalidIndex) {
+				return false;
+			}
+			denseArray[sparseArray[index]].changedTick = tick;
+			lastWrite = tick;
+			return true;
+		}
+
 		/// Get component for entity, returns nullptr if not found
 		[[nodiscard]] T* get(EntityID entity) {
 			uint32_t index = getIndex(entity);
@@ -67,8 +99,8 @@ namespace ecs {
 			return &denseArray[sparseArray[index]].component;
 		}
 
-		/// Remove component from entity
-		void remove(EntityID entity) override {
+		/// Remove component from entity, logging the removal at `tick`
+		void remove(EntityID entity, ChangeTick tick) override {
 			uint32_t index = getIndex(entity);
 			if (index >= sparseArray.size() || sparseArray[index] == kInvalidIndex) {
 				return;
@@ -87,6 +119,15 @@ namespace ecs {
 
 			denseArray.pop_back();
 			sparseArray[index] = kInvalidIndex;
+
+			if (removedLog.size() >= kMaxRemovedLog) {
+				// Consumers further behind than the kept half must resync (removedSince returns false)
+				auto dropEnd = removedLog.begin() + static_cast<std::ptrdiff_t>(kMaxRemovedLog / 2);
+				removedLogFloor = std::prev(dropEnd)->tick;
+				removedLog.erase(removedLog.begin(), dropEnd);
+			}
+			removedLog.push_back({entity, tick});
+			lastWrite = tick;
 		}
 
 		/// Check if entity has this component
@@ -116,16 +157,78 @@ namespace ecs {
 			return denseArray[denseIndex].component;
 		}
 
+		// ─── Change tracking ───
+
+		/// Tick the component at dense index was added at
+		[[nodiscard]] ChangeTick getAddedTick(size_t denseIndex) const {
+			assert(denseIndex < denseArray.size());
+			return denseArray[denseIndex].addedTick;
+		}
+
+		/// Tick the component at dense index was last written at (adds count as writes)
+		[[nodiscard]] ChangeTick getChangedTick(size_t denseIndex) const {
+			assert(denseIndex < denseArray.size());
+			return denseArray[denseIndex].changedTick;
+		}
+
+		/// Tick the entity's component was last written at, 0 if it has none
+		[[nodiscard]] ChangeTick changedTickOf(EntityID entity) const {
+			uint32_t index = getIndex(entity);
+			if (index >= sparseArray.size() || sparseArray[index] == kInvalidIndex) {
+				return 0;
+			}
+			return denseArray[sparseArray[index]].changedTick;
+		}
+
+		/// Tick of the latest add, write or removal anywhere in the pool. An O(1)
+		/// "did anything happen" check before scanning.
+		[[nodiscard]] ChangeTick getLastWriteTick() const { return lastWrite; }
+
+		/// Append entities whose component was added after `since`
+		void addedSince(ChangeTick since, std::vector<EntityID>& out) const {
+			for (const auto& entry : denseArray) {
+				if (entry.addedTick > since) {
+					out.push_back(entry.entity);
+				}
+			}
+		}
+
+		/// Append entities whose component was removed after `since`, oldest first.
+		/// Returns false if the log no longer reaches back to `since`; the caller
+		/// missed removals and must rebuild from a full scan instead.
+		bool removedSince(ChangeTick since, std::vector<EntityID>& out) const {
+			if (since < removedLogFloor) {
+				return false;
+			}
+			auto first = std::upper_bound(removedLog.begin(), removedLog.end(), since, [](ChangeTick tick, const RemovedEntry& entry) {
+				return tick < entry.tick;
+			});
+			for (; first != removedLog.end(); ++first) {
+				out.push_back(first->entity);
+			}
+			return true;
+		}
+
 	  private:
 		static constexpr uint32_t kInvalidIndex = UINT32_MAX;
 
 		struct DenseEntry {
-			EntityID entity;
-			T		 component;
+			EntityID   entity;
+			T		   component;
+			ChangeTick addedTick;
+			ChangeTick changedTick;
+		};
+
+		struct RemovedEntry {
+			EntityID   entity;
+			ChangeTick tick;
 		};
 
-		std::vector<uint32_t>	sparseArray; // Entity index -> dense index
-		std::vector<DenseEntry> denseArray;	 // Packed component storage
+		std::vector<uint32_t>	  sparseArray; // Entity index -> dense index
+		std::vector<DenseEntry>	  denseArray;  // Packed component storage
+		std::vector<RemovedEntry> removedLog;  // Removals in tick order (bounded)
+		ChangeTick				  removedLogFloor = 0; // Newest tick dropped from removedLog
+		ChangeTick				  lastWrite = 0;
 	};
 
 } // namespace ecs
@@ -0,0 +1,129 @@
+#include "ComponentPool.h"
+#include "Registry.h"
+#include "View.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace ecs;
+
+namespace {
+
+	struct Health {
+		int value = 0;
+	};
+
+	struct Name {
+		int id = 0;
+	};
+
+	std::vector<EntityID> collect(View<Health> view) {
+		std::vector<EntityID> out;
+		for (auto [entity, health] : view) {
+			out.push_back(entity);
+		}
+		return out;
+	}
+
+} // namespace
+
+// ============================================================================
+// Change tracking: consumers remember the tick they last processed and see
+// exactly the adds, marked writes and removals stamped after it.
+// ============================================================================
+
+TEST(ChangeTrackingTests, ChangedSince_SeesAddsAndMarkedWritesOnce) {
+	Registry registry;
+	EntityID a = registry.createEntity();
+	EntityID b = registry.createEntity();
+	registry.addComponent<Health>(a, 10);
+	registry.addComponent<Health>(b, 20);
+
+	ChangeTick seen = registry.takeChangeTick();
+	EXPECT_EQ(collect(View<Health>(registry).changedSince(0)).size(), 2U);
+	EXPECT_TRUE(collect(View<Health>(registry).changedSince(seen)).empty());
+
+	// Unmarked in-place writes are invisible; marked ones show up
+	registry.getComponent<Health>(a)->value = 11;
+	EXPECT_FALSE(registry.anyChangedSince<Health>(seen));
+	registry.getComponent<Health>(b)->value = 21;
+	EXPECT_TRUE(registry.markChanged<Health>(b));
+	EXPECT_EQ(collect(View<Health>(registry).changedSince(seen)), std::vector<EntityID>{b});
+
+	seen = registry.takeChangeTick();
+	EXPECT_FALSE(registry.anyChangedSince<Health>(seen));
+}
+
+TEST(ChangeTrackingTests, ChangedSince_MultiComponentViewMatchesAnyChangedComponent) {
+	Registry registry;
+	EntityID a = registry.createEntity();
+	EntityID b = registry.createEntity();
+	registry.addComponent<Health>(a, 1);
+	registry.addComponent<Name>(a, 1);
+	registry.addComponent<Health>(b, 2);
+	registry.addComponent<Name>(b, 2);
+	const ChangeTick seen = registry.takeChangeTick();
+
+	registry.markChanged<Name>(b);
+	std::vector<EntityID> changed;
+	for (auto [entity, health, name] : View<Health, Name>(registry).changedSince(seen)) {
+		changed.push_back(entity);
+	}
+	EXPECT_EQ(changed, std::vector<EntityID>{b});
+}
+
+TEST(ChangeTrackingTests, AddedAndRemovedSince_ReportEventsAfterTick) {
+	Registry registry;
+	EntityID a = registry.createEntity();
+	EntityID b = registry.createEntity();
+	registry.addComponent<Health>(a);
+	const ChangeTick seen = registry.takeChangeTick();
+
+	registry.addComponent<Health>(b);
+	registry.addComponent<Health>(a, 5); // replacement is a write, not an add
+	registry.destroyEntity(a);
+
+	std::vector<EntityID> added;
+	registry.addedSince<Health>(seen, added);
+	EXPECT_EQ(added, std::vector<EntityID>{b});
+
+	std::vector<EntityID> removed;
+	EXPECT_TRUE(registry.removedSince<Health>(seen, removed));
+	EXPECT_EQ(removed, std::vector<EntityID>{a});
+
+	// Swap-remove moved b into a's slot; its stamps moved with it
+	EXPECT_EQ(collect(View<Health>(registry).changedSince(seen)), std::vector<EntityID>{b});
+}
+
+TEST(ChangeTrackingTests, RemovedSince_ReportsTruncatedHistory) {
+	ComponentPool<Health> pool;
+	const size_t		  count = ComponentPool<Health>::kMaxRemovedLog + 1;
+	for (size_t i = 0; i < count; ++i) {
+		const EntityID	 entity = makeEntityID(static_cast<uint32_t>(i), 1);
+		const ChangeTick tick = static_cast<ChangeTick>(i + 1);
+		pool.add(entity, tick);
+		pool.remove(entity, tick);
+	}
+
+	std::vector<EntityID> removed;
+	EXPECT_FALSE(pool.removedSince(1, removed)); // oldest half was dropped
+	EXPECT_TRUE(removed.empty());
+
+	const ChangeTick recent = static_cast<ChangeTick>(count - 1);
+	EXPECT_TRUE(pool.removedSince(recent, removed));
+	EXPECT_EQ(removed, std::vector<EntityID>{makeEntityID(static_cast<uint32_t>(count - 1), 1)});
+}
+
+TEST(ChangeTrackingTests, ChangeEpoch_IdentifiesTheTickSequence) {
+	Registry	   first;
+	Registry	   second;
+	const uint64_t epoch = first.changeEpoch();
+	EXPECT_NE(epoch, second.changeEpoch()) << "two registries both start at tick 1";
+
+	// A move carries the ticks, so it carries the epoch too; a replacement does not
+	Registry moved = std::move(first);
+	EXPECT_EQ(moved.changeEpoch(), epoch);
+	moved = Registry{};
+	EXPECT_NE(moved.changeEpoch(), epoch);
+}
@@ -1,7 +1,48 @@
 #include "GoalTaskRegistry.h"
 
+#include <algorithm>
+
 namespace ecs {
 
+	namespace {
+		/// Drop one goal from an index list, erasing the list once empty (keeps the order of the rest)
+		template <typename Map, typename Key>
+		void eraseFromList(Map& index, const Key& key, const GoalTask* goal) {
+			auto it = index.find(key);
+			if (it == index.end()) {
+				return;
+			}
+			auto& list = it->second;
+			auto  pos = std::find(list.begin(), list.end(), goal);
+			if (pos != list.end()) {
+				list.erase(pos);
+			}
+			if (list.empty()) {
+				index.erase(it);
+			}
+		}
+
+		/// File a goal in an index list at its creation-order (id) slot. New goals have the
+		/// highest id so this appends; a goal re-filed by updateGoal keeps its old place.
+		template <typename Map, typename Key>
+		void insertInOrder(Map& index, const Key& key, const GoalTask* goal) {
+			auto& list = index[key];
+			auto  pos = std::lower_bound(list.begin(), list.end(), goal, [](const GoalTask* a, const GoalTask* b) { return a->id < b->id; });
+			if (pos == list.end() || *pos != goal) {
+				list.insert(pos, goal); // a repeated key (e.g. a duplicated accepted id) lists the goal once
+			}
+		}
+
+		bool contains(const std::vector<uint32_t>& ids, uint32_t id) {
+			return std::find(ids.begin(), ids.end(), id) != ids.end();
+		}
+
+		/// Copy an index span out, for callers that mutate goals while walking the result
+		std::vector<const GoalTask*> toVector(GoalSpan span) {
+			return {span.begin(), span.end()};
+		}
+	} // namespace
+
 	GoalTaskRegistry& GoalTaskRegistry::Get() {
 		static GoalTaskRegistry instance;
 		return instance;
@@ -13,7 +54,11 @@ namespace ecs {
 		typeToGoals.clear();
 		ownerToGoals.clear();
 		parentToChildren.clear();
+		acceptedToGoals.clear();
+		categoryToGoals.clear();
+		cellToGoals.clear();
 		nextGoalId = 1;
+		nextChainId = 1;
 	}
 
 	uint64_t GoalTaskRegistry::createGoal(GoalTask goal) {
@@ -54,20 +99,63 @@ namespace ecs {
 			return;
 		}
 
-		// Remove from type index (type might change)
-		auto typeIt = typeToGoals.find(it->second.type);
-		if (typeIt != typeToGoals.end()) {
-			typeIt->second.erase(goalId);
-			if (typeIt->second.empty()) {
-				typeToGoals.erase(typeIt);
+		// Type, accepted items and position may change; identity fields may not (see contract).
+		// Re-file only the keys that moved: most updates touch amounts or status, and a goal
+		// that stays in a list keeps its creation-order place there.
+		GoalTask&							goal = it->second;
+		const TaskType						oldType = goal.type;
+		const std::vector<uint32_t>			oldAccepted = goal.acceptedDefNameIds;
+		const engine::assets::ItemCategory	oldCategory = goal.acceptedCategory;
+		const uint64_t						oldCell = cellKey(cellCoord(goal.destinationPosition.x), cellCoord(goal.destinationPosition.y));
+
+		updater(goal);
+
+		const uint64_t newCell = cellKey(cellCoord(goal.destinationPosition.x), cellCoord(goal.destinationPosition.y));
+		if (newCell != oldCell) {
+			eraseFromList(cellToGoals, oldCell, &goal);
+			insertInOrder(cellToGoals, newCell, &goal);
+		}
+
+		if (goal.type != oldType) {
+			// Every type-keyed list moves
+			eraseFromList(typeToGoals, oldType, &goal);
+			for (uint32_t defNameId : oldAccepted) {
+				eraseFromList(acceptedToGoals, acceptedKey(oldType, defNameId), &goal);
+			}
+			if (oldCategory != engine::assets::ItemCategory::None) {
+				eraseFromList(categoryToGoals, acceptedKey(oldType, static_cast<uint32_t>(oldCategory)), &goal);
 			}
+			insertInOrder(typeToGoals, goal.type, &goal);
+			for (uint32_t defNameId : goal.acceptedDefNameIds) {
+				insertInOrder(acceptedToGoals, acceptedKey(goal.type, defNameId), &goal);
+			}
+			if (goal.acceptedCategory != engine::assets::ItemCategory::None) {
+				insertInOrder(categoryToGoals, acceptedKey(goal.type, static_cast<uint32_t>(goal.acceptedCategory)), &goal);
+			}
+			return;
 		}
 
-		// Apply update
-		updater(it->second);
+		if (goal.acceptedDefNameIds != oldAccepted) {
+			for (uint32_t defNameId : oldAccepted) {
+				if (!contains(goal.acceptedDefNameIds, defNameId)) {
+					eraseFromList(acceptedToGoals, acceptedKey(goal.type, defNameId), &goal);
+				}
+			}
+			for (uint32_t defNameId : goal.acceptedDefNameIds) {
+				if (!contains(oldAccepted, defNameId)) {
+					insertInOrder(acceptedToGoals, acceptedKey(goal.type, defNameId), &goal);
+				}
+			}
+		}
 
-		// Re-add to type index
-		typeToGoals[it->second.type].insert(goalId);
+		if (goal.acceptedCategory != oldCategory) {
+			if (oldCategory != engine::assets::ItemCategory::None) {
+				eraseFromList(categoryToGoals, acceptedKey(goal.type, static_cast<uint32_t>(oldCategory)), &goal);
+			}
+			if (goal.acceptedCategory != engine::assets::ItemCategory::None) {
+				insertInOrder(categoryToGoals, acceptedKey(goal.type, static_cast<uint32_t>(goal.acceptedCategory)), &goal);
+			}
+		}
 	}
 
 	void GoalTaskRegistry::removeGoal(uint64_t goalId) {
@@ -142,20 +230,7 @@ namespace ecs {
 	}
 
 	std::vector<const GoalTask*> GoalTaskRegistry::getGoalsOfType(TaskType type) const {
-		std::vector<const GoalTask*> result;
-
-		auto it = typeToGoals.find(type);
-		if (it != typeToGoals.end()) {
-			result.reserve(it->second.size());
-			for (uint64_t goalId : it->second) {
-				auto goalIt = goals.find(goalId);
-				if (goalIt != goals.end()) {
-					result.push_back(&goalIt->second);
-				}
-			}
-		}
-
-		return result;
+		return toVector(goalsOfType(type));
 	}
 
 	std::vector<const GoalTask*> GoalTaskRegistry::getGoalsMatching(const GoalFilter& filter) const {
@@ -172,17 +247,72 @@ namespace ecs {
 
 	std::vector<const GoalTask*> GoalTaskRegistry::getGoalsInRadius(const glm::vec2& center, float radius) const {
 		std::vector<const GoalTask*> result;
-		float						 radiusSq = radius * radius;
+		gatherInRadius(center, radius, std::nullopt, result);
+		return result;
+	}
 
-		for (const auto& [goalId, goal] : goals) {
-			float dx = goal.destinationPosition.x - center.x;
-			float dy = goal.destinationPosition.y - center.y;
-			if (dx * dx + dy * dy <= radiusSq) {
-				result.push_back(&goal);
+	void GoalTaskRegistry::getGoalsNear(TaskType type, const glm::vec2& center, float radius, std::vector<const GoalTask*>& out) const {
+		out.clear();
+		gatherInRadius(center, radius, type, out);
+
+		// Nearest first; goal id breaks ties so equal distances order the same every run
+		std::sort(out.begin(), out.end(), [&center](const GoalTask* a, const GoalTask* b) {
+			const glm::vec2 da = a->destinationPosition - center;
+			const glm::vec2 db = b->destinationPosition - center;
+			const float		distA = da.x * da.x + da.y * da.y;
+			const float		distB = db.x * db.x + db.y * db.y;
+			return distA != distB ? distA < distB : a->id < b->id;
+		});
+	}
+
+	void GoalTaskRegistry::gatherInRadius(
+		const glm::vec2& center, float radius, std::optional<TaskType> type, std::vector<const GoalTask*>& out
+	) const {
+		// NaN fails every distance test anyway; a negative radius contains nothing
+		if (!(radius >= 0.0F) || !std::isfinite(center.x) || !std::isfinite(center.y)) {
+			return;
+		}
+		const float radiusSq = radius * radius;
+		auto		within = [&center, radiusSq, type](const GoalTask* goal) {
+			   const glm::vec2 d = goal->destinationPosition - center;
+			   return (!type.has_value() || goal->type == *type) && d.x * d.x + d.y * d.y <= radiusSq;
+		};
+
+		const int32_t minCx = cellCoord(center.x - radius);
+		const int32_t maxCx = cellCoord(center.x + radius);
+		const int32_t minCy = cellCoord(center.y - radius);
+		const int32_t maxCy = cellCoord(center.y + radius);
+		const auto	  cellSpan = (static_cast<uint64_t>(maxCx - static_cast<int64_t>(minCx)) + 1) *
+							   (static_cast<uint64_t>(maxCy - static_cast<int64_t>(minCy)) + 1);
+
+		// A radius covering more cells than there are candidate goals is cheaper as a scan
+		const size_t candidates = type.has_value() ? goalCount(*type) : goals.size();
+		if (cellSpan > candidates) {
+			if (type.has_value()) {
+				for (const GoalTask* goal : goalsOfType(*type)) {
+					if (within(goal)) {
+						out.push_back(goal);
+					}
+				}
+			} else {
+				for (const auto& [goalId, goal] : goals) {
+					if (within(&goal)) {
+						out.push_back(&goal);
+					}
+				}
 			}
+			return;
 		}
 
-		return result;
+		for (int32_t cy = minCy; cy <= maxCy; ++cy) {
+			for (int32_t cx = minCx; cx <= maxCx; ++cx) {
+				for (const GoalTask* goal : lookup(cellToGoals, cellKey(cx, cy))) {
+					if (within(goal)) {
+						out.push_back(goal);
+					}
+				}
+			}
+		}
 	}
 
 	size_t GoalTaskRegistry::goalCount(TaskType type) const {
@@ -194,28 +324,40 @@ namespace ecs {
 	}
 
 	std::vector<const GoalTask*> GoalTaskRegistry::getGoalsByOwner(GoalOwner owner) const {
-		std::vector<const GoalTask*> result;
+		return toVector(goalsOwnedBy(owner));
+	}
 
+	size_t GoalTaskRegistry::goalCount(GoalOwner owner) const {
 		auto it = ownerToGoals.find(owner);
 		if (it != ownerToGoals.end()) {
-			result.reserve(it->second.size());
-			for (uint64_t goalId : it->second) {
-				auto goalIt = goals.find(goalId);
-				if (goalIt != goals.end()) {
-					result.push_back(&goalIt->second);
-				}
-			}
+			return it->second.size();
 		}
+		return 0;
+	}
 
+	std::vector<GoalTask> GoalTaskRegistry::exportGoals() const {
+		std::vector<GoalTask> result;
+		result.reserve(goals.size());
+		for (const auto& [id, goal] : goals) {
+			result.push_back(goal);
+		}
+		std::sort(result.begin(), result.end(), [](const GoalTask& a, const GoalTask& b) { return a.id < b.id; });
 		return result;
 	}
 
-	size_t GoalTaskRegistry::goalCount(GoalOwner owner) const {
-		auto it = ownerToGoals.find(owner);
-		if (it != ownerToGoals.end()) {
-			return it->second.size();
+	void GoalTaskRegistry::restore(std::vector<GoalTask> savedGoals, uint64_t savedNextGoalId) {
+		clear();
+		nextGoalId = std::max<uint64_t>(savedNextGoalId, 1);
+		for (auto& goal : savedGoals) {
+			nextGoalId = std::max(nextGoalId, goal.id + 1);
+			if (goal.chainId.has_value()) {
+				reserveChainId(*goal.chainId);
+			}
+			auto [it, inserted] = goals.emplace(goal.id, std::move(goal));
+			if (inserted) {
+				addToIndices(it->second);
+			}
 		}
-		return 0;
 	}
 
 	void GoalTaskRegistry::addToIndices(const GoalTask& goal) {
@@ -225,18 +367,35 @@ namespace ecs {
 			destinationToGoal[goal.destinationEntity] = goal.id;
 		}
 
-		// Type index
-		typeToGoals[goal.type].insert(goal.id);
-
 		// Owner index
 		if (goal.owner != GoalOwner::None) {
-			ownerToGoals[goal.owner].insert(goal.id);
+			insertInOrder(ownerToGoals, goal.owner, &goal);
 		}
 
 		// Parent-child index
 		if (goal.parentGoalId.has_value()) {
-			parentToChildren[goal.parentGoalId.value()].insert(goal.id);
+			insertInOrder(parentToChildren, goal.parentGoalId.value(), &goal);
+		}
+
+		addToContentIndices(goal);
+	}
+
+	void GoalTaskRegistry::addToContentIndices(const GoalTask& goal) {
+		// Type index
+		insertInOrder(typeToGoals, goal.type, &goal);
+
+		// Accepted-item index
+		for (uint32_t defNameId : goal.acceptedDefNameIds) {
+			insertInOrder(acceptedToGoals, acceptedKey(goal.type, defNameId), &goal);
+		}
+
+		// Accepted-category index
+		if (goal.acceptedCategory != engine::assets::ItemCategory::None) {
+			insertInOrder(categoryToGoals, acceptedKey(goal.type, static_cast<uint32_t>(goal.acceptedCategory)), &goal);
 		}
+
+		// Spatial index
+		insertInOrder(cellToGoals, cellKey(cellCoord(goal.destinationPosition.x), cellCoord(goal.destinationPosition.y)), &goal);
 	}
 
 	void GoalTaskRegistry::removeFromIndices(const GoalTask& goal) {
@@ -245,53 +404,32 @@ namespace ecs {
 			destinationToGoal.erase(goal.destinationEntity);
 		}
 
-		// Type index
-		auto typeIt = typeToGoals.find(goal.type);
-		if (typeIt != typeToGoals.end()) {
-			typeIt->second.erase(goal.id);
-			if (typeIt->second.empty()) {
-				typeToGoals.erase(typeIt);
-			}
-		}
-
 		// Owner index
 		if (goal.owner != GoalOwner::None) {
-			auto ownerIt = ownerToGoals.find(goal.owner);
-			if (ownerIt != ownerToGoals.end()) {
-				ownerIt->second.erase(goal.id);
-				if (ownerIt->second.empty()) {
-					ownerToGoals.erase(ownerIt);
-				}
-			}
+			eraseFromList(ownerToGoals, goal.owner, &goal);
 		}
 
 		// Parent-child index
 		if (goal.parentGoalId.has_value()) {
-			auto parentIt = parentToChildren.find(goal.parentGoalId.value());
-			if (parentIt != parentToChildren.end()) {
-				parentIt->second.erase(goal.id);
-				if (parentIt->second.empty()) {
-					parentToChildren.erase(parentIt);
-				}
-			}
+			eraseFromList(parentToChildren, goal.parentGoalId.value(), &goal);
 		}
-	}
 
-	std::vector<const GoalTask*> GoalTaskRegistry::getChildGoals(uint64_t parentId) const {
-		std::vector<const GoalTask*> result;
+		removeFromContentIndices(goal);
+	}
 
-		auto it = parentToChildren.find(parentId);
-		if (it != parentToChildren.end()) {
-			result.reserve(it->second.size());
-			for (uint64_t childId : it->second) {
-				auto goalIt = goals.find(childId);
-				if (goalIt != goals.end()) {
-					result.push_back(&goalIt->second);
-				}
-			}
+	void GoalTaskRegistry::removeFromContentIndices(const GoalTask& goal) {
+		eraseFromList(typeToGoals, goal.type, &goal);
+		for (uint32_t defNameId : goal.acceptedDefNameIds) {
+			eraseFromList(acceptedToGoals, acceptedKey(goal.type, defNameId), &goal); // no-op for a repeated id
+		}
+		if (goal.acceptedCategory != engine::assets::ItemCategory::None) {
+			eraseFromList(categoryToGoals, acceptedKey(goal.type, static_cast<uint32_t>(goal.acceptedCategory)), &goal);
 		}
+		eraseFromList(cellToGoals, cellKey(cellCoord(goal.destinationPosition.x), cellCoord(goal.destinationPosition.y)), &goal);
+	}
 
-		return result;
+	std::vector<const GoalTask*> GoalTaskRegistry::getChildGoals(uint64_t parentId) const {
+		return toVector(childGoals(parentId));
 	}
 
 	void GoalTaskRegistry::removeGoalWithChildren(uint64_t goalId) {
@@ -304,11 +442,8 @@ namespace ecs {
 			queue.pop_back();
 			toRemove.push_back(current);
 
-			auto childIt = parentToChildren.find(current);
-			if (childIt != parentToChildren.end()) {
-				for (uint64_t childId : childIt->second) {
-					queue.push_back(childId);
-				}
+			for (const GoalTask* child : childGoals(current)) {
+				queue.push_back(child->id);
 			}
 		}
 
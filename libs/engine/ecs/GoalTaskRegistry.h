@@ -6,6 +6,13 @@
 // not at the ITEM level. This makes task counts bounded by O(goals) ~200 instead
 // of O(discovered entities) ~100,000.
 //
+// Secondary indices (type, owner, parent, accepted item, accepted category and a
+// uniform grid over destinations) are kept in step on create/update/remove. They
+// hold pointers into the goal map (node-based, so goals never move) and back the
+// span queries, which read a list in place without allocating. A span is valid
+// until the next createGoal/updateGoal/removeGoal; callers that mutate goals while
+// walking results use the vector-returning getters, which copy.
+//
 // Design: docs/design/game-systems/colonists/task-registry.md
 // Architecture: docs/technical/task-generation-architecture.md
 
@@ -16,9 +23,12 @@
 
 #include <assets/AssetDefinition.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -103,6 +113,9 @@ namespace ecs {
 	/// Filter predicate for goal queries
 	using GoalFilter = std::function<bool(const GoalTask&)>;
 
+	/// Read-only view of an index list (see the span queries on GoalTaskRegistry)
+	using GoalSpan = std::span<const GoalTask* const>;
+
 	/// Global registry of goal-level tasks
 	/// Singleton - access via GoalTaskRegistry::Get()
 	///
@@ -127,9 +140,9 @@ namespace ecs {
 		///
 		/// CONTRACT: the updater may only mutate amount/accepted-type fields
 		/// (targetAmount, deliveredAmount, acceptedDefNameIds, acceptedCategory, status, ...).
-		/// It must NOT change indexed identity fields (type, owner, destinationEntity,
-		/// parentGoalId); only the type index is reconciled here. To change
-		/// identity, remove and recreate the goal.
+		/// It must NOT change indexed identity fields (owner, destinationEntity,
+		/// parentGoalId); the type, accepted-item and position indices are reconciled
+		/// here. To change identity, remove and recreate the goal.
 		///
 		/// @param goalId The goal to update
 		/// @param updater Function to modify the goal
@@ -160,7 +173,8 @@ namespace ecs {
 		/// Get a goal by ID
 		[[nodiscard]] const GoalTask* getGoal(uint64_t goalId) const;
 
-		/// Get mutable goal by ID (for systems that need to update goals)
+		/// Get mutable goal by ID (for systems that need to update goals). Indexed fields
+		/// (type, owner, destination, parent, accepted items/category) must go through updateGoal.
 		[[nodiscard]] GoalTask* getGoalMutable(uint64_t goalId);
 
 		/// Get goal by destination entity
@@ -172,9 +186,14 @@ namespace ecs {
 		/// Get all goals matching a filter
 		[[nodiscard]] std::vector<const GoalTask*> getGoalsMatching(const GoalFilter& filter) const;
 
-		/// Get goals within radius of a position
+		/// Get goals whose destination lies within radius of a position
 		[[nodiscard]] std::vector<const GoalTask*> getGoalsInRadius(const glm::vec2& center, float radius) const;
 
+		/// Fill `out` (cleared first) with goals of `type` whose destination lies within radius
+		/// of `center`, nearest first. Reads only the grid cells the radius overlaps, or scans
+		/// the type's goals when the radius spans more cells than there are goals.
+		void getGoalsNear(TaskType type, const glm::vec2& center, float radius, std::vector<const GoalTask*>& out) const;
+
 		/// Get total count of goals
 		[[nodiscard]] size_t goalCount() const { return goals.size(); }
 
@@ -187,6 +206,27 @@ namespace ecs {
 		/// Get count of goals by owner
 		[[nodiscard]] size_t goalCount(GoalOwner owner) const;
 
+		// --- Span queries (no allocation; invalidated by any goal create/update/remove) ---
+
+		/// Goals of a type, in creation order
+		[[nodiscard]] GoalSpan goalsOfType(TaskType type) const { return lookup(typeToGoals, type); }
+
+		/// Goals owned by a system, in creation order
+		[[nodiscard]] GoalSpan goalsOwnedBy(GoalOwner owner) const { return lookup(ownerToGoals, owner); }
+
+		/// Direct children of a goal, in creation order
+		[[nodiscard]] GoalSpan childGoals(uint64_t parentId) const { return lookup(parentToChildren, parentId); }
+
+		/// Goals of a type listing `defNameId` in acceptedDefNameIds
+		[[nodiscard]] GoalSpan goalsAccepting(TaskType type, uint32_t defNameId) const {
+			return lookup(acceptedToGoals, acceptedKey(type, defNameId));
+		}
+
+		/// Goals of a type accepting a whole item category (acceptedCategory, None never indexed)
+		[[nodiscard]] GoalSpan goalsAcceptingCategory(TaskType type, engine::assets::ItemCategory category) const {
+			return lookup(categoryToGoals, acceptedKey(type, static_cast<uint32_t>(category)));
+		}
+
 		// --- Hierarchy queries ---
 
 		/// Get all child goals of a parent goal
@@ -202,30 +242,102 @@ namespace ecs {
 		/// is not a Harvest goal.
 		uint64_t createHaulForCompletedHarvest(uint64_t harvestGoalId);
 
+		// --- Task chains ---
+
+		/// Allocate a task chain id (GoalTask::chainId, Task::chainId). One counter for every
+		/// goal system, reset by clear(), so chain ids never collide across systems and a fresh
+		/// game hands out the same sequence every run.
+		uint64_t allocateChainId() { return nextChainId++; }
+
+		/// Keep future chain ids above `chainId` (a restored Task still carrying it)
+		void reserveChainId(uint64_t chainId) { nextChainId = std::max(nextChainId, chainId + 1); }
+
+		// --- Save/load ---
+
+		/// Every goal, ordered by id (so a save of the same state is byte-identical)
+		[[nodiscard]] std::vector<GoalTask> exportGoals() const;
+
+		/// Id the next createGoal() will assign
+		[[nodiscard]] uint64_t peekNextGoalId() const { return nextGoalId; }
+
+		/// Replace all goals with saved ones, keeping their ids, and rebuild the indices.
+		/// The id counter is raised past the largest saved id if `savedNextGoalId` isn't,
+		/// and the chain counter past the largest saved chain id.
+		void restore(std::vector<GoalTask> savedGoals, uint64_t savedNextGoalId);
+
+		/// Side of a spatial index cell, in world units
+		static constexpr float kGoalCellSize = 32.0F;
+
 	  private:
 		GoalTaskRegistry() = default;
 
+		using GoalList = std::vector<const GoalTask*>;
+
+		template <typename Key>
+		[[nodiscard]] static GoalSpan lookup(const std::unordered_map<Key, GoalList>& index, const Key& key) {
+			auto it = index.find(key);
+			return it != index.end() ? GoalSpan(it->second) : GoalSpan();
+		}
+
+		[[nodiscard]] static uint64_t acceptedKey(TaskType type, uint32_t value) {
+			return (static_cast<uint64_t>(type) << 32) | value;
+		}
+
+		[[nodiscard]] static uint64_t cellKey(int32_t cx, int32_t cy) {
+			return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+		}
+
+		/// Clamped to +-2^30 cells so a huge or infinite coordinate can't overflow the
+		/// cast; NaN lands in cell 0.
+		[[nodiscard]] static int32_t cellCoord(float value) {
+			constexpr float kMaxCell = 1073741824.0F;
+			const float		cell = std::floor(value / kGoalCellSize);
+			return std::isnan(cell) ? 0 : static_cast<int32_t>(std::clamp(cell, -kMaxCell, kMaxCell));
+		}
+
 		// Goal storage
 		std::unordered_map<uint64_t, GoalTask> goals; // goalId → goal
 
 		// Index: destination entity → goalId
 		std::unordered_map<EntityID, uint64_t> destinationToGoal;
 
-		// Index: TaskType → set of goalIds
-		std::unordered_map<TaskType, std::unordered_set<uint64_t>> typeToGoals;
+		// Index lists below point into `goals` and keep creation order
+
+		// Index: TaskType → goals
+		std::unordered_map<TaskType, GoalList> typeToGoals;
+
+		// Index: GoalOwner → goals
+		std::unordered_map<GoalOwner, GoalList> ownerToGoals;
+
+		// Index: parentGoalId → child goals
+		std::unordered_map<uint64_t, GoalList> parentToChildren;
 
-		// Index: GoalOwner → set of goalIds
-		std::unordered_map<GoalOwner, std::unordered_set<uint64_t>> ownerToGoals;
+		// Index: (TaskType, accepted defNameId) → goals
+		std::unordered_map<uint64_t, GoalList> acceptedToGoals;
 
-		// Index: parentGoalId → set of child goalIds
-		std::unordered_map<uint64_t, std::unordered_set<uint64_t>> parentToChildren;
+		// Index: (TaskType, acceptedCategory) → goals
+		std::unordered_map<uint64_t, GoalList> categoryToGoals;
+
+		// Index: grid cell of destinationPosition → goals
+		std::unordered_map<uint64_t, GoalList> cellToGoals;
 
 		// Next goal ID
 		uint64_t nextGoalId = 1;
 
+		// Next task chain ID
+		uint64_t nextChainId = 1;
+
 		// Internal helpers
 		void addToIndices(const GoalTask& goal);
 		void removeFromIndices(const GoalTask& goal);
+
+		// The indices updateGoal() reconciles: type, accepted items/category, position
+		void addToContentIndices(const GoalTask& goal);
+		void removeFromContentIndices(const GoalTask& goal);
+
+		// Goals (of `type`, if set) within radius of center: the overlapped grid cells, or a
+		// scan of the candidates when that is fewer goals than cells
+		void gatherInRadius(const glm::vec2& center, float radius, std::optional<TaskType> type, std::vector<const GoalTask*>& out) const;
 	};
 
 } // namespace ecs
@@ -0,0 +1,203 @@
+// Tests for GoalTaskRegistry's secondary indices: accepted item/category, parent-child
+// lists and the destination grid stay in step across create/update/remove.
+
+#include "GoalTaskRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace ecs::test {
+
+	class GoalTaskRegistryTest : public ::testing::Test {
+	  protected:
+		void SetUp() override { GoalTaskRegistry::Get().clear(); }
+		void TearDown() override { GoalTaskRegistry::Get().clear(); }
+
+		static uint64_t makeGoal(
+			TaskType type, glm::vec2 pos, std::vector<uint32_t> accepted = {}, std::optional<uint64_t> parent = std::nullopt
+		) {
+			GoalTask goal;
+			goal.type = type;
+			goal.destinationEntity = static_cast<EntityID>(++nextEntity);
+			goal.destinationPosition = pos;
+			goal.acceptedDefNameIds = std::move(accepted);
+			goal.targetAmount = 10;
+			goal.parentGoalId = parent;
+			return GoalTaskRegistry::Get().createGoal(std::move(goal));
+		}
+
+		static bool contains(GoalSpan span, uint64_t goalId) {
+			return std::any_of(span.begin(), span.end(), [goalId](const GoalTask* goal) { return goal->id == goalId; });
+		}
+
+		static inline uint64_t nextEntity = 0;
+	};
+
+	TEST_F(GoalTaskRegistryTest, GoalsAcceptingIsKeyedByTypeAndItem) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t woodHaul = makeGoal(TaskType::Haul, {0.0F, 0.0F}, {1, 2});
+		const uint64_t stoneHaul = makeGoal(TaskType::Haul, {5.0F, 0.0F}, {3});
+		const uint64_t woodHarvest = makeGoal(TaskType::Harvest, {9.0F, 0.0F}, {1});
+
+		EXPECT_EQ(registry.goalsAccepting(TaskType::Haul, 1).size(), 1U);
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 1), woodHaul));
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 2), woodHaul));
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 3), stoneHaul));
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Harvest, 1), woodHarvest));
+		EXPECT_TRUE(registry.goalsAccepting(TaskType::Haul, 4).empty());
+	}
+
+	TEST_F(GoalTaskRegistryTest, RepeatedAcceptedIdListsGoalOnce) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t id = makeGoal(TaskType::Haul, {0.0F, 0.0F}, {7, 7});
+		EXPECT_EQ(registry.goalsAccepting(TaskType::Haul, 7).size(), 1U);
+
+		registry.removeGoal(id);
+		EXPECT_TRUE(registry.goalsAccepting(TaskType::Haul, 7).empty());
+	}
+
+	TEST_F(GoalTaskRegistryTest, UpdateGoalReindexesAcceptedItems) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t id = makeGoal(TaskType::Haul, {0.0F, 0.0F}, {1});
+
+		registry.updateGoal(id, [](GoalTask& goal) {
+			goal.acceptedDefNameIds = {2};
+			goal.acceptedCategory = engine::assets::ItemCategory::Food;
+		});
+
+		EXPECT_TRUE(registry.goalsAccepting(TaskType::Haul, 1).empty());
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 2), id));
+		EXPECT_TRUE(contains(registry.goalsAcceptingCategory(TaskType::Haul, engine::assets::ItemCategory::Food), id));
+		EXPECT_EQ(registry.goalCount(TaskType::Haul), 1U);
+	}
+
+	TEST_F(GoalTaskRegistryTest, UpdateGoalKeepsCreationOrder) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t first = makeGoal(TaskType::Haul, {0.0F, 0.0F}, {1});
+		const uint64_t second = makeGoal(TaskType::Haul, {1.0F, 0.0F}, {1});
+		const uint64_t third = makeGoal(TaskType::Haul, {2.0F, 0.0F}, {1});
+
+		auto ids = [](GoalSpan span) {
+			std::vector<uint64_t> out;
+			for (const GoalTask* goal : span) {
+				out.push_back(goal->id);
+			}
+			return out;
+		};
+		const std::vector<uint64_t> expected = {first, second, third};
+
+		// Status-only: nothing is re-filed
+		registry.updateGoal(first, [](GoalTask& goal) { goal.status = GoalStatus::Blocked; });
+		EXPECT_EQ(ids(registry.goalsOfType(TaskType::Haul)), expected);
+		EXPECT_EQ(ids(registry.goalsAccepting(TaskType::Haul, 1)), expected);
+
+		// An added accepted id and a move to another cell still leave the shared lists in order
+		registry.updateGoal(first, [](GoalTask& goal) {
+			goal.acceptedDefNameIds = {1, 2};
+			goal.destinationPosition = {100.0F, 0.0F};
+		});
+		EXPECT_EQ(ids(registry.goalsOfType(TaskType::Haul)), expected);
+		EXPECT_EQ(ids(registry.goalsAccepting(TaskType::Haul, 1)), expected);
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 2), first));
+		EXPECT_EQ(registry.getGoalsInRadius({100.0F, 0.0F}, 1.0F).size(), 1U);
+
+		// A type change away and back files the goal at its creation-order slot again
+		registry.updateGoal(second, [](GoalTask& goal) { goal.type = TaskType::Harvest; });
+		EXPECT_EQ(ids(registry.goalsOfType(TaskType::Haul)), (std::vector<uint64_t>{first, third}));
+		EXPECT_EQ(ids(registry.goalsAccepting(TaskType::Harvest, 1)), std::vector<uint64_t>{second});
+		registry.updateGoal(second, [](GoalTask& goal) { goal.type = TaskType::Haul; });
+		EXPECT_EQ(ids(registry.goalsOfType(TaskType::Haul)), expected);
+		EXPECT_EQ(ids(registry.goalsAccepting(TaskType::Haul, 1)), expected);
+	}
+
+	TEST_F(GoalTaskRegistryTest, ChildListsFollowCreateAndCascadeRemove) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t parent = makeGoal(TaskType::Craft, {0.0F, 0.0F});
+		const uint64_t first = makeGoal(TaskType::Harvest, {0.0F, 0.0F}, {1}, parent);
+		const uint64_t second = makeGoal(TaskType::Haul, {0.0F, 0.0F}, {1}, parent);
+
+		const GoalSpan children = registry.childGoals(parent);
+		ASSERT_EQ(children.size(), 2U);
+		EXPECT_EQ(children[0]->id, first) << "children are listed in creation order";
+		EXPECT_EQ(children[1]->id, second);
+
+		registry.removeGoalWithChildren(parent);
+		EXPECT_EQ(registry.goalCount(), 0U);
+		EXPECT_TRUE(registry.childGoals(parent).empty());
+		EXPECT_TRUE(registry.goalsAccepting(TaskType::Haul, 1).empty());
+		EXPECT_TRUE(registry.goalsOfType(TaskType::Harvest).empty());
+	}
+
+	TEST_F(GoalTaskRegistryTest, DuplicateDestinationReindexesInPlace) {
+		auto& registry = GoalTaskRegistry::Get();
+		GoalTask goal;
+		goal.type = TaskType::Haul;
+		goal.destinationEntity = static_cast<EntityID>(9001);
+		goal.acceptedDefNameIds = {1};
+		const uint64_t id = registry.createGoal(goal);
+
+		goal.acceptedDefNameIds = {2};
+		goal.destinationPosition = {100.0F, 100.0F};
+		EXPECT_EQ(registry.createGoal(goal), id);
+
+		EXPECT_TRUE(registry.goalsAccepting(TaskType::Haul, 1).empty());
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 2), id));
+		EXPECT_TRUE(registry.getGoalsInRadius({0.0F, 0.0F}, 1.0F).empty());
+		EXPECT_EQ(registry.getGoalsInRadius({100.0F, 100.0F}, 1.0F).size(), 1U);
+	}
+
+	TEST_F(GoalTaskRegistryTest, GoalsNearAreSortedNearestFirstAndFilteredByType) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t far = makeGoal(TaskType::Haul, {-60.0F, 0.0F});
+		const uint64_t near = makeGoal(TaskType::Haul, {3.0F, 4.0F});
+		makeGoal(TaskType::Harvest, {1.0F, 0.0F});
+		makeGoal(TaskType::Haul, {500.0F, 500.0F});
+
+		std::vector<const GoalTask*> found;
+		registry.getGoalsNear(TaskType::Haul, {0.0F, 0.0F}, 70.0F, found);
+		ASSERT_EQ(found.size(), 2U);
+		EXPECT_EQ(found[0]->id, near);
+		EXPECT_EQ(found[1]->id, far) << "cells at negative coordinates are searched too";
+
+		registry.getGoalsNear(TaskType::Haul, {0.0F, 0.0F}, 10.0F, found);
+		ASSERT_EQ(found.size(), 1U);
+		EXPECT_EQ(found[0]->id, near);
+	}
+
+	TEST_F(GoalTaskRegistryTest, RadiusQueriesSurviveHugeAndNonFiniteInput) {
+		auto& registry = GoalTaskRegistry::Get();
+		makeGoal(TaskType::Haul, {0.0F, 0.0F});
+		makeGoal(TaskType::Haul, {1.0e6F, -1.0e6F});
+
+		// Far more cells than goals: answered by a scan, not a cell walk
+		std::vector<const GoalTask*> found;
+		registry.getGoalsNear(TaskType::Haul, {0.0F, 0.0F}, 1.0e30F, found);
+		EXPECT_EQ(found.size(), 2U);
+		EXPECT_EQ(registry.getGoalsInRadius({0.0F, 0.0F}, std::numeric_limits<float>::infinity()).size(), 2U);
+
+		EXPECT_TRUE(registry.getGoalsInRadius({0.0F, 0.0F}, std::numeric_limits<float>::quiet_NaN()).empty());
+		EXPECT_TRUE(registry.getGoalsInRadius({std::numeric_limits<float>::quiet_NaN(), 0.0F}, 10.0F).empty());
+		registry.getGoalsNear(TaskType::Haul, {0.0F, 0.0F}, -5.0F, found);
+		EXPECT_TRUE(found.empty());
+	}
+
+	TEST_F(GoalTaskRegistryTest, RestoreRebuildsIndices) {
+		auto& registry = GoalTaskRegistry::Get();
+		const uint64_t parent = makeGoal(TaskType::Craft, {0.0F, 0.0F});
+		const uint64_t child = makeGoal(TaskType::Haul, {0.0F, 0.0F}, {5}, parent);
+		auto saved = registry.exportGoals();
+		const uint64_t next = registry.peekNextGoalId();
+
+		registry.clear();
+		EXPECT_TRUE(registry.goalsAccepting(TaskType::Haul, 5).empty());
+
+		registry.restore(std::move(saved), next);
+		EXPECT_TRUE(contains(registry.goalsAccepting(TaskType::Haul, 5), child));
+		EXPECT_TRUE(contains(registry.childGoals(parent), child));
+		EXPECT_EQ(registry.getGoalsInRadius({0.0F, 0.0F}, 1.0F).size(), 2U);
+	}
+
+} // namespace ecs::test
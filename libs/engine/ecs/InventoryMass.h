@@ -9,6 +9,10 @@
 // construction system computes (from an empty colonist) consistent with the clamp
 // the action system applies at harvest time, so a tool-carrying colonist never
 // stalls one unit short of the goal's trip target.
+//
+// The helpers work on AssetRegistry defName ids, the same ids ItemStack stores, so
+// the per-stack lookups here are vector indexing rather than string hashing. The
+// defName overloads resolve the id once and forward.
 
 #include <algorithm>
 #include <cmath>
@@ -48,34 +52,39 @@ namespace ecs {
 	[[nodiscard]] inline float carriedCargoMassKg(const Inventory& inv, const engine::assets::AssetRegistry& registry) {
 		float total = 0.0F;
 
-		auto addStack = [&](const std::string& defName, uint32_t quantity) {
-			if (quantity == 0 || defName.empty()) {
+		auto addStack = [&](const ItemStack& stack) {
+			if (stack.quantity == 0 || stack.defNameId == 0) {
 				return;
 			}
-			const auto* def = registry.getDefinition(defName);
+			const auto* def = registry.getDefinition(stack.defNameId);
 			if (def != nullptr && def->category == engine::assets::ItemCategory::Tool) {
 				return; // equipment, not cargo
 			}
-			total += registry.getItemMassKg(defName) * static_cast<float>(quantity);
+			const float massKg = (def != nullptr && def->itemProperties.has_value()) ? def->itemProperties->massKg : 1.0F;
+			total += massKg * static_cast<float>(stack.quantity);
 		};
 
 		if (inv.leftHand.has_value()) {
-			addStack(inv.leftHand->defName, inv.leftHand->quantity);
+			addStack(*inv.leftHand);
 		}
 		// A two-handed item shows in both hands as the same stack; counting both double-
 		// counts it. Skip the right hand when it mirrors the left.
-		if (inv.rightHand.has_value() && !(inv.leftHand.has_value() && inv.leftHand->defName == inv.rightHand->defName)) {
-			addStack(inv.rightHand->defName, inv.rightHand->quantity);
+		if (inv.rightHand.has_value() && !(inv.leftHand.has_value() && inv.leftHand->defNameId == inv.rightHand->defNameId)) {
+			addStack(*inv.rightHand);
 		}
 		for (const auto& stack : inv.items) {
-			addStack(stack.defName, stack.quantity);
+			addStack(stack);
 		}
 		return total;
 	}
 
-	/// How many more units of `defName` fit before hitting the cargo weight cap. Weight is the
+	/// How many more units of an item fit before hitting the cargo weight cap. Weight is the
 	/// only bound here; per-stack count limits live in Inventory (addableCount), and a hand
 	/// armful is weight-limited by design, so a massless item is unbounded.
+	[[nodiscard]] inline uint32_t cargoUnitsThatFit(const Inventory& inv, const engine::assets::AssetRegistry& registry, uint32_t defNameId) {
+		const float remaining = inv.carryCapacityKg - carriedCargoMassKg(inv, registry);
+		return massUnitsThatFit(remaining, registry.getItemMassKg(defNameId), UINT32_MAX);
+	}
 	[[nodiscard]] inline uint32_t cargoUnitsThatFit(const Inventory& inv, const engine::assets::AssetRegistry& registry, const std::string& defName) {
 		const float remaining = inv.carryCapacityKg - carriedCargoMassKg(inv, registry);
 		return massUnitsThatFit(remaining, registry.getItemMassKg(defName), UINT32_MAX);
@@ -88,29 +97,32 @@ namespace ecs {
 		if (toolType.empty()) {
 			return true;
 		}
-		auto matches = [&](const std::string& defName) {
-			return registry.getToolType(registry.getDefNameId(defName)) == toolType;
+		auto matches = [&](uint32_t defNameId) {
+			return registry.getToolType(defNameId) == toolType;
 		};
-		if (inv.leftHand.has_value() && matches(inv.leftHand->defName)) {
+		if (inv.leftHand.has_value() && matches(inv.leftHand->defNameId)) {
 			return true;
 		}
-		if (inv.rightHand.has_value() && matches(inv.rightHand->defName)) {
+		if (inv.rightHand.has_value() && matches(inv.rightHand->defNameId)) {
 			return true;
 		}
 		for (const auto& slot : inv.belt) {
-			if (slot.has_value() && matches(slot->defName)) {
+			if (slot.has_value() && matches(slot->defNameId)) {
 				return true;
 			}
 		}
 		for (const auto& stack : inv.items) {
-			if (stack.quantity > 0 && matches(stack.defName)) {
+			if (stack.quantity > 0 && matches(stack.defNameId)) {
 				return true;
 			}
 		}
 		return false;
 	}
 
-	/// How many units of `defName` an empty colonist with `carryCapacityKg` carries in one trip.
+	/// How many units of an item an empty colonist with `carryCapacityKg` carries in one trip.
+	[[nodiscard]] inline uint32_t cargoUnitsPerTrip(const engine::assets::AssetRegistry& registry, uint32_t defNameId, float carryCapacityKg) {
+		return massUnitsPerTrip(carryCapacityKg, registry.getItemMassKg(defNameId));
+	}
 	[[nodiscard]] inline uint32_t cargoUnitsPerTrip(const engine::assets::AssetRegistry& registry, const std::string& defName, float carryCapacityKg) {
 		return massUnitsPerTrip(carryCapacityKg, registry.getItemMassKg(defName));
 	}
@@ -119,39 +131,49 @@ namespace ecs {
 	// Two-hand items (handsRequired >= 2, e.g. Wood) live in the hands as a weight-limited
 	// armful and never enter the backpack, so anything that reads or consumes materials must
 	// look at the hands, not just `items`. A two-hand armful occupies BOTH hands as the same
-	// logical stack (equal quantity, same defName); these helpers preserve that mirror.
+	// logical stack (equal quantity, same item); these helpers preserve that mirror.
 
-	/// True if `defName` must be carried in both hands (so it lives in the hands, not the pack).
+	/// True if the item must be carried in both hands (so it lives in the hands, not the pack).
+	[[nodiscard]] inline bool itemIsTwoHand(const engine::assets::AssetRegistry& registry, uint32_t defNameId) {
+		const auto* def = registry.getDefinition(defNameId);
+		return def != nullptr && def->handsRequired >= 2;
+	}
 	[[nodiscard]] inline bool itemIsTwoHand(const engine::assets::AssetRegistry& registry, const std::string& defName) {
 		const auto* def = registry.getDefinition(defName);
 		return def != nullptr && def->handsRequired >= 2;
 	}
 
-	/// Quantity of `defName` held in the hands. A two-hand item mirrors across both hands; it is
+	/// Quantity of an item held in the hands. A two-hand item mirrors across both hands; it is
 	/// counted once (right skipped when it mirrors the left), matching carriedCargoMassKg.
-	[[nodiscard]] inline uint32_t handHeldQuantity(const Inventory& inv, const std::string& defName) {
+	[[nodiscard]] inline uint32_t handHeldQuantity(const Inventory& inv, uint32_t defNameId) {
 		uint32_t qty = 0;
-		if (inv.leftHand.has_value() && inv.leftHand->defName == defName) {
+		if (inv.leftHand.has_value() && inv.leftHand->defNameId == defNameId) {
 			qty += inv.leftHand->quantity;
 		}
-		if (inv.rightHand.has_value() && inv.rightHand->defName == defName &&
-			!(inv.leftHand.has_value() && inv.leftHand->defName == inv.rightHand->defName)) {
+		if (inv.rightHand.has_value() && inv.rightHand->defNameId == defNameId &&
+			!(inv.leftHand.has_value() && inv.leftHand->defNameId == inv.rightHand->defNameId)) {
 			qty += inv.rightHand->quantity;
 		}
 		return qty;
 	}
+	[[nodiscard]] inline uint32_t handHeldQuantity(const Inventory& inv, const std::string& defName) {
+		return handHeldQuantity(inv, engine::assets::AssetRegistry::Get().getDefNameId(defName));
+	}
 
-	/// Total `defName` a colonist can draw on: backpack plus hands. Callers that read materials
+	/// Total of an item a colonist can draw on: backpack plus hands. Callers that read materials
 	/// (craft input, haul, deposit) must use this so hand-carried two-hand goods are seen.
+	[[nodiscard]] inline uint32_t availableQuantity(const Inventory& inv, uint32_t defNameId) {
+		return inv.getQuantity(defNameId) + handHeldQuantity(inv, defNameId);
+	}
 	[[nodiscard]] inline uint32_t availableQuantity(const Inventory& inv, const std::string& defName) {
-		return inv.getQuantity(defName) + handHeldQuantity(inv, defName);
+		return availableQuantity(inv, engine::assets::AssetRegistry::Get().getDefNameId(defName));
 	}
 
-	/// Remove up to `quantity` of `defName` from the hands, keeping the two-hand mirror in sync
+	/// Remove up to `quantity` of an item from the hands, keeping the two-hand mirror in sync
 	/// (both hands decrement together and clear together). Returns the amount removed.
-	inline uint32_t removeFromHands(Inventory& inv, const std::string& defName, uint32_t quantity) {
-		const bool inLeft = inv.leftHand.has_value() && inv.leftHand->defName == defName;
-		const bool inRight = inv.rightHand.has_value() && inv.rightHand->defName == defName;
+	inline uint32_t removeFromHands(Inventory& inv, uint32_t defNameId, uint32_t quantity) {
+		const bool inLeft = inv.leftHand.has_value() && inv.leftHand->defNameId == defNameId;
+		const bool inRight = inv.rightHand.has_value() && inv.rightHand->defNameId == defNameId;
 		if (!inLeft && !inRight) {
 			return 0;
 		}
@@ -172,25 +194,28 @@ namespace ecs {
 		}
 		return toRemove;
 	}
+	inline uint32_t removeFromHands(Inventory& inv, const std::string& defName, uint32_t quantity) {
+		return removeFromHands(inv, engine::assets::AssetRegistry::Get().getDefNameId(defName), quantity);
+	}
 
 	/// Add a weight-limited armful of a two-hand material to the hands: grow an armful of the
 	/// same material already held, or seat a new one (which needs both hands free). Clamps to
 	/// the carry-weight cap and keeps the two-hand mirror in sync. Returns the amount lifted.
-	inline uint32_t addArmful(Inventory& inv, const engine::assets::AssetRegistry& registry, const std::string& defName, uint32_t quantity) {
+	inline uint32_t addArmful(Inventory& inv, const engine::assets::AssetRegistry& registry, uint32_t defNameId, uint32_t quantity) {
 		// An armful is one stack: bounded by carry weight AND the item's stackSize (the carry rule
 		// is weight-or-count, whichever binds first). For wood weight binds well below 40, so the
 		// stack cap only bites for lighter materials. Unknown/unbounded items fall back to weight.
-		const auto*	   def		 = registry.getDefinition(defName);
+		const auto*	   def		 = registry.getDefinition(defNameId);
 		const uint32_t stackCap	 = (def != nullptr && def->itemProperties.has_value()) ? def->itemProperties->stackSize : UINT32_MAX;
-		const uint32_t held		 = handHeldQuantity(inv, defName);
+		const uint32_t held		 = handHeldQuantity(inv, defNameId);
 		const uint32_t stackRoom = (held >= stackCap) ? 0U : stackCap - held;
-		const uint32_t lifted	 = std::min({quantity, cargoUnitsThatFit(inv, registry, defName), stackRoom});
+		const uint32_t lifted	 = std::min({quantity, cargoUnitsThatFit(inv, registry, defNameId), stackRoom});
 		if (lifted == 0) {
 			return 0;
 		}
-		if (inv.leftHand.has_value() && inv.leftHand->defName == defName) {
+		if (inv.leftHand.has_value() && inv.leftHand->defNameId == defNameId) {
 			inv.leftHand->quantity += lifted;
-			if (inv.rightHand.has_value() && inv.rightHand->defName == defName) {
+			if (inv.rightHand.has_value() && inv.rightHand->defNameId == defNameId) {
 				inv.rightHand->quantity += lifted;
 			}
 			return lifted;
@@ -198,10 +223,13 @@ namespace ecs {
 		if (!inv.hasHandsFree(2)) {
 			return 0;
 		}
-		inv.leftHand = ItemStack{defName, lifted};
-		inv.rightHand = ItemStack{defName, lifted};
+		inv.leftHand = ItemStack{defNameId, lifted};
+		inv.rightHand = ItemStack{defNameId, lifted};
 		return lifted;
 	}
+	inline uint32_t addArmful(Inventory& inv, const engine::assets::AssetRegistry& registry, const std::string& defName, uint32_t quantity) {
+		return addArmful(inv, registry, engine::assets::AssetRegistry::Get().internDefName(defName), quantity);
+	}
 
 	/// Stow any ONE-hand items held in the hands out of the way so both hands are free for a
 	/// two-hand armful. Stow order per slot: belt (if a slot is free) -> pack (by weight) -> drop.
@@ -216,26 +244,26 @@ namespace ecs {
 			if (!hand.has_value()) {
 				return;
 			}
-			const std::string defName  = hand->defName;
-			const uint32_t	  quantity = hand->quantity;
+			const uint32_t defNameId = hand->defNameId;
+			const uint32_t quantity	 = hand->quantity;
 			// A two-hand item occupies both hands as one mirrored stack; it can't go to belt/pack and
 			// must not be dropped here (it's not in the way of itself). Leave it for addArmful to grow.
-			if (ecs::itemIsTwoHand(registry, defName)) {
+			if (ecs::itemIsTwoHand(registry, defNameId)) {
 				return;
 			}
 			// 1. Belt: one one-hand item per slot, quantity 1 (the common held-tool case).
-			if (quantity == 1 && inv.stowToBelt(defName)) {
+			if (quantity == 1 && inv.stowToBelt(defNameId)) {
 				hand.reset();
 				return;
 			}
 			// 2. Pack: weight-respecting, only as many units as fit under the cargo cap.
-			const uint32_t fits	 = ecs::cargoUnitsThatFit(inv, registry, defName);
+			const uint32_t fits	 = ecs::cargoUnitsThatFit(inv, registry, defNameId);
 			const uint32_t toPack = std::min(quantity, fits);
-			const uint32_t packed = toPack > 0 ? inv.addItem(defName, toPack) : 0U;
+			const uint32_t packed = toPack > 0 ? inv.addItem(defNameId, toPack) : 0U;
 			// 3. Ground: whatever the belt and pack couldn't take drops at the colonist's feet.
 			const uint32_t dropped = quantity - packed;
 			if (dropped > 0) {
-				onDrop(defName, dropped);
+				onDrop(registry.getDefName(defNameId), dropped);
 			}
 			hand.reset();
 		};
@@ -262,10 +290,11 @@ namespace ecs {
 		if (quantity == 0) {
 			return 0;
 		}
+		const uint32_t defNameId = engine::assets::AssetRegistry::Get().internDefName(defName);
 
 		// Two-hand bulk goods live in the hands only; whatever weight/hands can't take drops.
-		if (ecs::itemIsTwoHand(registry, defName)) {
-			const uint32_t carried	 = ecs::addArmful(inv, registry, defName, quantity);
+		if (ecs::itemIsTwoHand(registry, defNameId)) {
+			const uint32_t carried	 = ecs::addArmful(inv, registry, defNameId, quantity);
 			const uint32_t remainder = quantity - carried;
 			if (remainder > 0) {
 				onDrop(defName, remainder);
@@ -274,23 +303,23 @@ namespace ecs {
 		}
 
 		// One-hand item: weight is the first gate. Anything over the carry-weight cap drops.
-		const uint32_t fits = ecs::cargoUnitsThatFit(inv, registry, defName);
+		const uint32_t fits = ecs::cargoUnitsThatFit(inv, registry, defNameId);
 		uint32_t	   toCarry = std::min(quantity, fits);
 		uint32_t	   carried = 0;
 
 		// 1. Empty hand(s): one unit per free hand (a hand stack is quantity 1).
 		while (carried < toCarry && inv.freeHandCount() > 0) {
 			if (!inv.rightHand.has_value()) {
-				inv.rightHand = ItemStack{defName, 1};
+				inv.rightHand = ItemStack{defNameId, 1};
 			} else {
-				inv.leftHand = ItemStack{defName, 1};
+				inv.leftHand = ItemStack{defNameId, 1};
 			}
 			++carried;
 		}
 
 		// 2. Free belt slots: one one-hand item each.
 		while (carried < toCarry && inv.beltHasFreeSlot()) {
-			if (!inv.stowToBelt(defName)) {
+			if (!inv.stowToBelt(defNameId)) {
 				break;
 			}
 			++carried;
@@ -298,7 +327,7 @@ namespace ecs {
 
 		// 3. Backpack: stack/slot limited; addItem reports what it actually seated.
 		if (carried < toCarry) {
-			carried += inv.addItem(defName, toCarry - carried);
+			carried += inv.addItem(defNameId, toCarry - carried);
 		}
 
 		// 4. Anything that didn't fit (weight cap or no slot anywhere) drops on the ground.
@@ -244,7 +244,7 @@ TEST_F(GiveItemCascadeTest, FullHands_SpillsToBelt) {
 	DropLog drops;
 	EXPECT_EQ(giveItemToColonist(inv, reg, "Axe", 1, std::ref(drops)), 1U);
 	EXPECT_TRUE(inv.belt[0].has_value()); // spilled to the first belt slot
-	EXPECT_EQ(inv.belt[0]->defName, "Axe");
+	EXPECT_EQ(inv.belt[0]->defName(), "Axe");
 	EXPECT_FALSE(inv.hasItem("Axe")); // not yet in the backpack
 	EXPECT_EQ(drops.total, 0U);
 }
@@ -309,7 +309,7 @@ TEST_F(GiveItemCascadeTest, StowHeldTool_GoesToBeltFirst) {
 	DropLog drops;
 	stowHeldOneHandItemsToFreeHands(inv, reg, std::ref(drops));
 	EXPECT_TRUE(inv.hasHandsFree(2)) << "Both hands freed for an armful";
-	EXPECT_TRUE(inv.belt[0].has_value() && inv.belt[0]->defName == "Axe") << "Axe parked on the belt";
+	EXPECT_TRUE(inv.belt[0].has_value() && inv.belt[0]->defName() == "Axe") << "Axe parked on the belt";
 	EXPECT_EQ(drops.total, 0U);
 }
 
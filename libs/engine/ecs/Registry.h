@@ -3,6 +3,8 @@
 #include "ComponentPool.h"
 #include "EntityID.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <queue>
 #include <typeindex>
@@ -55,7 +57,7 @@ public:
 
         // Remove all components
         for (auto& [typeIndex, pool] : pools) {
-            pool->remove(entity);
+            pool->remove(entity, changeTick);
         }
 
         // Increment generation to invalidate existing handles
@@ -77,7 +79,7 @@ public:
     /// Add a component to an entity
     template <typename T, typename... Args>
     T& addComponent(EntityID entity, Args&&... args) {
-        return getOrCreatePool<T>().add(entity, std::forward<Args>(args)...);
+        return getOrCreatePool<T>().add(entity, changeTick, std::forward<Args>(args)...);
     }
 
     /// Get a component from an entity (returns nullptr if not found)
@@ -105,10 +107,70 @@ public:
     template <typename T>
     void removeComponent(EntityID entity) {
         if (auto* pool = getPool<T>()) {
-            pool->remove(entity);
+            pool->remove(entity, changeTick);
         }
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    // Change Tracking
+    // ─────────────────────────────────────────────────────────────────────────
+    //
+    // Adds, replacements and removals are stamped with the current change tick.
+    // In-place writes through a component reference must be stamped explicitly
+    // with markChanged(). A consumer keeps the tick it last processed:
+    //
+    //   ChangeTick now = registry.takeChangeTick();
+    //   for (auto [e, c] : View<Colonist>(registry).changedSince(lastSeen)) { ... }
+    //   lastSeen = now;
+
+    /// Current tick, stamped on writes from now until the next takeChangeTick()
+    [[nodiscard]] ChangeTick getChangeTick() const {
+        return changeTick;
+    }
+
+    /// Return the current tick and start a new one: writes after this call compare
+    /// greater than the returned value, so nothing between two queries is missed
+    [[nodiscard]] ChangeTick takeChangeTick() {
+        return changeTick++;
+    }
+
+    /// Process-unique id of this registry's tick sequence. A fresh registry's ticks
+    /// restart at 1, so a consumer that outlives the world compares this to notice
+    /// a replacement and drop the tick it kept (moves carry the id along).
+    [[nodiscard]] uint64_t changeEpoch() const {
+        return epoch;
+    }
+
+    /// Stamp an in-place write to an entity's component (false if it has none)
+    template <typename T>
+    bool markChanged(EntityID entity) {
+        auto* pool = getPool<T>();
+        return pool && pool->markChanged(entity, changeTick);
+    }
+
+    /// True if any T was added, written or removed after `since`
+    template <typename T>
+    [[nodiscard]] bool anyChangedSince(ChangeTick since) const {
+        auto* pool = getPool<T>();
+        return pool && pool->getLastWriteTick() > since;
+    }
+
+    /// Append entities that gained a T after `since`
+    template <typename T>
+    void addedSince(ChangeTick since, std::vector<EntityID>& out) const {
+        if (auto* pool = getPool<T>()) {
+            pool->addedSince(since, out);
+        }
+    }
+
+    /// Append entities that lost a T (or were destroyed) after `since`.
+    /// Returns false if removals were missed; rebuild from a full scan instead.
+    template <typename T>
+    bool removedSince(ChangeTick since, std::vector<EntityID>& out) const {
+        auto* pool = getPool<T>();
+        return !pool || pool->removedSince(since, out);
+    }
+
     /// Get the component pool for a type (returns nullptr if none exists)
     template <typename T>
     [[nodiscard]] ComponentPool<T>* getPool() {
@@ -134,6 +196,51 @@ public:
         return livingCount;
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    // Save/Load
+    // ─────────────────────────────────────────────────────────────────────────
+    //
+    // Components hold other entities' IDs (inventory carry targets, task
+    // stations, goal destinations), so a load must hand out the exact IDs the
+    // save was taken with. The allocator is saved as-is: an index is alive
+    // unless it sits in the free list.
+
+    /// Entity allocator state: generation per index and the recycle queue, front first
+    struct AllocatorState {
+        std::vector<uint32_t> generations;
+        std::vector<uint32_t> freeList;
+    };
+
+    [[nodiscard]] AllocatorState exportAllocator() const {
+        AllocatorState state;
+        state.generations = generations;
+        state.freeList.reserve(freeList.size());
+        for (auto queue = freeList; !queue.empty(); queue.pop()) {
+            state.freeList.push_back(queue.front());
+        }
+        return state;
+    }
+
+    /// Adopt a saved allocator. Only valid before any entity exists; returns false
+    /// (and changes nothing) if entities are alive or the state is inconsistent.
+    /// Components are added afterwards against the restored IDs.
+    bool restoreAllocator(AllocatorState state) {
+        if (livingCount != 0 || !generations.empty()) {
+            return false;
+        }
+        std::vector<bool> recycled(state.generations.size(), false);
+        for (uint32_t index : state.freeList) {
+            if (index >= state.generations.size() || recycled[index]) {
+                return false;
+            }
+            recycled[index] = true;
+        }
+        generations = std::move(state.generations);
+        freeList = std::queue<uint32_t>(std::deque<uint32_t>(state.freeList.begin(), state.freeList.end()));
+        livingCount = generations.size() - state.freeList.size();
+        return true;
+    }
+
 private:
     template <typename T>
     ComponentPool<T>& getOrCreatePool() {
@@ -151,6 +258,13 @@ private:
     std::vector<uint32_t> generations;  // Generation counter per entity index
     std::queue<uint32_t> freeList;      // Recycled entity indices
     size_t livingCount = 0;
+    ChangeTick changeTick = 1;          // 0 is reserved for "never"
+    uint64_t epoch = nextEpoch();
+
+    static uint64_t nextEpoch() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
 
     std::unordered_map<std::type_index, std::unique_ptr<IComponentPool>> pools;
 };
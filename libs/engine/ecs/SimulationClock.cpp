@@ -0,0 +1,114 @@
+#include "SimulationClock.h"
+
+#include "World.h"
+#include "components/Movement.h"
+#include "components/Transform.h"
+#include "systems/DynamicEntityRenderSystem.h"
+#include "systems/TimeSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	// Record where every mover starts this tick. Entities that gained a Velocity
+	// since the last tick get their PreviousPosition after the loop, so the view's
+	// pools aren't touched mid-iteration.
+	void capturePreviousPositions(World& world) {
+		std::vector<std::pair<EntityID, glm::vec2>> added; // empty (no allocation) in steady state
+		for (auto [entity, pos, vel] : world.view<Position, Velocity>()) {
+			if (auto* prev = world.getComponent<PreviousPosition>(entity)) {
+				prev->value = pos.value;
+			} else {
+				added.emplace_back(entity, pos.value);
+			}
+		}
+		for (const auto& [entity, at] : added) {
+			world.addComponent<PreviousPosition>(entity, PreviousPosition{at});
+		}
+	}
+}  // namespace
+
+void SimulationClock::runTick(World& world) {
+	capturePreviousPositions(world);
+	world.tick(kTickSeconds);
+	++ticksRun;
+	if (afterTick) {
+		afterTick();
+	}
+}
+
+SimulationClock::FrameStats SimulationClock::advance(World& world, float frameSeconds) {
+	FrameStats stats;
+	world.beginFrame();
+
+	auto* time = world.tryGetSystem<TimeSystem>();
+	if (time != nullptr) {
+		time->setFixedStep(true);
+	}
+	const GameSpeed speed = time != nullptr ? time->speed() : GameSpeed::Normal;
+	frameSeconds = std::clamp(frameSeconds, 0.0F, kMaxFrameSeconds);
+
+	const auto start = Clock::now();
+	const auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(budgetMs));
+
+	// Game seconds the presentation band advances by (walk-cycle phase): the
+	// simulated time this frame, smooth across frames that run zero ticks.
+	float presentSeconds = 0.0F;
+
+	if (speed == GameSpeed::Max) {
+		// Budget-bound: always at least one tick so Max is never slower than a stall.
+		do {
+			runTick(world);
+			++stats.ticks;
+		} while (Clock::now() < deadline);
+		accumulator = 0.0F;
+		stats.alpha = 1.0F;
+		presentSeconds = static_cast<float>(stats.ticks) * kTickSeconds;
+	} else if (speed != GameSpeed::Paused) {
+		const float multiplier = time != nullptr ? time->speedMultiplier() : 1.0F;
+		accumulator += frameSeconds * multiplier;
+		while (accumulator >= kTickSeconds) {
+			if (stats.ticks > 0 && Clock::now() >= deadline) {
+				// Behind: keep the sub-tick remainder (for alpha), drop the rest.
+				const float whole = std::floor(accumulator / kTickSeconds) * kTickSeconds;
+				stats.droppedSeconds = whole;
+				accumulator -= whole;
+				break;
+			}
+			runTick(world);
+			accumulator -= kTickSeconds;
+			++stats.ticks;
+		}
+		stats.alpha = std::clamp(accumulator / kTickSeconds, 0.0F, 1.0F);
+		presentSeconds = frameSeconds * multiplier;
+	} else {
+		stats.alpha = std::clamp(accumulator / kTickSeconds, 0.0F, 1.0F);
+	}
+	stats.simMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+
+	if (time != nullptr) {
+		presentSeconds *= time->effectiveTimeScale();
+	}
+	if (auto* render = world.tryGetSystem<DynamicEntityRenderSystem>()) {
+		render->setInterpolationAlpha(stats.alpha);
+	}
+	world.present(presentSeconds);
+
+	last = stats;
+	return stats;
+}
+
+void SimulationClock::reset() {
+	accumulator = 0.0F;
+	ticksRun = 0;
+	last = {};
+}
+
+}  // namespace ecs
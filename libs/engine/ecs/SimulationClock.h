@@ -0,0 +1,78 @@
+#pragma once
+
+// SimulationClock - fixed-timestep driver for ecs::World.
+//
+// Decouples the simulation from the render frame rate. Real frame time, times
+// the TimeSystem speed multiplier, goes into an accumulator, and the world ticks
+// in constant kTickSeconds steps: at 10x a 60 fps frame runs ten 1/60 s ticks
+// instead of one 1/6 s step, so movement, collision and action timing come out
+// the same at every speed and frame rate. The clock puts TimeSystem into
+// fixed-step mode, which drops the speed multiplier from effectiveTimeScale().
+//
+// Ticking is bounded by a per-frame wall-clock budget. When the CPU can't keep
+// up, the whole-tick backlog is dropped and the colony runs slower than the
+// requested speed rather than spiralling. GameSpeed::Max ignores the accumulator
+// and ticks until the budget is spent.
+//
+// Once per frame, after the ticks, present() runs the render-prep band with
+// DynamicEntityRenderSystem blending movers between their last two tick
+// positions (PreviousPosition -> Position) by FrameStats::alpha, the fraction
+// of a tick left in the accumulator.
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace ecs {
+
+	class World;
+
+	class SimulationClock {
+	  public:
+		/// Simulation step every system sees, in seconds.
+		static constexpr float kTickSeconds = 1.0F / 60.0F;
+
+		/// Frame time is clamped to this before it reaches the accumulator, so a
+		/// debugger pause or window drag doesn't queue seconds of catch-up.
+		static constexpr float kMaxFrameSeconds = 0.25F;
+
+		/// Default wall-clock budget for ticking in one frame; leaves room to render at 60 fps.
+		static constexpr float kDefaultBudgetMs = 10.0F;
+
+		struct FrameStats {
+			int	  ticks = 0;			// Ticks run this frame
+			float alpha = 1.0F;			// Interpolation factor handed to rendering
+			float simMs = 0.0F;			// Wall time spent ticking
+			float droppedSeconds = 0.0F; // Backlog discarded by the budget (0 while keeping up)
+		};
+
+		/// Run this frame's ticks, calling the after-tick hook after each, then present().
+		FrameStats advance(World& world, float frameSeconds);
+
+		/// Called after every tick, before the next one. Callers drain work that
+		/// systems deferred out of their view loops (spawns, destroys) here, so the
+		/// next tick sees it exactly as it would with one tick per frame.
+		void setAfterTick(std::function<void()> callback) { afterTick = std::move(callback); }
+
+		void				setBudgetMs(float ms) { budgetMs = ms; }
+		[[nodiscard]] float budget() const { return budgetMs; }
+
+		/// Ticks run since construction (or reset()).
+		[[nodiscard]] uint64_t tickCount() const { return ticksRun; }
+
+		[[nodiscard]] const FrameStats& lastFrame() const { return last; }
+
+		/// Drop the accumulated remainder and the tick count (e.g. after loading a save).
+		void reset();
+
+	  private:
+		float				  accumulator = 0.0F;
+		float				  budgetMs = kDefaultBudgetMs;
+		uint64_t			  ticksRun = 0;
+		FrameStats			  last;
+		std::function<void()> afterTick;
+
+		void runTick(World& world);
+	};
+
+} // namespace ecs
@@ -0,0 +1,196 @@
+// SimulationClock: every tick has the same dt whatever the game speed or frame rate,
+// the accumulator carries sub-tick remainders (and reports them as the render alpha),
+// pause runs presentation only, the per-frame budget drops backlog instead of
+// spiralling, and a mover ends up in the same place at 30 fps and 144 fps.
+
+#include "SimulationClock.h"
+
+#include "World.h"
+#include "components/Movement.h"
+#include "components/Transform.h"
+#include "systems/MovementSystem.h"
+#include "systems/PhysicsSystem.h"
+#include "systems/TimeSystem.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace ecs {
+namespace {
+
+// Records the dt of every call; priority picks the simulation or presentation band.
+class ProbeSystem : public ISystem {
+  public:
+	explicit ProbeSystem(int prio)
+		: prio(prio) {}
+
+	void update(float deltaTime) override { calls.push_back(deltaTime); }
+	[[nodiscard]] int		  priority() const override { return prio; }
+	[[nodiscard]] const char* name() const override { return "Probe"; }
+
+	std::vector<float> calls;
+
+  private:
+	int prio;
+};
+
+class SimProbe : public ProbeSystem {
+  public:
+	SimProbe()
+		: ProbeSystem(500) {}
+};
+
+class PresentProbe : public ProbeSystem {
+  public:
+	PresentProbe()
+		: ProbeSystem(World::kPresentationPriority) {}
+};
+
+class SimulationClockTest : public ::testing::Test {
+  protected:
+	void SetUp() override {
+		world = std::make_unique<World>();
+		timeSystem = &world->registerSystem<TimeSystem>();
+		sim = &world->registerSystem<SimProbe>();
+		present = &world->registerSystem<PresentProbe>();
+	}
+
+	std::unique_ptr<World> world;
+	TimeSystem*			   timeSystem = nullptr;
+	SimProbe*			   sim = nullptr;
+	PresentProbe*		   present = nullptr;
+	SimulationClock		   clock;
+};
+
+constexpr float kFrame60 = 1.0F / 60.0F;
+
+TEST_F(SimulationClockTest, FastForwardRunsMoreTicksNotBiggerOnes) {
+	timeSystem->setSpeed(GameSpeed::VeryFast);
+	clock.setBudgetMs(1000.0F);
+
+	// Accumulated frame time lands a hair under a whole tick now and then, so look
+	// at the total over several frames rather than one.
+	int ticks = 0;
+	for (int i = 0; i < 6; ++i) {
+		ticks += clock.advance(*world, kFrame60).ticks;
+	}
+	EXPECT_GE(ticks, 59);
+	EXPECT_LE(ticks, 60);
+	ASSERT_EQ(sim->calls.size(), static_cast<size_t>(ticks));
+	for (float dt : sim->calls) {
+		EXPECT_FLOAT_EQ(dt, SimulationClock::kTickSeconds);
+	}
+	EXPECT_TRUE(timeSystem->isFixedStep());
+	EXPECT_FLOAT_EQ(timeSystem->effectiveTimeScale(), 1.0F) << "speed comes from tick count, not the step";
+	EXPECT_EQ(present->calls.size(), 6U) << "presentation runs once per frame";
+}
+
+TEST_F(SimulationClockTest, AccumulatorCarriesRemainderAsAlpha) {
+	// 100 fps at 1x: 0.6 of a tick after one frame, one tick and 0.2 left after two.
+	auto first = clock.advance(*world, 0.01F);
+	EXPECT_EQ(first.ticks, 0);
+	EXPECT_NEAR(first.alpha, 0.6F, 1e-3F);
+
+	auto second = clock.advance(*world, 0.01F);
+	EXPECT_EQ(second.ticks, 1);
+	EXPECT_NEAR(second.alpha, 0.2F, 1e-3F);
+	EXPECT_EQ(clock.tickCount(), 1U);
+}
+
+TEST_F(SimulationClockTest, PauseRunsPresentationOnly) {
+	timeSystem->setSpeed(GameSpeed::Paused);
+	for (int i = 0; i < 5; ++i) {
+		EXPECT_EQ(clock.advance(*world, kFrame60).ticks, 0);
+	}
+	EXPECT_TRUE(sim->calls.empty());
+	ASSERT_EQ(present->calls.size(), 5U);
+	EXPECT_FLOAT_EQ(present->calls.back(), 0.0F) << "no animation time passes while paused";
+}
+
+TEST_F(SimulationClockTest, BudgetDropsBacklogInsteadOfSpiralling) {
+	timeSystem->setSpeed(GameSpeed::VeryFast);
+	clock.setBudgetMs(0.0F);
+
+	auto stats = clock.advance(*world, SimulationClock::kMaxFrameSeconds);
+	EXPECT_EQ(stats.ticks, 1) << "always makes progress, then stops at the budget";
+	EXPECT_GT(stats.droppedSeconds, 0.0F);
+	EXPECT_LT(stats.alpha, 1.0F);
+
+	// The dropped time is gone: the next frame doesn't try to repay it.
+	clock.setBudgetMs(1000.0F);
+	stats = clock.advance(*world, 0.0F);
+	EXPECT_EQ(stats.ticks, 0);
+}
+
+TEST_F(SimulationClockTest, MaxSpeedTicksUntilBudgetAndFeedsHooks) {
+	timeSystem->setSpeed(GameSpeed::Max);
+	clock.setBudgetMs(2.0F);
+	int hookCalls = 0;
+	clock.setAfterTick([&hookCalls]() { ++hookCalls; });
+
+	auto stats = clock.advance(*world, kFrame60);
+	EXPECT_GE(stats.ticks, 1);
+	EXPECT_EQ(hookCalls, stats.ticks) << "deferred work drains after every tick";
+	EXPECT_FLOAT_EQ(stats.alpha, 1.0F);
+}
+
+// The point of the fixed step: a mover's trajectory depends on the tick count only,
+// not on how frames slice real time.
+TEST(SimulationClockDeterminism, SameTicksSamePositionAtAnyFrameRate) {
+	constexpr uint64_t kTicks = 300;
+	auto run = [](float frameSeconds) {
+		World world;
+		world.registerSystem<TimeSystem>().setSpeed(GameSpeed::VeryFast);
+		world.registerSystem<MovementSystem>();
+		world.registerSystem<PhysicsSystem>();
+		auto entity = world.createEntity();
+		world.addComponent<Position>(entity, Position{{0.0F, 0.0F}});
+		world.addComponent<Velocity>(entity, Velocity{{0.0F, 0.0F}});
+		world.addComponent<MovementTarget>(entity, MovementTarget{{40.0F, 7.0F}, 2.0F, true});
+
+		// Sample at the tick itself: frames can end past kTicks by different amounts.
+		SimulationClock clock;
+		clock.setBudgetMs(1000.0F);
+		glm::vec2 at{0.0F, 0.0F};
+		clock.setAfterTick([&]() {
+			if (clock.tickCount() == kTicks) {
+				at = world.getComponent<Position>(entity)->value;
+			}
+		});
+		while (clock.tickCount() < kTicks) {
+			clock.advance(world, frameSeconds);
+		}
+		return at;
+	};
+
+	const glm::vec2 at30 = run(1.0F / 30.0F);
+	const glm::vec2 at144 = run(1.0F / 144.0F);
+	EXPECT_GT(at30.x, 0.0F);
+	EXPECT_EQ(at30.x, at144.x);
+	EXPECT_EQ(at30.y, at144.y);
+}
+
+TEST(SimulationClockInterpolation, MoversGetPreviousPosition) {
+	World world;
+	world.registerSystem<TimeSystem>();
+	world.registerSystem<PhysicsSystem>();
+	auto entity = world.createEntity();
+	world.addComponent<Position>(entity, Position{{0.0F, 0.0F}});
+	world.addComponent<Velocity>(entity, Velocity{{6.0F, 0.0F}});
+	auto still = world.createEntity();
+	world.addComponent<Position>(still, Position{{1.0F, 1.0F}});
+
+	SimulationClock clock;
+	clock.advance(world, kFrame60 * 1.5F);
+
+	const auto* prev = world.getComponent<PreviousPosition>(entity);
+	ASSERT_NE(prev, nullptr);
+	EXPECT_FLOAT_EQ(prev->value.x, 0.0F);
+	EXPECT_NEAR(world.getComponent<Position>(entity)->value.x, 6.0F * SimulationClock::kTickSeconds, 1e-5F);
+	EXPECT_EQ(world.getComponent<PreviousPosition>(still), nullptr) << "only movers pay for interpolation";
+}
+
+}  // namespace
+}  // namespace ecs
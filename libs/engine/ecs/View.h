@@ -16,11 +16,19 @@ class View {
 public:
     explicit View(Registry& registry) : registry(registry) {}
 
+    /// Narrow the view to entities where any of the viewed components was added
+    /// or written after `since` (see Registry change tracking)
+    [[nodiscard]] View changedSince(ChangeTick since) const {
+        View narrowed(registry);
+        narrowed.sinceTick = since;
+        return narrowed;
+    }
+
     /// Iterator for View
     class Iterator {
     public:
-        Iterator(Registry& registry, size_t index, size_t size)
-            : registry(registry), currentIndex(index), poolSize(size) {
+        Iterator(Registry& registry, size_t index, size_t size, ChangeTick since)
+            : registry(registry), currentIndex(index), poolSize(size), sinceTick(since) {
             // Skip to first valid entity
             skipInvalid();
         }
@@ -54,7 +62,7 @@ public:
 
             while (currentIndex < poolSize) {
                 EntityID entity = smallestPool->getEntity(currentIndex);
-                if (hasAllComponents(entity)) {
+                if (hasAllComponents(entity) && (sinceTick == 0 || anyChanged(entity))) {
                     break;
                 }
                 ++currentIndex;
@@ -65,19 +73,24 @@ public:
             return (registry.hasComponent<Components>(entity) && ...);
         }
 
+        bool anyChanged(EntityID entity) {
+            return ((registry.getPool<Components>()->changedTickOf(entity) > sinceTick) || ...);
+        }
+
         Registry& registry;
         size_t currentIndex;
         size_t poolSize;
+        ChangeTick sinceTick;
     };
 
     [[nodiscard]] Iterator begin() {
         size_t size = getSmallestPoolSize();
-        return Iterator(registry, 0, size);
+        return Iterator(registry, 0, size, sinceTick);
     }
 
     [[nodiscard]] Iterator end() {
         size_t size = getSmallestPoolSize();
-        return Iterator(registry, size, size);
+        return Iterator(registry, size, size, sinceTick);
     }
 
 private:
@@ -91,6 +104,7 @@ private:
     }
 
     Registry& registry;
+    ChangeTick sinceTick = 0; // 0: no change filter
 };
 
 }  // namespace ecs
@@ -94,6 +94,44 @@ public:
         registry.removeComponent<T>(entity);
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    // Change Tracking (delegated to Registry)
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /// Return the current change tick and start a new one (see Registry)
+    [[nodiscard]] ChangeTick takeChangeTick() {
+        return registry.takeChangeTick();
+    }
+
+    /// Identifies this world's tick sequence (see Registry::changeEpoch)
+    [[nodiscard]] uint64_t changeEpoch() const {
+        return registry.changeEpoch();
+    }
+
+    /// Stamp an in-place write to an entity's component
+    template <typename T>
+    bool markChanged(EntityID entity) {
+        return registry.markChanged<T>(entity);
+    }
+
+    /// True if any T was added, written or removed after `since`
+    template <typename T>
+    [[nodiscard]] bool anyChangedSince(ChangeTick since) const {
+        return registry.anyChangedSince<T>(since);
+    }
+
+    /// Append entities that gained a T after `since`
+    template <typename T>
+    void addedSince(ChangeTick since, std::vector<EntityID>& out) const {
+        registry.addedSince<T>(since, out);
+    }
+
+    /// Append entities that lost a T after `since`; false if removals were missed
+    template <typename T>
+    bool removedSince(ChangeTick since, std::vector<EntityID>& out) const {
+        return registry.removedSince<T>(since, out);
+    }
+
     // ─────────────────────────────────────────────────────────────────────────
     // View (Query) System
     // ─────────────────────────────────────────────────────────────────────────
@@ -151,33 +189,44 @@ public:
         return it == systemMap.end() ? nullptr : static_cast<T*>(it->second);
     }
 
-    /// Update all systems in priority order
+    /// Get a registered system by type, or nullptr (const)
+    template <typename T>
+    [[nodiscard]] const T* tryGetSystem() const {
+        auto it = systemMap.find(std::type_index(typeid(T)));
+        return it == systemMap.end() ? nullptr : static_cast<const T*>(it->second);
+    }
+
+    /// First priority of the presentation band (ISystem: 900-999 is rendering
+    /// preparation). tick() runs the systems below it, present() the rest.
+    static constexpr int kPresentationPriority = 900;
+
+    /// Update all systems in priority order: one simulation tick, then presentation.
     void update(float deltaTime) {
+        beginFrame();
+        tick(deltaTime);
+        present(deltaTime);
+    }
+
+    /// Reset the per-system timings. tick()/present() add to them until the next
+    /// beginFrame(), so a frame that runs several ticks reports their sum.
+    void beginFrame() {
         sortSystemsIfNeeded();
+        for (auto& timing : systemTimings) {
+            timing.durationMs = 0.0F;
+        }
+    }
 
-#if ECS_ENABLE_SYSTEM_TIMING
-        systemTimings.clear();
-        // Note: capacity is retained from previous frames, no allocation after first frame
+    /// Run the simulation systems (priority < kPresentationPriority) once.
+    void tick(float deltaTime) {
+        runSystems(0, firstPresentationSystem, deltaTime);
+    }
 
-        for (auto& system : systems) {
-            auto start = std::chrono::high_resolution_clock::now();
-            system->update(deltaTime);
-            auto end = std::chrono::high_resolution_clock::now();
-
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-            systemTimings.push_back({
-                system->name(),
-                duration.count() / 1000.0F
-            });
-        }
-#else
-        for (auto& system : systems) {
-            system->update(deltaTime);
-        }
-#endif
+    /// Run the presentation systems (priority >= kPresentationPriority) once.
+    void present(float deltaTime) {
+        runSystems(firstPresentationSystem, systems.size(), deltaTime);
     }
 
-    /// Get timing information from last update (for profiling)
+    /// Get timing information from the current frame (for profiling)
     [[nodiscard]] const std::vector<SystemTiming>& getSystemTimings() const {
         return systemTimings;
     }
@@ -202,18 +251,47 @@ private:
             return;
         }
 
-        std::sort(systems.begin(), systems.end(),
+        std::stable_sort(systems.begin(), systems.end(),
                   [](const std::unique_ptr<ISystem>& a, const std::unique_ptr<ISystem>& b) {
                       return a->priority() < b->priority();
                   });
 
+        firstPresentationSystem = systems.size();
+        systemTimings.clear();
+        for (size_t i = 0; i < systems.size(); ++i) {
+            if (firstPresentationSystem == systems.size() && systems[i]->priority() >= kPresentationPriority) {
+                firstPresentationSystem = i;
+            }
+            systemTimings.push_back({systems[i]->name(), 0.0F});
+        }
+
         sorted = true;
     }
 
+    void runSystems(size_t begin, size_t end, float deltaTime) {
+        sortSystemsIfNeeded();
+
+#if ECS_ENABLE_SYSTEM_TIMING
+        for (size_t i = begin; i < end; ++i) {
+            auto start = std::chrono::high_resolution_clock::now();
+            systems[i]->update(deltaTime);
+            auto finish = std::chrono::high_resolution_clock::now();
+
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(finish - start);
+            systemTimings[i].durationMs += duration.count() / 1000.0F;
+        }
+#else
+        for (size_t i = begin; i < end; ++i) {
+            systems[i]->update(deltaTime);
+        }
+#endif
+    }
+
     Registry registry;
     std::vector<std::unique_ptr<ISystem>> systems;
     std::unordered_map<std::type_index, ISystem*> systemMap;
-    std::vector<SystemTiming> systemTimings;
+    std::vector<SystemTiming> systemTimings; // parallel to systems once sorted
+    size_t firstPresentationSystem = 0;
     bool sorted = false;
 };
 
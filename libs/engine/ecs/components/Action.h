@@ -130,8 +130,8 @@ namespace ecs {
 	/// Effect for item collection actions (Pickup, Harvest)
 	/// Adds items to inventory and optionally affects the source entity.
 	struct CollectionEffect {
-		/// Item definition name to add to inventory
-		std::string itemDefName;
+		/// Item to add to inventory (AssetRegistry defName id)
+		uint32_t itemDefNameId = 0;
 
 		/// Quantity of items to collect
 		uint32_t quantity = 1;
@@ -149,7 +149,7 @@ namespace ecs {
 		float regrowthTime = 0.0F;
 
 		/// Storage-to-storage pull only (ActionType::Withdraw): the SOURCE box entity to take items
-		/// FROM. When non-zero the collection removes `quantity` of `itemDefName` from that box's
+		/// FROM. When non-zero the collection removes `quantity` of `itemDefNameId` from that box's
 		/// Inventory (clamped to the live quantity) instead of touching a ground entity; the pile/pool/
 		/// single-shot ground paths are bypassed. 0 for a ground Pickup or a Harvest.
 		uint64_t sourceStorageId = 0;
@@ -158,8 +158,8 @@ namespace ecs {
 	/// Effect for consuming items from inventory (Eat action)
 	/// Removes item from inventory and restores a need, with optional side effect.
 	struct ConsumptionEffect {
-		/// Item definition name to consume from inventory
-		std::string itemDefName;
+		/// Item to consume from inventory (AssetRegistry defName id)
+		uint32_t itemDefNameId = 0;
 
 		/// Quantity to consume
 		uint32_t quantity = 1;
@@ -215,18 +215,18 @@ namespace ecs {
 		/// Station entity ID (for updating WorkQueue)
 		uint64_t stationEntityId = 0;
 
-		/// Input items to consume (defName -> count)
-		std::vector<std::pair<std::string, uint32_t>> inputs;
+		/// Input items to consume (defName id -> count)
+		std::vector<std::pair<uint32_t, uint32_t>> inputs;
 
-		/// Output items to produce (defName -> count)
-		std::vector<std::pair<std::string, uint32_t>> outputs;
+		/// Output items to produce (defName id -> count)
+		std::vector<std::pair<uint32_t, uint32_t>> outputs;
 	};
 
 	/// Effect for deposit actions (putting items into storage containers)
 	/// Moves item from colonist inventory to storage container inventory.
 	struct DepositEffect {
-		/// Item definition name to deposit
-		std::string itemDefName;
+		/// Item to deposit (AssetRegistry defName id)
+		uint32_t itemDefNameId = 0;
 
 		/// Quantity to deposit
 		uint32_t quantity = 1;
@@ -378,9 +378,9 @@ namespace ecs {
 		/// Factory: Eat action - consume food from inventory
 		/// Colonists always eat from inventory. Food must be harvested/collected first.
 		/// Eating restores hunger and fills digestion (food enters gut).
-		/// @param itemDefName Item to consume from inventory
+		/// @param itemDefNameId Item to consume from inventory
 		/// @param nutrition Amount of hunger to restore (0-1 scale)
-		static Action Eat(const std::string& itemDefName, float nutrition) {
+		static Action Eat(uint32_t itemDefNameId, float nutrition) {
 			Action action;
 			action.type = ActionType::Eat;
 			action.state = ActionState::Starting;
@@ -388,7 +388,7 @@ namespace ecs {
 			action.interruptable = false; // Can't stop mid-bite!
 
 			ConsumptionEffect consumeEff;
-			consumeEff.itemDefName = itemDefName;
+			consumeEff.itemDefNameId = itemDefNameId;
 			consumeEff.quantity = 1;
 			consumeEff.need = NeedType::Hunger;
 			consumeEff.restoreAmount = nutrition * 100.0F;
@@ -493,11 +493,11 @@ namespace ecs {
 		}
 
 		/// Factory: Pickup action - instantly pick up a ground item
-		/// @param itemDefName Item definition to add to inventory
+		/// @param itemDefNameId Item to add to inventory
 		/// @param quantity Number of items to pick up
 		/// @param sourcePos Position of the source entity
 		/// @param sourceDefName DefName of the source entity (for removal)
-		static Action Pickup(const std::string& itemDefName, uint32_t quantity, glm::vec2 sourcePos, const std::string& sourceDefName) {
+		static Action Pickup(uint32_t itemDefNameId, uint32_t quantity, glm::vec2 sourcePos, const std::string& sourceDefName) {
 			Action action;
 			action.type = ActionType::Pickup;
 			action.state = ActionState::Starting;
@@ -506,7 +506,7 @@ namespace ecs {
 			action.interruptable = false; // Don't interrupt mid-pickup
 
 			CollectionEffect collEff;
-			collEff.itemDefName = itemDefName;
+			collEff.itemDefNameId = itemDefNameId;
 			collEff.quantity = quantity;
 			collEff.sourcePosition = sourcePos;
 			collEff.sourceDefName = sourceDefName;
@@ -521,11 +521,11 @@ namespace ecs {
 		/// inventory (the pickup leg of a storage->storage pull). Mirrors Pickup, but the source is a
 		/// box's Inventory (sourceStorageId), not a ground entity: the effect removes from that box
 		/// (clamped to its live quantity) and never destroys it.
-		/// @param itemDefName Item to take from the source box and add to inventory
+		/// @param itemDefNameId Item to take from the source box and add to inventory
 		/// @param quantity Number of items to withdraw
 		/// @param sourceStorageId Entity ID of the source storage container
 		/// @param sourcePos Position of the source box (the walk-to target)
-		static Action Withdraw(const std::string& itemDefName, uint32_t quantity, uint64_t sourceStorageId, glm::vec2 sourcePos) {
+		static Action Withdraw(uint32_t itemDefNameId, uint32_t quantity, uint64_t sourceStorageId, glm::vec2 sourcePos) {
 			Action action;
 			action.type = ActionType::Withdraw;
 			action.state = ActionState::Starting;
@@ -534,10 +534,9 @@ namespace ecs {
 			action.interruptable = false; // Don't interrupt mid-withdraw
 
 			CollectionEffect collEff;
-			collEff.itemDefName = itemDefName;
+			collEff.itemDefNameId = itemDefNameId;
 			collEff.quantity = quantity;
 			collEff.sourcePosition = sourcePos;
-			collEff.sourceDefName = itemDefName; // unused by the box-withdraw path, but kept consistent
 			collEff.destroySource = false; // never destroy the box
 			collEff.regrowthTime = 0.0F;
 			collEff.sourceStorageId = sourceStorageId;
@@ -547,7 +546,7 @@ namespace ecs {
 		}
 
 		/// Factory: Harvest action - harvest items from an entity
-		/// @param itemDefName Item definition to yield
+		/// @param itemDefNameId Item to yield
 		/// @param quantity Number of items to harvest
 		/// @param harvestDuration Time to complete harvest
 		/// @param sourcePos Position of the source entity
@@ -555,7 +554,7 @@ namespace ecs {
 		/// @param destructive If true, entity is destroyed after harvest
 		/// @param regrowthTime If not destructive, time until harvestable again
 		static Action Harvest(
-			const std::string& itemDefName,
+			uint32_t		   itemDefNameId,
 			uint32_t		   quantity,
 			float			   harvestDuration,
 			glm::vec2		   sourcePos,
@@ -571,7 +570,7 @@ namespace ecs {
 			action.interruptable = false; // Don't interrupt mid-harvest
 
 			CollectionEffect collEff;
-			collEff.itemDefName = itemDefName;
+			collEff.itemDefNameId = itemDefNameId;
 			collEff.quantity = quantity;
 			collEff.sourcePosition = sourcePos;
 			collEff.sourceDefName = sourceDefName;
@@ -587,15 +586,15 @@ namespace ecs {
 		/// @param stationEntityId Entity ID of the crafting station
 		/// @param stationPos Position of the station
 		/// @param workAmount Work ticks to complete (converted to seconds)
-		/// @param inputs Input items to consume (defName -> count)
-		/// @param outputs Output items to produce (defName -> count)
+		/// @param inputs Input items to consume (defName id -> count)
+		/// @param outputs Output items to produce (defName id -> count)
 		static Action Craft(
-			const std::string&									 recipeDefName,
-			uint64_t											 stationEntityId,
-			glm::vec2											 stationPos,
-			float												 workAmount,
-			const std::vector<std::pair<std::string, uint32_t>>& inputs,
-			const std::vector<std::pair<std::string, uint32_t>>& outputs
+			const std::string&								  recipeDefName,
+			uint64_t										  stationEntityId,
+			glm::vec2										  stationPos,
+			float											  workAmount,
+			const std::vector<std::pair<uint32_t, uint32_t>>& inputs,
+			const std::vector<std::pair<uint32_t, uint32_t>>& outputs
 		) {
 			Action action;
 			action.type = ActionType::Craft;
@@ -617,18 +616,18 @@ namespace ecs {
 		}
 
 		/// Factory: Deposit action - deposit items into a storage container
-		/// @param itemDefName Item to deposit from inventory
+		/// @param itemDefNameId Item to deposit from inventory
 		/// @param quantity Number of items to deposit
 		/// @param storageEntityId Entity ID of the target storage container
 		/// @param storagePos Position of the storage container
 		/// @param deliverToCraftStation If true, the target is a crafting station: items stay
 		///        in inventory and the deposit only marks them delivered (see DepositEffect).
 		static Action Deposit(
-			const std::string& itemDefName,
-			uint32_t		   quantity,
-			uint64_t		   storageEntityId,
-			glm::vec2		   storagePos,
-			bool			   deliverToCraftStation = false
+			uint32_t  itemDefNameId,
+			uint32_t  quantity,
+			uint64_t  storageEntityId,
+			glm::vec2 storagePos,
+			bool	  deliverToCraftStation = false
 		) {
 			Action action;
 			action.type = ActionType::Deposit;
@@ -638,7 +637,7 @@ namespace ecs {
 			action.interruptable = false; // Don't interrupt mid-deposit
 
 			DepositEffect depEff;
-			depEff.itemDefName = itemDefName;
+			depEff.itemDefNameId = itemDefNameId;
 			depEff.quantity = quantity;
 			depEff.storageEntityId = storageEntityId;
 			depEff.deliverToCraftStation = deliverToCraftStation;
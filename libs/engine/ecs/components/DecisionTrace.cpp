@@ -0,0 +1,120 @@
+#include "DecisionTrace.h"
+
+#include "assets/AssetRegistry.h"
+#include "assets/RecipeDef.h"
+
+#include <utils/Log.h>
+
+namespace ecs {
+
+	namespace {
+
+		/// Get a human-readable name for a need type
+		[[nodiscard]] const char* needTypeName(NeedType need) {
+			switch (need) {
+				case NeedType::Hunger:
+					return "Hunger";
+				case NeedType::Thirst:
+					return "Thirst";
+				case NeedType::Energy:
+					return "Energy";
+				case NeedType::Bladder:
+					return "Bladder";
+				case NeedType::Digestion:
+					return "Digestion";
+				case NeedType::Count:
+					break;
+			}
+			// All valid NeedTypes must be handled above - hitting this is a bug
+			LOG_ERROR(Engine, "needTypeName: unhandled NeedType %d", static_cast<int>(need));
+			return "Unknown";
+		}
+
+		/// "<Need> at N%" plus what the status says about it
+		[[nodiscard]] std::string describeNeed(const EvaluatedOption& option) {
+			std::string reason = needTypeName(option.needType);
+			reason += " at " + std::to_string(static_cast<int>(option.needValue)) + "%";
+
+			if (option.status == OptionStatus::NoSource) {
+				reason += " (no known source)";
+			} else if (option.needValue < 10.0F) {
+				reason += " (critical)";
+			} else if (option.isActionable()) {
+				if (option.distanceToTarget > 0.0F) {
+					reason += " (" + std::to_string(static_cast<int>(option.distanceToTarget)) + "m away)";
+				} else if (option.targetPosition.has_value()) {
+					reason += " (using ground)";
+				}
+			} else if (option.status == OptionStatus::Satisfied) {
+				reason += " (satisfied)";
+			}
+
+			return reason;
+		}
+
+		/// Friendly label for a def ("Oak Tree", not "Flora_TreeOak"), falling back to the defName
+		[[nodiscard]] std::string labelOf(const engine::assets::AssetRegistry& registry, uint32_t defNameId) {
+			const auto& defName = registry.getDefName(defNameId);
+			const auto* def = registry.getDefinition(defName);
+			return (def != nullptr && !def->label.empty()) ? def->label : defName;
+		}
+
+		[[nodiscard]] std::string recipeLabel(const EvaluatedOption& option) {
+			return option.craftRecipe != nullptr ? option.craftRecipe->label : std::string("recipe");
+		}
+
+	} // namespace
+
+	std::string describeOption(const EvaluatedOption& option, const engine::assets::AssetRegistry& registry) {
+		switch (option.reason) {
+			case OptionReason::None:
+				return {};
+			case OptionReason::Need:
+				return describeNeed(option);
+			case OptionReason::NeedFromInventory:
+				return option.isActionable() ? describeNeed(option) + " (from inventory)" : describeNeed(option);
+			case OptionReason::NeedFromHarvest:
+				return option.isActionable() ? describeNeed(option) + " (harvest)" : describeNeed(option);
+			case OptionReason::GatherFood:
+				return "Gathering food (inventory empty)";
+			case OptionReason::NoFoodSource:
+				return "No food source known";
+			case OptionReason::DeliverToBuildSite:
+				return "Delivering " + registry.getDefName(option.haulItemDefNameId) + " to build site";
+			case OptionReason::DeliverToStation:
+				return "Delivering " + registry.getDefName(option.haulItemDefNameId) + " to crafting station";
+			case OptionReason::StockStorage:
+				return "Stocking " + registry.getDefName(option.haulItemDefNameId) + " into storage";
+			case OptionReason::FetchForCraft:
+				return "Fetching " + registry.getDefName(option.haulItemDefNameId) + " for crafting";
+			case OptionReason::HaulToStorage:
+				return "Hauling " + registry.getDefName(option.haulItemDefNameId) + " to storage";
+			case OptionReason::PullFromStorage:
+				return "Pulling " + registry.getDefName(option.haulItemDefNameId) + " from lower-priority storage";
+			case OptionReason::Harvest:
+				return "Cutting " + labelOf(registry, option.targetDefNameId.value_or(0)) + " for " +
+					   labelOf(registry, option.harvestYieldDefNameId);
+			case OptionReason::Build:
+				return "Building structure";
+			case OptionReason::Deconstruct:
+				return "Deconstructing structure";
+			case OptionReason::DeliverPackaged:
+				return "Delivering " + registry.getDefName(option.placePackagedDefNameId);
+			case OptionReason::PlacePackaged:
+				return "Placing " + registry.getDefName(option.placePackagedDefNameId);
+			case OptionReason::Craft:
+				return "Crafting " + recipeLabel(option);
+			case OptionReason::CraftAwaitingMaterials:
+				return "Crafting " + recipeLabel(option) + " (awaiting materials)";
+			case OptionReason::Idle:
+				return "All needs satisfied";
+		}
+		return {};
+	}
+
+	std::string describeSelection(const DecisionTrace& trace, const engine::assets::AssetRegistry& registry) {
+		const auto* selected = trace.getSelected();
+		return selected != nullptr ? "Selected: " + describeOption(*selected, registry) : std::string();
+	}
+
+} // namespace ecs
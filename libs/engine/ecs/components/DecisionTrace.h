@@ -3,6 +3,11 @@
 // Decision Trace Component for Task Queue Display
 // Captures why a colonist chose their current task and what alternatives exist.
 // See /docs/design/game-systems/colonists/decision-trace.md for design details.
+//
+// Options are plain records: the reason is an OptionReason code plus the option's own
+// ids and numbers, so an evaluation allocates no strings. Text is built by
+// describeOption()/describeSelection() only when something (the task list, a log
+// line, the committed Task::reason) actually reads it.
 
 #include "Needs.h"
 #include "Task.h"
@@ -15,6 +20,11 @@
 #include <string>
 #include <vector>
 
+namespace engine::assets {
+	class AssetRegistry;
+	struct RecipeDef;
+} // namespace engine::assets
+
 namespace ecs {
 
 	/// Maximum number of options to display in the UI (configurable for future expansion)
@@ -28,6 +38,31 @@ namespace ecs {
 		Satisfied  // Need above threshold, no action needed
 	};
 
+	/// Why an option exists, formatted on demand by describeOption(). The parameters
+	/// named on the right are the option fields the text is built from.
+	enum class OptionReason : uint8_t {
+		None,
+		Need,					// needType, needValue, status, distanceToTarget
+		NeedFromInventory,		// Need, eaten from carried food
+		NeedFromHarvest,		// Need, met by harvesting a known food source
+		GatherFood,				// no food carried, a harvestable is known
+		NoFoodSource,			// no food carried and none known
+		DeliverToBuildSite,		// haulItemDefNameId
+		DeliverToStation,		// haulItemDefNameId
+		StockStorage,			// haulItemDefNameId (carried into a stocking box)
+		FetchForCraft,			// haulItemDefNameId
+		HaulToStorage,			// haulItemDefNameId
+		PullFromStorage,		// haulItemDefNameId
+		Harvest,				// targetDefNameId (source), harvestYieldDefNameId
+		Build,
+		Deconstruct,
+		DeliverPackaged,		// placePackagedDefNameId (already carried)
+		PlacePackaged,			// placePackagedDefNameId
+		Craft,					// craftRecipe
+		CraftAwaitingMaterials, // craftRecipe
+		Idle					// wander: all needs satisfied
+	};
+
 	/// A single evaluated task option in the decision trace
 	struct EvaluatedOption {
 		TaskType taskType = TaskType::None;
@@ -47,11 +82,11 @@ namespace ecs {
 
 
 		// Crafting-specific fields (for Craft tasks)
-		std::string craftRecipeDefName;
-		uint64_t	stationEntityId = 0;
+		const engine::assets::RecipeDef* craftRecipe = nullptr; // Owned by RecipeRegistry
+		uint64_t						 stationEntityId = 0;
 
 		// Hauling-specific fields (for Haul tasks)
-		std::string				 haulItemDefName;		  // Item to haul
+		uint32_t				 haulItemDefNameId = 0;	  // Item to haul (AssetRegistry id)
 		uint32_t				 haulQuantity = 1;		  // Quantity to haul
 		std::optional<glm::vec2> haulSourcePosition;	  // Where to pick up from
 		uint64_t				 haulSourceStorageId = 0; // Source box entity ID for a storage->storage pull (0 = loose/inventory source)
@@ -62,6 +97,7 @@ namespace ecs {
 
 		// PlacePackaged-specific fields (for PlacePackaged tasks)
 		uint64_t				 placePackagedEntityId = 0; // Entity ID of packaged item
+		uint32_t				 placePackagedDefNameId = 0; // Its defName (for display)
 		std::optional<glm::vec2> placeSourcePosition;		// Where the packaged item is
 		std::optional<glm::vec2> placeTargetPosition;		// Where to place it
 
@@ -118,8 +154,8 @@ namespace ecs {
 		// stable id it has (goal id, station/entity id, etc.); higherPriority() breaks ties on it.
 		uint64_t tiebreakId = 0;
 
-		// Human-readable explanation for UI
-		std::string reason;
+		// Why this option exists; describeOption() turns it into text for the UI
+		OptionReason reason = OptionReason::None;
 
 		/// Compose the within-tier score from its breakdown fields. Score orders options WITHIN one
 		/// tier only (tier is compared first), so it never needs to encode categorical priority.
@@ -155,13 +191,9 @@ namespace ecs {
 		/// Timestamp of last evaluation (game time in seconds)
 		float lastEvaluationTime = 0.0F;
 
-		/// Summary of why the current task was selected
-		std::string selectionSummary;
-
-		/// Clear the trace for re-evaluation
+		/// Clear the trace for re-evaluation (keeps the option storage for the next one)
 		void clear() {
 			options.clear();
-			selectionSummary.clear();
 			// Note: lastEvaluationTime is set by the system after building
 		}
 
@@ -179,4 +211,11 @@ namespace ecs {
 		[[nodiscard]] size_t displayCount() const { return std::min(options.size(), kMaxDisplayedOptions); }
 	};
 
+	/// Human-readable explanation of an option, e.g. "Hunger at 8% (critical)" or
+	/// "Hauling Wood to storage". Ids are resolved through `registry`.
+	[[nodiscard]] std::string describeOption(const EvaluatedOption& option, const engine::assets::AssetRegistry& registry);
+
+	/// "Selected: <reason>" for the trace's selected option, or empty if none was selected
+	[[nodiscard]] std::string describeSelection(const DecisionTrace& trace, const engine::assets::AssetRegistry& registry);
+
 } // namespace ecs
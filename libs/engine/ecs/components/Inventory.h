@@ -13,6 +13,12 @@
 // - There is no per-container stack cap; the item's stackSize is the only bound.
 // - A defName with no asset def / no itemProperties is unbounded (no stack cap):
 //   bare-defName unit tests run without a registry and must not be capped at 1.
+// - Stacks hold AssetRegistry defName ids, so every lookup is an integer compare.
+//   Each operation also has a defName overload for callers at the string boundary
+//   (UI, dev commands, tests); those intern the name (AssetRegistry::internDefName)
+//   when adding, and only look it up when querying.
+// - An InventoryObserver may be attached to hear every backpack quantity change
+//   (ResourceLedgerSystem attaches one to each storage container).
 //
 // Related docs:
 // - /docs/technical/physical-stack-inventory.md
@@ -32,8 +38,31 @@ namespace ecs {
 
 	/// One physical stack: a single material, quantity in [1, stackSize].
 	struct ItemStack {
-		std::string defName;
-		uint32_t	quantity = 0;
+		uint32_t defNameId = 0; // AssetRegistry interned id
+		uint32_t quantity = 0;
+
+		ItemStack() = default;
+		ItemStack(uint32_t id, uint32_t count)
+			: defNameId(id),
+			  quantity(count) {}
+
+		/// Interns `name` (see AssetRegistry::internDefName)
+		ItemStack(const std::string& name, uint32_t count)
+			: defNameId(engine::assets::AssetRegistry::Get().internDefName(name)),
+			  quantity(count) {}
+
+		/// The material's defName, for display and string-keyed callers
+		[[nodiscard]] const std::string& defName() const { return engine::assets::AssetRegistry::Get().getDefName(defNameId); }
+	};
+
+	/// Hears backpack (items) quantity changes of the inventories it is attached to.
+	/// Hands and belt are not reported.
+	class InventoryObserver {
+	  public:
+		virtual ~InventoryObserver() = default;
+
+		/// `delta` units of `defNameId` entered (> 0) or left (< 0) the inventory keyed `owner`
+		virtual void onInventoryChanged(uint64_t owner, uint32_t defNameId, int64_t delta) = 0;
 	};
 
 	/// Inventory component - stores items as physical stacks, with hand slots and a belt.
@@ -79,7 +108,7 @@ namespace ecs {
 		// Backpack Storage
 		// ============================================================================
 
-		/// Stored stacks. Each entry is one physical stack (defName + quantity in
+		/// Stored stacks. Each entry is one physical stack (defName id + quantity in
 		/// [1, stackSize]); the same material may appear in several entries (slots).
 		std::vector<ItemStack> items;
 
@@ -90,19 +119,55 @@ namespace ecs {
 		/// against it; see ecs::carriedCargoMassKg. Caps how much a colonist hauls per trip.
 		float carryCapacityKg = 35.0F;
 
+		// ============================================================================
+		// Change Observer
+		// ============================================================================
+
+		/// Notified of every backpack change; owned by whoever attached it. Not saved:
+		/// the observer re-attaches after a load.
+		InventoryObserver* observer = nullptr;
+
+		/// Key passed back to the observer (the owning entity)
+		uint64_t observerKey = 0;
+
 	  private:
-		/// Per-stack cap for `defName`: the item's stackSize, or unbounded (UINT32_MAX) when
+		/// Per-stack cap for `defNameId`: the item's stackSize, or unbounded (UINT32_MAX) when
 		/// the def is unknown or carries no itemProperties. Unbounded (not 1) is intentional:
 		/// entities and unregistered defNames aren't stack-limited, and registry-free tests
 		/// rely on bare defNames staying uncapped.
-		[[nodiscard]] static uint32_t itemStackSize(const std::string& defName) {
-			const auto* def = engine::assets::AssetRegistry::Get().getDefinition(defName);
+		[[nodiscard]] static uint32_t itemStackSize(uint32_t defNameId) {
+			const auto* def = engine::assets::AssetRegistry::Get().getDefinition(defNameId);
 			if (def != nullptr && def->itemProperties.has_value()) {
 				return def->itemProperties->stackSize;
 			}
 			return UINT32_MAX;
 		}
 
+		/// Id for a queried defName: a lookup only, never interns (an unknown name reads as 0)
+		[[nodiscard]] static uint32_t lookupId(const std::string& defName) {
+			return engine::assets::AssetRegistry::Get().getDefNameId(defName);
+		}
+
+		/// Id for an added defName, interning names that have none yet
+		[[nodiscard]] static uint32_t internId(const std::string& defName) {
+			return engine::assets::AssetRegistry::Get().internDefName(defName);
+		}
+
+		void notify(uint32_t defNameId, int64_t delta) {
+			if (observer != nullptr && delta != 0) {
+				observer->onInventoryChanged(observerKey, defNameId, delta);
+			}
+		}
+
+		void notifyCleared() {
+			if (observer == nullptr) {
+				return;
+			}
+			for (const auto& stack : items) {
+				observer->onInventoryChanged(observerKey, stack.defNameId, -static_cast<int64_t>(stack.quantity));
+			}
+		}
+
 		/// Slots currently holding a stack.
 		[[nodiscard]] uint32_t usedSlots() const { return static_cast<uint32_t>(items.size()); }
 
@@ -120,54 +185,60 @@ namespace ecs {
 		/// Check if there's a free slot for one more stack.
 		[[nodiscard]] bool hasSpace() const { return usedSlots() < maxCapacity; }
 
-		/// Check if `quantity` of `defName` fits: existing-stack headroom plus free-slot capacity.
+		/// Check if `quantity` of an item fits: existing-stack headroom plus free-slot capacity.
+		[[nodiscard]] bool canAdd(uint32_t defNameId, uint32_t quantity = 1) const { return quantity <= addableCount(defNameId); }
 		[[nodiscard]] bool canAdd(const std::string& defName, uint32_t quantity = 1) const {
 			return quantity <= addableCount(defName);
 		}
 
-		/// How many of `defName` addItem() would actually accept right now: the sum of headroom
+		/// How many of an item addItem() would actually accept right now: the sum of headroom
 		/// left in every existing stack of that material, plus a full stack for each free slot.
 		/// Callers that withdraw from a finite source (a tree's resource pool) must clamp by this
 		/// so they never pull more than the backpack can hold.
-		[[nodiscard]] uint32_t addableCount(const std::string& defName) const {
-			const uint32_t cap = itemStackSize(defName);
+		[[nodiscard]] uint32_t addableCount(uint32_t defNameId) const {
+			const uint32_t cap = itemStackSize(defNameId);
 			uint64_t	   total = 0; // 64-bit accumulate: the freeSlots * cap term overflows uint32 for an unbounded cap (existing-stack headroom can't)
 			for (const auto& stack : items) {
-				if (stack.defName == defName && stack.quantity < cap) {
+				if (stack.defNameId == defNameId && stack.quantity < cap) {
 					total += cap - stack.quantity;
 				}
 			}
 			total += static_cast<uint64_t>(freeSlots()) * cap;
 			return total > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(total);
 		}
+		[[nodiscard]] uint32_t addableCount(const std::string& defName) const { return addableCount(lookupId(defName)); }
 
 		/// Check if inventory contains any stack of an item.
-		[[nodiscard]] bool hasItem(const std::string& defName) const {
-			return std::any_of(items.begin(), items.end(), [&](const ItemStack& s) { return s.defName == defName; });
+		[[nodiscard]] bool hasItem(uint32_t defNameId) const {
+			return std::any_of(items.begin(), items.end(), [&](const ItemStack& s) { return s.defNameId == defNameId; });
 		}
+		[[nodiscard]] bool hasItem(const std::string& defName) const { return hasItem(lookupId(defName)); }
 
 		/// Check if inventory has at least the specified quantity (summed across stacks).
+		[[nodiscard]] bool hasQuantity(uint32_t defNameId, uint32_t quantity) const { return getQuantity(defNameId) >= quantity; }
 		[[nodiscard]] bool hasQuantity(const std::string& defName, uint32_t quantity) const {
 			return getQuantity(defName) >= quantity;
 		}
 
 		/// Get total quantity of an item across all its stacks (0 if not present).
-		[[nodiscard]] uint32_t getQuantity(const std::string& defName) const {
+		[[nodiscard]] uint32_t getQuantity(uint32_t defNameId) const {
 			uint64_t total = 0;
 			for (const auto& stack : items) {
-				if (stack.defName == defName) {
+				if (stack.defNameId == defNameId) {
 					total += stack.quantity;
 				}
 			}
 			return total > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(total);
 		}
+		[[nodiscard]] uint32_t getQuantity(const std::string& defName) const { return getQuantity(lookupId(defName)); }
 
 		/// Get all items for UI display, aggregated to ONE ItemStack per material (summed),
 		/// so the gear panel shows "Wood x46" rather than one row per slot.
 		[[nodiscard]] std::vector<ItemStack> getAllItems() const {
 			std::vector<ItemStack> result;
 			for (const auto& stack : items) {
-				auto existing = std::find_if(result.begin(), result.end(), [&](const ItemStack& s) { return s.defName == stack.defName; });
+				auto existing =
+					std::find_if(result.begin(), result.end(), [&](const ItemStack& s) { return s.defNameId == stack.defNameId; });
 				if (existing != result.end()) {
 					existing->quantity += stack.quantity;
 				} else {
@@ -210,9 +281,10 @@ namespace ecs {
 		[[nodiscard]] bool hasHandsFree(uint8_t count) const { return freeHandCount() >= count; }
 
 		/// Check if holding a specific item in either hand
-		[[nodiscard]] bool isHolding(const std::string& defName) const {
-			return (leftHand.has_value() && leftHand->defName == defName) || (rightHand.has_value() && rightHand->defName == defName);
+		[[nodiscard]] bool isHolding(uint32_t defNameId) const {
+			return (leftHand.has_value() && leftHand->defNameId == defNameId) || (rightHand.has_value() && rightHand->defNameId == defNameId);
 		}
+		[[nodiscard]] bool isHolding(const std::string& defName) const { return isHolding(lookupId(defName)); }
 
 		/// Get item held in left hand (nullptr if empty)
 		[[nodiscard]] const ItemStack* getLeftHand() const { return leftHand.has_value() ? &leftHand.value() : nullptr; }
@@ -224,14 +296,14 @@ namespace ecs {
 		// Mutation Methods
 		// ============================================================================
 
-		/// Add items to inventory: top up existing non-full stacks of `defName` to its stackSize,
+		/// Add items to inventory: top up existing non-full stacks of the item to its stackSize,
 		/// then open new slots (each a stack <= stackSize) while a free slot remains.
 		/// @return Amount actually added (may be < quantity when out of slots).
-		uint32_t addItem(const std::string& defName, uint32_t quantity) {
+		uint32_t addItem(uint32_t defNameId, uint32_t quantity) {
 			if (quantity == 0) {
 				return 0; // adding nothing is a no-op (never create a zero-quantity slot)
 			}
-			const uint32_t cap = itemStackSize(defName);
+			const uint32_t cap = itemStackSize(defNameId);
 			if (cap == 0) {
 				return 0; // an unstackable-at-zero item can never be held
 			}
@@ -242,7 +314,7 @@ namespace ecs {
 				if (remaining == 0) {
 					break;
 				}
-				if (stack.defName == defName && stack.quantity < cap) {
+				if (stack.defNameId == defNameId && stack.quantity < cap) {
 					const uint32_t room = cap - stack.quantity;
 					const uint32_t toAdd = std::min(remaining, room);
 					stack.quantity += toAdd;
@@ -253,24 +325,26 @@ namespace ecs {
 			// Spill the rest into new slots.
 			while (remaining > 0 && hasSpace()) {
 				const uint32_t toAdd = std::min(remaining, cap);
-				items.push_back(ItemStack{defName, toAdd});
+				items.emplace_back(defNameId, toAdd);
 				remaining -= toAdd;
 			}
 
+			notify(defNameId, static_cast<int64_t>(quantity - remaining));
 			return quantity - remaining;
 		}
+		uint32_t addItem(const std::string& defName, uint32_t quantity) { return addItem(internId(defName), quantity); }
 
 		/// Remove items from inventory, draining across this material's stacks (last slot first)
 		/// and erasing emptied slots.
 		/// @return Amount actually removed (may be less if not enough).
-		uint32_t removeItem(const std::string& defName, uint32_t quantity) {
+		uint32_t removeItem(uint32_t defNameId, uint32_t quantity) {
 			if (quantity == 0) {
 				return 0;
 			}
 			uint32_t remaining = quantity;
 			// Drain from the back so erasing emptied slots doesn't disturb the iteration.
 			for (auto it = items.rbegin(); it != items.rend() && remaining > 0;) {
-				if (it->defName == defName) {
+				if (it->defNameId == defNameId) {
 					const uint32_t toRemove = std::min(remaining, it->quantity);
 					it->quantity -= toRemove;
 					remaining -= toRemove;
@@ -282,14 +356,20 @@ namespace ecs {
 				}
 				++it;
 			}
+			notify(defNameId, -static_cast<int64_t>(quantity - remaining));
 			return quantity - remaining;
 		}
+		uint32_t removeItem(const std::string& defName, uint32_t quantity) { return removeItem(lookupId(defName), quantity); }
 
 		/// Clear all items from inventory (backpack only)
-		void clear() { items.clear(); }
+		void clear() {
+			notifyCleared();
+			items.clear();
+		}
 
 		/// Clear everything including hands, belt, and carried entity
 		void clearAll() {
+			notifyCleared();
 			items.clear();
 			leftHand.reset();
 			rightHand.reset();
@@ -303,67 +383,67 @@ namespace ecs {
 		// ============================================================================
 
 		/// Pick up an item into hands
-		/// @param defName Item definition name
+		/// @param defNameId Item definition id
 		/// @param handsRequired How many hands needed (1 or 2)
 		/// @return true if successfully picked up
-		bool pickUp(const std::string& defName, uint8_t handsRequired = 1) {
+		bool pickUp(uint32_t defNameId, uint8_t handsRequired = 1) {
 			if (handsRequired == 2) {
 				// Two-handed: need both hands free
 				if (leftHand.has_value() || rightHand.has_value()) {
 					return false;
 				}
 				// Put in both hands (same item reference)
-				leftHand = ItemStack{defName, 1};
-				rightHand = ItemStack{defName, 1};
+				leftHand = ItemStack{defNameId, 1};
+				rightHand = ItemStack{defNameId, 1};
 				return true;
 			}
 
 			// One-handed: find a free hand
 			if (!rightHand.has_value()) {
-				rightHand = ItemStack{defName, 1};
+				rightHand = ItemStack{defNameId, 1};
 				return true;
 			}
 			if (!leftHand.has_value()) {
-				leftHand = ItemStack{defName, 1};
+				leftHand = ItemStack{defNameId, 1};
 				return true;
 			}
 			return false; // No free hands
 		}
+		bool pickUp(const std::string& defName, uint8_t handsRequired = 1) { return pickUp(internId(defName), handsRequired); }
 
-		/// Put down item(s) from hands
-		/// @param defName If specified, only put down this item; otherwise put down everything
+		/// Put down whatever is held (right hand first; a two-handed item frees both hands)
 		/// @return The item that was put down (nullopt if nothing)
-		std::optional<ItemStack> putDown(const std::string& defName = "") {
-			if (defName.empty()) {
-				// Put down everything - prioritize right hand
-				if (rightHand.has_value()) {
-					auto item = rightHand.value();
-					// Check if two-handed (same item in both hands)
-					if (leftHand.has_value() && leftHand->defName == item.defName) {
-						leftHand.reset();
-					}
-					rightHand.reset();
-					return item;
-				}
-				if (leftHand.has_value()) {
-					auto item = leftHand.value();
+		std::optional<ItemStack> putDown() {
+			if (rightHand.has_value()) {
+				auto item = rightHand.value();
+				// Check if two-handed (same item in both hands)
+				if (leftHand.has_value() && leftHand->defNameId == item.defNameId) {
 					leftHand.reset();
-					return item;
 				}
-				return std::nullopt;
+				rightHand.reset();
+				return item;
 			}
+			if (leftHand.has_value()) {
+				auto item = leftHand.value();
+				leftHand.reset();
+				return item;
+			}
+			return std::nullopt;
+		}
 
-			// Put down specific item
-			if (rightHand.has_value() && rightHand->defName == defName) {
+		/// Put down a specific held item
+		/// @return The item that was put down (nullopt if not held)
+		std::optional<ItemStack> putDown(uint32_t defNameId) {
+			if (rightHand.has_value() && rightHand->defNameId == defNameId) {
 				auto item = rightHand.value();
 				// Check if two-handed
-				if (leftHand.has_value() && leftHand->defName == defName) {
+				if (leftHand.has_value() && leftHand->defNameId == defNameId) {
 					leftHand.reset();
 				}
 				rightHand.reset();
 				return item;
 			}
-			if (leftHand.has_value() && leftHand->defName == defName) {
+			if (leftHand.has_value() && leftHand->defNameId == defNameId) {
 				auto item = leftHand.value();
 				leftHand.reset();
 				return item;
@@ -371,16 +451,21 @@ namespace ecs {
 			return std::nullopt;
 		}
 
+		/// Put down a held item by defName; an empty name puts down everything
+		std::optional<ItemStack> putDown(const std::string& defName) {
+			return defName.empty() ? putDown() : putDown(lookupId(defName));
+		}
+
 		/// Stow item from hands to backpack
-		/// @param defName Item to stow (must be in hands)
+		/// @param defNameId Item to stow (must be in hands)
 		/// @return true if successfully stowed
 		/// @note Two-handed items (held in both hands) cannot be stowed - they must be
 		///       placed on the ground. This is intentional as large items like furniture
 		///       shouldn't fit in a backpack.
-		bool stowToBackpack(const std::string& defName) {
+		bool stowToBackpack(uint32_t defNameId) {
 			// Check if we're holding this item
-			bool inRight = rightHand.has_value() && rightHand->defName == defName;
-			bool inLeft = leftHand.has_value() && leftHand->defName == defName;
+			bool inRight = rightHand.has_value() && rightHand->defNameId == defNameId;
+			bool inLeft = leftHand.has_value() && leftHand->defNameId == defNameId;
 
 			if (!inRight && !inLeft) {
 				return false; // Not holding this item
@@ -392,12 +477,12 @@ namespace ecs {
 			}
 
 			// Check if backpack has room
-			if (!canAdd(defName, 1)) {
+			if (!canAdd(defNameId, 1)) {
 				return false;
 			}
 
 			// Move to backpack
-			addItem(defName, 1);
+			addItem(defNameId, 1);
 
 			// Remove from hand
 			if (inRight) {
@@ -407,26 +492,30 @@ namespace ecs {
 			}
 			return true;
 		}
+		bool stowToBackpack(const std::string& defName) { return stowToBackpack(lookupId(defName)); }
 
 		/// Take item from backpack to hands
-		/// @param defName Item to take
+		/// @param defNameId Item to take
 		/// @param handsRequired How many hands needed
 		/// @return true if successfully taken
-		bool takeFromBackpack(const std::string& defName, uint8_t handsRequired = 1) {
+		bool takeFromBackpack(uint32_t defNameId, uint8_t handsRequired = 1) {
 			// Check if item is in backpack
-			if (!hasItem(defName)) {
+			if (!hasItem(defNameId)) {
 				return false;
 			}
 
 			// Try to pick up
-			if (!pickUp(defName, handsRequired)) {
+			if (!pickUp(defNameId, handsRequired)) {
 				return false;
 			}
 
 			// Remove from backpack
-			removeItem(defName, 1);
+			removeItem(defNameId, 1);
 			return true;
 		}
+		bool takeFromBackpack(const std::string& defName, uint8_t handsRequired = 1) {
+			return takeFromBackpack(lookupId(defName), handsRequired);
+		}
 
 		// ============================================================================
 		// Belt Mutation Methods
@@ -436,32 +525,34 @@ namespace ecs {
 		[[nodiscard]] bool beltHasFreeSlot() const { return !belt[0].has_value() || !belt[1].has_value(); }
 
 		/// Stow a one-hand item into the first free belt slot
-		/// @param defName Item to stow (one slot holds exactly one, quantity 1)
+		/// @param defNameId Item to stow (one slot holds exactly one, quantity 1)
 		/// @return true if seated, false if the belt is full
-		/// @note The belt only accepts one-hand items, but Inventory has no asset registry to
-		///       verify hand class - the CALLER must guarantee `defName` is one-hand.
-		bool stowToBelt(const std::string& defName) {
+		/// @note The belt only accepts one-hand items, but Inventory doesn't check hand class -
+		///       the CALLER must guarantee the item is one-hand.
+		bool stowToBelt(uint32_t defNameId) {
 			for (auto& slot : belt) {
 				if (!slot.has_value()) {
-					slot = ItemStack{defName, 1};
+					slot = ItemStack{defNameId, 1};
 					return true;
 				}
 			}
 			return false; // No free belt slot
 		}
+		bool stowToBelt(const std::string& defName) { return stowToBelt(internId(defName)); }
 
-		/// Take an item off the belt by defName (first matching slot)
-		/// @param defName Item to remove
+		/// Take an item off the belt (first matching slot)
+		/// @param defNameId Item to remove
 		/// @return true if a matching belt item was removed
-		bool takeFromBelt(const std::string& defName) {
+		bool takeFromBelt(uint32_t defNameId) {
 			for (auto& slot : belt) {
-				if (slot.has_value() && slot->defName == defName) {
+				if (slot.has_value() && slot->defNameId == defNameId) {
 					slot.reset();
 					return true;
 				}
 			}
 			return false; // Not on the belt
 		}
+		bool takeFromBelt(const std::string& defName) { return takeFromBelt(lookupId(defName)); }
 
 		// ============================================================================
 		// Factory Methods
@@ -168,10 +168,10 @@ TEST(InventoryTests, GetAllItemsMultiple) {
 	bool foundBerry = false;
 	bool foundStick = false;
 	for (const auto& item : items) {
-		if (item.defName == "Berry" && item.quantity == 10) {
+		if (item.defName() == "Berry" && item.quantity == 10) {
 			foundBerry = true;
 		}
-		if (item.defName == "Stick" && item.quantity == 5) {
+		if (item.defName() == "Stick" && item.quantity == 5) {
 			foundStick = true;
 		}
 	}
@@ -543,10 +543,10 @@ TEST_F(InventoryStackTest, GetAllItemsAggregatesStacksPerType) {
 	uint32_t wood = 0;
 	uint32_t stone = 0;
 	for (const auto& row : display) {
-		if (row.defName == "Wood") {
+		if (row.defName() == "Wood") {
 			wood = row.quantity;
 		}
-		if (row.defName == "Stone") {
+		if (row.defName() == "Stone") {
 			stone = row.quantity;
 		}
 	}
@@ -562,6 +562,34 @@ TEST_F(InventoryStackTest, UnregisteredMaterialStaysUnbounded) {
 	EXPECT_EQ(inv.getQuantity("Mystery"), 5000U);
 }
 
+TEST_F(InventoryStackTest, StacksCarryTheRegistryDefNameId) {
+	// Stacks hold the registry's defName id, so the id and defName overloads see the same stack.
+	const uint32_t woodId = engine::assets::AssetRegistry::Get().getDefNameId("Wood");
+	ASSERT_NE(woodId, 0U);
+
+	Inventory inv;
+	inv.addItem(woodId, 50);
+
+	ASSERT_EQ(inv.items.size(), 2U);
+	EXPECT_EQ(inv.items[0].defNameId, woodId);
+	EXPECT_EQ(inv.items[0].defName(), "Wood");
+	EXPECT_EQ(inv.getQuantity("Wood"), 50U);
+	EXPECT_EQ(inv.removeItem("Wood", 15), 15U);
+	EXPECT_EQ(inv.getQuantity(woodId), 35U);
+}
+
+TEST_F(InventoryStackTest, UnregisteredMaterialIsInternedOnAdd) {
+	// A defName with no asset def still gets an id, so it stacks and reads back by name.
+	Inventory inv;
+	inv.addItem("Mystery", 3);
+	const uint32_t mysteryId = engine::assets::AssetRegistry::Get().getDefNameId("Mystery");
+
+	EXPECT_NE(mysteryId, 0U);
+	ASSERT_EQ(inv.items.size(), 1U);
+	EXPECT_EQ(inv.items[0].defNameId, mysteryId);
+	EXPECT_EQ(inv.items[0].defName(), "Mystery");
+}
+
 // ============================================================================
 // Belt: two quick-draw slots for one-hand tools. Belt ops are pure inventory
 // (no asset registry); the caller guarantees the item is one-hand.
@@ -578,7 +606,7 @@ TEST(InventoryTests, BeltStowSeatsQuantityOne) {
 	Inventory inv;
 	EXPECT_TRUE(inv.stowToBelt("Axe"));
 	EXPECT_TRUE(inv.belt[0].has_value());
-	EXPECT_EQ(inv.belt[0]->defName, "Axe");
+	EXPECT_EQ(inv.belt[0]->defName(), "Axe");
 	EXPECT_EQ(inv.belt[0]->quantity, 1U);
 }
 
@@ -9,6 +9,12 @@ struct Position {
     glm::vec2 value{0.0f, 0.0f};
 };
 
+/// Position at the start of the latest simulation tick. SimulationClock keeps it
+/// for moving entities so rendering can blend toward Position between ticks.
+struct PreviousPosition {
+    glm::vec2 value{0.0f, 0.0f};
+};
+
 /// Facing direction of an entity
 struct Rotation {
     float radians = 0.0f;  // 0 = facing right (+X), PI/2 = facing up (+Y)
@@ -25,6 +25,7 @@
 #include "../components/Transform.h"
 #include "../components/WorkQueue.h"
 #include "NavigationSystem.h"
+#include "ResourceLedgerSystem.h"
 
 #include "assets/ActionTypeRegistry.h"
 #include "assets/AssetDefinition.h"
@@ -35,10 +36,11 @@
 #include "assets/RecipeRegistry.h"
 #include "world/chunk/ChunkManager.h"
 
+#include <threading/JobSystem.h>
 #include <utils/Log.h>
 
 #include <algorithm>
-#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <numbers>
 
@@ -46,16 +48,11 @@ namespace ecs {
 
 	namespace {
 
-		/// Global chain ID counter for generating unique chain identifiers.
-		/// Starts at 1 so that 0 can represent "no chain" in optional contexts.
-		/// NOTE: This variable intentionally has internal linkage by living in an anonymous
-		/// namespace inside this .cpp file. Do not move this definition into a header, or
-		/// each translation unit would get its own counter and chain IDs could collide.
-		std::atomic<uint64_t> g_nextChainId{1};
-
-		/// Generate a unique chain ID for multi-step tasks
+		/// Generate a unique chain ID for multi-step tasks. The counter lives in
+		/// GoalTaskRegistry, shared with the goal systems' Harvest→Haul chains, so ids
+		/// never collide and restart with the registry (new game, load, replay).
 		[[nodiscard]] uint64_t generateChainId() {
-			return g_nextChainId.fetch_add(1, std::memory_order_relaxed);
+			return GoalTaskRegistry::Get().allocateChainId();
 		}
 
 		/// Map NeedType to the CapabilityType that fulfills it
@@ -83,27 +80,6 @@ namespace ecs {
 			return engine::assets::CapabilityType::Edible;
 		}
 
-		/// Get a human-readable name for a need type (for debug logging)
-		[[nodiscard]] const char* needTypeName(NeedType need) {
-			switch (need) {
-				case NeedType::Hunger:
-					return "Hunger";
-				case NeedType::Thirst:
-					return "Thirst";
-				case NeedType::Energy:
-					return "Energy";
-				case NeedType::Bladder:
-					return "Bladder";
-				case NeedType::Digestion:
-					return "Digestion";
-				case NeedType::Count:
-					break;
-			}
-			// All valid NeedTypes must be handled above - hitting this is a bug
-			LOG_ERROR(Engine, "needTypeName: unhandled NeedType %d", static_cast<int>(need));
-			return "Unknown";
-		}
-
 		/// Get the first action defName for a task type (for chain interruption checks)
 		/// Maps TaskType (+ NeedType for FulfillNeed) to the action that will be triggered first.
 		/// Returns string_view to avoid allocation - all values are compile-time constants.
@@ -296,10 +272,10 @@ namespace ecs {
 				case TaskType::FulfillNeed:
 					return option.needType == currentTask.needToFulfill;
 				case TaskType::Craft:
-					return option.craftRecipeDefName == currentTask.craftRecipeDefName &&
+					return option.craftRecipe != nullptr && option.craftRecipe->defName == currentTask.craftRecipeDefName &&
 						   option.stationEntityId == currentTask.targetStationId;
 				case TaskType::Haul:
-					return option.haulItemDefName == currentTask.haulItemDefName &&
+					return option.haulItemDefNameId == currentTask.haulItemDefNameId &&
 						   option.haulTargetStorageId == currentTask.haulTargetStorageId;
 				case TaskType::PlacePackaged:
 					return option.placePackagedEntityId == currentTask.placePackagedEntityId;
@@ -362,9 +338,10 @@ namespace ecs {
 				const auto* destConfig = world->getComponent<StorageConfiguration>(destEntity);
 				if (destConfig != nullptr) {
 					const auto& reg = engine::assets::AssetRegistry::Get();
-					const auto* itemDef = reg.getDefinition(option.haulItemDefName);
+					const auto& itemDefName = reg.getDefName(option.haulItemDefNameId);
+					const auto* itemDef = reg.getDefinition(itemDefName);
 					if (itemDef != nullptr) {
-						const StoragePriority destPriority = destConfig->getPriorityFor(option.haulItemDefName, itemDef->category);
+						const StoragePriority destPriority = destConfig->getPriorityFor(itemDefName, itemDef->category);
 						const auto rank = static_cast<int16_t>(static_cast<uint8_t>(destPriority)); // 0..3
 						option.storagePriorityBias = static_cast<int16_t>(rank * priorityConfig.getStoragePriorityWeight());
 					}
@@ -420,18 +397,39 @@ namespace ecs {
 		) {
 			auto& goalRegistry = GoalTaskRegistry::Get();
 
-			// Query all Haul goals (storage containers wanting items)
-			auto haulGoals = goalRegistry.getGoalsOfType(TaskType::Haul);
-
-			for (const auto* goal : haulGoals) {
-				if (goal == nullptr) {
-					continue;
+			// How a Haul goal sources its items: from the colonist's pack (the three cases below)
+			// or, for everything else, from a remembered loose pile.
+			struct HaulKind {
+				bool construction = false;
+				bool craft = false;
+				bool storageStocking = false;
+				[[nodiscard]] bool fromInventory() const { return construction || craft || storageStocking; }
+			};
+			auto classifyHaul = [&goalRegistry](const GoalTask& goal) {
+				HaulKind kind;
+				kind.construction = goal.owner == GoalOwner::ConstructionGoalSystem;
+				if (!kind.construction && goal.parentGoalId.has_value()) {
+					const auto* parent = goalRegistry.getGoal(goal.parentGoalId.value());
+					kind.craft = parent != nullptr && parent->type == TaskType::Craft;
 				}
-				// A storage goal's slot-count targetAmount makes availableCapacity() a poor "full"
-				// signal (it goes 0 after one stack); its real headroom is the destination's
-				// per-item addableCount, checked below in the loose-pile path. Only gate the
-				// counter-driven goals (craft/construction) here.
-				if (goal->owner != GoalOwner::StorageGoalSystem && goal->availableCapacity() == 0) {
+				// A storage haul carries from inventory only when it was spawned from a completed
+				// stocking Harvest (it inherits that Harvest's chainId). Ordinary storage hauls have
+				// no chainId and fall through to the loose-pile scan.
+				kind.storageStocking = goal.owner == GoalOwner::StorageGoalSystem && goal.chainId.has_value();
+				return kind;
+			};
+			// A storage goal's slot-count targetAmount makes availableCapacity() a poor "full"
+			// signal (it goes 0 after one stack); its real headroom is the destination's
+			// per-item addableCount, checked in the loose-pile path. Only gate the
+			// counter-driven goals (craft/construction) here.
+			auto isFull = [](const GoalTask& goal) {
+				return goal.owner != GoalOwner::StorageGoalSystem && goal.availableCapacity() == 0;
+			};
+
+			// Query all Haul goals (storage containers wanting items). Read in place: nothing
+			// below creates or removes goals.
+			for (const auto* goal : goalRegistry.goalsOfType(TaskType::Haul)) {
+				if (isFull(*goal)) {
 					continue; // Goal is full
 				}
 
@@ -447,24 +445,16 @@ namespace ecs {
 				//    ordinary loose-pile haul handled by the memory scan below, not this path.
 				// All skip the memory scan and emit only once the dependency completed (status
 				// Available) and the colonist actually carries the material.
-				const bool isConstructionHaul = goal->owner == GoalOwner::ConstructionGoalSystem;
-				bool isCraftHaul = false;
-				if (!isConstructionHaul && goal->parentGoalId.has_value()) {
-					const auto* parent = goalRegistry.getGoal(goal->parentGoalId.value());
-					isCraftHaul = parent != nullptr && parent->type == TaskType::Craft;
-				}
-				// A storage haul carries from inventory only when it was spawned from a completed
-				// stocking Harvest (it inherits that Harvest's chainId). Ordinary storage hauls have
-				// no chainId and fall through to the loose-pile scan.
-				const bool isStorageStockingHaul = goal->owner == GoalOwner::StorageGoalSystem && goal->chainId.has_value();
-				const bool inventorySourceHaul = isConstructionHaul || isCraftHaul || isStorageStockingHaul;
-				if (inventorySourceHaul) {
+				const HaulKind kind = classifyHaul(*goal);
+				const bool	   isConstructionHaul = kind.construction;
+				const bool	   isCraftHaul = kind.craft;
+				const bool	   isStorageStockingHaul = kind.storageStocking;
+				if (kind.fromInventory()) {
 					if (goal->status == GoalStatus::Available) {
 						const bool toBlueprint = isConstructionHaul;
 						for (uint32_t acceptedId : goal->acceptedDefNameIds) {
-							const auto& itemDefName = registry.getDefName(acceptedId);
 							// Hand-carried two-hand goods (a wood armful) count too, not just the pack.
-							uint32_t	carried = ecs::availableQuantity(inventory, itemDefName);
+							uint32_t	carried = ecs::availableQuantity(inventory, acceptedId);
 							if (carried == 0) {
 								continue;
 							}
@@ -482,7 +472,7 @@ namespace ecs {
 							uint32_t haulCap = goal->availableCapacity();
 							if (isStorageStockingHaul) {
 								const auto* destInv = world != nullptr ? world->getComponent<Inventory>(goal->destinationEntity) : nullptr;
-								haulCap = destInv != nullptr ? destInv->addableCount(itemDefName) : 0U;
+								haulCap = destInv != nullptr ? destInv->addableCount(acceptedId) : 0U;
 								if (haulCap == 0) {
 									continue; // box can't take any more of this item right now
 								}
@@ -496,7 +486,7 @@ namespace ecs {
 							haulOption.targetPosition = goal->destinationPosition;
 							haulOption.targetDefNameId = acceptedId;
 							haulOption.distanceToTarget = glm::distance(position, goal->destinationPosition);
-							haulOption.haulItemDefName = itemDefName;
+							haulOption.haulItemDefNameId = acceptedId;
 							haulOption.haulQuantity = std::min(carried, haulCap);
 							haulOption.haulSourcePosition = position; // already carrying
 							haulOption.haulTargetStorageId = static_cast<uint64_t>(goal->destinationEntity);
@@ -510,9 +500,9 @@ namespace ecs {
 							haulOption.servesStorageStocking = isStorageStockingHaul;
 							haulOption.tiebreakId = goal->id ^ (static_cast<uint64_t>(acceptedId) << 1);
 							haulOption.status = OptionStatus::Available;
-							haulOption.reason = toBlueprint		   ? "Delivering " + itemDefName + " to build site"
-												: isStorageStockingHaul ? "Stocking " + itemDefName + " into storage"
-																		: "Delivering " + itemDefName + " to crafting station";
+							haulOption.reason = toBlueprint			   ? OptionReason::DeliverToBuildSite
+												: isStorageStockingHaul ? OptionReason::StockStorage
+																		: OptionReason::DeliverToStation;
 							trace.options.push_back(haulOption);
 						}
 					}
@@ -526,17 +516,16 @@ namespace ecs {
 							if (!accepted || !registry.hasCapability(looseItem.defNameId, engine::assets::CapabilityType::Carryable)) {
 								continue;
 							}
-							const auto& itemDefName = registry.getDefName(looseItem.defNameId);
 							// Deposits move the material into the station, so the pack empties between
 							// trips. Stop fetching once enough is already staged in the station
 							// (deliveredAmount) plus what the colonist is carrying toward this delivery
 							// (carried) to satisfy the goal; otherwise keep fetching the next unit. A
 							// recipe needing 2 with 1 staged and 0 in hand still needs a 2nd unit fetched.
-							const uint32_t carried = ecs::availableQuantity(inventory, itemDefName);
+							const uint32_t carried = ecs::availableQuantity(inventory, looseItem.defNameId);
 							if (goal->deliveredAmount + carried >= goal->targetAmount) {
 								continue;
 							}
-							const auto* itemDef = registry.getDefinition(itemDefName);
+							const auto* itemDef = registry.getDefinition(looseItem.defNameId);
 							if (itemDef == nullptr || !itemDef->capabilities.carryable.has_value()) {
 								continue;
 							}
@@ -546,7 +535,7 @@ namespace ecs {
 							// collect 0 -> fetch" loop. A colonist already loaded with unrelated cargo (or
 							// mid-trip carrying the previous unit) can hit this. Skip the fetch when no unit
 							// fits; the craft stays pending until the colonist has room, instead of spinning.
-							if (ecs::cargoUnitsThatFit(inventory, registry, itemDefName) == 0) {
+							if (ecs::cargoUnitsThatFit(inventory, registry, looseItem.defNameId) == 0) {
 								continue;
 							}
 
@@ -560,7 +549,7 @@ namespace ecs {
 							fetchOption.targetPosition = looseItem.position;
 							fetchOption.targetDefNameId = looseItem.defNameId;
 							fetchOption.distanceToTarget = tripDistance;
-							fetchOption.haulItemDefName = itemDefName;
+							fetchOption.haulItemDefNameId = looseItem.defNameId;
 							fetchOption.haulQuantity = std::min(itemDef->capabilities.carryable.value().quantity, goal->availableCapacity());
 							fetchOption.haulSourcePosition = looseItem.position;
 							fetchOption.haulTargetStorageId = static_cast<uint64_t>(goal->destinationEntity);
@@ -573,100 +562,16 @@ namespace ecs {
 							fetchOption.servesActiveWorkOrder = true;
 							fetchOption.tiebreakId = goal->id ^ (key << 1);
 							fetchOption.status = OptionStatus::Available;
-							fetchOption.reason = "Fetching " + itemDefName + " for crafting";
+							fetchOption.reason = OptionReason::FetchForCraft;
 							trace.options.push_back(fetchOption);
 						}
 					}
 					continue;
 				}
 
-				// Check colonist's memory for items that can fulfill this goal
-				for (const auto& [key, looseItem] : memory.knownWorldEntities) {
-					// Check if this item type is accepted by the goal
-					bool accepted = false;
-
-					// Check by category
-					if (goal->acceptedCategory != engine::assets::ItemCategory::None) {
-						const auto& defName = registry.getDefName(looseItem.defNameId);
-						const auto* def = registry.getDefinition(defName);
-						if (def != nullptr && def->category == goal->acceptedCategory) {
-							accepted = true;
-						}
-					}
-
-					// Check by specific defNameId
-					if (!accepted) {
-						for (uint32_t acceptedId : goal->acceptedDefNameIds) {
-							if (looseItem.defNameId == acceptedId) {
-								accepted = true;
-								break;
-							}
-						}
-					}
-
-					if (!accepted) {
-						continue;
-					}
-
-					// Check if entity is actually Carryable
-					if (!registry.hasCapability(looseItem.defNameId, engine::assets::CapabilityType::Carryable)) {
-						continue;
-					}
-
-					const auto& itemDefName = registry.getDefName(looseItem.defNameId);
-					const auto* itemDef = registry.getDefinition(itemDefName);
-					if (itemDef == nullptr) {
-						continue;
-					}
-
-					// Calculate trip distance: colonist -> item -> goal destination
-					float tripDistance = glm::distance(position, looseItem.position) +
-										 glm::distance(looseItem.position, goal->destinationPosition);
-
-					// Create haul option
-					EvaluatedOption haulOption;
-					haulOption.taskType = TaskType::Haul;
-					haulOption.needType = NeedType::Count;
-					haulOption.needValue = 100.0F;
-					haulOption.threshold = 0.0F;
-					haulOption.targetPosition = looseItem.position;
-					haulOption.targetDefNameId = looseItem.defNameId;
-					haulOption.distanceToTarget = tripDistance;
-					haulOption.haulItemDefName = itemDefName;
-					// Size the trip by what the DESTINATION storage can actually accept of this
-					// specific item -- its stack headroom plus free-slot * stackSize
-					// (addableCount), not the goal's slot count. A storage with 3 free slots takes
-					// up to 3 full stacks of wood (~120), not 3 wood. Then over-propose only as far
-					// as the colonist can carry (weight); the pickup clamps to the live
-					// ResourceStack and remaining carry capacity, and the deposit clamps to the
-					// storage's PHYSICAL slot capacity (addableCount), NOT the configured max -- storage
-					// max is a soft target. A single colonist's per-trip storageHeadroom clamp keeps it
-					// within physical room, but two concurrent hauls can both pass it and transiently
-					// overfill past the configured max; slot capacity is the only hard cap.
-					uint32_t storageHeadroom = UINT32_MAX;
-					if (const auto* destInv = world != nullptr ? world->getComponent<Inventory>(goal->destinationEntity) : nullptr) {
-						storageHeadroom = destInv->addableCount(itemDefName);
-					}
-					if (storageHeadroom == 0) {
-						continue; // storage can't take any more of this item, skip it
-					}
-					haulOption.haulQuantity =
-						std::min(storageHeadroom, ecs::cargoUnitsPerTrip(registry, itemDefName, inventory.carryCapacityKg));
-					haulOption.haulSourcePosition = looseItem.position;
-					haulOption.haulTargetStorageId = static_cast<uint64_t>(goal->destinationEntity);
-					haulOption.haulTargetPosition = goal->destinationPosition;
-					haulOption.haulGoalId = goal->id;
-					// Tiebreak on (goal, source item) so two equidistant loose items for the same
-					// goal resolve deterministically rather than by memory's hash order.
-					haulOption.tiebreakId = goal->id ^ (key << 1);
-					haulOption.status = OptionStatus::Available;
-					haulOption.reason = "Hauling " + itemDefName + " to storage";
-					trace.options.push_back(haulOption);
-				}
-
 				// Storage-to-storage pull (storage priority, Phase 2): for an ordinary storage umbrella
 				// goal (StorageGoalSystem-owned, no chainId/craft parent -- those returned above via
-				// inventorySourceHaul), ALSO scan other storage boxes as sources. A higher-priority
+				// kind.fromInventory()), ALSO scan other storage boxes as sources. A higher-priority
 				// destination box pulls items UP from strictly-lower-priority boxes. The strict-< gate is
 				// the load-bearing invariant: items flow monotonically up the 4-level ladder
 				// (Low<Medium<High<Critical), never sideways or down, which makes A->B->A cycles
@@ -675,10 +580,11 @@ namespace ecs {
 					const auto destEntity = goal->destinationEntity;
 					const auto* destConfig = world->getComponent<StorageConfiguration>(destEntity);
 					const auto* destInv = world->getComponent<Inventory>(destEntity);
+					const auto* ledger = world->tryGetSystem<ResourceLedgerSystem>();
 					if (destConfig != nullptr && destInv != nullptr) {
 						for (uint32_t acceptedId : goal->acceptedDefNameIds) {
 							const auto& itemDefName = registry.getDefName(acceptedId);
-							const auto* itemDef = registry.getDefinition(itemDefName);
+							const auto* itemDef = registry.getDefinition(acceptedId);
 							if (itemDef == nullptr || !registry.hasCapability(acceptedId, engine::assets::CapabilityType::Carryable)) {
 								continue;
 							}
@@ -688,28 +594,28 @@ namespace ecs {
 							// Dest headroom for this item (stack room + free slots * stackSize) and the
 							// dest's own max clamp (don't overfill past the configured max). Computed once
 							// per item, outside the source loop.
-							const uint32_t destHeadroom = destInv->addableCount(itemDefName);
+							const uint32_t destHeadroom = destInv->addableCount(acceptedId);
 							if (destHeadroom == 0) {
 								continue; // dest box can't take any more of this item
 							}
 							const uint32_t destMax = destConfig->getMaxAmountFor(itemDefName, cat);
-							const uint32_t destHas = destInv->getQuantity(itemDefName);
+							const uint32_t destHas = destInv->getQuantity(acceptedId);
 							const uint32_t maxRemaining = destMax == 0 ? UINT32_MAX : (destMax > destHas ? destMax - destHas : 0U);
 							if (maxRemaining == 0) {
 								continue; // dest already at its configured max
 							}
-							const uint32_t perTrip = ecs::cargoUnitsPerTrip(registry, itemDefName, inventory.carryCapacityKg);
+							const uint32_t perTrip = ecs::cargoUnitsPerTrip(registry, acceptedId, inventory.carryCapacityKg);
 							if (perTrip == 0) {
 								continue; // colonist can't carry a single unit of this item
 							}
 
-							for (auto [srcEntity, srcConfig, srcInv, srcPos] : world->view<StorageConfiguration, Inventory, Position>()) {
+							// Judge one candidate source box holding `srcHas` of the item
+							auto considerSource = [&](EntityID srcEntity, const StorageConfiguration& srcConfig, uint32_t srcHas, glm::vec2 srcPos) {
 								if (srcEntity == destEntity) {
-									continue; // never pull from the destination itself
+									return; // never pull from the destination itself
 								}
-								const uint32_t srcHas = srcInv.getQuantity(itemDefName);
 								if (srcHas == 0) {
-									continue; // source holds none of this item
+									return; // source holds none of this item
 								}
 								// Strict-< gate: pull only from a STRICTLY lower-priority box. Never same,
 								// never higher. This is what keeps the flow monotonic and cycle-free.
@@ -720,42 +626,42 @@ namespace ecs {
 								// still holds -- Low is the floor, so the strict-< gate can never form a cycle.
 								const StoragePriority srcPriority = srcConfig.getPriorityFor(itemDefName, cat);
 								if (!(static_cast<uint8_t>(srcPriority) < static_cast<uint8_t>(destPriority))) {
-									continue;
+									return;
 								}
 								// Discovery-gating: the colony must KNOW the source box (no god-view),
 								// mirroring how a loose pickup is gated on the pile being in memory.
 								if (!ecs::colonyKnowsStorageEntity(world, registry, srcEntity)) {
-									continue;
+									return;
 								}
 								// Don't drain the source below ITS OWN configured minimum for this item.
 								const uint32_t srcMin = srcConfig.getMinAmountFor(itemDefName, cat);
 								const uint32_t drainable = srcHas > srcMin ? srcHas - srcMin : 0U;
 								if (drainable == 0) {
-									continue;
+									return;
 								}
 								// Three clamps + one trip, min wins: don't drain source below its min,
 								// don't exceed dest headroom, don't overfill past dest max, carry one trip.
 								const uint32_t qty = std::min({drainable, destHeadroom, maxRemaining, perTrip});
 								if (qty == 0) {
-									continue;
+									return;
 								}
 
 								// Mirror the loose-pile haul option field-for-field, but the source is the
 								// box: walk to it, Withdraw, then the unchanged deposit leg stocks the dest.
 								const float tripDistance =
-									glm::distance(position, srcPos.value) + glm::distance(srcPos.value, goal->destinationPosition);
+									glm::distance(position, srcPos) + glm::distance(srcPos, goal->destinationPosition);
 
 								EvaluatedOption pullOption;
 								pullOption.taskType = TaskType::Haul;
 								pullOption.needType = NeedType::Count;
 								pullOption.needValue = 100.0F;
 								pullOption.threshold = 0.0F;
-								pullOption.targetPosition = srcPos.value;
+								pullOption.targetPosition = srcPos;
 								pullOption.targetDefNameId = acceptedId;
 								pullOption.distanceToTarget = tripDistance;
-								pullOption.haulItemDefName = itemDefName;
+								pullOption.haulItemDefNameId = acceptedId;
 								pullOption.haulQuantity = qty;
-								pullOption.haulSourcePosition = srcPos.value;
+								pullOption.haulSourcePosition = srcPos;
 								pullOption.haulSourceStorageId = static_cast<uint64_t>(srcEntity);
 								pullOption.haulTargetStorageId = static_cast<uint64_t>(destEntity);
 								pullOption.haulTargetPosition = goal->destinationPosition;
@@ -768,13 +674,105 @@ namespace ecs {
 								// view iteration order.
 								pullOption.tiebreakId = goal->id ^ (static_cast<uint64_t>(srcEntity) << 1);
 								pullOption.status = OptionStatus::Available;
-								pullOption.reason = "Pulling " + itemDefName + " from lower-priority storage";
+								pullOption.reason = OptionReason::PullFromStorage;
 								trace.options.push_back(pullOption);
+							};
+
+							// The ledger lists just the boxes holding this item; without it, scan every box.
+							if (ledger != nullptr) {
+								for (const auto& holding : ledger->holders(acceptedId)) {
+									const auto* srcConfig = world->getComponent<StorageConfiguration>(holding.storage);
+									const auto* srcPos = world->getComponent<Position>(holding.storage);
+									if (srcConfig != nullptr && srcPos != nullptr) {
+										considerSource(holding.storage, *srcConfig, holding.count, srcPos->value);
+									}
+								}
+							} else {
+								for (auto [srcEntity, srcConfig, srcInv, srcPos] : world->view<StorageConfiguration, Inventory, Position>()) {
+									considerSource(srcEntity, srcConfig, srcInv.getQuantity(acceptedId), srcPos.value);
+								}
 							}
 						}
 					}
 				}
 			}
+
+			// Loose-pile hauls: for each remembered item, look up the Haul goals that accept it
+			// (by id, then by category) instead of testing every goal against every memory.
+			for (const auto& [key, looseItem] : memory.knownWorldEntities) {
+				// Check if entity is actually Carryable
+				if (!registry.hasCapability(looseItem.defNameId, engine::assets::CapabilityType::Carryable)) {
+					continue;
+				}
+
+				const auto* itemDef = registry.getDefinition(looseItem.defNameId);
+				if (itemDef == nullptr) {
+					continue;
+				}
+
+				auto offerHaul = [&](const GoalTask* goal) {
+					if (isFull(*goal) || classifyHaul(*goal).fromInventory()) {
+						return; // pack-sourced hauls were handled above
+					}
+
+					// Calculate trip distance: colonist -> item -> goal destination
+					float tripDistance = glm::distance(position, looseItem.position) +
+										 glm::distance(looseItem.position, goal->destinationPosition);
+
+					// Create haul option
+					EvaluatedOption haulOption;
+					haulOption.taskType = TaskType::Haul;
+					haulOption.needType = NeedType::Count;
+					haulOption.needValue = 100.0F;
+					haulOption.threshold = 0.0F;
+					haulOption.targetPosition = looseItem.position;
+					haulOption.targetDefNameId = looseItem.defNameId;
+					haulOption.distanceToTarget = tripDistance;
+					haulOption.haulItemDefNameId = looseItem.defNameId;
+					// Size the trip by what the DESTINATION storage can actually accept of this
+					// specific item -- its stack headroom plus free-slot * stackSize
+					// (addableCount), not the goal's slot count. A storage with 3 free slots takes
+					// up to 3 full stacks of wood (~120), not 3 wood. Then over-propose only as far
+					// as the colonist can carry (weight); the pickup clamps to the live
+					// ResourceStack and remaining carry capacity, and the deposit clamps to the
+					// storage's PHYSICAL slot capacity (addableCount), NOT the configured max -- storage
+					// max is a soft target. A single colonist's per-trip storageHeadroom clamp keeps it
+					// within physical room, but two concurrent hauls can both pass it and transiently
+					// overfill past the configured max; slot capacity is the only hard cap.
+					uint32_t storageHeadroom = UINT32_MAX;
+					if (const auto* destInv = world != nullptr ? world->getComponent<Inventory>(goal->destinationEntity) : nullptr) {
+						storageHeadroom = destInv->addableCount(looseItem.defNameId);
+					}
+					if (storageHeadroom == 0) {
+						return; // storage can't take any more of this item, skip it
+					}
+					haulOption.haulQuantity =
+						std::min(storageHeadroom, ecs::cargoUnitsPerTrip(registry, looseItem.defNameId, inventory.carryCapacityKg));
+					haulOption.haulSourcePosition = looseItem.position;
+					haulOption.haulTargetStorageId = static_cast<uint64_t>(goal->destinationEntity);
+					haulOption.haulTargetPosition = goal->destinationPosition;
+					haulOption.haulGoalId = goal->id;
+					// Tiebreak on (goal, source item) so two equidistant loose items for the same
+					// goal resolve deterministically rather than by memory's hash order.
+					haulOption.tiebreakId = goal->id ^ (key << 1);
+					haulOption.status = OptionStatus::Available;
+					haulOption.reason = OptionReason::HaulToStorage;
+					trace.options.push_back(haulOption);
+				};
+
+				const auto itemCategory = itemDef->category;
+				for (const auto* goal : goalRegistry.goalsAccepting(TaskType::Haul, looseItem.defNameId)) {
+					if (itemCategory != engine::assets::ItemCategory::None && goal->acceptedCategory == itemCategory) {
+						continue; // accepted by category too: offered once, from the category list
+					}
+					offerHaul(goal);
+				}
+				if (itemCategory != engine::assets::ItemCategory::None) {
+					for (const auto* goal : goalRegistry.goalsAcceptingCategory(TaskType::Haul, itemCategory)) {
+						offerHaul(goal);
+					}
+				}
+			}
 		}
 
 		/// Evaluate harvest options by querying Harvest goals from GoalTaskRegistry
@@ -795,7 +793,7 @@ namespace ecs {
 			auto& goalRegistry = GoalTaskRegistry::Get();
 
 			// Query all Harvest goals (requests for items that come from harvestables)
-			auto harvestGoals = goalRegistry.getGoalsOfType(TaskType::Harvest);
+			const GoalSpan harvestGoals = goalRegistry.goalsOfType(TaskType::Harvest);
 
 			for (const auto* goal : harvestGoals) {
 				if (goal == nullptr || goal->availableCapacity() == 0) {
@@ -861,9 +859,8 @@ namespace ecs {
 					// and pick the same harvest again -- an infinite chop-nothing loop. Skip the
 					// option when no unit fits (no stack/slot headroom and no carry weight), leaving
 					// the harvest for a trip when the colonist has room.
-					const std::string& yieldName = def->capabilities.harvestable->yieldDefName;
-					if (ecs::cargoUnitsThatFit(inventory, registry, yieldName) == 0 ||
-						inventory.addableCount(yieldName) == 0) {
+					if (ecs::cargoUnitsThatFit(inventory, registry, yieldDefNameId) == 0 ||
+						inventory.addableCount(yieldDefNameId) == 0) {
 						continue;
 					}
 
@@ -898,14 +895,7 @@ namespace ecs {
 					harvestOption.skillLevel = farmSkillLevel;
 					harvestOption.skillBonus = farmSkillBonus;
 
-					// Build reason string from friendly labels, not raw defNames ("Oak Tree", not
-					// "Flora_TreeOak"). Falls back to the defName if a label is missing.
-					const auto&		  yieldDefName = registry.getDefName(goal->yieldDefNameId);
-					const auto*		  yieldDef = registry.getDefinition(yieldDefName);
-					const std::string srcLabel = !def->label.empty() ? def->label : defName;
-					const std::string yieldLabel =
-						(yieldDef != nullptr && !yieldDef->label.empty()) ? yieldDef->label : yieldDefName;
-					harvestOption.reason = "Cutting " + srcLabel + " for " + yieldLabel;
+					harvestOption.reason = OptionReason::Harvest;
 
 					trace.options.push_back(harvestOption);
 				}
@@ -927,7 +917,7 @@ namespace ecs {
 			}
 			auto& goalRegistry = GoalTaskRegistry::Get();
 
-			for (const auto* goal : goalRegistry.getGoalsOfType(TaskType::Build)) {
+			for (const auto* goal : goalRegistry.goalsOfType(TaskType::Build)) {
 				if (goal == nullptr || goal->status != GoalStatus::Available) {
 					continue;
 				}
@@ -957,7 +947,7 @@ namespace ecs {
 				auto [buildSkillLevel, buildSkillBonus] = calculateSkillBonus(skills, kSkillConstruction);
 				buildOption.skillLevel = buildSkillLevel;
 				buildOption.skillBonus = buildSkillBonus;
-				buildOption.reason = "Building structure";
+				buildOption.reason = OptionReason::Build;
 
 				trace.options.push_back(buildOption);
 			}
@@ -975,7 +965,7 @@ namespace ecs {
 			}
 			auto& goalRegistry = GoalTaskRegistry::Get();
 
-			for (const auto* goal : goalRegistry.getGoalsOfType(TaskType::Deconstruct)) {
+			for (const auto* goal : goalRegistry.goalsOfType(TaskType::Deconstruct)) {
 				if (goal == nullptr || goal->status != GoalStatus::Available) {
 					continue;
 				}
@@ -1002,7 +992,7 @@ namespace ecs {
 				auto [deconstructSkillLevel, deconstructSkillBonus] = calculateSkillBonus(skills, kSkillConstruction);
 				deconstructOption.skillLevel = deconstructSkillLevel;
 				deconstructOption.skillBonus = deconstructSkillBonus;
-				deconstructOption.reason = "Deconstructing structure";
+				deconstructOption.reason = OptionReason::Deconstruct;
 
 				trace.options.push_back(deconstructOption);
 			}
@@ -1013,7 +1003,13 @@ namespace ecs {
 		/// @param position Colonist position
 		/// @param inventory Colonist inventory (to check if carrying)
 		/// @param trace Output decision trace
-		void evaluatePlacePackagedOptions(World* world, const glm::vec2& position, const Inventory& inventory, DecisionTrace& trace) {
+		void evaluatePlacePackagedOptions(
+			World*								 world,
+			const engine::assets::AssetRegistry& registry,
+			const glm::vec2&					 position,
+			const Inventory&					 inventory,
+			DecisionTrace&						 trace
+		) {
 			// Find packaged items with targetPosition set (awaiting colonist delivery)
 			for (auto [packagedEntity, packagedPos, packaged, packagedAppearance] : world->view<Position, Packaged, Appearance>()) {
 				// Only consider items with a target position set
@@ -1056,7 +1052,8 @@ namespace ecs {
 				placeOption.placeTargetPosition = targetPos;
 				placeOption.tiebreakId = static_cast<uint64_t>(packagedEntity);
 				placeOption.status = OptionStatus::Available;
-				placeOption.reason = isCarryingThis ? "Delivering " + packagedAppearance.defName : "Placing " + packagedAppearance.defName;
+				placeOption.placePackagedDefNameId = registry.getDefNameId(packagedAppearance.defName);
+				placeOption.reason = isCarryingThis ? OptionReason::DeliverPackaged : OptionReason::PlacePackaged;
 				trace.options.push_back(placeOption);
 			}
 		}
@@ -1076,9 +1073,13 @@ namespace ecs {
 		// Advance this system's monotonic clock (used for lastEvaluationTime + within-tier task age).
 		m_elapsedTime += deltaTime;
 
-		// Process all entities with the required components
+		// Pass 1: per-colonist upkeep, collecting the colonists due for evaluation.
+		// Pass 2 (runDueEvaluations) runs those evaluations; see the header on scheduling.
+		m_due.clear();
+		size_t colonists = 0;
 		for (auto [entity, position, needs, memory, task, movementTarget, inventory] :
 			 world->view<Position, NeedsComponent, Memory, Task, MovementTarget, Inventory>()) {
+			++colonists;
 
 			// Stranded-colonist recovery. A colonist standing off the walkable mesh -- it beelined
 			// into a water hole before the async mesh finished building, spawned on a riverbank
@@ -1227,168 +1228,311 @@ namespace ecs {
 				task.timeSinceEvaluation += deltaTime;
 				continue;
 			}
+			m_due.push_back({entity, classifyEvaluation(task, needs), task.timeSinceEvaluation});
+		}
 
-			// Store current task state for the (tier, score) interruption comparison
-			int		  currentTier = task.priorityTier;
-			bool	  hasActiveAction = (action != nullptr && action->isActive());
-			TaskState previousState = task.state;
-
-			// Check if entity has DecisionTrace component for trace-based selection
-			auto* trace = world->getComponent<DecisionTrace>(entity);
-			if (trace != nullptr) {
-				// Get optional Skills component for skill bonus calculation
-				auto* skills = world->getComponent<Skills>(entity);
-
-				// Build full decision trace (always, for UI updates)
-				buildDecisionTrace(entity, position, needs, memory, task, inventory, skills, *trace);
-
-				// Get the best option's (tier, score) key
-				const auto* selected = trace->getSelected();
-				int			newTier = (selected != nullptr) ? selected->tier : kTierIdle;
-				float		newScore = (selected != nullptr) ? selected->score : 0.0F;
-
-				// Check if the new task is actually different from current task
-				bool isSameTask = false;
-				if (selected != nullptr && task.isActive()) {
-					// Compare task type
-					bool sameType = (task.type == selected->taskType);
-
-					// For wander tasks, same type is enough - don't interrupt just because target
-					// changed. EXCEPT when nav has stopped this wander (no believed route to its
-					// point): it MUST then be free to pick a fresh, reachable target, or it stays
-					// pinned to the unreachable one forever -- a permanent freeze.
-					if (sameType && task.type == TaskType::Wander && task.navState != NavState::CantFindWayTo) {
-						isSameTask = true;
-					} else {
-						bool sameTarget = false;
-						if (selected->targetPosition.has_value()) {
-							const auto& selectedPos = selected->targetPosition.value();
-							// Check that at least one position is non-zero to avoid default (0,0) matches
-							const float selectedLen2 = glm::dot(selectedPos, selectedPos);
-							const float currentLen2 = glm::dot(task.targetPosition, task.targetPosition);
-							if (selectedLen2 > 0.0001F || currentLen2 > 0.0001F) {
-								// Use distance threshold for "same" position (within 0.5 meters)
-								float dist = glm::distance(task.targetPosition, selectedPos);
-								sameTarget = (dist < 0.5F);
-							}
-						}
-						// For PlacePackaged tasks, check entity ID instead of position
-						// (position changes mid-task from source to target after phase 1)
-						bool samePlaceTarget = true;
-						if (selected->taskType == TaskType::PlacePackaged) {
-							if (task.placePackagedEntityId != 0U && selected->placePackagedEntityId != 0U) {
-								samePlaceTarget = (task.placePackagedEntityId == selected->placePackagedEntityId);
-							} else {
-								samePlaceTarget = false;
-							}
-							// For PlacePackaged, entity ID match is sufficient - skip position check
-							if (samePlaceTarget) {
-								sameTarget = true;
-							}
+		runDueEvaluations(deltaTime, colonists);
+	}
+
+	void AIDecisionSystem::runDueEvaluations(float deltaTime, size_t colonists) {
+		using Clock = std::chrono::steady_clock;
+
+		m_evaluationStats = EvaluationStats{};
+		m_evaluationStats.due = static_cast<uint32_t>(m_due.size());
+
+		const bool budgeted = m_evaluationBudgetMicros > 0;
+		size_t	   recheckQuota = m_due.size();
+		if (budgeted) {
+			std::sort(m_due.begin(), m_due.end(), [](const DueEvaluation& a, const DueEvaluation& b) {
+				if (a.urgency != b.urgency) {
+					return a.urgency < b.urgency;
+				}
+				if (a.waited != b.waited) {
+					return a.waited > b.waited;
+				}
+				return a.entity < b.entity;
+			});
+			// Steady rate: every colonist once per kReEvalInterval, rounded up so a small
+			// colony still gets at least one re-check per tick.
+			recheckQuota = static_cast<size_t>(std::ceil(static_cast<float>(colonists) * deltaTime / kReEvalInterval));
+			recheckQuota = std::max<size_t>(recheckQuota, 1);
+		}
+
+		// Unbudgeted, everything due is one batch. Budgeted, the budget is checked between
+		// batches: one evaluation at a time when scoring serially, a few per worker otherwise.
+		size_t batchLimit = m_due.size();
+		if (budgeted) {
+			batchLimit = m_parallelScoring ? std::max(kMinParallelBatch, foundation::JobSystem::shared().threadCount() * kScoringBatchPerWorker)
+										   : 1;
+		}
+
+		const auto tickStart = Clock::now();
+		size_t	   rechecks = 0;
+		size_t	   next = 0;
+		while (next < m_due.size()) {
+			m_batch.clear();
+			for (; next < m_due.size() && m_batch.size() < batchLimit; ++next) {
+				DueEvaluation& due = m_due[next];
+				if (budgeted && due.urgency != EvaluationUrgency::Critical) {
+					const bool isRecheck = due.urgency >= EvaluationUrgency::Periodic;
+					const auto spentMicros = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - tickStart).count();
+					const bool anyRun = m_evaluationStats.evaluated > 0 || !m_batch.empty();
+					const bool overBudget = anyRun && spentMicros >= m_evaluationBudgetMicros;
+					if (overBudget || (isRecheck && rechecks >= recheckQuota)) {
+						// Still due next tick; the timer keeps running so it sorts earlier then.
+						if (auto* task = world->getComponent<Task>(due.entity)) {
+							task->timeSinceEvaluation += deltaTime;
 						}
+						++m_evaluationStats.deferred;
+						continue;
+					}
+					if (isRecheck) {
+						++rechecks;
+					}
+				}
+				// Drawn here, serially and in evaluation order, so the RNG stream doesn't depend
+				// on which worker scores the colonist.
+				for (auto& offset : due.wanderOffsets) {
+					offset = drawWanderOffset();
+				}
+				m_batch.push_back(next);
+			}
 
-						isSameTask = sameType && sameTarget && samePlaceTarget;
+			if (m_parallelScoring && m_batch.size() >= kMinParallelBatch) {
+				foundation::JobSystem::shared().parallelFor(0, m_batch.size(), 1, [this](size_t begin, size_t end) {
+					for (size_t i = begin; i < end; ++i) {
+						scoreEvaluation(m_due[m_batch[i]]);
 					}
+				});
+			} else {
+				for (size_t index : m_batch) {
+					scoreEvaluation(m_due[index]);
 				}
+			}
+
+			m_batchStale = false;
+			for (size_t index : m_batch) {
+				DueEvaluation& due = m_due[index];
+				const auto		commitStart = Clock::now();
+				commitEvaluation(due);
+				const float micros = due.scoreMicros + std::chrono::duration<float, std::micro>(Clock::now() - commitStart).count();
+				++m_evaluationStats.evaluated;
+				m_evaluationStats.totalMicros += micros;
+				m_evaluationStats.maxMicros = std::max(m_evaluationStats.maxMicros, micros);
+			}
+		}
+		m_due.clear();
+	}
+
+	AIDecisionSystem::EvaluationUrgency AIDecisionSystem::classifyEvaluation(const Task& task, const NeedsComponent& needs) {
+		for (auto needType : NeedsComponent::kActionableNeeds) {
+			if (needs.get(needType).isCritical()) {
+				return EvaluationUrgency::Critical;
+			}
+		}
+		if (!task.isActive() || task.state == TaskState::Arrived || task.navState == NavState::CantFindWayTo) {
+			return EvaluationUrgency::Undecided;
+		}
+		return task.type == TaskType::Wander ? EvaluationUrgency::Wander : EvaluationUrgency::Periodic;
+	}
+
+	void AIDecisionSystem::scoreEvaluation(DueEvaluation& due) {
+		const auto start = std::chrono::steady_clock::now();
+		const EntityID entity = due.entity;
+		const auto*	   position = world->getComponent<Position>(entity);
+		const auto*	   needs = world->getComponent<NeedsComponent>(entity);
+		const auto*	   memory = world->getComponent<Memory>(entity);
+		const auto*	   task = world->getComponent<Task>(entity);
+		const auto*	   inventory = world->getComponent<Inventory>(entity);
+		auto*		   trace = world->getComponent<DecisionTrace>(entity);
+		if (position != nullptr && needs != nullptr && memory != nullptr && task != nullptr && inventory != nullptr && trace != nullptr) {
+			// Build full decision trace (always, for UI updates), with the optional Skills
+			// component for the skill bonus
+			const auto* skills = world->getComponent<Skills>(entity);
+			buildDecisionTrace(entity, *position, *needs, *memory, *task, *inventory, skills, due.wanderOffsets, *trace);
+		}
+		due.scoreMicros = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+	}
 
-				// Decision: Should we switch tasks?
-				// Don't switch if it's the same task we're already doing
-				bool shouldSwitch = !isSameTask;
-
-				// Two-hand-carry-must-finish-deposit invariant. A two-hand armful (e.g. Wood) rides in
-				// BOTH hands and can't be stowed to belt/backpack, so ANY switch whose first action needs
-				// the hands makes the chain-interruption below DROP the whole load on the ground. Protect
-				// the in-flight delivery against any same-or-lower-priority challenger that would otherwise
-				// drop it -- whether to fetch MORE of the very item it's already carrying (a withdraw/drop
-				// loop that never provisions the destination) or to wander off idle with the load still in
-				// hand. Hold the delivery so it completes; the colonist
-				// re-evaluates with empty hands once the load is deposited.
-				//
-				// Two escapes/limits keep this from ever pinning a colonist on a stuck haul:
-				//   - It never fires when the delivery itself has no believed route to its destination
-				//     (navState CantFindWayTo) -- holding an undeliverable load would strand it.
-				//   - A strictly-higher-tier challenger (critical need, active work order) still preempts;
-				//     dropping for an emergency is acceptable. Only same-or-lower-priority challengers
-				//     (the opportunistic pull, idle Wander) are blocked.
-				const bool currentHaulUnreachable = (task.navState == NavState::CantFindWayTo);
-				const bool carryingTwoHandLoad = task.type == TaskType::Haul && !task.haulItemDefName.empty() &&
-					ecs::itemIsTwoHand(m_registry, task.haulItemDefName) && inventory.isHolding(task.haulItemDefName);
-				if (shouldSwitch && !currentHaulUnreachable && carryingTwoHandLoad && selected != nullptr) {
-					// Case 1: a Harvest of the same yield (e.g. clearing a footprint emits a Harvest for the
-					// blockers' Wood). Held regardless of tier -- the chop->drop->chop loop it forms is the
-					// original two-hand-drop bug this guard was built for.
-					const bool sameYieldHarvest = selected->taskType == TaskType::Harvest &&
-						selected->harvestYieldDefNameId == m_registry.getDefNameId(task.haulItemDefName);
-					// Case 2: ANY same-or-lower-priority challenger. A two-hand carry must finish its deposit
-					// before taking on any task that does not outrank it -- idle Wander (tier 7) included. Two
-					// ways this fires: (a) the storage-priority pull, where mid-carry evaluateHaulOptions'
-					// pull-source scan re-emits a fresh withdraw option still pointing at the SOURCE box (it
-					// still has stock) with a high score (distance 0, the colonist is standing on it), whose
-					// targetPosition is the source rather than the in-flight deposit target, so the isSameTask
-					// check above sees a different target and treats it as a switch -- dropping the un-stowable
-					// armful to withdraw again, then dropping again, in a loop; (b) the source is drained to
-					// its min so no pull is offered and the top option is Wander, which -- not being a Haul
-					// -- the old taskType==Haul restriction let slip past, so the colonist walked off
-					// carrying the load indefinitely. A strictly-higher-tier challenger (critical need,
-					// active work order) still preempts; dropping for an emergency is acceptable.
-					const bool sameOrLowerPriorityChallenger = selected->tier >= task.priorityTier;
-					if (sameYieldHarvest || sameOrLowerPriorityChallenger) {
-						shouldSwitch = false;
-						task.timeSinceEvaluation = 0.0F; // we did evaluate; hold the delivery
+	void AIDecisionSystem::commitEvaluation(DueEvaluation& due) {
+		const EntityID entity = due.entity;
+		auto*		   positionPtr = world->getComponent<Position>(entity);
+		auto*		   needsPtr = world->getComponent<NeedsComponent>(entity);
+		auto*		   memoryPtr = world->getComponent<Memory>(entity);
+		auto*		   taskPtr = world->getComponent<Task>(entity);
+		auto*		   movementTargetPtr = world->getComponent<MovementTarget>(entity);
+		auto*		   inventoryPtr = world->getComponent<Inventory>(entity);
+		if (positionPtr == nullptr || needsPtr == nullptr || memoryPtr == nullptr || taskPtr == nullptr ||
+			movementTargetPtr == nullptr || inventoryPtr == nullptr) {
+			return; // destroyed or stripped by an earlier commit this tick
+		}
+		auto& position = *positionPtr;
+		auto& task = *taskPtr;
+		auto& movementTarget = *movementTargetPtr;
+		auto& inventory = *inventoryPtr;
+		auto* action = world->getComponent<Action>(entity);
+
+		// Store current task state for the (tier, score) interruption comparison
+		int		  currentTier = task.priorityTier;
+		bool	  hasActiveAction = (action != nullptr && action->isActive());
+		TaskState previousState = task.state;
+
+		// Check if entity has DecisionTrace component for trace-based selection
+		auto* trace = world->getComponent<DecisionTrace>(entity);
+		if (trace != nullptr) {
+			// An earlier commit in this batch changed state the trace was scored against
+			if (m_batchStale) {
+				scoreEvaluation(due);
+			}
+
+			// Get the best option's (tier, score) key
+			const auto* selected = trace->getSelected();
+			int			newTier = (selected != nullptr) ? selected->tier : kTierIdle;
+			float		newScore = (selected != nullptr) ? selected->score : 0.0F;
+
+			// Check if the new task is actually different from current task
+			bool isSameTask = false;
+			if (selected != nullptr && task.isActive()) {
+				// Compare task type
+				bool sameType = (task.type == selected->taskType);
+
+				// For wander tasks, same type is enough - don't interrupt just because target
+				// changed. EXCEPT when nav has stopped this wander (no believed route to its
+				// point): it MUST then be free to pick a fresh, reachable target, or it stays
+				// pinned to the unreachable one forever -- a permanent freeze.
+				if (sameType && task.type == TaskType::Wander && task.navState != NavState::CantFindWayTo) {
+					isSameTask = true;
+				} else {
+					bool sameTarget = false;
+					if (selected->targetPosition.has_value()) {
+						const auto& selectedPos = selected->targetPosition.value();
+						// Check that at least one position is non-zero to avoid default (0,0) matches
+						const float selectedLen2 = glm::dot(selectedPos, selectedPos);
+						const float currentLen2 = glm::dot(task.targetPosition, task.targetPosition);
+						if (selectedLen2 > 0.0001F || currentLen2 > 0.0001F) {
+							// Use distance threshold for "same" position (within 0.5 meters)
+							float dist = glm::distance(task.targetPosition, selectedPos);
+							sameTarget = (dist < 0.5F);
+						}
 					}
+					// For PlacePackaged tasks, check entity ID instead of position
+					// (position changes mid-task from source to target after phase 1)
+					bool samePlaceTarget = true;
+					if (selected->taskType == TaskType::PlacePackaged) {
+						if (task.placePackagedEntityId != 0U && selected->placePackagedEntityId != 0U) {
+							samePlaceTarget = (task.placePackagedEntityId == selected->placePackagedEntityId);
+						} else {
+							samePlaceTarget = false;
+						}
+						// For PlacePackaged, entity ID match is sufficient - skip position check
+						if (samePlaceTarget) {
+							sameTarget = true;
+						}
+					}
+
+					isSameTask = sameType && sameTarget && samePlaceTarget;
 				}
+			}
+
+			// Decision: Should we switch tasks?
+			// Don't switch if it's the same task we're already doing
+			bool shouldSwitch = !isSameTask;
+
+			// Two-hand-carry-must-finish-deposit invariant. A two-hand armful (e.g. Wood) rides in
+			// BOTH hands and can't be stowed to belt/backpack, so ANY switch whose first action needs
+			// the hands makes the chain-interruption below DROP the whole load on the ground. Protect
+			// the in-flight delivery against any same-or-lower-priority challenger that would otherwise
+			// drop it -- whether to fetch MORE of the very item it's already carrying (a withdraw/drop
+			// loop that never provisions the destination) or to wander off idle with the load still in
+			// hand. Hold the delivery so it completes; the colonist
+			// re-evaluates with empty hands once the load is deposited.
+			//
+			// Two escapes/limits keep this from ever pinning a colonist on a stuck haul:
+			//   - It never fires when the delivery itself has no believed route to its destination
+			//     (navState CantFindWayTo) -- holding an undeliverable load would strand it.
+			//   - A strictly-higher-tier challenger (critical need, active work order) still preempts;
+			//     dropping for an emergency is acceptable. Only same-or-lower-priority challengers
+			//     (the opportunistic pull, idle Wander) are blocked.
+			const bool currentHaulUnreachable = (task.navState == NavState::CantFindWayTo);
+			const bool carryingTwoHandLoad = task.type == TaskType::Haul && task.haulItemDefNameId != 0 &&
+				ecs::itemIsTwoHand(m_registry, task.haulItemDefNameId) && inventory.isHolding(task.haulItemDefNameId);
+			if (shouldSwitch && !currentHaulUnreachable && carryingTwoHandLoad && selected != nullptr) {
+				// Case 1: a Harvest of the same yield (e.g. clearing a footprint emits a Harvest for the
+				// blockers' Wood). Held regardless of tier -- the chop->drop->chop loop it forms is the
+				// original two-hand-drop bug this guard was built for.
+				const bool sameYieldHarvest = selected->taskType == TaskType::Harvest &&
+					selected->harvestYieldDefNameId == task.haulItemDefNameId;
+				// Case 2: ANY same-or-lower-priority challenger. A two-hand carry must finish its deposit
+				// before taking on any task that does not outrank it -- idle Wander (tier 7) included. Two
+				// ways this fires: (a) the storage-priority pull, where mid-carry evaluateHaulOptions'
+				// pull-source scan re-emits a fresh withdraw option still pointing at the SOURCE box (it
+				// still has stock) with a high score (distance 0, the colonist is standing on it), whose
+				// targetPosition is the source rather than the in-flight deposit target, so the isSameTask
+				// check above sees a different target and treats it as a switch -- dropping the un-stowable
+				// armful to withdraw again, then dropping again, in a loop; (b) the source is drained to
+				// its min so no pull is offered and the top option is Wander, which -- not being a Haul
+				// -- the old taskType==Haul restriction let slip past, so the colonist walked off
+				// carrying the load indefinitely. A strictly-higher-tier challenger (critical need,
+				// active work order) still preempts; dropping for an emergency is acceptable.
+				const bool sameOrLowerPriorityChallenger = selected->tier >= task.priorityTier;
+				if (sameYieldHarvest || sameOrLowerPriorityChallenger) {
+					shouldSwitch = false;
+					task.timeSinceEvaluation = 0.0F; // we did evaluate; hold the delivery
+				}
+			}
+
+			if (isSameTask) {
+				task.timeSinceEvaluation = 0.0F; // Reset timer, we did evaluate
+				// Update the (tier, score) key even when staying on the same task (the score can
+				// change, e.g. PlacePackaged promotes to tier 4 when the colonist starts carrying).
+				task.priorityTier = newTier;
+				task.priority = newScore;
+			}
 
-				if (isSameTask) {
+			// If action in progress, check if we can/should interrupt. Tier is inviolable; the
+			// within-tier anti-thrash margin is already applied at SELECTION (the in-progress
+			// option carries the hysteresis bonus), so re-applying a score gap here would
+			// double-count it. The gate's remaining job is the tier rule and the
+			// non-interruptable block.
+			if (shouldSwitch && hasActiveAction && previousState == TaskState::Arrived) {
+				if (!action->interruptable) {
+					// Biological necessities (Eat, Drink, Toilet) cannot be interrupted
+					shouldSwitch = false;
+					task.timeSinceEvaluation = 0.0F; // Reset timer, we did evaluate
+				} else if (newTier > currentTier) {
+					// A lower-tier challenger never preempts in-progress work. (A higher tier
+					// always interrupts; a same-tier winner already beat the hysteresis margin at
+					// selection, so it is honored.)
+					shouldSwitch = false;
 					task.timeSinceEvaluation = 0.0F; // Reset timer, we did evaluate
-					// Update the (tier, score) key even when staying on the same task (the score can
-					// change, e.g. PlacePackaged promotes to tier 4 when the colonist starts carrying).
-					task.priorityTier = newTier;
-					task.priority = newScore;
 				}
+			}
 
-				// If action in progress, check if we can/should interrupt. Tier is inviolable; the
-				// within-tier anti-thrash margin is already applied at SELECTION (the in-progress
-				// option carries the hysteresis bonus), so re-applying a score gap here would
-				// double-count it. The gate's remaining job is the tier rule and the
-				// non-interruptable block.
-				if (shouldSwitch && hasActiveAction && previousState == TaskState::Arrived) {
-					if (!action->interruptable) {
-						// Biological necessities (Eat, Drink, Toilet) cannot be interrupted
-						shouldSwitch = false;
-						task.timeSinceEvaluation = 0.0F; // Reset timer, we did evaluate
-					} else if (newTier > currentTier) {
-						// A lower-tier challenger never preempts in-progress work. (A higher tier
-						// always interrupts; a same-tier winner already beat the hysteresis margin at
-						// selection, so it is honored.)
-						shouldSwitch = false;
-						task.timeSinceEvaluation = 0.0F; // Reset timer, we did evaluate
-					}
+			if (shouldSwitch) {
+				// Handle chain interruption if mid-chain and new task needs hands
+				if (task.chainId.has_value() && task.chainStep > 0 && selected != nullptr) {
+					handleChainInterruption(entity, task, inventory, position, selected->taskType, selected->needType);
+					// It may drop items or a packaged entity that other colonists' options read
+					m_batchStale = true;
 				}
 
-				if (shouldSwitch) {
-					// Handle chain interruption if mid-chain and new task needs hands
-					if (task.chainId.has_value() && task.chainStep > 0 && selected != nullptr) {
-						handleChainInterruption(entity, task, inventory, position, selected->taskType, selected->needType);
-					}
+				// Clear and assign new task
+				task.clear();
+				task.timeSinceEvaluation = 0.0F;
+				selectTaskFromTrace(entity, task, movementTarget, *trace, position);
+				task.priorityTier = newTier; // Store the (tier, score) key for future comparisons
+				task.priority = newScore;
 
-					// Clear and assign new task
-					task.clear();
-					task.timeSinceEvaluation = 0.0F;
-					selectTaskFromTrace(entity, task, movementTarget, *trace, position);
-					task.priorityTier = newTier; // Store the (tier, score) key for future comparisons
-					task.priority = newScore;
-
-					LOG_INFO(
-						Engine,
-						"[AI] Entity %llu: %s (tier %d, score %.0f) → (%.1f, %.1f)",
-						static_cast<unsigned long long>(entity),
-						task.reason.c_str(),
-						task.priorityTier,
-						task.priority,
-						task.targetPosition.x,
-						task.targetPosition.y
-					);
-				}
+				LOG_INFO(
+					Engine,
+					"[AI] Entity %llu: %s (tier %d, score %.0f) → (%.1f, %.1f)",
+					static_cast<unsigned long long>(entity),
+					task.reason.c_str(),
+					task.priorityTier,
+					task.priority,
+					task.targetPosition.x,
+					task.targetPosition.y
+				);
 			}
 		}
 	}
@@ -1460,7 +1604,7 @@ namespace ecs {
 		return false;
 	}
 
-	glm::vec2 AIDecisionSystem::generateWanderTarget(const glm::vec2& currentPos) {
+	glm::vec2 AIDecisionSystem::drawWanderOffset() {
 		// Generate random angle and distance
 		std::uniform_real_distribution<float> angleDist(0.0F, 2.0F * std::numbers::pi_v<float>);
 		std::uniform_real_distribution<float> distDist(kWanderRadius * 0.3F, kWanderRadius);
@@ -1468,7 +1612,7 @@ namespace ecs {
 		float angle = angleDist(m_rng);
 		float distance = distDist(m_rng);
 
-		return currentPos + glm::vec2{std::cos(angle) * distance, std::sin(angle) * distance};
+		return glm::vec2{std::cos(angle) * distance, std::sin(angle) * distance};
 	}
 
 	void AIDecisionSystem::buildDecisionTrace(
@@ -1479,6 +1623,7 @@ namespace ecs {
 		const Task&			  currentTask,
 		const Inventory&	  inventory,
 		const Skills*		  skills,
+		const WanderOffsets&  wanderOffsets,
 		DecisionTrace&		  trace
 	) {
 		trace.clear();
@@ -1508,11 +1653,7 @@ namespace ecs {
 					option.targetPosition = position.value;
 					option.distanceToTarget = 0.0F;
 					option.status = need.needsAttention() ? OptionStatus::Available : OptionStatus::Satisfied;
-					option.reason = formatOptionReason(option, needTypeName(needType));
-					// Add special marker to indicate this is from inventory
-					if (option.status == OptionStatus::Available) {
-						option.reason += " (from inventory)";
-					}
+					option.reason = OptionReason::NeedFromInventory;
 					trace.options.push_back(option);
 					continue;
 				}
@@ -1532,10 +1673,7 @@ namespace ecs {
 							option.targetDefNameId = harvestable->defNameId;
 							option.distanceToTarget = glm::distance(position.value, harvestable->position);
 							option.status = need.needsAttention() ? OptionStatus::Available : OptionStatus::Satisfied;
-							option.reason = formatOptionReason(option, needTypeName(needType));
-							if (option.status == OptionStatus::Available) {
-								option.reason += " (harvest)";
-							}
+							option.reason = OptionReason::NeedFromHarvest;
 							trace.options.push_back(option);
 							continue;
 						}
@@ -1544,7 +1682,7 @@ namespace ecs {
 
 				// No food in inventory and no harvestable food source found
 				option.status = need.needsAttention() ? OptionStatus::NoSource : OptionStatus::Satisfied;
-				option.reason = formatOptionReason(option, needTypeName(needType));
+				option.reason = OptionReason::Need;
 				trace.options.push_back(option);
 				continue;
 			}
@@ -1598,7 +1736,7 @@ namespace ecs {
 				option.status = need.needsAttention() ? OptionStatus::NoSource : OptionStatus::Satisfied;
 			}
 
-			option.reason = formatOptionReason(option, needTypeName(needType));
+			option.reason = OptionReason::Need;
 			trace.options.push_back(option);
 		}
 
@@ -1644,10 +1782,10 @@ namespace ecs {
 				gatherOption.targetPosition = edibleHarvestable->position;
 				gatherOption.distanceToTarget = nearestEdibleDist;
 				gatherOption.status = OptionStatus::Available;
-				gatherOption.reason = "Gathering food (inventory empty)";
+				gatherOption.reason = OptionReason::GatherFood;
 			} else {
 				gatherOption.status = OptionStatus::NoSource;
-				gatherOption.reason = "No food source known";
+				gatherOption.reason = OptionReason::NoFoodSource;
 			}
 
 			trace.options.push_back(gatherOption);
@@ -1694,7 +1832,7 @@ namespace ecs {
 			craftOption.threshold = 0.0F;
 			craftOption.targetPosition = stationPos.value;
 			craftOption.distanceToTarget = glm::distance(position.value, stationPos.value);
-			craftOption.craftRecipeDefName = nextJob->recipeDefName;
+			craftOption.craftRecipe = recipe;
 			craftOption.stationEntityId = static_cast<uint64_t>(stationEntity);
 			craftOption.tiebreakId = static_cast<uint64_t>(stationEntity);
 
@@ -1707,10 +1845,10 @@ namespace ecs {
 			// option is the crafting WORK, workable only once the station holds every input.
 			if (hasAllInputs) {
 				craftOption.status = OptionStatus::Available;
-				craftOption.reason = "Crafting " + recipe->label;
+				craftOption.reason = OptionReason::Craft;
 			} else {
 				craftOption.status = OptionStatus::NoSource;
-				craftOption.reason = "Crafting " + recipe->label + " (awaiting materials)";
+				craftOption.reason = OptionReason::CraftAwaitingMaterials;
 			}
 
 			trace.options.push_back(craftOption);
@@ -1732,7 +1870,7 @@ namespace ecs {
 		evaluateDeconstructOptions(world, position.value, skills, trace);
 
 		// Place packaged items at target locations
-		evaluatePlacePackagedOptions(world, position.value, inventory, trace);
+		evaluatePlacePackagedOptions(world, m_registry, position.value, inventory, trace);
 
 		// Agent footprint + belief for the reachability checks below (reachable-wander generation
 		// and the option filter). Defined once here so both uses share them.
@@ -1760,10 +1898,10 @@ namespace ecs {
 			// reachable -- a colonist hemmed in by water/obstacles where every point lands somewhere
 			// it can't path to -- emit no idle option at all. The no-option hold then makes it stand
 			// and look around instead of committing to an unreachable point and thrashing on it.
-			glm::vec2 wanderTarget	= generateWanderTarget(position.value);
+			glm::vec2 wanderTarget	= position.value + wanderOffsets[0];
 			bool	  foundReachable = !haveMesh || m_navSystem->isReachable(position.value, wanderTarget, agentRadius, belief);
-			for (int attempt = 0; !foundReachable && attempt < 5; ++attempt) {
-				const glm::vec2 candidate = generateWanderTarget(position.value);
+			for (size_t attempt = 1; !foundReachable && attempt < wanderOffsets.size(); ++attempt) {
+				const glm::vec2 candidate = position.value + wanderOffsets[attempt];
 				if (m_navSystem->isReachable(position.value, candidate, agentRadius, belief)) {
 					wanderTarget   = candidate;
 					foundReachable = true;
@@ -1774,7 +1912,7 @@ namespace ecs {
 				wanderOption.taskType		= TaskType::Wander;
 				wanderOption.needType		= NeedType::Count; // N/A
 				wanderOption.status			= OptionStatus::Available;
-				wanderOption.reason			= "All needs satisfied";
+				wanderOption.reason			= OptionReason::Idle;
 				wanderOption.targetPosition = wanderTarget;
 				trace.options.push_back(wanderOption);
 			}
@@ -1842,10 +1980,22 @@ namespace ecs {
 				continue;
 			}
 			option.status = OptionStatus::Selected;
-			trace.selectionSummary = "Selected: " + option.reason;
 			break;
 		}
 
+		// An unwatched trace only needs the winner (see setFullTraces)
+		if (!m_fullTraces && entity != m_watchedColonist) {
+			const auto selected = std::find_if(trace.options.begin(), trace.options.end(), [](const EvaluatedOption& option) {
+				return option.status == OptionStatus::Selected;
+			});
+			if (selected != trace.options.end()) {
+				std::iter_swap(trace.options.begin(), selected);
+				trace.options.resize(1);
+			} else {
+				trace.options.clear();
+			}
+		}
+
 		// Stamp the evaluation time so the inspector can detect a changed trace. m_elapsedTime is
 		// this system's monotonic seconds-since-start clock (deltaTime accumulated in update); a real
 		// game-time clock isn't wired to this system yet, but a monotonic timestamp is all the UI
@@ -1882,11 +2032,11 @@ namespace ecs {
 		task.type = selected->taskType;
 		task.needToFulfill = selected->needType;
 		task.targetPosition = selected->targetPosition.value_or(position.value);
-		task.reason = selected->reason;
+		task.reason = describeOption(*selected, m_registry);
 
 		// Copy crafting-specific fields for Craft tasks
 		if (selected->taskType == TaskType::Craft) {
-			task.craftRecipeDefName = selected->craftRecipeDefName;
+			task.craftRecipeDefName = selected->craftRecipe != nullptr ? selected->craftRecipe->defName : std::string();
 			task.targetStationId = selected->stationEntityId;
 		}
 
@@ -1916,7 +2066,7 @@ namespace ecs {
 		// Haul is a two-step chain: Pickup (step 0) → Deposit (step 1)
 		// If Haul goal has a chainId (linked to Harvest), use that for continuity bonus
 		if (selected->taskType == TaskType::Haul) {
-			task.haulItemDefName = selected->haulItemDefName;
+			task.haulItemDefNameId = selected->haulItemDefNameId;
 			task.haulQuantity = selected->haulQuantity;
 			task.haulSourcePosition = selected->haulSourcePosition.value_or(glm::vec2{0.0F, 0.0F});
 			task.haulSourceStorageId = selected->haulSourceStorageId;
@@ -2091,31 +2241,6 @@ namespace ecs {
 		return NavRequestOutcome::Routed;
 	}
 
-	std::string AIDecisionSystem::formatOptionReason(const EvaluatedOption& option, const char* needName) {
-		if (option.taskType == TaskType::Wander) {
-			return "All needs satisfied";
-		}
-
-		std::string reason = needName;
-		reason += " at " + std::to_string(static_cast<int>(option.needValue)) + "%";
-
-		if (option.status == OptionStatus::NoSource) {
-			reason += " (no known source)";
-		} else if (option.needValue < 10.0F) {
-			reason += " (critical)";
-		} else if (option.status == OptionStatus::Available || option.status == OptionStatus::Selected) {
-			if (option.distanceToTarget > 0.0F) {
-				reason += " (" + std::to_string(static_cast<int>(option.distanceToTarget)) + "m away)";
-			} else if (option.targetPosition.has_value()) {
-				reason += " (using ground)";
-			}
-		} else if (option.status == OptionStatus::Satisfied) {
-			reason += " (satisfied)";
-		}
-
-		return reason;
-	}
-
 	void AIDecisionSystem::handleChainInterruption(
 		EntityID		entity,
 		const Task&		task,
@@ -2134,40 +2259,41 @@ namespace ecs {
 		const auto entityId = static_cast<unsigned long long>(entity);
 
 		// For Haul tasks: item is in hands
-		if (task.type == TaskType::Haul && !task.haulItemDefName.empty()) {
+		if (task.type == TaskType::Haul && task.haulItemDefNameId != 0) {
+			const uint32_t	   itemId = task.haulItemDefNameId;
+			const std::string& itemName = m_registry.getDefName(itemId);
+
 			// Verify item is actually in hands before operating
-			if (!inventory.isHolding(task.haulItemDefName)) {
-				LOG_WARNING(Engine, "[AI] Entity %llu: chain interrupted but not holding %s", entityId, task.haulItemDefName.c_str());
+			if (!inventory.isHolding(itemId)) {
+				LOG_WARNING(Engine, "[AI] Entity %llu: chain interrupted but not holding %s", entityId, itemName.c_str());
 				return;
 			}
 
-			const auto* assetDef = m_registry.getDefinition(task.haulItemDefName);
+			const auto* assetDef = m_registry.getDefinition(itemId);
 			uint8_t		handsRequired = (assetDef != nullptr) ? assetDef->handsRequired : 1;
 
 			if (handsRequired == 1) {
 				// 1-handed item: try the belt (quick-draw slot) first, then the backpack. The item is
 				// in hand, so a belt stow seats a copy on the belt and clears the hand.
-				if (inventory.stowToBelt(task.haulItemDefName)) {
-					inventory.putDown(task.haulItemDefName);
-					LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, stowed %s to belt", entityId, task.haulItemDefName.c_str());
+				if (inventory.stowToBelt(itemId)) {
+					inventory.putDown(itemId);
+					LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, stowed %s to belt", entityId, itemName.c_str());
 					return;
 				}
-				if (inventory.stowToBackpack(task.haulItemDefName)) {
-					LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, stowed %s to backpack", entityId, task.haulItemDefName.c_str());
+				if (inventory.stowToBackpack(itemId)) {
+					LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, stowed %s to backpack", entityId, itemName.c_str());
 					return;
 				}
 				// Belt and backpack full - fall through to drop
-				LOG_INFO(
-					Engine, "[AI] Entity %llu: chain interrupted, dropping %s (belt and backpack full)", entityId, task.haulItemDefName.c_str()
-				);
+				LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, dropping %s (belt and backpack full)", entityId, itemName.c_str());
 			} else {
-				LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, dropping %s (2-handed)", entityId, task.haulItemDefName.c_str());
+				LOG_INFO(Engine, "[AI] Entity %llu: chain interrupted, dropping %s (2-handed)", entityId, itemName.c_str());
 			}
 
 			// Drop the item
-			inventory.putDown(task.haulItemDefName);
+			inventory.putDown(itemId);
 			if (m_onDropItem) {
-				m_onDropItem(task.haulItemDefName, position.value.x, position.value.y);
+				m_onDropItem(itemName, position.value.x, position.value.y);
 			}
 			return;
 		}
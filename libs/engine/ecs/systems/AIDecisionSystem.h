@@ -17,10 +17,14 @@
 #include "../components/Needs.h"
 #include "../components/Task.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <glm/vec2.hpp>
 #include <optional>
 #include <random>
+#include <vector>
 
 namespace engine::assets {
 class AssetRegistry;
@@ -93,12 +97,83 @@ public:
 	/// reachable is near the click (no order issued).
 	[[nodiscard]] std::optional<glm::vec2> issuePlayerMoveOrder(EntityID entity, glm::vec2 worldGoal);
 
+	// --- Evaluation scheduling ---------------------------------------------------
+	//
+	// Each update() first runs the cheap per-colonist upkeep (off-mesh recovery, repath,
+	// nav-state hold) for everyone, collecting the colonists whose re-evaluation is due.
+	// Evaluations (decision trace + task selection: goal, memory and station scans plus
+	// path requests) are the expensive part. With no budget (the default) every due
+	// colonist evaluates this tick, in view order. With a budget they run by urgency:
+	//   Critical  - a critical need: always evaluated, even past the budget
+	//   Undecided - no task, arrived, or no route to the current one
+	//   Periodic  - the kReEvalInterval re-check of ongoing work
+	//   Wander    - the per-tick preemption check of an idle wander
+	// and, within a class, the longest-waiting first. Once the budget is spent the rest
+	// wait for the next tick with their timers still running, so they sort earlier then.
+	// Periodic and Wander re-checks are also capped at the steady rate (every colonist
+	// once per kReEvalInterval), which staggers a cohort that came due on the same tick
+	// (colonists spawned together) across the interval instead of re-evaluating it in
+	// one spike.
+
+	/// Urgency class of a due evaluation, most urgent first
+	enum class EvaluationUrgency : uint8_t { Critical, Undecided, Periodic, Wander };
+
+	/// Per-tick evaluation budget in microseconds; 0 = evaluate every due colonist each
+	/// tick (the default). A budgeted run depends on wall-clock time, so it is not
+	/// reproducible tick for tick.
+	void setEvaluationBudget(uint32_t microseconds) { m_evaluationBudgetMicros = microseconds; }
+	[[nodiscard]] uint32_t evaluationBudget() const { return m_evaluationBudgetMicros; }
+
+	/// What the last update() evaluated, for profiling
+	struct EvaluationStats {
+		uint32_t due = 0;		  // colonists whose re-evaluation was due
+		uint32_t evaluated = 0;	  // of those, evaluated this tick
+		uint32_t deferred = 0;	  // pushed to a later tick (budget spent or stagger cap)
+		float	 totalMicros = 0.0F; // time spent in evaluations
+		float	 maxMicros = 0.0F;	 // slowest single evaluation
+	};
+	[[nodiscard]] const EvaluationStats& lastEvaluationStats() const { return m_evaluationStats; }
+
+	// An evaluation is two phases. Scoring (buildDecisionTrace: needs, haul, harvest, craft,
+	// build and placement options) only reads the world and writes the colonist's own
+	// DecisionTrace; the commit (switch decision, chain interruption, task + path setup) writes.
+	// Due evaluations are scored as a batch -- on JobSystem workers when parallel scoring is on
+	// and the batch is big enough -- then committed one by one in the order above. Wander
+	// targets are drawn from the seeded RNG before scoring, in that same order. A commit that
+	// changes what scoring reads (a chain interruption drops items or a packaged entity) marks
+	// the rest of the batch stale, and those colonists are re-scored before their commit.
+	// So results are identical with or without parallel scoring. Budgeted runs are checked
+	// between batches; see kScoringBatchPerWorker.
+
+	/// Score due evaluations on JobSystem workers (default on); off = score on the calling thread
+	void setParallelScoring(bool enabled) { m_parallelScoring = enabled; }
+	[[nodiscard]] bool parallelScoring() const { return m_parallelScoring; }
+
+	// --- Decision trace detail ----------------------------------------------------
+	//
+	// Every option is scored either way. With full traces off, only the watched colonist
+	// (the one whose task list is open) keeps its whole option list; every other trace is
+	// cut down to the selected option once it is chosen, which is all the commit reads.
+
+	/// Keep every colonist's full option list (default on: tests and tools inspect anyone)
+	void setFullTraces(bool enabled) { m_fullTraces = enabled; }
+	[[nodiscard]] bool fullTraces() const { return m_fullTraces; }
+
+	/// Colonist whose trace is kept in full when full traces are off (kInvalidEntity = none).
+	/// The full list appears at that colonist's next evaluation.
+	void setWatchedColonist(EntityID entity) { m_watchedColonist = entity; }
+	[[nodiscard]] EntityID watchedColonist() const { return m_watchedColonist; }
+
 	[[nodiscard]] int priority() const override { return 60; }
 	[[nodiscard]] const char* name() const override { return "AIDecision"; }
 
 private:
-	/// Generate a random position within wander radius
-	[[nodiscard]] glm::vec2 generateWanderTarget(const glm::vec2& currentPos);
+	/// Wander candidates tried per evaluation (the first plus up to five reachability retries)
+	static constexpr size_t kWanderAttempts = 6;
+	using WanderOffsets = std::array<glm::vec2, kWanderAttempts>;
+
+	/// Draw a random offset within the wander radius
+	[[nodiscard]] glm::vec2 drawWanderOffset();
 
 	/// Check if entity should re-evaluate its current task
 	/// @param task Current task
@@ -109,11 +184,35 @@ private:
 	///        keeps its periodic throttle
 	[[nodiscard]] bool shouldReEvaluate(const struct Task& task, const struct NeedsComponent& needs, const struct Action* action, bool movementTargetActive);
 
+	/// Scheduling class of a colonist whose shouldReEvaluate() is true
+	[[nodiscard]] static EvaluationUrgency classifyEvaluation(const struct Task& task, const struct NeedsComponent& needs);
+
+	/// A colonist whose re-evaluation came due this tick
+	struct DueEvaluation {
+		EntityID		  entity;
+		EvaluationUrgency urgency;
+		float			  waited;			  // task.timeSinceEvaluation when it came due
+		WanderOffsets	  wanderOffsets{};	  // drawn before scoring, in evaluation order
+		float			  scoreMicros = 0.0F; // time spent scoring (on whichever thread)
+	};
+
+	/// Pass 2 of update(): run (or defer) the evaluations collected in m_due
+	void runDueEvaluations(float deltaTime, size_t colonists);
+
+	/// Scoring phase: rebuild the colonist's decision trace. Reads the world and writes only
+	/// the colonist's own DecisionTrace, so a batch can run concurrently.
+	void scoreEvaluation(DueEvaluation& due);
+
+	/// Commit phase (serial): switch tasks if a better option won. Looks the colonist's
+	/// components up again, so it is safe after other colonists' commits.
+	void commitEvaluation(DueEvaluation& due);
+
 	/// Build decision trace by evaluating all options
 	/// Populates the trace with all needs + wander, sorted by priority
 	/// @param currentTask Current task (used to preserve target when already pursuing a need)
 	/// @param inventory Colonist inventory (for checking food availability)
 	/// @param skills Optional colonist skills (for skill bonus calculation)
+	/// @param wanderOffsets Pre-drawn wander candidates, relative to the colonist
 	void buildDecisionTrace(
 		EntityID entity,
 		const struct Position& position,
@@ -122,6 +221,7 @@ private:
 		const struct Task& currentTask,
 		const struct Inventory& inventory,
 		const struct Skills* skills,
+		const WanderOffsets& wanderOffsets,
 		struct DecisionTrace& trace);
 
 	/// Select task from the decision trace (picks first Selected option)
@@ -155,11 +255,6 @@ private:
 	NavRequestOutcome requestNavPath(EntityID entity, const glm::vec2& goal, const struct Position& position,
 									 const struct Memory& memory, struct MovementTarget& movementTarget);
 
-	/// Format a human-readable reason for an option
-	[[nodiscard]] static std::string formatOptionReason(
-		const struct EvaluatedOption& option,
-		const char* needName);
-
 	/// Handle chain interruption when switching away from a mid-chain task
 	/// Stows 1-handed items to backpack, drops 2-handed items or packaged entities.
 	/// @param entity Entity ID for logging
@@ -206,6 +301,32 @@ private:
 	/// Random number generator for wander behavior (seeded from random_device by default)
 	std::mt19937 m_rng;
 
+	/// Batches below this size are scored on the calling thread (not worth the dispatch)
+	static constexpr size_t kMinParallelBatch = 8;
+
+	/// With a budget, a batch holds this many evaluations per worker, so the budget is
+	/// still checked every few evaluations
+	static constexpr size_t kScoringBatchPerWorker = 4;
+
+	/// See setEvaluationBudget(); 0 = unbounded
+	uint32_t m_evaluationBudgetMicros = 0;
+
+	/// See setParallelScoring()
+	bool m_parallelScoring = true;
+
+	/// See setFullTraces() / setWatchedColonist()
+	bool	 m_fullTraces = true;
+	EntityID m_watchedColonist = kInvalidEntity;
+
+	/// Set by a commit that changed state scoring reads; later commits in the batch re-score
+	bool m_batchStale = false;
+
+	/// Reused across updates: the due evaluations, and indices into it for the current batch
+	std::vector<DueEvaluation> m_due;
+	std::vector<size_t>		   m_batch;
+
+	EvaluationStats m_evaluationStats;
+
 	/// Callback for dropping items on the ground (when chain is interrupted)
 	DropItemCallback m_onDropItem = nullptr;
 };
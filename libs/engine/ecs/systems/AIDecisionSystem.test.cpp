@@ -4,6 +4,7 @@
 
 #include "AIDecisionSystem.h"
 #include "ActionSystem.h"
+#include "ResourceLedgerSystem.h"
 
 #include "../GoalTaskRegistry.h"
 #include "../InventoryMass.h"
@@ -35,13 +36,24 @@
 #include <chrono>
 #include <cmath>
 #include <optional>
+#include <tuple>
 
 namespace ecs::test {
 
 	// Test fixture for AIDecisionSystem tests
 	class AIDecisionSystemTest : public ::testing::Test {
 	  protected:
-		void SetUp() override {
+		void SetUp() override { buildWorld(); }
+		void TearDown() override { destroyWorld(); }
+
+		/// Swap in a fresh world, with the singletons reset as SetUp leaves them (for tests that
+		/// run the same scenario twice and compare)
+		void resetWorld() {
+			destroyWorld();
+			buildWorld();
+		}
+
+		void buildWorld() {
 			// Create ECS world
 			world = std::make_unique<World>();
 
@@ -73,7 +85,7 @@ namespace ecs::test {
 			world->registerSystem<AIDecisionSystem>(registry, recipeRegistry, kTestRngSeed);
 		}
 
-		void TearDown() override {
+		void destroyWorld() {
 			// Clean up test definitions
 			engine::assets::AssetRegistry::Get().clearDefinitions();
 			GoalTaskRegistry::Get().clear();
@@ -957,7 +969,10 @@ namespace ecs::test {
 
 		ASSERT_NE(hungerOption, nullptr);
 		EXPECT_EQ(hungerOption->status, OptionStatus::NoSource);
-		EXPECT_TRUE(hungerOption->reason.find("no known source") != std::string::npos);
+		EXPECT_EQ(hungerOption->reason, OptionReason::Need);
+		EXPECT_TRUE(
+			describeOption(*hungerOption, engine::assets::AssetRegistry::Get()).find("no known source") != std::string::npos
+		);
 	}
 
 	TEST_F(AIDecisionSystemTest, TraceShowsSatisfiedForHighNeeds) {
@@ -1104,7 +1119,8 @@ namespace ecs::test {
 		ASSERT_NE(task, nullptr);
 
 		// Store initial selection summary
-		std::string initialSummary = trace->selectionSummary;
+		const auto& registry = engine::assets::AssetRegistry::Get();
+		std::string initialSummary = describeSelection(*trace, registry);
 		EXPECT_FALSE(initialSummary.empty());
 
 		// Trigger re-evaluation by simulating arrival
@@ -1113,10 +1129,30 @@ namespace ecs::test {
 
 		// Trace should be rebuilt (may have same or different summary)
 		// The key is that it's still valid
-		EXPECT_FALSE(trace->selectionSummary.empty());
+		EXPECT_FALSE(describeSelection(*trace, registry).empty());
 		EXPECT_EQ(trace->options.size(), 6u); // Still has all options (5 needs + wander, no Gather Food since has food)
 	}
 
+	TEST_F(AIDecisionSystemTest, UnwatchedTraceKeepsOnlySelectedOption) {
+		auto& ai = world->getSystem<AIDecisionSystem>();
+		ai.setFullTraces(false);
+		auto watched = createColonist({0.0F, 0.0F});
+		auto unwatched = createColonist({5.0F, 0.0F});
+		ai.setWatchedColonist(watched);
+		addKnownEntity(unwatched, {8.0F, 3.0F}, kWaterDefId, engine::assets::CapabilityType::Drinkable);
+		setNeedValue(unwatched, NeedType::Thirst, 40.0F);
+
+		world->update(0.016F);
+
+		EXPECT_GT(getTrace(watched)->options.size(), 1u);
+
+		const auto* trace = getTrace(unwatched);
+		ASSERT_EQ(trace->options.size(), 1u);
+		EXPECT_EQ(trace->options[0].status, OptionStatus::Selected);
+		EXPECT_EQ(trace->options[0].needType, NeedType::Thirst);
+		EXPECT_EQ(getTask(unwatched)->reason, describeOption(trace->options[0], engine::assets::AssetRegistry::Get()));
+	}
+
 	// =============================================================================
 	// (tier, score) arbitration key tests
 	//
@@ -1578,6 +1614,41 @@ namespace ecs::test {
 		EXPECT_TRUE(pull->servesStorageStocking);
 	}
 
+	// 1b. Same pull with the ResourceLedgerSystem registered: sources come from the ledger's holder
+	//     list instead of a scan of every box, and a box emptied since the last sync is never offered.
+	TEST_F(AIDecisionSystemTest, PullFromLowerPriorityBoxViaLedger) {
+		auto& registry = engine::assets::AssetRegistry::Get();
+		const uint32_t woodId = registerPullItem(registry, "Wood");
+		registerStorageDef(registry, "Box");
+		const uint32_t boxDefId = registry.getDefNameId("Box");
+		world->registerSystem<ResourceLedgerSystem>();
+
+		const glm::vec2 emptiedPos{1.0F, 0.0F};
+		const glm::vec2 lowPos{2.0F, 0.0F};
+		const glm::vec2 highPos{4.0F, 0.0F};
+		const EntityID emptiedBox = makeStorageBox(emptiedPos, "Box", "Wood", ecs::StoragePriority::Low, /*qty=*/10);
+		const EntityID lowBox = makeStorageBox(lowPos, "Box", "Wood", ecs::StoragePriority::Low, /*qty=*/10);
+		const EntityID highBox = makeStorageBox(highPos, "Box", "Wood", ecs::StoragePriority::High);
+
+		auto colonist = createColonist({0.0F, 0.0F});
+		satisfyAllNeeds(*getNeeds(colonist));
+		addKnownEntity(colonist, emptiedPos, boxDefId, engine::assets::CapabilityType::Storage);
+		addKnownEntity(colonist, lowPos, boxDefId, engine::assets::CapabilityType::Storage);
+		addKnownEntity(colonist, highPos, boxDefId, engine::assets::CapabilityType::Storage);
+
+		world->update(0.016F); // ledger attaches the boxes
+		world->getComponent<Inventory>(emptiedBox)->removeItem(woodId, 10);
+		ASSERT_EQ(world->getSystem<ResourceLedgerSystem>().total(woodId), 10U);
+
+		makeUmbrellaGoal(highBox, highPos, woodId);
+		world->update(0.016F);
+
+		const auto* pull = findPullOption(*getTrace(colonist));
+		ASSERT_NE(pull, nullptr) << "the ledger path should still find the low box";
+		EXPECT_EQ(pull->haulSourceStorageId, static_cast<uint64_t>(lowBox));
+		EXPECT_EQ(pull->haulTargetStorageId, static_cast<uint64_t>(highBox));
+	}
+
 	// 2. Never from same: two Medium boxes both holding Wood -> NO pull between them (strict-< gate).
 	TEST_F(AIDecisionSystemTest, NoPullBetweenSamePriorityBoxes) {
 		auto& registry = engine::assets::AssetRegistry::Get();
@@ -1840,7 +1911,7 @@ namespace ecs::test {
 		task->state = TaskState::Moving; // in-flight toward the dest box (phase 2)
 		task->navState = NavState::Traveling; // has a believed route (NOT CantFindWayTo) -> guard applies
 		task->haulGoalId = haulId;
-		task->haulItemDefName = "Wood";
+		task->haulItemDefNameId = engine::assets::AssetRegistry::Get().internDefName("Wood");
 		task->haulQuantity = 14;
 		task->haulSourceStorageId = static_cast<uint64_t>(srcBox);
 		task->haulSourcePosition = srcPos;
@@ -1923,7 +1994,7 @@ namespace ecs::test {
 		task->state = TaskState::Moving;	  // in-flight toward the dest box (phase 2)
 		task->navState = NavState::Traveling; // has a believed route (NOT CantFindWayTo) -> guard applies
 		task->haulGoalId = haulId;
-		task->haulItemDefName = "Wood";
+		task->haulItemDefNameId = engine::assets::AssetRegistry::Get().internDefName("Wood");
 		task->haulQuantity = 14;
 		task->haulSourceStorageId = static_cast<uint64_t>(srcBox);
 		task->haulSourcePosition = srcPos;
@@ -2006,7 +2077,7 @@ namespace ecs::test {
 		task->state = TaskState::Moving;
 		task->navState = NavState::Traveling;
 		task->haulGoalId = haulId;
-		task->haulItemDefName = "Wood";
+		task->haulItemDefNameId = engine::assets::AssetRegistry::Get().internDefName("Wood");
 		task->haulQuantity = carried;
 		task->haulSourceStorageId = static_cast<uint64_t>(srcBox);
 		task->haulSourcePosition = srcPos;
@@ -2382,7 +2453,7 @@ namespace ecs::test {
 		task->type = TaskType::Haul;
 		task->chainId = 42ULL;
 		task->chainStep = 0;
-		task->haulItemDefName = "Berry";
+		task->haulItemDefNameId = engine::assets::AssetRegistry::Get().internDefName("Berry");
 		task->haulQuantity = 1;
 		task->haulSourcePosition = {5.0F, 5.0F};
 		task->haulTargetPosition = {10.0F, 10.0F};
@@ -2484,7 +2555,7 @@ namespace ecs::test {
 			task->type = TaskType::Haul;
 			task->chainId = 100ULL;
 			task->chainStep = 1;
-			task->haulItemDefName = "Axe";
+			task->haulItemDefNameId = engine::assets::AssetRegistry::Get().internDefName("Axe");
 			task->state = TaskState::Moving;
 			return task;
 		}
@@ -2511,7 +2582,7 @@ namespace ecs::test {
 		// Belt is the first stow target: the Axe lands in a belt slot, the hand is freed,
 		// and nothing fell through to the backpack.
 		EXPECT_TRUE(inventory->belt[0].has_value()) << "Axe stows to the first belt slot";
-		EXPECT_EQ(inventory->belt[0]->defName, "Axe");
+		EXPECT_EQ(inventory->belt[0]->defName(), "Axe");
 		EXPECT_FALSE(inventory->isHolding("Axe")) << "Hand freed for the new task";
 		EXPECT_FALSE(inventory->hasItem("Axe")) << "Belt stow does not also hit the backpack";
 	}
@@ -2718,7 +2789,7 @@ namespace ecs::test {
 		auto* task = getTask(colonist);
 		ASSERT_NE(task, nullptr);
 		ASSERT_EQ(task->type, TaskType::Haul) << "colonist takes the storage haul when all needs are met";
-		EXPECT_EQ(task->haulItemDefName, "Pellet");
+		EXPECT_EQ(task->haulItemDefNameId, engine::assets::AssetRegistry::Get().getDefNameId("Pellet"));
 		EXPECT_EQ(task->haulTargetStorageId, static_cast<uint64_t>(storage));
 		EXPECT_EQ(task->haulQuantity, 200U)
 			<< "sized by the storage's addableCount (5 slots x 40 stack = 200), not the 5-slot count";
@@ -3116,4 +3187,122 @@ namespace ecs::test {
 		EXPECT_FALSE(task->isActive());
 	}
 
+
+	// =============================================================================
+	// Evaluation Scheduling
+	// =============================================================================
+
+	// No budget (the default): every colonist whose evaluation is due gets it this tick.
+	TEST_F(AIDecisionSystemTest, UnbudgetedUpdateEvaluatesEveryDueColonist) {
+		constexpr int kNumColonists = 6;
+		std::vector<EntityID> colonists;
+		for (int i = 0; i < kNumColonists; ++i) {
+			colonists.push_back(createColonist({static_cast<float>(i), 0.0F}));
+		}
+
+		world->update(0.016F);
+
+		const auto& stats = world->getSystem<AIDecisionSystem>().lastEvaluationStats();
+		EXPECT_EQ(stats.due, static_cast<uint32_t>(kNumColonists));
+		EXPECT_EQ(stats.evaluated, static_cast<uint32_t>(kNumColonists));
+		EXPECT_EQ(stats.deferred, 0U);
+		for (auto colonist : colonists) {
+			EXPECT_TRUE(getTask(colonist)->isActive());
+		}
+	}
+
+	// A budget far below one evaluation's cost still evaluates one colonist per tick and defers
+	// the rest, which stay due and are picked up on later ticks.
+	TEST_F(AIDecisionSystemTest, SpentBudgetDefersRemainingEvaluations) {
+		constexpr int kNumColonists = 6;
+		std::vector<EntityID> colonists;
+		for (int i = 0; i < kNumColonists; ++i) {
+			colonists.push_back(createColonist({static_cast<float>(i), 0.0F}));
+		}
+		auto& ai = world->getSystem<AIDecisionSystem>();
+		ai.setEvaluationBudget(1);
+
+		world->update(0.016F);
+
+		const auto& stats = ai.lastEvaluationStats();
+		EXPECT_EQ(stats.due, static_cast<uint32_t>(kNumColonists));
+		EXPECT_GE(stats.evaluated, 1U);
+		EXPECT_EQ(stats.evaluated + stats.deferred, stats.due);
+		EXPECT_GT(stats.totalMicros, 0.0F);
+		EXPECT_GE(stats.totalMicros, stats.maxMicros);
+
+		for (int tick = 0; tick < kNumColonists; ++tick) {
+			world->update(0.016F);
+		}
+		for (auto colonist : colonists) {
+			EXPECT_TRUE(getTask(colonist)->isActive());
+		}
+	}
+
+	// Scoring on JobSystem workers commits exactly what scoring one colonist at a time does:
+	// same tasks, same targets (wander draws included), same reasons.
+	TEST_F(AIDecisionSystemTest, ParallelScoringMatchesSerialScoring) {
+		constexpr int kNumColonists = 32;
+
+		auto runColony = [this](bool parallel) {
+			// Fresh world, registries and RNG seed for each run
+			resetWorld();
+			world->getSystem<AIDecisionSystem>().setParallelScoring(parallel);
+
+			std::vector<EntityID> colonists;
+			for (int i = 0; i < kNumColonists; ++i) {
+				auto colonist = createColonist({static_cast<float>(i % 8) * 3.0F, static_cast<float>(i / 8) * 3.0F});
+				if (i % 3 == 0) {
+					setNeedValue(colonist, NeedType::Hunger, 30.0F);
+				}
+				if (i % 5 == 0) {
+					setNeedValue(colonist, NeedType::Energy, 20.0F);
+				}
+				for (int bush = 0; bush < 4; ++bush) {
+					addKnownEntity(
+						colonist,
+						{static_cast<float>(bush * 6), 1.0F},
+						kBerryBushDefId + static_cast<uint32_t>(bush),
+						engine::assets::CapabilityType::Harvestable
+					);
+				}
+				colonists.push_back(colonist);
+			}
+
+			for (int tick = 0; tick < 10; ++tick) {
+				world->update(0.1F);
+			}
+
+			std::vector<std::tuple<TaskType, float, float, std::string>> outcome;
+			for (auto colonist : colonists) {
+				const auto* task = getTask(colonist);
+				outcome.emplace_back(task->type, task->targetPosition.x, task->targetPosition.y, task->reason);
+			}
+			return outcome;
+		};
+
+		const auto serial = runColony(false);
+		const auto parallel = runColony(true);
+		ASSERT_EQ(serial.size(), parallel.size());
+		for (size_t i = 0; i < serial.size(); ++i) {
+			EXPECT_EQ(serial[i], parallel[i]) << "colonist " << i;
+		}
+	}
+
+	// A critical need jumps the queue and is evaluated even when the budget is already spent.
+	TEST_F(AIDecisionSystemTest, CriticalNeedIsEvaluatedFirstUnderBudget) {
+		for (int i = 0; i < 5; ++i) {
+			createColonist({static_cast<float>(i), 0.0F});
+		}
+		auto starving = createColonist({10.0F, 0.0F}); // last in view order
+		setNeedValue(starving, NeedType::Hunger, 5.0F);
+		auto& ai = world->getSystem<AIDecisionSystem>();
+		ai.setEvaluationBudget(1);
+
+		world->update(0.016F);
+
+		EXPECT_TRUE(getTask(starving)->isActive());
+		EXPECT_GE(ai.lastEvaluationStats().evaluated, 1U);
+	}
+
 } // namespace ecs::test
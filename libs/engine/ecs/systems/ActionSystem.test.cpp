@@ -31,6 +31,13 @@
 
 namespace ecs::test {
 
+namespace {
+	// Action payloads and haul tasks carry AssetRegistry ids; tests name items by defName.
+	uint32_t itemId(const std::string& defName) {
+		return engine::assets::AssetRegistry::Get().internDefName(defName);
+	}
+} // namespace
+
 // =============================================================================
 // harvestWorkRate (pure helper)
 // =============================================================================
@@ -58,7 +65,7 @@ TEST(HarvestWorkRateTest, SkillClampedToValidRange) {
 // =============================================================================
 
 TEST(ActionFactoryTest, EatActionCreation) {
-	auto action = Action::Eat("Berry", 0.5F);
+	auto action = Action::Eat(itemId("Berry"), 0.5F);
 
 	EXPECT_EQ(action.type, ActionType::Eat);
 	EXPECT_EQ(action.state, ActionState::Starting);
@@ -68,7 +75,7 @@ TEST(ActionFactoryTest, EatActionCreation) {
 	// Check variant-based effect - Eat now uses ConsumptionEffect
 	ASSERT_TRUE(action.hasConsumptionEffect());
 	const auto& effect = action.consumptionEffect();
-	EXPECT_EQ(effect.itemDefName, "Berry");
+	EXPECT_EQ(effect.itemDefNameId, itemId("Berry"));
 	EXPECT_EQ(effect.need, NeedType::Hunger);
 	EXPECT_FLOAT_EQ(effect.restoreAmount, 50.0F); // 0.5 * 100
 }
@@ -151,7 +158,7 @@ TEST(ActionFactoryTest, ToiletActionCreation_Both) {
 }
 
 TEST(ActionFactoryTest, ActionClear) {
-	auto action = Action::Eat("Berry", 0.8F);
+	auto action = Action::Eat(itemId("Berry"), 0.8F);
 	action.elapsed = 1.5F;
 	action.state = ActionState::InProgress;
 
@@ -168,12 +175,12 @@ TEST(ActionFactoryTest, ActionIsActive) {
 	Action action{};
 	EXPECT_FALSE(action.isActive());
 
-	action = Action::Eat("Berry", 0.5F);
+	action = Action::Eat(itemId("Berry"), 0.5F);
 	EXPECT_TRUE(action.isActive());
 }
 
 TEST(ActionFactoryTest, ActionProgress) {
-	auto action = Action::Eat("Berry", 0.5F);
+	auto action = Action::Eat(itemId("Berry"), 0.5F);
 	EXPECT_FLOAT_EQ(action.progress(), 0.0F);
 
 	action.elapsed = 1.0F;
@@ -599,7 +606,7 @@ TEST_F(ActionSystemGoalTest, HarvestThenInventoryHaulDeliversMaterialsAndUnblock
 	task->targetPosition = {1.0F, 1.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Harvest("Stick", 2, 4.0F, {1.0F, 1.0F}, "Flora_WoodyBush",
+	*action = Action::Harvest(itemId("Stick"), 2, 4.0F, {1.0F, 1.0F}, "Flora_WoodyBush",
 							  /*destructive=*/false, /*regrowthTime=*/0.0F);
 
 	world->update(0.1F); // start
@@ -632,7 +639,7 @@ TEST_F(ActionSystemGoalTest, HarvestThenInventoryHaulDeliversMaterialsAndUnblock
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "Stick";
+	task->haulItemDefNameId = itemId("Stick");
 	task->haulQuantity = 2;
 	task->haulTargetStorageId = static_cast<uint64_t>(station);
 	task->haulTargetPosition = {5.0F, 0.0F};
@@ -708,7 +715,7 @@ TEST_F(ActionSystemGoalTest, WithdrawPullsFromSourceBoxThenDepositsIntoDestBox)
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = item;
+	task->haulItemDefNameId = itemId(item);
 	task->haulQuantity = 5;
 	task->haulSourceStorageId = static_cast<uint64_t>(srcBox);
 	task->haulSourcePosition = srcPos;
@@ -809,7 +816,7 @@ TEST_F(ActionSystemGoalTest, WithdrawTwoHandWoodRidesInHandsThenDepositsIntoDest
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = item;
+	task->haulItemDefNameId = itemId(item);
 	task->haulQuantity = 5;
 	task->haulSourceStorageId = static_cast<uint64_t>(srcBox);
 	task->haulSourcePosition = srcPos;
@@ -918,7 +925,7 @@ TEST_F(ActionSystemGoalTest, CraftDepositMetersToRecipeNeedAndKeepsSurplus) {
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "PlantFiber";
+	task->haulItemDefNameId = itemId("PlantFiber");
 	task->haulQuantity = 1;
 	task->haulTargetStorageId = static_cast<uint64_t>(station);
 	task->haulTargetPosition = stationPos;
@@ -986,7 +993,7 @@ TEST_F(ActionSystemGoalTest, CraftFetchFromPileTakesOnlyRemainingNeedLeavesRest)
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "SmallStone";
+	task->haulItemDefNameId = itemId("SmallStone");
 	task->haulQuantity = 2;
 	task->haulSourcePosition = pilePos;
 	task->haulTargetStorageId = 0;
@@ -1046,7 +1053,7 @@ TEST_F(ActionSystemGoalTest, HarvestTakesFullYieldEvenAboveRecipeNeed) {
 
 	// Reed yields 5 PlantFiber (source defName differs from the yield -> harvest path, not a pickup).
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Harvest("PlantFiber", 5, 4.0F, reedPos, "Flora_Reed",
+	*action = Action::Harvest(itemId("PlantFiber"), 5, 4.0F, reedPos, "Flora_Reed",
 							  /*destructive=*/true, /*regrowthTime=*/0.0F);
 
 	world->update(0.1F); // start
@@ -1137,7 +1144,7 @@ TEST_F(ActionSystemGoalTest, LooseFetchHaulCommitsToDepositAndCreditsCraftStatio
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "SmallStone";
+	task->haulItemDefNameId = itemId("SmallStone");
 	task->haulQuantity = 1;
 	task->haulSourcePosition = sourcePos;
 	task->haulTargetStorageId = static_cast<uint64_t>(station);
@@ -1185,7 +1192,7 @@ TEST_F(ActionSystemGoalTest, LooseFetchHaulCommitsToDepositAndCreditsCraftStatio
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "SmallStone";
+	task->haulItemDefNameId = itemId("SmallStone");
 	task->haulQuantity = 1;
 	task->haulSourcePosition = stationPos; // already here, no pickup
 	task->haulTargetStorageId = static_cast<uint64_t>(station);
@@ -1269,7 +1276,7 @@ TEST_F(ActionSystemGoalTest, LooseFetchPicksUpWhenSourceOverlapsStation) {
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "SmallStone";
+	task->haulItemDefNameId = itemId("SmallStone");
 	task->haulQuantity = 1;
 	task->haulSourcePosition = sourcePos;
 	task->haulTargetStorageId = static_cast<uint64_t>(station);
@@ -1351,7 +1358,7 @@ TEST_F(ActionSystemGoalTest, CarryingAtSourceRedirectsToDepositInsteadOfDeadlock
 	task->type = TaskType::Haul;
 	task->state = TaskState::Arrived;
 	task->haulGoalId = haulId;
-	task->haulItemDefName = "Wood";
+	task->haulItemDefNameId = itemId("Wood");
 	task->haulQuantity = 10;
 	task->haulSourcePosition = sourcePos;
 	task->haulTargetStorageId = static_cast<uint64_t>(box);
@@ -1534,7 +1541,7 @@ class FellingTest : public ::testing::Test {
 		// harvestGoalId left 0: no goal bookkeeping, just the collection effect.
 
 		auto* action = world->getComponent<Action>(colonist);
-		*action = Action::Harvest("Wood", yield, 1.0F, {1.0F, 1.0F}, "Flora_TreeOak",
+		*action = Action::Harvest(itemId("Wood"), yield, 1.0F, {1.0F, 1.0F}, "Flora_TreeOak",
 								  /*destructive=*/true, /*regrowthTime=*/0.0F);
 
 		world->update(0.1F); // start
@@ -1612,7 +1619,7 @@ TEST_F(FellingTest, HeldAxeStowedToBeltFreeingHandsForWoodArmful) {
 	fell(colonist, 30);
 
 	// The axe was stowed to the belt (a slot was free), freeing both hands for the wood.
-	EXPECT_TRUE(inventory->belt[0].has_value() && inventory->belt[0]->defName == "Axe")
+	EXPECT_TRUE(inventory->belt[0].has_value() && inventory->belt[0]->defName() == "Axe")
 		<< "Held axe stowed to the belt to free the hands";
 	EXPECT_FALSE(inventory->isHolding("Axe")) << "Axe no longer in a hand";
 
@@ -1780,7 +1787,7 @@ class LoosePileHaulTest : public ::testing::Test {
 		task->targetPosition = pilePos;
 
 		auto* action = world->getComponent<Action>(colonist);
-		*action = Action::Pickup("Wood", UINT32_MAX, pilePos, "Wood");
+		*action = Action::Pickup(itemId("Wood"), UINT32_MAX, pilePos, "Wood");
 
 		world->update(0.1F); // start
 		world->update(1.0F); // complete (Pickup duration 0.5s)
@@ -1962,7 +1969,7 @@ TEST_F(HandMaterialActionTest, DepositFromHandsBouncesStorageFullRemainderToBoth
 	task->targetPosition = {0.0F, 0.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Deposit("Wood", 14, static_cast<uint64_t>(storage), {0.0F, 0.0F});
+	*action = Action::Deposit(itemId("Wood"), 14, static_cast<uint64_t>(storage), {0.0F, 0.0F});
 
 	world->update(0.1F); // start
 	world->update(2.0F); // complete (deposit duration 1s)
@@ -2009,7 +2016,7 @@ TEST_F(HandMaterialActionTest, DepositFromHandsToMissingStorageReturnsAllToBothH
 	task->targetPosition = {0.0F, 0.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Deposit("Wood", 14, kMissingStorage, {0.0F, 0.0F});
+	*action = Action::Deposit(itemId("Wood"), 14, kMissingStorage, {0.0F, 0.0F});
 
 	world->update(0.1F);
 	world->update(2.0F);
@@ -2057,7 +2064,7 @@ TEST_F(HandMaterialActionTest, DepositToBuildSiteRecordsOnManifestAndBouncesOver
 	task->targetPosition = {0.0F, 0.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Deposit("Wood", 14, static_cast<uint64_t>(buildSite), {0.0F, 0.0F});
+	*action = Action::Deposit(itemId("Wood"), 14, static_cast<uint64_t>(buildSite), {0.0F, 0.0F});
 
 	world->update(0.1F); // start
 	world->update(2.0F); // complete (deposit duration 1s)
@@ -2117,7 +2124,7 @@ TEST_F(HandMaterialActionTest, DepositToBuildSiteRemovesHaulGoalOnExactDelivery)
 	task->targetPosition = {0.0F, 0.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Deposit("Wood", 10, static_cast<uint64_t>(buildSite), {0.0F, 0.0F});
+	*action = Action::Deposit(itemId("Wood"), 10, static_cast<uint64_t>(buildSite), {0.0F, 0.0F});
 
 	world->update(0.1F); // start
 	world->update(2.0F); // complete
@@ -2164,7 +2171,7 @@ TEST_F(HandMaterialActionTest, StorageHaulFillsAcrossStacksAndGoalSurvivesWhileS
 	task->targetPosition = {0.0F, 0.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Deposit("Wood", 50, static_cast<uint64_t>(storage), {0.0F, 0.0F});
+	*action = Action::Deposit(itemId("Wood"), 50, static_cast<uint64_t>(storage), {0.0F, 0.0F});
 
 	world->update(0.1F); // start
 	world->update(2.0F); // complete (deposit duration 1s)
@@ -2208,7 +2215,7 @@ TEST_F(HandMaterialActionTest, FullStorageRetiresHaulGoalAndAcceptsNothing) {
 	task->targetPosition = {0.0F, 0.0F};
 
 	auto* action = world->getComponent<Action>(colonist);
-	*action = Action::Deposit("Wood", 14, static_cast<uint64_t>(storage), {0.0F, 0.0F});
+	*action = Action::Deposit(itemId("Wood"), 14, static_cast<uint64_t>(storage), {0.0F, 0.0F});
 
 	world->update(0.1F);
 	world->update(2.0F);
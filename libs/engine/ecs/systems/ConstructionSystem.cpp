@@ -25,11 +25,10 @@
 namespace ecs {
 
 	namespace {
-		// Chain id source for linking Harvest -> Haul material chains, matching
-		// CraftingGoalSystem's local generator (continuity bonus for the cutter-hauler).
+		// Chain id source for linking Harvest -> Haul material chains (continuity bonus for
+		// the cutter-hauler); shared with the other goal systems via the registry.
 		uint64_t generateChainId() {
-			static uint64_t nextChainId = 1;
-			return nextChainId++;
+			return GoalTaskRegistry::Get().allocateChainId();
 		}
 	} // namespace
 
@@ -772,7 +771,7 @@ namespace ecs {
 		auto& registry = GoalTaskRegistry::Get();
 
 		std::vector<uint64_t> toRemove;
-		for (const auto* child : registry.getChildGoals(umbrellaGoalId)) {
+		for (const auto* child : registry.childGoals(umbrellaGoalId)) {
 			if (child->destinationEntity != blueprintEntity) {
 				continue;
 			}
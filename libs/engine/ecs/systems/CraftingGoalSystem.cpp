@@ -23,8 +23,7 @@ namespace ecs {
 	namespace {
 		// Generate a unique chain ID for linking Harvest → Haul tasks
 		uint64_t generateChainId() {
-			static uint64_t nextChainId = 1;
-			return nextChainId++;
+			return GoalTaskRegistry::Get().allocateChainId();
 		}
 
 		// Stable, non-zero identity for a recipe defName (used to detect recipe swaps).
@@ -116,7 +115,7 @@ namespace ecs {
 				uint32_t inputDefNameId;
 			};
 			std::vector<Pending> candidates;
-			for (const auto* child : registry.getChildGoals(craftGoalId)) {
+			for (const auto* child : registry.childGoals(craftGoalId)) {
 				const bool reresolvable =
 					child->status == GoalStatus::NoSource || child->status == GoalStatus::Available;
 				if (child->type == TaskType::Haul && reresolvable && !child->acceptedDefNameIds.empty()) {
@@ -343,7 +342,7 @@ namespace ecs {
 					// children are currently outstanding for this Craft. Rebuild the Harvest/Haul
 					// hierarchy for the shortfall (children already provisioning an in-flight unit are
 					// left alone; we only rebuild once they're gone and the store is short).
-					const bool hasChildren = !goalRegistry.getChildGoals(existingGoal->id).empty();
+					const bool hasChildren = !goalRegistry.childGoals(existingGoal->id).empty();
 					if (alreadyStaged < totalInputsNeeded && !hasChildren) {
 						buildChildHierarchy(existingGoal->id);
 					}
@@ -368,7 +367,7 @@ namespace ecs {
 				// new recipe so children match the new inputs.
 				uint64_t craftGoalId = existingGoal->id;
 				std::vector<uint64_t> oldChildIds;
-				for (const auto* child : goalRegistry.getChildGoals(craftGoalId)) {
+				for (const auto* child : goalRegistry.childGoals(craftGoalId)) {
 					oldChildIds.push_back(child->id);
 				}
 				for (uint64_t childId : oldChildIds) {
@@ -46,6 +46,14 @@ void DynamicEntityRenderSystem::update(float deltaTime) {
     // Collect all entities with position and appearance
     for (auto [entity, pos, rot, appearance] :
          world->view<Position, Rotation, Appearance>()) {
+        // Between fixed ticks, draw movers part-way from where the last tick started.
+        glm::vec2 at = pos.value;
+        if (interpolationAlpha < 1.0F) {
+            if (const auto* prev = world->getComponent<PreviousPosition>(entity)) {
+                at = prev->value + (pos.value - prev->value) * interpolationAlpha;
+            }
+        }
+
         // Check if entity is packaged
         auto* packaged = world->getComponent<Packaged>(entity);
 
@@ -65,10 +73,10 @@ void DynamicEntityRenderSystem::update(float deltaTime) {
 
             // Entity position is the bottom/baseline - offset each sprite by its height
             // so both bottoms align at the entity position
-            float bottomY = pos.value.y;
+            float bottomY = at.y;
 
             // Crate is centered on entity position
-            float crateCenterX = pos.value.x;
+            float crateCenterX = at.x;
             float crateLeftX = crateCenterX - kCrateWidth * 0.5F;
 
             // First render the crate (so it appears behind the item)
@@ -126,7 +134,7 @@ void DynamicEntityRenderSystem::update(float deltaTime) {
             centerOffsetY = -(minY + maxY) * 0.5F;
         }
 
-        placed.position = glm::vec2(pos.value.x + centerOffsetX, pos.value.y + centerOffsetY);
+        placed.position = glm::vec2(at.x + centerOffsetX, at.y + centerOffsetY);
         placed.rotation = 0.0F;  // Dynamic entities don't rotate - use FacingDirection for sprites
         placed.scale = appearance.scale;
         placed.colorTint = appearance.colorTint;
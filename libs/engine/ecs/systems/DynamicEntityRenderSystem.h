@@ -23,8 +23,13 @@ public:
         return renderData;
     }
 
+    /// Blend factor between each moving entity's PreviousPosition (0) and Position (1),
+    /// set by SimulationClock before present(). 1 (the default) renders Position as is.
+    void setInterpolationAlpha(float alpha) { interpolationAlpha = alpha; }
+
 private:
     std::vector<engine::assets::PlacedEntity> renderData;
+    float interpolationAlpha = 1.0F;
 
     // Per-frame backing store for animated entities' per-part transforms. A deque so push_back
     // keeps earlier entries' addresses stable (PlacedEntity::partTransforms points in here).
@@ -14,6 +14,7 @@
 
 #include <nav/PathQuery.h>
 
+#include <threading/JobSystem.h>
 #include <utils/Log.h>
 
 #include <world/chunk/Chunk.h>
@@ -486,7 +487,7 @@ namespace ecs {
 		LOG_DEBUG(Engine, "[NavBuild] region %d buildInput %.2f ms: polys=%zu walkableBorders=%zu blockedRings=%zu",
 				 region.id, inputMs, input.polygons.size(), walkableBorders, input.polygons.size() - walkableBorders);
 
-		region.future = std::async(std::launch::async, [input = std::move(input), id = region.id]() {
+		region.future = foundation::JobSystem::shared().submit([input = std::move(input), id = region.id]() {
 			const auto			   buildStart = std::chrono::steady_clock::now();
 			geometry::nav::NavMesh m		  = gnav::buildNavMesh(input);
 			const double		   buildMs =
@@ -495,7 +496,7 @@ namespace ecs {
 			LOG_DEBUG(Engine, "[NavBuild] region %d buildNavMesh %.2f ms: tris=%zu verts=%zu", id, buildMs,
 					 m.triangles.size(), m.vertices.size());
 			return m;
-		});
+		}, foundation::JobPriority::Background);
 	}
 
 	void NavigationSystem::drainFinishedBuilds() {
@@ -503,7 +504,7 @@ namespace ecs {
 			if (!region.future.valid()) {
 				continue;
 			}
-			if (region.future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+			if (!blockingBuilds && region.future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
 				continue; // still building: keep serving the old mesh
 			}
 			region.navMesh = region.future.get(); // swap the new mesh in; old mesh is dropped
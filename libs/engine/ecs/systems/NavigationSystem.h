@@ -13,7 +13,7 @@
 // The build ingests only the obstacles inside a region's rect, so a forested world
 // (tens of thousands of loaded trees) still builds fast because a region holds only
 // ~1-2k. Per region the expensive triangulation (geometry::nav::buildNavMesh) runs on
-// a std::async worker; the cheap-but-not-thread-safe extraction that reads live game
+// a JobSystem Background job; the cheap-but-not-thread-safe extraction that reads live game
 // state (engine::nav::buildInput, which walks ConstructionWorld -- NOT thread-safe)
 // runs ON the main thread, producing a self-contained NavMeshInput the worker owns by
 // value. While a region's rebuild is in flight its OLD mesh keeps serving queries.
@@ -148,6 +148,11 @@ class NavigationSystem : public ISystem {
 
 	void setConstructionWorld(const engine::construction::ConstructionWorld* world) { constructionWorld = world; }
 
+	// Deterministic swaps for replays: update() waits for an in-flight build instead of
+	// polling it, so a mesh always lands on the tick after its build launched, however
+	// fast the worker is. Builds still run on the worker. Off in the game.
+	void setBlockingBuilds(bool blocking) { blockingBuilds = blocking; }
+
 	// --- Queries (synchronous, dispatched to the region containing the point) -
 
 	// Taut polyline in world meters from start to goal for a disc agent of the given
@@ -431,6 +436,9 @@ class NavigationSystem : public ISystem {
 	glm::vec2 viewportHalfM{0.0F, 0.0F};
 	bool	  haveViewport = false;
 
+	// See setBlockingBuilds().
+	bool blockingBuilds = false;
+
 	// Max over all regions' meshGeneration; see generation().
 	std::uint64_t meshGeneration = 0;
 
@@ -0,0 +1,244 @@
+#include "ResourceLedgerSystem.h"
+
+#include "../World.h"
+#include "../components/StorageConfiguration.h"
+
+#include <assets/AssetRegistry.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace ecs {
+
+	namespace {
+		/// The box's minAmount for an item (all matching rules summed, as the pull reads it)
+		uint32_t minAmountFor(const StorageConfiguration& config, uint32_t defNameId) {
+			const auto& registry = engine::assets::AssetRegistry::Get();
+			const auto* def = registry.getDefinition(defNameId);
+			return def != nullptr ? config.getMinAmountFor(registry.getDefName(defNameId), def->category) : 0U;
+		}
+	} // namespace
+
+	ResourceLedgerSystem::~ResourceLedgerSystem() {
+		// Systems are destroyed before the registry, so the boxes are still there to unhook
+		if (world != nullptr) {
+			detachAll();
+		}
+	}
+
+	void ResourceLedgerSystem::update(float /*deltaTime*/) {
+		if (world == nullptr) {
+			return;
+		}
+		syncStorages();
+	}
+
+	void ResourceLedgerSystem::syncStorages() {
+		const ChangeTick now = world->takeChangeTick();
+		if (m_lastSeen == 0) {
+			rebuild();
+			m_lastSeen = now;
+			return;
+		}
+
+		// Drop boxes that lost their storage config or inventory (destroyed entities included)
+		std::vector<EntityID> removed;
+		if (!world->removedSince<StorageConfiguration>(m_lastSeen, removed) || !world->removedSince<Inventory>(m_lastSeen, removed)) {
+			rebuild(); // removal log overflowed: some drops were missed
+			m_lastSeen = now;
+			return;
+		}
+		for (EntityID storage : removed) {
+			detach(storage);
+		}
+
+		// Attach new boxes and re-attach replaced inventories (a replacement is a fresh
+		// component without our hook). Boxes already hooked are skipped: their writes
+		// stamp the pool, but the counts were applied as they happened.
+		if (world->anyChangedSince<StorageConfiguration>(m_lastSeen) || world->anyChangedSince<Inventory>(m_lastSeen)) {
+			for (auto [storage, config, inventory] : world->view<StorageConfiguration, Inventory>().changedSince(m_lastSeen)) {
+				if (inventory.observer != this || inventory.observerKey != static_cast<uint64_t>(storage)) {
+					attach(storage, inventory);
+				}
+			}
+		}
+		m_lastSeen = now;
+
+		if (++m_frameCounter >= kReservedRefreshInterval) {
+			m_frameCounter = 0;
+			refreshReserved();
+		}
+	}
+
+	void ResourceLedgerSystem::rebuild() {
+		detachAll();
+		if (world == nullptr) {
+			return;
+		}
+		for (auto [storage, config, inventory] : world->view<StorageConfiguration, Inventory>()) {
+			attach(storage, inventory);
+		}
+	}
+
+	void ResourceLedgerSystem::onInventoryChanged(uint64_t owner, uint32_t defNameId, int64_t delta) {
+		const auto storage = static_cast<EntityID>(owner);
+		auto it = m_storages.find(storage);
+		if (it == m_storages.end()) {
+			return; // not (or no longer) a tracked box
+		}
+		apply(storage, it->second, defNameId, delta);
+	}
+
+	uint32_t ResourceLedgerSystem::countIn(EntityID storage, uint32_t defNameId) const {
+		auto it = m_storages.find(storage);
+		if (it == m_storages.end()) {
+			return 0;
+		}
+		for (const auto& entry : it->second.entries) {
+			if (entry.defNameId == defNameId) {
+				return m_holders[defNameId][entry.holding].count;
+			}
+		}
+		return 0;
+	}
+
+	void ResourceLedgerSystem::attach(EntityID storage, Inventory& inventory) {
+		detach(storage);
+
+		m_storages.emplace(storage, StorageRecord{});
+		inventory.observer = this;
+		inventory.observerKey = static_cast<uint64_t>(storage);
+
+		// Count what the box already holds; apply() reads each floor from the config
+		auto& record = m_storages.at(storage);
+		for (const auto& stack : inventory.items) {
+			apply(storage, record, stack.defNameId, static_cast<int64_t>(stack.quantity));
+		}
+	}
+
+	void ResourceLedgerSystem::detach(EntityID storage) {
+		auto it = m_storages.find(storage);
+		if (it == m_storages.end()) {
+			return;
+		}
+		auto& record = it->second;
+		while (!record.entries.empty()) {
+			eraseEntry(record, record.entries.size() - 1);
+		}
+		m_storages.erase(it);
+
+		// Unhook the inventory if it is still ours (it may already be gone)
+		if (world != nullptr) {
+			if (auto* inventory = world->getComponent<Inventory>(storage); inventory != nullptr && inventory->observer == this) {
+				inventory->observer = nullptr;
+				inventory->observerKey = 0;
+			}
+		}
+	}
+
+	void ResourceLedgerSystem::detachAll() {
+		if (world != nullptr) {
+			for (const auto& [storage, record] : m_storages) {
+				if (auto* inventory = world->getComponent<Inventory>(storage); inventory != nullptr && inventory->observer == this) {
+					inventory->observer = nullptr;
+					inventory->observerKey = 0;
+				}
+			}
+		}
+		m_storages.clear();
+		m_holders.clear();
+		m_totals.clear();
+		m_reservedTotals.clear();
+	}
+
+	void ResourceLedgerSystem::refreshReserved() {
+		for (auto& [storage, record] : m_storages) {
+			if (const auto* config = world->getComponent<StorageConfiguration>(storage)) {
+				refreshReserved(record, *config);
+			}
+		}
+	}
+
+	void ResourceLedgerSystem::refreshReserved(StorageRecord& record, const StorageConfiguration& config) {
+		for (auto& entry : record.entries) {
+			setFloor(entry, minAmountFor(config, entry.defNameId));
+		}
+	}
+
+	void ResourceLedgerSystem::apply(EntityID storage, StorageRecord& record, uint32_t defNameId, int64_t delta) {
+		auto it = std::find_if(record.entries.begin(), record.entries.end(), [defNameId](const Entry& entry) {
+			return entry.defNameId == defNameId;
+		});
+		if (it == record.entries.end()) {
+			if (delta <= 0) {
+				return; // nothing counted to take away
+			}
+			ensureDef(defNameId);
+			auto& list = m_holders[defNameId];
+			record.entries.push_back(Entry{defNameId, static_cast<uint32_t>(list.size()), 0});
+			list.push_back(Holding{storage, 0, 0});
+			it = std::prev(record.entries.end());
+			it->floor = floorFor(storage, defNameId);
+		}
+
+		Holding&	   holding = m_holders[defNameId][it->holding];
+		const uint32_t removed = delta < 0 ? static_cast<uint32_t>(std::min<int64_t>(-delta, holding.count)) : 0U;
+		const uint32_t count = holding.count + (delta > 0 ? static_cast<uint32_t>(delta) : 0U) - removed;
+
+		m_totals[defNameId] = m_totals[defNameId] - holding.count + count;
+		m_reservedTotals[defNameId] -= holding.reserved;
+		holding.count = count;
+		holding.reserved = std::min(count, it->floor);
+		m_reservedTotals[defNameId] += holding.reserved;
+
+		if (count == 0) {
+			eraseEntry(record, static_cast<size_t>(it - record.entries.begin()));
+		}
+	}
+
+	void ResourceLedgerSystem::setFloor(Entry& entry, uint32_t floor) {
+		entry.floor = floor;
+		Holding& holding = m_holders[entry.defNameId][entry.holding];
+		m_reservedTotals[entry.defNameId] -= holding.reserved;
+		holding.reserved = std::min(holding.count, floor);
+		m_reservedTotals[entry.defNameId] += holding.reserved;
+	}
+
+	uint32_t ResourceLedgerSystem::floorFor(EntityID storage, uint32_t defNameId) const {
+		const auto* config = world != nullptr ? world->getComponent<StorageConfiguration>(storage) : nullptr;
+		return config != nullptr ? minAmountFor(*config, defNameId) : 0U;
+	}
+
+	void ResourceLedgerSystem::eraseEntry(StorageRecord& record, size_t entryIndex) {
+		const Entry entry = record.entries[entryIndex];
+		auto&		list = m_holders[entry.defNameId];
+
+		m_totals[entry.defNameId] -= list[entry.holding].count;
+		m_reservedTotals[entry.defNameId] -= list[entry.holding].reserved;
+
+		// Swap-remove the holding and point the moved box's entry at its new slot
+		if (entry.holding + 1 != list.size()) {
+			list[entry.holding] = list.back();
+			auto& movedRecord = m_storages.at(list[entry.holding].storage);
+			for (auto& moved : movedRecord.entries) {
+				if (moved.defNameId == entry.defNameId) {
+					moved.holding = entry.holding;
+					break;
+				}
+			}
+		}
+		list.pop_back();
+
+		record.entries[entryIndex] = record.entries.back();
+		record.entries.pop_back();
+	}
+
+	void ResourceLedgerSystem::ensureDef(uint32_t defNameId) {
+		if (defNameId >= m_holders.size()) {
+			m_holders.resize(defNameId + 1);
+			m_totals.resize(defNameId + 1, 0);
+			m_reservedTotals.resize(defNameId + 1, 0);
+		}
+	}
+
+} // namespace ecs
@@ -0,0 +1,144 @@
+#pragma once
+
+// ResourceLedgerSystem - Colony-wide count of what sits in storage, and where
+//
+// Answers "how much Wood does the colony hold, and in which boxes" without walking
+// every StorageConfiguration + Inventory. The ledger attaches itself as the
+// InventoryObserver of each storage container, so every addItem/removeItem/clear
+// on a box adjusts the counts as it happens.
+//
+// Design:
+// - update() only attaches and detaches boxes, from the registry's change tracking:
+//   a newly added (or replaced) StorageConfiguration/Inventory is attached and its
+//   current contents counted; a removed one is dropped. Counts themselves never
+//   need a rescan.
+// - Per def id: colony total, the reserved share, and the boxes holding it with
+//   their counts (holders(), no allocation).
+// - Reserved = the units each box keeps back for its own minAmount rule (what a
+//   storage-to-storage pull may not drain). Rules are edited in place by the UI
+//   without a change stamp, so the reserved split is refreshed on a throttle.
+// - Only backpack contents are counted; storage containers have no hands or belt.
+//
+// Optional collaborator: consumers look it up with World::tryGetSystem and fall
+// back to scanning storages when it isn't registered.
+
+#include "../ComponentPool.h"
+#include "../EntityID.h"
+#include "../ISystem.h"
+#include "../components/Inventory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace ecs {
+
+	struct StorageConfiguration;
+
+	/// Colony storage ledger, maintained through inventory change hooks
+	/// Priority: 54 (after NeedsDecay, before the goal systems and AI read it)
+	class ResourceLedgerSystem : public ISystem, public InventoryObserver {
+	  public:
+		/// One box holding some of an item
+		struct Holding {
+			EntityID storage = kInvalidEntity;
+			uint32_t count = 0;	   // units in the box (> 0)
+			uint32_t reserved = 0; // units the box's own minimum keeps back (<= count)
+		};
+
+		ResourceLedgerSystem() = default;
+		~ResourceLedgerSystem() override;
+
+		ResourceLedgerSystem(const ResourceLedgerSystem&) = delete;
+		ResourceLedgerSystem& operator=(const ResourceLedgerSystem&) = delete;
+
+		void update(float deltaTime) override;
+
+		[[nodiscard]] int		  priority() const override { return 54; }
+		[[nodiscard]] const char* name() const override { return "ResourceLedger"; }
+
+		void onInventoryChanged(uint64_t owner, uint32_t defNameId, int64_t delta) override;
+
+		// --- Queries ---
+
+		/// Units of an item across all storage
+		[[nodiscard]] uint32_t total(uint32_t defNameId) const { return defNameId < m_totals.size() ? m_totals[defNameId] : 0U; }
+
+		/// Units of an item held back by the boxes' own minimums
+		[[nodiscard]] uint32_t reserved(uint32_t defNameId) const {
+			return defNameId < m_reservedTotals.size() ? m_reservedTotals[defNameId] : 0U;
+		}
+
+		/// Units of an item free to be taken out of storage
+		[[nodiscard]] uint32_t available(uint32_t defNameId) const { return total(defNameId) - reserved(defNameId); }
+
+		/// Boxes holding an item, in no particular order
+		[[nodiscard]] std::span<const Holding> holders(uint32_t defNameId) const {
+			if (defNameId >= m_holders.size()) {
+				return {};
+			}
+			return m_holders[defNameId];
+		}
+
+		/// Units of an item in one box (0 if the box isn't tracked)
+		[[nodiscard]] uint32_t countIn(EntityID storage, uint32_t defNameId) const;
+
+		/// Call fn(defNameId, total, reserved) for every item with stock
+		template <typename Fn>
+		void forEachTotal(Fn&& fn) const {
+			for (uint32_t id = 0; id < m_totals.size(); ++id) {
+				if (m_totals[id] > 0) {
+					fn(id, m_totals[id], m_reservedTotals[id]);
+				}
+			}
+		}
+
+		/// Number of storage containers being tracked
+		[[nodiscard]] size_t storageCount() const { return m_storages.size(); }
+
+		/// Recount everything from the world (also runs on the first update)
+		void rebuild();
+
+	  private:
+		/// One item a tracked box holds
+		struct Entry {
+			uint32_t defNameId = 0;
+			uint32_t holding = 0; // index into m_holders[defNameId]
+			uint32_t floor = 0;	  // the box's minAmount for the item
+		};
+
+		struct StorageRecord {
+			std::vector<Entry> entries;
+		};
+
+		/// Attach and detach boxes from the registry's change tracking
+		void syncStorages();
+
+		void attach(EntityID storage, Inventory& inventory);
+		void detach(EntityID storage);
+		void detachAll();
+
+		/// Re-read every box's minimums from its StorageConfiguration
+		void refreshReserved();
+		void refreshReserved(StorageRecord& record, const StorageConfiguration& config);
+
+		/// Apply a count change to one box's holding, keeping totals and holder lists in step
+		void apply(EntityID storage, StorageRecord& record, uint32_t defNameId, int64_t delta);
+		void setFloor(Entry& entry, uint32_t floor);
+		[[nodiscard]] uint32_t floorFor(EntityID storage, uint32_t defNameId) const;
+		void eraseEntry(StorageRecord& record, size_t entryIndex);
+		void ensureDef(uint32_t defNameId);
+
+		std::unordered_map<EntityID, StorageRecord> m_storages;
+		std::vector<std::vector<Holding>>			m_holders;		  // by def id
+		std::vector<uint32_t>						m_totals;		  // by def id
+		std::vector<uint32_t>						m_reservedTotals; // by def id
+
+		ChangeTick m_lastSeen = 0; // 0 = never synced
+		uint32_t   m_frameCounter = 0;
+		static constexpr uint32_t kReservedRefreshInterval = 60; // frames, as StorageGoalSystem
+	};
+
+} // namespace ecs
@@ -0,0 +1,180 @@
+// Tests for ResourceLedgerSystem: colony storage totals kept in step through the
+// inventory change hooks, with boxes attached and dropped from change tracking.
+
+#include "ResourceLedgerSystem.h"
+
+#include "../World.h"
+#include "../components/Inventory.h"
+#include "../components/StorageConfiguration.h"
+#include "../components/Transform.h"
+
+#include <assets/AssetRegistry.h>
+
+#include <gtest/gtest.h>
+
+namespace ecs::test {
+
+	class ResourceLedgerSystemTest : public ::testing::Test {
+	  protected:
+		void SetUp() override {
+			auto& registry = engine::assets::AssetRegistry::Get();
+			registerItem(registry, "Wood");
+			registerItem(registry, "Stone");
+			woodId = registry.getDefNameId("Wood");
+			stoneId = registry.getDefNameId("Stone");
+
+			world = std::make_unique<World>();
+			ledger = &world->registerSystem<ResourceLedgerSystem>();
+		}
+
+		void TearDown() override {
+			world.reset();
+			engine::assets::AssetRegistry::Get().clearDefinitions();
+		}
+
+		static void registerItem(engine::assets::AssetRegistry& registry, const std::string& defName) {
+			engine::assets::AssetDefinition item;
+			item.defName = defName;
+			item.label = defName;
+			item.category = engine::assets::ItemCategory::RawMaterial;
+			item.itemProperties = engine::assets::ItemProperties{};
+			item.itemProperties->stackSize = 100;
+			registry.registerTestDefinition(std::move(item));
+		}
+
+		EntityID makeBox(glm::vec2 pos, const std::string& item = "", uint32_t qty = 0, uint32_t minAmount = 0) {
+			auto box = world->createEntity();
+			world->addComponent<Position>(box, Position{pos});
+			auto inv = Inventory::createForStorage();
+			if (qty > 0) {
+				inv.addItem(item, qty);
+			}
+			world->addComponent<Inventory>(box, std::move(inv));
+			StorageConfiguration config;
+			config.addRule(StorageRule{
+				.defName = "*",
+				.category = engine::assets::ItemCategory::RawMaterial,
+				.priority = StoragePriority::Medium,
+				.minAmount = minAmount,
+			});
+			world->addComponent<StorageConfiguration>(box, std::move(config));
+			return box;
+		}
+
+		std::unique_ptr<World> world;
+		ResourceLedgerSystem*  ledger = nullptr;
+		uint32_t			   woodId = 0;
+		uint32_t			   stoneId = 0;
+	};
+
+	TEST_F(ResourceLedgerSystemTest, CountsContentsOfExistingBoxes) {
+		makeBox({0.0F, 0.0F}, "Wood", 5);
+		makeBox({10.0F, 0.0F}, "Wood", 7);
+		makeBox({20.0F, 0.0F}, "Stone", 3);
+
+		world->update(0.016F);
+
+		EXPECT_EQ(ledger->storageCount(), 3U);
+		EXPECT_EQ(ledger->total(woodId), 12U);
+		EXPECT_EQ(ledger->total(stoneId), 3U);
+		EXPECT_EQ(ledger->holders(woodId).size(), 2U);
+		EXPECT_EQ(ledger->holders(stoneId).size(), 1U);
+	}
+
+	TEST_F(ResourceLedgerSystemTest, InventoryWritesUpdateTotalsWithoutRescan) {
+		auto box = makeBox({0.0F, 0.0F});
+		world->update(0.016F);
+		EXPECT_EQ(ledger->total(woodId), 0U);
+
+		// No update between the writes and the queries: the hook alone keeps counts current
+		auto* inv = world->getComponent<Inventory>(box);
+		inv->addItem(woodId, 8);
+		EXPECT_EQ(ledger->total(woodId), 8U);
+		EXPECT_EQ(ledger->countIn(box, woodId), 8U);
+
+		inv->removeItem(woodId, 3);
+		EXPECT_EQ(ledger->total(woodId), 5U);
+
+		inv->removeItem(woodId, 5);
+		EXPECT_EQ(ledger->total(woodId), 0U);
+		EXPECT_TRUE(ledger->holders(woodId).empty()) << "an emptied box stops being listed as a holder";
+
+		inv->addItem(stoneId, 2);
+		inv->clear();
+		EXPECT_EQ(ledger->total(stoneId), 0U);
+	}
+
+	TEST_F(ResourceLedgerSystemTest, HolderListStaysConsistentWhenAMiddleBoxEmpties) {
+		auto a = makeBox({0.0F, 0.0F}, "Wood", 1);
+		auto b = makeBox({1.0F, 0.0F}, "Wood", 2);
+		auto c = makeBox({2.0F, 0.0F}, "Wood", 3);
+		world->update(0.016F);
+
+		world->getComponent<Inventory>(a)->removeItem(woodId, 1);
+		world->getComponent<Inventory>(c)->addItem(woodId, 4);
+
+		const auto holders = ledger->holders(woodId);
+		ASSERT_EQ(holders.size(), 2U);
+		EXPECT_EQ(ledger->countIn(b, woodId), 2U);
+		EXPECT_EQ(ledger->countIn(c, woodId), 7U);
+		EXPECT_EQ(ledger->total(woodId), 9U);
+	}
+
+	TEST_F(ResourceLedgerSystemTest, BoxesAddedAndDestroyedLaterAreTracked) {
+		auto first = makeBox({0.0F, 0.0F}, "Wood", 4);
+		world->update(0.016F);
+
+		auto second = makeBox({5.0F, 0.0F}, "Wood", 6);
+		world->update(0.016F);
+		EXPECT_EQ(ledger->total(woodId), 10U);
+
+		world->destroyEntity(first);
+		world->update(0.016F);
+		EXPECT_EQ(ledger->storageCount(), 1U);
+		EXPECT_EQ(ledger->total(woodId), 6U);
+		EXPECT_EQ(ledger->countIn(second, woodId), 6U);
+	}
+
+	TEST_F(ResourceLedgerSystemTest, BoxWithoutStorageConfigIsDroppedAndUnhooked) {
+		auto box = makeBox({0.0F, 0.0F}, "Wood", 4);
+		world->update(0.016F);
+
+		world->removeComponent<StorageConfiguration>(box);
+		world->update(0.016F);
+		EXPECT_EQ(ledger->total(woodId), 0U);
+
+		auto* inv = world->getComponent<Inventory>(box);
+		EXPECT_EQ(inv->observer, nullptr);
+		inv->addItem(woodId, 1);
+		EXPECT_EQ(ledger->total(woodId), 0U) << "a plain inventory is not colony storage";
+	}
+
+	TEST_F(ResourceLedgerSystemTest, ReplacedInventoryIsRecounted) {
+		auto box = makeBox({0.0F, 0.0F}, "Wood", 4);
+		world->update(0.016F);
+
+		auto fresh = Inventory::createForStorage();
+		fresh.addItem("Stone", 9);
+		world->addComponent<Inventory>(box, std::move(fresh));
+		world->update(0.016F);
+
+		EXPECT_EQ(ledger->total(woodId), 0U);
+		EXPECT_EQ(ledger->total(stoneId), 9U);
+	}
+
+	TEST_F(ResourceLedgerSystemTest, ReservedFollowsEachBoxMinimum) {
+		auto keeper = makeBox({0.0F, 0.0F}, "Wood", 10, /*minAmount=*/4);
+		makeBox({5.0F, 0.0F}, "Wood", 3, /*minAmount=*/5);
+		world->update(0.016F);
+
+		// 4 kept in the first box, and all 3 of the second (below its minimum of 5)
+		EXPECT_EQ(ledger->total(woodId), 13U);
+		EXPECT_EQ(ledger->reserved(woodId), 7U);
+		EXPECT_EQ(ledger->available(woodId), 6U);
+
+		world->getComponent<Inventory>(keeper)->removeItem(woodId, 8);
+		EXPECT_EQ(ledger->reserved(woodId), 5U);
+		EXPECT_EQ(ledger->available(woodId), 0U);
+	}
+
+} // namespace ecs::test
@@ -20,11 +20,10 @@ namespace ecs {
 		// Generate a unique chain ID linking a stocking Harvest to the carry-in Haul it spawns
 		// (createHaulForCompletedHarvest copies the chainId). The carry-in Haul is recognized as a
 		// stocking delivery -- not an ordinary loose-pile haul -- by being StorageGoalSystem-owned
-		// AND having a chainId, so the chainId must be non-zero/unique. Internal linkage: a static
-		// local counter, distinct from other systems' generators.
+		// AND having a chainId, so the chainId must be non-zero/unique. Drawn from the registry's
+		// shared counter, so it never collides with another system's chains.
 		uint64_t generateChainId() {
-			static uint64_t nextChainId = 1;
-			return nextChainId++;
+			return GoalTaskRegistry::Get().allocateChainId();
 		}
 
 	} // namespace
@@ -211,7 +210,7 @@ namespace ecs {
 		// A box stocks only a handful of distinct items; a small vector with a linear scan beats a
 		// per-tick heap-allocating set.
 		std::vector<uint32_t> itemsBeingStocked;
-		for (const auto* child : registry.getChildGoals(umbrellaId)) {
+		for (const auto* child : registry.childGoals(umbrellaId)) {
 			if (child == nullptr) {
 				continue;
 			}
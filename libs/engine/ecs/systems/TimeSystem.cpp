@@ -7,7 +7,7 @@ namespace ecs {
 
 namespace {
 	// Number of valid GameSpeed enum values
-	constexpr int kSpeedMultiplierCount = 4;
+	constexpr int kSpeedMultiplierCount = 5;
 }  // namespace
 
 const char* seasonName(Season season) {
@@ -31,10 +31,7 @@ void TimeSystem::update(float deltaTime) {
 		return;	 // Time frozen
 	}
 
-	int speedIndex = static_cast<int>(currentSpeed);
-	assert(speedIndex >= 0 && speedIndex < kSpeedMultiplierCount && "Invalid GameSpeed enum value");
-	float speedMultiplier = kSpeedMultipliers[speedIndex];
-	float gameMinutes = deltaTime * baseTimeScale * speedMultiplier;
+	float gameMinutes = deltaTime * effectiveTimeScale();
 	advanceTime(gameMinutes);
 }
 
@@ -99,10 +96,17 @@ void TimeSystem::skipTime(float gameMinutes) {
 	}
 }
 
-float TimeSystem::effectiveTimeScale() const {
+float TimeSystem::speedMultiplier() const {
 	int speedIndex = static_cast<int>(currentSpeed);
 	assert(speedIndex >= 0 && speedIndex < kSpeedMultiplierCount && "Invalid GameSpeed enum value");
-	return baseTimeScale * kSpeedMultipliers[speedIndex];
+	return kSpeedMultipliers[speedIndex];
+}
+
+float TimeSystem::effectiveTimeScale() const {
+	if (fixedStep) {
+		return isPaused() ? 0.0F : baseTimeScale;
+	}
+	return baseTimeScale * speedMultiplier();
 }
 
 GameTimeSnapshot TimeSystem::snapshot() const {
@@ -115,4 +119,11 @@ GameTimeSnapshot TimeSystem::snapshot() const {
 	};
 }
 
+void TimeSystem::restore(const GameTimeSnapshot& saved) {
+	dayCount = saved.day < 1 ? 1 : saved.day;
+	setTimeOfDay(saved.timeOfDay);
+	advanceTime(0.0F); // recompute the season from the day count
+	setSpeed(saved.speed);
+}
+
 }  // namespace ecs
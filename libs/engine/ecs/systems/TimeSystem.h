@@ -4,11 +4,15 @@
 //
 // This system runs first (priority 10) and provides:
 // - Day/season/time tracking
-// - Game speed control (pause, 1x, 3x, 10x)
+// - Game speed control (pause, 1x, 3x, 10x, max)
 // - Effective time scale for other systems to query
 //
 // Other systems should call effectiveTimeScale() to get
 // speed-adjusted dt rather than using raw deltaTime.
+//
+// Under SimulationClock (fixed-step mode) the speed setting is realised as
+// ticks per frame instead: every tick has the same dt and effectiveTimeScale()
+// drops the speed multiplier, so systems behave the same at every speed.
 
 #include "../ISystem.h"
 
@@ -19,7 +23,8 @@ enum class GameSpeed {
 	Paused = 0,
 	Normal = 1,	  // 1x
 	Fast = 2,	  // 3x
-	VeryFast = 3  // 10x
+	VeryFast = 3, // 10x
+	Max = 4		  // As many fixed ticks as the frame budget allows (SimulationClock)
 };
 
 /// Season enumeration
@@ -65,13 +70,27 @@ class TimeSystem : public ISystem {
 	[[nodiscard]] float timeOfDay() const { return currentTimeOfDay; }
 	[[nodiscard]] GameTimeSnapshot snapshot() const;
 
+	/// Put the clock back where a snapshot left it (save/load). Season is
+	/// recomputed from the day; the speed is applied as set.
+	void restore(const GameTimeSnapshot& saved);
+
 	// --- Time Scale (for other systems) ---
 	/// Returns the effective time multiplier for this frame (game-minutes per real-second).
-	/// Returns 0.0 when paused. NOTE: this also scales MovementSystem/PhysicsSystem integration, so
+	/// Returns 0.0 when paused. In fixed-step mode the speed multiplier is left out (the clock runs
+	/// more ticks instead), so this is just the base scale. NOTE: this also scales MovementSystem/PhysicsSystem integration, so
 	/// baseTimeScale must stay a pure speed multiplier -- do not repurpose it as a clock-rate knob, or
 	/// colonists would move at that rate (e.g. baseTimeScale 60 => 60x movement, not just a fast clock).
 	[[nodiscard]] float effectiveTimeScale() const;
 
+	/// Speed setting as a multiplier of 1x (0 when paused). SimulationClock feeds
+	/// frame time times this into its tick accumulator.
+	[[nodiscard]] float speedMultiplier() const;
+
+	/// Fixed-step mode: set by SimulationClock, which calls update() with a constant
+	/// tick dt and realises the game speed as the number of ticks per frame.
+	void setFixedStep(bool enabled) { fixedStep = enabled; }
+	[[nodiscard]] bool isFixedStep() const { return fixedStep; }
+
 	// --- Configuration ---
 	/// Set game-minutes per real-second at 1x speed (default: 1.0)
 	void setBaseTimeScale(float gameMinutesPerSecond) { baseTimeScale = gameMinutesPerSecond; }
@@ -94,13 +113,15 @@ class TimeSystem : public ISystem {
 	// Speed state
 	GameSpeed currentSpeed = GameSpeed::Normal;
 	GameSpeed previousSpeed = GameSpeed::Normal;  // For pause/resume
+	bool fixedStep = false;
 
 	// Configuration
 	float baseTimeScale = 1.0F;	 // Game-minutes per real-second at 1x
 	int daysPerSeason = 15;
 
-	// Speed multipliers
-	static constexpr float kSpeedMultipliers[] = {0.0F, 1.0F, 3.0F, 10.0F};
+	// Speed multipliers. Max has no fixed rate under SimulationClock; without the
+	// clock (variable step) it falls back to the 10x step.
+	static constexpr float kSpeedMultipliers[] = {0.0F, 1.0F, 3.0F, 10.0F, 10.0F};
 
 	void advanceTime(float gameMinutes);
 };
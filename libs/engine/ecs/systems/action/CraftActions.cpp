@@ -36,10 +36,16 @@ namespace ecs {
 			);
 			return;
 		}
-		for (const auto& [itemName, count] : craftEff.inputs) {
-			uint32_t removed = stationInv->removeItem(itemName, count);
+		for (const auto& [itemId, count] : craftEff.inputs) {
+			uint32_t removed = stationInv->removeItem(itemId, count);
 			if (removed < count) {
-				LOG_WARNING(Engine, "[Action] Craft failed to consume %u x %s from station (only had %u)", count, itemName.c_str(), removed);
+				LOG_WARNING(
+					Engine,
+					"[Action] Craft failed to consume %u x %s from station (only had %u)",
+					count,
+					assetRegistry.getDefName(itemId).c_str(),
+					removed
+				);
 			}
 		}
 
@@ -51,8 +57,9 @@ namespace ecs {
 		// respecting at every step. Keying on category (not handsRequired) is deliberate: Wood is
 		// also two-hand but must stay a carryable resource, not become a packaged install.
 		const glm::vec2 dropPos = action.targetPosition; // colonist crafts standing at the station
-		for (const auto& [itemName, count] : craftEff.outputs) {
-			const auto* outputDef = assetRegistry.getDefinition(itemName);
+		for (const auto& [itemId, count] : craftEff.outputs) {
+			const std::string& itemName = assetRegistry.getDefName(itemId);
+			const auto*		   outputDef = assetRegistry.getDefinition(itemId);
 			const bool	isFurniture =
 				outputDef != nullptr && outputDef->category == engine::assets::ItemCategory::Furniture;
 
@@ -152,15 +159,18 @@ namespace ecs {
 			}
 		}
 
-		// Build inputs and outputs vectors for the action
-		std::vector<std::pair<std::string, uint32_t>> inputs;
+		// Build inputs and outputs vectors for the action. Interned here rather than read from the
+		// recipe's defNameId, which stays 0 for an item with no asset definition.
+		auto& assetRegistry = engine::assets::AssetRegistry::Get();
+
+		std::vector<std::pair<uint32_t, uint32_t>> inputs;
 		for (const auto& input : recipe->inputs) {
-			inputs.emplace_back(input.defName, input.count);
+			inputs.emplace_back(assetRegistry.internDefName(input.defName), input.count);
 		}
 
-		std::vector<std::pair<std::string, uint32_t>> outputs;
+		std::vector<std::pair<uint32_t, uint32_t>> outputs;
 		for (const auto& output : recipe->outputs) {
-			outputs.emplace_back(output.defName, output.count);
+			outputs.emplace_back(assetRegistry.internDefName(output.defName), output.count);
 		}
 
 		// Create the craft action
@@ -73,15 +73,16 @@ namespace ecs {
 	) {
 		const auto& collEff = action.collectionEffect();
 
-		auto& harvestRegistry = engine::assets::AssetRegistry::Get();
+		auto&			   harvestRegistry = engine::assets::AssetRegistry::Get();
+		const std::string& itemName = harvestRegistry.getDefName(collEff.itemDefNameId);
 
 		// Cap this withdrawal by what the colonist can actually take this action: the carry
 		// weight (tools are equipment and don't count) AND the backpack's stack/slot headroom.
 		// Clamping by both means the pool below is only debited by what truly lands in the
 		// inventory, so a tree's wood is conserved. At the limit `wanted` is 0: take nothing
 		// and leave the source for the next trip rather than dropping items on the floor.
-		const uint32_t massFit = ecs::cargoUnitsThatFit(inventory, harvestRegistry, collEff.itemDefName);
-		const uint32_t slotFit = inventory.addableCount(collEff.itemDefName);
+		const uint32_t massFit = ecs::cargoUnitsThatFit(inventory, harvestRegistry, collEff.itemDefNameId);
+		const uint32_t slotFit = inventory.addableCount(collEff.itemDefNameId);
 		const uint32_t wanted = std::min({collEff.quantity, massFit, slotFit});
 
 		uint32_t added = 0;
@@ -103,30 +104,30 @@ namespace ecs {
 				);
 				return;
 			}
-			const uint32_t removed = sourceInv->removeItem(collEff.itemDefName, wanted);
+			const uint32_t removed = sourceInv->removeItem(collEff.itemDefNameId, wanted);
 			// A two-hand good (wood) can't ride in the pack: it must seat into the hands as a
 			// weight-limited armful, mirroring the loose-pile and single-shot branches above/below.
 			// Stow any held one-hand tool first so it doesn't block the lift. addItem would silently
 			// violate the two-hand invariant, then the deposit leg's removeFromHands would find empty
 			// hands and strand the good -- breaking the Wood box-to-box case.
-			if (ecs::itemIsTwoHand(harvestRegistry, collEff.itemDefName)) {
+			if (ecs::itemIsTwoHand(harvestRegistry, collEff.itemDefNameId)) {
 				stowHeldToolsForArmful(inventory, collEff.sourcePosition);
-				added = ecs::addArmful(inventory, harvestRegistry, collEff.itemDefName, removed);
+				added = ecs::addArmful(inventory, harvestRegistry, collEff.itemDefNameId, removed);
 			} else {
-				added = inventory.addItem(collEff.itemDefName, removed);
+				added = inventory.addItem(collEff.itemDefNameId, removed);
 			}
 			if (added < removed) {
 				// Colonist couldn't hold all we pulled (raced carry/slot state, or a two-hand stack/
 				// weight cap): put the remainder back in the source box so nothing is lost.
-				sourceInv->addItem(collEff.itemDefName, removed - added);
+				sourceInv->addItem(collEff.itemDefNameId, removed - added);
 			}
 			LOG_INFO(
 				Engine,
 				"[Action] Withdrew %u x %s from box %llu (now carrying %u)",
 				added,
-				collEff.itemDefName.c_str(),
+				itemName.c_str(),
 				static_cast<unsigned long long>(collEff.sourceStorageId),
-				inventory.getQuantity(collEff.itemDefName)
+				inventory.getQuantity(collEff.itemDefNameId)
 			);
 			return; // a pull's harvest-goal credit is N/A; the deposit leg credits the umbrella
 		}
@@ -137,11 +138,11 @@ namespace ecs {
 		// the entity only when it empties -- never the full-destroy a Pickup's CollectionEffect
 		// requests (destroySource=true), which would delete a still-loaded pile. This branch
 		// intercepts before the pool/single-shot logic so a pile never reaches that destroy.
-		// Only a ground pickup (sourceDefName == itemDefName, e.g. "Wood" from "Wood") may take the
+		// Only a ground pickup (the source IS the item, e.g. "Wood" from "Wood") may take the
 		// loose-pile path. A tree-fell yields "Wood" from "Flora_Tree..."; its source differs, so it
 		// must NOT be diverted here -- otherwise a pile sitting on the fell spot would hijack the chop.
-		const LoosePile pile = (collEff.sourceDefName == collEff.itemDefName)
-								   ? findLoosePile(world, collEff.itemDefName, collEff.sourcePosition)
+		const LoosePile pile = (collEff.sourceDefName == itemName)
+								   ? findLoosePile(world, itemName, collEff.sourcePosition)
 								   : LoosePile{};
 		if (pile.stack) {
 			// A pickup from a ground pile takes only what was REQUESTED (collEff.quantity, the
@@ -150,14 +151,14 @@ namespace ecs {
 			// Carry capacity still clamps. A harvest (the pool/single-shot branches below) instead
 			// takes all it can carry, because a far harvest spot shouldn't strand cut resources.
 			const uint32_t requested = std::min(collEff.quantity, pile.stack->quantity);
-			if (ecs::itemIsTwoHand(harvestRegistry, collEff.itemDefName)) {
+			if (ecs::itemIsTwoHand(harvestRegistry, collEff.itemDefNameId)) {
 				// A two-hand armful needs both hands; stow any held one-hand tool (belt -> pack -> drop)
 				// so an axe in hand doesn't block the lift.
 				stowHeldToolsForArmful(inventory, collEff.sourcePosition);
-				added = ecs::addArmful(inventory, harvestRegistry, collEff.itemDefName, requested);
+				added = ecs::addArmful(inventory, harvestRegistry, collEff.itemDefNameId, requested);
 			} else {
-				const uint32_t fit = ecs::cargoUnitsThatFit(inventory, harvestRegistry, collEff.itemDefName);
-				added = inventory.addItem(collEff.itemDefName, std::min(requested, fit));
+				const uint32_t fit = ecs::cargoUnitsThatFit(inventory, harvestRegistry, collEff.itemDefNameId);
+				added = inventory.addItem(collEff.itemDefNameId, std::min(requested, fit));
 			}
 
 			pile.stack->quantity -= added; // mutate the live component so the pile tracks what is left
@@ -168,13 +169,12 @@ namespace ecs {
 				if (m_onRemoveEntityById) {
 					m_onRemoveEntityById(pile.entity);
 				}
-				uint32_t pileDefNameId = harvestRegistry.getDefNameId(collEff.itemDefName);
-				memory.forgetWorldEntity({collEff.sourcePosition.x, collEff.sourcePosition.y}, pileDefNameId);
+				memory.forgetWorldEntity({collEff.sourcePosition.x, collEff.sourcePosition.y}, collEff.itemDefNameId);
 				LOG_INFO(
 					Engine,
 					"[Action] Hauled last %u x %s from loose pile at (%.1f, %.1f) - pile removed",
 					added,
-					collEff.itemDefName.c_str(),
+					itemName.c_str(),
 					collEff.sourcePosition.x,
 					collEff.sourcePosition.y
 				);
@@ -183,7 +183,7 @@ namespace ecs {
 					Engine,
 					"[Action] Hauled %u x %s from loose pile at (%.1f, %.1f) - %u left",
 					added,
-					collEff.itemDefName.c_str(),
+					itemName.c_str(),
 					collEff.sourcePosition.x,
 					collEff.sourcePosition.y,
 					pile.stack->quantity
@@ -197,13 +197,13 @@ namespace ecs {
 				// to fit by both weight and slots), so the tree's wood is conserved.
 				const ResourceDraw draw =
 					m_onDecrementResource(collEff.sourceDefName, collEff.sourcePosition.x, collEff.sourcePosition.y, wanted);
-				added = inventory.addItem(collEff.itemDefName, draw.removed);
+				added = inventory.addItem(collEff.itemDefNameId, draw.removed);
 				LOG_INFO(
 					Engine,
 					"[Action] Chopped %u x %s (now carrying %u)",
 					added,
-					collEff.itemDefName.c_str(),
-					inventory.getQuantity(collEff.itemDefName)
+					itemName.c_str(),
+					inventory.getQuantity(collEff.itemDefNameId)
 				);
 				if (draw.depleted) {
 					if (m_onRemoveEntity) {
@@ -239,7 +239,7 @@ namespace ecs {
 			// whole yield still drops and the source is removed, so no wood is lost and no stump
 			// lingers. Everything else (one-hand) stacks into the pack and only touches the
 			// source when something was actually collected.
-			const bool isTwoHand = ecs::itemIsTwoHand(harvestRegistry, collEff.itemDefName);
+			const bool isTwoHand = ecs::itemIsTwoHand(harvestRegistry, collEff.itemDefNameId);
 
 			bool destroySource = false;
 			bool regrowSource = false;
@@ -249,16 +249,16 @@ namespace ecs {
 				// crafted/holds a one-hand axe, it sits in a hand and would block the lift; stow it
 				// (belt -> pack -> drop) first so the wood goes into the hands rather than dropping.
 				stowHeldToolsForArmful(inventory, collEff.sourcePosition);
-				added = ecs::addArmful(inventory, harvestRegistry, collEff.itemDefName, collEff.quantity);
+				added = ecs::addArmful(inventory, harvestRegistry, collEff.itemDefNameId, collEff.quantity);
 
 				const uint32_t remainder = collEff.quantity - added;
 				if (remainder > 0 && m_onDropResource) {
-					m_onDropResource(collEff.itemDefName, collEff.sourcePosition.x, collEff.sourcePosition.y, remainder);
+					m_onDropResource(itemName, collEff.sourcePosition.x, collEff.sourcePosition.y, remainder);
 					LOG_INFO(
 						Engine,
 						"[Action] Dropped loose pile of %u x %s at (%.1f, %.1f)",
 						remainder,
-						collEff.itemDefName.c_str(),
+						itemName.c_str(),
 						collEff.sourcePosition.x,
 						collEff.sourcePosition.y
 					);
@@ -272,24 +272,22 @@ namespace ecs {
 				// further items). A harvest cut (source differs from the yield, e.g. a bush yielding
 				// Sticks) is NOT capped this way: its yield is whatever the harvestable gives.
 				uint32_t take = wanted;
-				if (collEff.sourceDefName == collEff.itemDefName) {
-					const auto* srcDef = harvestRegistry.getDefinition(collEff.itemDefName);
+				if (collEff.sourceDefName == itemName) {
+					const auto* srcDef = harvestRegistry.getDefinition(collEff.itemDefNameId);
 					if (srcDef != nullptr && srcDef->capabilities.carryable.has_value()) {
 						take = std::min(take, srcDef->capabilities.carryable->quantity);
 					}
 				}
-				added = inventory.addItem(collEff.itemDefName, take);
+				added = inventory.addItem(collEff.itemDefNameId, take);
 				destroySource = added > 0 && collEff.destroySource;
 				regrowSource = added > 0 && !collEff.destroySource && collEff.regrowthTime > 0.0F;
 			}
 
 			if (added < collEff.quantity) {
 				// Carry/slot-limited below the full yield -- expected, not an error.
-				LOG_INFO(
-					Engine, "[Action] Collected %u of %u x %s (carry-limited)", added, collEff.quantity, collEff.itemDefName.c_str()
-				);
+				LOG_INFO(Engine, "[Action] Collected %u of %u x %s (carry-limited)", added, collEff.quantity, itemName.c_str());
 			} else {
-				LOG_INFO(Engine, "[Action] Collected %u x %s", added, collEff.itemDefName.c_str());
+				LOG_INFO(Engine, "[Action] Collected %u x %s", added, itemName.c_str());
 			}
 
 			if (destroySource) {
@@ -438,7 +436,7 @@ namespace ecs {
 		// Build the Harvest at the ENTITY's position (the actual tree), not task.targetPosition (the
 		// snapped stand point). applyCollectionEffect resolves the source pool/pile by this position.
 		action = Action::Harvest(
-			harvestCap.yieldDefName,
+			yieldDefNameId,
 			yieldAmount,
 			harvestCap.durability,
 			entity.position,
@@ -59,8 +59,9 @@ namespace ecs {
 	void ActionSystem::applyDepositEffect(const Action& action, Task& task, Inventory& inventory) {
 		const auto& depEff = action.depositEffect();
 
-		auto&	   registry = engine::assets::AssetRegistry::Get();
-		const bool twoHand	= ecs::itemIsTwoHand(registry, depEff.itemDefName);
+		auto&			   registry = engine::assets::AssetRegistry::Get();
+		const std::string& itemName = registry.getDefName(depEff.itemDefNameId);
+		const bool		   twoHand = ecs::itemIsTwoHand(registry, depEff.itemDefNameId);
 
 		// Craft-material delivery, mirroring the build-site path: the material is MOVED from the
 		// colonist's pack/hands into the crafting station's own Inventory store. The colonist's
@@ -75,7 +76,7 @@ namespace ecs {
 				LOG_WARNING(
 					Engine,
 					"[Action] Craft delivery of %s: station %llu has no Inventory store, items kept in pack",
-					depEff.itemDefName.c_str(),
+					itemName.c_str(),
 					static_cast<unsigned long long>(depEff.storageEntityId)
 				);
 				return;
@@ -87,40 +88,40 @@ namespace ecs {
 			// needs (a Reed yields up to 3 Plant Fiber, the recipe wants 1) deposits only the
 			// shortfall and keeps the rest on himself. Banking the excess would masquerade as
 			// available stock for later crafts and mis-route their provisioning.
-			const uint32_t carried = ecs::availableQuantity(inventory, depEff.itemDefName);
-			const uint32_t toDeposit = std::min(carried, craftStationRemaining(world, stationEntity, *stationInv, depEff.itemDefName));
+			const uint32_t carried = ecs::availableQuantity(inventory, depEff.itemDefNameId);
+			const uint32_t toDeposit = std::min(carried, craftStationRemaining(world, stationEntity, *stationInv, itemName));
 			if (toDeposit == 0) {
 				// Station already holds the full requirement for this input; keep the surplus carried.
 				LOG_DEBUG(Engine, "[Action] Craft deposit skipped: station %llu already has enough %s",
-					static_cast<unsigned long long>(stationEntity), depEff.itemDefName.c_str());
+					static_cast<unsigned long long>(stationEntity), itemName.c_str());
 				return;
 			}
-			uint32_t removed = twoHand ? ecs::removeFromHands(inventory, depEff.itemDefName, toDeposit)
-									   : inventory.removeItem(depEff.itemDefName, toDeposit);
+			uint32_t removed = twoHand ? ecs::removeFromHands(inventory, depEff.itemDefNameId, toDeposit)
+									   : inventory.removeItem(depEff.itemDefNameId, toDeposit);
 			if (removed == 0) {
-				LOG_WARNING(Engine, "[Action] Craft deposit failed: %s not in inventory", depEff.itemDefName.c_str());
+				LOG_WARNING(Engine, "[Action] Craft deposit failed: %s not in inventory", itemName.c_str());
 				return;
 			}
 
 			// removed is already capped to the remaining recipe need, so the store has room for all
 			// of it (createForStorage gives ample slots); add and credit exactly that.
-			uint32_t added = stationInv->addItem(depEff.itemDefName, removed);
+			uint32_t added = stationInv->addItem(depEff.itemDefNameId, removed);
 			if (added < removed) {
 				// Defensive: store slot-limited below the metered amount. Keep the surplus carried.
 				uint32_t leftover = removed - added;
 				if (twoHand) {
-					ecs::addArmful(inventory, registry, depEff.itemDefName, leftover);
+					ecs::addArmful(inventory, registry, depEff.itemDefNameId, leftover);
 				} else {
-					inventory.addItem(depEff.itemDefName, leftover);
+					inventory.addItem(depEff.itemDefNameId, leftover);
 				}
-				LOG_WARNING(Engine, "[Action] Craft station full: deposited %u of %u x %s", added, removed, depEff.itemDefName.c_str());
+				LOG_WARNING(Engine, "[Action] Craft station full: deposited %u of %u x %s", added, removed, itemName.c_str());
 			}
 
 			LOG_INFO(
 				Engine,
 				"[Action] Delivered %u x %s into crafting station %llu (now in station store)",
 				added,
-				depEff.itemDefName.c_str(),
+				itemName.c_str(),
 				static_cast<unsigned long long>(depEff.storageEntityId)
 			);
 
@@ -136,8 +137,8 @@ namespace ecs {
 		} else {
 
 		// Remove item from the colonist: two-hand goods come out of the hands, the rest the pack.
-		uint32_t removed = twoHand ? ecs::removeFromHands(inventory, depEff.itemDefName, depEff.quantity)
-								   : inventory.removeItem(depEff.itemDefName, depEff.quantity);
+		uint32_t removed = twoHand ? ecs::removeFromHands(inventory, depEff.itemDefNameId, depEff.quantity)
+								   : inventory.removeItem(depEff.itemDefNameId, depEff.quantity);
 		if (removed > 0) {
 			const auto storageEntity = static_cast<EntityID>(depEff.storageEntityId);
 
@@ -145,22 +146,22 @@ namespace ecs {
 			// the blueprint's delivered[] manifest, capped at its requirement. A storage container
 			// owns an Inventory and the goods land there. These are the only two deposit targets.
 			if (auto* blueprint = world->getComponent<StructureBlueprint>(storageEntity)) {
-				uint32_t recorded = blueprint->recordDelivery(depEff.itemDefName, removed);
+				uint32_t recorded = blueprint->recordDelivery(itemName, removed);
 				if (recorded < removed) {
 					// Over the requirement: bounce the surplus back to the colonist (mirrored armful
 					// for two-hand goods, backpack otherwise) rather than overfilling the manifest.
 					uint32_t leftover = removed - recorded;
 					if (twoHand) {
-						ecs::addArmful(inventory, registry, depEff.itemDefName, leftover);
+						ecs::addArmful(inventory, registry, depEff.itemDefNameId, leftover);
 					} else {
-						inventory.addItem(depEff.itemDefName, leftover);
+						inventory.addItem(depEff.itemDefNameId, leftover);
 					}
 				}
 				LOG_INFO(
 					Engine,
 					"[Action] Delivered %u x %s to build site %llu (recorded on manifest)",
 					recorded,
-					depEff.itemDefName.c_str(),
+					itemName.c_str(),
 					static_cast<unsigned long long>(depEff.storageEntityId)
 				);
 
@@ -174,22 +175,22 @@ namespace ecs {
 					}
 				}
 			} else if (auto* storageInv = world->getComponent<Inventory>(storageEntity)) {
-				uint32_t added = storageInv->addItem(depEff.itemDefName, removed);
+				uint32_t added = storageInv->addItem(depEff.itemDefNameId, removed);
 				if (added < removed) {
 					// Storage full - put remaining back in colonist inventory
 					uint32_t leftover = removed - added;
 					if (twoHand) {
-						ecs::addArmful(inventory, registry, depEff.itemDefName, leftover);
+						ecs::addArmful(inventory, registry, depEff.itemDefNameId, leftover);
 					} else {
-						inventory.addItem(depEff.itemDefName, leftover);
+						inventory.addItem(depEff.itemDefNameId, leftover);
 					}
-					LOG_WARNING(Engine, "[Action] Storage full: deposited %u of %u x %s", added, removed, depEff.itemDefName.c_str());
+					LOG_WARNING(Engine, "[Action] Storage full: deposited %u of %u x %s", added, removed, itemName.c_str());
 				} else {
 					LOG_INFO(
 						Engine,
 						"[Action] Deposited %u x %s into storage %llu",
 						added,
-						depEff.itemDefName.c_str(),
+						itemName.c_str(),
 						static_cast<unsigned long long>(depEff.storageEntityId)
 					);
 				}
@@ -232,9 +233,9 @@ namespace ecs {
 				// Target is neither a build site nor a storage container (destroyed/gone) - put
 				// items back, credit nothing.
 				if (twoHand) {
-					ecs::addArmful(inventory, registry, depEff.itemDefName, removed);
+					ecs::addArmful(inventory, registry, depEff.itemDefNameId, removed);
 				} else {
-					inventory.addItem(depEff.itemDefName, removed);
+					inventory.addItem(depEff.itemDefNameId, removed);
 				}
 				LOG_WARNING(
 					Engine,
@@ -243,7 +244,7 @@ namespace ecs {
 				);
 			}
 		} else {
-			LOG_WARNING(Engine, "[Action] Deposit failed: %s not in inventory", depEff.itemDefName.c_str());
+			LOG_WARNING(Engine, "[Action] Deposit failed: %s not in inventory", itemName.c_str());
 		}
 		} // end storage-deposit branch
 	}
@@ -299,7 +300,8 @@ namespace ecs {
 	}
 
 	void ActionSystem::startHaulAction(EntityID entity, Task& task, Action& action, const Position& position, Memory& memory, const Inventory& inventory) {
-		auto& registry = engine::assets::AssetRegistry::Get();
+		auto&			   registry = engine::assets::AssetRegistry::Get();
+		const std::string& haulItemName = registry.getDefName(task.haulItemDefNameId);
 
 		constexpr float kPositionTolerance = 0.5F;
 
@@ -313,7 +315,7 @@ namespace ecs {
 			const auto targetEntity = static_cast<EntityID>(task.haulTargetStorageId);
 			const bool targetIsCraftStation = world->hasComponent<WorkQueue>(targetEntity);
 			action = Action::Deposit(
-				task.haulItemDefName,
+				task.haulItemDefNameId,
 				task.haulQuantity,
 				task.haulTargetStorageId,
 				task.haulTargetPosition,
@@ -323,7 +325,7 @@ namespace ecs {
 				Engine,
 				"[Action] Haul-from-inventory: deliver %u x %s to %s %llu",
 				task.haulQuantity,
-				task.haulItemDefName.c_str(),
+				haulItemName.c_str(),
 				targetIsCraftStation ? "crafting station" : "build site",
 				static_cast<unsigned long long>(task.haulTargetStorageId)
 			);
@@ -341,7 +343,7 @@ namespace ecs {
 		// and a position-only check would Deposit an empty pack, fail, and re-issue the same
 		// fetch every tick -- an infinite "deposit nothing -> refetch" loop that strands the
 		// craft half-provisioned.
-		const bool carryingHaulItem = ecs::availableQuantity(inventory, task.haulItemDefName) > 0;
+		const bool carryingHaulItem = ecs::availableQuantity(inventory, task.haulItemDefNameId) > 0;
 
 		glm::vec2 diffToSource = position.value - task.haulSourcePosition;
 		float	  distSqToSource = diffToSource.x * diffToSource.x + diffToSource.y * diffToSource.y;
@@ -371,12 +373,12 @@ namespace ecs {
 					action.clear();
 					return;
 				}
-				action = Action::Withdraw(task.haulItemDefName, task.haulQuantity, task.haulSourceStorageId, task.haulSourcePosition);
+				action = Action::Withdraw(task.haulItemDefNameId, task.haulQuantity, task.haulSourceStorageId, task.haulSourcePosition);
 				LOG_DEBUG(
 					Engine,
 					"[Action] Haul phase 1: Withdraw %u x %s from box %llu at (%.1f, %.1f)",
 					task.haulQuantity,
-					task.haulItemDefName.c_str(),
+					haulItemName.c_str(),
 					static_cast<unsigned long long>(task.haulSourceStorageId),
 					task.haulSourcePosition.x,
 					task.haulSourcePosition.y
@@ -395,13 +397,13 @@ namespace ecs {
 					continue;
 				}
 
-				const auto& defName = registry.getDefName(entity.defNameId);
-
 				// Check if this is the item we want to haul
-				if (defName != task.haulItemDefName) {
+				if (entity.defNameId != task.haulItemDefNameId) {
 					continue;
 				}
 
+				const auto& defName = registry.getDefName(entity.defNameId);
+
 				const auto* def = registry.getDefinition(defName);
 				if (def != nullptr && def->capabilities.carryable.has_value()) {
 					const auto& carryableCap = def->capabilities.carryable.value();
@@ -418,7 +420,7 @@ namespace ecs {
 					const auto* goal = task.haulGoalId != 0 ? GoalTaskRegistry::Get().getGoal(task.haulGoalId) : nullptr;
 					if (goal != nullptr && goal->owner == GoalOwner::CraftingGoalSystem && goal->targetAmount > 0) {
 						// targetAmount is an item count for a craft haul, so the remaining need is exact.
-						const uint32_t carried = ecs::availableQuantity(inventory, task.haulItemDefName);
+						const uint32_t carried = ecs::availableQuantity(inventory, task.haulItemDefNameId);
 						const uint32_t accountedFor = goal->deliveredAmount + carried;
 						pickupQty = goal->targetAmount > accountedFor ? goal->targetAmount - accountedFor : 0U;
 						if (pickupQty == 0) {
@@ -428,7 +430,7 @@ namespace ecs {
 							return;
 						}
 					}
-					action = Action::Pickup(defName, pickupQty, entity.position, defName);
+					action = Action::Pickup(entity.defNameId, pickupQty, entity.position, defName);
 					LOG_DEBUG(
 						Engine,
 						"[Action] Haul phase 1: Pickup %u x %s at (%.1f, %.1f)",
@@ -452,7 +454,7 @@ namespace ecs {
 			LOG_WARNING(
 				Engine,
 				"[Action] Haul failed: item %s not found at (%.1f, %.1f)%s",
-				task.haulItemDefName.c_str(),
+				haulItemName.c_str(),
 				task.haulSourcePosition.x,
 				task.haulSourcePosition.y,
 				staleAtSource.has_value() ? " - forgot stale entry" : ""
@@ -478,7 +480,7 @@ namespace ecs {
 			// The station carries an Inventory too, so the WorkQueue is what distinguishes it.
 			const bool toCraftStation = world->hasComponent<WorkQueue>(storageEntity);
 			action = Action::Deposit(
-				task.haulItemDefName,
+				task.haulItemDefNameId,
 				task.haulQuantity,
 				task.haulTargetStorageId,
 				task.haulTargetPosition,
@@ -488,7 +490,7 @@ namespace ecs {
 				Engine,
 				"[Action] Haul phase 2: Deposit %u x %s into storage %llu",
 				task.haulQuantity,
-				task.haulItemDefName.c_str(),
+				haulItemName.c_str(),
 				static_cast<unsigned long long>(task.haulTargetStorageId)
 			);
 		} else if (carryingHaulItem) {
@@ -523,7 +525,7 @@ namespace ecs {
 			LOG_DEBUG(
 				Engine,
 				"[Action] Haul: carrying %s at source, redirecting to deposit at (%.1f, %.1f)",
-				task.haulItemDefName.c_str(),
+				haulItemName.c_str(),
 				task.haulTargetPosition.x,
 				task.haulTargetPosition.y
 			);
@@ -604,23 +606,24 @@ namespace ecs {
 			return;
 		}
 
-		const auto& itemName = handSlot->defName;
-		uint32_t	quantity = handSlot->quantity;
+		const uint32_t	   itemId = handSlot->defNameId;
+		const std::string& itemName = handSlot->defName(); // registry-owned, outlives the slot
+		uint32_t		   quantity = handSlot->quantity;
 
 		// Check if item can go in backpack (1-handed items only)
-		bool canBackpack = !ecs::itemIsTwoHand(engine::assets::AssetRegistry::Get(), itemName);
+		bool canBackpack = !ecs::itemIsTwoHand(engine::assets::AssetRegistry::Get(), itemId);
 
 		if (canBackpack) {
 			// One-hand item: try the belt first (quick-draw tool slot), then the backpack, then drop.
 			// A single belt slot holds one item; only attempt it for the common quantity-1 hand stack.
-			if (quantity == 1 && inventory.stowToBelt(itemName)) {
+			if (quantity == 1 && inventory.stowToBelt(itemId)) {
 				LOG_DEBUG(Engine, "[Action] Stowed %s from %s hand to belt", itemName.c_str(), handName);
 				handSlot.reset();
 				return;
 			}
 
 			// Try to stow in backpack
-			uint32_t added = inventory.addItem(itemName, quantity);
+			uint32_t added = inventory.addItem(itemId, quantity);
 			if (added == quantity) {
 				LOG_DEBUG(Engine, "[Action] Stowed %u x %s from %s hand to backpack", quantity, itemName.c_str(), handName);
 			} else {
@@ -691,9 +694,9 @@ namespace ecs {
 		// independently would drop it twice. Handle the mirror once: drop the whole
 		// armful as a single loose pile (haulable, not per-unit packaged), free both hands.
 		if (inventory.leftHand.has_value() && inventory.rightHand.has_value()
-			&& inventory.leftHand->defName == inventory.rightHand->defName
-			&& ecs::itemIsTwoHand(engine::assets::AssetRegistry::Get(), inventory.leftHand->defName)) {
-			const std::string defName  = inventory.leftHand->defName;
+			&& inventory.leftHand->defNameId == inventory.rightHand->defNameId
+			&& ecs::itemIsTwoHand(engine::assets::AssetRegistry::Get(), inventory.leftHand->defNameId)) {
+			const std::string defName  = inventory.leftHand->defName();
 			const uint32_t	  quantity = inventory.leftHand->quantity;
 			if (m_onDropResource) {
 				m_onDropResource(defName, dropPosition.x, dropPosition.y, quantity);
@@ -46,17 +46,18 @@ namespace ecs {
 			case NeedType::Hunger: {
 				// Priority 1: Check inventory for any edible food (data-driven)
 				for (const auto& edibleItemName : engine::assets::getEdibleItemNames()) {
-					if (inventory.hasItem(edibleItemName)) {
+					const uint32_t edibleId = registry.getDefNameId(edibleItemName);
+					if (inventory.hasItem(edibleId)) {
 						// Get nutrition from item properties
 						auto  edibleInfo = engine::assets::getEdibleItemInfo(edibleItemName);
 						float nutrition = edibleInfo ? edibleInfo->nutrition : 0.3F;
-						action = Action::Eat(edibleItemName, nutrition);
+						action = Action::Eat(edibleId, nutrition);
 						LOG_DEBUG(
 							Engine,
 							"[Action] Creating Eat action for %s (nutrition %.2f, qty %u)",
 							edibleItemName.c_str(),
 							nutrition,
-							inventory.getQuantity(edibleItemName)
+							inventory.getQuantity(edibleId)
 						);
 						break;
 					}
@@ -106,7 +107,7 @@ namespace ecs {
 						}
 
 						action = Action::Harvest(
-							harvestCap.yieldDefName,
+							registry.internDefName(harvestCap.yieldDefName),
 							yield,
 							harvestCap.durability,
 							entity.position,
@@ -211,10 +212,11 @@ namespace ecs {
 	}
 
 	void ActionSystem::applyConsumptionEffect(const Action& action, NeedsComponent& needs, Inventory& inventory) {
-		const auto& consumeEff = action.consumptionEffect();
+		const auto&		   consumeEff = action.consumptionEffect();
+		const std::string& itemName = engine::assets::AssetRegistry::Get().getDefName(consumeEff.itemDefNameId);
 
 		// Remove item from inventory
-		uint32_t removed = inventory.removeItem(consumeEff.itemDefName, consumeEff.quantity);
+		uint32_t removed = inventory.removeItem(consumeEff.itemDefNameId, consumeEff.quantity);
 		if (removed > 0) {
 			// Restore the need
 			if (consumeEff.need < NeedType::Count) {
@@ -239,12 +241,12 @@ namespace ecs {
 				Engine,
 				"[Action] Consumed %u x %s from inventory, restored %.1f%% %s",
 				removed,
-				consumeEff.itemDefName.c_str(),
+				itemName.c_str(),
 				consumeEff.restoreAmount,
 				consumeEff.need == NeedType::Hunger ? "hunger" : "need"
 			);
 		} else {
-			LOG_WARNING(Engine, "[Action] Failed to consume %s from inventory (not found)", consumeEff.itemDefName.c_str());
+			LOG_WARNING(Engine, "[Action] Failed to consume %s from inventory (not found)", itemName.c_str());
 		}
 	}
 
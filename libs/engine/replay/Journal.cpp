@@ -0,0 +1,270 @@
+#include "Journal.h"
+
+#include <utils/Log.h>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+namespace engine::replay {
+
+	namespace {
+
+		using json = nlohmann::json;
+
+		constexpr const char* kFormat = "wsjournal";
+
+		bool parseTick(const std::string& text, uint64_t& out) {
+			if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+				return false;
+			}
+			out = std::strtoull(text.c_str(), nullptr, 10);
+			return true;
+		}
+
+		bool readStringMap(const json& object, std::vector<std::pair<std::string, std::string>>& out) {
+			if (!object.is_object()) {
+				return false;
+			}
+			for (const auto& [key, value] : object.items()) {
+				if (!value.is_string()) {
+					return false;
+				}
+				out.emplace_back(key, value.get<std::string>());
+			}
+			return true;
+		}
+
+	} // namespace
+
+	// --- Command ------------------------------------------------------------
+
+	std::string Command::param(const std::string& key, const std::string& fallback) const {
+		for (const auto& [k, v] : params) {
+			if (k == key) {
+				return v;
+			}
+		}
+		return fallback;
+	}
+
+	bool Command::hasParam(const std::string& key) const {
+		for (const auto& [k, v] : params) {
+			if (k == key) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	std::string Command::toString() const {
+		std::string out = std::to_string(tick) + " " + verb;
+		for (const auto& [key, value] : params) {
+			out += " " + key + "=" + value;
+		}
+		return out;
+	}
+
+	std::optional<Command> parseCommand(const std::string& text) {
+		std::istringstream in(text);
+		std::string		   word;
+		Command			   command;
+		if (!(in >> word) || !parseTick(word, command.tick) || !(in >> command.verb)) {
+			return std::nullopt;
+		}
+		while (in >> word) {
+			const size_t eq = word.find('=');
+			if (eq == std::string::npos || eq == 0) {
+				return std::nullopt;
+			}
+			command.params.emplace_back(word.substr(0, eq), word.substr(eq + 1));
+		}
+		return command;
+	}
+
+	// --- Journal ------------------------------------------------------------
+
+	void Journal::setMeta(const std::string& key, const std::string& value) {
+		for (auto& [k, v] : meta) {
+			if (k == key) {
+				v = value;
+				return;
+			}
+		}
+		meta.emplace_back(key, value);
+	}
+
+	std::string Journal::metaValue(const std::string& key, const std::string& fallback) const {
+		for (const auto& [k, v] : meta) {
+			if (k == key) {
+				return v;
+			}
+		}
+		return fallback;
+	}
+
+	void Journal::recordHashes(uint64_t tick, const std::vector<save::StateHash>& state) {
+		if (parts.empty()) {
+			parts.reserve(state.size());
+			for (const auto& part : state) {
+				parts.emplace_back(part.name);
+			}
+		}
+		TickHashes& entry = ticks.emplace_back(TickHashes{tick, {}});
+		entry.hashes.reserve(state.size());
+		for (const auto& part : state) {
+			entry.hashes.push_back(part.hash);
+		}
+	}
+
+	std::optional<Divergence> Journal::compare(size_t index, const std::vector<save::StateHash>& state) const {
+		const TickHashes& recorded = ticks[index];
+		const size_t	  count = std::max(parts.size(), state.size());
+		for (size_t i = 0; i < count; ++i) {
+			const bool		  haveRecorded = i < parts.size() && i < recorded.hashes.size();
+			const bool		  haveActual = i < state.size();
+			const std::string part = haveRecorded ? parts[i] : state[i].name;
+			if (haveRecorded && haveActual && part == state[i].name && recorded.hashes[i] == state[i].hash) {
+				continue;
+			}
+			return Divergence{
+				recorded.tick,
+				part,
+				haveRecorded ? recorded.hashes[i] : 0,
+				haveActual ? state[i].hash : 0,
+			};
+		}
+		return std::nullopt;
+	}
+
+	// --- Serialization ------------------------------------------------------
+
+	bool writeJournal(const Journal& journal, std::ostream& out) {
+		json meta = json::object();
+		for (const auto& [key, value] : journal.meta) {
+			meta[key] = value;
+		}
+
+		json commands = json::array();
+		for (const auto& command : journal.commands) {
+			json params = json::object();
+			for (const auto& [key, value] : command.params) {
+				params[key] = value;
+			}
+			commands.push_back({{"tick", command.tick}, {"verb", command.verb}, {"params", std::move(params)}});
+		}
+
+		json hashes = json::array();
+		for (const auto& entry : journal.ticks) {
+			json row = json::array();
+			row.push_back(entry.tick);
+			for (uint64_t hash : entry.hashes) {
+				row.push_back(hash);
+			}
+			hashes.push_back(std::move(row));
+		}
+
+		const json doc = {
+			{"format", kFormat},
+			{"version", Journal::kVersion},
+			{"meta", std::move(meta)},
+			{"parts", journal.parts},
+			{"commands", std::move(commands)},
+			{"hashes", std::move(hashes)},
+		};
+		out << doc.dump() << "\n";
+		return static_cast<bool>(out);
+	}
+
+	bool writeJournal(const Journal& journal, const std::filesystem::path& path) {
+		std::ofstream out(path);
+		if (!out || !writeJournal(journal, out)) {
+			LOG_ERROR(Engine, "writeJournal: cannot write %s", path.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	bool readJournal(std::istream& in, Journal& journal, std::string& error) {
+		const json doc = json::parse(in, nullptr, /*allow_exceptions=*/false);
+		if (doc.is_discarded() || !doc.is_object() || doc.value("format", "") != kFormat) {
+			error = "not a journal";
+			return false;
+		}
+		if (doc.value("version", 0U) != Journal::kVersion) {
+			error = "unsupported journal version";
+			return false;
+		}
+
+		Journal loaded;
+		if (doc.contains("meta") && !readStringMap(doc["meta"], loaded.meta)) {
+			error = "bad meta";
+			return false;
+		}
+
+		const json& parts = doc.value("parts", json::array());
+		for (const auto& part : parts) {
+			if (!part.is_string()) {
+				error = "bad parts";
+				return false;
+			}
+			loaded.parts.push_back(part.get<std::string>());
+		}
+
+		for (const auto& entry : doc.value("commands", json::array())) {
+			Command command;
+			if (!entry.is_object() || !entry.contains("tick") || !entry["tick"].is_number_unsigned() ||
+				!entry.contains("verb") || !entry["verb"].is_string() ||
+				(entry.contains("params") && !readStringMap(entry["params"], command.params))) {
+				error = "bad command";
+				return false;
+			}
+			command.tick = entry["tick"].get<uint64_t>();
+			command.verb = entry["verb"].get<std::string>();
+			if (!loaded.commands.empty() && command.tick < loaded.commands.back().tick) {
+				error = "commands out of tick order";
+				return false;
+			}
+			loaded.commands.push_back(std::move(command));
+		}
+
+		for (const auto& row : doc.value("hashes", json::array())) {
+			if (!row.is_array() || row.size() != parts.size() + 1) {
+				error = "bad hash row";
+				return false;
+			}
+			TickHashes entry;
+			entry.hashes.reserve(parts.size());
+			for (size_t i = 0; i < row.size(); ++i) {
+				if (!row[i].is_number_unsigned()) {
+					error = "bad hash row";
+					return false;
+				}
+				if (i == 0) {
+					entry.tick = row[i].get<uint64_t>();
+				} else {
+					entry.hashes.push_back(row[i].get<uint64_t>());
+				}
+			}
+			loaded.ticks.push_back(std::move(entry));
+		}
+
+		journal = std::move(loaded);
+		return true;
+	}
+
+	bool readJournal(const std::filesystem::path& path, Journal& journal, std::string& error) {
+		std::ifstream in(path);
+		if (!in) {
+			error = "cannot open " + path.string();
+			return false;
+		}
+		return readJournal(in, journal, error);
+	}
+
+} // namespace engine::replay
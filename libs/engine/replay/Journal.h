@@ -0,0 +1,100 @@
+#pragma once
+
+// Simulation input journal ("wsjournal"), version 1.
+//
+// A journal pins down one headless run: the scenario it was built from (world
+// and RNG seeds, colony size, timestep) as `meta`, every input applied to the
+// simulation with the tick it landed on, and a state hash per tick (see
+// save::hashState). Replaying re-executes the inputs against a fresh harness
+// and compares hashes tick by tick; the first mismatch names the tick and the
+// component pool where the runs diverged.
+//
+// Inputs use DevCommand's verb/params shape (debug/DebugServer.h), so a command
+// recorded here is the same thing the /api/dev endpoint would have received.
+// Commands apply at the start of their tick, before the simulation steps.
+//
+// Stored as JSON:
+//   { "format": "wsjournal", "version": 1,
+//     "meta":     { "<key>": "<value>", ... },
+//     "parts":    [ "<StateHash name>", ... ],
+//     "commands": [ { "tick": n, "verb": "...", "params": { "<key>": "<value>" } }, ... ],
+//     "hashes":   [ [ tick, hash per part... ], ... ] }
+
+#include <save/SaveGame.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace engine::replay {
+
+	/// One recorded input, applied at the start of `tick`.
+	struct Command {
+		uint64_t										 tick = 0;
+		std::string										 verb;
+		std::vector<std::pair<std::string, std::string>> params;
+
+		/// Look up a param by key, returning fallback if not present
+		[[nodiscard]] std::string param(const std::string& key, const std::string& fallback = "") const;
+
+		/// True if `key` is present
+		[[nodiscard]] bool hasParam(const std::string& key) const;
+
+		/// "<tick> <verb> key=value ...", the form parseCommand() reads
+		[[nodiscard]] std::string toString() const;
+	};
+
+	/// Parse "<tick> <verb> key=value ..." (whitespace separated). Returns nullopt
+	/// if the tick or verb is missing or a param has no '='.
+	[[nodiscard]] std::optional<Command> parseCommand(const std::string& text);
+
+	/// State hashes for one tick, parallel to Journal::parts.
+	struct TickHashes {
+		uint64_t			  tick = 0;
+		std::vector<uint64_t> hashes;
+	};
+
+	struct Divergence {
+		uint64_t	tick = 0;
+		std::string part; // StateHash name, e.g. "Position"
+		uint64_t	expected = 0;
+		uint64_t	actual = 0;
+	};
+
+	struct Journal {
+		static constexpr uint32_t kVersion = 1;
+
+		std::vector<std::pair<std::string, std::string>> meta;	   // scenario settings, in insertion order
+		std::vector<std::string>						 parts;	   // hashed state parts, fixed order
+		std::vector<Command>							 commands; // ascending tick
+		std::vector<TickHashes>							 ticks;	   // ascending tick
+
+		void setMeta(const std::string& key, const std::string& value);
+		[[nodiscard]] std::string metaValue(const std::string& key, const std::string& fallback = "") const;
+
+		/// Append the hashes taken after `tick`. The first call fixes `parts`.
+		void recordHashes(uint64_t tick, const std::vector<save::StateHash>& state);
+
+		/// Compare a replayed tick against the recorded entry `index`. Returns the first
+		/// part that differs (in `parts` order), or nullopt if the tick matches. A
+		/// replay whose parts don't line up with the recording diverges at that part.
+		[[nodiscard]] std::optional<Divergence> compare(size_t index, const std::vector<save::StateHash>& state) const;
+	};
+
+	/// Serialize to JSON. Returns false if the stream fails.
+	bool writeJournal(const Journal& journal, std::ostream& out);
+
+	/// Write to `path`. Logs and returns false on failure.
+	bool writeJournal(const Journal& journal, const std::filesystem::path& path);
+
+	/// Parse a journal. Returns false with `error` set if it isn't a readable
+	/// version-1 journal.
+	bool readJournal(std::istream& in, Journal& journal, std::string& error);
+
+	bool readJournal(const std::filesystem::path& path, Journal& journal, std::string& error);
+
+} // namespace engine::replay
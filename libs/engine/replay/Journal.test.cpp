@@ -0,0 +1,84 @@
+// Journal: command text parses and prints back, a journal survives a JSON round
+// trip, and compare() names the first part whose hash moved.
+
+#include "Journal.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+namespace engine::replay {
+namespace {
+
+std::vector<save::StateHash> state(uint64_t position, uint64_t needs) {
+	return {{1, "Position", position}, {2, "NeedsComponent", needs}};
+}
+
+TEST(JournalTest, ParsesCommandText) {
+	const auto command = parseCommand("120 need colonist=Ada need=hunger value=10");
+	ASSERT_TRUE(command.has_value());
+	EXPECT_EQ(command->tick, 120U);
+	EXPECT_EQ(command->verb, "need");
+	EXPECT_EQ(command->param("need"), "hunger");
+	EXPECT_EQ(command->param("missing", "x"), "x");
+	EXPECT_EQ(command->toString(), "120 need colonist=Ada need=hunger value=10");
+
+	EXPECT_FALSE(parseCommand("need colonist=Ada").has_value()) << "no tick";
+	EXPECT_FALSE(parseCommand("12").has_value()) << "no verb";
+	EXPECT_FALSE(parseCommand("12 kill Ada").has_value()) << "param without '='";
+}
+
+TEST(JournalTest, RoundTripsThroughJson) {
+	Journal journal;
+	journal.setMeta("aiSeed", "42");
+	journal.setMeta("dt", "0.0166666675");
+	journal.setMeta("aiSeed", "7");
+	journal.commands.push_back(*parseCommand("3 time speed=4"));
+	journal.commands.push_back(*parseCommand("9 kill colonist=Bob"));
+	journal.recordHashes(0, state(11, 22));
+	journal.recordHashes(1, state(0xFFFFFFFFFFFFFFFFULL, 23));
+
+	std::stringstream buffer;
+	ASSERT_TRUE(writeJournal(journal, buffer));
+
+	Journal		loaded;
+	std::string error;
+	ASSERT_TRUE(readJournal(buffer, loaded, error)) << error;
+	EXPECT_EQ(loaded.meta.size(), 2U);
+	EXPECT_EQ(loaded.metaValue("aiSeed"), "7");
+	EXPECT_EQ(loaded.parts, (std::vector<std::string>{"Position", "NeedsComponent"}));
+	ASSERT_EQ(loaded.commands.size(), 2U);
+	EXPECT_EQ(loaded.commands[1].toString(), "9 kill colonist=Bob");
+	ASSERT_EQ(loaded.ticks.size(), 2U);
+	EXPECT_EQ(loaded.ticks[1].tick, 1U);
+	EXPECT_EQ(loaded.ticks[1].hashes[0], 0xFFFFFFFFFFFFFFFFULL) << "64-bit hashes survive JSON";
+
+	std::istringstream foreign("{\"format\": \"other\"}");
+	EXPECT_FALSE(readJournal(foreign, loaded, error));
+}
+
+TEST(JournalTest, CompareReportsFirstDivergentPart) {
+	Journal journal;
+	journal.recordHashes(5, state(11, 22));
+
+	EXPECT_FALSE(journal.compare(0, state(11, 22)).has_value());
+
+	const auto moved = journal.compare(0, state(11, 99));
+	ASSERT_TRUE(moved.has_value());
+	EXPECT_EQ(moved->tick, 5U);
+	EXPECT_EQ(moved->part, "NeedsComponent");
+	EXPECT_EQ(moved->expected, 22U);
+	EXPECT_EQ(moved->actual, 99U);
+
+	const auto both = journal.compare(0, state(12, 99));
+	ASSERT_TRUE(both.has_value());
+	EXPECT_EQ(both->part, "Position") << "earliest part in hash order wins";
+
+	const auto missing = journal.compare(0, {{1, "Position", 11}});
+	ASSERT_TRUE(missing.has_value()) << "a part the replay no longer hashes is a divergence";
+	EXPECT_EQ(missing->part, "NeedsComponent");
+}
+
+}  // namespace
+}  // namespace engine::replay
@@ -0,0 +1,198 @@
+#include "SimCommands.h"
+
+#include <ecs/World.h>
+#include <ecs/components/Movement.h>
+#include <ecs/components/Needs.h>
+#include <ecs/components/Transform.h>
+#include <ecs/systems/ConstructionSystem.h>
+#include <ecs/systems/NavigationSystem.h>
+#include <ecs/systems/TimeSystem.h>
+
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+namespace engine::replay {
+
+	namespace {
+
+		SimCommandResult applied(std::string message) {
+			return SimCommandResult{true, true, std::move(message)};
+		}
+
+		SimCommandResult refused(std::string message) {
+			return SimCommandResult{true, false, std::move(message)};
+		}
+
+		std::string entityLabel(ecs::EntityID id) {
+			return "#" + std::to_string(static_cast<unsigned long long>(id));
+		}
+
+		ecs::EntityID parseEntity(const std::string& spec) {
+			return static_cast<ecs::EntityID>(std::strtoull(spec.c_str(), nullptr, 10));
+		}
+
+		/// "x,y"; false unless both halves parse.
+		bool parsePoint(const std::string& spec, glm::vec2& out) {
+			const auto comma = spec.find(',');
+			if (comma == std::string::npos) {
+				return false;
+			}
+			char*		endX = nullptr;
+			char*		endY = nullptr;
+			const float x = std::strtof(spec.c_str(), &endX);
+			const float y = std::strtof(spec.c_str() + comma + 1, &endY);
+			if (endX == spec.c_str() || endY == spec.c_str() + comma + 1) {
+				return false;
+			}
+			out = {x, y};
+			return true;
+		}
+
+		bool parseNeedType(const std::string& name, ecs::NeedType& out) {
+			for (size_t i = 0; i < ecs::kNeedLabels.size(); ++i) {
+				const std::string label = ecs::kNeedLabels[i];
+				const bool		  same = std::equal(name.begin(), name.end(), label.begin(), label.end(), [](char a, char b) {
+					 return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+				 });
+				if (same) {
+					out = static_cast<ecs::NeedType>(i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// "h" or "h:mm" as fractional hours.
+		float parseClock(const std::string& spec) {
+			const float h = std::strtof(spec.c_str(), nullptr);
+			const auto	colon = spec.find(':');
+			return colon == std::string::npos ? h : h + std::strtof(spec.c_str() + colon + 1, nullptr) / 60.0F;
+		}
+
+		/// Game minutes; an 'h' suffix means hours.
+		float parseDuration(const std::string& spec) {
+			char*		end = nullptr;
+			const float v = std::strtof(spec.c_str(), &end);
+			return end != nullptr && (*end == 'h' || *end == 'H') ? v * 60.0F : v;
+		}
+
+		SimCommandResult applyNeed(ecs::World& world, const Command& command) {
+			const ecs::EntityID id = parseEntity(command.param("colonist"));
+			auto*				needs = world.getComponent<ecs::NeedsComponent>(id);
+			if (needs == nullptr) {
+				return refused("need: no colonist " + entityLabel(id));
+			}
+			ecs::NeedType type{};
+			if (!parseNeedType(command.param("need"), type)) {
+				return refused("need: unknown need '" + command.param("need") + "'");
+			}
+			const float value = std::clamp(std::strtof(command.param("value", "100").c_str(), nullptr), 0.0F, 100.0F);
+			needs->get(type).value = value;
+
+			char summary[64];
+			std::snprintf(summary, sizeof(summary), "%s=%.1f", ecs::needLabel(type), static_cast<double>(value));
+			return applied("need: " + std::string(summary) + " on " + entityLabel(id));
+		}
+
+		SimCommandResult applyTime(ecs::World& world, const Command& command) {
+			auto* timeSystem = world.tryGetSystem<ecs::TimeSystem>();
+			if (timeSystem == nullptr) {
+				return refused("time: no TimeSystem");
+			}
+			if (!command.hasParam("speed") && !command.hasParam("set") && !command.hasParam("skip")) {
+				return refused("time: needs speed, set or skip");
+			}
+			// Speed is checked first, so a bad one refuses the command before set/skip apply
+			if (command.hasParam("speed")) {
+				const long speed = std::strtol(command.param("speed").c_str(), nullptr, 10);
+				if (speed < 0 || speed > static_cast<long>(ecs::GameSpeed::Max)) {
+					return refused("time: speed must be 0..4");
+				}
+				timeSystem->setSpeed(static_cast<ecs::GameSpeed>(speed));
+			}
+			if (command.hasParam("set")) {
+				timeSystem->setTimeOfDay(parseClock(command.param("set")));
+			}
+			if (command.hasParam("skip")) {
+				timeSystem->skipTime(parseDuration(command.param("skip")));
+			}
+
+			const auto snap = timeSystem->snapshot();
+			char	   summary[64];
+			std::snprintf(
+				summary, sizeof(summary), "time: day %d, %.2fh, speed %d", snap.day, static_cast<double>(snap.timeOfDay), static_cast<int>(snap.speed)
+			);
+			return applied(summary);
+		}
+
+		SimCommandResult applyTeleport(ecs::World& world, const Command& command) {
+			const ecs::EntityID id = parseEntity(command.param("colonist"));
+			auto*				pos = world.getComponent<ecs::Position>(id);
+			if (pos == nullptr) {
+				return refused("teleport: no entity " + entityLabel(id));
+			}
+			glm::vec2 to{0.0F, 0.0F};
+			if (!parsePoint(command.param("to"), to)) {
+				return refused("teleport: needs to=x,y");
+			}
+			// Same gate as every placing dev verb: an active walkable nav face
+			const auto* navigation = world.tryGetSystem<ecs::NavigationSystem>();
+			if (navigation == nullptr || !navigation->isValidPosition(to)) {
+				return refused("teleport: target is not on the walkable nav mesh");
+			}
+			pos->value = to;
+			if (auto* target = world.getComponent<ecs::MovementTarget>(id)) {
+				target->active = false;
+			}
+			if (auto* velocity = world.getComponent<ecs::Velocity>(id)) {
+				velocity->value = {0.0F, 0.0F};
+			}
+			return applied("teleport: " + entityLabel(id) + " moved");
+		}
+
+		SimCommandResult applyKill(ecs::World& world, const Command& command) {
+			const ecs::EntityID id = parseEntity(command.param("colonist"));
+			if (!world.isAlive(id)) {
+				return refused("kill: no entity " + entityLabel(id));
+			}
+			world.destroyEntity(id);
+			return applied("kill: removed " + entityLabel(id));
+		}
+
+		SimCommandResult applyComplete(ecs::World& world, const Command& command) {
+			const ecs::EntityID id = parseEntity(command.param("id"));
+			auto*				construction = world.tryGetSystem<ecs::ConstructionSystem>();
+			if (construction == nullptr || !construction->forceCompleteBlueprint(id)) {
+				return refused("complete: " + entityLabel(id) + " is not a buildable blueprint");
+			}
+			return applied("complete: built blueprint " + entityLabel(id));
+		}
+
+	} // namespace
+
+	SimCommandResult applySimCommand(ecs::World& world, const Command& command) {
+		const std::string& verb = command.verb;
+		if (verb == "need") {
+			return applyNeed(world, command);
+		}
+		if (verb == "time") {
+			return applyTime(world, command);
+		}
+		if (verb == "teleport") {
+			return applyTeleport(world, command);
+		}
+		if (verb == "kill") {
+			return applyKill(world, command);
+		}
+		if (verb == "complete") {
+			return applyComplete(world, command);
+		}
+		return SimCommandResult{false, false, "unsupported verb '" + verb + "'"};
+	}
+
+} // namespace engine::replay
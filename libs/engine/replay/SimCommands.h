@@ -0,0 +1,35 @@
+#pragma once
+
+// Simulation-side dev verbs, shared by the live game (DevCommandHandler behind
+// /api/dev) and headless replays (sim-bench's SimHarness), so a journaled command
+// does exactly what the endpoint did when it was recorded.
+//
+//   need      colonist=<id> need=<label> [value=0..100, default 100]
+//   time      [speed=0..4] [set=<h[:mm]>] [skip=<minutes, or Nh>]
+//   teleport  colonist=<id> to=<x,y>   (the target must be on the walkable nav mesh)
+//   kill      colonist=<id>
+//   complete  id=<blueprint entity>
+//
+// Verbs that need the scene (selection, UI, placement tools) stay in the app.
+
+#include "Journal.h"
+
+#include <string>
+
+namespace ecs {
+	class World;
+}
+
+namespace engine::replay {
+
+	struct SimCommandResult {
+		bool		handled = false; ///< the verb is one of the above
+		bool		ok = false;		 ///< applied; otherwise nothing changed and `message` says why
+		std::string message;		 ///< one-line summary for logs and dev toasts
+	};
+
+	/// Apply one simulation verb between ticks. Unknown verbs come back with
+	/// handled == false so the caller can try its own.
+	SimCommandResult applySimCommand(ecs::World& world, const Command& command);
+
+} // namespace engine::replay
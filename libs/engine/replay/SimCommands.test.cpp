@@ -0,0 +1,74 @@
+// SimCommands: the shared need/time/kill verbs apply to a bare world, refuse bad
+// params without changing anything, and leave unknown verbs to the caller.
+
+#include "SimCommands.h"
+
+#include <ecs/World.h>
+#include <ecs/components/Needs.h>
+#include <ecs/systems/TimeSystem.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace engine::replay {
+namespace {
+
+Command command(const std::string& text) {
+	auto parsed = parseCommand("0 " + text);
+	EXPECT_TRUE(parsed.has_value()) << text;
+	return parsed.value_or(Command{});
+}
+
+TEST(SimCommandsTest, NeedSetsAndClampsTheValue) {
+	ecs::World	  world;
+	ecs::EntityID colonist = world.createEntity();
+	world.addComponent<ecs::NeedsComponent>(colonist);
+	const std::string id = std::to_string(static_cast<unsigned long long>(colonist));
+
+	SimCommandResult result = applySimCommand(world, command("need colonist=" + id + " need=HUNGER value=150"));
+	EXPECT_TRUE(result.handled);
+	EXPECT_TRUE(result.ok) << result.message;
+	EXPECT_FLOAT_EQ(world.getComponent<ecs::NeedsComponent>(colonist)->get(ecs::NeedType::Hunger).value, 100.0F);
+
+	result = applySimCommand(world, command("need colonist=" + id + " need=boredom"));
+	EXPECT_FALSE(result.ok);
+	EXPECT_NE(result.message.find("unknown need"), std::string::npos) << result.message;
+}
+
+TEST(SimCommandsTest, TimeRefusesABadSpeedBeforeApplyingAnything) {
+	ecs::World world;
+	auto&	   time = world.registerSystem<ecs::TimeSystem>();
+	const auto before = time.snapshot();
+
+	const SimCommandResult result = applySimCommand(world, command("time speed=9 set=6"));
+	EXPECT_FALSE(result.ok);
+	EXPECT_EQ(time.snapshot().speed, before.speed);
+	EXPECT_FLOAT_EQ(time.snapshot().timeOfDay, before.timeOfDay);
+
+	EXPECT_TRUE(applySimCommand(world, command("time speed=2 set=6:30")).ok);
+	EXPECT_EQ(time.snapshot().speed, ecs::GameSpeed::Fast);
+	EXPECT_FLOAT_EQ(time.snapshot().timeOfDay, 6.5F);
+
+	EXPECT_FALSE(applySimCommand(world, command("time")).ok) << "no speed, set or skip";
+}
+
+TEST(SimCommandsTest, KillRemovesOnlyLiveEntities) {
+	ecs::World		  world;
+	ecs::EntityID	  colonist = world.createEntity();
+	const std::string id = std::to_string(static_cast<unsigned long long>(colonist));
+
+	EXPECT_TRUE(applySimCommand(world, command("kill colonist=" + id)).ok);
+	EXPECT_FALSE(world.isAlive(colonist));
+	EXPECT_FALSE(applySimCommand(world, command("kill colonist=" + id)).ok);
+}
+
+TEST(SimCommandsTest, UnknownVerbIsLeftToTheCaller) {
+	ecs::World			   world;
+	const SimCommandResult result = applySimCommand(world, command("select colonist=1"));
+	EXPECT_FALSE(result.handled);
+	EXPECT_FALSE(result.ok);
+}
+
+}  // namespace
+}  // namespace engine::replay
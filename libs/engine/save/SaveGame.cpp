@@ -0,0 +1,1845 @@
+#include "SaveGame.h"
+
+#include <assets/AssetRegistry.h>
+#include <assets/placement/PlacementExecutor.h>
+#include <ecs/GoalTaskRegistry.h>
+#include <ecs/World.h>
+#include <ecs/components/Action.h>
+#include <ecs/components/AgentRadius.h>
+#include <ecs/components/AnimationState.h>
+#include <ecs/components/Appearance.h>
+#include <ecs/components/Attributes.h>
+#include <ecs/components/Colonist.h>
+#include <ecs/components/Colony.h>
+#include <ecs/components/DecisionTrace.h>
+#include <ecs/components/FacingDirection.h>
+#include <ecs/components/Inventory.h>
+#include <ecs/components/Knowledge.h>
+#include <ecs/components/Memory.h>
+#include <ecs/components/Movement.h>
+#include <ecs/components/Needs.h>
+#include <ecs/components/Packaged.h>
+#include <ecs/components/PlayerControlled.h>
+#include <ecs/components/ResourceStack.h>
+#include <ecs/components/Room.h>
+#include <ecs/components/Skills.h>
+#include <ecs/components/StorageConfiguration.h>
+#include <ecs/components/Structure.h>
+#include <ecs/components/StructureBlueprint.h>
+#include <ecs/components/StructureHealth.h>
+#include <ecs/components/Task.h>
+#include <ecs/components/Transform.h>
+#include <ecs/components/WorkQueue.h>
+#include <ecs/systems/TimeSystem.h>
+#include <threading/JobSystem.h>
+#include <utils/Log.h>
+#include <utils/WorldHash.h>
+
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+
+static_assert(std::endian::native == std::endian::little,
+	"Save file format is little-endian; big-endian targets are unsupported");
+static_assert(std::numeric_limits<float>::is_iec559 && sizeof(float) == 4,
+	"Save file format requires IEEE-754 binary32 float");
+
+namespace engine::save {
+
+	namespace {
+
+		constexpr char	   kMagic[4] = {'W', 'S', 'S', 'V'};
+		constexpr uint32_t kFormatVersion = 1;
+
+		constexpr uint32_t fourcc(const char (&id)[5]) {
+			return static_cast<uint32_t>(static_cast<uint8_t>(id[0])) | (static_cast<uint32_t>(static_cast<uint8_t>(id[1])) << 8) |
+				   (static_cast<uint32_t>(static_cast<uint8_t>(id[2])) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(id[3])) << 24);
+		}
+
+		constexpr uint32_t kStringsSection = fourcc("STRS");
+		constexpr uint32_t kDefsSection = fourcc("DEFS");
+		constexpr uint32_t kTimeSection = fourcc("TIME");
+		constexpr uint32_t kEntitiesSection = fourcc("ENTS");
+		constexpr uint32_t kPoolSection = fourcc("POOL");
+		constexpr uint32_t kConstructionSection = fourcc("CNST");
+		constexpr uint32_t kGoalsSection = fourcc("GOAL");
+		constexpr uint32_t kCooldownsSection = fourcc("CDWN");
+
+		// Directory sanity limits; anything larger is a corrupt or hostile file.
+		constexpr uint32_t kMaxSections = 4096;
+		constexpr uint64_t kMaxSectionBytes = 1ULL << 31;
+
+		std::string sectionName(uint32_t id) {
+			std::string name(4, '?');
+			for (size_t i = 0; i < 4; ++i) {
+				const char c = static_cast<char>((id >> (8 * i)) & 0xFF);
+				name[i] = (c >= 0x20 && c < 0x7F) ? c : '?';
+			}
+			return name;
+		}
+
+		float millisecondsSince(std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// --- Byte buffers ---------------------------------------------------
+
+		struct Writer {
+			std::vector<uint8_t>& out;
+
+			template <typename T>
+			void scalar(T v) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				bytes(&v, sizeof(T));
+			}
+
+			void bytes(const void* data, size_t len) {
+				const size_t at = out.size();
+				out.resize(at + len);
+				if (len > 0) {
+					std::memcpy(out.data() + at, data, len);
+				}
+			}
+
+			template <typename T>
+			void span(const std::vector<T>& v) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				bytes(v.data(), v.size() * sizeof(T));
+			}
+		};
+
+		// Bounds-checked: reading past the end marks the reader failed and yields zeros,
+		// so a truncated or corrupt section can't run off the buffer.
+		struct Reader {
+			const uint8_t* data = nullptr;
+			size_t		   size = 0;
+			size_t		   pos = 0;
+			bool		   failed = false;
+
+			template <typename T>
+			void scalar(T& v) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				bytes(&v, sizeof(T));
+			}
+
+			void bytes(void* out, size_t len) {
+				if (failed || len > size - pos) {
+					failed = true;
+					std::memset(out, 0, len);
+					return;
+				}
+				if (len > 0) {
+					std::memcpy(out, data + pos, len);
+				}
+				pos += len;
+			}
+
+			template <typename T>
+			void span(std::vector<T>& v) {
+				static_assert(std::is_trivially_copyable_v<T>);
+				bytes(v.data(), v.size() * sizeof(T));
+			}
+
+			[[nodiscard]] size_t remaining() const { return size - pos; }
+			[[nodiscard]] bool	 good() const { return !failed; }
+		};
+
+		// --- String and def-id tables ---------------------------------------
+
+		class StringTable {
+		  public:
+			uint32_t intern(const std::string& value) {
+				auto [it, inserted] = index.try_emplace(value, static_cast<uint32_t>(strings.size()));
+				if (inserted) {
+					strings.push_back(&it->first); // map nodes don't move on rehash
+				}
+				return it->second;
+			}
+
+			[[nodiscard]] const std::vector<const std::string*>& all() const { return strings; }
+
+		  private:
+			std::unordered_map<std::string, uint32_t> index;
+			std::vector<const std::string*>			  strings;
+		};
+
+		// Runtime defName id -> file id. File id i + 1 names runtimeIds[i]; 0 stays 0.
+		class DefTable {
+		  public:
+			uint32_t intern(uint32_t runtimeId) {
+				if (runtimeId == 0) {
+					return 0;
+				}
+				auto [it, inserted] = index.try_emplace(runtimeId, static_cast<uint32_t>(runtimeIds.size() + 1));
+				if (inserted) {
+					runtimeIds.push_back(runtimeId);
+				}
+				return it->second;
+			}
+
+			[[nodiscard]] const std::vector<uint32_t>& all() const { return runtimeIds; }
+
+		  private:
+			std::unordered_map<uint32_t, uint32_t> index;
+			std::vector<uint32_t>				   runtimeIds;
+		};
+
+		struct LoadTables {
+			std::vector<std::string> strings;
+			std::vector<uint32_t>	 defs{0}; // file id -> runtime id
+		};
+
+		// --- Type traits for the generic column encoding --------------------
+
+		template <typename T>
+		struct IsOptional : std::false_type {};
+		template <typename T>
+		struct IsOptional<std::optional<T>> : std::true_type {};
+
+		template <typename T>
+		struct IsVector : std::false_type {};
+		template <typename T, typename A>
+		struct IsVector<std::vector<T, A>> : std::true_type {};
+
+		template <typename T>
+		struct IsArray : std::false_type {};
+		template <typename T, size_t N>
+		struct IsArray<std::array<T, N>> : std::true_type {};
+
+		template <typename T>
+		struct IsPair : std::false_type {};
+		template <typename A, typename B>
+		struct IsPair<std::pair<A, B>> : std::true_type {};
+
+		template <typename T>
+		struct IsVariant : std::false_type {};
+		template <typename... Ts>
+		struct IsVariant<std::variant<Ts...>> : std::true_type {};
+
+		template <typename T>
+		struct IsUnorderedSet : std::false_type {};
+		template <typename T, typename H, typename E, typename A>
+		struct IsUnorderedSet<std::unordered_set<T, H, E, A>> : std::true_type {};
+
+		template <typename T>
+		struct IsUnorderedMap : std::false_type {};
+		template <typename K, typename V, typename H, typename E, typename A>
+		struct IsUnorderedMap<std::unordered_map<K, V, H, E, A>> : std::true_type {};
+
+		template <typename V, size_t... I>
+		void emplaceAlternative(V& variant, size_t index, std::index_sequence<I...> /*unused*/) {
+			((index == I ? (variant.template emplace<I>(), true) : false) || ...);
+		}
+
+		// --- Aggregate fields -----------------------------------------------
+		//
+		// One description per record type, shared by the Encoder and Decoder so the
+		// two directions can't drift apart. Field order is the file order.
+
+		template <typename Io>
+		void fields(Io& /*io*/, std::monostate& /*unused*/) {}
+
+		template <typename Io>
+		void fields(Io& io, geometry::Vec2i64& v) {
+			io(v.x);
+			io(v.y);
+		}
+
+		template <typename Io>
+		void fields(Io& io, engine::world::ChunkCoordinate& c) {
+			io(c.x);
+			io(c.y);
+		}
+
+		// Item ids (stacks, hauls, action payloads) keep their defName as a string rather than a
+		// DEFS entry: an item may have no definition (DEFS would map it to 0), and the name is
+		// re-interned on load.
+		template <typename Io, typename Id>
+		void itemDef(Io& io, Id& defNameId) {
+			std::string defName;
+			if constexpr (!Io::kReading) {
+				defName = engine::assets::AssetRegistry::Get().getDefName(defNameId);
+			}
+			io(defName);
+			if constexpr (Io::kReading) {
+				defNameId = engine::assets::AssetRegistry::Get().internDefName(defName);
+			}
+		}
+
+		/// (item id, count) pairs, laid out like a vector of (string, uint32) pairs
+		template <typename Io>
+		void itemCounts(Io& io, std::vector<std::pair<uint32_t, uint32_t>>& counts) {
+			if constexpr (Io::kReading) {
+				counts.clear();
+				counts.resize(io.count());
+			} else {
+				io.count(counts.size());
+			}
+			for (auto& [defNameId, count] : counts) {
+				itemDef(io, defNameId);
+				io(count);
+			}
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::ItemStack& stack) {
+			itemDef(io, stack.defNameId);
+			io(stack.quantity);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::Need& need) {
+			io(need.value);
+			io(need.decayRate);
+			io(need.seekThreshold);
+			io(need.criticalThreshold);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::StorageRule& rule) {
+			io(rule.defName);
+			io(rule.category);
+			io(rule.priority);
+			io(rule.minAmount);
+			io(rule.maxAmount);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::CraftingJob& job) {
+			io(job.recipeDefName);
+			io(job.quantity);
+			io(job.completed);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::KnownDynamicEntity& known) {
+			io(known.entityId);
+			io(known.lastKnownPosition);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::NeedEffect& effect) {
+			io(effect.need);
+			io(effect.restoreAmount);
+			io(effect.sideEffectNeed);
+			io(effect.sideEffectAmount);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::CollectionEffect& effect) {
+			itemDef(io, effect.itemDefNameId);
+			io(effect.quantity);
+			io(effect.sourcePosition);
+			io(effect.sourceDefName);
+			io(effect.destroySource);
+			io(effect.regrowthTime);
+			io(effect.sourceStorageId);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::ConsumptionEffect& effect) {
+			itemDef(io, effect.itemDefNameId);
+			io(effect.quantity);
+			io(effect.need);
+			io(effect.restoreAmount);
+			io(effect.sideEffectNeed);
+			io(effect.sideEffectAmount);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::ProgressEffect& effect) {
+			io(effect.targetEntityId);
+			io(effect.skillLevel);
+			io(effect.deconstruct);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::SpawnEffect& effect) {
+			io(effect.position);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::CraftingEffect& effect) {
+			io(effect.recipeDefName);
+			io(effect.stationEntityId);
+			itemCounts(io, effect.inputs);
+			itemCounts(io, effect.outputs);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::DepositEffect& effect) {
+			itemDef(io, effect.itemDefNameId);
+			io(effect.quantity);
+			io(effect.storageEntityId);
+			io(effect.deliverToCraftStation);
+		}
+
+		template <typename Io>
+		void fields(Io& io, ecs::PlacePackagedEffect& effect) {
+			io(effect.packagedEntityId);
+			io(effect.targetPosition);
+		}
+
+		template <typename Io>
+		void fields(Io& io, construction::Foundation& foundation) {
+			io(foundation.id);
+			io(foundation.ring);
+			io(foundation.material);
+			io(foundation.state);
+			io(foundation.entity);
+		}
+
+		template <typename Io>
+		void fields(Io& io, construction::Vertex& vertex) {
+			io(vertex.id);
+			io(vertex.pos);
+			io(vertex.segments);
+		}
+
+		template <typename Io>
+		void fields(Io& io, construction::WallSegment& segment) {
+			io(segment.id);
+			io(segment.v0);
+			io(segment.v1);
+			io(segment.material);
+			io(segment.thicknessPreset);
+			io(segment.hostFoundation);
+			io(segment.state);
+			io(segment.entity);
+		}
+
+		template <typename Io>
+		void fields(Io& io, construction::Opening& opening) {
+			io(opening.id);
+			io(opening.segment);
+			io(opening.t);
+			io(opening.type);
+			io(opening.material);
+			io(opening.state);
+			io(opening.entity);
+		}
+
+		template <typename Io>
+		void fields(Io& io, assets::PlacementExecutor::CooldownRecord& record) {
+			io(record.coord);
+			io(record.tileX);
+			io(record.tileY);
+			io(record.defName);
+			io(record.remainingSeconds);
+		}
+
+		// --- Encoder / Decoder ----------------------------------------------
+
+		class Encoder {
+		  public:
+			static constexpr bool kReading = false;
+
+			Encoder(std::vector<uint8_t>& out, StringTable& strings, DefTable& defs)
+				: writer{out},
+				  stringTable(strings),
+				  defTable(defs) {}
+
+			template <typename T>
+			void operator()(const T& value) {
+				if constexpr (std::is_same_v<T, bool>) {
+					writer.scalar(static_cast<uint8_t>(value ? 1 : 0));
+				} else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+					writer.scalar(value);
+				} else if constexpr (std::is_same_v<T, std::string>) {
+					writer.scalar(stringTable.intern(value));
+				} else if constexpr (std::is_same_v<T, glm::vec2>) {
+					writer.scalar(value.x);
+					writer.scalar(value.y);
+				} else if constexpr (std::is_same_v<T, glm::vec4>) {
+					writer.scalar(value.x);
+					writer.scalar(value.y);
+					writer.scalar(value.z);
+					writer.scalar(value.w);
+				} else if constexpr (IsOptional<T>::value) {
+					(*this)(value.has_value());
+					if (value.has_value()) {
+						(*this)(*value);
+					}
+				} else if constexpr (IsVector<T>::value) {
+					count(value.size());
+					for (const auto& element : value) {
+						(*this)(element);
+					}
+				} else if constexpr (IsArray<T>::value) {
+					for (const auto& element : value) {
+						(*this)(element);
+					}
+				} else if constexpr (IsPair<T>::value) {
+					(*this)(value.first);
+					(*this)(value.second);
+				} else if constexpr (IsVariant<T>::value) {
+					writer.scalar(static_cast<uint8_t>(value.index()));
+					std::visit([this](const auto& alternative) { (*this)(alternative); }, value);
+				} else if constexpr (IsUnorderedSet<T>::value) {
+					std::vector<typename T::value_type> sorted(value.begin(), value.end());
+					std::sort(sorted.begin(), sorted.end());
+					(*this)(sorted);
+				} else if constexpr (IsUnorderedMap<T>::value) {
+					std::vector<const typename T::value_type*> entries;
+					entries.reserve(value.size());
+					for (const auto& entry : value) {
+						entries.push_back(&entry);
+					}
+					std::sort(entries.begin(), entries.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+					count(entries.size());
+					for (const auto* entry : entries) {
+						(*this)(entry->first);
+						(*this)(entry->second);
+					}
+				} else {
+					// fields() is shared with the Decoder, which writes through it; this side only reads.
+					fields(*this, const_cast<T&>(value));
+				}
+			}
+
+			void count(size_t n) { writer.scalar(static_cast<uint32_t>(n)); }
+
+			/// A defName id, stored as its index in the save's def-id table
+			void def(uint32_t runtimeId) { writer.scalar(defTable.intern(runtimeId)); }
+
+			/// A vector or set of defName ids (sets sorted, like every unordered container)
+			template <typename C>
+			void defList(const C& ids) {
+				std::vector<uint32_t> ordered(ids.begin(), ids.end());
+				if constexpr (IsUnorderedSet<C>::value) {
+					std::sort(ordered.begin(), ordered.end());
+				}
+				count(ordered.size());
+				for (uint32_t id : ordered) {
+					def(id);
+				}
+			}
+
+			/// One column: `member` of every row, in row order
+			template <typename Row, typename M, typename C>
+			void column(const std::vector<Row*>& rows, M C::*member) {
+				for (Row* row : rows) {
+					(*this)(row->*member);
+				}
+			}
+
+			template <typename Row, typename C>
+			void defColumn(const std::vector<Row*>& rows, uint32_t C::*member) {
+				for (Row* row : rows) {
+					def(row->*member);
+				}
+			}
+
+			/// One column written per row by `fn(io, row)`, for fields that need more than a plain copy
+			template <typename Row, typename Fn>
+			void columnWith(const std::vector<Row*>& rows, Fn&& fn) {
+				for (Row* row : rows) {
+					fn(*this, *row);
+				}
+			}
+
+			Writer writer;
+
+		  private:
+			StringTable& stringTable;
+			DefTable&	 defTable;
+		};
+
+		class Decoder {
+		  public:
+			static constexpr bool kReading = true;
+
+			Decoder(const std::vector<uint8_t>& in, const LoadTables& tables)
+				: reader{in.data(), in.size()},
+				  tables(tables) {}
+
+			template <typename T>
+			void operator()(T& value) {
+				if constexpr (std::is_same_v<T, bool>) {
+					uint8_t raw = 0;
+					reader.scalar(raw);
+					value = raw != 0;
+				} else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+					reader.scalar(value);
+				} else if constexpr (std::is_same_v<T, std::string>) {
+					uint32_t index = 0;
+					reader.scalar(index);
+					if (index < tables.strings.size()) {
+						value = tables.strings[index];
+					} else {
+						reader.failed = true;
+					}
+				} else if constexpr (std::is_same_v<T, glm::vec2>) {
+					reader.scalar(value.x);
+					reader.scalar(value.y);
+				} else if constexpr (std::is_same_v<T, glm::vec4>) {
+					reader.scalar(value.x);
+					reader.scalar(value.y);
+					reader.scalar(value.z);
+					reader.scalar(value.w);
+				} else if constexpr (IsOptional<T>::value) {
+					bool present = false;
+					(*this)(present);
+					if (present) {
+						(*this)(value.emplace());
+					} else {
+						value.reset();
+					}
+				} else if constexpr (IsVector<T>::value) {
+					value.clear();
+					value.resize(count());
+					for (auto& element : value) {
+						(*this)(element);
+					}
+				} else if constexpr (IsArray<T>::value) {
+					for (auto& element : value) {
+						(*this)(element);
+					}
+				} else if constexpr (IsPair<T>::value) {
+					(*this)(value.first);
+					(*this)(value.second);
+				} else if constexpr (IsVariant<T>::value) {
+					uint8_t index = 0;
+					reader.scalar(index);
+					if (index >= std::variant_size_v<T>) {
+						reader.failed = true;
+						return;
+					}
+					emplaceAlternative(value, index, std::make_index_sequence<std::variant_size_v<T>>{});
+					std::visit([this](auto& alternative) { (*this)(alternative); }, value);
+				} else if constexpr (IsUnorderedSet<T>::value) {
+					const size_t n = count();
+					value.clear();
+					value.reserve(n);
+					for (size_t i = 0; i < n; ++i) {
+						typename T::value_type element{};
+						(*this)(element);
+						value.insert(std::move(element));
+					}
+				} else if constexpr (IsUnorderedMap<T>::value) {
+					const size_t n = count();
+					value.clear();
+					value.reserve(n);
+					for (size_t i = 0; i < n; ++i) {
+						typename T::key_type	key{};
+						typename T::mapped_type mapped{};
+						(*this)(key);
+						(*this)(mapped);
+						value.emplace(std::move(key), std::move(mapped));
+					}
+				} else {
+					fields(*this, value);
+				}
+			}
+
+			/// Element count; a count the remaining bytes can't possibly hold fails the read.
+			size_t count() {
+				uint32_t n = 0;
+				reader.scalar(n);
+				if (n > reader.remaining()) {
+					reader.failed = true;
+					return 0;
+				}
+				return n;
+			}
+
+			void def(uint32_t& id) {
+				uint32_t fileId = 0;
+				reader.scalar(fileId);
+				if (fileId < tables.defs.size()) {
+					id = tables.defs[fileId];
+				} else {
+					reader.failed = true;
+					id = 0;
+				}
+			}
+
+			/// Defs that no longer exist in this build come back as 0 and are dropped from sets.
+			template <typename C>
+			void defList(C& ids) {
+				const size_t n = count();
+				ids.clear();
+				for (size_t i = 0; i < n; ++i) {
+					uint32_t id = 0;
+					def(id);
+					if constexpr (IsUnorderedSet<C>::value) {
+						if (id != 0) {
+							ids.insert(id);
+						}
+					} else {
+						ids.push_back(id);
+					}
+				}
+			}
+
+			template <typename Row, typename M, typename C>
+			void column(const std::vector<Row*>& rows, M C::*member) {
+				for (Row* row : rows) {
+					(*this)(row->*member);
+				}
+			}
+
+			template <typename Row, typename C>
+			void defColumn(const std::vector<Row*>& rows, uint32_t C::*member) {
+				for (Row* row : rows) {
+					def(row->*member);
+				}
+			}
+
+			template <typename Row, typename Fn>
+			void columnWith(const std::vector<Row*>& rows, Fn&& fn) {
+				for (Row* row : rows) {
+					fn(*this, *row);
+				}
+			}
+
+			[[nodiscard]] bool good() const { return reader.good(); }
+
+			Reader reader;
+
+		  private:
+			const LoadTables& tables;
+		};
+
+		// --- Component pools ------------------------------------------------
+		//
+		// Each saved component type has a stable tag and its columns. A component
+		// missing from SavedComponents is not saved; derived ones (NavPath, Room,
+		// PreviousPosition) are left out on purpose.
+
+		template <typename T>
+		struct PoolCodec;
+
+		template <>
+		struct PoolCodec<ecs::Position> {
+			static constexpr uint32_t	 kTag = fourcc("POSN");
+			static constexpr const char* kName = "Position";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Position::value);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Rotation> {
+			static constexpr uint32_t	 kTag = fourcc("ROTN");
+			static constexpr const char* kName = "Rotation";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Rotation::radians);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Velocity> {
+			static constexpr uint32_t	 kTag = fourcc("VELO");
+			static constexpr const char* kName = "Velocity";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Velocity::value);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::MovementTarget> {
+			static constexpr uint32_t	 kTag = fourcc("MTGT");
+			static constexpr const char* kName = "MovementTarget";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::MovementTarget::target);
+				io.column(rows, &ecs::MovementTarget::speed);
+				io.column(rows, &ecs::MovementTarget::active);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::AgentRadius> {
+			static constexpr uint32_t	 kTag = fourcc("ARAD");
+			static constexpr const char* kName = "AgentRadius";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::AgentRadius::radiusMeters);
+				io.column(rows, &ecs::AgentRadius::invMass);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::AnimationState> {
+			static constexpr uint32_t	 kTag = fourcc("ANIM");
+			static constexpr const char* kName = "AnimationState";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::AnimationState::phase);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::FacingDirection> {
+			static constexpr uint32_t	 kTag = fourcc("FACE");
+			static constexpr const char* kName = "FacingDirection";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::FacingDirection::direction);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Appearance> {
+			static constexpr uint32_t	 kTag = fourcc("APPR");
+			static constexpr const char* kName = "Appearance";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Appearance::defName);
+				io.column(rows, &ecs::Appearance::scale);
+				io.column(rows, &ecs::Appearance::colorTint);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Attributes> {
+			static constexpr uint32_t	 kTag = fourcc("ATTR");
+			static constexpr const char* kName = "Attributes";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Attributes::strength);
+				io.column(rows, &ecs::Attributes::agility);
+				io.column(rows, &ecs::Attributes::intelligence);
+				io.column(rows, &ecs::Attributes::civility);
+				io.column(rows, &ecs::Attributes::sanity);
+				io.column(rows, &ecs::Attributes::kindness);
+				io.column(rows, &ecs::Attributes::workEthic);
+				io.column(rows, &ecs::Attributes::socialNeed);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Colonist> {
+			static constexpr uint32_t	 kTag = fourcc("COLN");
+			static constexpr const char* kName = "Colonist";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Colonist::name);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Colony> {
+			static constexpr uint32_t	 kTag = fourcc("CLNY");
+			static constexpr const char* kName = "Colony";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Colony::originPosition);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Inventory> {
+			static constexpr uint32_t	 kTag = fourcc("INVT");
+			static constexpr const char* kName = "Inventory";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Inventory::leftHand);
+				io.column(rows, &ecs::Inventory::rightHand);
+				io.column(rows, &ecs::Inventory::belt);
+				io.column(rows, &ecs::Inventory::carryingPackagedEntity);
+				io.column(rows, &ecs::Inventory::items);
+				io.column(rows, &ecs::Inventory::maxCapacity);
+				io.column(rows, &ecs::Inventory::carryCapacityKg);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Knowledge> {
+			static constexpr uint32_t	 kTag = fourcc("KNOW");
+			static constexpr const char* kName = "Knowledge";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.columnWith(rows, [](auto& column, auto& knowledge) { column.defList(knowledge.knownDefs); });
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Memory> {
+			static constexpr uint32_t	 kTag = fourcc("MEMO");
+			static constexpr const char* kName = "Memory";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Memory::owner);
+				io.column(rows, &ecs::Memory::sightRadius);
+				// World entities are keyed by a hash of their runtime def id, so they are
+				// saved as (def, position) oldest first and re-remembered on load, which
+				// rebuilds the keys, the capability index and the LRU order together.
+				io.columnWith(rows, [](auto& column, auto& memory) {
+					if constexpr (std::decay_t<decltype(column)>::kReading) {
+						const auto& assets = engine::assets::AssetRegistry::Get();
+						const size_t n = column.count();
+						for (size_t i = 0; i < n; ++i) {
+							uint32_t  defNameId = 0;
+							glm::vec2 position{0.0F, 0.0F};
+							column.def(defNameId);
+							column(position);
+							memory.rememberWorldEntity(position, defNameId, assets.getCapabilityMask(defNameId));
+						}
+					} else {
+						column.count(memory.lruOrder.size());
+						for (uint64_t key : memory.lruOrder) {
+							const auto& known = memory.knownWorldEntities.at(key);
+							column.def(known.defNameId);
+							column(known.position);
+						}
+					}
+				});
+				io.column(rows, &ecs::Memory::knownDynamicEntities);
+				io.column(rows, &ecs::Memory::knownSegments);
+				io.column(rows, &ecs::Memory::knownOpenings);
+				io.column(rows, &ecs::Memory::beliefVersion);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::NeedsComponent> {
+			static constexpr uint32_t	 kTag = fourcc("NEED");
+			static constexpr const char* kName = "NeedsComponent";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::NeedsComponent::needs);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Packaged> {
+			static constexpr uint32_t	 kTag = fourcc("PKGD");
+			static constexpr const char* kName = "Packaged";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Packaged::targetPosition);
+				io.column(rows, &ecs::Packaged::beingCarried);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::PlayerControlled> {
+			static constexpr uint32_t	 kTag = fourcc("PLYR");
+			static constexpr const char* kName = "PlayerControlled";
+			template <typename Io, typename Rows>
+			static void columns(Io& /*io*/, Rows& /*rows*/) {}
+		};
+
+		template <>
+		struct PoolCodec<ecs::ResourceStack> {
+			static constexpr uint32_t	 kTag = fourcc("RSTK");
+			static constexpr const char* kName = "ResourceStack";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::ResourceStack::quantity);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Skills> {
+			static constexpr uint32_t	 kTag = fourcc("SKIL");
+			static constexpr const char* kName = "Skills";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Skills::levels);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::StorageConfiguration> {
+			static constexpr uint32_t	 kTag = fourcc("STOR");
+			static constexpr const char* kName = "StorageConfiguration";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::StorageConfiguration::rules);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Structure> {
+			static constexpr uint32_t	 kTag = fourcc("STRC");
+			static constexpr const char* kName = "Structure";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Structure::kind);
+				io.column(rows, &ecs::Structure::graphId);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::StructureHealth> {
+			static constexpr uint32_t	 kTag = fourcc("SHLT");
+			static constexpr const char* kName = "StructureHealth";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::StructureHealth::hp);
+				io.column(rows, &ecs::StructureHealth::maxHp);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::StructureBlueprint> {
+			static constexpr uint32_t	 kTag = fourcc("BLPR");
+			static constexpr const char* kName = "StructureBlueprint";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::StructureBlueprint::phase);
+				io.column(rows, &ecs::StructureBlueprint::demolishing);
+				io.column(rows, &ecs::StructureBlueprint::required);
+				io.column(rows, &ecs::StructureBlueprint::delivered);
+				io.column(rows, &ecs::StructureBlueprint::workTotal);
+				io.column(rows, &ecs::StructureBlueprint::workDone);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Task> {
+			static constexpr uint32_t	 kTag = fourcc("TASK");
+			static constexpr const char* kName = "Task";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Task::type);
+				io.column(rows, &ecs::Task::state);
+				io.column(rows, &ecs::Task::navState);
+				io.column(rows, &ecs::Task::navStateHold);
+				io.column(rows, &ecs::Task::targetPosition);
+				io.column(rows, &ecs::Task::needToFulfill);
+				io.column(rows, &ecs::Task::harvestTargetEntityId);
+				io.column(rows, &ecs::Task::harvestGoalId);
+				io.defColumn(rows, &ecs::Task::harvestYieldDefNameId);
+				io.column(rows, &ecs::Task::craftRecipeDefName);
+				io.column(rows, &ecs::Task::targetStationId);
+				io.columnWith(rows, [](auto& column, auto& task) { itemDef(column, task.haulItemDefNameId); });
+				io.column(rows, &ecs::Task::haulQuantity);
+				io.column(rows, &ecs::Task::haulSourceStorageId);
+				io.column(rows, &ecs::Task::haulTargetStorageId);
+				io.column(rows, &ecs::Task::haulGoalId);
+				io.column(rows, &ecs::Task::haulSourcePosition);
+				io.column(rows, &ecs::Task::haulTargetPosition);
+				io.column(rows, &ecs::Task::haulFromInventory);
+				io.column(rows, &ecs::Task::buildBlueprintEntityId);
+				io.column(rows, &ecs::Task::placePackagedEntityId);
+				io.column(rows, &ecs::Task::placeSourcePosition);
+				io.column(rows, &ecs::Task::placeTargetPosition);
+				io.column(rows, &ecs::Task::chainId);
+				io.column(rows, &ecs::Task::chainStep);
+				io.column(rows, &ecs::Task::timeSinceEvaluation);
+				io.column(rows, &ecs::Task::priorityTier);
+				io.column(rows, &ecs::Task::priority);
+				io.column(rows, &ecs::Task::reason);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::Action> {
+			static constexpr uint32_t	 kTag = fourcc("ACTN");
+			static constexpr const char* kName = "Action";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::Action::type);
+				io.column(rows, &ecs::Action::state);
+				io.column(rows, &ecs::Action::duration);
+				io.column(rows, &ecs::Action::elapsed);
+				io.column(rows, &ecs::Action::targetPosition);
+				io.column(rows, &ecs::Action::interruptable);
+				io.column(rows, &ecs::Action::spawnBioPile);
+				io.column(rows, &ecs::Action::effect);
+			}
+		};
+
+		template <>
+		struct PoolCodec<ecs::WorkQueue> {
+			static constexpr uint32_t	 kTag = fourcc("WORK");
+			static constexpr const char* kName = "WorkQueue";
+			template <typename Io, typename Rows>
+			static void columns(Io& io, Rows& rows) {
+				io.column(rows, &ecs::WorkQueue::jobs);
+				io.column(rows, &ecs::WorkQueue::progress);
+			}
+		};
+
+		// The trace is rewritten on every AI evaluation; only its presence is saved.
+		template <>
+		struct PoolCodec<ecs::DecisionTrace> {
+			static constexpr uint32_t	 kTag = fourcc("DTRC");
+			static constexpr const char* kName = "DecisionTrace";
+			template <typename Io, typename Rows>
+			static void columns(Io& /*io*/, Rows& /*rows*/) {}
+		};
+
+		template <typename... Ts>
+		struct ComponentList {};
+
+		using SavedComponents = ComponentList<
+			ecs::Position,
+			ecs::Rotation,
+			ecs::Velocity,
+			ecs::MovementTarget,
+			ecs::AgentRadius,
+			ecs::AnimationState,
+			ecs::FacingDirection,
+			ecs::Appearance,
+			ecs::Attributes,
+			ecs::Colonist,
+			ecs::Colony,
+			ecs::Inventory,
+			ecs::Knowledge,
+			ecs::Memory,
+			ecs::NeedsComponent,
+			ecs::Packaged,
+			ecs::PlayerControlled,
+			ecs::ResourceStack,
+			ecs::Skills,
+			ecs::StorageConfiguration,
+			ecs::Structure,
+			ecs::StructureHealth,
+			ecs::StructureBlueprint,
+			ecs::Task,
+			ecs::Action,
+			ecs::WorkQueue,
+			ecs::DecisionTrace>;
+
+		template <typename... Ts>
+		constexpr bool tagsAreUnique(ComponentList<Ts...> /*unused*/) {
+			constexpr std::array<uint32_t, sizeof...(Ts)> tags{PoolCodec<Ts>::kTag...};
+			for (size_t i = 0; i < tags.size(); ++i) {
+				for (size_t j = i + 1; j < tags.size(); ++j) {
+					if (tags[i] == tags[j]) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+		static_assert(tagsAreUnique(SavedComponents{}), "component pool tags must be unique");
+
+		template <typename Io, typename Rows>
+		void goalColumns(Io& io, Rows& rows) {
+			io.column(rows, &ecs::GoalTask::id);
+			io.column(rows, &ecs::GoalTask::type);
+			io.column(rows, &ecs::GoalTask::destinationEntity);
+			io.column(rows, &ecs::GoalTask::destinationPosition);
+			io.defColumn(rows, &ecs::GoalTask::destinationDefNameId);
+			io.columnWith(rows, [](auto& column, auto& goal) { column.defList(goal.acceptedDefNameIds); });
+			io.column(rows, &ecs::GoalTask::acceptedCategory);
+			io.column(rows, &ecs::GoalTask::targetAmount);
+			io.column(rows, &ecs::GoalTask::deliveredAmount);
+			io.column(rows, &ecs::GoalTask::createdAt);
+			io.column(rows, &ecs::GoalTask::owner);
+			io.column(rows, &ecs::GoalTask::parentGoalId);
+			io.column(rows, &ecs::GoalTask::status);
+			io.defColumn(rows, &ecs::GoalTask::yieldDefNameId);
+			io.column(rows, &ecs::GoalTask::recipeNameId);
+			io.column(rows, &ecs::GoalTask::chainId);
+		}
+
+		// --- Encoding -------------------------------------------------------
+
+		using Section = Snapshot::Section;
+
+		struct EncodeContext {
+			const ecs::Registry&					 registry;
+			const std::unordered_set<ecs::EntityID>& skipped; // derived entities (rooms)
+			StringTable&							 strings;
+			DefTable&								 defs;
+			std::vector<Section>&					 sections;
+		};
+
+		// The rows of one pool that get saved, in dense (pool) order.
+		template <typename T>
+		struct PoolRows {
+			std::vector<ecs::EntityID> entities;
+			std::vector<const T*>	   rows;
+		};
+
+		template <typename T>
+		PoolRows<T> collectRows(const ecs::Registry& registry, const std::unordered_set<ecs::EntityID>& skipped) {
+			PoolRows<T> out;
+			const auto* pool = registry.getPool<T>();
+			if (pool == nullptr) {
+				return out;
+			}
+			out.entities.reserve(pool->size());
+			out.rows.reserve(pool->size());
+			for (size_t i = 0; i < pool->size(); ++i) {
+				const ecs::EntityID entity = pool->getEntity(i);
+				if (skipped.count(entity) == 0) {
+					out.entities.push_back(entity);
+					out.rows.push_back(&pool->getComponent(i));
+				}
+			}
+			return out;
+		}
+
+		template <typename T>
+		void writePool(Encoder& io, PoolRows<T>& pool) {
+			io.writer.scalar(PoolCodec<T>::kTag);
+			io.count(pool.rows.size());
+			io.writer.span(pool.entities);
+			PoolCodec<T>::columns(io, pool.rows);
+		}
+
+		template <typename T>
+		void encodePool(EncodeContext& ctx) {
+			PoolRows<T> pool = collectRows<T>(ctx.registry, ctx.skipped);
+			if (pool.rows.empty()) {
+				return;
+			}
+			Section& section = ctx.sections.emplace_back(Section{kPoolSection, {}});
+			Encoder	 io(section.bytes, ctx.strings, ctx.defs);
+			writePool(io, pool);
+		}
+
+		template <typename... Ts>
+		void encodePools(ComponentList<Ts...> /*unused*/, EncodeContext& ctx) {
+			(encodePool<Ts>(ctx), ...);
+		}
+
+		void encodeTime(Encoder& io, const ecs::TimeSystem& time) {
+			const auto saved = time.snapshot();
+			io(static_cast<int32_t>(saved.day));
+			io(saved.timeOfDay);
+			io(static_cast<int32_t>(saved.speed));
+		}
+
+		void encodeEntities(Encoder& io, const ecs::Registry& registry) {
+			const auto allocator = registry.exportAllocator();
+			io.count(allocator.generations.size());
+			io.writer.span(allocator.generations);
+			io.count(allocator.freeList.size());
+			io.writer.span(allocator.freeList);
+		}
+
+		void encodeConstruction(Encoder& io, const construction::ConstructionWorld& construction) {
+			const auto tables = construction.exportTables();
+			io(tables.nextFoundationId);
+			io(tables.nextVertexId);
+			io(tables.nextSegmentId);
+			io(tables.nextOpeningId);
+			io(tables.foundations);
+			io(tables.vertices);
+			io(tables.segments);
+			io(tables.openings);
+		}
+
+		void encodeGoals(Encoder& io, const ecs::GoalTaskRegistry& goalRegistry) {
+			const auto						  goals = goalRegistry.exportGoals();
+			std::vector<const ecs::GoalTask*> rows;
+			rows.reserve(goals.size());
+			for (const auto& goal : goals) {
+				rows.push_back(&goal);
+			}
+			io(goalRegistry.peekNextGoalId());
+			io.count(rows.size());
+			goalColumns(io, rows);
+		}
+
+		// --- State hashing --------------------------------------------------
+
+		// One section encoded against its own string and def tables, so a change in
+		// one pool never shifts the indices (and hashes) of another. Strings and defs
+		// are folded in by value: runtime def ids may differ between processes.
+		class SectionHasher {
+		  public:
+			explicit SectionHasher(std::vector<StateHash>& out)
+				: hashes(out) {}
+
+			template <typename Encode>
+			void operator()(uint32_t tag, const char* name, Encode&& encode) {
+				StringTable strings;
+				DefTable	defs;
+				bytes.clear();
+				Encoder io(bytes, strings, defs);
+				encode(io);
+
+				uint64_t hash = foundation::hashBytes(bytes.data(), bytes.size());
+				for (const std::string* value : strings.all()) {
+					hash = foundation::hashCombine(hash, foundation::hashBytes(value->data(), value->size()));
+				}
+				const auto& assets = assets::AssetRegistry::Get();
+				for (uint32_t runtimeId : defs.all()) {
+					const std::string& defName = assets.getDefName(runtimeId);
+					hash = foundation::hashCombine(hash, foundation::hashBytes(defName.data(), defName.size()));
+				}
+				hashes.push_back({tag, name, hash});
+			}
+
+		  private:
+			std::vector<StateHash>& hashes;
+			std::vector<uint8_t>	bytes; // reused across sections
+		};
+
+		template <typename... Ts>
+		void hashPools(ComponentList<Ts...> /*unused*/, const ecs::Registry& registry, SectionHasher& hasher) {
+			const std::unordered_set<ecs::EntityID> none;
+			(hasher(PoolCodec<Ts>::kTag,
+					PoolCodec<Ts>::kName,
+					[&](Encoder& io) {
+						PoolRows<Ts> pool = collectRows<Ts>(registry, none);
+						writePool(io, pool);
+					}),
+			 ...);
+		}
+
+		// --- Decoding -------------------------------------------------------
+
+		enum class PoolResult { Ok, UnknownTag, Corrupt };
+
+		// Per entity index, from the ENTS section: which indices are free-listed (a
+		// free index still passes Registry::isAlive at its bumped generation) and which
+		// got at least one component.
+		struct LoadedEntities {
+			std::vector<bool> recycled;
+			std::vector<bool> populated;
+
+			[[nodiscard]] bool isLive(const ecs::Registry& registry, ecs::EntityID entity) const {
+				return registry.isAlive(entity) && !recycled[ecs::getIndex(entity)];
+			}
+		};
+
+		template <typename T>
+		bool decodePool(Decoder& io, ecs::World& world, LoadedEntities& loaded) {
+			const size_t			   n = io.count();
+			std::vector<ecs::EntityID> entities(n);
+			io.reader.span(entities);
+			if (!io.good()) {
+				return false;
+			}
+			auto& registry = world.getRegistry();
+			for (ecs::EntityID entity : entities) {
+				if (!loaded.isLive(registry, entity)) {
+					return false;
+				}
+				world.addComponent<T>(entity);
+			}
+			// Pointers only after every add: adds grow the pool's dense array.
+			std::vector<T*> rows;
+			rows.reserve(n);
+			for (ecs::EntityID entity : entities) {
+				rows.push_back(world.getComponent<T>(entity));
+				loaded.populated[ecs::getIndex(entity)] = true;
+			}
+			PoolCodec<T>::columns(io, rows);
+			return io.good();
+		}
+
+		template <typename... Ts>
+		PoolResult decodePoolByTag(ComponentList<Ts...> /*unused*/, uint32_t tag, Decoder& io, ecs::World& world, LoadedEntities& loaded) {
+			PoolResult result = PoolResult::UnknownTag;
+			((tag == PoolCodec<Ts>::kTag ? (result = decodePool<Ts>(io, world, loaded) ? PoolResult::Ok : PoolResult::Corrupt, true) : false) ||
+			 ...);
+			return result;
+		}
+
+		struct DirectoryEntry {
+			uint32_t id = 0;
+			uint32_t flags = 0;
+			uint64_t size = 0;
+			uint64_t hash = 0;
+		};
+
+	} // namespace
+
+	size_t Snapshot::byteCount() const {
+		size_t total = 0;
+		for (const auto& section : sections) {
+			total += section.bytes.size();
+		}
+		return total;
+	}
+
+	Snapshot captureSnapshot(
+		const ecs::World&						world,
+		const construction::ConstructionWorld&	construction,
+		const assets::PlacementExecutor*		placement
+	) {
+		const auto	start = std::chrono::steady_clock::now();
+		StringTable strings;
+		DefTable	defs;
+
+		// Content first: the string and def tables are only complete once every
+		// other section is encoded. They are moved to the front afterwards.
+		std::vector<Section> sections;
+
+		if (const auto* time = world.tryGetSystem<ecs::TimeSystem>()) {
+			Section& section = sections.emplace_back(Section{kTimeSection, {}});
+			Encoder	 io(section.bytes, strings, defs);
+			encodeTime(io, *time);
+		}
+
+		const auto& registry = world.getRegistry();
+		{
+			Section& section = sections.emplace_back(Section{kEntitiesSection, {}});
+			Encoder	 io(section.bytes, strings, defs);
+			encodeEntities(io, registry);
+		}
+
+		// Room entities are re-derived from the topology after a load; their IDs come
+		// back as empty shells that loadSave() releases.
+		std::unordered_set<ecs::EntityID> derived;
+		if (const auto* rooms = registry.getPool<ecs::Room>()) {
+			for (size_t i = 0; i < rooms->size(); ++i) {
+				derived.insert(rooms->getEntity(i));
+			}
+		}
+		EncodeContext ctx{registry, derived, strings, defs, sections};
+		encodePools(SavedComponents{}, ctx);
+
+		{
+			Section& section = sections.emplace_back(Section{kConstructionSection, {}});
+			Encoder	 io(section.bytes, strings, defs);
+			encodeConstruction(io, construction);
+		}
+
+		{
+			Section& section = sections.emplace_back(Section{kGoalsSection, {}});
+			Encoder	 io(section.bytes, strings, defs);
+			encodeGoals(io, ecs::GoalTaskRegistry::Get());
+		}
+
+		if (placement != nullptr) {
+			Section& section = sections.emplace_back(Section{kCooldownsSection, {}});
+			Encoder	 io(section.bytes, strings, defs);
+			io(placement->exportCooldowns());
+		}
+
+		// DEFS interns the defNames into the string table, so it's built before STRS.
+		Section defsSection{kDefsSection, {}};
+		{
+			const auto& assets = assets::AssetRegistry::Get();
+			Writer		w{defsSection.bytes};
+			w.scalar(static_cast<uint32_t>(defs.all().size()));
+			for (uint32_t runtimeId : defs.all()) {
+				w.scalar(strings.intern(assets.getDefName(runtimeId)));
+			}
+		}
+		Section stringsSection{kStringsSection, {}};
+		{
+			Writer w{stringsSection.bytes};
+			w.scalar(static_cast<uint32_t>(strings.all().size()));
+			for (const std::string* value : strings.all()) {
+				w.scalar(static_cast<uint32_t>(value->size()));
+				w.bytes(value->data(), value->size());
+			}
+		}
+
+		Snapshot snapshot;
+		snapshot.sections.reserve(sections.size() + 2);
+		snapshot.sections.push_back(std::move(stringsSection));
+		snapshot.sections.push_back(std::move(defsSection));
+		for (auto& section : sections) {
+			snapshot.sections.push_back(std::move(section));
+		}
+		snapshot.entities = registry.getLivingCount() - derived.size();
+		snapshot.captureMs = millisecondsSince(start);
+		return snapshot;
+	}
+
+	std::vector<StateHash> hashState(const ecs::World& world, const construction::ConstructionWorld& construction) {
+		std::vector<StateHash> hashes;
+		SectionHasher		   hasher(hashes);
+		const auto&			   registry = world.getRegistry();
+
+		if (const auto* time = world.tryGetSystem<ecs::TimeSystem>()) {
+			hasher(kTimeSection, "TimeSystem", [&](Encoder& io) { encodeTime(io, *time); });
+		}
+		hasher(kEntitiesSection, "Entities", [&](Encoder& io) { encodeEntities(io, registry); });
+		hashPools(SavedComponents{}, registry, hasher);
+		hasher(kConstructionSection, "ConstructionWorld", [&](Encoder& io) { encodeConstruction(io, construction); });
+		hasher(kGoalsSection, "GoalTaskRegistry", [&](Encoder& io) { encodeGoals(io, ecs::GoalTaskRegistry::Get()); });
+		return hashes;
+	}
+
+	bool writeSnapshot(const Snapshot& snapshot, std::ostream& out) {
+		std::vector<uint8_t> header;
+		Writer				 w{header};
+		w.bytes(kMagic, sizeof(kMagic));
+		w.scalar(kFormatVersion);
+		w.scalar(static_cast<uint32_t>(snapshot.sections.size()));
+		for (const auto& section : snapshot.sections) {
+			w.scalar(section.id);
+			w.scalar(uint32_t{0}); // flags: uncompressed
+			w.scalar(static_cast<uint64_t>(section.bytes.size()));
+			w.scalar(foundation::hashSpan(section.bytes));
+		}
+		out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+		for (const auto& section : snapshot.sections) {
+			out.write(reinterpret_cast<const char*>(section.bytes.data()), static_cast<std::streamsize>(section.bytes.size()));
+		}
+		out.flush();
+		return static_cast<bool>(out);
+	}
+
+	bool writeSnapshot(const Snapshot& snapshot, const std::filesystem::path& path) {
+		std::error_code ec;
+		if (path.has_parent_path()) {
+			std::filesystem::create_directories(path.parent_path(), ec);
+			if (ec) {
+				LOG_ERROR(Engine, "writeSnapshot: cannot create directory %s: %s", path.parent_path().string().c_str(), ec.message().c_str());
+				return false;
+			}
+		}
+
+		// Write to a sibling temp file, then rename into place so a crash or I/O
+		// failure never leaves a truncated save at the target path.
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+		{
+			std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+			if (!out) {
+				LOG_ERROR(Engine, "writeSnapshot: cannot open %s for writing", tempPath.string().c_str());
+				return false;
+			}
+			if (!writeSnapshot(snapshot, out)) {
+				LOG_ERROR(Engine, "writeSnapshot: write failed for %s", tempPath.string().c_str());
+				out.close();
+				std::filesystem::remove(tempPath, ec);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, ec);
+		if (ec) {
+			LOG_ERROR(Engine, "writeSnapshot: cannot rename %s to %s: %s", tempPath.string().c_str(), path.string().c_str(), ec.message().c_str());
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+		return true;
+	}
+
+	LoadResult loadSave(
+		std::istream&					 in,
+		ecs::World&						 world,
+		construction::ConstructionWorld& construction,
+		assets::PlacementExecutor*		 placement
+	) {
+		const auto start = std::chrono::steady_clock::now();
+		LoadResult result;
+		auto	   fail = [&result](std::string message) {
+			  LOG_ERROR(Engine, "loadSave: %s", message.c_str());
+			  result.error = std::move(message);
+			  return result;
+		};
+
+		char	 magic[4] = {};
+		uint32_t version = 0;
+		uint32_t sectionCount = 0;
+		in.read(magic, sizeof(magic));
+		in.read(reinterpret_cast<char*>(&version), sizeof(version));
+		in.read(reinterpret_cast<char*>(&sectionCount), sizeof(sectionCount));
+		if (!in || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+			return fail("not a colony save (bad magic)");
+		}
+		if (version != kFormatVersion) {
+			return fail("unsupported save version " + std::to_string(version));
+		}
+		if (sectionCount > kMaxSections) {
+			return fail("implausible section count " + std::to_string(sectionCount));
+		}
+
+		std::vector<DirectoryEntry> directory(sectionCount);
+		for (auto& entry : directory) {
+			in.read(reinterpret_cast<char*>(&entry.id), sizeof(entry.id));
+			in.read(reinterpret_cast<char*>(&entry.flags), sizeof(entry.flags));
+			in.read(reinterpret_cast<char*>(&entry.size), sizeof(entry.size));
+			in.read(reinterpret_cast<char*>(&entry.hash), sizeof(entry.hash));
+		}
+		if (!in) {
+			return fail("truncated section directory");
+		}
+
+		auto& registry = world.getRegistry();
+		if (registry.getLivingCount() != 0) {
+			return fail("target world already has entities");
+		}
+
+		LoadTables			 tables;
+		std::vector<uint8_t> buffer;
+		LoadedEntities		 loaded;
+		bool				 haveEntities = false;
+
+		for (const auto& entry : directory) {
+			const std::string name = sectionName(entry.id);
+			if (entry.size > kMaxSectionBytes) {
+				return fail("section " + name + " is implausibly large");
+			}
+			buffer.resize(static_cast<size_t>(entry.size));
+			in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+			if (!in) {
+				return fail("truncated section " + name);
+			}
+			if (foundation::hashSpan(buffer) != entry.hash) {
+				return fail("checksum mismatch in section " + name);
+			}
+			if (entry.flags != 0) {
+				++result.skippedSections; // an encoding this build doesn't know
+				continue;
+			}
+
+			Decoder io(buffer, tables);
+			switch (entry.id) {
+				case kStringsSection: {
+					const size_t n = io.count();
+					tables.strings.resize(n);
+					for (auto& value : tables.strings) {
+						const size_t length = io.count();
+						value.resize(length);
+						io.reader.bytes(value.data(), length);
+					}
+					break;
+				}
+				case kDefsSection: {
+					const auto&	 assets = assets::AssetRegistry::Get();
+					const size_t n = io.count();
+					tables.defs.assign(1, 0);
+					for (size_t i = 0; i < n; ++i) {
+						uint32_t nameIndex = 0;
+						io.reader.scalar(nameIndex);
+						tables.defs.push_back(nameIndex < tables.strings.size() ? assets.getDefNameId(tables.strings[nameIndex]) : 0);
+					}
+					break;
+				}
+				case kTimeSection: {
+					int32_t day = 1;
+					float	timeOfDay = 0.0F;
+					int32_t speed = 0;
+					io(day);
+					io(timeOfDay);
+					io(speed);
+					// speed indexes TimeSystem's multiplier table; don't trust it off disk
+					if (io.good() && (speed < static_cast<int32_t>(ecs::GameSpeed::Paused) || speed > static_cast<int32_t>(ecs::GameSpeed::Max))) {
+						return fail("invalid game speed");
+					}
+					if (auto* time = world.tryGetSystem<ecs::TimeSystem>(); time != nullptr && io.good()) {
+						time->restore(ecs::GameTimeSnapshot{
+							.day = day,
+							.season = ecs::Season::Spring,
+							.timeOfDay = timeOfDay,
+							.speed = static_cast<ecs::GameSpeed>(speed),
+							.isPaused = speed == 0
+						});
+					}
+					break;
+				}
+				case kEntitiesSection: {
+					ecs::Registry::AllocatorState allocator;
+					allocator.generations.resize(io.count());
+					io.reader.span(allocator.generations);
+					allocator.freeList.resize(io.count());
+					io.reader.span(allocator.freeList);
+					const size_t indexCount = allocator.generations.size();
+					const auto	 freeList = allocator.freeList;
+					if (!io.good() || haveEntities || !registry.restoreAllocator(std::move(allocator))) {
+						return fail("invalid entity table");
+					}
+					loaded.recycled.assign(indexCount, false);
+					loaded.populated.assign(indexCount, false);
+					for (uint32_t index : freeList) {
+						loaded.recycled[index] = true;
+					}
+					haveEntities = true;
+					break;
+				}
+				case kPoolSection: {
+					if (!haveEntities) {
+						return fail("component pool before the entity table");
+					}
+					uint32_t tag = 0;
+					io.reader.scalar(tag);
+					const PoolResult pool = decodePoolByTag(SavedComponents{}, tag, io, world, loaded);
+					if (pool == PoolResult::UnknownTag) {
+						LOG_WARNING(Engine, "loadSave: skipping unknown component pool '%s'", sectionName(tag).c_str());
+						++result.skippedSections;
+					} else if (pool == PoolResult::Corrupt) {
+						return fail("corrupt component pool " + sectionName(tag));
+					}
+					break;
+				}
+				case kConstructionSection: {
+					construction::ConstructionTables topology;
+					io(topology.nextFoundationId);
+					io(topology.nextVertexId);
+					io(topology.nextSegmentId);
+					io(topology.nextOpeningId);
+					io(topology.foundations);
+					io(topology.vertices);
+					io(topology.segments);
+					io(topology.openings);
+					if (io.good()) {
+						construction.restoreTables(std::move(topology));
+					}
+					break;
+				}
+				case kGoalsSection: {
+					uint64_t nextGoalId = 1;
+					io(nextGoalId);
+					std::vector<ecs::GoalTask> goals(io.count());
+					std::vector<ecs::GoalTask*> rows;
+					rows.reserve(goals.size());
+					for (auto& goal : goals) {
+						rows.push_back(&goal);
+					}
+					goalColumns(io, rows);
+					if (io.good()) {
+						ecs::GoalTaskRegistry::Get().restore(std::move(goals), nextGoalId);
+					}
+					break;
+				}
+				case kCooldownsSection: {
+					std::vector<assets::PlacementExecutor::CooldownRecord> cooldowns;
+					io(cooldowns);
+					if (placement != nullptr && io.good()) {
+						placement->restoreCooldowns(cooldowns);
+					}
+					break;
+				}
+				default:
+					LOG_WARNING(Engine, "loadSave: skipping unknown section '%s'", name.c_str());
+					++result.skippedSections;
+					break;
+			}
+			if (!io.good()) {
+				return fail("corrupt section " + name);
+			}
+		}
+
+		if (!haveEntities) {
+			return fail("save has no entity table");
+		}
+
+		// Entities whose only components were derived (rooms) come back as empty
+		// shells; release them so the allocator matches what was actually restored.
+		const auto allocator = registry.exportAllocator();
+		for (uint32_t index = 0; index < allocator.generations.size(); ++index) {
+			const ecs::EntityID entity = ecs::makeEntityID(index, allocator.generations[index]);
+			if (!loaded.populated[index] && !loaded.recycled[index]) {
+				world.destroyEntity(entity);
+			}
+		}
+
+		// Chain ids live in both goals (raised past by restore()) and colonist tasks; keep
+		// newly allocated chains clear of every task that survived the load.
+		if (const auto* tasks = registry.getPool<ecs::Task>()) {
+			for (size_t i = 0; i < tasks->size(); ++i) {
+				if (const auto& chainId = tasks->getComponent(i).chainId) {
+					ecs::GoalTaskRegistry::Get().reserveChainId(*chainId);
+				}
+			}
+		}
+
+		result.ok = true;
+		result.entities = registry.getLivingCount();
+		result.loadMs = millisecondsSince(start);
+		return result;
+	}
+
+	LoadResult loadSave(
+		const std::filesystem::path&	 path,
+		ecs::World&						 world,
+		construction::ConstructionWorld& construction,
+		assets::PlacementExecutor*		 placement
+	) {
+		std::ifstream in(path, std::ios::binary);
+		if (!in) {
+			LoadResult result;
+			result.error = "cannot open " + path.string();
+			LOG_ERROR(Engine, "loadSave: %s", result.error.c_str());
+			return result;
+		}
+		return loadSave(in, world, construction, placement);
+	}
+
+	// --- Autosaver ----------------------------------------------------------
+
+	Autosaver::~Autosaver() {
+		wait();
+	}
+
+	bool Autosaver::update(
+		float									realSeconds,
+		const ecs::World&						world,
+		const construction::ConstructionWorld&	construction,
+		const assets::PlacementExecutor*		placement
+	) {
+		if (intervalSeconds <= 0.0F || path.empty()) {
+			return false;
+		}
+		sinceLastSave += realSeconds;
+		if (sinceLastSave < intervalSeconds || writing()) {
+			return false;
+		}
+		wait(); // collect the finished write's result
+		start(world, construction, placement, false);
+		return true;
+	}
+
+	void Autosaver::saveNow(
+		const ecs::World&						world,
+		const construction::ConstructionWorld&	construction,
+		const assets::PlacementExecutor*		placement
+	) {
+		if (path.empty()) {
+			LOG_WARNING(Engine, "Autosaver: no save path set");
+			return;
+		}
+		wait();
+		start(world, construction, placement, true);
+	}
+
+	bool Autosaver::writing() const {
+		return pending.valid() && pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+	}
+
+	bool Autosaver::wait() {
+		if (pending.valid()) {
+			lastWriteOk = pending.get();
+			unreported.push_back(Completion{lastWriteOk, pendingManual});
+		}
+		return lastWriteOk;
+	}
+
+	std::optional<Autosaver::Completion> Autosaver::poll() {
+		if (pending.valid() && !writing()) {
+			wait();
+		}
+		if (unreported.empty()) {
+			return std::nullopt;
+		}
+		const Completion oldest = unreported.front();
+		unreported.erase(unreported.begin());
+		return oldest;
+	}
+
+	void Autosaver::start(
+		const ecs::World&						world,
+		const construction::ConstructionWorld&	construction,
+		const assets::PlacementExecutor*		placement,
+		bool									manual
+	) {
+		sinceLastSave = 0.0F;
+		pendingManual = manual;
+		auto snapshot = std::make_shared<Snapshot>(captureSnapshot(world, construction, placement));
+		last = Stats{snapshot->captureMs, snapshot->byteCount(), snapshot->entities};
+		LOG_INFO(Engine, "Autosave: captured %zu entities (%zu bytes) in %.2f ms", last.entities, last.bytes, static_cast<double>(last.captureMs));
+		pending = foundation::JobSystem::shared().submit(
+			[snapshot, target = path]() { return writeSnapshot(*snapshot, target); }, foundation::JobPriority::Background
+		);
+	}
+
+} // namespace engine::save
@@ -0,0 +1,238 @@
+#pragma once
+
+// Binary colony save file ("WSSV"), version 1.
+//
+// Version history:
+//   1 — initial format.
+//
+// Covers everything the simulation can't re-derive: the ECS world (entity
+// allocator plus every component pool listed in SaveGame.cpp), the
+// ConstructionWorld topology, GoalTaskRegistry goals, PlacementExecutor regrowth
+// cooldowns and the TimeSystem clock. Colonist Memory is an ordinary component
+// pool. Derived state is left out and rebuilds lazily once the loaded world
+// ticks: NavPath (replanned by AIDecisionSystem), Room entities (re-detected
+// from the restored topology), PreviousPosition (captured every tick), the nav
+// mesh, the vision geometry index and the agent spatial hash (all keyed on
+// ConstructionWorld::version() or rebuilt per tick). Chunks and flora are not
+// saved; they regenerate from the world seed.
+//
+// All multi-byte values are little-endian (asserted in SaveGame.cpp), and every
+// value is written field by field, never as a raw struct, so padding never
+// reaches disk.
+//
+// Layout (sequential):
+//   magic               char[4]   "WSSV"
+//   formatVersion       uint32    = 1
+//   sectionCount        uint32
+//   directory           sectionCount x { id uint32 (fourcc), flags uint32 (0),
+//                                        size uint64, fnv1a uint64 }
+//   payloads            each section's bytes, in directory order
+//
+// Sections (a loader skips ids it doesn't know, so later versions can add more):
+//   STRS  string table: count uint32, then { length uint32, bytes } per string.
+//         Every string elsewhere in the file is a uint32 index into it.
+//   DEFS  def-id table: count uint32, then the STRS index of each defName.
+//         AssetRegistry defName ids are assigned at startup and differ between
+//         runs, so saved def ids are indices into this table and are mapped
+//         back through AssetRegistry::getDefNameId() on load. File id 0 is
+//         reserved for "no def".
+//   TIME  day int32, timeOfDay float32, speed int32 (GameSpeed).
+//   ENTS  generationCount uint32, generations uint32[], freeCount uint32,
+//         freeList uint32[] (recycle order). Loading restores these first so
+//         every saved EntityID comes back identical.
+//   POOL  one per saved component type: tag uint32 (fourcc), count uint32,
+//         entity column uint64[count], then one column per field, each field
+//         written for all `count` rows before the next field starts.
+//   CNST  ConstructionWorld tables: four id counters (uint64), then the
+//         foundation, vertex, segment and opening records.
+//   GOAL  nextGoalId uint64, count uint32, then GoalTask columns.
+//   CDWN  regrowth cooldowns: count uint32, then records.
+//
+// Column encodings: bool as uint8; enums at their declared size; glm vectors as
+// float32 components; optional as uint8 presence + value; vector as count
+// uint32 + elements; unordered containers as count + elements sorted by key, so
+// saving the same state twice produces the same bytes.
+//
+// Compression is not applied: no compression library is available to the
+// engine yet. The flags word in the directory is reserved for it.
+
+#include <construction/ConstructionWorld.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+	class World;
+}
+
+namespace engine::assets {
+	class PlacementExecutor;
+}
+
+namespace engine::save {
+
+	/// A whole save image, encoded in memory as its sections. Capturing it is the
+	/// only step that reads live state; checksumming and writing it out is safe
+	/// from any thread.
+	struct Snapshot {
+		struct Section {
+			uint32_t			 id = 0;
+			std::vector<uint8_t> bytes;
+		};
+
+		std::vector<Section> sections;		   // in file order
+		size_t				 entities = 0;	   // living entities saved
+		float				 captureMs = 0.0F; // main-thread time spent encoding
+
+		/// Payload size, excluding the header and directory
+		[[nodiscard]] size_t byteCount() const;
+	};
+
+	/// Encode the current state. `placement` may be null (no cooldowns saved).
+	/// GoalTaskRegistry is the process-wide singleton and is always included.
+	[[nodiscard]] Snapshot captureSnapshot(
+		const ecs::World&						world,
+		const construction::ConstructionWorld&	construction,
+		const assets::PlacementExecutor*		placement
+	);
+
+	/// Write a snapshot to `path` via a sibling temp file and a rename, so a crash
+	/// mid-write never leaves a truncated save behind. Logs and returns false on failure.
+	bool writeSnapshot(const Snapshot& snapshot, const std::filesystem::path& path);
+
+	/// Write a snapshot to an open binary stream. Returns false if the stream fails.
+	bool writeSnapshot(const Snapshot& snapshot, std::ostream& out);
+
+	/// Fingerprint of one part of the simulation state.
+	struct StateHash {
+		uint32_t	tag = 0;		  // section or component pool fourcc
+		const char* name = "";		  // e.g. "Position", "GoalTaskRegistry" (static storage)
+		uint64_t	hash = 0;
+	};
+
+	/// Hash the state a save would contain, one entry per part in a fixed order: the
+	/// clock, the entity allocator, every saved component pool (empty ones included),
+	/// the construction tables and the goal registry. Each part is hashed from the same
+	/// bytes captureSnapshot() would write, with strings and defNames folded in by
+	/// value, so equal states hash equal across processes. For replay divergence checks.
+	[[nodiscard]] std::vector<StateHash> hashState(
+		const ecs::World&						world,
+		const construction::ConstructionWorld&	construction
+	);
+
+	struct LoadResult {
+		bool		ok = false;
+		size_t		entities = 0;		 // living entities after load
+		size_t		skippedSections = 0; // unknown section or component ids
+		float		loadMs = 0.0F;
+		std::string error;				 // set when !ok
+	};
+
+	/// Restore a save into a freshly constructed world (systems registered, no
+	/// entities yet) and an empty ConstructionWorld. Sections are read one at a
+	/// time from the stream and applied as they arrive. `placement` may be null
+	/// (saved cooldowns are then ignored). On failure the targets are partially
+	/// restored and should be discarded.
+	LoadResult loadSave(
+		std::istream&					 in,
+		ecs::World&						 world,
+		construction::ConstructionWorld& construction,
+		assets::PlacementExecutor*		 placement
+	);
+
+	LoadResult loadSave(
+		const std::filesystem::path&	 path,
+		ecs::World&						 world,
+		construction::ConstructionWorld& construction,
+		assets::PlacementExecutor*		 placement
+	);
+
+	/// Periodic autosave. The snapshot is captured on the calling (main) thread;
+	/// the write runs as a Background job on the shared JobSystem, so the frame
+	/// only pays for encoding. At most one write is in flight: a save that comes
+	/// due while the previous one is still writing waits for the next update.
+	class Autosaver {
+	  public:
+		static constexpr float kDefaultIntervalSeconds = 300.0F;
+
+		struct Stats {
+			float  captureMs = 0.0F;
+			size_t bytes = 0;
+			size_t entities = 0;
+		};
+
+		/// A finished write, as reported once by poll().
+		struct Completion {
+			bool ok = false;
+			bool manual = false; ///< started by saveNow() rather than the timer
+		};
+
+		Autosaver() = default;
+		~Autosaver();
+
+		Autosaver(const Autosaver&) = delete;
+		Autosaver& operator=(const Autosaver&) = delete;
+
+		void setPath(std::filesystem::path savePath) { path = std::move(savePath); }
+		[[nodiscard]] const std::filesystem::path& savePath() const { return path; }
+
+		/// Real seconds between autosaves; <= 0 disables them (saveNow() still works).
+		void setInterval(float seconds) { intervalSeconds = seconds; }
+
+		/// Advance the autosave timer by real (unscaled) frame time and start a save
+		/// when it's due. Returns true if a save was started this call.
+		bool update(
+			float									realSeconds,
+			const ecs::World&						world,
+			const construction::ConstructionWorld&	construction,
+			const assets::PlacementExecutor*		placement
+		);
+
+		/// Capture now and write in the background, waiting for any in-flight write first.
+		void saveNow(
+			const ecs::World&						world,
+			const construction::ConstructionWorld&	construction,
+			const assets::PlacementExecutor*		placement
+		);
+
+		/// True while a background write is in flight.
+		[[nodiscard]] bool writing() const;
+
+		/// Block until the in-flight write finishes. Returns its result, or the
+		/// previous one if nothing was in flight.
+		bool wait();
+
+		/// Non-blocking: report the oldest finished write not yet returned, or nullopt if
+		/// there is none. Each write is reported once, in the order they finished, so a
+		/// saveNow() that collects an autosave still in flight reports both. Call once a
+		/// frame to surface save results.
+		[[nodiscard]] std::optional<Completion> poll();
+
+		[[nodiscard]] const Stats& lastSave() const { return last; }
+
+	  private:
+		void start(
+			const ecs::World&						world,
+			const construction::ConstructionWorld&	construction,
+			const assets::PlacementExecutor*		placement,
+			bool									manual
+		);
+
+		std::filesystem::path	path;
+		float					intervalSeconds = kDefaultIntervalSeconds;
+		float					sinceLastSave = 0.0F;
+		std::future<bool>		pending;
+		bool					pendingManual = false; ///< kind of the write in `pending`
+		bool					lastWriteOk = true;
+		std::vector<Completion>	unreported; ///< finished writes poll() hasn't returned yet, oldest first
+		Stats					last;
+	};
+
+} // namespace engine::save
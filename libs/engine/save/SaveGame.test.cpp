@@ -0,0 +1,397 @@
+// SaveGame: a capture → write → load round trip restores identical entity IDs,
+// component values, per-run def ids (through the def table), Memory's LRU order,
+// goals, construction topology, cooldowns and the clock; saving the loaded state
+// again produces the same bytes; corrupt or foreign files are rejected; the
+// per-part state hash changes only for the part that changed.
+
+#include "SaveGame.h"
+
+#include <assets/AssetRegistry.h>
+#include <assets/placement/PlacementExecutor.h>
+#include <ecs/GoalTaskRegistry.h>
+#include <ecs/World.h>
+#include <ecs/components/Action.h>
+#include <ecs/components/Colonist.h>
+#include <ecs/components/Inventory.h>
+#include <ecs/components/Knowledge.h>
+#include <ecs/components/Memory.h>
+#include <ecs/components/Room.h>
+#include <ecs/components/Task.h>
+#include <ecs/components/Transform.h>
+#include <ecs/systems/TimeSystem.h>
+
+#include <utils/WorldHash.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace engine::save {
+namespace {
+
+using assets::AssetRegistry;
+using assets::PlacementExecutor;
+using construction::ConstructionWorld;
+using ecs::EntityID;
+
+constexpr const char* kBerryDef = "Test_Save_Berry";
+constexpr const char* kWaterDef = "Test_Save_Water";
+
+class SaveGameTest : public ::testing::Test {
+  protected:
+	void SetUp() override {
+		auto& registry = AssetRegistry::Get();
+		// ID 0 is the registry's "no def" sentinel; claim it so the test defs get real ids.
+		if (registry.getDefNameId("Test_Save_IdZeroReservation") == 0) {
+			registry.registerSyntheticDefinition("Test_Save_IdZeroReservation", 0);
+		}
+		// Non-zero masks: rememberWorldEntity drops decorative (mask 0) entities.
+		berryId = registry.registerSyntheticDefinition(kBerryDef, 1U << 0);
+		waterId = registry.registerSyntheticDefinition(kWaterDef, 1U << 1);
+		ASSERT_NE(berryId, 0U);
+		ecs::GoalTaskRegistry::Get().clear();
+	}
+
+	void TearDown() override { ecs::GoalTaskRegistry::Get().clear(); }
+
+	// Populate `world` with a colonist (most component kinds), a loose stack, a
+	// destroyed entity (so the allocator has a free list) and a room shell.
+	void populate(ecs::World& world, ConstructionWorld& construction, PlacementExecutor& placement) {
+		world.registerSystem<ecs::TimeSystem>().restore(
+			ecs::GameTimeSnapshot{.day = 4, .season = ecs::Season::Spring, .timeOfDay = 17.5F, .speed = ecs::GameSpeed::Fast, .isPaused = false}
+		);
+
+		EntityID gone = world.createEntity();
+		colonist = world.createEntity();
+		stack = world.createEntity();
+		world.destroyEntity(gone);
+		room = world.createEntity();
+		world.addComponent<ecs::Room>(room);
+
+		world.addComponent<ecs::Position>(colonist, ecs::Position{{3.5F, -2.25F}});
+		world.addComponent<ecs::Colonist>(colonist, ecs::Colonist{"Ada"});
+
+		auto& inventory = world.addComponent<ecs::Inventory>(colonist);
+		inventory.rightHand = ecs::ItemStack{"Stone", 2};
+		inventory.items.push_back(ecs::ItemStack{"Berry", 5});
+		inventory.carryingPackagedEntity = stack;
+
+		auto& knowledge = world.addComponent<ecs::Knowledge>(colonist);
+		knowledge.knownDefs = {berryId, waterId};
+
+		auto& memory = world.addComponent<ecs::Memory>(colonist);
+		memory.owner = colonist;
+		memory.rememberWorldEntity({1.0F, 1.0F}, berryId, 1U << 0);
+		memory.rememberWorldEntity({2.0F, 2.0F}, waterId, 1U << 1);
+		memory.rememberWorldEntity({3.0F, 3.0F}, berryId, 1U << 0);
+		memory.knownSegments = {7, 3};
+
+		auto& task = world.addComponent<ecs::Task>(colonist);
+		task.type = ecs::TaskType::Harvest;
+		task.harvestTargetEntityId = stack;
+		task.harvestYieldDefNameId = berryId;
+		task.haulItemDefNameId = AssetRegistry::Get().internDefName("Berry"); // no definition: saved by name
+		task.chainId = 42;
+		task.reason = "hungry";
+
+		auto& action = world.addComponent<ecs::Action>(colonist);
+		action.type = ecs::ActionType::Harvest;
+		action.duration = 4.0F;
+		action.effect = ecs::CollectionEffect{
+			.itemDefNameId = task.haulItemDefNameId, .quantity = 3, .sourcePosition = {5.0F, 6.0F}, .sourceDefName = kBerryDef
+		};
+
+		world.addComponent<ecs::Position>(stack, ecs::Position{{8.0F, 9.0F}});
+
+		ecs::GoalTask goal;
+		goal.type = ecs::TaskType::Haul;
+		goal.destinationEntity = stack;
+		goal.destinationDefNameId = waterId;
+		goal.acceptedDefNameIds = {berryId};
+		goal.targetAmount = 10;
+		goal.parentGoalId = 99;
+		goalId = ecs::GoalTaskRegistry::Get().createGoal(goal);
+
+		ASSERT_TRUE(construction.commitFoundation(geometry::Ring{{0, 0}, {4000, 0}, {4000, 4000}, {0, 4000}}, "Wood").ok());
+
+		placement.setEntityCooldown({1, -2}, {10.0F, 20.0F}, kBerryDef, 30.0F);
+	}
+
+	static std::string save(const ecs::World& world, const ConstructionWorld& construction, const PlacementExecutor& placement) {
+		std::ostringstream out(std::ios::binary);
+		EXPECT_TRUE(writeSnapshot(captureSnapshot(world, construction, &placement), out));
+		return out.str();
+	}
+
+	uint32_t berryId = 0;
+	uint32_t waterId = 0;
+	EntityID colonist = ecs::kInvalidEntity;
+	EntityID stack = ecs::kInvalidEntity;
+	EntityID room = ecs::kInvalidEntity;
+	uint64_t goalId = 0;
+};
+
+TEST_F(SaveGameTest, RoundTripRestoresStateAndIds) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+	const std::string bytes = save(world, construction, placement);
+	ecs::GoalTaskRegistry::Get().clear();
+
+	ecs::World		  loaded;
+	auto&			  time = loaded.registerSystem<ecs::TimeSystem>();
+	ConstructionWorld loadedConstruction;
+	PlacementExecutor loadedPlacement(AssetRegistry::Get());
+	std::istringstream in(bytes, std::ios::binary);
+	const LoadResult result = loadSave(in, loaded, loadedConstruction, &loadedPlacement);
+	ASSERT_TRUE(result.ok) << result.error;
+	EXPECT_EQ(result.entities, 2U) << "the room shell is derived and released";
+	EXPECT_FALSE(loaded.isAlive(room));
+
+	EXPECT_EQ(time.day(), 4);
+	EXPECT_FLOAT_EQ(time.timeOfDay(), 17.5F);
+	EXPECT_EQ(time.speed(), ecs::GameSpeed::Fast);
+
+	ASSERT_TRUE(loaded.isAlive(colonist));
+	ASSERT_TRUE(loaded.isAlive(stack));
+	EXPECT_EQ(loaded.getComponent<ecs::Colonist>(colonist)->name, "Ada");
+	EXPECT_FLOAT_EQ(loaded.getComponent<ecs::Position>(colonist)->value.y, -2.25F);
+
+	const auto* inventory = loaded.getComponent<ecs::Inventory>(colonist);
+	ASSERT_NE(inventory, nullptr);
+	ASSERT_TRUE(inventory->rightHand.has_value());
+	EXPECT_EQ(inventory->rightHand->defName(), "Stone");
+	EXPECT_FALSE(inventory->leftHand.has_value());
+	ASSERT_EQ(inventory->items.size(), 1U);
+	EXPECT_EQ(inventory->items[0].quantity, 5U);
+	EXPECT_EQ(inventory->carryingPackagedEntity, stack);
+
+	EXPECT_TRUE(loaded.getComponent<ecs::Knowledge>(colonist)->knownDefs.count(waterId) == 1);
+
+	const auto* memory = loaded.getComponent<ecs::Memory>(colonist);
+	ASSERT_NE(memory, nullptr);
+	EXPECT_EQ(memory->knownWorldEntities.size(), 3U);
+	EXPECT_EQ(memory->lruOrder, world.getComponent<ecs::Memory>(colonist)->lruOrder) << "keys rebuild to the same hashes, same order";
+	EXPECT_EQ(memory->knownSegments.size(), 2U);
+
+	const auto* task = loaded.getComponent<ecs::Task>(colonist);
+	EXPECT_EQ(task->harvestYieldDefNameId, berryId);
+	EXPECT_EQ(engine::assets::AssetRegistry::Get().getDefName(task->haulItemDefNameId), "Berry");
+	EXPECT_EQ(task->chainId, std::optional<uint64_t>(42));
+	EXPECT_EQ(task->reason, "hungry");
+
+	const auto* action = loaded.getComponent<ecs::Action>(colonist);
+	const auto* collect = std::get_if<ecs::CollectionEffect>(&action->effect);
+	ASSERT_NE(collect, nullptr);
+	EXPECT_EQ(collect->quantity, 3U);
+	EXPECT_EQ(collect->itemDefNameId, task->haulItemDefNameId);
+	EXPECT_EQ(collect->sourceDefName, kBerryDef);
+
+	const auto* goal = ecs::GoalTaskRegistry::Get().getGoal(goalId);
+	ASSERT_NE(goal, nullptr);
+	EXPECT_EQ(goal->destinationDefNameId, waterId);
+	EXPECT_EQ(goal->acceptedDefNameIds, std::vector<uint32_t>{berryId});
+	EXPECT_EQ(goal->parentGoalId, std::optional<uint64_t>(99));
+	const auto hauls = ecs::GoalTaskRegistry::Get().getGoalsOfType(ecs::TaskType::Haul);
+	EXPECT_EQ(hauls, std::vector<const ecs::GoalTask*>{goal}) << "indices are rebuilt";
+	EXPECT_GT(ecs::GoalTaskRegistry::Get().allocateChainId(), 42U) << "new chains skip the loaded task's chain id";
+
+	ASSERT_EQ(loadedConstruction.foundations().size(), 1U);
+	EXPECT_EQ(loadedConstruction.foundations()[0].ring, construction.foundations()[0].ring);
+	EXPECT_TRUE(loadedPlacement.isEntityOnCooldown({1, -2}, {10.0F, 20.0F}, kBerryDef));
+
+	// Unordered containers are written sorted, so the loaded state saves to the same
+	// bytes every time. (Not the original's bytes: the room shell was released.)
+	const std::string resaved = save(loaded, loadedConstruction, loadedPlacement);
+	ecs::GoalTaskRegistry::Get().clear();
+	ecs::World		   again;
+	again.registerSystem<ecs::TimeSystem>();
+	ConstructionWorld  againConstruction;
+	PlacementExecutor  againPlacement(AssetRegistry::Get());
+	std::istringstream resavedIn(resaved, std::ios::binary);
+	ASSERT_TRUE(loadSave(resavedIn, again, againConstruction, &againPlacement).ok);
+	EXPECT_EQ(save(again, againConstruction, againPlacement), resaved);
+
+	// New IDs continue the saved allocator: the released room index is reused next.
+	EXPECT_EQ(loaded.createEntity(), ecs::makeEntityID(ecs::getIndex(room), ecs::getGeneration(room) + 1));
+}
+
+TEST_F(SaveGameTest, RejectsForeignAndCorruptFiles) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+	std::string bytes = save(world, construction, placement);
+
+	auto load = [](const std::string& data) {
+		ecs::World		   target;
+		ConstructionWorld  targetConstruction;
+		std::istringstream in(data, std::ios::binary);
+		return loadSave(in, target, targetConstruction, nullptr);
+	};
+
+	std::string foreign = bytes;
+	foreign[0] = 'X';
+	EXPECT_FALSE(load(foreign).ok);
+
+	std::string corrupt = bytes;
+	corrupt[corrupt.size() - 3] ^= 0x5A; // a payload byte: the section checksum catches it
+	const LoadResult result = load(corrupt);
+	EXPECT_FALSE(result.ok);
+	EXPECT_NE(result.error.find("checksum"), std::string::npos) << result.error;
+
+	EXPECT_FALSE(load(bytes.substr(0, bytes.size() / 2)).ok) << "truncated";
+}
+
+TEST_F(SaveGameTest, RejectsOutOfRangeGameSpeed) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+	std::string bytes = save(world, construction, placement);
+
+	// Walk the directory to the TIME payload, overwrite its speed and re-seal the
+	// checksum, so only the range check can refuse it.
+	uint32_t sectionCount = 0;
+	std::memcpy(&sectionCount, bytes.data() + 8, sizeof(sectionCount));
+	size_t entryAt = 12;
+	size_t payloadAt = 12 + (sectionCount * 24);
+	bool   patched = false;
+	for (uint32_t i = 0; i < sectionCount && !patched; ++i, entryAt += 24) {
+		uint32_t id = 0;
+		uint64_t size = 0;
+		std::memcpy(&id, bytes.data() + entryAt, sizeof(id));
+		std::memcpy(&size, bytes.data() + entryAt + 8, sizeof(size));
+		if (std::memcmp(&id, "TIME", 4) == 0) {
+			const int32_t speed = 99;
+			std::memcpy(bytes.data() + payloadAt + 8, &speed, sizeof(speed));
+			const uint64_t hash = foundation::hashBytes(bytes.data() + payloadAt, static_cast<size_t>(size));
+			std::memcpy(bytes.data() + entryAt + 16, &hash, sizeof(hash));
+			patched = true;
+		}
+		payloadAt += static_cast<size_t>(size);
+	}
+	ASSERT_TRUE(patched);
+
+	ecs::World target;
+	target.registerSystem<ecs::TimeSystem>();
+	ConstructionWorld  targetConstruction;
+	std::istringstream in(bytes, std::ios::binary);
+	const LoadResult   result = loadSave(in, target, targetConstruction, nullptr);
+	EXPECT_FALSE(result.ok);
+	EXPECT_NE(result.error.find("speed"), std::string::npos) << result.error;
+}
+
+TEST_F(SaveGameTest, RefusesToLoadIntoPopulatedWorld) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+	std::istringstream in(save(world, construction, placement), std::ios::binary);
+
+	ecs::World		  target;
+	ConstructionWorld targetConstruction;
+	(void)target.createEntity();
+	EXPECT_FALSE(loadSave(in, target, targetConstruction, nullptr).ok);
+}
+
+TEST_F(SaveGameTest, StateHashPinpointsTheChangedPart) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+
+	const std::vector<StateHash> before = hashState(world, construction);
+	const std::vector<StateHash> same = hashState(world, construction);
+	ASSERT_EQ(before.size(), same.size());
+	for (size_t i = 0; i < before.size(); ++i) {
+		EXPECT_EQ(before[i].hash, same[i].hash) << before[i].name;
+	}
+
+	world.getComponent<ecs::Position>(stack)->value.x += 0.5F;
+	const std::vector<StateHash> after = hashState(world, construction);
+	ASSERT_EQ(after.size(), before.size()) << "empty pools still get an entry, so parts line up";
+	for (size_t i = 0; i < before.size(); ++i) {
+		EXPECT_EQ(after[i].tag, before[i].tag);
+		if (std::string(before[i].name) == "Position") {
+			EXPECT_NE(after[i].hash, before[i].hash);
+		} else {
+			EXPECT_EQ(after[i].hash, before[i].hash) << before[i].name;
+		}
+	}
+}
+
+TEST_F(SaveGameTest, AutosaverReportsEachFinishedWriteOnce) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+
+	const std::filesystem::path dir = std::filesystem::temp_directory_path() / "worldsim_autosaver_test";
+	std::filesystem::remove_all(dir);
+	std::filesystem::create_directories(dir);
+
+	Autosaver autosaver;
+	EXPECT_FALSE(autosaver.poll().has_value()) << "nothing written yet";
+
+	autosaver.setPath(dir / "quick.wssv");
+	autosaver.saveNow(world, construction, &placement);
+	autosaver.wait();
+	auto done = autosaver.poll();
+	ASSERT_TRUE(done.has_value());
+	EXPECT_TRUE(done->ok);
+	EXPECT_TRUE(done->manual);
+	EXPECT_FALSE(autosaver.poll().has_value()) << "a write is reported once";
+
+	// A regular file where the save directory should be: the write fails
+	std::ofstream(dir / "blocker") << "x";
+	autosaver.setPath(dir / "blocker" / "quick.wssv");
+	autosaver.saveNow(world, construction, &placement);
+	autosaver.wait();
+	done = autosaver.poll();
+	ASSERT_TRUE(done.has_value());
+	EXPECT_FALSE(done->ok);
+
+	std::filesystem::remove_all(dir);
+}
+
+TEST_F(SaveGameTest, AutosaverReportsAutosaveAndQuickSaveSeparately) {
+	ecs::World		  world;
+	ConstructionWorld construction;
+	PlacementExecutor placement(AssetRegistry::Get());
+	populate(world, construction, placement);
+
+	const std::filesystem::path dir = std::filesystem::temp_directory_path() / "worldsim_autosaver_overlap_test";
+	std::filesystem::remove_all(dir);
+	std::filesystem::create_directories(dir);
+
+	Autosaver autosaver;
+	autosaver.setPath(dir / "autosave.wssv");
+	autosaver.setInterval(1.0F);
+
+	// F5 while the timed write may still be running: saveNow collects it, then starts its own
+	ASSERT_TRUE(autosaver.update(2.0F, world, construction, &placement));
+	autosaver.saveNow(world, construction, &placement);
+
+	auto done = autosaver.poll();
+	ASSERT_TRUE(done.has_value());
+	EXPECT_TRUE(done->ok);
+	EXPECT_FALSE(done->manual) << "the autosave is reported as itself, not as the quick save";
+
+	autosaver.wait();
+	done = autosaver.poll();
+	ASSERT_TRUE(done.has_value());
+	EXPECT_TRUE(done->ok);
+	EXPECT_TRUE(done->manual);
+	EXPECT_FALSE(autosaver.poll().has_value());
+
+	std::filesystem::remove_all(dir);
+}
+
+}  // namespace
+}  // namespace engine::save
@@ -28,6 +28,28 @@ namespace engine::world {
 		}
 	} // namespace
 
+	TileRenderData makeTileRenderData(uint8_t surfaceId, uint8_t waterDepth, uint64_t adjacency) {
+		TileRenderData render{};
+		render.surfaceId = surfaceId;
+		render.waterDepth = waterDepth; // cosmetic depth for the water shader
+
+		// Pre-compute edge and corner masks
+		render.edgeMask = TileAdjacency::getEdgeMaskByStack(adjacency, surfaceId);
+		render.cornerMask = TileAdjacency::getCornerMaskByStack(adjacency, surfaceId);
+		render.hardEdgeMask = TileAdjacency::getHardEdgeMaskByFamily(adjacency, surfaceId);
+
+		// Pre-extract all neighbor surface IDs
+		render.neighborN = TileAdjacency::getNeighbor(adjacency, TileAdjacency::N);
+		render.neighborE = TileAdjacency::getNeighbor(adjacency, TileAdjacency::E);
+		render.neighborS = TileAdjacency::getNeighbor(adjacency, TileAdjacency::S);
+		render.neighborW = TileAdjacency::getNeighbor(adjacency, TileAdjacency::W);
+		render.neighborNW = TileAdjacency::getNeighbor(adjacency, TileAdjacency::NW);
+		render.neighborNE = TileAdjacency::getNeighbor(adjacency, TileAdjacency::NE);
+		render.neighborSE = TileAdjacency::getNeighbor(adjacency, TileAdjacency::SE);
+		render.neighborSW = TileAdjacency::getNeighbor(adjacency, TileAdjacency::SW);
+		return render;
+	}
+
 	Chunk::Chunk(ChunkCoordinate coord, ChunkSampleResult biomeData, uint64_t worldSeed)
 		: m_coord(coord),
 		  m_biomeData(std::move(biomeData)),
@@ -56,7 +78,7 @@ namespace engine::world {
 		// This avoids per-frame extraction of adjacency data during rendering
 		computeRenderData();
 
-		m_renderDataVersion.fetch_add(1, std::memory_order_release);
+		m_renderDataFullVersion.store(m_renderDataVersion.fetch_add(1, std::memory_order_release) + 1, std::memory_order_release);
 
 		// Mark generation complete (release semantics for thread safety)
 		m_generationComplete.store(true, std::memory_order_release);
@@ -90,31 +112,9 @@ namespace engine::world {
 	}
 
 	void Chunk::computeRenderData() {
-		for (uint16_t y = 0; y < kChunkSize; ++y) {
-			for (uint16_t x = 0; x < kChunkSize; ++x) {
-				size_t		idx = y * kChunkSize + x;
-				const auto& tile = m_tiles[idx];
-				auto&		render = m_renderData[idx];
-
-				uint8_t surfaceId = static_cast<uint8_t>(tile.surface);
-				render.surfaceId = surfaceId;
-				render.waterDepth = tile.waterDepth; // cosmetic depth for the water shader
-
-				// Pre-compute edge and corner masks
-				render.edgeMask = TileAdjacency::getEdgeMaskByStack(tile.adjacency, surfaceId);
-				render.cornerMask = TileAdjacency::getCornerMaskByStack(tile.adjacency, surfaceId);
-				render.hardEdgeMask = TileAdjacency::getHardEdgeMaskByFamily(tile.adjacency, surfaceId);
-
-				// Pre-extract all neighbor surface IDs
-				render.neighborN = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::N);
-				render.neighborE = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::E);
-				render.neighborS = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::S);
-				render.neighborW = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::W);
-				render.neighborNW = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::NW);
-				render.neighborNE = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::NE);
-				render.neighborSE = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::SE);
-				render.neighborSW = TileAdjacency::getNeighbor(tile.adjacency, TileAdjacency::SW);
-			}
+		for (size_t idx = 0; idx < m_tiles.size(); ++idx) {
+			const auto& tile = m_tiles[idx];
+			m_renderData[idx] = makeTileRenderData(static_cast<uint8_t>(tile.surface), tile.waterDepth, tile.adjacency);
 		}
 	}
 
@@ -128,24 +128,13 @@ namespace engine::world {
 
 		// Update pre-computed render data to match new adjacency
 		const auto& tile = m_tiles[idx];
-		auto&		render = m_renderData[idx];
-		uint8_t		surfaceId = static_cast<uint8_t>(tile.surface);
-
-		render.surfaceId = surfaceId;
-		render.waterDepth = tile.waterDepth; // keep cosmetic depth in sync
-		render.edgeMask = TileAdjacency::getEdgeMaskByStack(adjacency, surfaceId);
-		render.cornerMask = TileAdjacency::getCornerMaskByStack(adjacency, surfaceId);
-		render.hardEdgeMask = TileAdjacency::getHardEdgeMaskByFamily(adjacency, surfaceId);
-		render.neighborN = TileAdjacency::getNeighbor(adjacency, TileAdjacency::N);
-		render.neighborE = TileAdjacency::getNeighbor(adjacency, TileAdjacency::E);
-		render.neighborS = TileAdjacency::getNeighbor(adjacency, TileAdjacency::S);
-		render.neighborW = TileAdjacency::getNeighbor(adjacency, TileAdjacency::W);
-		render.neighborNW = TileAdjacency::getNeighbor(adjacency, TileAdjacency::NW);
-		render.neighborNE = TileAdjacency::getNeighbor(adjacency, TileAdjacency::NE);
-		render.neighborSE = TileAdjacency::getNeighbor(adjacency, TileAdjacency::SE);
-		render.neighborSW = TileAdjacency::getNeighbor(adjacency, TileAdjacency::SW);
+		m_renderData[idx] = makeTileRenderData(static_cast<uint8_t>(tile.surface), tile.waterDepth, adjacency);
 
-		m_renderDataVersion.fetch_add(1, std::memory_order_release);
+		const uint32_t version = m_renderDataVersion.fetch_add(1, std::memory_order_release) + 1;
+		const bool	   onBorder = localX == 0 || localY == 0 || localX == kChunkSize - 1 || localY == kChunkSize - 1;
+		if (!onBorder) {
+			m_renderDataFullVersion.store(version, std::memory_order_release);
+		}
 	}
 
 	TileData Chunk::computeTile(uint16_t localX, uint16_t localY) const {
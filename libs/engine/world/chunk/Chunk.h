@@ -90,7 +90,7 @@ struct TileData {
 
 /// Pre-computed tile rendering data - 16 bytes per tile.
 /// Cached during chunk generation to avoid per-frame adjacency extraction.
-/// Used by ChunkRenderer for fast tile rendering.
+/// ChunkRenderer uploads it in a packed form (see TileDataPacking.h).
 struct TileRenderData {
 	uint8_t surfaceId;     ///< Surface type (0-255)
 	uint8_t edgeMask;      ///< Edge shadow mask (N,E,S,W bits)
@@ -108,6 +108,9 @@ struct TileRenderData {
 	uint8_t padding[3];    ///< Pad to 16 bytes for cache alignment
 };
 
+/// Render data for one tile: masks and neighbor ids extracted from its adjacency.
+[[nodiscard]] TileRenderData makeTileRenderData(uint8_t surfaceId, uint8_t waterDepth, uint64_t adjacency);
+
 /// A 512×512 region of the world.
 /// Tiles are pre-computed during generate() and stored in a flat array.
 /// All systems read from the same definitive tile data.
@@ -171,13 +174,19 @@ class Chunk {
 	}
 
 	/// Raw render data array (kChunkSize * kChunkSize entries, row-major).
-	/// Uploaded directly as a GPU tile-data texture by ChunkRenderer.
+	/// Packed into GPU tile-data textures by ChunkRenderer.
 	[[nodiscard]] const TileRenderData* renderData() const { return m_renderData.data(); }
 
 	/// Version counter for render data; bumped by generate() and setAdjacency().
 	/// GPU caches compare this to detect stale uploads.
 	[[nodiscard]] uint32_t renderDataVersion() const { return m_renderDataVersion.load(std::memory_order_acquire); }
 
+	/// Render data version of the last change NOT confined to the outer ring of
+	/// tiles (generation, or setAdjacency off the border). A GPU copy uploaded at
+	/// or after this version is brought current by re-uploading the border alone,
+	/// which is all adjacency stitching touches.
+	[[nodiscard]] uint32_t renderDataFullVersion() const { return m_renderDataFullVersion.load(std::memory_order_acquire); }
+
   private:
 	ChunkCoordinate m_coord;
 	ChunkSampleResult m_biomeData;
@@ -196,6 +205,7 @@ class Chunk {
 
 	/// Bumped whenever m_renderData changes (generation, adjacency updates)
 	std::atomic<uint32_t> m_renderDataVersion{0};
+	std::atomic<uint32_t> m_renderDataFullVersion{0};
 
 	/// Cached shore tile positions (land tiles adjacent to water)
 	/// Computed during generation, used by VisionSystem for fast shore discovery
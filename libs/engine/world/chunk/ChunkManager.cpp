@@ -1,5 +1,6 @@
 #include "ChunkManager.h"
 
+#include <threading/JobSystem.h>
 #include <utils/Log.h>
 
 #include <algorithm>
@@ -12,6 +13,16 @@ namespace engine::world {
 	ChunkManager::ChunkManager(std::unique_ptr<IWorldSampler> sampler)
 		: m_sampler(std::move(sampler)) {}
 
+	ChunkManager::~ChunkManager() {
+		// JobSystem futures do not block on destruction (std::async's did), so
+		// wait explicitly before m_chunks frees what the workers are writing.
+		for (auto& [coord, future] : m_generating) {
+			if (future.valid()) {
+				future.wait();
+			}
+		}
+	}
+
 	void ChunkManager::update(WorldPosition cameraCenter) {
 		// Integrate any chunks whose generation worker finished
 		pollGeneratedChunks();
@@ -106,7 +117,10 @@ namespace engine::world {
 		// pollGeneratedChunks() once the worker finishes.
 		Chunk* rawChunk = chunk.get();
 		m_chunks[coord] = std::move(chunk);
-		m_generating.emplace_back(coord, std::async(std::launch::async, [rawChunk]() { rawChunk->generate(); }));
+		m_generating.emplace_back(
+			coord,
+			foundation::JobSystem::shared().submit([rawChunk]() { rawChunk->generate(); }, foundation::JobPriority::High)
+		);
 
 		LOG_DEBUG(Engine, "Loading chunk (%d, %d)", coord.x, coord.y);
 	}
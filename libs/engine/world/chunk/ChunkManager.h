@@ -32,7 +32,9 @@ class ChunkManager {
 	ChunkManager(ChunkManager&&) = default;
 	ChunkManager& operator=(ChunkManager&&) = default;
 
-	~ChunkManager() = default;
+	/// Blocks until in-flight tile generation finishes (workers hold raw
+	/// pointers into m_chunks).
+	~ChunkManager();
 
 	/// Update loaded chunks based on camera position.
 	/// Loads new chunks within load radius, unloads chunks outside unload radius.
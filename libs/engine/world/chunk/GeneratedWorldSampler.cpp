@@ -1,5 +1,7 @@
 #include "GeneratedWorldSampler.h"
 
+#include <vector>
+
 namespace engine::world {
 
 	GeneratedWorldSampler::GeneratedWorldSampler(std::shared_ptr<const worldgen::GeneratedWorld> world,
@@ -31,15 +33,17 @@ namespace engine::world {
 	ChunkSampleResult GeneratedWorldSampler::sampleChunk(ChunkCoordinate coord) const {
 		ChunkSampleResult result;
 
-		result.cornerBiomes[0] = sampleBiomeAt(coord.corner(ChunkCorner::NorthWest));
-		result.cornerBiomes[1] = sampleBiomeAt(coord.corner(ChunkCorner::NorthEast));
-		result.cornerBiomes[2] = sampleBiomeAt(coord.corner(ChunkCorner::SouthWest));
-		result.cornerBiomes[3] = sampleBiomeAt(coord.corner(ChunkCorner::SouthEast));
-
-		result.cornerElevations[0] = sampleElevation(coord.corner(ChunkCorner::NorthWest));
-		result.cornerElevations[1] = sampleElevation(coord.corner(ChunkCorner::NorthEast));
-		result.cornerElevations[2] = sampleElevation(coord.corner(ChunkCorner::SouthWest));
-		result.cornerElevations[3] = sampleElevation(coord.corner(ChunkCorner::SouthEast));
+		// The four corners as one 2x2 batch, row-major from the origin: NW, NE,
+		// SW, SE (matching the cornerBiomes order). Biome and elevation come
+		// from the same sample, so each corner is located once.
+		const WorldPosition nw = coord.corner(ChunkCorner::NorthWest);
+		const double		chunkExtent = static_cast<double>(kChunkSize) * static_cast<double>(kTileSize);
+		std::vector<worldgen::PlanetSampler::PositionSample> corners;
+		sampler.sampleGrid(static_cast<double>(nw.x), static_cast<double>(nw.y), chunkExtent, 2, 2, corners);
+		for (size_t i = 0; i < corners.size(); ++i) {
+			result.cornerBiomes[i] = toBiomeWeights(corners[i]);
+			result.cornerElevations[i] = corners[i].elevationMeters;
+		}
 
 		result.computeSectorGrid();
 
@@ -61,8 +65,7 @@ namespace engine::world {
 		return sampler.elevationAt(static_cast<double>(pos.x), static_cast<double>(pos.y));
 	}
 
-	BiomeWeights GeneratedWorldSampler::sampleBiomeAt(WorldPosition pos) const {
-		auto sample = sampler.sampleAt(static_cast<double>(pos.x), static_cast<double>(pos.y));
+	BiomeWeights GeneratedWorldSampler::toBiomeWeights(const worldgen::PlanetSampler::PositionSample& sample) {
 		BiomeWeights weights;
 		for (uint32_t i = 0; i < sample.weightCount; ++i)
 			weights.set(sample.weights[i].biome, sample.weights[i].weight);
@@ -32,7 +32,7 @@ class GeneratedWorldSampler : public IWorldSampler {
 	[[nodiscard]] uint64_t getWorldSeed() const override { return sampler.seed(); }
 
   private:
-	[[nodiscard]] BiomeWeights sampleBiomeAt(WorldPosition pos) const;
+	[[nodiscard]] static BiomeWeights toBiomeWeights(const worldgen::PlanetSampler::PositionSample& sample);
 
 	worldgen::PlanetSampler sampler;
 	// Present only when the world carries drainage data (FlowAccum + Downhill).
@@ -9,6 +9,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <primitives/BatchRenderer.h>
 #include <primitives/Primitives.h>
+#include <threading/JobSystem.h>
 
 namespace engine::world {
 
@@ -42,17 +43,13 @@ namespace engine::world {
 		auto&  subChunk = bakedData.subChunks[subIndex];
 		size_t bytesUploaded = 0;
 
-		subChunk.minX = cpu.minX;
-		subChunk.minY = cpu.minY;
-		subChunk.maxX = cpu.maxX;
-		subChunk.maxY = cpu.maxY;
-
 		for (int bucketIndex = 0; bucketIndex < kFloraBucketCount; ++bucketIndex) {
 			auto& cpuBucket = cpu.buckets[bucketIndex];
 			auto& gpuBucket = subChunk.buckets[bucketIndex];
 
 			gpuBucket.entityCount = cpuBucket.entityCount;
 			gpuBucket.maxEntityHeight = cpuBucket.maxEntityHeight;
+			gpuBucket.pointVertexStart = cpuBucket.pointVertexStart;
 
 			if (cpuBucket.vertices.empty()) {
 				gpuBucket.indexCount = 0;
@@ -94,6 +91,7 @@ namespace engine::world {
 		BakedChunkData bakedData;
 		bakedData.lastAccessFrame = frameCounter;
 		bakedData.totalEntityCount = cpuData.totalEntityCount;
+		bakedData.cullTree = std::move(cpuData.cullTree);
 
 		for (int subIndex = 0; subIndex < kSubChunkCount; ++subIndex) {
 			uploadSubChunk(bakedData, cpuData.subChunks[subIndex], subIndex);
@@ -108,6 +106,7 @@ namespace engine::world {
 		BakedChunkData bakedData;
 		bakedData.lastAccessFrame = frameCounter;
 		bakedData.totalEntityCount = cpuData.totalEntityCount;
+		bakedData.cullTree = std::move(cpuData.cullTree);
 		m_bakedChunkCache[coord] = std::move(bakedData);
 
 		m_pendingUploads.push_back(PendingUpload{coord, std::move(cpuData), 0});
@@ -151,6 +150,36 @@ namespace engine::world {
 	void BakedChunkRenderer::releaseBakedChunkCache(const ChunkCoordinate& coord) {
 		// RAII wrappers automatically release GPU resources when destroyed
 		m_bakedChunkCache.erase(coord);
+		m_chunkListCount = 0; // Lists may point at the erased entry
+	}
+
+	void BakedChunkRenderer::buildDrawLists(const RenderContext& ctx) {
+		// Gather the cached chunks serially (LRU timestamps, map lookups), then
+		// walk their cull trees in parallel: each chunk owns its range list.
+		m_chunkListCount = 0;
+		for (const auto& coord : ctx.processedChunks) {
+			auto cacheIt = m_bakedChunkCache.find(coord);
+			if (cacheIt == m_bakedChunkCache.end()) {
+				continue; // Not cached yet - will be built next frame
+			}
+			cacheIt->second.lastAccessFrame = ctx.frameCounter; // Update LRU timestamp
+			if (m_chunkListCount == m_chunkLists.size()) {
+				m_chunkLists.emplace_back();
+			}
+			m_chunkLists[m_chunkListCount++].chunk = &cacheIt->second;
+		}
+
+		// Cull tree query: view bounds + on-screen size
+		const float			zoom = ctx.camera.zoom();
+		const VisibleBounds vis = computeVisibleBounds(ctx.camera, ctx.viewportWidth, ctx.viewportHeight, ctx.pixelsPerMeter);
+		const BakedCullView view{vis.minX, vis.minY, vis.maxX, vis.maxY, ctx.pixelsPerMeter * zoom};
+		foundation::JobSystem::shared().parallelFor(0, m_chunkListCount, 1, [this, &view](size_t begin, size_t end) {
+			for (size_t c = begin; c < end; ++c) {
+				auto& list = m_chunkLists[c];
+				list.ranges.clear();
+				collectBakedDrawRanges(list.chunk->cullTree, view, list.ranges);
+			}
+		});
 	}
 
 	void BakedChunkRenderer::renderBakedChunks(const RenderContext& ctx, InstancingUniforms& uniforms, RenderStats& stats) {
@@ -165,11 +194,9 @@ namespace engine::world {
 		// Set viewport on BatchRenderer
 		batchRenderer->setViewport(ctx.viewportWidth, ctx.viewportHeight);
 
-		// Calculate visible world bounds for sub-chunk culling
 		float zoom = ctx.camera.zoom();
 		float camX = ctx.camera.position().x;
 		float camY = ctx.camera.position().y;
-		VisibleBounds vis = computeVisibleBounds(ctx.camera, ctx.viewportWidth, ctx.viewportHeight, ctx.pixelsPerMeter);
 
 		// Save GL state before modifying
 		GLboolean blendEnabled = glIsEnabled(GL_BLEND);
@@ -214,47 +241,51 @@ namespace engine::world {
 			glUniform1f(uniforms.bakedAlpha, currentAlpha);
 		}
 
-		// Draw visible sub-chunks from each cached chunk
-		for (const auto& coord : ctx.processedChunks) {
-			auto cacheIt = m_bakedChunkCache.find(coord);
-			if (cacheIt == m_bakedChunkCache.end()) {
-				continue; // Not cached yet - will be built next frame
-			}
-
-			auto& cache = cacheIt->second;
-			cache.lastAccessFrame = ctx.frameCounter; // Update LRU timestamp
+		// Draw the ranges buildDrawLists() collected for each cached chunk
+		for (size_t c = 0; c < m_chunkListCount; ++c) {
+			const auto& cache = *m_chunkLists[c].chunk;
+			for (const auto& range : m_chunkLists[c].ranges) {
+				const auto& bucket = cache.subChunks[range.subChunk].buckets[range.bucket];
+				if (bucket.indexCount == 0) {
+					continue; // Not uploaded yet (budgeted upload in progress)
+				}
 
-			// Check each sub-chunk for visibility
-			for (const auto& subChunk : cache.subChunks) {
-				// AABB intersection test: is sub-chunk visible?
-				if (subChunk.maxX < vis.minX || subChunk.minX > vis.maxX || subChunk.maxY < vis.minY || subChunk.minY > vis.maxY) {
-					continue; // Sub-chunk is completely off-screen
+				// Short flora fades across a band from kImpostorCutoffPx to 2x
+				// that and is skipped below it, where the grass tile texture
+				// takes over. Tall flora has no texture stand-in, so it stays
+				// opaque at every zoom and collapses to points under
+				// kPointImpostorMaxPx instead of fading out (see bakedBucketDraws).
+				float screenHeightPx = bucket.maxEntityHeight * pixelsPerWorldMeter;
+				float alpha = range.bucket == kTallFloraBucket
+								  ? 1.0F
+								  : std::clamp((screenHeightPx - kImpostorCutoffPx) / kImpostorCutoffPx, 0.0F, 1.0F);
+				if (alpha <= 0.0F) {
+					continue;
+				}
+				if (alpha != currentAlpha && uniforms.bakedAlpha >= 0) {
+					glUniform1f(uniforms.bakedAlpha, alpha);
+					currentAlpha = alpha;
 				}
 
-				for (const auto& bucket : subChunk.buckets) {
-					if (bucket.indexCount == 0) {
-						continue; // Empty bucket
-					}
-
-					// Cutoff with a fade band from kImpostorCutoffPx to 2x that.
-					// Tall flora's maxEntityHeight keeps it drawn far past the
-					// zoom where grass hands off to the tile texture.
-					float screenHeightPx = bucket.maxEntityHeight * pixelsPerWorldMeter;
-					float alpha = std::clamp((screenHeightPx - kImpostorCutoffPx) / kImpostorCutoffPx, 0.0F, 1.0F);
-					if (alpha <= 0.0F) {
-						continue;
-					}
-					if (alpha != currentAlpha && uniforms.bakedAlpha >= 0) {
-						glUniform1f(uniforms.bakedAlpha, alpha);
-						currentAlpha = alpha;
-					}
-
-					stats.entities += bucket.entityCount;
-					stats.drawCalls++;
-					stats.triangles += bucket.indexCount / 3;
-					bucket.vao.bind();
-					glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(bucket.indexCount), GL_UNSIGNED_INT, nullptr);
+				stats.entities += range.entityCount;
+				stats.drawCalls++;
+				bucket.vao.bind();
+
+				// Tall flora under a couple of pixels: one point per entity
+				if (range.bucket == kTallFloraBucket && screenHeightPx < kPointImpostorMaxPx) {
+					glDrawArrays(
+						GL_POINTS, static_cast<GLint>(bucket.pointVertexStart + range.firstEntity), static_cast<GLsizei>(range.entityCount)
+					);
+					continue;
 				}
+
+				stats.triangles += range.indexCount / 3;
+				glDrawElements(
+					GL_TRIANGLES,
+					static_cast<GLsizei>(range.indexCount),
+					GL_UNSIGNED_INT,
+					reinterpret_cast<const void*>(static_cast<uintptr_t>(range.firstIndex) * sizeof(uint32_t))
+				);
 			}
 		}
 
@@ -3,7 +3,9 @@
 // BakedChunkRenderer - Baked static-entity path with sub-chunk culling.
 // Entity vertices are pre-transformed to world space once per chunk (on a
 // worker thread via AsyncChunkProcessor, or on the render thread when an
-// evicted chunk is revisited). Sub-regions are culled against the viewport.
+// evicted chunk is revisited). A per-chunk quadtree (BakedCullTree) culls
+// against the viewport down to quarter-sub-chunk cells and drops quadrants
+// whose flora is too small on screen; tiny tall flora draws as points.
 // CPU bake types/constants live in BakedEntityMesh.h.
 
 #include "assets/placement/PlacementExecutor.h"
@@ -56,7 +58,12 @@ class BakedChunkRenderer {
 		return m_bakedChunkCache.find(coord) == m_bakedChunkCache.end();
 	}
 
+	/// Extract phase: cull each processed chunk's tree into its draw list, in
+	/// parallel on the JobSystem. GL-free; call after this frame's uploads.
+	void buildDrawLists(const RenderContext& ctx);
+
 	/// Render static entities using baked per-chunk meshes (glDrawElements, no instancing).
+	/// Submits the lists from buildDrawLists() (same frame, no evictions in between).
 	void renderBakedChunks(const RenderContext& ctx, InstancingUniforms& uniforms, RenderStats& stats);
 
 	/// LRU cache eviction. Keep recently-used chunks cached even when not visible,
@@ -83,19 +90,19 @@ class BakedChunkRenderer {
 		Renderer::GLBuffer indexIBO;     // Combined indices
 		uint32_t indexCount = 0;         // Total indices in IBO
 		uint32_t entityCount = 0;        // For debugging/metrics
-		float maxEntityHeight = 0.0F;    // Drives the far-zoom cutoff (short bucket)
+		float maxEntityHeight = 0.0F;    // Drives the far-zoom cutoff (short) / point impostors (tall)
+		uint32_t pointVertexStart = 0;   // Tall bucket: one point impostor vertex per entity from here
 	};
 
 	/// GPU resources for a single sub-region's baked entity meshes.
 	struct BakedSubChunkData {
 		std::array<BakedMeshGPU, kFloraBucketCount> buckets;
-		float minX = 0, minY = 0;        // World-space bounds for culling
-		float maxX = 0, maxY = 0;
 	};
 
 	/// GPU resources for a chunk, subdivided into sub-regions.
 	struct BakedChunkData {
 		std::array<BakedSubChunkData, kSubChunkCount> subChunks;
+		BakedCullTree cullTree;          // Bounds/ranges for view and zoom culling
 		uint32_t totalEntityCount = 0;   // For debugging/metrics
 		uint64_t lastAccessFrame = 0;    // For LRU eviction
 	};
@@ -115,6 +122,17 @@ class BakedChunkRenderer {
 	// Memoized template meshes (keyed by defName)
 	TemplateMeshCache m_templateCache;
 
+	/// One cached chunk's draw ranges for this frame.
+	struct ChunkDrawList {
+		const BakedChunkData* chunk = nullptr;
+		std::vector<BakedDrawRange> ranges;
+	};
+
+	// Per-chunk draw lists from the cull trees; [0, m_chunkListCount) hold this
+	// frame's (entries reused across frames to keep their capacity)
+	std::vector<ChunkDrawList> m_chunkLists;
+	size_t m_chunkListCount = 0;
+
 	/// Upload a single sub-chunk's buffers into an existing cache entry.
 	/// @return Bytes of vertex+index data uploaded
 	size_t uploadSubChunk(BakedChunkData& bakedData, BakedSubChunkCPUData& cpu, int subIndex);
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <unordered_map>
 
 namespace engine::world {
@@ -13,26 +14,16 @@ namespace engine::world {
 	) {
 		BakedChunkCPUData data;
 		WorldPosition	  chunkOrigin = coord.origin();
+		data.cullTree.reset();
 
-		// Sub-chunk bounds (set even for empty sub-chunks so culling data is valid)
-		for (int subY = 0; subY < kSubChunkGridSize; ++subY) {
-			for (int subX = 0; subX < kSubChunkGridSize; ++subX) {
-				auto& subChunk = data.subChunks[subY * kSubChunkGridSize + subX];
-				subChunk.minX = chunkOrigin.x + static_cast<float>(subX) * kSubChunkWorldSize;
-				subChunk.minY = chunkOrigin.y + static_cast<float>(subY) * kSubChunkWorldSize;
-				subChunk.maxX = subChunk.minX + kSubChunkWorldSize;
-				subChunk.maxY = subChunk.minY + kSubChunkWorldSize;
-			}
-		}
-
-		// Bin entities by sub-chunk
-		std::array<std::vector<const assets::PlacedEntity*>, kSubChunkCount> bins;
+		// Bin entities by cull tree leaf cell
+		std::vector<std::vector<const assets::PlacedEntity*>> bins(static_cast<size_t>(kCullTreeLeafGridSize) * kCullTreeLeafGridSize);
 		for (const auto* entity : entities) {
-			int subX = static_cast<int>((entity->position.x - chunkOrigin.x) / kSubChunkWorldSize);
-			int subY = static_cast<int>((entity->position.y - chunkOrigin.y) / kSubChunkWorldSize);
-			subX = std::clamp(subX, 0, kSubChunkGridSize - 1);
-			subY = std::clamp(subY, 0, kSubChunkGridSize - 1);
-			bins[subY * kSubChunkGridSize + subX].push_back(entity);
+			int cellX = static_cast<int>((entity->position.x - chunkOrigin.x) / kCullTreeLeafWorldSize);
+			int cellY = static_cast<int>((entity->position.y - chunkOrigin.y) / kCullTreeLeafWorldSize);
+			cellX = std::clamp(cellX, 0, kCullTreeLeafGridSize - 1);
+			cellY = std::clamp(cellY, 0, kCullTreeLeafGridSize - 1);
+			bins[static_cast<size_t>(cellY) * kCullTreeLeafGridSize + cellX].push_back(entity);
 		}
 
 		// Template mesh height cache (template Y extent, before entity scale)
@@ -56,85 +47,296 @@ namespace engine::world {
 			return height;
 		};
 
-		// Transform each bin into world-space vertices, split by height bucket
+		// Transform each sub-chunk's cells into world-space vertices, split by
+		// height bucket. Cells are visited in quadtree (Morton) order so every
+		// cull tree node's entities are contiguous in each bucket.
+		constexpr int kCellsPerSubChunkSide = kCullTreeLeafGridSize / kSubChunkGridSize;
+		std::vector<BakedVertex> points;
 		for (int subIndex = 0; subIndex < kSubChunkCount; ++subIndex) {
-			const auto& bin = bins[subIndex];
-			if (bin.empty()) {
-				continue;
-			}
+			const int subX = subIndex % kSubChunkGridSize;
+			const int subY = subIndex / kSubChunkGridSize;
 
 			auto&					subChunk = data.subChunks[subIndex];
 			std::array<uint32_t, 2> vertexOffsets{0, 0};
+			points.clear();
 
-			for (const auto* entity : bin) {
-				const auto* templateMesh = getTemplate(entity->defName);
-				if (templateMesh == nullptr) {
-					continue;
+			for (int morton = 0; morton < kCellsPerSubChunkSide * kCellsPerSubChunkSide; ++morton) {
+				int localX = 0;
+				int localY = 0;
+				for (int bit = 0; (1 << bit) < kCellsPerSubChunkSide; ++bit) {
+					localX |= ((morton >> (2 * bit)) & 1) << bit;
+					localY |= ((morton >> (2 * bit + 1)) & 1) << bit;
 				}
+				const int cellX = subX * kCellsPerSubChunkSide + localX;
+				const int cellY = subY * kCellsPerSubChunkSide + localY;
 
-				float entityScale = entity->scale;
-				float worldHeight = templateHeight(templateMesh) * entityScale;
-				int	  bucketIndex = (worldHeight < kShortFloraMaxHeight) ? kShortFloraBucket : kTallFloraBucket;
-				auto& bucket = subChunk.buckets[bucketIndex];
-				auto& vertexOffset = vertexOffsets[bucketIndex];
-				bucket.maxEntityHeight = std::max(bucket.maxEntityHeight, worldHeight);
-
-				float posX = entity->position.x;
-				float posY = entity->position.y;
-				bool  hasMeshColors = templateMesh->hasColors();
-
-				constexpr float kRotationEpsilon = 0.0001F;
-				bool			noRotation = std::abs(entity->rotation) < kRotationEpsilon;
-
-				float cosR = 1.0F;
-				float sinR = 0.0F;
-				if (!noRotation) {
-					cosR = std::cos(entity->rotation);
-					sinR = std::sin(entity->rotation);
+				auto& leaf = data.cullTree.node(kCullTreeLeafLevel, cellX, cellY);
+				for (int bucketIndex = 0; bucketIndex < kFloraBucketCount; ++bucketIndex) {
+					leaf.buckets[bucketIndex].firstIndex = static_cast<uint32_t>(subChunk.buckets[bucketIndex].indices.size());
+					leaf.buckets[bucketIndex].firstEntity = subChunk.buckets[bucketIndex].entityCount;
 				}
+				leaf.minX = leaf.minY = std::numeric_limits<float>::max();
+				leaf.maxX = leaf.maxY = std::numeric_limits<float>::lowest();
+
+				for (const auto* entity : bins[static_cast<size_t>(cellY) * kCullTreeLeafGridSize + cellX]) {
+					const auto* templateMesh = getTemplate(entity->defName);
+					if (templateMesh == nullptr || templateMesh->vertices.empty()) {
+						continue;
+					}
+
+					float entityScale = entity->scale;
+					float worldHeight = templateHeight(templateMesh) * entityScale;
+					int	  bucketIndex = (worldHeight < kShortFloraMaxHeight) ? kShortFloraBucket : kTallFloraBucket;
+					auto& bucket = subChunk.buckets[bucketIndex];
+					auto& vertexOffset = vertexOffsets[bucketIndex];
+					bucket.maxEntityHeight = std::max(bucket.maxEntityHeight, worldHeight);
+					leaf.buckets[bucketIndex].maxEntityHeight = std::max(leaf.buckets[bucketIndex].maxEntityHeight, worldHeight);
+
+					float posX = entity->position.x;
+					float posY = entity->position.y;
+					bool  hasMeshColors = templateMesh->hasColors();
+
+					constexpr float kRotationEpsilon = 0.0001F;
+					bool			noRotation = std::abs(entity->rotation) < kRotationEpsilon;
+
+					float cosR = 1.0F;
+					float sinR = 0.0F;
+					if (!noRotation) {
+						cosR = std::cos(entity->rotation);
+						sinR = std::sin(entity->rotation);
+					}
+
+					// Entity extent and mean color, for the cull bounds and its point impostor
+					float entityMinX = std::numeric_limits<float>::max();
+					float entityMinY = std::numeric_limits<float>::max();
+					float entityMaxX = std::numeric_limits<float>::lowest();
+					float entityMaxY = std::numeric_limits<float>::lowest();
+					float colorSum[4] = {0.0F, 0.0F, 0.0F, 0.0F};
+
+					for (size_t i = 0; i < templateMesh->vertices.size(); ++i) {
+						const auto& v = templateMesh->vertices[i];
+						BakedVertex baked;
+
+						float sx = v.x * entityScale;
+						float sy = v.y * entityScale;
+
+						if (noRotation) {
+							baked.position.x = sx + posX;
+							baked.position.y = sy + posY;
+						} else {
+							baked.position.x = sx * cosR - sy * sinR + posX;
+							baked.position.y = sx * sinR + sy * cosR + posY;
+						}
 
-				for (size_t i = 0; i < templateMesh->vertices.size(); ++i) {
-					const auto& v = templateMesh->vertices[i];
-					BakedVertex baked;
+						if (hasMeshColors) {
+							const auto& meshColor = templateMesh->colors[i];
+							baked.color = Foundation::Color(
+								meshColor.r * entity->colorTint.r,
+								meshColor.g * entity->colorTint.g,
+								meshColor.b * entity->colorTint.b,
+								meshColor.a * entity->colorTint.a
+							);
+						} else {
+							baked.color = Foundation::Color(entity->colorTint);
+						}
 
-					float sx = v.x * entityScale;
-					float sy = v.y * entityScale;
+						entityMinX = std::min(entityMinX, baked.position.x);
+						entityMinY = std::min(entityMinY, baked.position.y);
+						entityMaxX = std::max(entityMaxX, baked.position.x);
+						entityMaxY = std::max(entityMaxY, baked.position.y);
+						colorSum[0] += baked.color.r;
+						colorSum[1] += baked.color.g;
+						colorSum[2] += baked.color.b;
+						colorSum[3] += baked.color.a;
 
-					if (noRotation) {
-						baked.position.x = sx + posX;
-						baked.position.y = sy + posY;
-					} else {
-						baked.position.x = sx * cosR - sy * sinR + posX;
-						baked.position.y = sx * sinR + sy * cosR + posY;
+						bucket.vertices.push_back(baked);
 					}
 
-					if (hasMeshColors) {
-						const auto& meshColor = templateMesh->colors[i];
-						baked.color = Foundation::Color(
-							meshColor.r * entity->colorTint.r,
-							meshColor.g * entity->colorTint.g,
-							meshColor.b * entity->colorTint.b,
-							meshColor.a * entity->colorTint.a
+					for (const auto& idx : templateMesh->indices) {
+						bucket.indices.push_back(vertexOffset + idx);
+					}
+
+					const float vertexCount = static_cast<float>(templateMesh->vertices.size());
+					if (bucketIndex == kTallFloraBucket) {
+						BakedVertex point;
+						point.position = Foundation::Vec2((entityMinX + entityMaxX) * 0.5F, (entityMinY + entityMaxY) * 0.5F);
+						point.color = Foundation::Color(
+							colorSum[0] / vertexCount, colorSum[1] / vertexCount, colorSum[2] / vertexCount, colorSum[3] / vertexCount
 						);
-					} else {
-						baked.color = Foundation::Color(entity->colorTint);
+						points.push_back(point);
 					}
+					leaf.minX = std::min(leaf.minX, entityMinX);
+					leaf.minY = std::min(leaf.minY, entityMinY);
+					leaf.maxX = std::max(leaf.maxX, entityMaxX);
+					leaf.maxY = std::max(leaf.maxY, entityMaxY);
 
-					bucket.vertices.push_back(baked);
+					vertexOffset += static_cast<uint32_t>(templateMesh->vertices.size());
+					bucket.entityCount++;
 				}
 
-				for (const auto& idx : templateMesh->indices) {
-					bucket.indices.push_back(vertexOffset + idx);
+				for (int bucketIndex = 0; bucketIndex < kFloraBucketCount; ++bucketIndex) {
+					auto& range = leaf.buckets[bucketIndex];
+					range.indexCount = static_cast<uint32_t>(subChunk.buckets[bucketIndex].indices.size()) - range.firstIndex;
+					range.entityCount = subChunk.buckets[bucketIndex].entityCount - range.firstEntity;
+				}
+				if (leaf.empty()) {
+					leaf.minX = leaf.minY = leaf.maxX = leaf.maxY = 0.0F;
 				}
-
-				vertexOffset += static_cast<uint32_t>(templateMesh->vertices.size());
-				bucket.entityCount++;
 			}
 
+			// Point impostors go after the tall bucket's mesh vertices, one per entity in bake order
+			auto& tall = subChunk.buckets[kTallFloraBucket];
+			tall.pointVertexStart = static_cast<uint32_t>(tall.vertices.size());
+			tall.vertices.insert(tall.vertices.end(), points.begin(), points.end());
+
 			data.totalEntityCount += subChunk.buckets[kShortFloraBucket].entityCount + subChunk.buckets[kTallFloraBucket].entityCount;
 		}
 
+		data.cullTree.buildInteriorNodes();
 		return data;
 	}
 
+	void BakedCullTree::buildInteriorNodes() {
+		for (int level = kCullTreeLeafLevel - 1; level >= 0; --level) {
+			const int side = 1 << level;
+			for (int y = 0; y < side; ++y) {
+				for (int x = 0; x < side; ++x) {
+					auto& parent = node(level, x, y);
+					parent = BakedCullNode{};
+					bool hasBounds = false;
+
+					// Children in quadtree order; the first holds each range's start
+					for (int child = 0; child < 4; ++child) {
+						const auto& c = node(level + 1, 2 * x + (child & 1), 2 * y + (child >> 1));
+						for (int bucketIndex = 0; bucketIndex < kFloraBucketCount; ++bucketIndex) {
+							auto&		range = parent.buckets[bucketIndex];
+							const auto& childRange = c.buckets[bucketIndex];
+							if (child == 0) {
+								range.firstIndex = childRange.firstIndex;
+								range.firstEntity = childRange.firstEntity;
+							}
+							range.indexCount += childRange.indexCount;
+							range.entityCount += childRange.entityCount;
+							range.maxEntityHeight = std::max(range.maxEntityHeight, childRange.maxEntityHeight);
+						}
+						if (c.empty()) {
+							continue;
+						}
+						if (!hasBounds) {
+							parent.minX = c.minX;
+							parent.minY = c.minY;
+							parent.maxX = c.maxX;
+							parent.maxY = c.maxY;
+							hasBounds = true;
+						} else {
+							parent.minX = std::min(parent.minX, c.minX);
+							parent.minY = std::min(parent.minY, c.minY);
+							parent.maxX = std::max(parent.maxX, c.maxX);
+							parent.maxY = std::max(parent.maxY, c.maxY);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	namespace {
+
+		bool intersects(const BakedCullNode& node, const BakedCullView& view) {
+			return node.maxX >= view.minX && node.minX <= view.maxX && node.maxY >= view.minY && node.minY <= view.maxY;
+		}
+
+		bool containedIn(const BakedCullNode& node, const BakedCullView& view) {
+			return node.minX >= view.minX && node.maxX <= view.maxX && node.minY >= view.minY && node.maxY <= view.maxY;
+		}
+
+		void appendRange(std::vector<BakedDrawRange>& out, int subChunk, int bucket, const BakedCullRange& range) {
+			if (!out.empty()) {
+				auto& last = out.back();
+				if (last.subChunk == subChunk && last.bucket == bucket && last.firstIndex + last.indexCount == range.firstIndex) {
+					last.indexCount += range.indexCount;
+					last.entityCount += range.entityCount;
+					return;
+				}
+			}
+			out.push_back(BakedDrawRange{
+				static_cast<uint16_t>(subChunk),
+				static_cast<uint16_t>(bucket),
+				range.firstIndex,
+				range.indexCount,
+				range.firstEntity,
+				range.entityCount
+			});
+		}
+
+		/// Within one sub-chunk: emit one bucket's visible ranges
+		void collectBucket(
+			const BakedCullTree& tree, const BakedCullView& view, int level, int x, int y, int subChunk, int bucket, bool inside,
+			std::vector<BakedDrawRange>& out
+		) {
+			const auto& node = tree.node(level, x, y);
+			if (node.buckets[bucket].entityCount == 0) {
+				return;
+			}
+			if (!inside) {
+				if (!intersects(node, view)) {
+					return;
+				}
+				inside = containedIn(node, view);
+			}
+			if (inside || level == kCullTreeLeafLevel) {
+				appendRange(out, subChunk, bucket, node.buckets[bucket]);
+				return;
+			}
+			for (int child = 0; child < 4; ++child) {
+				collectBucket(tree, view, level + 1, 2 * x + (child & 1), 2 * y + (child >> 1), subChunk, bucket, inside, out);
+			}
+		}
+
+		/// Down to the sub-chunk level: reject quadrants by view and by on-screen size
+		void collectQuadrant(
+			const BakedCullTree& tree, const BakedCullView& view, int level, int x, int y, bool inside, std::vector<BakedDrawRange>& out
+		) {
+			const auto&							node = tree.node(level, x, y);
+			std::array<bool, kFloraBucketCount> draws{};
+			bool								anyDraws = false;
+			for (int bucketIndex = 0; bucketIndex < kFloraBucketCount; ++bucketIndex) {
+				const auto& range = node.buckets[bucketIndex];
+				draws[bucketIndex] =
+					range.entityCount > 0 && bakedBucketDraws(bucketIndex, range.maxEntityHeight, view.pixelsPerWorldMeter);
+				anyDraws = anyDraws || draws[bucketIndex];
+			}
+			if (!anyDraws) {
+				return;
+			}
+			if (!inside) {
+				if (!intersects(node, view)) {
+					return;
+				}
+				inside = containedIn(node, view);
+			}
+
+			if (level == kCullTreeSubChunkLevel) {
+				const int subChunk = y * kSubChunkGridSize + x;
+				for (int bucketIndex = 0; bucketIndex < kFloraBucketCount; ++bucketIndex) {
+					if (draws[bucketIndex]) {
+						collectBucket(tree, view, level, x, y, subChunk, bucketIndex, inside, out);
+					}
+				}
+				return;
+			}
+			for (int child = 0; child < 4; ++child) {
+				collectQuadrant(tree, view, level + 1, 2 * x + (child & 1), 2 * y + (child >> 1), inside, out);
+			}
+		}
+
+	} // namespace
+
+	void collectBakedDrawRanges(const BakedCullTree& tree, const BakedCullView& view, std::vector<BakedDrawRange>& out) {
+		if (!tree.isValid()) {
+			return;
+		}
+		collectQuadrant(tree, view, 0, 0, 0, false, out);
+	}
+
 } // namespace engine::world
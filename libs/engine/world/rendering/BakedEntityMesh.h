@@ -39,6 +39,22 @@ inline constexpr int kTallFloraBucket = 1;
 inline constexpr float kShortFloraMaxHeight = 1.0F; // meters; bucket split point
 inline constexpr float kImpostorCutoffPx = 3.0F;	// on-screen height where short flora fades out
 
+/// Tall flora whose on-screen height falls below this draws as one point per
+/// entity (baked after its mesh vertices) instead of full geometry; at that
+/// size the triangles rasterize to the same pixel or two anyway.
+inline constexpr float kPointImpostorMaxPx = 2.0F;
+
+/// Cull tree: a quadtree over each chunk, from the whole chunk down to cells
+/// a quarter of a sub-chunk wide (32x32 cells per chunk). Within a sub-chunk,
+/// entities are baked in quadtree (Morton) order, so every node at or below
+/// the sub-chunk level covers one contiguous index range per bucket and a
+/// close zoom draws just the visible cells instead of whole sub-chunks.
+inline constexpr int kCullTreeSubChunkLevel = 3; // 8x8 nodes == sub-chunks
+inline constexpr int kCullTreeLeafLevel = 5;	 // 32x32 cells
+inline constexpr int kCullTreeLeafGridSize = 1 << kCullTreeLeafLevel;
+inline constexpr float kCullTreeLeafWorldSize = kChunkWorldSize / static_cast<float>(kCullTreeLeafGridSize);
+static_assert((1 << kCullTreeSubChunkLevel) == kSubChunkGridSize, "Cull tree sub-chunk level must match the sub-chunk grid");
+
 /// Per-vertex data: position (Vec2) + color (Color) = 24 bytes
 struct BakedVertex {
 	Foundation::Vec2  position; // World-space position
@@ -52,20 +68,98 @@ struct BakedMeshCPU {
 	std::vector<uint32_t>	 indices;
 	uint32_t				 entityCount = 0;
 	float					 maxEntityHeight = 0.0F; // tallest entity (meters), drives the zoom cutoff
+	uint32_t				 pointVertexStart = 0;	 // tall bucket: entity point impostors start here (one per entity)
 };
 
 /// CPU-side meshes for one sub-region, ready for GL upload
 struct BakedSubChunkCPUData {
 	std::array<BakedMeshCPU, kFloraBucketCount> buckets;
-	float										minX = 0, minY = 0, maxX = 0, maxY = 0; // World-space bounds for culling
+};
+
+/// What a cull tree node covers in one bucket. Ranges index the owning
+/// sub-chunk's buffers, so they are only meaningful at or below
+/// kCullTreeSubChunkLevel.
+struct BakedCullRange {
+	uint32_t firstIndex = 0;
+	uint32_t indexCount = 0;
+	uint32_t firstEntity = 0; // also the point impostor offset from pointVertexStart
+	uint32_t entityCount = 0;
+	float	 maxEntityHeight = 0.0F;
+};
+
+/// One quadtree node: world-space bounds of the baked geometry below it (not
+/// the cell, so overhanging canopies are never culled early) and per-bucket
+/// ranges.
+struct BakedCullNode {
+	float										  minX = 0, minY = 0, maxX = 0, maxY = 0;
+	std::array<BakedCullRange, kFloraBucketCount> buckets;
+
+	[[nodiscard]] bool empty() const { return buckets[kShortFloraBucket].entityCount + buckets[kTallFloraBucket].entityCount == 0; }
+};
+
+/// Quadtree over one chunk, stored level by level (root first); level L is a
+/// row-major 2^L x 2^L grid.
+class BakedCullTree {
+  public:
+	static constexpr int kNodeCount = ((1 << (2 * (kCullTreeLeafLevel + 1))) - 1) / 3;
+
+	BakedCullTree() = default;
+
+	[[nodiscard]] static constexpr int nodeIndex(int level, int x, int y) {
+		return ((1 << (2 * level)) - 1) / 3 + (y << level) + x;
+	}
+
+	[[nodiscard]] bool isValid() const { return !m_nodes.empty(); }
+	[[nodiscard]] const BakedCullNode& node(int level, int x, int y) const { return m_nodes[nodeIndex(level, x, y)]; }
+	[[nodiscard]] BakedCullNode& node(int level, int x, int y) { return m_nodes[nodeIndex(level, x, y)]; }
+
+	/// Size the node array (leaves are then filled by the bake)
+	void reset() { m_nodes.assign(kNodeCount, BakedCullNode{}); }
+
+	/// Derive every level above the leaves from their children
+	void buildInteriorNodes();
+
+  private:
+	std::vector<BakedCullNode> m_nodes; // heap: ~70KB per chunk
 };
 
 /// CPU-side meshes for a whole chunk
 struct BakedChunkCPUData {
 	std::array<BakedSubChunkCPUData, kSubChunkCount> subChunks;
+	BakedCullTree									 cullTree;
 	uint32_t										 totalEntityCount = 0;
 };
 
+/// View parameters for a cull tree query.
+struct BakedCullView {
+	float minX = 0, minY = 0, maxX = 0, maxY = 0; // visible world bounds
+	float pixelsPerWorldMeter = 1.0F;			  // on-screen pixels per meter (pixelsPerMeter * zoom)
+};
+
+/// A contiguous range of one sub-chunk bucket to draw.
+struct BakedDrawRange {
+	uint16_t subChunk = 0;
+	uint16_t bucket = 0;
+	uint32_t firstIndex = 0;
+	uint32_t indexCount = 0;
+	uint32_t firstEntity = 0;
+	uint32_t entityCount = 0;
+};
+
+/// True if a bucket whose tallest entity is `maxEntityHeight` meters draws at
+/// this zoom. Short flora hands off to the grass tile texture below
+/// kImpostorCutoffPx; tall flora always draws (as points when tiny).
+[[nodiscard]] inline bool bakedBucketDraws(int bucket, float maxEntityHeight, float pixelsPerWorldMeter) {
+	return bucket == kTallFloraBucket || maxEntityHeight * pixelsPerWorldMeter > kImpostorCutoffPx;
+}
+
+/// Append the ranges to draw for `view`, grouped by sub-chunk with the short
+/// bucket before the tall one. Quadrants outside the view, or holding only
+/// flora too small to draw, are rejected without visiting their children;
+/// quadrants fully inside the view draw as single ranges. Adjacent ranges
+/// are merged.
+void collectBakedDrawRanges(const BakedCullTree& tree, const BakedCullView& view, std::vector<BakedDrawRange>& out);
+
 /// True if `defName` is a groundcover asset. Groundcover is skipped by the baked
 /// path (it renders via the instanced GroundcoverRenderer), so the bake-time
 /// template lookups in both BakedChunkRenderer and AsyncChunkProcessor return
@@ -0,0 +1,152 @@
+// Tests for the baked-entity cull tree: every entity whose geometry reaches
+// the view is in a collected range, a close view draws only nearby cells, and
+// flora too small to draw at a wide zoom is rejected.
+
+#include "world/rendering/BakedEntityMesh.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace engine::world;
+
+namespace {
+
+	/// Unit square centered on the origin, scaled per entity to set its height.
+	renderer::TessellatedMesh makeSquare() {
+		renderer::TessellatedMesh mesh;
+		mesh.vertices = {{-0.5F, -0.5F}, {0.5F, -0.5F}, {0.5F, 0.5F}, {-0.5F, 0.5F}};
+		mesh.indices = {0, 1, 2, 0, 2, 3};
+		return mesh;
+	}
+
+	struct TestChunk {
+		renderer::TessellatedMesh			   square = makeSquare();
+		std::deque<assets::PlacedEntity>	   placed;
+		std::vector<const assets::PlacedEntity*> entities;
+		BakedChunkCPUData					   data;
+
+		/// `count` entities scattered over chunk (0,0); every fourth is tall.
+		explicit TestChunk(int count, float shortScale = 0.5F) {
+			std::mt19937						  rng(1234);
+			std::uniform_real_distribution<float> pos(0.0F, kChunkWorldSize);
+			for (int i = 0; i < count; ++i) {
+				assets::PlacedEntity entity;
+				entity.defName = "square";
+				entity.position = {pos(rng), pos(rng)};
+				entity.scale = i % 4 == 0 ? 3.0F : shortScale;
+				placed.push_back(entity);
+				entities.push_back(&placed.back());
+			}
+			data = bakeChunkEntities(entities, ChunkCoordinate{0, 0}, [this](const std::string&) { return &square; });
+		}
+
+		/// Entities covered by `ranges`, as (sub-chunk, bucket, entity index) flags.
+		std::vector<bool> drawnEntities(const std::vector<BakedDrawRange>& ranges) const {
+			std::vector<bool> drawn(static_cast<size_t>(kSubChunkCount) * kFloraBucketCount * entities.size());
+			for (const auto& range : ranges) {
+				for (uint32_t e = range.firstEntity; e < range.firstEntity + range.entityCount; ++e) {
+					drawn[(static_cast<size_t>(range.subChunk) * kFloraBucketCount + range.bucket) * entities.size() + e] = true;
+				}
+			}
+			return drawn;
+		}
+	};
+
+	/// Each baked entity's bounds, recovered from its 4 vertices.
+	struct BakedEntity {
+		int	  subChunk;
+		int	  bucket;
+		int	  index;
+		float minX, minY, maxX, maxY;
+	};
+
+	std::vector<BakedEntity> bakedEntities(const BakedChunkCPUData& data) {
+		std::vector<BakedEntity> out;
+		for (int sub = 0; sub < kSubChunkCount; ++sub) {
+			for (int bucket = 0; bucket < kFloraBucketCount; ++bucket) {
+				const auto& mesh = data.subChunks[sub].buckets[bucket];
+				for (uint32_t e = 0; e < mesh.entityCount; ++e) {
+					const auto& v0 = mesh.vertices[e * 4].position;
+					const auto& v2 = mesh.vertices[e * 4 + 2].position;
+					out.push_back({sub, bucket, static_cast<int>(e), v0.x, v0.y, v2.x, v2.y});
+				}
+			}
+		}
+		return out;
+	}
+
+} // namespace
+
+TEST(BakedCullTreeTest, RangesCoverEveryEntityTouchingTheView) {
+	const TestChunk chunk(4000);
+	ASSERT_EQ(chunk.data.totalEntityCount, 4000U);
+
+	const BakedCullView views[] = {
+		{0.0F, 0.0F, kChunkWorldSize, kChunkWorldSize, 64.0F}, // whole chunk
+		{100.0F, 200.0F, 104.0F, 203.0F, 320.0F},				// zoom 20: a few meters
+		{60.0F, 60.0F, 200.0F, 140.0F, 16.0F},					// straddles sub-chunk edges
+	};
+	for (const auto& view : views) {
+		std::vector<BakedDrawRange> ranges;
+		collectBakedDrawRanges(chunk.data.cullTree, view, ranges);
+		const std::vector<bool> drawn = chunk.drawnEntities(ranges);
+
+		int missing = 0;
+		for (const auto& e : bakedEntities(chunk.data)) {
+			const bool touchesView = e.maxX >= view.minX && e.minX <= view.maxX && e.maxY >= view.minY && e.minY <= view.maxY;
+			const size_t flag = (static_cast<size_t>(e.subChunk) * kFloraBucketCount + e.bucket) * chunk.entities.size() + e.index;
+			if (touchesView && !drawn[flag]) {
+				++missing;
+			}
+		}
+		EXPECT_EQ(missing, 0) << "view " << view.minX << "," << view.minY;
+
+		// Index ranges must match the entity ranges they claim (4 verts / 6 indices each)
+		for (const auto& range : ranges) {
+			EXPECT_EQ(range.indexCount, range.entityCount * 6);
+			EXPECT_EQ(range.firstIndex, range.firstEntity * 6);
+		}
+	}
+}
+
+TEST(BakedCullTreeTest, CloseViewDrawsOnlyNearbyCells) {
+	const TestChunk chunk(20000);
+
+	std::vector<BakedDrawRange> ranges;
+	collectBakedDrawRanges(chunk.data.cullTree, {100.0F, 200.0F, 104.0F, 203.0F, 320.0F}, ranges);
+
+	uint32_t drawnEntities = 0;
+	for (const auto& range : ranges) {
+		drawnEntities += range.entityCount;
+	}
+	// The containing 64m sub-chunk holds ~20000/64 entities; its 16m cells ~1/16 of that.
+	const uint32_t subChunkEntities = chunk.data.subChunks[3 * kSubChunkGridSize + 1].buckets[0].entityCount +
+									  chunk.data.subChunks[3 * kSubChunkGridSize + 1].buckets[1].entityCount;
+	EXPECT_GT(drawnEntities, 0U);
+	EXPECT_LT(drawnEntities * 4, subChunkEntities);
+}
+
+TEST(BakedCullTreeTest, WideZoomSkipsTinyShortFloraButKeepsTallFlora) {
+	const TestChunk chunk(2000, 0.2F);
+	const BakedCullView wide{0.0F, 0.0F, kChunkWorldSize, kChunkWorldSize, 4.0F}; // 0.2m * 4px < cutoff
+
+	std::vector<BakedDrawRange> ranges;
+	collectBakedDrawRanges(chunk.data.cullTree, wide, ranges);
+
+	uint32_t tallDrawn = 0;
+	for (const auto& range : ranges) {
+		EXPECT_EQ(range.bucket, kTallFloraBucket);
+		tallDrawn += range.entityCount;
+	}
+	EXPECT_EQ(tallDrawn, 500U);
+
+	// Tall flora bakes one point impostor per entity after its mesh vertices
+	for (const auto& sub : chunk.data.subChunks) {
+		const auto& tall = sub.buckets[kTallFloraBucket];
+		EXPECT_EQ(tall.pointVertexStart, tall.entityCount * 4);
+		EXPECT_EQ(tall.vertices.size(), tall.entityCount * 5);
+	}
+}
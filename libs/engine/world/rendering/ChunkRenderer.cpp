@@ -4,22 +4,19 @@
 #include <primitives/Primitives.h>
 #include <utils/Log.h>
 
+#include "world/chunk/TileAdjacency.h"
+
 #include <GL/glew.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <span>
 #include <vector>
 
 namespace engine::world {
 
-	namespace {
-		// The tile-data texture is uploaded as raw TileRenderData; the fragment
-		// shader unpacks bytes from uint texels assuming this exact layout.
-		static_assert(sizeof(TileRenderData) == 16, "tile.frag texel layout must match TileRenderData");
-	} // namespace
-
 	ChunkRenderer::ChunkRenderer(float pixelsPerMeter)
 		: m_pixelsPerMeter(pixelsPerMeter) {}
 
@@ -43,11 +40,22 @@ namespace engine::world {
 		m_loc.cameraZoom = glGetUniformLocation(program, "u_cameraZoom");
 		m_loc.pixelsPerMeter = glGetUniformLocation(program, "u_pixelsPerMeter");
 		m_loc.viewportSize = glGetUniformLocation(program, "u_viewportSize");
-		m_loc.tileData = glGetUniformLocation(program, "u_tileData");
+		m_loc.tileSurfaces = glGetUniformLocation(program, "u_tileSurfaces");
+		m_loc.tileMasks = glGetUniformLocation(program, "u_tileMasks");
+		m_loc.surfaceFamily = glGetUniformLocation(program, "u_surfaceFamily");
 		m_loc.tileAtlas = glGetUniformLocation(program, "u_tileAtlas");
 		m_loc.tileAtlasRectCount = glGetUniformLocation(program, "u_tileAtlasRectCount");
 		m_loc.tileAtlasRects = glGetUniformLocation(program, "u_tileAtlasRects");
 
+		// Hard edges are derived in the shader from surface families; the table
+		// is constant, so set it once
+		GLint families[kTileSurfaceIdCount];
+		for (int id = 0; id < kTileSurfaceIdCount; ++id) {
+			families[id] = static_cast<GLint>(TileAdjacency::getSurfaceFamily(static_cast<uint8_t>(id)));
+		}
+		m_shader.use();
+		glUniform1iv(m_loc.surfaceFamily, kTileSurfaceIdCount, families);
+
 		// Unit quad as triangle strip: (0,0) (1,0) (0,1) (1,1)
 		constexpr float kQuad[] = {0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 1.0F, 1.0F, 1.0F};
 		m_quadVAO = Renderer::GLVertexArray::create();
@@ -67,32 +75,76 @@ namespace engine::world {
 		entry.lastAccessFrame = m_frameCounter;
 
 		uint32_t version = chunk.renderDataVersion();
-		if (entry.texture.isValid() && entry.version == version) {
+		if (entry.surfaces.isValid() && entry.version == version) {
 			return entry;
 		}
 
-		if (!entry.texture.isValid()) {
-			entry.texture = Renderer::GLTexture(
-				kChunkSize, kChunkSize, GL_RGBA32UI, GL_RGBA_INTEGER, GL_UNSIGNED_INT, chunk.renderData()
+		bool fullUpload = true;
+		if (!entry.surfaces.isValid()) {
+			entry.surfaces = Renderer::GLTexture(
+				kTileSurfacePlaneSize, kTileSurfacePlaneSize, GL_RG8UI, GL_RG_INTEGER, GL_UNSIGNED_BYTE, nullptr
 			);
 			// Integer textures require NEAREST filtering (ctor default is LINEAR)
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			entry.masks = Renderer::GLTexture(kChunkSize, kChunkSize, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, nullptr);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		} else if (entry.version >= chunk.renderDataFullVersion()) {
+			// Everything since our upload was border stitching: only the apron
+			// and the outer mask ring changed (a few KB), so refresh just those.
+			fullUpload = false;
 		} else {
-			// Stale re-uploads (adjacency stitching bumped the version) are 4MB
-			// each and several chunks can go stale together; cap one per frame.
-			// A frame of stale border blending is invisible.
+			// Full stale re-uploads are ~0.76 MB each and several chunks can go
+			// stale together; cap one per frame. A frame of stale blending is
+			// invisible.
 			if (m_staleReuploadsThisFrame >= kMaxStaleReuploadsPerFrame) {
 				return entry;
 			}
 			m_staleReuploadsThisFrame++;
-			entry.texture.bind();
-			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kChunkSize, kChunkSize, GL_RGBA_INTEGER, GL_UNSIGNED_INT, chunk.renderData());
 		}
+
+		// Packed rows are tightly packed bytes, not 4-byte aligned
+		GLint unpackAlignment = 4;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		entry.surfaces.bind();
+		uploadRects(
+			chunk,
+			fullUpload ? std::span<const TileTexelRect>(&kTileSurfacePlaneRect, 1) : std::span<const TileTexelRect>(kTileSurfaceBorderRects),
+			kTileSurfaceTexelBytes,
+			GL_RG_INTEGER,
+			packTileSurfaceRect
+		);
+		entry.masks.bind();
+		uploadRects(
+			chunk,
+			fullUpload ? std::span<const TileTexelRect>(&kTileMaskPlaneRect, 1) : std::span<const TileTexelRect>(kTileMaskBorderRects),
+			kTileMaskTexelBytes,
+			GL_RED_INTEGER,
+			packTileMaskRect
+		);
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
 		entry.version = version;
 		return entry;
 	}
 
+	void ChunkRenderer::uploadRects(
+		const Chunk& chunk,
+		std::span<const TileTexelRect> rects,
+		int texelBytes,
+		unsigned int format,
+		void (*pack)(const TileRenderData*, const TileTexelRect&, uint8_t*)
+	) {
+		for (const TileTexelRect& rect : rects) {
+			m_uploadScratch.resize(rect.area() * static_cast<size_t>(texelBytes));
+			pack(chunk.renderData(), rect, m_uploadScratch.data());
+			glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height, format, GL_UNSIGNED_BYTE, m_uploadScratch.data());
+		}
+	}
+
 	void ChunkRenderer::evictStaleTextures() {
 		if (m_textureCache.size() <= kMaxCachedTextures) {
 			return;
@@ -155,7 +207,7 @@ namespace engine::world {
 		glUniform1f(m_loc.pixelsPerMeter, m_pixelsPerMeter);
 		glUniform2f(m_loc.viewportSize, static_cast<float>(viewportWidth), static_cast<float>(viewportHeight));
 
-		// Tile atlas on unit 0, per-chunk tile data on unit 1
+		// Tile atlas on unit 0, per-chunk surfaces on unit 1 and masks on unit 2
 		const auto& atlasRects = Renderer::Primitives::getTileAtlasRects();
 		glActiveTexture(GL_TEXTURE0);
 		glBindTexture(GL_TEXTURE_2D, Renderer::Primitives::getTileAtlasTexture());
@@ -164,7 +216,8 @@ namespace engine::world {
 		if (!atlasRects.empty()) {
 			glUniform4fv(m_loc.tileAtlasRects, static_cast<GLsizei>(atlasRects.size()), reinterpret_cast<const float*>(atlasRects.data()));
 		}
-		glUniform1i(m_loc.tileData, 1);
+		glUniform1i(m_loc.tileSurfaces, 1);
+		glUniform1i(m_loc.tileMasks, 2);
 		glActiveTexture(GL_TEXTURE1);
 
 		m_quadVAO.bind();
@@ -174,8 +227,11 @@ namespace engine::world {
 				continue;
 			}
 
-			ChunkTileTexture& entry = ensureTexture(*chunk);
-			entry.texture.bind(); // unit 1 is active
+			ChunkTileTexture& entry = ensureTexture(*chunk); // binds on unit 1
+			entry.surfaces.bind();
+			glActiveTexture(GL_TEXTURE2);
+			entry.masks.bind();
+			glActiveTexture(GL_TEXTURE1);
 
 			WorldPosition origin = chunk->worldOrigin();
 			ChunkCoordinate coord = chunk->coordinate();
@@ -2,12 +2,14 @@
 
 // ChunkRenderer - Renders ground tiles from per-chunk tile-data textures.
 // Each visible chunk is a single quad; the fragment shader fetches per-tile
-// data (surface, masks, neighbors) from an RGBA32UI texture that mirrors the
-// chunk's TileRenderData array. Tile geometry never touches the CPU per frame.
+// data from two small integer textures packed from the chunk's TileRenderData
+// (see TileDataPacking.h): surfaces + water depth with a one-tile neighbor
+// apron, and edge/corner masks. Tile geometry never touches the CPU per frame.
 
 #include "world/chunk/Chunk.h"
 #include "world/chunk/ChunkManager.h"
 #include "world/camera/WorldCamera.h"
+#include "world/rendering/TileDataPacking.h"
 
 #include <gl/GLBuffer.h>
 #include <gl/GLTexture.h>
@@ -15,7 +17,9 @@
 #include <shader/Shader.h>
 
 #include <cstdint>
+#include <span>
 #include <unordered_map>
+#include <vector>
 
 namespace engine::world {
 
@@ -51,20 +55,21 @@ class ChunkRenderer {
 	[[nodiscard]] uint32_t lastChunkCount() const { return m_lastChunkCount; }
 
   private:
-	/// GPU tile-data texture for one chunk, with the render-data version it was
-	/// uploaded from (stale versions are re-uploaded before drawing).
+	/// GPU tile-data textures for one chunk, with the render-data version they
+	/// were uploaded from (stale versions are refreshed before drawing).
 	struct ChunkTileTexture {
-		Renderer::GLTexture texture;
+		Renderer::GLTexture surfaces; // RG8UI, kTileSurfacePlaneSize^2
+		Renderer::GLTexture masks;	  // R8UI, kChunkSize^2
 		uint32_t version = 0;
 		uint64_t lastAccessFrame = 0;
 	};
 
-	// LRU cache: 512x512 RGBA32UI = 4 MB per chunk
-	static constexpr size_t kMaxCachedTextures = 32; // 128 MB cap
+	// LRU cache: 514x514 RG8UI + 512x512 R8UI = ~0.76 MB per chunk
+	static constexpr size_t kMaxCachedTextures = 32; // ~24 MB cap
 	static constexpr size_t kEvictionBatchSize = 8;
 
-	// Cap stale-texture re-uploads (4 MB each) per frame; adjacency stitching
-	// can dirty several visible chunks in the same update
+	// Cap full stale re-uploads (~0.76 MB each) per frame. Border-only
+	// refreshes from adjacency stitching are a few KB and are not capped.
 	static constexpr int kMaxStaleReuploadsPerFrame = 1;
 
 	/// Lazily create shader + unit quad (requires GL context)
@@ -73,6 +78,16 @@ class ChunkRenderer {
 	/// Get (uploading/refreshing if needed) the tile-data texture for a chunk
 	ChunkTileTexture& ensureTexture(const Chunk& chunk);
 
+	/// Pack `rects` of one plane into m_uploadScratch and upload each into the
+	/// bound texture
+	void uploadRects(
+		const Chunk& chunk,
+		std::span<const TileTexelRect> rects,
+		int texelBytes,
+		unsigned int format,
+		void (*pack)(const TileRenderData*, const TileTexelRect&, uint8_t*)
+	);
+
 	/// Evict least-recently-used textures when over the cache cap
 	void evictStaleTextures();
 
@@ -88,6 +103,7 @@ class ChunkRenderer {
 	Renderer::GLBuffer m_quadVBO;
 
 	std::unordered_map<ChunkCoordinate, ChunkTileTexture> m_textureCache;
+	std::vector<uint8_t> m_uploadScratch; // packed texels for the upload in flight
 
 	struct UniformLocations {
 		int projection = -1;
@@ -98,7 +114,9 @@ class ChunkRenderer {
 		int cameraZoom = -1;
 		int pixelsPerMeter = -1;
 		int viewportSize = -1;
-		int tileData = -1;
+		int tileSurfaces = -1;
+		int tileMasks = -1;
+		int surfaceFamily = -1;
 		int tileAtlas = -1;
 		int tileAtlasRectCount = -1;
 		int tileAtlasRects = -1;
@@ -0,0 +1,182 @@
+#include "DynamicDrawList.h"
+
+#include <vector/Types.h>
+
+#include <algorithm>
+
+namespace engine::world {
+
+	void DynamicDrawList::build(
+		const std::vector<assets::PlacedEntity>& entities,
+		const DynamicDrawView&					 view,
+		const DynamicMeshLookup&				 lookup,
+		uint32_t								 batchCount,
+		foundation::JobSystem&					 jobs
+	) {
+		m_slabCount = (entities.size() + kGrainSize - 1) / kGrainSize;
+		if (m_slabs.size() < m_slabCount) {
+			m_slabs.resize(m_slabCount);
+		}
+		m_entityBatch.assign(entities.size(), DynamicMeshInfo::kNoBatch);
+		for (size_t s = 0; s < m_slabCount; ++s) {
+			auto& slab = m_slabs[s];
+			slab.batchCounts.assign(batchCount, 0);
+			slab.animatedUsed = 0;
+			slab.unresolved.clear();
+			slab.entities = 0;
+		}
+
+		// Pass 1 (workers): cull, classify, count per batch, deform animated entities
+		jobs.parallelFor(0, entities.size(), kGrainSize, [&](size_t begin, size_t end) {
+			buildSlab(m_slabs[begin / kGrainSize], begin, end, entities, view, lookup);
+		});
+
+		// Lay batches out back to back; within a batch, slabs in order (so
+		// instance order matches entity order, as a serial build would)
+		m_batches.assign(batchCount, DynamicBatchRange{});
+		m_unresolved.clear();
+		m_entityCount = 0;
+		for (size_t s = 0; s < m_slabCount; ++s) {
+			m_slabs[s].batchCursor.assign(batchCount, 0);
+		}
+		uint32_t slot = 0;
+		for (uint32_t b = 0; b < batchCount; ++b) {
+			m_batches[b].first = slot;
+			for (size_t s = 0; s < m_slabCount; ++s) {
+				m_slabs[s].batchCursor[b] = slot;
+				slot += m_slabs[s].batchCounts[b];
+			}
+			m_batches[b].count = slot - m_batches[b].first;
+		}
+		m_instanceCount = slot;
+		for (size_t s = 0; s < m_slabCount; ++s) {
+			m_entityCount += m_slabs[s].entities;
+			for (const auto& name : m_slabs[s].unresolved) {
+				if (std::find(m_unresolved.begin(), m_unresolved.end(), name) == m_unresolved.end()) {
+					m_unresolved.push_back(name);
+				}
+			}
+		}
+	}
+
+	void DynamicDrawList::buildSlab(
+		Slab&									 slab,
+		size_t									 begin,
+		size_t									 end,
+		const std::vector<assets::PlacedEntity>& entities,
+		const DynamicDrawView&					 view,
+		const DynamicMeshLookup&				 lookup
+	) {
+		const VisibleBounds& vis = view.vis;
+		AnimatedGeometry*	 anim = nullptr;
+
+		// Next arena for animated geometry (reusing last frame's capacity)
+		auto nextArena = [&slab]() {
+			if (slab.animatedUsed == slab.animated.size()) {
+				slab.animated.emplace_back();
+			}
+			AnimatedGeometry& arena = slab.animated[slab.animatedUsed++];
+			arena.vertices.clear();
+			arena.colors.clear();
+			arena.indices.clear();
+			return &arena;
+		};
+
+		std::vector<Foundation::Vec2> animVerts;
+		for (size_t e = begin; e < end; ++e) {
+			const auto& entity = entities[e];
+			// Frustum culling for dynamic entities
+			if (entity.position.x < vis.minX || entity.position.x > vis.maxX || entity.position.y < vis.minY ||
+				entity.position.y > vis.maxY) {
+				continue;
+			}
+
+			const DynamicMeshInfo* info = lookup(entity.defName);
+			if (info == nullptr) {
+				if (std::find(slab.unresolved.begin(), slab.unresolved.end(), entity.defName) == slab.unresolved.end()) {
+					slab.unresolved.push_back(entity.defName);
+				}
+				continue;
+			}
+			const auto* templateMesh = info->mesh;
+			if (templateMesh == nullptr) {
+				continue;
+			}
+
+			// Animated entities carry per-part transforms; they can't be GPU-instanced (each
+			// has unique deformed geometry), so emit them to the CPU batch with their parts moved.
+			if (entity.partTransforms != nullptr && !entity.partTransforms->empty() && !templateMesh->parts.empty()) {
+				// Keep each arena inside the 16-bit index space
+				if (anim == nullptr || anim->vertices.size() + templateMesh->vertices.size() > 65535U) {
+					anim = nextArena();
+				}
+				const auto& xforms = *entity.partTransforms;
+				const bool	hasMeshColors = templateMesh->hasColors();
+				const auto	vertexBase = static_cast<uint32_t>(anim->vertices.size());
+
+				// Copy the template verts, then deform each part's range by its transform.
+				animVerts.assign(templateMesh->vertices.begin(), templateMesh->vertices.end());
+				for (size_t k = 0; k < templateMesh->parts.size() && k < xforms.size(); ++k) {
+					const auto&	   part = templateMesh->parts[k];
+					const uint32_t partEnd =
+						std::min<uint32_t>(part.vertexStart + part.vertexCount, static_cast<uint32_t>(animVerts.size()));
+					for (uint32_t i = part.vertexStart; i < partEnd; ++i) {
+						const glm::vec2 r = xforms[k].apply({animVerts[i].x, animVerts[i].y});
+						animVerts[i] = {r.x, r.y};
+					}
+				}
+
+				const float entityScale = entity.scale;
+				for (size_t i = 0; i < animVerts.size(); ++i) {
+					const float worldX = animVerts[i].x * entityScale + entity.position.x;
+					const float worldY = animVerts[i].y * entityScale + entity.position.y;
+					anim->vertices.emplace_back(
+						(worldX - view.camX) * view.scale + view.halfViewW, (worldY - view.camY) * view.scale + view.halfViewH
+					);
+					if (hasMeshColors) {
+						const auto& mc = templateMesh->colors[i];
+						anim->colors.emplace_back(
+							mc.r * entity.colorTint.r, mc.g * entity.colorTint.g, mc.b * entity.colorTint.b, mc.a * entity.colorTint.a
+						);
+					} else {
+						anim->colors.emplace_back(entity.colorTint.r, entity.colorTint.g, entity.colorTint.b, entity.colorTint.a);
+					}
+				}
+				for (const auto idx : templateMesh->indices) {
+					anim->indices.push_back(static_cast<uint16_t>(vertexBase + idx));
+				}
+				slab.entities++;
+				continue;
+			}
+
+			if (info->batch == DynamicMeshInfo::kNoBatch) {
+				continue;
+			}
+			m_entityBatch[e] = info->batch;
+			slab.batchCounts[info->batch]++;
+			slab.entities++;
+		}
+	}
+
+	void DynamicDrawList::writeInstances(
+		const std::vector<assets::PlacedEntity>& entities, Renderer::InstanceData* out, foundation::JobSystem& jobs
+	) {
+		// Pass 2 (workers): each slab writes its entities at its own cursors, so
+		// no two workers touch the same slot
+		jobs.parallelFor(0, entities.size(), kGrainSize, [&](size_t begin, size_t end) {
+			auto& cursor = m_slabs[begin / kGrainSize].batchCursor;
+			for (size_t e = begin; e < end; ++e) {
+				const uint32_t batch = m_entityBatch[e];
+				if (batch == DynamicMeshInfo::kNoBatch) {
+					continue;
+				}
+				const auto& entity = entities[e];
+				// World-space - GPU does the transform!
+				out[cursor[batch]++] = Renderer::InstanceData(
+					Foundation::Vec2(entity.position.x, entity.position.y), entity.rotation, entity.scale, entity.colorTint
+				);
+			}
+		});
+	}
+
+} // namespace engine::world
@@ -0,0 +1,133 @@
+#pragma once
+
+// DynamicDrawList - GL-free "extract" phase for dynamic (ECS) entities.
+// Culls and classifies the frame's entities on JobSystem workers in fixed
+// slabs: instanced entities get a slot in their mesh type's batch, animated
+// entities are deformed on the CPU into per-slab geometry arenas. The render
+// thread only resolves new mesh types (template + GL upload), then submits;
+// writeInstances() is itself a parallel loop straight into mapped memory.
+// Needs no GL context, so lists can be built headless (tests, benchmarks).
+
+#include "assets/placement/SpatialIndex.h"
+#include "primitives/InstanceData.h"
+#include "world/rendering/RenderContext.h"
+
+#include <graphics/Color.h>
+#include <math/Types.h>
+#include <threading/JobSystem.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace renderer {
+struct TessellatedMesh;
+}
+
+namespace engine::world {
+
+/// Render-thread-resolved info for one defName. Read (never written) by the
+/// parallel build.
+struct DynamicMeshInfo {
+	static constexpr uint32_t kNoBatch = UINT32_MAX;
+
+	const renderer::TessellatedMesh* mesh = nullptr; // null: not drawable
+	uint32_t						 batch = kNoBatch; // instanced batch index, or kNoBatch (no GPU mesh)
+};
+
+/// Looks up a defName's resolved info; null if the render thread has not
+/// resolved it yet. Must be safe to call from several workers at once.
+using DynamicMeshLookup = std::function<const DynamicMeshInfo*(const std::string&)>;
+
+/// World-to-screen mapping for CPU-deformed animated entities.
+struct DynamicDrawView {
+	VisibleBounds vis;
+	float		  camX = 0.0F;
+	float		  camY = 0.0F;
+	float		  scale = 1.0F; // pixels per meter * zoom
+	float		  halfViewW = 0.0F;
+	float		  halfViewH = 0.0F;
+};
+
+/// Screen-space geometry for animated entities, kept in a 16-bit index space
+/// (one drawTriangles call each).
+struct AnimatedGeometry {
+	std::vector<Foundation::Vec2>  vertices;
+	std::vector<Foundation::Color> colors;
+	std::vector<uint16_t>		   indices;
+};
+
+/// One mesh type's instances: slots [first, first + count) of the write.
+struct DynamicBatchRange {
+	uint32_t first = 0;
+	uint32_t count = 0;
+};
+
+/// Per-frame culled draw list for dynamic entities. Buffers (the per-slab
+/// arenas) keep their capacity across frames.
+class DynamicDrawList {
+  public:
+	/// Entities per slab. Results depend only on the slab layout, never on
+	/// how many workers ran it.
+	static constexpr size_t kGrainSize = 1024;
+
+	/// Cull and classify `entities` for `batchCount` instanced batches.
+	/// Entities whose defName `lookup` does not know are skipped and reported
+	/// by unresolved(); resolve them and build again.
+	void build(
+		const std::vector<assets::PlacedEntity>& entities,
+		const DynamicDrawView& view,
+		const DynamicMeshLookup& lookup,
+		uint32_t batchCount,
+		foundation::JobSystem& jobs
+	);
+
+	/// defNames the last build() skipped because lookup returned null (deduplicated).
+	[[nodiscard]] const std::vector<std::string>& unresolved() const { return m_unresolved; }
+
+	/// Total instanced entities and each batch's slot range.
+	[[nodiscard]] uint32_t instanceCount() const { return m_instanceCount; }
+	[[nodiscard]] const std::vector<DynamicBatchRange>& batches() const { return m_batches; }
+
+	/// Write every instance into `out` (instanceCount() slots), in parallel.
+	/// Once per build(); `entities` must be the vector build() saw.
+	void writeInstances(const std::vector<assets::PlacedEntity>& entities, Renderer::InstanceData* out, foundation::JobSystem& jobs);
+
+	/// Animated geometry in entity order (draw after the instanced batches).
+	template <typename Fn> void forEachAnimated(Fn&& fn) const {
+		for (size_t s = 0; s < m_slabCount; ++s) {
+			for (size_t a = 0; a < m_slabs[s].animatedUsed; ++a) {
+				fn(m_slabs[s].animated[a]);
+			}
+		}
+	}
+
+	/// Entities drawn (instanced + animated) by the last build()
+	[[nodiscard]] uint32_t entityCount() const { return m_entityCount; }
+
+  private:
+	struct Slab {
+		std::vector<uint32_t>		  batchCounts; // instances per batch in this slab
+		std::vector<uint32_t>		  batchCursor; // writeInstances: next slot per batch
+		std::vector<AnimatedGeometry> animated;	   // arenas; [0, animatedUsed) hold this frame's data
+		size_t						  animatedUsed = 0;
+		std::vector<std::string>	  unresolved;
+		uint32_t					  entities = 0;
+	};
+
+	void buildSlab(
+		Slab& slab, size_t begin, size_t end, const std::vector<assets::PlacedEntity>& entities, const DynamicDrawView& view,
+		const DynamicMeshLookup& lookup
+	);
+
+	std::vector<Slab>			   m_slabs;
+	size_t						   m_slabCount = 0;
+	std::vector<uint32_t>		   m_entityBatch; // per entity: batch index or kNoBatch (culled/animated)
+	std::vector<DynamicBatchRange> m_batches;
+	std::vector<std::string>	   m_unresolved;
+	uint32_t					   m_instanceCount = 0;
+	uint32_t					   m_entityCount = 0;
+};
+
+}  // namespace engine::world
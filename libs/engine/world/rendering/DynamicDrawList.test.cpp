@@ -0,0 +1,202 @@
+// Tests for the dynamic-entity draw list: the parallel build culls and groups
+// instances exactly like a serial walk over the entities, unknown mesh types
+// are reported once, animated entities are deformed into screen space, and
+// the result does not depend on the worker count.
+
+#include "world/rendering/DynamicDrawList.h"
+
+#include <threading/JobSystem.h>
+#include <vector/Types.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace engine::world;
+
+namespace {
+
+	renderer::TessellatedMesh makeSquare() {
+		renderer::TessellatedMesh mesh;
+		mesh.vertices = {{-0.5F, -0.5F}, {0.5F, -0.5F}, {0.5F, 0.5F}, {-0.5F, 0.5F}};
+		mesh.indices = {0, 1, 2, 0, 2, 3};
+		return mesh;
+	}
+
+	/// Three instanced mesh types plus one with no GPU mesh (kNoBatch).
+	struct TestMeshes {
+		renderer::TessellatedMesh						 square = makeSquare();
+		std::unordered_map<std::string, DynamicMeshInfo> info{
+			{"a", {&square, 0}}, {"b", {&square, 1}}, {"c", {&square, 2}}, {"noGpu", {&square, DynamicMeshInfo::kNoBatch}}
+		};
+
+		DynamicMeshLookup lookup() const {
+			return [this](const std::string& defName) -> const DynamicMeshInfo* {
+				auto it = info.find(defName);
+				return it != info.end() ? &it->second : nullptr;
+			};
+		}
+	};
+
+	constexpr uint32_t kBatchCount = 3;
+
+	/// A 100x100m view centered on the origin.
+	DynamicDrawView makeView() {
+		DynamicDrawView view;
+		view.vis = {-50.0F, 50.0F, -50.0F, 50.0F};
+		view.scale = 10.0F;
+		view.halfViewW = 500.0F;
+		view.halfViewH = 500.0F;
+		return view;
+	}
+
+	/// Entities scattered over twice the view, cycling through the mesh types.
+	std::vector<engine::assets::PlacedEntity> makeEntities(int count) {
+		static const char* const kNames[] = {"a", "b", "c", "noGpu", "a", "b"};
+		std::mt19937						  rng(42);
+		std::uniform_real_distribution<float> pos(-100.0F, 100.0F);
+		std::vector<engine::assets::PlacedEntity> entities(static_cast<size_t>(count));
+		for (int i = 0; i < count; ++i) {
+			auto& entity = entities[static_cast<size_t>(i)];
+			entity.defName = kNames[i % 6];
+			entity.position = {pos(rng), pos(rng)};
+			entity.scale = 1.0F + static_cast<float>(i % 7);
+		}
+		return entities;
+	}
+
+	bool inView(const engine::assets::PlacedEntity& entity, const VisibleBounds& vis) {
+		return entity.position.x >= vis.minX && entity.position.x <= vis.maxX && entity.position.y >= vis.minY &&
+			   entity.position.y <= vis.maxY;
+	}
+
+	std::vector<Renderer::InstanceData>
+	writeAll(DynamicDrawList& list, const std::vector<engine::assets::PlacedEntity>& entities, foundation::JobSystem& jobs) {
+		std::vector<Renderer::InstanceData> out(list.instanceCount());
+		list.writeInstances(entities, out.data(), jobs);
+		return out;
+	}
+
+} // namespace
+
+TEST(DynamicDrawListTest, MatchesSerialReference) {
+	const TestMeshes meshes;
+	const auto		 entities = makeEntities(10000);
+	const auto		 view = makeView();
+	foundation::JobSystem jobs(3);
+
+	DynamicDrawList list;
+	list.build(entities, view, meshes.lookup(), kBatchCount, jobs);
+	EXPECT_TRUE(list.unresolved().empty());
+
+	// Serial reference: per batch, the visible entities in entity order
+	std::vector<std::vector<size_t>> expected(kBatchCount);
+	uint32_t						 expectedEntities = 0;
+	for (size_t e = 0; e < entities.size(); ++e) {
+		if (!inView(entities[e], view.vis)) {
+			continue;
+		}
+		const uint32_t batch = meshes.info.at(entities[e].defName).batch;
+		if (batch != DynamicMeshInfo::kNoBatch) {
+			expected[batch].push_back(e);
+			expectedEntities++;
+		}
+	}
+
+	ASSERT_EQ(list.batches().size(), kBatchCount);
+	EXPECT_EQ(list.entityCount(), expectedEntities);
+	EXPECT_EQ(list.instanceCount(), expectedEntities);
+
+	const auto instances = writeAll(list, entities, jobs);
+	uint32_t   nextFirst = 0;
+	for (uint32_t b = 0; b < kBatchCount; ++b) {
+		const auto& range = list.batches()[b];
+		EXPECT_EQ(range.first, nextFirst); // batches are back to back
+		ASSERT_EQ(range.count, expected[b].size());
+		for (uint32_t i = 0; i < range.count; ++i) {
+			const auto& entity = entities[expected[b][i]];
+			const auto& inst = instances[range.first + i];
+			EXPECT_EQ(inst.worldPosition.x, entity.position.x);
+			EXPECT_EQ(inst.worldPosition.y, entity.position.y);
+			EXPECT_EQ(inst.scale, entity.scale);
+		}
+		nextFirst += range.count;
+	}
+}
+
+TEST(DynamicDrawListTest, ReportsEachUnresolvedNameOnce) {
+	TestMeshes meshes;
+	meshes.info.erase("b");
+	const auto			  entities = makeEntities(5000);
+	foundation::JobSystem jobs(3);
+
+	DynamicDrawList list;
+	list.build(entities, makeView(), meshes.lookup(), kBatchCount, jobs);
+	ASSERT_EQ(list.unresolved().size(), 1U);
+	EXPECT_EQ(list.unresolved()[0], "b");
+	EXPECT_EQ(list.batches()[1].count, 0U);
+
+	// Resolving and rebuilding picks the skipped entities up
+	const uint32_t before = list.instanceCount();
+	meshes.info.emplace("b", DynamicMeshInfo{&meshes.square, 1});
+	list.build(entities, makeView(), meshes.lookup(), kBatchCount, jobs);
+	EXPECT_TRUE(list.unresolved().empty());
+	EXPECT_GT(list.instanceCount(), before);
+}
+
+TEST(DynamicDrawListTest, ResultIndependentOfWorkerCount) {
+	const TestMeshes meshes;
+	const auto		 entities = makeEntities(7777);
+	const auto		 view = makeView();
+
+	foundation::JobSystem serialJobs(1);
+	foundation::JobSystem parallelJobs(4);
+	DynamicDrawList		  serial;
+	DynamicDrawList		  parallel;
+	serial.build(entities, view, meshes.lookup(), kBatchCount, serialJobs);
+	parallel.build(entities, view, meshes.lookup(), kBatchCount, parallelJobs);
+
+	ASSERT_EQ(serial.instanceCount(), parallel.instanceCount());
+	const auto a = writeAll(serial, entities, serialJobs);
+	const auto b = writeAll(parallel, entities, parallelJobs);
+	for (size_t i = 0; i < a.size(); ++i) {
+		EXPECT_EQ(a[i].worldPosition.x, b[i].worldPosition.x);
+		EXPECT_EQ(a[i].worldPosition.y, b[i].worldPosition.y);
+	}
+}
+
+TEST(DynamicDrawListTest, AnimatedEntitiesDeformIntoScreenSpace) {
+	TestMeshes meshes;
+	meshes.square.parts.push_back({"body", 0, 4});
+	const std::vector<engine::assets::PartTransform> xforms{{0.0F, {1.0F, 1.0F}, {1.0F, 0.0F}, {0.0F, 0.0F}}};
+
+	std::vector<engine::assets::PlacedEntity> entities(3);
+	entities[0].defName = "a";
+	entities[0].position = {0.0F, 0.0F};
+	entities[0].partTransforms = &xforms; // animated: moved 1m right
+	entities[1].defName = "a"; // instanced
+	entities[1].position = {10.0F, 10.0F};
+	entities[2].defName = "a";
+	entities[2].position = {500.0F, 0.0F}; // culled
+	entities[2].partTransforms = &xforms;
+	foundation::JobSystem jobs(2);
+
+	DynamicDrawList list;
+	list.build(entities, makeView(), meshes.lookup(), kBatchCount, jobs);
+	EXPECT_EQ(list.entityCount(), 2U);
+	EXPECT_EQ(list.instanceCount(), 1U);
+
+	int animated = 0;
+	list.forEachAnimated([&animated](const AnimatedGeometry& anim) {
+		++animated;
+		ASSERT_EQ(anim.vertices.size(), 4U);
+		ASSERT_EQ(anim.indices.size(), 6U);
+		// (-0.5 + 1) m * 10 px/m + 500 px
+		EXPECT_FLOAT_EQ(anim.vertices[0].x, 505.0F);
+		EXPECT_FLOAT_EQ(anim.vertices[0].y, 495.0F);
+	});
+	EXPECT_EQ(animated, 1);
+}
@@ -79,8 +79,15 @@ namespace engine::world {
 			}
 		}
 
-		// Static entities from baked per-chunk meshes: single glDrawElements per
-		// chunk, no instancing overhead.
+		// Extract: cull and classify this frame's draws on the JobSystem. The
+		// lists are GL-free (dynamic mesh types seen for the first time are
+		// uploaded between builds), so the submit below only issues draws.
+		baked.buildDrawLists(ctx);
+		groundcover.buildDrawLists(ctx);
+		instancedDynamic.buildDrawList(ctx);
+
+		// Submit. Static entities from baked per-chunk meshes: single
+		// glDrawElements per visible range, no instancing overhead.
 		baked.renderBakedChunks(ctx, m_uniforms, stats);
 
 		// Groundcover (grass) via GPU instancing. Skipped by the baked path and
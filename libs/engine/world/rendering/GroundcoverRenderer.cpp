@@ -9,6 +9,7 @@
 #include <vector>
 #include <primitives/BatchRenderer.h>
 #include <primitives/Primitives.h>
+#include <threading/JobSystem.h>
 
 namespace engine::world {
 
@@ -44,6 +45,7 @@ void GroundcoverRenderer::evictLRU(const std::unordered_set<ChunkCoordinate>& pr
 	for (size_t i = 0; i < toEvict; ++i) {
 		m_groundcoverChunkCache.erase(byAge[i].first);
 	}
+	m_visibleChunks.clear(); // may point at erased entries
 }
 
 namespace {
@@ -61,7 +63,9 @@ const std::vector<Renderer::InstancedMeshHandle>& GroundcoverRenderer::ensureGro
 	}
 
 	// Generate the asset's variant tufts via the asset system (one buildMesh per seed) so the
-	// look lives entirely in the asset (grass.lua + params), not here.
+	// look lives entirely in the asset (grass.lua + params), not here. After an async load the
+	// meshes were pre-generated off this thread (AssetRegistry::pregenerateTemplates), so
+	// buildMesh is a copy and only the upload happens here.
 	std::vector<Renderer::InstancedMeshHandle> handles;
 	auto*									   batchRenderer = Renderer::Primitives::getBatchRenderer();
 	auto&									   registry = assets::AssetRegistry::Get();
@@ -121,26 +125,55 @@ void GroundcoverRenderer::buildGroundcoverChunk(
 	}
 }
 
-void GroundcoverRenderer::render(const RenderContext& ctx, InstancingUniforms& uniforms, RenderStats& stats) {
-	auto* batchRenderer = Renderer::Primitives::getBatchRenderer();
-	if (batchRenderer == nullptr) {
+namespace {
+	/// Zoom LOD: a tuft is kGroundcoverHeightM tall; below kGroundcoverLodCutoffPx on screen
+	/// we skip the geometry entirely and let the grass tile texture carry it. Tunable.
+	float groundcoverLodAlpha(const RenderContext& ctx) {
+		const float bladeScreenPx = kGroundcoverHeightM * ctx.pixelsPerMeter * ctx.camera.zoom();
+		return std::clamp((bladeScreenPx - kGroundcoverLodCutoffPx) / kGroundcoverLodCutoffPx, 0.0F, 1.0F);
+	}
+} // namespace
+
+void GroundcoverRenderer::buildDrawLists(const RenderContext& ctx) {
+	m_visibleChunks.clear();
+	if (groundcoverLodAlpha(ctx) <= 0.0F) {
 		return;
 	}
 
-	const float zoom = ctx.camera.zoom();
-	const float ppm = ctx.pixelsPerMeter;
+	// Touch every processed chunk's cache entry serially (map inserts, LRU stamps), then build
+	// the new ones in parallel: each reads the spatial index and writes only its own entry.
+	m_chunksToBuild.clear();
+	for (const auto& coord : ctx.processedChunks) {
+		auto& cache = m_groundcoverChunkCache[coord];
+		cache.lastAccessFrame = ctx.frameCounter;
+		if (!cache.built) {
+			m_chunksToBuild.emplace_back(coord, &cache);
+		}
+		m_visibleChunks.push_back(&cache);
+	}
+	foundation::JobSystem::shared().parallelFor(0, m_chunksToBuild.size(), 1, [this, &ctx](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			buildGroundcoverChunk(ctx.executor, m_chunksToBuild[i].first, *m_chunksToBuild[i].second);
+		}
+	});
+
+	const VisibleBounds vis = computeVisibleBounds(ctx.camera, ctx.viewportWidth, ctx.viewportHeight, ctx.pixelsPerMeter);
+	std::erase_if(m_visibleChunks, [&vis](const GroundcoverChunkCache* cache) {
+		return cache->maxX < vis.minX || cache->minX > vis.maxX || cache->maxY < vis.minY || cache->minY > vis.maxY;
+	});
+}
 
-	// Zoom LOD: a tuft is kGroundcoverHeightM tall; below kGroundcoverLodCutoffPx on screen
-	// we skip the geometry entirely and let the grass tile texture carry it. Tunable.
-	const float bladeScreenPx = kGroundcoverHeightM * ppm * zoom;
-	const float lodAlpha = std::clamp((bladeScreenPx - kGroundcoverLodCutoffPx) / kGroundcoverLodCutoffPx, 0.0F, 1.0F);
-	if (lodAlpha <= 0.0F) {
+void GroundcoverRenderer::render(const RenderContext& ctx, InstancingUniforms& uniforms, RenderStats& stats) {
+	auto* batchRenderer = Renderer::Primitives::getBatchRenderer();
+	if (batchRenderer == nullptr || m_visibleChunks.empty()) {
 		return;
 	}
 
-	const float			camX = ctx.camera.position().x;
-	const float			camY = ctx.camera.position().y;
-	const VisibleBounds vis = computeVisibleBounds(ctx.camera, ctx.viewportWidth, ctx.viewportHeight, ppm);
+	const float zoom = ctx.camera.zoom();
+	const float ppm = ctx.pixelsPerMeter;
+	const float lodAlpha = groundcoverLodAlpha(ctx);
+	const float camX = ctx.camera.position().x;
+	const float camY = ctx.camera.position().y;
 
 	GLuint shaderProgram = batchRenderer->getShaderProgram();
 	glUseProgram(shaderProgram);
@@ -162,16 +195,8 @@ void GroundcoverRenderer::render(const RenderContext& ctx, InstancingUniforms& u
 	}
 
 	const Foundation::Vec2 cameraPos(camX, camY);
-	for (const auto& coord : ctx.processedChunks) {
-		auto& cache = m_groundcoverChunkCache[coord];
-		cache.lastAccessFrame = ctx.frameCounter;
-		if (!cache.built) {
-			buildGroundcoverChunk(ctx.executor, coord, cache);
-		}
-		if (cache.maxX < vis.minX || cache.minX > vis.maxX || cache.maxY < vis.minY || cache.minY > vis.maxY) {
-			continue;
-		}
-		for (auto& [defName, buckets] : cache.byDef) {
+	for (auto* cache : m_visibleChunks) {
+		for (auto& [defName, buckets] : cache->byDef) {
 			const auto&	 handles = ensureGroundcoverVariants(defName);
 			const size_t count = std::min(buckets.size(), handles.size());
 			for (size_t v = 0; v < count; ++v) {
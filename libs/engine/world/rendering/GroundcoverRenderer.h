@@ -18,6 +18,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace engine::world {
@@ -25,6 +26,11 @@ namespace engine::world {
 /// Draws groundcover (grass) for the visible chunks via GPU instancing, with the zoom LOD.
 class GroundcoverRenderer {
   public:
+	/// Extract phase: build instance buckets for newly visible chunks (in parallel on the
+	/// JobSystem) and cull the visible list. GL-free; skipped entirely below the zoom LOD.
+	void buildDrawLists(const RenderContext& ctx);
+
+	/// Submit the chunks buildDrawLists() kept (uploads variant meshes on first use).
 	void render(const RenderContext& ctx, InstancingUniforms& uniforms, RenderStats& stats);
 
 	/// Release uploaded variant meshes on teardown.
@@ -49,6 +55,10 @@ class GroundcoverRenderer {
 	};
 	std::unordered_map<ChunkCoordinate, GroundcoverChunkCache> m_groundcoverChunkCache;
 
+	/// This frame's visible chunks, and the scratch list of chunks to build.
+	std::vector<GroundcoverChunkCache*>							m_visibleChunks;
+	std::vector<std::pair<ChunkCoordinate, GroundcoverChunkCache*>> m_chunksToBuild;
+
 	/// Per-defName uploaded variant mesh handles, generated lazily from the asset
 	/// (AssetRegistry::buildMesh per seed) so all look/feel stays in the asset, not engine C++.
 	std::unordered_map<std::string, std::vector<Renderer::InstancedMeshHandle>> m_groundcoverHandles;
@@ -4,6 +4,8 @@
 #include <primitives/Primitives.h>
 #include <vector/Types.h>
 
+#include <threading/JobSystem.h>
+
 #include <algorithm>
 
 namespace engine::world {
@@ -39,154 +41,99 @@ namespace engine::world {
 		return insertedIt->second;
 	}
 
-	void InstancedEntityRenderer::renderDynamic(const RenderContext& ctx, RenderStats& stats) {
-		// Dynamic entities (from ECS) change position each frame, so we rebuild them.
-		// GL state note: BatchRenderer::drawInstanced() sets up its own GL state internally,
-		// so we don't need to carry state from the baked path here.
-		const auto* dynamicEntities = ctx.dynamicEntities;
-		if (dynamicEntities != nullptr && !dynamicEntities->empty()) {
-			// Clear per-frame instance batches (keep capacity for reuse)
-			for (auto& [defName, batch] : m_instanceBatches) {
-				batch.clear();
+	void InstancedEntityRenderer::resolveMeshInfo(const std::string& defName) {
+		DynamicMeshInfo info;
+		info.mesh = m_templateCache.get(defName);
+		if (info.mesh != nullptr) {
+			const auto& handle = getOrCreateMeshHandle(defName, info.mesh);
+			if (handle.isValid()) {
+				info.batch = static_cast<uint32_t>(m_batchHandles.size());
+				m_batchHandles.push_back(&handle);
 			}
+		}
+		m_meshInfo.emplace(defName, info);
+	}
 
-			float zoom = ctx.camera.zoom();
-			float camX = ctx.camera.position().x;
-			float camY = ctx.camera.position().y;
-
-			const VisibleBounds vis = computeVisibleBounds(ctx.camera, ctx.viewportWidth, ctx.viewportHeight, ctx.pixelsPerMeter);
-
-			// Per-frame CPU batch for animated entities (per-part deformed; not GPU-instanceable).
-			m_animVertices.clear();
-			m_animColors.clear();
-			m_animIndices.clear();
-			uint32_t	animVertexBase = 0;
-			const float scale = ctx.pixelsPerMeter * zoom;
-			const float halfViewW = static_cast<float>(ctx.viewportWidth) * 0.5F;
-			const float halfViewH = static_cast<float>(ctx.viewportHeight) * 0.5F;
-
-			// Emit the accumulated animated batch as one CPU draw, then reset it. The batch uses a
-			// 16-bit index space, so we flush before it would overflow (only reachable at very high
-			// animated-entity counts) and once at the end. A mid-loop flush draws under the
-			// instanced entities; the common single end-flush draws over them.
-			auto flushAnim = [&]() {
-				if (m_animIndices.empty()) {
-					return;
-				}
-				Renderer::Primitives::drawTriangles(Renderer::Primitives::TrianglesArgs{
-					.vertices = m_animVertices.data(),
-					.indices = m_animIndices.data(),
-					.vertexCount = m_animVertices.size(),
-					.indexCount = m_animIndices.size(),
-					.colors = m_animColors.data()
-				});
-				m_animVertices.clear();
-				m_animColors.clear();
-				m_animIndices.clear();
-				animVertexBase = 0;
-			};
-
-			for (const auto& entity : *dynamicEntities) {
-				// Frustum culling for dynamic entities
-				if (entity.position.x < vis.minX || entity.position.x > vis.maxX || entity.position.y < vis.minY ||
-					entity.position.y > vis.maxY) {
-					continue;
-				}
-
-				// Get or create mesh handle for this asset type
-				const auto* templateMesh = m_templateCache.get(entity.defName);
-				if (templateMesh == nullptr) {
-					continue;
-				}
-
-				// Animated entities carry per-part transforms; they can't be GPU-instanced (each
-				// has unique deformed geometry), so emit them to the CPU batch with their parts moved.
-				if (entity.partTransforms != nullptr && !entity.partTransforms->empty() && !templateMesh->parts.empty()) {
-					// Keep the batch inside the 16-bit index space: flush if this entity overflows it.
-					if (animVertexBase + static_cast<uint32_t>(templateMesh->vertices.size()) > 65535U) {
-						flushAnim();
-					}
-					const auto& xforms = *entity.partTransforms;
-					const bool	hasMeshColors = templateMesh->hasColors();
-
-					// Copy the template verts, then deform each part's range by its transform.
-					thread_local std::vector<Foundation::Vec2> animVerts;
-					animVerts.assign(templateMesh->vertices.begin(), templateMesh->vertices.end());
-					for (size_t k = 0; k < templateMesh->parts.size() && k < xforms.size(); ++k) {
-						const auto&	   part = templateMesh->parts[k];
-						const uint32_t end =
-							std::min<uint32_t>(part.vertexStart + part.vertexCount, static_cast<uint32_t>(animVerts.size()));
-						for (uint32_t i = part.vertexStart; i < end; ++i) {
-							const glm::vec2 r = xforms[k].apply({animVerts[i].x, animVerts[i].y});
-							animVerts[i] = {r.x, r.y};
-						}
-					}
-
-					const float entityScale = entity.scale;
-					for (size_t i = 0; i < animVerts.size(); ++i) {
-						const float worldX = animVerts[i].x * entityScale + entity.position.x;
-						const float worldY = animVerts[i].y * entityScale + entity.position.y;
-						m_animVertices.emplace_back((worldX - camX) * scale + halfViewW, (worldY - camY) * scale + halfViewH);
-						if (hasMeshColors) {
-							const auto& mc = templateMesh->colors[i];
-							m_animColors.emplace_back(
-								mc.r * entity.colorTint.r, mc.g * entity.colorTint.g, mc.b * entity.colorTint.b, mc.a * entity.colorTint.a
-							);
-						} else {
-							m_animColors.emplace_back(entity.colorTint.r, entity.colorTint.g, entity.colorTint.b, entity.colorTint.a);
-						}
-					}
-					for (const auto idx : templateMesh->indices) {
-						m_animIndices.push_back(static_cast<uint16_t>(animVertexBase + idx));
-					}
-					animVertexBase += static_cast<uint32_t>(animVerts.size());
-					stats.entities++;
-					continue;
-				}
-
-				// Ensure mesh handle exists
-				auto& handle = getOrCreateMeshHandle(entity.defName, templateMesh);
-				if (!handle.isValid()) {
-					continue;
-				}
-
-				// Create instance data (world-space - GPU does the transform!)
-				Renderer::InstanceData instance(
-					Foundation::Vec2(entity.position.x, entity.position.y), entity.rotation, entity.scale, entity.colorTint
-				);
+	void InstancedEntityRenderer::buildDrawList(const RenderContext& ctx) {
+		const auto* dynamicEntities = ctx.dynamicEntities;
+		if (dynamicEntities == nullptr || dynamicEntities->empty()) {
+			return;
+		}
 
-				// Add to batch for this mesh type
-				m_instanceBatches[entity.defName].push_back(instance);
-				stats.entities++;
+		const float zoom = ctx.camera.zoom();
+		DynamicDrawView view;
+		view.vis = computeVisibleBounds(ctx.camera, ctx.viewportWidth, ctx.viewportHeight, ctx.pixelsPerMeter);
+		view.camX = ctx.camera.position().x;
+		view.camY = ctx.camera.position().y;
+		view.scale = ctx.pixelsPerMeter * zoom;
+		view.halfViewW = static_cast<float>(ctx.viewportWidth) * 0.5F;
+		view.halfViewH = static_cast<float>(ctx.viewportHeight) * 0.5F;
+
+		// Workers only read m_meshInfo; new defNames are resolved here between builds
+		// (template lookup and mesh upload are render-thread work), which only
+		// repeats the build on frames where a mesh type first appears.
+		const DynamicMeshLookup lookup = [this](const std::string& defName) -> const DynamicMeshInfo* {
+			auto it = m_meshInfo.find(defName);
+			return it != m_meshInfo.end() ? &it->second : nullptr;
+		};
+		auto& jobs = foundation::JobSystem::shared();
+		m_drawList.build(*dynamicEntities, view, lookup, static_cast<uint32_t>(m_batchHandles.size()), jobs);
+		if (!m_drawList.unresolved().empty()) {
+			for (const auto& defName : m_drawList.unresolved()) {
+				resolveMeshInfo(defName);
 			}
+			m_drawList.build(*dynamicEntities, view, lookup, static_cast<uint32_t>(m_batchHandles.size()), jobs);
+		}
+	}
 
-			// Draw dynamic entities with per-frame upload
-			auto* batchRenderer = Renderer::Primitives::getBatchRenderer();
-			if (batchRenderer != nullptr) {
-				Foundation::Vec2 cameraPos(camX, camY);
+	void InstancedEntityRenderer::renderDynamic(const RenderContext& ctx, RenderStats& stats) {
+		// Dynamic entities (from ECS) change position each frame; buildDrawList()
+		// culled and classified them. GL state note: BatchRenderer::drawInstanced()
+		// sets up its own GL state internally, so we don't need to carry state
+		// from the baked path here.
+		const auto* dynamicEntities = ctx.dynamicEntities;
+		if (dynamicEntities == nullptr || dynamicEntities->empty()) {
+			return;
+		}
+		stats.entities += m_drawList.entityCount();
 
-				for (auto& [defName, instances] : m_instanceBatches) {
-					if (instances.empty()) {
-						continue;
-					}
+		// Write every instance straight into the instance stream (in parallel),
+		// then draw one range per mesh type
+		auto* batchRenderer = Renderer::Primitives::getBatchRenderer();
+		if (batchRenderer != nullptr && m_drawList.instanceCount() > 0) {
+			Renderer::BatchRenderer::InstanceWrite write = batchRenderer->beginInstanceWrite(m_drawList.instanceCount());
+			if (write.data != nullptr) {
+				m_drawList.writeInstances(*dynamicEntities, write.data, foundation::JobSystem::shared());
+			}
 
-					auto handleIt = m_meshHandles.find(defName);
-					if (handleIt == m_meshHandles.end() || !handleIt->second.isValid()) {
+			if (batchRenderer->endInstanceWrite(write)) {
+				const Foundation::Vec2 cameraPos(ctx.camera.position().x, ctx.camera.position().y);
+				const auto&			   batches = m_drawList.batches();
+				for (size_t b = 0; b < batches.size(); ++b) {
+					if (batches[b].count == 0) {
 						continue;
 					}
 
 					// Stats note: drawInstanced increments BatchRenderer's own counters,
 					// so these draws are NOT added to stats.drawCalls (avoids double count)
 					batchRenderer->drawInstanced(
-						handleIt->second, instances.data(), static_cast<uint32_t>(instances.size()), cameraPos, zoom, ctx.pixelsPerMeter
+						*m_batchHandles[b], write, batches[b].first, batches[b].count, cameraPos, ctx.camera.zoom(), ctx.pixelsPerMeter
 					);
 				}
 			}
-
-			// Draw the animated dynamic entities (CPU per-part deformed) over the instanced ones,
-			// so a colonist's limbs sit on top of any instanced ground items.
-			flushAnim();
 		}
+
+		// Draw the animated dynamic entities (CPU per-part deformed) over the instanced ones,
+		// so a colonist's limbs sit on top of any instanced ground items.
+		m_drawList.forEachAnimated([](const AnimatedGeometry& anim) {
+			Renderer::Primitives::drawTriangles(Renderer::Primitives::TrianglesArgs{
+				.vertices = anim.vertices.data(),
+				.indices = anim.indices.data(),
+				.vertexCount = anim.vertices.size(),
+				.indexCount = anim.indices.size(),
+				.colors = anim.colors.data()
+			});
+		});
 	}
 
 } // namespace engine::world
@@ -1,19 +1,19 @@
 #pragma once
 
 // InstancedEntityRenderer - dynamic ECS entities via GPU instancing.
-// Dynamic entities (from ECS) change position each frame, so we rebuild their
-// instance batches per frame and draw one batch per mesh type. Shared mesh
-// geometry (VBO/IBO) is uploaded once per defName and reused.
+// Dynamic entities (from ECS) change position each frame, so their draw list
+// is rebuilt per frame: buildDrawList() culls and classifies them on JobSystem
+// workers (DynamicDrawList, GL-free), renderDynamic() writes the instances
+// into the BatchRenderer's instance stream and draws one batch per mesh type.
+// Shared mesh geometry (VBO/IBO) is uploaded once per defName and reused.
 
 #include "assets/placement/PlacementExecutor.h"
 #include "primitives/InstanceData.h"
+#include "world/rendering/DynamicDrawList.h"
 #include "world/rendering/InstancingUniforms.h"
 #include "world/rendering/RenderContext.h"
 #include "world/rendering/TemplateMeshCache.h"
 
-#include <graphics/Color.h>
-#include <math/Types.h>
-
 #include <cstdint>
 #include <string>
 #include <unordered_map>
@@ -30,7 +30,11 @@ class InstancedEntityRenderer {
   public:
 	~InstancedEntityRenderer();
 
-	/// Render dynamic entities (per-frame rebuild) via GPU instancing.
+	/// Extract phase: build this frame's dynamic draw list (parallel; uploads
+	/// meshes for defNames seen for the first time, so call on the GL thread).
+	void buildDrawList(const RenderContext& ctx);
+
+	/// Submit phase: draw the list built by buildDrawList().
 	void renderDynamic(const RenderContext& ctx, RenderStats& stats);
 
   private:
@@ -42,18 +46,19 @@ class InstancedEntityRenderer {
 	// These hold the SHARED mesh geometry (VBO/IBO) that all chunks reference
 	std::unordered_map<std::string, Renderer::InstancedMeshHandle> m_meshHandles;
 
-	// Per-frame instance batches (grouped by mesh type, reused each frame)
-	// Used ONLY for dynamic entities that change per-frame
-	std::unordered_map<std::string, std::vector<Renderer::InstanceData>> m_instanceBatches;
+	// Resolved per-defName info read by the parallel build, and the mesh
+	// handle of each instanced batch (batch index = position here)
+	std::unordered_map<std::string, DynamicMeshInfo> m_meshInfo;
+	std::vector<const Renderer::InstancedMeshHandle*> m_batchHandles;
+
+	// This frame's draw list (reused each frame)
+	DynamicDrawList m_drawList;
 
 	// Memoized template meshes (keyed by defName)
 	TemplateMeshCache m_templateCache;
 
-	// Per-frame CPU geometry for animated entities (per-part deformed, so not GPU-instanceable):
-	// their parts are transformed on the CPU and drawn in one batch over the instanced entities.
-	std::vector<Foundation::Vec2>  m_animVertices;
-	std::vector<Foundation::Color> m_animColors;
-	std::vector<uint16_t>		   m_animIndices;
+	/// Resolve a defName seen for the first time (template lookup + GPU upload)
+	void resolveMeshInfo(const std::string& defName);
 
 	/// Get or create GPU mesh handle for a template
 	Renderer::InstancedMeshHandle& getOrCreateMeshHandle(
@@ -0,0 +1,81 @@
+#include "TileDataPacking.h"
+
+#include <algorithm>
+
+namespace engine::world {
+
+	namespace {
+		/// Surface id at tile (x, y), which may lie one tile outside the chunk: an
+		/// apron tile reads the neighbor id its adjacent border tile stores.
+		uint8_t surfaceAt(const TileRenderData* renderData, int x, int y) {
+			const int			  cx = std::clamp(x, 0, kChunkSize - 1);
+			const int			  cy = std::clamp(y, 0, kChunkSize - 1);
+			const TileRenderData& border = renderData[cy * kChunkSize + cx];
+			const int			  dx = x - cx;
+			const int			  dy = y - cy;
+			if (dy < 0) {
+				return dx < 0 ? border.neighborNW : (dx > 0 ? border.neighborNE : border.neighborN);
+			}
+			if (dy > 0) {
+				return dx < 0 ? border.neighborSW : (dx > 0 ? border.neighborSE : border.neighborS);
+			}
+			return dx < 0 ? border.neighborW : (dx > 0 ? border.neighborE : border.surfaceId);
+		}
+	} // namespace
+
+	void packTileSurfaceRect(const TileRenderData* renderData, const TileTexelRect& rect, uint8_t* out) {
+		for (int py = rect.y; py < rect.y + rect.height; ++py) {
+			for (int px = rect.x; px < rect.x + rect.width; ++px) {
+				const int  x = px - 1;
+				const int  y = py - 1;
+				const bool inside = x >= 0 && y >= 0 && x < kChunkSize && y < kChunkSize;
+				*out++ = surfaceAt(renderData, x, y);
+				*out++ = inside ? renderData[y * kChunkSize + x].waterDepth : 0;
+			}
+		}
+	}
+
+	void packTileMaskRect(const TileRenderData* renderData, const TileTexelRect& rect, uint8_t* out) {
+		for (int y = rect.y; y < rect.y + rect.height; ++y) {
+			for (int x = rect.x; x < rect.x + rect.width; ++x) {
+				const TileRenderData& tile = renderData[y * kChunkSize + x];
+				*out++ = static_cast<uint8_t>((tile.edgeMask & 0x0F) | (tile.cornerMask << 4));
+			}
+		}
+	}
+
+	TileRenderData unpackTileRenderData(const uint8_t* surfacePlane, const uint8_t* maskPlane, int x, int y) {
+		auto surface = [&](int dx, int dy) {
+			return surfacePlane[((y + 1 + dy) * kTileSurfacePlaneSize + (x + 1 + dx)) * kTileSurfaceTexelBytes];
+		};
+
+		TileRenderData tile{};
+		tile.surfaceId = surface(0, 0);
+		tile.waterDepth = surfacePlane[((y + 1) * kTileSurfacePlaneSize + (x + 1)) * kTileSurfaceTexelBytes + 1];
+		tile.neighborN = surface(0, -1);
+		tile.neighborE = surface(1, 0);
+		tile.neighborS = surface(0, 1);
+		tile.neighborW = surface(-1, 0);
+		tile.neighborNW = surface(-1, -1);
+		tile.neighborNE = surface(1, -1);
+		tile.neighborSE = surface(1, 1);
+		tile.neighborSW = surface(-1, 1);
+
+		const uint8_t masks = maskPlane[y * kChunkSize + x];
+		tile.edgeMask = masks & 0x0F;
+		tile.cornerMask = masks >> 4;
+
+		uint64_t adjacency = 0;
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::N, tile.neighborN);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::E, tile.neighborE);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::S, tile.neighborS);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::W, tile.neighborW);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::NW, tile.neighborNW);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::NE, tile.neighborNE);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::SE, tile.neighborSE);
+		TileAdjacency::setNeighbor(adjacency, TileAdjacency::SW, tile.neighborSW);
+		tile.hardEdgeMask = TileAdjacency::getHardEdgeMaskByFamily(adjacency, tile.surfaceId);
+		return tile;
+	}
+
+} // namespace engine::world
@@ -0,0 +1,82 @@
+#pragma once
+
+// Compact GPU encoding of a chunk's TileRenderData for ChunkRenderer.
+// TileRenderData is 16 bytes per tile, and most of it is the 8 neighbor surface
+// ids -- which are just the surface ids of the adjacent tiles. The GPU copy
+// keeps only what tile.frag cannot derive:
+//   surface plane  RG8UI, (kChunkSize+2)^2: r = surfaceId, g = waterDepth. A
+//                  one-tile apron holds the surfaces just outside the chunk,
+//                  copied from the border tiles' neighbor ids, so it tracks
+//                  adjacency stitching exactly. Neighbors are fetched from here.
+//   mask plane     R8UI, kChunkSize^2: edgeMask | cornerMask << 4.
+// hardEdgeMask depends only on the surface families of a tile and its 8
+// neighbors (TileAdjacency::getHardEdgeMaskByFamily); tile.frag recomputes it
+// from a family table ChunkRenderer uploads. ~3 bytes per tile instead of 16:
+// 0.76 MB per chunk instead of 4 MB.
+//
+// Stitching (Chunk::setAdjacency on border tiles) changes only the apron and
+// the mask plane's outer ring: kTileSurfaceBorderRects / kTileMaskBorderRects,
+// a few KB that ChunkRenderer re-uploads in place of the whole chunk.
+//
+// CPU only; no GL.
+
+#include "world/chunk/Chunk.h"
+#include "world/chunk/TileAdjacency.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::world {
+
+/// Surface plane edge length: the chunk plus a one-tile apron on each side.
+inline constexpr int kTileSurfacePlaneSize = kChunkSize + 2;
+inline constexpr int kTileSurfaceTexelBytes = 2; // RG8UI
+inline constexpr int kTileMaskTexelBytes = 1;	 // R8UI
+
+/// Surface ids fit the adjacency field's 6 bits per direction; sizes the
+/// family table tile.frag indexes.
+inline constexpr int kTileSurfaceIdCount = 1 << TileAdjacency::kBitsPerDirection;
+
+/// Texel rectangle within one plane.
+struct TileTexelRect {
+	int x = 0;
+	int y = 0;
+	int width = 0;
+	int height = 0;
+
+	[[nodiscard]] constexpr size_t area() const { return static_cast<size_t>(width) * static_cast<size_t>(height); }
+};
+
+inline constexpr TileTexelRect kTileSurfacePlaneRect{0, 0, kTileSurfacePlaneSize, kTileSurfacePlaneSize};
+inline constexpr TileTexelRect kTileMaskPlaneRect{0, 0, kChunkSize, kChunkSize};
+
+/// Texels a border re-stitch can change: top and bottom rows (corners
+/// included), then the left and right columns between them.
+inline constexpr std::array<TileTexelRect, 4> kTileSurfaceBorderRects{{
+	{0, 0, kTileSurfacePlaneSize, 1},
+	{0, kTileSurfacePlaneSize - 1, kTileSurfacePlaneSize, 1},
+	{0, 1, 1, kTileSurfacePlaneSize - 2},
+	{kTileSurfacePlaneSize - 1, 1, 1, kTileSurfacePlaneSize - 2},
+}};
+inline constexpr std::array<TileTexelRect, 4> kTileMaskBorderRects{{
+	{0, 0, kChunkSize, 1},
+	{0, kChunkSize - 1, kChunkSize, 1},
+	{0, 1, 1, kChunkSize - 2},
+	{kChunkSize - 1, 1, 1, kChunkSize - 2},
+}};
+
+/// Encode `rect` of the surface plane (apron-inclusive texel coordinates) from
+/// a chunk's render data. Writes rect.area() * kTileSurfaceTexelBytes bytes,
+/// row-major, tightly packed.
+void packTileSurfaceRect(const TileRenderData* renderData, const TileTexelRect& rect, uint8_t* out);
+
+/// Encode `rect` of the mask plane (tile coordinates). Writes
+/// rect.area() * kTileMaskTexelBytes bytes, row-major, tightly packed.
+void packTileMaskRect(const TileRenderData* renderData, const TileTexelRect& rect, uint8_t* out);
+
+/// Decode tile (x, y) from whole planes the way tile.frag does: neighbors from
+/// the surface plane, hardEdgeMask from surface families. Padding is zero.
+[[nodiscard]] TileRenderData unpackTileRenderData(const uint8_t* surfacePlane, const uint8_t* maskPlane, int x, int y);
+
+} // namespace engine::world
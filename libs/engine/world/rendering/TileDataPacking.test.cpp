@@ -0,0 +1,152 @@
+// Tests for the packed tile-data encoding: every TileRenderData field survives
+// a pack/unpack round trip, and a border-only repack after stitching matches a
+// full repack.
+
+#include "world/rendering/TileDataPacking.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace engine::world;
+
+namespace {
+
+	/// Surface ids for the chunk plus a one-tile ring of outside tiles,
+	/// (kChunkSize+2)^2 row-major; (x, y) in chunk coordinates, -1..kChunkSize.
+	struct SurfaceGrid {
+		std::vector<uint8_t> ids;
+
+		explicit SurfaceGrid(uint32_t seed)
+			: ids(static_cast<size_t>(kTileSurfacePlaneSize) * kTileSurfacePlaneSize) {
+			// Mostly the five real surfaces, plus ids up to the 6-bit limit.
+			std::mt19937 rng(seed);
+			for (auto& id : ids) {
+				id = static_cast<uint8_t>(rng() % 8 == 0 ? rng() % kTileSurfaceIdCount : rng() % 5);
+			}
+		}
+
+		uint8_t& at(int x, int y) { return ids[static_cast<size_t>(y + 1) * kTileSurfacePlaneSize + (x + 1)]; }
+
+		uint64_t adjacencyAt(int x, int y) {
+			uint64_t adj = 0;
+			TileAdjacency::setNeighbor(adj, TileAdjacency::N, at(x, y - 1));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::E, at(x + 1, y));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::S, at(x, y + 1));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::W, at(x - 1, y));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::NW, at(x - 1, y - 1));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::NE, at(x + 1, y - 1));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::SE, at(x + 1, y + 1));
+			TileAdjacency::setNeighbor(adj, TileAdjacency::SW, at(x - 1, y + 1));
+			return adj;
+		}
+
+		TileRenderData renderAt(int x, int y) {
+			const auto waterDepth = static_cast<uint8_t>((x * 7 + y * 13) & 0xFF);
+			return makeTileRenderData(at(x, y), waterDepth, adjacencyAt(x, y));
+		}
+
+		std::vector<TileRenderData> renderData() {
+			std::vector<TileRenderData> out(static_cast<size_t>(kChunkSize) * kChunkSize);
+			for (int y = 0; y < kChunkSize; ++y) {
+				for (int x = 0; x < kChunkSize; ++x) {
+					out[static_cast<size_t>(y) * kChunkSize + x] = renderAt(x, y);
+				}
+			}
+			return out;
+		}
+	};
+
+	struct PackedPlanes {
+		std::vector<uint8_t> surfaces = std::vector<uint8_t>(kTileSurfacePlaneRect.area() * kTileSurfaceTexelBytes);
+		std::vector<uint8_t> masks = std::vector<uint8_t>(kTileMaskPlaneRect.area() * kTileMaskTexelBytes);
+
+		explicit PackedPlanes(const std::vector<TileRenderData>& data) {
+			packTileSurfaceRect(data.data(), kTileSurfacePlaneRect, surfaces.data());
+			packTileMaskRect(data.data(), kTileMaskPlaneRect, masks.data());
+		}
+	};
+
+	/// Copy a tightly packed sub-rect into a whole plane, as glTexSubImage2D would.
+	void blit(const std::vector<uint8_t>& rectBytes, const TileTexelRect& rect, int planeWidth, int texelBytes,
+			  std::vector<uint8_t>& plane) {
+		for (int row = 0; row < rect.height; ++row) {
+			std::memcpy(plane.data() + (static_cast<size_t>(rect.y + row) * planeWidth + rect.x) * texelBytes,
+						rectBytes.data() + static_cast<size_t>(row) * rect.width * texelBytes,
+						static_cast<size_t>(rect.width) * texelBytes);
+		}
+	}
+
+	bool sameTile(const TileRenderData& a, const TileRenderData& b) {
+		return a.surfaceId == b.surfaceId && a.edgeMask == b.edgeMask && a.cornerMask == b.cornerMask &&
+			   a.hardEdgeMask == b.hardEdgeMask && a.neighborN == b.neighborN && a.neighborE == b.neighborE &&
+			   a.neighborS == b.neighborS && a.neighborW == b.neighborW && a.neighborNW == b.neighborNW &&
+			   a.neighborNE == b.neighborNE && a.neighborSE == b.neighborSE && a.neighborSW == b.neighborSW &&
+			   a.waterDepth == b.waterDepth;
+	}
+
+} // namespace
+
+TEST(TileDataPackingTest, RoundTripsEveryTile) {
+	SurfaceGrid						  grid(42);
+	const std::vector<TileRenderData> data = grid.renderData();
+	const PackedPlanes				  packed(data);
+
+	int mismatches = 0;
+	for (int y = 0; y < kChunkSize; ++y) {
+		for (int x = 0; x < kChunkSize; ++x) {
+			const TileRenderData& expected = data[static_cast<size_t>(y) * kChunkSize + x];
+			if (!sameTile(unpackTileRenderData(packed.surfaces.data(), packed.masks.data(), x, y), expected)) {
+				++mismatches;
+			}
+		}
+	}
+	EXPECT_EQ(mismatches, 0);
+
+	const size_t packedBytes = packed.surfaces.size() + packed.masks.size();
+	const size_t rawBytes = data.size() * sizeof(TileRenderData);
+	EXPECT_GE(rawBytes, packedBytes * 4) << "packed " << packedBytes << " bytes vs " << rawBytes;
+}
+
+TEST(TileDataPackingTest, BorderRepackMatchesFullRepackAfterStitching) {
+	SurfaceGrid					grid(7);
+	std::vector<TileRenderData> data = grid.renderData();
+	PackedPlanes				gpu(data);
+
+	// Neighbors load and the outside ring changes; only border tiles are
+	// re-stitched, like ChunkManager::refreshAdjacencyForChunkBoundary.
+	std::mt19937 rng(99);
+	for (int i = -1; i <= kChunkSize; ++i) {
+		grid.at(i, -1) = static_cast<uint8_t>(rng() % 5);
+		grid.at(i, kChunkSize) = static_cast<uint8_t>(rng() % 5);
+		grid.at(-1, i) = static_cast<uint8_t>(rng() % 5);
+		grid.at(kChunkSize, i) = static_cast<uint8_t>(rng() % 5);
+	}
+	for (int i = 0; i < kChunkSize; ++i) {
+		for (auto [x, y] : {std::pair{i, 0}, std::pair{i, kChunkSize - 1}, std::pair{0, i}, std::pair{kChunkSize - 1, i}}) {
+			data[static_cast<size_t>(y) * kChunkSize + x] = grid.renderAt(x, y);
+		}
+	}
+
+	size_t uploadedBytes = 0;
+	for (const TileTexelRect& rect : kTileSurfaceBorderRects) {
+		std::vector<uint8_t> bytes(rect.area() * kTileSurfaceTexelBytes);
+		packTileSurfaceRect(data.data(), rect, bytes.data());
+		blit(bytes, rect, kTileSurfacePlaneSize, kTileSurfaceTexelBytes, gpu.surfaces);
+		uploadedBytes += bytes.size();
+	}
+	for (const TileTexelRect& rect : kTileMaskBorderRects) {
+		std::vector<uint8_t> bytes(rect.area() * kTileMaskTexelBytes);
+		packTileMaskRect(data.data(), rect, bytes.data());
+		blit(bytes, rect, kChunkSize, kTileMaskTexelBytes, gpu.masks);
+		uploadedBytes += bytes.size();
+	}
+
+	const PackedPlanes full(data);
+	EXPECT_EQ(gpu.surfaces, full.surfaces);
+	EXPECT_EQ(gpu.masks, full.masks);
+	EXPECT_LT(uploadedBytes * 100, full.surfaces.size() + full.masks.size());
+}
@@ -19,6 +19,8 @@ namespace Foundation {
 		json << "\"drawCalls\":" << drawCalls << ",";
 		json << "\"vertexCount\":" << vertexCount << ",";
 		json << "\"triangleCount\":" << triangleCount << ",";
+		json << "\"uploadBytes\":" << uploadBytes << ",";
+		json << "\"uploadStalls\":" << uploadStalls << ",";
 		// Timing breakdown
 		json << "\"tileRenderMs\":" << tileRenderMs << ",";
 		json << "\"entityRenderMs\":" << entityRenderMs << ",";
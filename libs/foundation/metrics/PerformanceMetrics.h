@@ -24,6 +24,8 @@ namespace Foundation { // NOLINT(readability-identifier-naming)
 		uint32_t drawCalls{};	   // Number of draw calls this frame
 		uint32_t vertexCount{};	   // Number of vertices rendered this frame
 		uint32_t triangleCount{};  // Number of triangles rendered this frame
+		uint64_t uploadBytes{};	   // Bytes streamed CPU->GPU this frame (vertices, indices, instances)
+		uint32_t uploadStalls{};   // Streaming fence waits that blocked on the GPU this frame
 
 		// Timing breakdown (for profiling bottlenecks)
 		float	 tileRenderMs{};	 // Time spent rendering tiles
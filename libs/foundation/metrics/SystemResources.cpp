@@ -1,4 +1,5 @@
-// SystemResources - macOS implementation using mach APIs.
+// SystemResources - macOS implementation using mach APIs; memory-only on
+// Linux (/proc/self/status) and Windows (process memory counters).
 
 #include "metrics/SystemResources.h"
 
@@ -7,6 +8,24 @@
 #include <mach/task_info.h>
 #include <sys/resource.h>
 #include <sys/sysctl.h>
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+#ifdef __linux__
+#include <cstdio>
+#include <sys/resource.h>
+#endif
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <ctime>
 #endif
 
 #include <chrono>
@@ -20,19 +39,9 @@ namespace Foundation {
 	uint64_t SystemResources::s_lastSampleTime = 0;
 
 	ResourceSnapshot SystemResources::sample() {
-		ResourceSnapshot snapshot;
+		ResourceSnapshot snapshot = sampleMemory();
 
 #ifdef __APPLE__
-		// Get memory info
-		mach_task_basic_info_data_t taskInfo;
-		mach_msg_type_number_t		infoCount = MACH_TASK_BASIC_INFO_COUNT;
-
-		if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&taskInfo), &infoCount) ==
-			KERN_SUCCESS) {
-			snapshot.memoryUsedBytes = taskInfo.resident_size;
-			snapshot.memoryPeakBytes = taskInfo.resident_size_max;
-		}
-
 		// Get CPU usage
 		thread_array_t		  threadList;
 		mach_msg_type_number_t threadCount;
@@ -80,10 +89,102 @@ namespace Foundation {
 		}
 #endif
 
+		return snapshot;
+	}
+
+	ResourceSnapshot SystemResources::sampleMemory() {
+		ResourceSnapshot snapshot;
+
+#ifdef __APPLE__
+		mach_task_basic_info_data_t taskInfo;
+		mach_msg_type_number_t		infoCount = MACH_TASK_BASIC_INFO_COUNT;
+
+		if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&taskInfo), &infoCount) ==
+			KERN_SUCCESS) {
+			snapshot.memoryUsedBytes = taskInfo.resident_size;
+			snapshot.memoryPeakBytes = taskInfo.resident_size_max;
+		}
+#elif defined(__linux__)
+		// Resident and peak-resident set size (kB) from procfs. CPU usage is not
+		// sampled here; worldgen-cli and the perf tooling only need memory.
+		if (std::FILE* fp = std::fopen("/proc/self/status", "r")) {
+			char			   line[256];
+			unsigned long long kb = 0;
+			while (std::fgets(line, sizeof(line), fp) != nullptr) {
+				if (std::sscanf(line, "VmRSS: %llu kB", &kb) == 1) {
+					snapshot.memoryUsedBytes = static_cast<uint64_t>(kb) * 1024;
+				} else if (std::sscanf(line, "VmHWM: %llu kB", &kb) == 1) {
+					snapshot.memoryPeakBytes = static_cast<uint64_t>(kb) * 1024;
+				}
+			}
+			std::fclose(fp);
+		}
+#elif defined(_WIN32)
+		PROCESS_MEMORY_COUNTERS counters{};
+		if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+			snapshot.memoryUsedBytes = static_cast<uint64_t>(counters.WorkingSetSize);
+			snapshot.memoryPeakBytes = static_cast<uint64_t>(counters.PeakWorkingSetSize);
+		}
+#endif
+
 		// Get CPU core count (cached after first call)
 		snapshot.cpuCoreCount = static_cast<uint32_t>(std::thread::hardware_concurrency());
 
 		return snapshot;
 	}
 
+	double SystemResources::processCpuSeconds() {
+#if defined(__APPLE__) || defined(__linux__)
+		rusage usage{};
+		if (getrusage(RUSAGE_SELF, &usage) != 0) {
+			return 0.0;
+		}
+		auto toSeconds = [](const timeval& tv) {
+			return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) * 1e-6;
+		};
+		return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+#elif defined(_WIN32)
+		FILETIME creation{};
+		FILETIME exitTime{};
+		FILETIME kernel{};
+		FILETIME user{};
+		if (!GetProcessTimes(GetCurrentProcess(), &creation, &exitTime, &kernel, &user)) {
+			return 0.0;
+		}
+		// FILETIME counts 100 ns intervals.
+		auto toSeconds = [](const FILETIME& ft) {
+			uint64_t ticks = (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+			return static_cast<double>(ticks) * 1e-7;
+		};
+		return toSeconds(kernel) + toSeconds(user);
+#else
+		return 0.0;
+#endif
+	}
+
+	double SystemResources::threadCpuSeconds() {
+#if defined(__APPLE__) || defined(__linux__)
+		timespec ts{};
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+			return 0.0;
+		}
+		return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+#elif defined(_WIN32)
+		FILETIME creation{};
+		FILETIME exitTime{};
+		FILETIME kernel{};
+		FILETIME user{};
+		if (!GetThreadTimes(GetCurrentThread(), &creation, &exitTime, &kernel, &user)) {
+			return 0.0;
+		}
+		auto toSeconds = [](const FILETIME& ft) {
+			uint64_t ticks = (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+			return static_cast<double>(ticks) * 1e-7;
+		};
+		return toSeconds(kernel) + toSeconds(user);
+#else
+		return 0.0;
+#endif
+	}
+
 } // namespace Foundation
@@ -3,7 +3,10 @@
 // SystemResources - Platform-specific helpers for CPU/memory monitoring.
 //
 // Provides lightweight resource monitoring for performance diagnostics.
-// Uses mach APIs on macOS for accurate per-process metrics.
+// Uses mach APIs on macOS for accurate per-process metrics. Linux and Windows
+// report memory (current and peak RSS) only; CPU usage stays 0 there.
+// processCpuSeconds() (cumulative process CPU time) and threadCpuSeconds()
+// (the calling thread's) work on all three.
 
 #include <cstdint>
 
@@ -22,6 +25,19 @@ namespace Foundation {
 		/// CPU usage is calculated since last call to this function
 		static ResourceSnapshot sample();
 
+		/// Memory and core count only (cpuUsagePercent stays 0). Touches no
+		/// shared state, so unlike sample() it is safe to call from any thread.
+		static ResourceSnapshot sampleMemory();
+
+		/// Total user + system CPU time consumed by this process so far, in
+		/// seconds, summed over all threads. Thread-safe; 0 where unsupported.
+		static double processCpuSeconds();
+
+		/// User + system CPU time consumed so far by the calling thread alone, in
+		/// seconds. Unlike processCpuSeconds() it is not inflated by other threads
+		/// working at the same time. 0 where unsupported.
+		static double threadCpuSeconds();
+
 	  private:
 		// For CPU usage calculation between samples
 		static uint64_t s_lastUserTime;
@@ -0,0 +1,50 @@
+#include "JobSystem.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <future>
+#include <vector>
+
+using namespace foundation;
+
+// ParallelFor, fan-out and many-small-task cases run side by side with TaskPool
+// in TaskPool.bench.cpp; this file covers what only JobSystem is compared on.
+
+// The std::async pattern the engine used before JobSystem: one thread per task.
+// Compare with BM_ManySmallTasks<JobSystemBackend>/1000.
+static void BM_StdAsyncManySmallJobs(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        std::atomic<int> n{0};
+        std::vector<std::future<void>> futures;
+        futures.reserve(static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            futures.push_back(std::async(std::launch::async, [&] { n.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto& f : futures) f.wait();
+        benchmark::DoNotOptimize(n.load());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdAsyncManySmallJobs)->Arg(1000);
+
+// Nested parallelFor (not possible on TaskPool): 64 outer slabs x 16 inner.
+static void BM_JobSystemNestedParallelFor(benchmark::State& state) {
+    JobSystem jobs(4);
+    std::vector<int64_t> data(64 * 16 * 256, 1);
+
+    for (auto _ : state) {
+        std::atomic<int64_t> sum{0};
+        jobs.parallelFor(0, 64, 1, [&](size_t ob, size_t) {
+            jobs.parallelFor(0, 16, 1, [&](size_t ib, size_t) {
+                const size_t base = (ob * 16 + ib) * 256;
+                int64_t      local = 0;
+                for (size_t i = 0; i < 256; ++i) local += data[base + i]; // NOLINT
+                sum.fetch_add(local, std::memory_order_relaxed);
+            });
+        });
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(BM_JobSystemNestedParallelFor);
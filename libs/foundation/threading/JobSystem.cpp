@@ -0,0 +1,279 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace foundation {
+
+namespace {
+
+// Jobs a worker can hold in one deque before overflowing to the injection
+// queue. Deep fork/join trees stay well under this.
+constexpr size_t kDequeCapacity = 4096;
+
+// Failed take attempts (each followed by a yield) before a worker sleeps.
+constexpr int kIdleSpins = 64;
+
+// Upper bound on how long a helping waiter blocks before re-polling the
+// queues; wakeups normally come sooner via waitCv.
+constexpr auto kWaitPoll = std::chrono::microseconds(200);
+
+thread_local const JobSystem* tlsSystem      = nullptr;
+thread_local int              tlsWorkerIndex = -1;
+
+} // namespace
+
+// ============================================================================
+// TaskGroup
+// ============================================================================
+
+TaskGroup::~TaskGroup() {
+    system.helpUntilDone(*this);
+}
+
+void TaskGroup::run(std::function<void()> fn, JobPriority priority) {
+    jobs.fetch_add(1, std::memory_order_relaxed);
+    pending.fetch_add(1, std::memory_order_relaxed);
+    system.enqueue(new JobSystem::Job{std::move(fn), this, false}, priority);
+}
+
+void TaskGroup::then(std::function<void()> fn, JobPriority priority) {
+    bool launchNow = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.fetch_add(1, std::memory_order_relaxed);
+        // Checked under the mutex: a job finishing concurrently either sees
+        // the stored continuation when it takes the mutex, or has already
+        // dropped jobs to 0 and we launch here.
+        if (jobs.load(std::memory_order_acquire) == 0) {
+            continuationLaunched = true;
+            launchNow = true;
+        } else {
+            continuation = std::move(fn);
+            continuationPriority = priority;
+        }
+    }
+    if (launchNow) system.enqueue(new JobSystem::Job{std::move(fn), this, true}, priority);
+}
+
+void TaskGroup::wait() {
+    system.helpUntilDone(*this);
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::exchange(firstError, nullptr);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void TaskGroup::finishJob(std::exception_ptr error, bool isContinuation) {
+    if (error) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!firstError) firstError = error;
+    }
+
+    if (!isContinuation && jobs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::function<void()> cont;
+        JobPriority contPriority = JobPriority::High;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (continuation && !continuationLaunched) {
+                cont = std::exchange(continuation, nullptr);
+                contPriority = continuationPriority;
+                continuationLaunched = true;
+            }
+        }
+        if (cont) system.enqueue(new JobSystem::Job{std::move(cont), this, true}, contPriority);
+    }
+
+    // Last touch of *this: once pending hits 0 a waiter may destroy the group.
+    JobSystem& sys = system;
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) sys.notifyGroupDone();
+}
+
+// ============================================================================
+// JobSystem
+// ============================================================================
+
+JobSystem::JobSystem(unsigned threadCount) {
+    if (threadCount == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threadCount = (hw > 1) ? hw - 1 : 1;
+    }
+    workers.resize(threadCount);
+    for (Worker& w : workers) {
+        for (auto& deque : w.deques) deque = std::make_unique<WorkStealingDeque<Job>>(kDequeCapacity);
+    }
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers[i].thread = std::thread([this, i] { workerLoop(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        shutdown = true;
+    }
+    sleepCv.notify_all();
+    for (Worker& w : workers) {
+        if (w.thread.joinable()) w.thread.join();
+    }
+}
+
+JobSystem& JobSystem::shared() {
+    static JobSystem instance;
+    return instance;
+}
+
+int JobSystem::currentWorkerIndex() const {
+    return tlsSystem == this ? tlsWorkerIndex : -1;
+}
+
+void JobSystem::enqueue(Job* job, JobPriority priority) {
+    const auto p = static_cast<size_t>(priority);
+    // Count before publishing so a taker can never decrement below zero.
+    queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+
+    const int self = currentWorkerIndex();
+    if (self < 0 || !workers[static_cast<size_t>(self)].deques[p]->push(job)) {
+        std::lock_guard<std::mutex> lock(injectMutex);
+        injected[p].push_back(job);
+    }
+
+    // Pairs with the sleeper's seq_cst increment of sleepingWorkers before it
+    // re-checks queuedJobs: either it sees our job or we see it asleep.
+    if (sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        sleepCv.notify_one();
+    }
+    waitCv.notify_all();
+}
+
+JobSystem::Job* JobSystem::tryTake(int workerIndex) {
+    const size_t n = workers.size();
+    for (size_t p = 0; p < kJobPriorityCount; ++p) {
+        Job* job = nullptr;
+        if (workerIndex >= 0) job = workers[static_cast<size_t>(workerIndex)].deques[p]->pop();
+        if (!job) {
+            std::lock_guard<std::mutex> lock(injectMutex);
+            if (!injected[p].empty()) {
+                job = injected[p].front();
+                injected[p].pop_front();
+            }
+        }
+        // Steal round-robin starting after ourselves so thieves spread out.
+        const size_t start = workerIndex >= 0 ? static_cast<size_t>(workerIndex) + 1 : 0;
+        for (size_t k = 0; !job && k < n; ++k) {
+            const size_t victim = (start + k) % n;
+            if (static_cast<int>(victim) == workerIndex) continue;
+            job = workers[victim].deques[p]->steal();
+        }
+        if (job) {
+            queuedJobs.fetch_sub(1, std::memory_order_seq_cst);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::execute(Job* job) {
+    std::exception_ptr error;
+    try {
+        job->fn();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    TaskGroup* group = job->group;
+    const bool isContinuation = job->isContinuation;
+    delete job;
+    // Detached jobs come from submit(), whose packaged_task stores any
+    // exception in the future, so only group jobs can get here with one.
+    if (group) group->finishJob(error, isContinuation);
+}
+
+void JobSystem::helpUntilDone(const TaskGroup& group) {
+    const int self = currentWorkerIndex();
+    while (!group.done()) {
+        if (Job* job = tryTake(self)) {
+            execute(job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(waitMutex);
+        waitCv.wait_for(lock, kWaitPoll, [&] {
+            return group.done() || queuedJobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+void JobSystem::notifyGroupDone() {
+    { std::lock_guard<std::mutex> lock(waitMutex); }
+    waitCv.notify_all();
+}
+
+void JobSystem::workerLoop(unsigned index) {
+    tlsSystem      = this;
+    tlsWorkerIndex = static_cast<int>(index);
+
+    int idle = 0;
+    while (true) {
+        if (Job* job = tryTake(static_cast<int>(index))) {
+            execute(job);
+            idle = 0;
+            continue;
+        }
+        if (++idle < kIdleSpins) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle = 0;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        sleepCv.wait(lock, [&] {
+            return shutdown || queuedJobs.load(std::memory_order_seq_cst) > 0;
+        });
+        sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+        // Drain before exiting: the destructor promises every queued job runs.
+        if (shutdown && queuedJobs.load(std::memory_order_seq_cst) == 0) break;
+    }
+}
+
+void JobSystem::parallelFor(size_t begin, size_t end, size_t grainSize,
+                            const std::function<void(size_t, size_t)>& fn,
+                            JobPriority priority) {
+    if (begin >= end) return;
+    if (grainSize == 0) grainSize = 1;
+    const size_t totalSlabs = (end - begin + grainSize - 1) / grainSize;
+
+    // Same slab layout as TaskPool: slab k is [begin + k*grain, +grain), so
+    // results depend only on the layout, never on who ran which slab.
+    std::atomic<size_t> nextSlab{0};
+    std::mutex          errorMutex;
+    std::exception_ptr  firstError;
+    auto runSlabs = [&] {
+        size_t slab{};
+        while ((slab = nextSlab.fetch_add(1, std::memory_order_relaxed)) < totalSlabs) {
+            const size_t slabBegin = begin + slab * grainSize;
+            const size_t slabEnd   = std::min(slabBegin + grainSize, end);
+            try {
+                fn(slabBegin, slabEnd);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+    };
+
+    // One claiming job per worker that could usefully join (the caller runs
+    // slabs too); late starters find the counter exhausted and return.
+    TaskGroup group(*this);
+    const size_t helpers = std::min(workers.size(), totalSlabs - 1);
+    for (size_t i = 0; i < helpers; ++i) group.run(runSlabs, priority);
+    runSlabs();
+    group.wait();
+
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+} // namespace foundation
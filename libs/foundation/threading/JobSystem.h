@@ -0,0 +1,186 @@
+#pragma once
+
+// JobSystem: shared work-stealing pool for engine async work (chunk tile
+// generation, entity placement, navmesh builds) and nested data parallelism.
+//
+// Key design choices:
+//   - One bounded set of workers per process (JobSystem::shared()), instead of
+//     a std::async thread per task. Each worker owns one WorkStealingDeque per
+//     priority; jobs a worker spawns go to its own deque (LIFO, cache-warm),
+//     idle workers steal the oldest jobs from others. Jobs submitted from
+//     non-worker threads go to a mutex-guarded injection queue.
+//   - Two priorities. High ("frame-critical": the player sees the result within
+//     a frame or two) is always drained before Background, in every queue a
+//     worker looks at. Priority is not preemption: a running Background job
+//     finishes first.
+//   - TaskGroup is the unit of waiting. wait() HELPS (runs queued jobs) rather
+//     than blocking, so waiting inside a job — nested parallelFor, fork/join —
+//     cannot deadlock the pool. A group may carry one continuation (then()),
+//     scheduled as a job once the group's jobs drain.
+//   - parallelFor keeps TaskPool's fixed-slab contract: [begin,end) is split
+//     into slabs of grainSize regardless of thread count, so a computation that
+//     is a pure function of (slab begin, slab end) is bit-identical at any
+//     parallelism (the WorldHash property). Unlike TaskPool it is reentrant
+//     and may run concurrently with other parallelFors and jobs.
+//   - Exceptions: the first exception thrown by a group's jobs is rethrown by
+//     wait(). Detached jobs (submit()) report through their std::future.
+//
+// TaskPool stays for worldgen, which sizes a private pool per generator and
+// relies on its per-slab telemetry; engine code should use JobSystem.
+
+#include "WorkStealingDeque.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace foundation {
+
+enum class JobPriority : uint8_t {
+    High       = 0, // frame-critical
+    Background = 1,
+};
+
+inline constexpr size_t kJobPriorityCount = 2;
+
+class JobSystem;
+
+// A set of jobs that can be waited on together. Must outlive its jobs:
+// wait() before destruction (the destructor waits too).
+class TaskGroup {
+  public:
+    explicit TaskGroup(JobSystem& system) : system(system) {}
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    // Queue fn as a job of this group. Callable from any thread, including
+    // from inside this group's own jobs.
+    void run(std::function<void()> fn, JobPriority priority = JobPriority::High);
+
+    // Schedule fn as a job once every job of this group has finished (at
+    // once if none are outstanding). At most one continuation per group; it
+    // fires once, for the jobs outstanding when the group first drains, so
+    // add all jobs before calling then(). wait() also waits for it.
+    void then(std::function<void()> fn, JobPriority priority = JobPriority::High);
+
+    // Run queued jobs until this group (and its continuation) is done, then
+    // rethrow the first exception any of them threw.
+    void wait();
+
+    // True once every job and the continuation have finished.
+    bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+  private:
+    friend class JobSystem;
+
+    // Called by the worker that ran one of this group's jobs.
+    void finishJob(std::exception_ptr error, bool isContinuation);
+
+    JobSystem& system;
+    // jobs + (1 while a continuation is registered and not yet finished).
+    std::atomic<int64_t> pending{0};
+    std::atomic<int64_t> jobs{0};
+
+    std::mutex            mutex; // guards the fields below
+    std::function<void()> continuation;
+    JobPriority           continuationPriority{JobPriority::High};
+    bool                  continuationLaunched{false};
+    std::exception_ptr    firstError;
+};
+
+class JobSystem {
+  public:
+    // threadCount: 0 = hardware_concurrency - 1, minimum 1.
+    explicit JobSystem(unsigned threadCount = 0);
+    ~JobSystem(); // runs every queued job, then joins
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Process-wide pool shared by all engine async work. Created on first use.
+    static JobSystem& shared();
+
+    unsigned threadCount() const { return static_cast<unsigned>(workers.size()); }
+
+    // Detached job with a future for its result (a drop-in for
+    // std::async(std::launch::async, ...)). Unlike std::async's future, this
+    // one does NOT block in its destructor: owners of tasks that reference
+    // them must wait() before destruction.
+    template <typename Fn>
+    auto submit(Fn&& fn, JobPriority priority = JobPriority::High)
+        -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+        using R    = std::invoke_result_t<std::decay_t<Fn>>;
+        auto task  = std::make_shared<std::packaged_task<R()>>(std::forward<Fn>(fn));
+        auto future = task->get_future();
+        enqueue(new Job{[task]() { (*task)(); }, nullptr, false}, priority);
+        return future;
+    }
+
+    // Fixed-slab parallel loop (see header comment). fn(slabBegin, slabEnd).
+    // Blocks (helping) until every slab has run; rethrows the first exception.
+    void parallelFor(size_t begin, size_t end, size_t grainSize,
+                     const std::function<void(size_t, size_t)>& fn,
+                     JobPriority priority = JobPriority::High);
+
+  private:
+    friend class TaskGroup;
+
+    struct Job {
+        std::function<void()> fn;
+        TaskGroup*            group{};
+        bool                  isContinuation{};
+    };
+
+    struct Worker {
+        std::thread thread;
+        std::array<std::unique_ptr<WorkStealingDeque<Job>>, kJobPriorityCount> deques;
+    };
+
+    void enqueue(Job* job, JobPriority priority);
+
+    // One queued job, highest priority first, or nullptr. workerIndex < 0 for
+    // non-worker threads (they cannot pop a deque of their own).
+    Job* tryTake(int workerIndex);
+    void execute(Job* job);
+
+    // Help until group is done; used by TaskGroup::wait.
+    void helpUntilDone(const TaskGroup& group);
+    void notifyGroupDone();
+
+    void workerLoop(unsigned index);
+
+    // Index of the calling thread among this system's workers, or -1.
+    int currentWorkerIndex() const;
+
+    std::vector<Worker> workers;
+
+    // Injection queues for jobs from non-worker threads and deque overflow.
+    std::mutex                                      injectMutex;
+    std::array<std::deque<Job*>, kJobPriorityCount> injected;
+
+    // Number of jobs sitting in any queue. Sleepers wait for it to go > 0.
+    std::atomic<int64_t> queuedJobs{0};
+    std::atomic<int>     sleepingWorkers{0};
+    std::mutex           sleepMutex;
+    std::condition_variable sleepCv;
+    bool                 shutdown{false}; // guarded by sleepMutex
+
+    // Waiters with nothing to help with block here; signalled when any group
+    // drains or a job is queued.
+    std::mutex              waitMutex;
+    std::condition_variable waitCv;
+};
+
+} // namespace foundation
@@ -0,0 +1,219 @@
+#include "JobSystem.h"
+#include "WorkStealingDeque.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace foundation;
+
+// ============================================================================
+// WorkStealingDeque
+// ============================================================================
+
+TEST(WorkStealingDequeTests, OwnerLifoThiefFifo) {
+    WorkStealingDeque<int> dq(8);
+    int items[4] = {0, 1, 2, 3};
+    for (int& i : items) ASSERT_TRUE(dq.push(&i));
+
+    EXPECT_EQ(dq.steal(), &items[0]) << "thieves take the oldest";
+    EXPECT_EQ(dq.pop(), &items[3]) << "the owner takes the newest";
+    EXPECT_EQ(dq.pop(), &items[2]);
+    EXPECT_EQ(dq.steal(), &items[1]);
+    EXPECT_EQ(dq.pop(), nullptr);
+    EXPECT_EQ(dq.steal(), nullptr);
+}
+
+TEST(WorkStealingDequeTests, PushFailsWhenFull) {
+    WorkStealingDeque<int> dq(4);
+    int v = 0;
+    for (size_t i = 0; i < dq.capacity(); ++i) ASSERT_TRUE(dq.push(&v));
+    EXPECT_FALSE(dq.push(&v));
+    EXPECT_NE(dq.pop(), nullptr);
+    EXPECT_TRUE(dq.push(&v)) << "space frees up after a pop";
+}
+
+TEST(WorkStealingDequeTests, ConcurrentStealsTakeEachItemOnce) {
+    constexpr int kItems = 20000;
+    WorkStealingDeque<int> dq(kItems);
+    std::vector<int> items(kItems);
+    std::vector<std::atomic<int>> seen(kItems);
+
+    std::atomic<bool> ownerDone{false};
+    auto thief = [&] {
+        while (!ownerDone.load() || dq.sizeApprox() > 0) {
+            if (int* p = dq.steal()) seen[static_cast<size_t>(p - items.data())].fetch_add(1);
+        }
+    };
+    std::thread t1(thief);
+    std::thread t2(thief);
+    for (int i = 0; i < kItems; ++i) {
+        ASSERT_TRUE(dq.push(&items[static_cast<size_t>(i)]));
+        if (i % 3 == 0) {
+            if (int* p = dq.pop()) seen[static_cast<size_t>(p - items.data())].fetch_add(1);
+        }
+    }
+    while (int* p = dq.pop()) seen[static_cast<size_t>(p - items.data())].fetch_add(1);
+    ownerDone.store(true);
+    t1.join();
+    t2.join();
+
+    for (int i = 0; i < kItems; ++i) {
+        ASSERT_EQ(seen[static_cast<size_t>(i)].load(), 1) << "item " << i;
+    }
+}
+
+// ============================================================================
+// parallelFor
+// ============================================================================
+
+TEST(JobSystemTests, ParallelForSumEqualsSerial) {
+    JobSystem jobs(4);
+    constexpr size_t kN = 100000;
+    std::atomic<size_t> sum{0};
+    jobs.parallelFor(0, kN, 1000, [&](size_t b, size_t e) {
+        size_t local = 0;
+        for (size_t i = b; i < e; ++i) local += i;
+        sum.fetch_add(local, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(sum.load(), kN * (kN - 1) / 2);
+}
+
+TEST(JobSystemTests, SlabLayoutIndependentOfThreadCount) {
+    auto slabsAt = [](unsigned threads) {
+        JobSystem jobs(threads);
+        std::mutex m;
+        std::vector<std::pair<size_t, size_t>> slabs;
+        jobs.parallelFor(7, 1000, 64, [&](size_t b, size_t e) {
+            std::lock_guard<std::mutex> lock(m);
+            slabs.emplace_back(b, e);
+        });
+        std::sort(slabs.begin(), slabs.end());
+        return slabs;
+    };
+    auto one = slabsAt(1);
+    ASSERT_EQ(one.size(), (1000u - 7u + 63u) / 64u);
+    EXPECT_EQ(one.front().first, 7u);
+    EXPECT_EQ(one.back().second, 1000u);
+    EXPECT_EQ(one, slabsAt(3));
+    EXPECT_EQ(one, slabsAt(8));
+}
+
+TEST(JobSystemTests, NestedParallelForCompletes) {
+    // TaskPool forbids this; here the outer slabs' waits help run inner slabs.
+    JobSystem jobs(2);
+    std::atomic<size_t> count{0};
+    jobs.parallelFor(0, 16, 1, [&](size_t, size_t) {
+        jobs.parallelFor(0, 100, 10, [&](size_t b, size_t e) {
+            count.fetch_add(e - b, std::memory_order_relaxed);
+        });
+    });
+    EXPECT_EQ(count.load(), 1600u);
+}
+
+TEST(JobSystemTests, ParallelForExceptionPropagates) {
+    JobSystem jobs(3);
+    EXPECT_THROW(jobs.parallelFor(0, 100, 1,
+                                  [](size_t b, size_t) {
+                                      if (b == 42) throw std::runtime_error("slab 42");
+                                  }),
+                 std::runtime_error);
+
+    std::atomic<size_t> n{0};
+    jobs.parallelFor(0, 10, 1, [&](size_t, size_t) { n.fetch_add(1); });
+    EXPECT_EQ(n.load(), 10u) << "the system stays usable after an exception";
+}
+
+// ============================================================================
+// TaskGroup / submit
+// ============================================================================
+
+TEST(JobSystemTests, ContinuationRunsAfterAllJobs) {
+    JobSystem jobs(3);
+    std::atomic<int> finished{0};
+    std::atomic<int> seenByContinuation{-1};
+    TaskGroup group(jobs);
+    for (int i = 0; i < 50; ++i) {
+        group.run([&] {
+            std::this_thread::yield();
+            finished.fetch_add(1);
+        });
+    }
+    group.then([&] { seenByContinuation.store(finished.load()); });
+    group.wait();
+    EXPECT_EQ(seenByContinuation.load(), 50);
+}
+
+TEST(JobSystemTests, ContinuationOnEmptyGroupRunsImmediately) {
+    JobSystem jobs(1);
+    std::atomic<bool> ran{false};
+    TaskGroup group(jobs);
+    group.then([&] { ran.store(true); });
+    group.wait();
+    EXPECT_TRUE(ran.load());
+}
+
+TEST(JobSystemTests, GroupWaitRethrows) {
+    JobSystem jobs(2);
+    TaskGroup group(jobs);
+    group.run([] { throw std::logic_error("boom"); });
+    group.run([] {});
+    EXPECT_THROW(group.wait(), std::logic_error);
+}
+
+TEST(JobSystemTests, SubmitReturnsResultThroughFuture) {
+    JobSystem jobs(2);
+    auto f = jobs.submit([] { return 6 * 7; }, JobPriority::Background);
+    EXPECT_EQ(f.get(), 42);
+
+    auto g = jobs.submit([]() -> int { throw std::runtime_error("x"); });
+    EXPECT_THROW(g.get(), std::runtime_error);
+}
+
+TEST(JobSystemTests, HighPriorityDrainsBeforeBackground) {
+    // One worker, held busy while both priorities queue up behind it.
+    JobSystem jobs(1);
+    std::atomic<bool> release{false};
+    std::atomic<bool> blockerRunning{false};
+    auto blocker = jobs.submit([&] {
+        blockerRunning.store(true);
+        while (!release.load()) std::this_thread::yield();
+    });
+    while (!blockerRunning.load()) std::this_thread::yield();
+
+    std::mutex m;
+    std::vector<JobPriority> order;
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 5; ++i) {
+        futures.push_back(jobs.submit([&] {
+            std::lock_guard<std::mutex> lock(m);
+            order.push_back(JobPriority::Background);
+        }, JobPriority::Background));
+        futures.push_back(jobs.submit([&] {
+            std::lock_guard<std::mutex> lock(m);
+            order.push_back(JobPriority::High);
+        }, JobPriority::High));
+    }
+    release.store(true);
+    blocker.get();
+    for (auto& f : futures) f.get();
+
+    ASSERT_EQ(order.size(), 10u);
+    for (size_t i = 0; i < 5; ++i) EXPECT_EQ(order[i], JobPriority::High) << "position " << i;
+    for (size_t i = 5; i < 10; ++i) EXPECT_EQ(order[i], JobPriority::Background) << "position " << i;
+}
+
+TEST(JobSystemTests, DestructorRunsQueuedJobs) {
+    std::atomic<int> ran{0};
+    {
+        JobSystem jobs(2);
+        for (int i = 0; i < 100; ++i) {
+            (void)jobs.submit([&] { ran.fetch_add(1); }, JobPriority::Background);
+        }
+    }
+    EXPECT_EQ(ran.load(), 100);
+}
@@ -1,3 +1,4 @@
+#include "JobSystem.h"
 #include "TaskPool.h"
 #include <benchmark/benchmark.h>
 #include <atomic>
@@ -6,18 +7,57 @@
 
 using namespace foundation;
 
+// TaskPool and JobSystem side by side on the same workloads. Each pool is
+// wrapped in a backend with the same three entry points; TaskPool expresses
+// independent tasks as a grain-1 parallelFor over the task indices, which is
+// how worldgen would have to issue them.
+namespace {
+
+    struct TaskPoolBackend {
+        explicit TaskPoolBackend(unsigned threads) : pool(threads) {}
+
+        template <typename Fn> void parallelFor(size_t begin, size_t end, size_t grain, Fn&& fn) {
+            pool.parallelFor(begin, end, grain, fn);
+        }
+
+        template <typename Fn> void runTasks(size_t count, Fn&& fn) {
+            pool.parallelFor(0, count, 1, [&](size_t b, size_t) { fn(b); });
+        }
+
+        TaskPool pool;
+    };
+
+    struct JobSystemBackend {
+        explicit JobSystemBackend(unsigned threads) : jobs(threads) {}
+
+        template <typename Fn> void parallelFor(size_t begin, size_t end, size_t grain, Fn&& fn) {
+            jobs.parallelFor(begin, end, grain, fn);
+        }
+
+        template <typename Fn> void runTasks(size_t count, Fn&& fn) {
+            TaskGroup group(jobs);
+            for (size_t i = 0; i < count; ++i) {
+                group.run([&fn, i] { fn(i); });
+            }
+            group.wait();
+        }
+
+        JobSystem jobs;
+    };
+
+} // namespace
+
 // Trivial sum of 1M elements: measures scheduling overhead vs serial
-static void BM_ParallelForVsSerial_1M(benchmark::State& state) {
+template <typename Backend> static void BM_ParallelForVsSerial_1M(benchmark::State& state) {
     constexpr size_t kN = 1000000;
     const size_t grain = static_cast<size_t>(state.range(0));
     std::vector<int64_t> data(kN, 1);
 
-    unsigned threads = static_cast<unsigned>(state.range(1));
-    TaskPool pool(threads);
+    Backend backend(static_cast<unsigned>(state.range(1)));
 
     for (auto _ : state) {
         std::atomic<int64_t> sum{0};
-        pool.parallelFor(0, kN, grain, [&](size_t b, size_t e) {
+        backend.parallelFor(0, kN, grain, [&](size_t b, size_t e) {
             int64_t local = 0;
             for (size_t i = b; i < e; ++i) local += data[i]; // NOLINT
             sum.fetch_add(local, std::memory_order_relaxed);
@@ -27,7 +67,50 @@ static void BM_ParallelForVsSerial_1M(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kN));
 }
 // grain=1000, 1 thread (baseline) vs 4 threads
-BENCHMARK(BM_ParallelForVsSerial_1M)->Args({1000, 1})->Args({1000, 4});
+BENCHMARK_TEMPLATE(BM_ParallelForVsSerial_1M, TaskPoolBackend)->Args({1000, 1})->Args({1000, 4});
+BENCHMARK_TEMPLATE(BM_ParallelForVsSerial_1M, JobSystemBackend)->Args({1000, 1})->Args({1000, 4});
+
+// Fan-out: 64 independent tasks of uneven size (the largest is 8x the
+// smallest), the shape of per-chunk or per-plate work. 4 threads.
+template <typename Backend> static void BM_FanOutUneven(benchmark::State& state) {
+    constexpr size_t kTasks = 64;
+    constexpr size_t kBase = 4096;
+    std::vector<int64_t> data(kTasks * kBase * 8, 1);
+
+    Backend backend(4);
+
+    for (auto _ : state) {
+        std::atomic<int64_t> sum{0};
+        backend.runTasks(kTasks, [&](size_t task) {
+            const size_t begin = task * kBase * 8;
+            const size_t end = begin + kBase * (1 + task % 8);
+            int64_t local = 0;
+            for (size_t i = begin; i < end; ++i) local += data[i]; // NOLINT
+            sum.fetch_add(local, std::memory_order_relaxed);
+        });
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kTasks));
+}
+BENCHMARK_TEMPLATE(BM_FanOutUneven, TaskPoolBackend);
+BENCHMARK_TEMPLATE(BM_FanOutUneven, JobSystemBackend);
+
+// Many tiny tasks: per-task overhead (slab claim vs job allocation, deque
+// push and wakeups). 4 threads.
+template <typename Backend> static void BM_ManySmallTasks(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    Backend backend(4);
+
+    for (auto _ : state) {
+        std::atomic<int> n{0};
+        backend.runTasks(count, [&](size_t) { n.fetch_add(1, std::memory_order_relaxed); });
+        benchmark::DoNotOptimize(n.load());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK_TEMPLATE(BM_ManySmallTasks, TaskPoolBackend)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_ManySmallTasks, JobSystemBackend)->Arg(1000)->Arg(10000);
 
 static void BM_SerialSum_1M(benchmark::State& state) {
     constexpr size_t kN = 1000000;
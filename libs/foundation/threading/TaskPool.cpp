@@ -1,6 +1,10 @@
 #include "TaskPool.h"
 
+#include "metrics/SystemResources.h"
+
+#include <bit>
 #include <cassert>
+#include <chrono>
 #include <stdexcept>
 
 namespace foundation {
@@ -42,6 +46,15 @@ void TaskPool::parallelFor(size_t begin, size_t end, size_t grainSize,
     nextSlab.store(0, std::memory_order_relaxed);
     completedSlabs.store(0, std::memory_order_relaxed);
 
+    const bool collect = statsEnabled;
+    std::chrono::steady_clock::time_point callStart{};
+    if (collect) {
+        callBusyNanos.store(0, std::memory_order_relaxed);
+        callWorkerCpuNanos.store(0, std::memory_order_relaxed);
+        for (auto& bucket : callHistogram) bucket.store(0, std::memory_order_relaxed);
+        callStart = std::chrono::steady_clock::now();
+    }
+
     {
         std::lock_guard<std::mutex> lock(mutex);
         currentJob.totalSlabs = totalSlabs;
@@ -49,24 +62,16 @@ void TaskPool::parallelFor(size_t begin, size_t end, size_t grainSize,
         currentJob.end = end;
         currentJob.grainSize = grainSize;
         currentJob.fn = &fn;
+        currentJob.collectStats = collect;
         ++jobSeq;
         jobReady = true;
     }
     cv.notify_all();
 
     // Calling thread also participates as a worker to avoid wasting a core.
-    size_t slabIdx{};
-    while ((slabIdx = nextSlab.fetch_add(1, std::memory_order_relaxed)) < totalSlabs) {
-        size_t slabBegin = begin + slabIdx * grainSize;
-        size_t slabEnd = slabBegin + grainSize;
-        if (slabEnd > end) slabEnd = end;
-        try {
-            fn(slabBegin, slabEnd);
-        } catch (...) {
-            std::lock_guard<std::mutex> lock(mutex);
-            if (!firstException) firstException = std::current_exception();
-        }
-        completedSlabs.fetch_add(1, std::memory_order_acq_rel);
+    {
+        Job job{totalSlabs, begin, end, grainSize, &fn, collect};
+        runSlabs(job);
     }
 
     // Wait until every slab is done AND no worker still holds a snapshot of
@@ -80,10 +85,68 @@ void TaskPool::parallelFor(size_t begin, size_t end, size_t grainSize,
                activeParticipants == 0;
     });
     jobReady = false;
+    lock.unlock();
+
+    if (collect) {
+        const double wall = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - callStart).count();
+        const double busy =
+            static_cast<double>(callBusyNanos.load(std::memory_order_relaxed)) * 1e-9;
+        const double capacity = wall * static_cast<double>(workers.size() + 1);
+        stats.calls += 1;
+        stats.slabs += totalSlabs;
+        stats.wallSeconds += wall;
+        stats.busySeconds += busy;
+        stats.idleSeconds += capacity > busy ? capacity - busy : 0.0;
+        stats.workerCpuSeconds +=
+            static_cast<double>(callWorkerCpuNanos.load(std::memory_order_relaxed)) * 1e-9;
+        for (size_t k = 0; k < ParallelForStats::kHistogramBuckets; ++k) {
+            stats.slabHistogram[k] += callHistogram[k].load(std::memory_order_relaxed);
+        }
+    }
 
     if (firstException) std::rethrow_exception(firstException);
 }
 
+ParallelForStats TaskPool::takeStats() {
+    ParallelForStats out = stats;
+    stats = {};
+    return out;
+}
+
+void TaskPool::runSlabs(const Job& job) {
+    size_t slabIdx{};
+    while ((slabIdx = nextSlab.fetch_add(1, std::memory_order_relaxed)) < job.totalSlabs) {
+        size_t slabBegin = job.begin + slabIdx * job.grainSize;
+        size_t slabEnd = slabBegin + job.grainSize;
+        if (slabEnd > job.end) slabEnd = job.end;
+
+        std::chrono::steady_clock::time_point slabStart{};
+        if (job.collectStats) slabStart = std::chrono::steady_clock::now();
+        try {
+            (*job.fn)(slabBegin, slabEnd);
+        } catch (...) {
+            std::lock_guard<std::mutex> eLock(mutex);
+            if (!firstException) firstException = std::current_exception();
+        }
+        if (job.collectStats) {
+            const auto nanos = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - slabStart).count());
+            callBusyNanos.fetch_add(nanos, std::memory_order_relaxed);
+            // log2 bucket of the duration in microseconds (bit_width(0) == 0).
+            size_t bucket = static_cast<size_t>(std::bit_width(nanos / 1000));
+            if (bucket > 0) --bucket;
+            if (bucket >= ParallelForStats::kHistogramBuckets) {
+                bucket = ParallelForStats::kHistogramBuckets - 1;
+            }
+            callHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+        // Last: once every slab is counted the caller may fold the stats.
+        completedSlabs.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
 void TaskPool::workerLoop() {
     uint64_t lastSeenSeq = 0;
     while (true) {
@@ -101,23 +164,17 @@ void TaskPool::workerLoop() {
         // activeParticipants > 0, because its done-predicate is evaluated
         // under this same mutex.
         Job job = currentJob;
-        const auto* fn = job.fn;
         lastSeenSeq = jobSeq;
         ++activeParticipants;
         lock.unlock();
 
-        size_t slabIdx{};
-        while ((slabIdx = nextSlab.fetch_add(1, std::memory_order_relaxed)) < job.totalSlabs) {
-            size_t slabBegin = job.begin + slabIdx * job.grainSize;
-            size_t slabEnd = slabBegin + job.grainSize;
-            if (slabEnd > job.end) slabEnd = job.end;
-            try {
-                (*fn)(slabBegin, slabEnd);
-            } catch (...) {
-                std::lock_guard<std::mutex> eLock(mutex);
-                if (!firstException) firstException = std::current_exception();
-            }
-            completedSlabs.fetch_add(1, std::memory_order_acq_rel);
+        const double cpuStart =
+            job.collectStats ? Foundation::SystemResources::threadCpuSeconds() : 0.0;
+        runSlabs(job);
+        if (job.collectStats) {
+            const double cpu = Foundation::SystemResources::threadCpuSeconds() - cpuStart;
+            callWorkerCpuNanos.fetch_add(static_cast<uint64_t>(cpu > 0.0 ? cpu * 1e9 : 0.0),
+                                         std::memory_order_relaxed);
         }
 
         // Deregister under the mutex, then notify. Holding the mutex here
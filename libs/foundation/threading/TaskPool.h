@@ -12,9 +12,15 @@
 //     the stored exception is rethrown on the calling thread.
 //   - NOT reentrant: do not call ParallelFor from within a worker lambda.
 //   - Thread count: constructor default 0 → hardware_concurrency - 1, minimum 1.
+//   - Telemetry: setStatsEnabled(true) times every slab and accumulates a
+//     ParallelForStats until takeStats(). Off by default; disabled cost is one
+//     branch per slab. Worker CPU time is read from each worker's own thread
+//     clock, so it belongs to this pool even when other pools run alongside.
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <mutex>
@@ -23,6 +29,32 @@
 
 namespace foundation {
 
+// Aggregate parallelFor telemetry (durations in seconds).
+struct ParallelForStats {
+    static constexpr size_t kHistogramBuckets = 16;
+
+    uint64_t calls{};
+    uint64_t slabs{};
+    double   wallSeconds{}; // sum of parallelFor call durations, caller's view
+    double   busySeconds{}; // sum of slab execution time over all participants
+    double   idleSeconds{}; // wall * (threadCount + 1) - busy: capacity spent waiting
+    double   workerCpuSeconds{}; // thread CPU time of the pool's workers (not the caller)
+    // slabHistogram[k] counts slabs that took [2^k, 2^(k+1)) microseconds.
+    // Bucket 0 also holds sub-microsecond slabs; the last bucket is open-ended.
+    std::array<uint64_t, kHistogramBuckets> slabHistogram{};
+
+    // Fold another accumulation into this one.
+    void merge(const ParallelForStats& o) {
+        calls += o.calls;
+        slabs += o.slabs;
+        wallSeconds += o.wallSeconds;
+        busySeconds += o.busySeconds;
+        idleSeconds += o.idleSeconds;
+        workerCpuSeconds += o.workerCpuSeconds;
+        for (size_t k = 0; k < kHistogramBuckets; ++k) slabHistogram[k] += o.slabHistogram[k];
+    }
+};
+
 class TaskPool {
   public:
     explicit TaskPool(unsigned threadCount = 0);
@@ -42,6 +74,14 @@ class TaskPool {
 
     unsigned threadCount() const { return static_cast<unsigned>(workers.size()); }
 
+    // Enable/disable slab timing for subsequent parallelFor calls. Call only
+    // between parallelFor calls, from the thread that issues them.
+    void setStatsEnabled(bool enabled) { statsEnabled = enabled; }
+
+    // Stats accumulated since the last take; resets the accumulator. Same
+    // threading rule as setStatsEnabled.
+    ParallelForStats takeStats();
+
   private:
     struct Job {
         size_t totalSlabs{};
@@ -49,8 +89,13 @@ class TaskPool {
         size_t end{};
         size_t grainSize{};
         const std::function<void(size_t, size_t)>* fn{};
+        bool collectStats{};
     };
 
+    // Claim and run slabs of job until none remain. Shared by the calling
+    // thread and the workers.
+    void runSlabs(const Job& job);
+
     void workerLoop();
 
     std::vector<std::thread> workers;
@@ -66,6 +111,14 @@ class TaskPool {
     uint64_t                 jobSeq{0};             // guarded by mutex
     bool                     shutdown{false};
     bool                     jobReady{false};
+
+    // Telemetry. The per-call atomics are written by every participant and
+    // folded into `stats` by the calling thread once the call completes.
+    bool                     statsEnabled{false};
+    ParallelForStats         stats{};
+    std::atomic<uint64_t>    callBusyNanos{0};
+    std::atomic<uint64_t>    callWorkerCpuNanos{0};
+    std::array<std::atomic<uint64_t>, ParallelForStats::kHistogramBuckets> callHistogram{};
 };
 
 } // namespace foundation
@@ -207,3 +207,35 @@ TEST(TaskPoolTests, PoolChurnConstructDestroy) {
         ASSERT_EQ(sum.load(), 100u);
     }
 }
+
+// ============================================================================
+// Telemetry
+// ============================================================================
+
+TEST(TaskPoolTests, StatsCountCallsAndSlabs) {
+    TaskPool pool(3);
+    std::atomic<size_t> sum{0};
+    auto body = [&](size_t b, size_t e) { sum.fetch_add(e - b, std::memory_order_relaxed); };
+
+    pool.parallelFor(0, 100, 10, body); // stats off: not counted
+    pool.setStatsEnabled(true);
+    pool.parallelFor(0, 100, 10, body); // 10 slabs
+    pool.parallelFor(0, 50, 16, body);  // 4 slabs
+    pool.setStatsEnabled(false);
+
+    ParallelForStats stats = pool.takeStats();
+    EXPECT_EQ(sum.load(), 250u);
+    EXPECT_EQ(stats.calls, 2u);
+    EXPECT_EQ(stats.slabs, 14u);
+    uint64_t histogramTotal = 0;
+    for (uint64_t count : stats.slabHistogram) histogramTotal += count;
+    EXPECT_EQ(histogramTotal, stats.slabs);
+    EXPECT_GE(stats.wallSeconds, 0.0);
+    EXPECT_GE(stats.busySeconds, 0.0);
+    EXPECT_GE(stats.idleSeconds, 0.0);
+    EXPECT_GE(stats.workerCpuSeconds, 0.0);
+
+    ParallelForStats empty = pool.takeStats();
+    EXPECT_EQ(empty.calls, 0u) << "takeStats resets the accumulator";
+    EXPECT_EQ(empty.slabs, 0u);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+// WorkStealingDeque: fixed-capacity Chase-Lev deque of pointers (Lê, Pop,
+// Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+// Models", PPoPP 2013).
+//
+//   - push/pop: OWNER thread only, LIFO at the bottom (hot cache, depth-first).
+//   - steal:    any thread, FIFO at the top (oldest = largest remaining work).
+//   - Lock-free. Capacity is fixed (power of two) so slots are never
+//     reallocated under a concurrent thief; push returns false when full and
+//     the caller falls back to a shared queue (JobSystem does).
+//   - Slots are atomics, so the structure is clean under ThreadSanitizer.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace foundation {
+
+template <typename T>
+class WorkStealingDeque {
+  public:
+    // capacity is rounded up to a power of two.
+    explicit WorkStealingDeque(size_t capacity = 1024) {
+        size_t cap = 1;
+        while (cap < capacity) cap <<= 1;
+        mask  = static_cast<int64_t>(cap - 1);
+        slots = std::make_unique<std::atomic<T*>[]>(cap);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only. False when full.
+    bool push(T* item) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        if (b - t > mask) return false;
+        slots[static_cast<size_t>(b & mask)].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only. nullptr when empty (or when a thief won the last item).
+    T* pop() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = slots[static_cast<size_t>(b & mask)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last item: race the thieves for it.
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread. nullptr when empty or when another thread won the race.
+    T* steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        T* item = slots[static_cast<size_t>(t & mask)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // Approximate (racy) size; for heuristics and tests only.
+    size_t sizeApprox() const {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    size_t capacity() const { return static_cast<size_t>(mask + 1); }
+
+  private:
+    // top and bottom on separate cache lines: thieves hammer top, the owner
+    // hammers bottom.
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    int64_t                          mask{};
+    std::unique_ptr<std::atomic<T*>[]> slots;
+};
+
+} // namespace foundation
@@ -14,11 +14,13 @@
 namespace planetview {
 
 namespace {
-// Base-tier resolution cap = the product subdivision max (kMaxGridSubdivision
-// = 2048). At this cap mip 0 carries one texel per tile for every generatable world,
-// which is exactly what the shader's analytic per-pixel hex render reads (one
-// exact tile color per cell); finer than one-texel-per-tile is never needed.
-constexpr uint32_t kBaseMax = 2048;
+// Base-tier resolution cap. Up to it, mip 0 carries one texel per tile, which is
+// exactly what the shader's analytic per-pixel hex render reads (one exact tile
+// color per cell). Finer grids (up to kMaxGridSubdivision = 2048) downsample
+// here and get their exact tile colors from the paged detail tier
+// (PlanetDetailTier) where zoomed in: a full-resident 2048 base would cost
+// ~224 MB of mipped RGBA8, the 1024 cap ~56 MB plus a fixed ~17 MB atlas.
+constexpr uint32_t kBaseMax = 1024;
 
 // Fill texel rows [jb, je) of rhombus `r`'s base texture into `dst` (texSize^2*4).
 // Texel (i,j) maps to an owned chart vertex via canonicalTile, so seam/pole
@@ -36,6 +36,7 @@ const char* colorModeName(ColorMode m);
 // Base tier of the two-tier hex renderer: 10 per-rhombus RGBA8 textures at
 // baseSize = min(n, 1024), with a full mip chain. Answers "zoomed out" — tiles
 // are sub-pixel and the mipmapped texture is the correct (shimmer-free) result.
+// For n > 1024 the zoomed-in exact tile colors come from PlanetDetailTier.
 //
 // Baking is split so a high-n grid never hitches the render thread:
 //   bake(world, mode) runs on a TaskPool worker, producing CPU buffers for all
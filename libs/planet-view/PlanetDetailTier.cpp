@@ -0,0 +1,165 @@
+#include "PlanetDetailTier.h"
+
+#include <world/worldgen/data/GeneratedWorld.h>
+#include <world/worldgen/grid/SphereGrid.h>
+
+#include <threading/JobSystem.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace planetview {
+
+namespace {
+constexpr size_t kPageBytes = static_cast<size_t>(kPageTexels) * kPageTexels * 4;
+} // namespace
+
+PlanetDetailTier::~PlanetDetailTier() {
+    release();
+}
+
+void PlanetDetailTier::release() {
+    // Drain the worker before dropping its batch (it writes into inFlight).
+    if (bakeFuture.valid()) {
+        try { bakeFuture.get(); } catch (...) {}
+    }
+    inFlight.reset();
+    ready.clear();
+    world.reset();
+
+    if (atlas)    { glDeleteTextures(1, &atlas);    atlas    = 0; }
+    if (tableTex) { glDeleteTextures(1, &tableTex); tableTex = 0; }
+    subdivision = 0;
+}
+
+void PlanetDetailTier::init(uint32_t newSubdivision, uint32_t baseSize) {
+    release();
+    if (newSubdivision <= baseSize) return;
+
+    subdivision = newSubdivision;
+    pages.init(newSubdivision, kAtlasLayers);
+
+    glGenTextures(1, &atlas);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, atlas);
+    // texelFetch only: the shader reads exact tile colors, never filtered.
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8,
+                 static_cast<GLsizei>(kPageTexels), static_cast<GLsizei>(kPageTexels),
+                 kAtlasLayers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    const auto pps = static_cast<GLsizei>(pages.pagesPerSide());
+    glGenTextures(1, &tableTex);
+    glBindTexture(GL_TEXTURE_2D, tableTex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, pps, pps * 10, 0,
+                 GL_RED_INTEGER, GL_UNSIGNED_SHORT, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void PlanetDetailTier::setSource(std::shared_ptr<const worldgen::GeneratedWorld> newWorld,
+                                 ColorMode newMode) {
+    if (!isActive()) return;
+    world = std::move(newWorld);
+    mode = newMode;
+    ++generation;
+    pages.clear();
+    ready.clear();
+}
+
+void PlanetDetailTier::update(const OrbitCamera& camera, int widthPx, int heightPx) {
+    if (!isActive() || !world || !world->grid) return;
+
+    reapBake();
+    uploadReady();
+
+    // Keep the wanted set well under the atlas size so this frame's pages are
+    // never each other's eviction victims.
+    samplePages(camera, widthPx, heightPx, *world->grid, kSampleStepPx, samples);
+    selectPages(samples, subdivision, static_cast<size_t>(kAtlasLayers / 2), wanted);
+    missing.clear();
+    pages.request(wanted, missing);
+    scheduleBake();
+}
+
+void PlanetDetailTier::reapBake() {
+    if (!inFlight || !bakeFuture.valid() ||
+        bakeFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return;
+    }
+    bakeFuture.get();
+    std::shared_ptr<const BakeBatch> batch = std::move(inFlight);
+    if (batch->generation != generation) return; // recolored meanwhile
+    for (size_t k = 0; k < batch->keys.size(); ++k) {
+        ready.push_back({batch->keys[k], batch, k});
+    }
+}
+
+void PlanetDetailTier::uploadReady() {
+    const size_t count = std::min(ready.size(), static_cast<size_t>(kUploadsPerFrame));
+    if (count > 0) {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, atlas);
+        for (size_t k = 0; k < count; ++k) {
+            const ReadyPage& page = ready[k];
+            const int layer = pages.commit(page.key);
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+                            static_cast<GLsizei>(kPageTexels), static_cast<GLsizei>(kPageTexels), 1,
+                            GL_RGBA, GL_UNSIGNED_BYTE, page.batch->texels.data() + page.index * kPageBytes);
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        ready.erase(ready.begin(), ready.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+
+    if (pages.takeTableDirty()) {
+        // Rows are pagesPerSide uint16s: not 4-byte aligned for odd widths.
+        GLint prevAlignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+        const auto pps = static_cast<GLsizei>(pages.pagesPerSide());
+        glBindTexture(GL_TEXTURE_2D, tableTex);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, pps, pps * 10,
+                        GL_RED_INTEGER, GL_UNSIGNED_SHORT, pages.tableEntries().data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, prevAlignment);
+    }
+}
+
+void PlanetDetailTier::scheduleBake() {
+    if (inFlight || missing.empty()) return;
+
+    auto batch = std::make_shared<BakeBatch>();
+    batch->generation = generation;
+    const size_t count = std::min(missing.size(), kBakeBatch);
+    batch->keys.assign(missing.begin(), missing.begin() + static_cast<std::ptrdiff_t>(count));
+    for (uint64_t key : batch->keys) pages.markPending(key);
+    inFlight = batch;
+
+    // A Background job on the shared JobSystem, not the TaskPool: the base-tier bake
+    // may be running a parallelFor on it, and TaskPool is not reentrant across callers.
+    auto source = world;
+    ColorMode bakeMode = mode;
+    uint32_t n = subdivision;
+    bakeFuture = foundation::JobSystem::shared().submit(
+        [batch, source, bakeMode, n]() {
+            batch->texels.resize(batch->keys.size() * kPageBytes);
+            for (size_t k = 0; k < batch->keys.size(); ++k) {
+                bakePage(batch->texels.data() + k * kPageBytes, batch->keys[k], n, *source, bakeMode);
+            }
+        },
+        foundation::JobPriority::Background);
+}
+
+void PlanetDetailTier::bind(GLuint tableUnit, GLuint atlasUnit) const {
+    glActiveTexture(GL_TEXTURE0 + tableUnit);
+    glBindTexture(GL_TEXTURE_2D, tableTex);
+    glActiveTexture(GL_TEXTURE0 + atlasUnit);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, atlas);
+}
+
+} // namespace planetview
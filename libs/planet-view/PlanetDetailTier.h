@@ -0,0 +1,102 @@
+#pragma once
+
+#include "PlanetColorizer.h" // ColorMode
+#include "PlanetPages.h"
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace worldgen {
+struct GeneratedWorld;
+}
+
+namespace planetview {
+
+class OrbitCamera;
+
+// Detail tier of the hex renderer: exact per-tile colors for grids finer than
+// the base tier (n > baseSize), streamed as pages (see PlanetPages.h) into a
+// bounded GL_TEXTURE_2D_ARRAY atlas. The shader looks a cell's page up in an
+// R16UI indirection table (rhombus-major rows of pagesPerSide entries) and
+// falls back to the downsampled base tier while a page is not resident.
+//
+// Per frame, update():
+//   1. reaps a finished page bake (worker thread, colorized from the world),
+//   2. uploads at most kUploadsPerFrame pages into LRU-allocated layers,
+//   3. ray-casts the viewport for the pages under magnified tiles and queues
+//      a bake of the missing ones (at most one batch in flight).
+// GPU memory is fixed: kAtlasLayers pages plus the table, whatever the zoom.
+class PlanetDetailTier {
+  public:
+    static constexpr int    kAtlasLayers     = 256;   // 256 * 130^2 RGBA8 = ~17 MB
+    static constexpr int    kUploadsPerFrame = 4;     // ~270 KB of texels per frame
+    static constexpr size_t kBakeBatch       = 16;    // pages per worker bake
+    static constexpr float  kSampleStepPx    = 32.0F; // feedback ray spacing
+
+    PlanetDetailTier() = default;
+    ~PlanetDetailTier();
+
+    PlanetDetailTier(const PlanetDetailTier&) = delete;
+    PlanetDetailTier& operator=(const PlanetDetailTier&) = delete;
+
+    // Allocate the atlas and table for a grid finer than the base tier; for
+    // n <= baseSize the base already holds one texel per tile and the tier
+    // stays inactive. Must be called with a live GL context.
+    void init(uint32_t subdivision, uint32_t baseSize);
+
+    bool isActive() const { return atlas != 0; }
+
+    // Table width in pages; 0 when inactive (the shader then skips the lookup).
+    uint32_t pagesPerSide() const { return isActive() ? pages.pagesPerSide() : 0; }
+
+    // Color source for pages. Drops every resident page; visible ones re-bake
+    // on demand from the new world/mode.
+    void setSource(std::shared_ptr<const worldgen::GeneratedWorld> world, ColorMode mode);
+
+    // Reap, upload and request pages for this view. Call once per frame on the
+    // render thread, before PlanetRenderer::render.
+    void update(const OrbitCamera& camera, int widthPx, int heightPx);
+
+    // Bind the table and atlas to the given texture units.
+    void bind(GLuint tableUnit, GLuint atlasUnit) const;
+
+  private:
+    struct BakeBatch {
+        uint64_t generation{0};
+        std::vector<uint64_t> keys;
+        std::vector<uint8_t>  texels; // kPageTexels^2 RGBA8 per key, back to back
+    };
+    struct ReadyPage {
+        uint64_t key{0};
+        std::shared_ptr<const BakeBatch> batch;
+        size_t index{0};
+    };
+
+    GLuint atlas{0};
+    GLuint tableTex{0};
+    uint32_t subdivision{0};
+
+    PlanetPageSet pages;
+    std::shared_ptr<const worldgen::GeneratedWorld> world;
+    ColorMode mode{ColorMode::Terrain};
+    uint64_t generation{0}; // bumped by setSource; stale bakes are dropped
+
+    std::shared_ptr<BakeBatch> inFlight;
+    std::future<void> bakeFuture;
+    std::vector<ReadyPage> ready; // baked, awaiting upload (oldest first)
+
+    // Per-frame scratch, kept to avoid reallocating.
+    std::vector<PageSample> samples;
+    std::vector<uint64_t> wanted;
+    std::vector<uint64_t> missing;
+
+    void release();
+    void reapBake();
+    void uploadReady();
+    void scheduleBake();
+};
+
+} // namespace planetview
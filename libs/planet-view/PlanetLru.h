@@ -4,6 +4,7 @@
 // eviction policy is unit-testable in isolation. A "key" is an opaque uint64
 // (the renderer packs rhombus/pi/pj into it).
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <unordered_map>
@@ -20,6 +21,7 @@ class PlanetLru {
         slots_.assign(static_cast<size_t>(capacity), kNoKey);
         order_.clear();
         map_.clear();
+        free_.clear();
         for (int i = 0; i < capacity; ++i) free_.push_back(i);
     }
 
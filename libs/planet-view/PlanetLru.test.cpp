@@ -0,0 +1,44 @@
+// PlanetLru: slot allocation and eviction for the detail-page atlas.
+
+#include "PlanetLru.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace planetview;
+
+TEST(PlanetLru, ClearDoesNotDuplicateFreeLayers) {
+    PlanetLru lru;
+    lru.init(4);
+    uint64_t evicted = PlanetLru::kNoKey;
+    lru.allocate(0, evicted);
+    lru.clear(); // free layers still listed must not be listed twice
+
+    // Commit past capacity: the resident pages must always sit in distinct layers
+    for (uint64_t key = 0; key < 8; ++key) {
+        lru.allocate(key, evicted);
+        std::vector<int> layers;
+        for (uint64_t resident = 0; resident <= key; ++resident) {
+            if (lru.resident(resident)) layers.push_back(lru.layerOf(resident));
+        }
+        std::sort(layers.begin(), layers.end());
+        EXPECT_EQ(std::adjacent_find(layers.begin(), layers.end()), layers.end()) << "after committing key " << key;
+        EXPECT_LE(layers.size(), 4U);
+    }
+}
+
+TEST(PlanetLru, EvictsLeastRecentlyUsedOnceFull) {
+    PlanetLru lru;
+    lru.init(2);
+    uint64_t evicted = PlanetLru::kNoKey;
+    lru.allocate(10, evicted);
+    lru.allocate(11, evicted);
+    lru.touch(10);
+
+    const int layer = lru.allocate(12, evicted);
+    EXPECT_EQ(evicted, 11U);
+    EXPECT_FALSE(lru.resident(11));
+    EXPECT_EQ(lru.keyAt(layer), 12U);
+}
@@ -0,0 +1,163 @@
+#include "PlanetPages.h"
+
+#include "OrbitCamera.h"
+#include "PlanetPicker.h"
+#include "PlanetTileColor.h"
+
+#include <world/worldgen/data/GeneratedWorld.h>
+#include <world/worldgen/grid/SphereGrid.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace planetview {
+
+namespace {
+// Angular spacing of adjacent tile centers on an n grid, in radians (the same
+// estimate GlobeView uses to clamp the camera's px/tile).
+float tileAngle(uint32_t n) { return 1.1F / static_cast<float>(n); }
+
+uint32_t tileIndex(double t, uint32_t n) {
+    const double k = std::floor(t * static_cast<double>(n) + 0.5);
+    return static_cast<uint32_t>(std::clamp(k, 0.0, static_cast<double>(n - 1)));
+}
+} // namespace
+
+uint64_t pageAt(uint32_t rhombus, double u, double v, uint32_t n) {
+    // Tile centers sit at chart vertices: i = round(u*n) (1-based), j = round(v*n).
+    const uint32_t ti = tileIndex(u - 1.0 / static_cast<double>(n), n);
+    const uint32_t tj = tileIndex(v, n);
+    return pageKey({rhombus, ti / kPageTiles, tj / kPageTiles});
+}
+
+void samplePages(const OrbitCamera& camera, int widthPx, int heightPx,
+                 const worldgen::SphereGrid& grid, float stepPx,
+                 std::vector<PageSample>& out) {
+    out.clear();
+    if (widthPx <= 0 || heightPx <= 0 || stepPx <= 0.0F) return;
+
+    const float w = static_cast<float>(widthPx);
+    const float h = static_cast<float>(heightPx);
+    const glm::mat4 invProj = glm::inverse(camera.projMatrix(w / h));
+    const glm::mat4 invView = glm::inverse(camera.viewMatrix());
+    const glm::vec3 origin = camera.position();
+    const float angle = tileAngle(grid.subdivision());
+
+    auto hitAt = [&](float x, float y) {
+        glm::vec3 ray = ndcToRay(x / w * 2.0F - 1.0F, 1.0F - y / h * 2.0F, invProj, invView);
+        return raySphereHit(origin, ray);
+    };
+
+    const int cols = static_cast<int>(std::ceil(w / stepPx));
+    const int rows = static_cast<int>(std::ceil(h / stepPx));
+    for (int row = 0; row <= rows; ++row) {
+        const float y = std::min(static_cast<float>(row) * stepPx, h - 1.0F);
+        for (int col = 0; col <= cols; ++col) {
+            const float x = std::min(static_cast<float>(col) * stepPx, w - 1.0F);
+            auto hit = hitAt(x, y);
+            if (!hit) continue;
+
+            // On-screen tile size from the surface distance one pixel away, in the
+            // worse of the two screen directions (foreshortening near the limb).
+            // A neighbor that falls off the limb means the tile is sub-pixel there.
+            auto dx = hitAt(x + 1.0F, y);
+            auto dy = hitAt(x, y + 1.0F);
+            float tilePx = 0.0F;
+            if (dx && dy) {
+                float perPx = std::max(glm::length(*dx - *hit), glm::length(*dy - *hit));
+                tilePx = perPx > 0.0F ? angle / perPx : 0.0F;
+            }
+
+            glm::vec3 p = glm::normalize(*hit);
+            PageSample s;
+            grid.locateRhombusUV({p.x, p.y, p.z}, s.rhombus, s.u, s.v);
+            s.tilePx = tilePx;
+            out.push_back(s);
+        }
+    }
+}
+
+void selectPages(const std::vector<PageSample>& samples, uint32_t n, size_t maxPages,
+                 std::vector<uint64_t>& out) {
+    out.clear();
+    std::vector<std::pair<float, uint64_t>> scored;
+    scored.reserve(samples.size());
+    for (const auto& s : samples) {
+        if (s.tilePx >= kDetailMinTilePx) {
+            scored.emplace_back(s.tilePx, pageAt(s.rhombus, s.u, s.v, n));
+        }
+    }
+    std::stable_sort(scored.begin(), scored.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    std::unordered_set<uint64_t> seen;
+    for (const auto& [tilePx, key] : scored) {
+        if (out.size() >= maxPages) break;
+        if (seen.insert(key).second) out.push_back(key);
+    }
+}
+
+void bakePage(uint8_t* dst, uint64_t key, uint32_t n,
+              const worldgen::GeneratedWorld& world, ColorMode mode) {
+    const worldgen::SphereGrid& grid = *world.grid;
+    const PageAddress a = pageAddress(key);
+    const int border = static_cast<int>(kPageBorder);
+    const int i0 = static_cast<int>(a.pi * kPageTiles) - border + 1; // 1-based i of texel x=0
+    const int j0 = static_cast<int>(a.pj * kPageTiles) - border;
+    const int last = static_cast<int>(n);
+
+    for (uint32_t y = 0; y < kPageTexels; ++y) {
+        // Clamp to one vertex past the owned range: the last page of a grid that
+        // isn't a multiple of kPageTiles repeats its border (never sampled).
+        const int j = std::clamp(j0 + static_cast<int>(y), -1, last);
+        for (uint32_t x = 0; x < kPageTexels; ++x) {
+            const int i = std::clamp(i0 + static_cast<int>(x), 0, last + 1);
+            RGBA8 c = colorForTile(grid.canonicalTile(a.rhombus, i, j), mode, world);
+            size_t o = (static_cast<size_t>(y) * kPageTexels + x) * 4;
+            dst[o + 0] = c.r;
+            dst[o + 1] = c.g;
+            dst[o + 2] = c.b;
+            dst[o + 3] = c.a;
+        }
+    }
+}
+
+void PlanetPageSet::init(uint32_t n, int capacity) {
+    pps = planetview::pagesPerSide(n);
+    lru.init(capacity);
+    table.assign(static_cast<size_t>(pps) * pps * 10U, 0);
+    pending.clear();
+    tableDirty = true;
+}
+
+void PlanetPageSet::clear() {
+    lru.clear();
+    std::fill(table.begin(), table.end(), 0);
+    pending.clear();
+    tableDirty = true;
+}
+
+void PlanetPageSet::request(const std::vector<uint64_t>& wanted, std::vector<uint64_t>& missing) {
+    for (uint64_t key : wanted) {
+        if (lru.resident(key)) {
+            lru.touch(key);
+        } else if (pending.find(key) == pending.end()) {
+            missing.push_back(key);
+        }
+    }
+}
+
+int PlanetPageSet::commit(uint64_t key) {
+    pending.erase(key);
+    uint64_t evicted = PlanetLru::kNoKey;
+    int layer = lru.allocate(key, evicted);
+    if (evicted != PlanetLru::kNoKey) {
+        table[tableIndex(pageAddress(evicted))] = 0;
+    }
+    table[tableIndex(pageAddress(key))] = static_cast<uint16_t>(layer + 1);
+    tableDirty = true;
+    return layer;
+}
+
+} // namespace planetview
@@ -0,0 +1,134 @@
+#pragma once
+
+// Detail tier addressing and bookkeeping, GL-free. The base tier caps at
+// kBaseMax texels per rhombus side; above that, exact per-tile colors stream
+// in as fixed-size pages for only the part of the globe that is zoomed in far
+// enough to draw tiles as hexes. This header holds everything that decides
+// WHICH pages and WHAT they contain — screen-space page requests, page
+// colorization, and the resident set (PlanetLru slots + indirection table) —
+// so selection, baking and eviction are unit-testable without a context.
+// PlanetDetailTier owns the GL half (atlas, table texture, async bake, upload).
+
+#include "PlanetColorizer.h" // ColorMode
+#include "PlanetLru.h"
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace worldgen {
+struct GeneratedWorld;
+class SphereGrid;
+}
+
+namespace planetview {
+
+class OrbitCamera;
+
+// A page is kPageTiles x kPageTiles tiles plus a kPageBorder ring of the
+// neighboring tiles (resolved across rhombus seams and poles by canonicalTile),
+// so the shader's neighbor-cell lookups at a page edge stay in one atlas layer.
+// planet.frag mirrors kPageTiles.
+constexpr uint32_t kPageTiles  = 128;
+constexpr uint32_t kPageBorder = 1;
+constexpr uint32_t kPageTexels = kPageTiles + 2 * kPageBorder;
+
+// Tiles are only worth a detail page once the shader draws them as hexes
+// (planet.frag fades from the mipped base to per-cell colors over 1..2 px/tile).
+constexpr float kDetailMinTilePx = 1.0F;
+
+struct PageAddress {
+    uint32_t rhombus{0};
+    uint32_t pi{0}; // page column (tile i-1 / kPageTiles)
+    uint32_t pj{0}; // page row    (tile j   / kPageTiles)
+};
+
+// PlanetLru key: rhombus in the high word, page row/column in the low word.
+inline uint64_t pageKey(PageAddress a) {
+    return (static_cast<uint64_t>(a.rhombus) << 32) | (static_cast<uint64_t>(a.pj) << 16) | a.pi;
+}
+
+inline PageAddress pageAddress(uint64_t key) {
+    return {static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key & 0xFFFFU),
+            static_cast<uint32_t>((key >> 16) & 0xFFFFU)};
+}
+
+inline uint32_t pagesPerSide(uint32_t n) { return (n + kPageTiles - 1) / kPageTiles; }
+
+// Page holding the tile nearest rhombus-local (u, v) on an n grid.
+uint64_t pageAt(uint32_t rhombus, double u, double v, uint32_t n);
+
+// One screen-space feedback sample: where a viewport point lands on the globe
+// and how many pixels a tile spans there.
+struct PageSample {
+    uint32_t rhombus{0};
+    double   u{0.0};
+    double   v{0.0};
+    float    tilePx{0.0F};
+};
+
+// Ray-cast a grid of viewport points (every stepPx, edges included) against the
+// globe. Points that miss the sphere produce no sample.
+void samplePages(const OrbitCamera& camera, int widthPx, int heightPx,
+                 const worldgen::SphereGrid& grid, float stepPx,
+                 std::vector<PageSample>& out);
+
+// Pages wanted this frame: those under samples with tilePx >= kDetailMinTilePx,
+// most magnified first, deduplicated, at most maxPages.
+void selectPages(const std::vector<PageSample>& samples, uint32_t n, size_t maxPages,
+                 std::vector<uint64_t>& out);
+
+// Colorize one page into dst (kPageTexels^2 RGBA8). Texel (x, y) holds tile
+// i-1 = pi*kPageTiles + x - kPageBorder, j = pj*kPageTiles + y - kPageBorder.
+// Thread-safe: reads only the world.
+void bakePage(uint8_t* dst, uint64_t key, uint32_t n,
+              const worldgen::GeneratedWorld& world, ColorMode mode);
+
+// Resident set of the detail atlas: which page sits in which layer, what is
+// being baked, and the indirection table the shader reads (one uint16 per page,
+// rhombus-major rows: entry (r*pps + pj)*pps + pi = atlas layer + 1, 0 = absent).
+class PlanetPageSet {
+  public:
+    void init(uint32_t n, int capacity);
+
+    // Forget every page (e.g. color mode or world changed). Keeps the layout.
+    void clear();
+
+    uint32_t pagesPerSide() const { return pps; }
+    int capacity() const { return lru.capacity(); }
+
+    // Feed this frame's wanted pages (priority order). Resident ones are marked
+    // recently used; the rest, minus those already baking, go to `missing`.
+    void request(const std::vector<uint64_t>& wanted, std::vector<uint64_t>& missing);
+
+    // A bake of `key` was queued; it is not re-requested until committed.
+    void markPending(uint64_t key) { pending.insert(key); }
+
+    // Make a baked page resident. Returns the atlas layer to upload into; the
+    // least-recently-used page is evicted if the atlas is full.
+    int commit(uint64_t key);
+
+    bool resident(uint64_t key) const { return lru.resident(key); }
+    uint16_t entry(PageAddress a) const { return table[tableIndex(a)]; }
+    const std::vector<uint16_t>& tableEntries() const { return table; }
+
+    // True once after any table change (the GL side re-uploads it).
+    bool takeTableDirty() {
+        bool was = tableDirty;
+        tableDirty = false;
+        return was;
+    }
+
+  private:
+    size_t tableIndex(PageAddress a) const {
+        return (static_cast<size_t>(a.rhombus) * pps + a.pj) * pps + a.pi;
+    }
+
+    PlanetLru lru;
+    std::vector<uint16_t> table;
+    std::unordered_set<uint64_t> pending;
+    uint32_t pps{0};
+    bool tableDirty{false};
+};
+
+} // namespace planetview
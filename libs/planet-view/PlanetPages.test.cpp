@@ -0,0 +1,193 @@
+// Detail-tier page logic, all CPU — no GL context: page addressing, screen-space
+// page selection, page colorization (must agree with the full-resolution base
+// bake and resolve seam borders to the true neighbor tile), and the resident
+// set's LRU eviction + indirection table.
+
+#include "PlanetPages.h"
+
+#include "OrbitCamera.h"
+#include "PlanetTileColor.h"
+
+#include <world/worldgen/data/GeneratedWorld.h>
+#include <world/worldgen/data/PlanetParams.h>
+#include <world/worldgen/grid/SphereGrid.h>
+#include <world/worldgen/pipeline/PlanetGenerator.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace planetview;
+
+namespace {
+
+std::shared_ptr<const worldgen::GeneratedWorld> generate(uint32_t n) {
+    worldgen::PlanetParams params =
+        worldgen::PlanetParams::preset(worldgen::Preset::EarthLike);
+    params.gridSubdivision = n;
+    params.seed = 42;
+
+    worldgen::PlanetGenerator gen;
+    gen.start(params);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while (std::chrono::steady_clock::now() < deadline) {
+        auto prog = gen.progress();
+        if (prog.state == worldgen::GenerationProgress::State::Complete ||
+            prog.state == worldgen::GenerationProgress::State::Failed ||
+            prog.state == worldgen::GenerationProgress::State::Cancelled) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return gen.takeResult();
+}
+
+float maxTilePx(const std::vector<PageSample>& samples) {
+    float best = 0.0F;
+    for (const auto& s : samples) best = std::max(best, s.tilePx);
+    return best;
+}
+
+} // namespace
+
+TEST(PlanetPages, KeyRoundTripsAndPageAtFindsTheTilesPage) {
+    PageAddress a{7, 3, 12};
+    PageAddress b = pageAddress(pageKey(a));
+    EXPECT_EQ(b.rhombus, 7U);
+    EXPECT_EQ(b.pi, 3U);
+    EXPECT_EQ(b.pj, 12U);
+
+    const uint32_t n = 512;
+    EXPECT_EQ(pagesPerSide(n), 4U);
+    EXPECT_EQ(pagesPerSide(600), 5U);
+    // Tile i=129 (1-based) is 0-based column 128: the second page column.
+    PageAddress p = pageAddress(pageAt(2, 129.0 / n, 127.0 / n, n));
+    EXPECT_EQ(p.rhombus, 2U);
+    EXPECT_EQ(p.pi, 1U);
+    EXPECT_EQ(p.pj, 0U);
+    // Seam overshoot clamps into the rhombus.
+    p = pageAddress(pageAt(2, 1.0, 1.0, n));
+    EXPECT_EQ(p.pi, 3U);
+    EXPECT_EQ(p.pj, 3U);
+}
+
+TEST(PlanetPages, SelectionKeepsMagnifiedPagesMostMagnifiedFirst) {
+    const uint32_t n = 1024;
+    std::vector<PageSample> samples = {
+        {0, 0.05, 0.05, 0.5F},  // sub-pixel: base tier suffices
+        {1, 0.05, 0.05, 3.0F},
+        {1, 0.06, 0.05, 2.0F},  // same page as above
+        {4, 0.90, 0.90, 40.0F},
+        {5, 0.50, 0.50, 10.0F},
+    };
+    std::vector<uint64_t> out;
+    selectPages(samples, n, 8, out);
+    ASSERT_EQ(out.size(), 3U);
+    EXPECT_EQ(pageAddress(out[0]).rhombus, 4U);
+    EXPECT_EQ(pageAddress(out[1]).rhombus, 5U);
+    EXPECT_EQ(pageAddress(out[2]).rhombus, 1U);
+
+    selectPages(samples, n, 2, out);
+    EXPECT_EQ(out.size(), 2U);
+}
+
+TEST(PlanetPages, FeedbackRequestsPagesOnlyWhenZoomedIn) {
+    const uint32_t n = 2048;
+    worldgen::SphereGrid grid(n);
+    std::vector<PageSample> samples;
+    std::vector<uint64_t> wanted;
+
+    OrbitCamera far;
+    far.distance = 2.5F;
+    samplePages(far, 1280, 720, grid, 32.0F, samples);
+    ASSERT_FALSE(samples.empty()); // the globe is in view
+    EXPECT_LT(maxTilePx(samples), kDetailMinTilePx);
+    selectPages(samples, n, 128, wanted);
+    EXPECT_TRUE(wanted.empty());
+
+    // Close enough that tiles are tens of pixels: only a handful of pages show.
+    OrbitCamera close;
+    close.distance = 1.0F + 0.02F;
+    samplePages(close, 1280, 720, grid, 32.0F, samples);
+    EXPECT_GT(maxTilePx(samples), 10.0F);
+    selectPages(samples, n, 128, wanted);
+    EXPECT_FALSE(wanted.empty());
+    EXPECT_LT(wanted.size(), 16U);
+}
+
+TEST(PlanetPages, PageMatchesFullResolutionBaseAndResolvesSeamBorders) {
+    const uint32_t n = 64; // one page per rhombus
+    auto world = generate(n);
+    ASSERT_TRUE(world);
+
+    const uint32_t r = 3;
+    std::vector<uint8_t> base;
+    PlanetColorizer::bakeRhombusForTest(base, r, n, n, *world, ColorMode::Terrain);
+    std::vector<uint8_t> page(static_cast<size_t>(kPageTexels) * kPageTexels * 4);
+    bakePage(page.data(), pageKey({r, 0, 0}), n, *world, ColorMode::Terrain);
+
+    auto texel = [&](uint32_t x, uint32_t y) {
+        size_t o = (static_cast<size_t>(y) * kPageTexels + x) * 4;
+        return RGBA8{page[o], page[o + 1], page[o + 2], page[o + 3]};
+    };
+    for (uint32_t j = 0; j < n; ++j) {
+        for (uint32_t i = 0; i < n; ++i) {
+            RGBA8 c = texel(i + kPageBorder, j + kPageBorder);
+            size_t o = (static_cast<size_t>(j) * n + i) * 4;
+            ASSERT_EQ(c.r, base[o]) << "i=" << i << " j=" << j;
+            ASSERT_EQ(c.g, base[o + 1]);
+            ASSERT_EQ(c.b, base[o + 2]);
+        }
+    }
+
+    // The left border column is the i=0 seam: tiles owned by the neighbor rhombus.
+    const worldgen::SphereGrid& grid = *world->grid;
+    for (uint32_t j = 0; j < n; ++j) {
+        RGBA8 want = colorForTile(grid.canonicalTile(r, 0, static_cast<int>(j)), ColorMode::Terrain, *world);
+        RGBA8 got = texel(0, j + kPageBorder);
+        EXPECT_EQ(got.r, want.r);
+        EXPECT_EQ(got.g, want.g);
+        EXPECT_EQ(got.b, want.b);
+    }
+}
+
+TEST(PlanetPageSet, CommitEvictsLeastRecentlyUsedAndKeepsTableInSync) {
+    PlanetPageSet pages;
+    pages.init(1024, 2);
+    EXPECT_TRUE(pages.takeTableDirty());
+    EXPECT_FALSE(pages.takeTableDirty());
+
+    const uint64_t a = pageKey({0, 0, 0});
+    const uint64_t b = pageKey({0, 1, 0});
+    const uint64_t c = pageKey({9, 7, 7});
+
+    std::vector<uint64_t> missing;
+    pages.request({a, b}, missing);
+    EXPECT_EQ(missing, (std::vector<uint64_t>{a, b}));
+    pages.markPending(a);
+    pages.markPending(b);
+
+    // Baking pages are not re-requested
+    missing.clear();
+    pages.request({a, b}, missing);
+    EXPECT_TRUE(missing.empty());
+
+    const int layerA = pages.commit(a);
+    pages.commit(b);
+    EXPECT_EQ(pages.entry(pageAddress(a)), layerA + 1);
+    EXPECT_TRUE(pages.takeTableDirty());
+
+    // a is visible again this frame, so b is the eviction victim
+    pages.request({a}, missing);
+    const int layerC = pages.commit(c);
+    EXPECT_FALSE(pages.resident(b));
+    EXPECT_EQ(pages.entry(pageAddress(b)), 0);
+    EXPECT_EQ(pages.entry(pageAddress(c)), layerC + 1);
+    EXPECT_NE(layerC, layerA);
+
+    pages.clear();
+    EXPECT_FALSE(pages.resident(a));
+    EXPECT_EQ(pages.entry(pageAddress(c)), 0);
+}
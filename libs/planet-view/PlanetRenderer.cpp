@@ -2,6 +2,7 @@
 
 #include "OrbitCamera.h"
 #include "PlanetColorizer.h"
+#include "PlanetDetailTier.h"
 #include "PlanetMesh.h"
 
 #include <shader/ShaderLoader.h>
@@ -101,7 +102,12 @@ void PlanetRenderer::cacheUniforms() {
     planetUniforms.sunDir       = glGetUniformLocation(planetShader, "u_sunDir");
     planetUniforms.cameraPos    = glGetUniformLocation(planetShader, "u_cameraPos");
     planetUniforms.baseTex      = glGetUniformLocation(planetShader, "u_baseTex");
+    planetUniforms.baseSize     = glGetUniformLocation(planetShader, "u_baseSize");
     planetUniforms.n            = glGetUniformLocation(planetShader, "u_n");
+    planetUniforms.pageTable    = glGetUniformLocation(planetShader, "u_pageTable");
+    planetUniforms.detailAtlas  = glGetUniformLocation(planetShader, "u_detailAtlas");
+    planetUniforms.pagesPerSide = glGetUniformLocation(planetShader, "u_pagesPerSide");
+    planetUniforms.rhombus      = glGetUniformLocation(planetShader, "u_rhombus");
 
     blitUniforms.tex = glGetUniformLocation(blitShader, "u_tex");
 }
@@ -114,7 +120,8 @@ void PlanetRenderer::destroyFbo() {
 
 void PlanetRenderer::render(const PlanetMesh& mesh, const PlanetColorizer& colorizer,
                             uint32_t subdivision,
-                            const OrbitCamera& camera, int widthPx, int heightPx) {
+                            const OrbitCamera& camera, int widthPx, int heightPx,
+                            const PlanetDetailTier* detail) {
     if (!isReady() || !mesh.isBuilt() || !colorizer.isReady()) return;
 
     resize(widthPx, heightPx);
@@ -135,6 +142,12 @@ void PlanetRenderer::render(const PlanetMesh& mesh, const PlanetColorizer& color
     glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &prevVao);
     GLint prevActiveTexture  = 0;
     glGetIntegerv(GL_ACTIVE_TEXTURE, &prevActiveTexture);
+    glActiveTexture(GL_TEXTURE0 + kPageTableUnit);
+    GLint prevTableBinding   = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &prevTableBinding);
+    glActiveTexture(GL_TEXTURE0 + kDetailAtlasUnit);
+    GLint prevAtlasBinding   = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D_ARRAY, &prevAtlasBinding);
     glActiveTexture(GL_TEXTURE0);
     GLint prevTex0Binding    = 0;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &prevTex0Binding);
@@ -179,13 +192,23 @@ void PlanetRenderer::render(const PlanetMesh& mesh, const PlanetColorizer& color
     glUniform3fv(planetUniforms.sunDir,       1, glm::value_ptr(sunDir));
     glUniform3fv(planetUniforms.cameraPos,    1, glm::value_ptr(camPos));
     glUniform1i(planetUniforms.baseTex, 0);
+    glUniform1f(planetUniforms.baseSize, static_cast<float>(colorizer.baseSize()));
     glUniform1f(planetUniforms.n, static_cast<float>(subdivision));
 
+    // Detail samplers get their own units even when unused: GL rejects a draw
+    // whose samplers of different types share a unit.
+    const bool useDetail = detail != nullptr && detail->isActive();
+    glUniform1i(planetUniforms.pageTable, static_cast<GLint>(kPageTableUnit));
+    glUniform1i(planetUniforms.detailAtlas, static_cast<GLint>(kDetailAtlasUnit));
+    glUniform1i(planetUniforms.pagesPerSide, useDetail ? static_cast<GLint>(detail->pagesPerSide()) : 0);
+    if (useDetail) detail->bind(kPageTableUnit, kDetailAtlasUnit);
+
     for (uint32_t r = 0; r < 10U; ++r) {
         const auto& rm = mesh.rhombus(r);
         if (!rm.vao) continue;
 
         colorizer.bind(r, 0);
+        glUniform1i(planetUniforms.rhombus, static_cast<GLint>(r));
 
         glBindVertexArray(rm.vao);
         glDrawElements(GL_TRIANGLES,
@@ -206,7 +229,11 @@ void PlanetRenderer::render(const PlanetMesh& mesh, const PlanetColorizer& color
     glFrontFace(static_cast<GLenum>(prevFrontFace));
     glUseProgram(static_cast<GLuint>(prevProgram));
     glBindVertexArray(static_cast<GLuint>(prevVao));
-    // Restore unit-0 binding while unit 0 is active, then restore the active unit.
+    // Restore each unit's binding while it is active, then restore the active unit.
+    glActiveTexture(GL_TEXTURE0 + kPageTableUnit);
+    glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(prevTableBinding));
+    glActiveTexture(GL_TEXTURE0 + kDetailAtlasUnit);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, static_cast<GLuint>(prevAtlasBinding));
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(prevTex0Binding));
     glActiveTexture(static_cast<GLenum>(prevActiveTexture));
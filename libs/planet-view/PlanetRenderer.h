@@ -8,6 +8,7 @@ namespace planetview {
 
 class PlanetMesh;
 class PlanetColorizer;
+class PlanetDetailTier;
 class OrbitCamera;
 
 // Owns the offscreen FBO (RGBA8 colour + DEPTH24 renderbuffer), planet shader,
@@ -35,10 +36,12 @@ class PlanetRenderer {
 
     // Draw the planet into the offscreen FBO. `subdivision` is the grid n,
     // which drives the shader's per-pixel hex assignment (cell fill, AA edges,
-    // and outline).
+    // and outline). `detail` supplies exact tile colors when the grid is finer
+    // than the base tier; without it (or while inactive) cells read the base.
     void render(const PlanetMesh& mesh, const PlanetColorizer& colorizer,
                 uint32_t subdivision,
-                const OrbitCamera& camera, int widthPx, int heightPx);
+                const OrbitCamera& camera, int widthPx, int heightPx,
+                const PlanetDetailTier* detail = nullptr);
 
     // Blit the FBO colour texture to the currently bound default framebuffer.
     // Call this BEFORE 2D UI rendering so the planet is below the UI.
@@ -54,6 +57,10 @@ class PlanetRenderer {
     GLuint colorTex{0};
     GLuint depthRbo{0};
 
+    // Texture units: 0 = base tier (per rhombus), then the detail tier's pair.
+    static constexpr GLuint kPageTableUnit   = 1;
+    static constexpr GLuint kDetailAtlasUnit = 2;
+
     GLuint planetShader{0};
     GLuint blitShader{0};
     GLuint blitVao{0}; // empty VAO for gl_VertexID full-screen triangle
@@ -71,7 +78,12 @@ class PlanetRenderer {
         GLint sunDir    {-1};
         GLint cameraPos {-1};
         GLint baseTex   {-1};
+        GLint baseSize  {-1};
         GLint n         {-1};
+        GLint pageTable {-1};
+        GLint detailAtlas{-1};
+        GLint pagesPerSide{-1};
+        GLint rhombus   {-1};
     } planetUniforms;
 
     struct BlitUniforms {
@@ -4,10 +4,20 @@ in vec3 v_worldPos;
 in vec3 v_normal;
 in vec2 v_uv;
 
-uniform sampler2D u_baseTex;  // per-rhombus RGBA8 + mips; one texel per tile (texSize == n)
+uniform sampler2D u_baseTex;  // per-rhombus RGBA8 + mips; one texel per tile up to kBaseMax
+uniform float u_baseSize;     // base texture size (== u_n unless the grid is finer than kBaseMax)
 
 uniform float u_n;            // grid subdivision
 
+// Detail tier (PlanetDetailTier): exact tile colors for grids finer than the
+// base, paged into an atlas. u_pagesPerSide == 0 when the tier is inactive.
+uniform usampler2D     u_pageTable;     // R16UI, row (rhombus*pps + pj), col pi: atlas layer+1, 0 = absent
+uniform sampler2DArray u_detailAtlas;   // kPageTexels^2 RGBA8 pages (1-texel border ring)
+uniform int            u_pagesPerSide;
+uniform int            u_rhombus;       // rhombus being drawn
+
+const int kPageTiles = 128;             // mirrors PlanetPages.h
+
 uniform vec3  u_sunDir;       // world-space, normalised
 uniform vec3  u_cameraPos;
 
@@ -43,14 +53,30 @@ ivec2 hexRound(vec2 axial) {
 // Unskewed Cartesian for the 60-degree lattice basis (matches locateHex).
 vec2 cart(vec2 a) { return vec2(a.x + 0.5 * a.y, a.y * HALF_SQRT3); }
 
-// Exact (un-blended) color of a hex cell: its texel center sampled at mip 0.
-// Cell (q,r): q is the 1-based i, r the 0-based j; tile (i,j) lives at texel
-// (i-1, j) (texSize == n). Sampling the texel center returns it exactly even
-// with the bilinear filter; mip 0 keeps it from pulling a coarser, pre-blended
-// mip when slightly zoomed out.
+// Exact (un-blended) color of a hex cell. Cell (q,r): q is the 1-based i, r
+// the 0-based j, so tile (i,j) is at 0-based (i-1, j).
+//
+// Resident detail page first: the cell's page comes from the in-range tile, and
+// cells just past the rhombus edge (seam/pole neighbors) read the page's border
+// ring, which holds the true tile across the seam.
+//
+// Otherwise the base texel center at mip 0: tile (i-1, j) when the base is
+// full-resolution, the nearest baked texel when it is downsampled. Sampling the
+// texel center returns it exactly even with the bilinear filter; mip 0 keeps it
+// from pulling a coarser, pre-blended mip when slightly zoomed out.
 vec3 cellColor(ivec2 cell) {
-    vec2 uv = (vec2(cell) - vec2(1.0, 0.0) + 0.5) / u_n;
-    uv = clamp(uv, 0.5 / u_n, 1.0 - 0.5 / u_n); // clamp seam/pole overshoot
+    ivec2 tile = cell - ivec2(1, 0);
+    if (u_pagesPerSide > 0) {
+        ivec2 page  = clamp(tile, ivec2(0), ivec2(int(u_n) - 1)) / kPageTiles;
+        uint  entry = texelFetch(u_pageTable, ivec2(page.x, u_rhombus * u_pagesPerSide + page.y), 0).r;
+        if (entry != 0u) {
+            ivec2 local = clamp(tile - page * kPageTiles, ivec2(-1), ivec2(kPageTiles)) + 1;
+            return texelFetch(u_detailAtlas, ivec3(local, int(entry) - 1), 0).rgb;
+        }
+    }
+    vec2 texel = floor((vec2(tile) + 0.5) * (u_baseSize / u_n));
+    vec2 uv = (texel + 0.5) / u_baseSize;
+    uv = clamp(uv, 0.5 / u_baseSize, 1.0 - 0.5 / u_baseSize); // clamp seam/pole overshoot
     return textureLod(u_baseTex, uv, 0.0).rgb;
 }
 
@@ -0,0 +1,203 @@
+// StreamingBuffer implementation: persistent-mapped ring with fences, or
+// unsynchronized map + orphaning where buffer storage is unavailable.
+
+#include "gl/StreamingBuffer.h"
+#include "utils/Log.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Renderer {
+
+	namespace {
+		// Map/orphan through a target that is not VAO state, so streaming never
+		// disturbs whichever VAO (and element buffer) happens to be bound.
+		constexpr GLenum kScratchTarget = GL_COPY_WRITE_BUFFER;
+
+		constexpr GLbitfield kPersistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		constexpr GLbitfield kAppendFlags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+		// Fence waits are normally instant; this bounds a single wait call.
+		constexpr GLuint64 kFenceWaitNs = 1'000'000'000; // 1s
+
+		size_t alignUp(size_t value, size_t alignment) {
+			return (value + alignment - 1) / alignment * alignment;
+		}
+	} // namespace
+
+	StreamingBuffer StreamingBuffer::create(size_t regionBytes) {
+		StreamingBuffer stream;
+		stream.m_persistent = GLEW_ARB_buffer_storage != 0;
+		stream.createStorage(std::max<size_t>(regionBytes, 256));
+		return stream;
+	}
+
+	StreamingBuffer::StreamingBuffer(StreamingBuffer&& other) noexcept {
+		*this = std::move(other);
+	}
+
+	StreamingBuffer& StreamingBuffer::operator=(StreamingBuffer&& other) noexcept {
+		if (this != &other) {
+			release();
+			m_handle = std::exchange(other.m_handle, 0);
+			m_persistent = other.m_persistent;
+			m_mapped = std::exchange(other.m_mapped, nullptr);
+			m_regionBytes = other.m_regionBytes;
+			m_region = other.m_region;
+			m_cursor = other.m_cursor;
+			for (int i = 0; i < kRegionCount; ++i) {
+				m_fences[i] = std::exchange(other.m_fences[i], nullptr);
+			}
+			m_stats = other.m_stats;
+		}
+		return *this;
+	}
+
+	void StreamingBuffer::createStorage(size_t regionBytes) {
+		m_regionBytes = regionBytes;
+		m_region = 0;
+		m_cursor = 0;
+		const auto totalBytes = static_cast<GLsizeiptr>(regionBytes * kRegionCount);
+
+		glGenBuffers(1, &m_handle);
+		glBindBuffer(kScratchTarget, m_handle);
+		if (m_persistent) {
+			glBufferStorage(kScratchTarget, totalBytes, nullptr, kPersistentFlags);
+			m_mapped = static_cast<uint8_t*>(glMapBufferRange(kScratchTarget, 0, totalBytes, kPersistentFlags));
+			if (m_mapped == nullptr) {
+				// Advertised but refused: storage is immutable, so start over unmapped
+				LOG_WARNING(Renderer, "StreamingBuffer: persistent map failed, using orphaning fallback");
+				glBindBuffer(kScratchTarget, 0);
+				glDeleteBuffers(1, &m_handle);
+				m_persistent = false;
+				glGenBuffers(1, &m_handle);
+				glBindBuffer(kScratchTarget, m_handle);
+			}
+		}
+		if (!m_persistent) {
+			glBufferData(kScratchTarget, totalBytes, nullptr, GL_STREAM_DRAW);
+		}
+		glBindBuffer(kScratchTarget, 0);
+	}
+
+	void StreamingBuffer::release() {
+		for (GLsync& fence : m_fences) {
+			if (fence != nullptr) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+		if (m_handle != 0) {
+			if (m_mapped != nullptr) {
+				glBindBuffer(kScratchTarget, m_handle);
+				glUnmapBuffer(kScratchTarget);
+				glBindBuffer(kScratchTarget, 0);
+				m_mapped = nullptr;
+			}
+			glDeleteBuffers(1, &m_handle);
+			m_handle = 0;
+		}
+	}
+
+	void StreamingBuffer::grow(size_t minRegionBytes) {
+		// Rare (first frames at a new high-water mark): drain the GPU's use of
+		// every region, then replace the buffer.
+		for (int i = 0; i < kRegionCount; ++i) {
+			waitForRegion(i);
+		}
+		const bool	   persistent = m_persistent;
+		const size_t   regionBytes = std::max(minRegionBytes, m_regionBytes * 2);
+		StreamingStats stats = m_stats;
+		release();
+		m_persistent = persistent;
+		createStorage(regionBytes);
+		m_stats = stats;
+		m_stats.orphans++;
+	}
+
+	StreamingBuffer::Allocation StreamingBuffer::allocate(size_t bytes, size_t alignment) {
+		if (m_handle == 0 || bytes == 0) {
+			return {};
+		}
+		if (bytes > m_regionBytes) {
+			grow(alignUp(bytes, alignment));
+		}
+
+		size_t offset = alignUp(m_cursor, alignment);
+		if (m_persistent) {
+			if (offset + bytes > m_regionBytes) {
+				// This frame's region is full: continue in the next one early
+				advanceRegion();
+				offset = 0;
+			}
+			m_cursor = offset + bytes;
+			m_stats.uploadBytes += bytes;
+			const size_t absolute = static_cast<size_t>(m_region) * m_regionBytes + offset;
+			return {m_mapped + absolute, static_cast<GLintptr>(absolute), bytes};
+		}
+
+		// Fallback: ranges are never rewritten until the buffer is orphaned, so
+		// unsynchronized mapping is safe.
+		const size_t capacity = m_regionBytes * kRegionCount;
+		glBindBuffer(kScratchTarget, m_handle);
+		if (offset + bytes > capacity) {
+			glBufferData(kScratchTarget, static_cast<GLsizeiptr>(capacity), nullptr, GL_STREAM_DRAW);
+			m_stats.orphans++;
+			offset = 0;
+		}
+		void* data = glMapBufferRange(kScratchTarget, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes), kAppendFlags);
+		glBindBuffer(kScratchTarget, 0);
+		if (data == nullptr) {
+			return {};
+		}
+		m_cursor = offset + bytes;
+		m_stats.uploadBytes += bytes;
+		return {data, static_cast<GLintptr>(offset), bytes};
+	}
+
+	bool StreamingBuffer::commit(const Allocation& allocation) {
+		if (!allocation.isValid()) {
+			return false;
+		}
+		if (m_persistent) {
+			return true; // coherent mapping: writes are visible to later GL commands
+		}
+		glBindBuffer(kScratchTarget, m_handle);
+		const bool intact = glUnmapBuffer(kScratchTarget) == GL_TRUE;
+		glBindBuffer(kScratchTarget, 0);
+		return intact;
+	}
+
+	void StreamingBuffer::endFrame() {
+		if (m_persistent && m_cursor > 0) {
+			advanceRegion();
+		}
+	}
+
+	void StreamingBuffer::advanceRegion() {
+		if (m_fences[m_region] != nullptr) {
+			glDeleteSync(m_fences[m_region]);
+		}
+		m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_region = (m_region + 1) % kRegionCount;
+		m_cursor = 0;
+		waitForRegion(m_region);
+	}
+
+	void StreamingBuffer::waitForRegion(int region) {
+		GLsync fence = m_fences[region];
+		if (fence == nullptr) {
+			return;
+		}
+		GLenum status = glClientWaitSync(fence, 0, 0);
+		if (status == GL_TIMEOUT_EXPIRED) {
+			m_stats.stalls++;
+			do {
+				status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceWaitNs);
+			} while (status == GL_TIMEOUT_EXPIRED);
+		}
+		glDeleteSync(fence);
+		m_fences[region] = nullptr;
+	}
+
+} // namespace Renderer
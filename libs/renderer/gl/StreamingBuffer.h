@@ -0,0 +1,104 @@
+#pragma once
+
+// StreamingBuffer - GPU buffer for data rewritten every frame (batched
+// vertices/indices, instance data). Callers write straight into mapped buffer
+// memory instead of handing the driver a CPU array to copy.
+//
+// Two strategies, picked at creation:
+// - Persistent ring (GL 4.4 / ARB_buffer_storage): one buffer mapped for its
+//   whole lifetime, split into kRegionCount per-frame regions. endFrame()
+//   fences the region just written and moves to the next, waiting on that
+//   region's fence only if the GPU is still reading it (3 frames back).
+// - Orphaning fallback (everything else, e.g. macOS GL 4.1): ranges are
+//   appended with unsynchronized map/unmap; when the buffer is full it is
+//   orphaned (re-specified) so the driver hands out fresh storage while the
+//   GPU finishes with the old.
+//
+// The buffer grows when a single allocation exceeds a region. Growing replaces
+// the GL buffer object, so bind handle() at draw time rather than caching it
+// in a VAO.
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Renderer {
+
+/// Upload counters for one StreamingBuffer since its last resetStats().
+struct StreamingStats {
+	uint64_t uploadBytes = 0; // bytes handed out by allocate()
+	uint32_t stalls = 0;	  // fence waits that blocked on the GPU
+	uint32_t orphans = 0;	  // buffer re-specifications (fallback wrap or growth)
+};
+
+class StreamingBuffer {
+  public:
+	static constexpr int kRegionCount = 3;
+
+	/// A reserved range: write `size` bytes at `data`, commit(), then have GL
+	/// read from byte `offset` of handle().
+	struct Allocation {
+		void*	 data = nullptr;
+		GLintptr offset = 0;
+		size_t	 size = 0;
+
+		[[nodiscard]] bool isValid() const { return data != nullptr; }
+	};
+
+	/// Default constructor - creates an empty (invalid) stream
+	StreamingBuffer() = default;
+
+	/// Create a stream with `regionBytes` of space per frame
+	static StreamingBuffer create(size_t regionBytes);
+
+	~StreamingBuffer() { release(); }
+
+	// Non-copyable
+	StreamingBuffer(const StreamingBuffer&) = delete;
+	StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+	StreamingBuffer(StreamingBuffer&& other) noexcept;
+	StreamingBuffer& operator=(StreamingBuffer&& other) noexcept;
+
+	/// Reserve `bytes` at an `alignment`-byte offset. Only one allocation may
+	/// be outstanding (uncommitted) at a time. Invalid if the stream is not
+	/// created or mapping failed.
+	[[nodiscard]] Allocation allocate(size_t bytes, size_t alignment = 16);
+
+	/// Finish writing an allocation. False if its contents were lost (the
+	/// fallback's unmap failed); skip draws that read it.
+	bool commit(const Allocation& allocation);
+
+	/// Call once the frame's draws from this stream are submitted.
+	void endFrame();
+
+	/// Release the GPU resource (makes this stream invalid)
+	void release();
+
+	[[nodiscard]] GLuint handle() const { return m_handle; }
+	[[nodiscard]] bool isValid() const { return m_handle != 0; }
+	[[nodiscard]] bool isPersistent() const { return m_persistent; }
+
+	[[nodiscard]] const StreamingStats& stats() const { return m_stats; }
+	void resetStats() { m_stats = {}; }
+
+  private:
+	void createStorage(size_t regionBytes);
+	void grow(size_t minRegionBytes);
+
+	/// Fence the current region, move to the next and wait until it is free.
+	void advanceRegion();
+	void waitForRegion(int region);
+
+	GLuint	 m_handle = 0;
+	bool	 m_persistent = false;
+	uint8_t* m_mapped = nullptr; // persistent mapping of the whole buffer
+	size_t	 m_regionBytes = 0;
+	int		 m_region = 0;
+	size_t	 m_cursor = 0; // next free byte: within m_region (persistent) or the buffer (fallback)
+	GLsync	 m_fences[kRegionCount] = {};
+	StreamingStats m_stats;
+};
+
+} // namespace Renderer
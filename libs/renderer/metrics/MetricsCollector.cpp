@@ -47,6 +47,8 @@ namespace Renderer {
 		metrics.drawCalls = drawCalls + entityDrawCalls;
 		metrics.vertexCount = vertexCount;
 		metrics.triangleCount = triangleCount + entityTriangleCount;
+		metrics.uploadBytes = uploadBytes;
+		metrics.uploadStalls = uploadStalls;
 
 		// Timing breakdown
 		metrics.tileRenderMs = tileRenderMs;
@@ -110,6 +112,11 @@ namespace Renderer {
 		visibleChunkCount = inVisibleChunkCount;
 	}
 
+	void MetricsCollector::setUploadStats(uint64_t inUploadBytes, uint32_t inUploadStalls) {
+		uploadBytes = inUploadBytes;
+		uploadStalls = inUploadStalls;
+	}
+
 	void MetricsCollector::setEntityRenderStats(uint32_t inDrawCalls, uint32_t inTriangleCount) {
 		entityDrawCalls = inDrawCalls;
 		entityTriangleCount = inTriangleCount;
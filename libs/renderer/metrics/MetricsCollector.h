@@ -27,6 +27,9 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		void setTimingBreakdown(float tileRenderMs, float entityRenderMs, float updateMs,
 								uint32_t tileCount, uint32_t entityCount, uint32_t visibleChunkCount);
 
+		// Set CPU->GPU streaming stats (bytes written to streaming buffers, blocking fence waits)
+		void setUploadStats(uint64_t uploadBytes, uint32_t uploadStalls);
+
 		// Set entity renderer stats (raw GL draws that bypass BatchRenderer counters)
 		void setEntityRenderStats(uint32_t drawCalls, uint32_t triangleCount);
 
@@ -53,6 +56,10 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		uint32_t vertexCount;
 		uint32_t triangleCount;
 
+		// Streaming upload stats
+		uint64_t uploadBytes{};
+		uint32_t uploadStalls{};
+
 		// Entity renderer stats (raw GL draws outside the batch renderer)
 		uint32_t entityDrawCalls{};
 		uint32_t entityTriangleCount{};
@@ -6,6 +6,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
 #include <algorithm>
+#include <cstring>
 
 namespace Renderer {
 
@@ -20,6 +21,23 @@ namespace Renderer {
 			Foundation::Vec4 result = transform * Foundation::Vec4(pos.x, pos.y, 0.0F, 1.0F);
 			return Foundation::Vec2(result.x, result.y);
 		}
+
+		// Per-frame stream capacities; streams grow if a frame needs more.
+		constexpr size_t kVertexStreamBytes = 1024 * 1024;	 // ~13k UberVertex
+		constexpr size_t kIndexStreamBytes = 256 * 1024;	 // 64k indices
+		constexpr size_t kInstanceStreamBytes = 2048 * 1024; // 64k InstanceData
+
+		// Point the uber vertex attributes (locations 0-5) at UberVertex data
+		// starting at `base` in the bound GL_ARRAY_BUFFER.
+		void setUberVertexAttributes(GLintptr base) {
+			auto at = [base](size_t field) { return reinterpret_cast<const void*>(base + static_cast<GLintptr>(field)); };
+			glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(UberVertex), at(offsetof(UberVertex, position)));
+			glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(UberVertex), at(offsetof(UberVertex, texCoord)));
+			glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), at(offsetof(UberVertex, color)));
+			glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), at(offsetof(UberVertex, data1)));
+			glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), at(offsetof(UberVertex, data2)));
+			glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), at(offsetof(UberVertex, clipBounds)));
+		}
 	} // namespace
 
 	BatchRenderer::BatchRenderer() { // NOLINT(cppcoreguidelines-pro-type-member-init,modernize-use-equals-default)
@@ -46,6 +64,7 @@ namespace Renderer {
 		atlasLoc = glGetUniformLocation(shader.getProgram(), "u_atlas");
 		viewportHeightLoc = glGetUniformLocation(shader.getProgram(), "u_viewportHeight");
 		pixelRatioLoc = glGetUniformLocation(shader.getProgram(), "u_pixelRatio");
+		clipOriginLoc = glGetUniformLocation(shader.getProgram(), "u_clipOrigin");
 
 		// Get uniform locations (instanced rendering)
 		cameraPositionLoc = glGetUniformLocation(shader.getProgram(), "u_cameraPosition");
@@ -70,52 +89,33 @@ namespace Renderer {
 				  << " u_viewportSize=" << viewportSizeLoc << std::endl;
 #endif
 
-		// Create VAO/VBO/IBO using RAII wrappers
+		// Create VAO and the per-frame streams (RAII wrappers)
 		vao = GLVertexArray::create();
-		vbo = GLBuffer::create(GL_ARRAY_BUFFER);
-		ibo = GLBuffer::create(GL_ELEMENT_ARRAY_BUFFER);
-
+		vertexStream = StreamingBuffer::create(kVertexStreamBytes);
+		indexStream = StreamingBuffer::create(kIndexStreamBytes);
+		instanceStream = StreamingBuffer::create(kInstanceStreamBytes);
+
+		// Attributes (uber.vert):
+		//   0 a_position, 1 a_texCoord (UV for text, rectLocalPos for shapes),
+		//   2 a_color, 3 a_data1 (borderData for shapes),
+		//   4 a_data2 (shapeParams for shapes, (pixelRange, 0, 0, -1) for text),
+		//   5 a_clipBounds ((minX, minY, maxX, maxY) for clipping)
+		// Note: locations 6-7 are reserved for instancing.
+		// Each flush() points them (and the element buffer) at that batch's
+		// stream ranges.
 		vao.bind();
-
-		// Set up vertex buffer
-		glBindBuffer(GL_ARRAY_BUFFER, vbo);
-
-		// Position attribute (location = 0)
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(UberVertex), (void*)offsetof(UberVertex, position));
-
-		// TexCoord attribute (location = 1) - UV for text, rectLocalPos for shapes
-		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(UberVertex), (void*)offsetof(UberVertex, texCoord));
-
-		// Color attribute (location = 2)
-		glEnableVertexAttribArray(2);
-		glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), (void*)offsetof(UberVertex, color));
-
-		// Data1 attribute (location = 3) - borderData for shapes
-		glEnableVertexAttribArray(3);
-		glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), (void*)offsetof(UberVertex, data1));
-
-		// Data2 attribute (location = 4) - shapeParams for shapes, (pixelRange, 0, 0, -1) for text
-		glEnableVertexAttribArray(4);
-		glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), (void*)offsetof(UberVertex, data2));
-
-		// ClipBounds attribute (location = 5) - (minX, minY, maxX, maxY) for clipping
-		// Note: locations 6-7 are reserved for instancing
-		glEnableVertexAttribArray(5);
-		glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(UberVertex), (void*)offsetof(UberVertex, clipBounds));
-
-		// Bind index buffer
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
-
+		for (GLuint location = 0; location <= 5; ++location) {
+			glEnableVertexAttribArray(location);
+		}
 		glBindVertexArray(0);
 	}
 
 	void BatchRenderer::shutdown() {
 		// Release RAII wrappers (GPU resources freed automatically)
 		vao.release();
-		vbo.release();
-		ibo.release();
+		vertexStream.release();
+		indexStream.release();
+		instanceStream.release();
 		// Shader cleanup handled by its own RAII destructor
 	}
 
@@ -453,31 +453,144 @@ namespace Renderer {
 		fontPixelRange = pixelRange;
 	}
 
+	void BatchRenderer::addImageQuad(const Foundation::Rect& bounds, GLuint texture, const Foundation::Color& tint, float zIndex) {
+		if (texture == 0) {
+			return;
+		}
+		const uint32_t		   zGroupStart = static_cast<uint32_t>(indices.size());
+		const uint32_t		   baseIndex = static_cast<uint32_t>(vertices.size());
+		const Foundation::Vec4 colorVec = tint.toVec4();
+		const Foundation::Vec4 zeroVec4(0.0F, 0.0F, 0.0F, 0.0F);
+		const Foundation::Vec4 imageParams(0.0F, 0.0F, 0.0F, kRenderModeImage);
+
+		// Corners TL, TR, BR, BL. Render targets store rows bottom-up, so the
+		// top edge samples v = 1.
+		const float x0 = bounds.x;
+		const float y0 = bounds.y;
+		const float x1 = bounds.x + bounds.width;
+		const float y1 = bounds.y + bounds.height;
+		vertices.push_back({TransformPosition(Foundation::Vec2(x0, y0), currentTransform, transformIsIdentity),
+							Foundation::Vec2(0.0F, 1.0F), colorVec, zeroVec4, imageParams, currentClipBounds});
+		vertices.push_back({TransformPosition(Foundation::Vec2(x1, y0), currentTransform, transformIsIdentity),
+							Foundation::Vec2(1.0F, 1.0F), colorVec, zeroVec4, imageParams, currentClipBounds});
+		vertices.push_back({TransformPosition(Foundation::Vec2(x1, y1), currentTransform, transformIsIdentity),
+							Foundation::Vec2(1.0F, 0.0F), colorVec, zeroVec4, imageParams, currentClipBounds});
+		vertices.push_back({TransformPosition(Foundation::Vec2(x0, y1), currentTransform, transformIsIdentity),
+							Foundation::Vec2(0.0F, 0.0F), colorVec, zeroVec4, imageParams, currentClipBounds});
+
+		indices.push_back(baseIndex + 0);
+		indices.push_back(baseIndex + 1);
+		indices.push_back(baseIndex + 2);
+		indices.push_back(baseIndex + 0);
+		indices.push_back(baseIndex + 2);
+		indices.push_back(baseIndex + 3);
+
+		// Tagged with the texture like a text glyph with its atlas, so flush()
+		// binds it for this run
+		vertexAtlas.insert(vertexAtlas.end(), 4, texture);
+
+		recordGroup(zGroupStart, zIndex);
+	}
+
+	void BatchRenderer::beginOffscreen(const Foundation::Rect& region, float pixelRatio) {
+		offscreen = OffscreenTarget{region, pixelRatio};
+	}
+
+	void BatchRenderer::endOffscreen() {
+		offscreen.reset();
+	}
+
 	void BatchRenderer::flush() {
 		if (vertices.empty()) {
 			return;
 		}
 
-		// Resolve draw order. Submission ("organic") order is kept unless some draw
-		// carried an explicit (non-zero) z; then the per-draw-call groups are
-		// stable-sorted by z and the emit-order index list is rebuilt (groups, not
-		// triangles). The zIndex came from the component layer; the renderer only
-		// orders by it. The fast path costs nothing beyond the group records.
-		const std::vector<uint32_t>* emit = &indices;
-		std::vector<uint32_t>		 sortedIndices;
-		if (anyExplicitZ && !drawGroups.empty()) {
-			std::stable_sort(drawGroups.begin(), drawGroups.end(), [](const DrawGroup& a, const DrawGroup& b) { return a.zIndex < b.zIndex; });
-			sortedIndices.reserve(indices.size());
-			for (const DrawGroup& g : drawGroups) {
-				sortedIndices.insert(sortedIndices.end(), indices.begin() + g.indexStart, indices.begin() + g.indexStart + g.indexCount);
+		// Stream the batch: vertices are copied once into mapped memory; indices
+		// are emitted straight into the index stream below, in draw order.
+		const size_t				vertexBytes = vertices.size() * sizeof(UberVertex);
+		StreamingBuffer::Allocation vertexAlloc = vertexStream.allocate(vertexBytes, sizeof(float));
+		if (vertexAlloc.isValid()) {
+			std::memcpy(vertexAlloc.data, vertices.data(), vertexBytes);
+		}
+		const bool verticesOk = vertexStream.commit(vertexAlloc);
+
+		StreamingBuffer::Allocation indexAlloc = indexStream.allocate(indices.size() * sizeof(uint32_t), sizeof(uint32_t));
+
+		// Resolve draw order while writing the indices. Submission ("organic")
+		// order is kept unless some draw carried an explicit (non-zero) z; then
+		// the per-draw-call groups are stable-sorted by z and emitted group by
+		// group (groups, not triangles). The zIndex came from the component
+		// layer; the renderer only orders by it.
+		//
+		// Multi-atlas draw splitting happens in the same pass. All shapes and
+		// text share one vertex/index range and one draw order (z-order ==
+		// emit order). Text vertices are tagged in `vertexAtlas` with the MSDF
+		// atlas they sample; shapes are tagged 0 (they ignore the bound texture,
+		// the shader branches on data2.w). A new draw run starts only when a
+		// text triangle needs a different atlas than the current run's.
+		// Triangles are never reordered, so z-order is exact.
+		//
+		// Common case (all text from one atlas, e.g. the default Roboto): every
+		// text triangle needs the same atlas, so this collapses to a single
+		// glDrawElements identical to the prior single-atlas behavior.
+		drawRuns.clear();
+		auto*  out = static_cast<uint32_t*>(indexAlloc.data);
+		size_t written = 0;
+		size_t runStart = 0;
+		GLuint runAtlas = defaultFontAtlas;
+
+		auto emitTriangles = [&](const uint32_t* src, size_t count) {
+			for (size_t i = 0; i < count; i += 3) {
+				// A triangle's vertices are all shape (tag 0) or all the same text
+				// atlas; max() yields the text atlas if any, else 0 (no requirement).
+				GLuint required = vertexAtlas[src[i]];
+				required = std::max(required, vertexAtlas[src[i + 1]]);
+				required = std::max(required, vertexAtlas[src[i + 2]]);
+				if (required != 0 && required != runAtlas) {
+					if (written > runStart) {
+						drawRuns.push_back({runStart, written - runStart, runAtlas});
+					}
+					runAtlas = required;
+					runStart = written;
+				}
+				out[written] = src[i];
+				out[written + 1] = src[i + 1];
+				out[written + 2] = src[i + 2];
+				written += 3;
+			}
+		};
+		if (indexAlloc.isValid()) {
+			if (anyExplicitZ && !drawGroups.empty()) {
+				std::stable_sort(drawGroups.begin(), drawGroups.end(), [](const DrawGroup& a, const DrawGroup& b) {
+					return a.zIndex < b.zIndex;
+				});
+				for (const DrawGroup& g : drawGroups) {
+					emitTriangles(indices.data() + g.indexStart, g.indexCount);
+				}
+			} else {
+				emitTriangles(indices.data(), indices.size());
+			}
+			if (written > runStart) {
+				drawRuns.push_back({runStart, written - runStart, runAtlas});
 			}
-			emit = &sortedIndices;
 		}
-		const std::vector<uint32_t>& idx = *emit;
+		const bool indicesOk = indexStream.commit(indexAlloc);
 
-		// Enable blending for transparency (shapes and text both need this)
+		if (!verticesOk || !indicesOk) {
+			std::cerr << "[BatchRenderer] Failed to stream batch (" << vertices.size() << " vertices); dropped" << std::endl;
+			clearBatch();
+			return;
+		}
+
+		// Enable blending for transparency (shapes and text both need this).
+		// Offscreen targets also accumulate coverage in alpha (premultiplied
+		// result), so a cached layer composites like the draws it replaces.
 		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		if (offscreen.has_value()) {
+			glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		} else {
+			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		}
 
 		// Disable depth testing for 2D rendering
 		glDisable(GL_DEPTH_TEST);
@@ -485,23 +598,22 @@ namespace Renderer {
 		// Disable face culling (quads may be in either winding order)
 		glDisable(GL_CULL_FACE);
 
-		// Upload vertex data to GPU
-		glBindBuffer(GL_ARRAY_BUFFER, vbo);
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(UberVertex), vertices.data(), GL_DYNAMIC_DRAW);
-
-		// Upload index data to GPU
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx.size() * sizeof(uint32_t), idx.data(), GL_DYNAMIC_DRAW);
-
-		// Bind shader and VAO
+		// Bind shader and VAO, then point it at this batch's stream ranges
 		shader.use();
 		glBindVertexArray(vao);
+		glBindBuffer(GL_ARRAY_BUFFER, vertexStream.handle());
+		setUberVertexAttributes(vertexAlloc.offset);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexStream.handle());
 
 		// Create projection matrix
 		// If CoordinateSystem is set, use it for DPI-aware projection (logical pixels)
 		// Otherwise fall back to viewport dimensions (may be incorrect on high-DPI displays)
 		Foundation::Mat4 projection;
-		if (coordinateSystem != nullptr) {
+		if (offscreen.has_value()) {
+			// The target shows just its region of the logical screen
+			const Foundation::Rect& r = offscreen->region;
+			projection = glm::ortho(r.x, r.x + r.width, r.y + r.height, r.y, -1.0F, 1.0F);
+		} else if (coordinateSystem != nullptr) {
 			projection = coordinateSystem->CreateScreenSpaceProjection();
 		} else {
 			projection = glm::ortho(0.0F, static_cast<float>(viewportWidth), static_cast<float>(viewportHeight), 0.0F, -1.0F, 1.0F);
@@ -515,9 +627,14 @@ namespace Renderer {
 
 		// Set viewport height and pixel ratio for clipping
 		// gl_FragCoord uses physical pixels, so we need framebuffer height and pixel ratio
-		float framebufferHeight = static_cast<float>(viewportHeight);
-		float pixelRatio = 1.0F;
-		if (coordinateSystem != nullptr) {
+		float			 framebufferHeight = static_cast<float>(viewportHeight);
+		float			 pixelRatio = 1.0F;
+		Foundation::Vec2 clipOrigin(0.0F, 0.0F);
+		if (offscreen.has_value()) {
+			pixelRatio = offscreen->pixelRatio;
+			framebufferHeight = offscreen->region.height * pixelRatio;
+			clipOrigin = Foundation::Vec2(offscreen->region.x, offscreen->region.y);
+		} else if (coordinateSystem != nullptr) {
 			// Get pixel ratio for DPI scaling
 			pixelRatio = coordinateSystem->getPixelRatio();
 			// Get logical height and convert to framebuffer (physical) height
@@ -526,6 +643,7 @@ namespace Renderer {
 		}
 		glUniform1f(viewportHeightLoc, framebufferHeight);
 		glUniform1f(pixelRatioLoc, pixelRatio);
+		glUniform2f(clipOriginLoc, clipOrigin.x, clipOrigin.y);
 
 		// Set instanced = false for standard batched rendering path
 		glUniform1i(instancedLoc, 0);
@@ -533,58 +651,17 @@ namespace Renderer {
 		glActiveTexture(GL_TEXTURE0);
 		glUniform1i(atlasLoc, 0);
 
-		// Multi-atlas draw splitting.
-		//
-		// All shapes and text share one VBO/IBO and one draw order (z-order ==
-		// submission order). Text vertices are tagged in `vertexAtlas` with the
-		// MSDF atlas they sample; shapes are tagged 0 (they ignore the bound
-		// texture, the shader branches on data2.w). We walk triangles in order,
-		// keeping a contiguous run of indices, and start a NEW draw call only
-		// when a text triangle needs a different atlas than the one currently
-		// bound. Triangles are never reordered, so z-order is exact.
-		//
-		// Common case (all text from one atlas, e.g. the default Roboto): every
-		// text triangle needs the same atlas, so this collapses to a single
-		// glDrawElements identical to the prior single-atlas behavior.
-		const size_t indexCount = idx.size();
-		GLuint		 boundAtlas = defaultFontAtlas; // What's currently bound on the GPU
-		if (boundAtlas != 0) {
-			glBindTexture(GL_TEXTURE_2D, boundAtlas);
-		}
-
-		size_t runStart = 0; // First index of the current contiguous run
-		for (size_t tri = 0; tri < indexCount; tri += 3) {
-			// A triangle's vertices are all shape (tag 0) or all the same text
-			// atlas; max() yields the text atlas if any, else 0 (no requirement).
-			GLuint required = vertexAtlas[idx[tri]];
-			required = std::max(required, vertexAtlas[idx[tri + 1]]);
-			required = std::max(required, vertexAtlas[idx[tri + 2]]);
-
-			if (required != 0 && required != boundAtlas) {
-				// Flush the run accumulated so far with the previously bound atlas.
-				if (tri > runStart) {
-					glDrawElements(
-						GL_TRIANGLES,
-						static_cast<GLsizei>(tri - runStart),
-						GL_UNSIGNED_INT,
-						(const void*)(runStart * sizeof(uint32_t))
-					);
-					drawCallCount++;
-				}
-				// Bind the atlas this run needs and start a new run here.
-				boundAtlas = required;
-				glBindTexture(GL_TEXTURE_2D, boundAtlas);
-				runStart = tri;
+		GLuint boundAtlas = 0;
+		for (const DrawRun& run : drawRuns) {
+			if (run.atlas != 0 && run.atlas != boundAtlas) {
+				glBindTexture(GL_TEXTURE_2D, run.atlas);
+				boundAtlas = run.atlas;
 			}
-		}
-
-		// Draw the final run.
-		if (indexCount > runStart) {
 			glDrawElements(
 				GL_TRIANGLES,
-				static_cast<GLsizei>(indexCount - runStart),
+				static_cast<GLsizei>(run.indexCount),
 				GL_UNSIGNED_INT,
-				(const void*)(runStart * sizeof(uint32_t))
+				reinterpret_cast<const void*>(indexAlloc.offset + static_cast<GLintptr>(run.indexStart * sizeof(uint32_t)))
 			);
 			drawCallCount++;
 		}
@@ -599,6 +676,10 @@ namespace Renderer {
 		frameTriangleCount += indices.size() / 3;
 
 		// Clear buffers for next batch
+		clearBatch();
+	}
+
+	void BatchRenderer::clearBatch() {
 		vertices.clear();
 		indices.clear();
 		vertexAtlas.clear();
@@ -610,15 +691,17 @@ namespace Renderer {
 		drawCallCount = 0;
 		frameVertexCount = 0;
 		frameTriangleCount = 0;
-		vertices.clear();
-		indices.clear();
-		vertexAtlas.clear();
-		drawGroups.clear();
-		anyExplicitZ = false;
+		vertexStream.resetStats();
+		indexStream.resetStats();
+		instanceStream.resetStats();
+		clearBatch();
 	}
 
 	void BatchRenderer::endFrame() {
 		flush();
+		vertexStream.endFrame();
+		indexStream.endFrame();
+		instanceStream.endFrame();
 	}
 
 	void BatchRenderer::setViewport(int width, int height) {
@@ -643,6 +726,10 @@ namespace Renderer {
 		stats.drawCalls = static_cast<uint32_t>(drawCallCount);
 		stats.vertexCount = static_cast<uint32_t>(frameVertexCount);
 		stats.triangleCount = static_cast<uint32_t>(frameTriangleCount);
+		for (const StreamingBuffer* stream : {&vertexStream, &indexStream, &instanceStream}) {
+			stats.uploadBytes += stream->stats().uploadBytes;
+			stats.uploadStalls += stream->stats().stalls;
+		}
 		return stats;
 	}
 
@@ -673,8 +760,8 @@ namespace Renderer {
 
 	// Maximum allowed instances to prevent excessive GPU memory allocation.
 	// Groundcover (dense grass) needs hundreds of thousands per instanced mesh, so
-	// this is sized for that; the instance buffer is only as large as the requested
-	// maxInstances (e.g. 250k blades = 8MB), not this cap.
+	// this is sized for that. Instance data lives in the shared instance stream,
+	// which grows to the largest single draw (e.g. 250k blades = 8MB).
 	constexpr uint32_t kMaxAllowedInstances = 2000000;
 
 	InstancedMeshHandle BatchRenderer::uploadInstancedMesh(
@@ -750,29 +837,14 @@ namespace Renderer {
 		handle.indexCount = static_cast<uint32_t>(mesh.indices.size());
 		handle.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
 
-		// Create instance VBO (dynamic - updated each frame with per-instance data) - RAII wrapper
-		handle.instanceVBO = GLBuffer::create(GL_ARRAY_BUFFER);
-		glBindBuffer(GL_ARRAY_BUFFER, handle.instanceVBO);
-		glBufferData(
-			GL_ARRAY_BUFFER,
-			static_cast<GLsizeiptr>(maxInstances * sizeof(InstanceData)),
-			nullptr, // No initial data - will be updated each frame
-			GL_DYNAMIC_DRAW
-		);
-
-		// Set up instance attributes with divisor = 1 (advance once per instance, not per vertex)
+		// Instance attributes advance once per instance (divisor = 1). Their
+		// pointers are set per draw, into the instance stream range holding
+		// that draw's InstanceData.
 		// Location 6: instanceData1 (worldPos.xy, rotation, scale)
-		// InstanceData layout: [worldPosition.x, worldPosition.y, rotation, scale, colorTint...]
-		glEnableVertexAttribArray(6);
-		glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), reinterpret_cast<void*>(0));
-		glVertexAttribDivisor(6, 1); // Key: advance once per instance
-
 		// Location 7: instanceData2 (colorTint.rgba)
+		glEnableVertexAttribArray(6);
+		glVertexAttribDivisor(6, 1);
 		glEnableVertexAttribArray(7);
-		glVertexAttribPointer(
-			7, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
-			reinterpret_cast<void*>(offsetof(InstanceData, colorTint))
-		);
 		glVertexAttribDivisor(7, 1);
 
 		glBindVertexArray(0);
@@ -785,7 +857,6 @@ namespace Renderer {
 		handle.vao.release();
 		handle.meshVBO.release();
 		handle.meshIBO.release();
-		handle.instanceVBO.release();
 
 		// Reset other fields
 		handle.indexCount = 0;
@@ -793,18 +864,7 @@ namespace Renderer {
 		handle.maxInstances = 0;
 	}
 
-	void BatchRenderer::drawInstanced(
-		const InstancedMeshHandle& handle,
-		const InstanceData*		   instances,
-		uint32_t				   count,
-		Foundation::Vec2		   cameraPosition,
-		float					   cameraZoom,
-		float					   pixelsPerMeter
-	) {
-		if (!handle.isValid() || count == 0 || instances == nullptr) {
-			return;
-		}
-
+	void BatchRenderer::beginInstancedPass(Foundation::Vec2 cameraPosition, float cameraZoom, float pixelsPerMeter) {
 		// Enable blending for transparency
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -844,39 +904,60 @@ namespace Renderer {
 			logicalHeight = windowSize.y;
 		}
 		glUniform2f(viewportSizeLoc, logicalWidth, logicalHeight);
+	}
 
-		// Bind the instanced mesh VAO and instance buffer
+	void BatchRenderer::drawInstancesAt(const InstancedMeshHandle& handle, GLintptr byteOffset, uint32_t count) {
+		// Point the instance attributes at this draw's range of the stream
 		handle.vao.bind();
-		handle.instanceVBO.bind();
+		glBindBuffer(GL_ARRAY_BUFFER, instanceStream.handle());
+		glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), reinterpret_cast<const void*>(byteOffset));
+		glVertexAttribPointer(
+			7, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData),
+			reinterpret_cast<const void*>(byteOffset + static_cast<GLintptr>(offsetof(InstanceData, colorTint)))
+		);
+
+		glDrawElementsInstanced(
+			GL_TRIANGLES,
+			static_cast<GLsizei>(handle.indexCount),
+			GL_UNSIGNED_SHORT, // mesh indices are uint16_t
+			nullptr,
+			static_cast<GLsizei>(count)
+		);
+
+		drawCallCount++;
+		// Each instance renders all mesh vertices; triangle count = indices / 3
+		frameVertexCount += static_cast<size_t>(handle.vertexCount) * count;
+		frameTriangleCount += static_cast<size_t>(handle.indexCount / 3) * count;
+	}
+
+	void BatchRenderer::drawInstanced(
+		const InstancedMeshHandle& handle,
+		const InstanceData*		   instances,
+		uint32_t				   count,
+		Foundation::Vec2		   cameraPosition,
+		float					   cameraZoom,
+		float					   pixelsPerMeter
+	) {
+		if (!handle.isValid() || count == 0 || instances == nullptr) {
+			return;
+		}
+
+		beginInstancedPass(cameraPosition, cameraZoom, pixelsPerMeter);
 
-		// Handle overflow by batching multiple draw calls if needed
-		// This ensures all instances render even if count > maxInstances
+		// Split into draws of at most maxInstances, each copied into the stream
 		uint32_t remaining = count;
 		uint32_t offset = 0;
 
 		while (remaining > 0) {
 			uint32_t batchSize = std::min(remaining, handle.maxInstances);
 
-			// Upload this batch of instance data to GPU
-			glBufferSubData(
-				GL_ARRAY_BUFFER, 0,
-				static_cast<GLsizeiptr>(batchSize * sizeof(InstanceData)),
-				instances + offset
-			);
-
-			// Draw this batch of instances
-			glDrawElementsInstanced(
-				GL_TRIANGLES,
-				static_cast<GLsizei>(handle.indexCount),
-				GL_UNSIGNED_SHORT, // mesh indices are uint16_t
-				nullptr,
-				static_cast<GLsizei>(batchSize)
-			);
-
-			drawCallCount++;
-			// Each instance renders all mesh vertices; triangle count = indices / 3
-			frameVertexCount += static_cast<size_t>(handle.vertexCount) * batchSize;
-			frameTriangleCount += static_cast<size_t>(handle.indexCount / 3) * batchSize;
+			StreamingBuffer::Allocation alloc = instanceStream.allocate(batchSize * sizeof(InstanceData), alignof(InstanceData));
+			if (alloc.isValid()) {
+				std::memcpy(alloc.data, instances + offset, alloc.size);
+			}
+			if (instanceStream.commit(alloc)) {
+				drawInstancesAt(handle, alloc.offset, batchSize);
+			}
 
 			remaining -= batchSize;
 			offset += batchSize;
@@ -886,4 +967,42 @@ namespace Renderer {
 		glDisable(GL_BLEND);
 	}
 
+	BatchRenderer::InstanceWrite BatchRenderer::beginInstanceWrite(uint32_t count) {
+		StreamingBuffer::Allocation alloc = instanceStream.allocate(count * sizeof(InstanceData), alignof(InstanceData));
+		if (!alloc.isValid()) {
+			return {};
+		}
+		return {static_cast<InstanceData*>(alloc.data), count, alloc.offset};
+	}
+
+	bool BatchRenderer::endInstanceWrite(const InstanceWrite& write) {
+		return instanceStream.commit({write.data, write.offset, write.count * sizeof(InstanceData)});
+	}
+
+	void BatchRenderer::drawInstanced(
+		const InstancedMeshHandle& handle,
+		const InstanceWrite&	   write,
+		uint32_t				   first,
+		uint32_t				   count,
+		Foundation::Vec2		   cameraPosition,
+		float					   cameraZoom,
+		float					   pixelsPerMeter
+	) {
+		if (!handle.isValid() || write.data == nullptr || count == 0 || first + count > write.count) {
+			return;
+		}
+
+		beginInstancedPass(cameraPosition, cameraZoom, pixelsPerMeter);
+
+		// Already in the stream: split into draws of at most maxInstances, no copy
+		for (uint32_t done = 0; done < count;) {
+			uint32_t batchSize = std::min(count - done, handle.maxInstances);
+			drawInstancesAt(handle, write.offset + static_cast<GLintptr>((first + done) * sizeof(InstanceData)), batchSize);
+			done += batchSize;
+		}
+
+		glBindVertexArray(0);
+		glDisable(GL_BLEND);
+	}
+
 } // namespace Renderer
@@ -8,8 +8,8 @@
 //
 // Also provides GPU instancing for efficient rendering of many identical meshes.
 
-#include "gl/GLBuffer.h"
 #include "gl/GLVertexArray.h"
+#include "gl/StreamingBuffer.h"
 #include "graphics/Color.h"
 #include "graphics/PrimitiveStyles.h"
 #include "graphics/Rect.h"
@@ -48,6 +48,7 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 	// Render mode constants for data2.w
 	constexpr float kRenderModeText = -1.0F;   // Text rendering (MSDF)
 	constexpr float kRenderModeShadow = -3.0F; // Box-shadow / glow (SDF soft falloff)
+	constexpr float kRenderModeImage = -4.0F;  // Cached premultiplied RGBA texture (UI layer caches)
 	// Shapes use borderPosition (0, 1, 2) in data2.w
 
 	// Batch accumulator - collects geometry before GPU upload
@@ -119,6 +120,23 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		// atlasTexture == 0). pixelRange comes from atlas generation.
 		void setFontAtlas(GLuint atlasTexture, float pixelRange = 4.0F);
 
+		// --- Image rendering ---
+
+		// Add a quad sampling a whole texture rendered offscreen (e.g. a cached
+		// UI layer from a RenderToTexture). The texture holds premultiplied
+		// color; tint multiplies the result. Split into draw runs like atlases.
+		void addImageQuad(const Foundation::Rect& bounds, GLuint texture, const Foundation::Color& tint, float zIndex = 0.0F);
+
+		// --- Offscreen targets ---
+
+		// Flushes until endOffscreen() render into the currently bound
+		// framebuffer, which covers `region` of the logical screen at
+		// `pixelRatio` physical pixels per logical pixel. Geometry keeps its
+		// screen coordinates; only the projection and clip mapping change, and
+		// alpha accumulates so the target can be composited later.
+		void beginOffscreen(const Foundation::Rect& region, float pixelRatio);
+		void endOffscreen();
+
 		// --- Rendering ---
 
 		// Flush accumulated geometry to GPU and render
@@ -166,6 +184,8 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 			uint32_t drawCalls = 0;
 			uint32_t vertexCount = 0;
 			uint32_t triangleCount = 0;
+			uint64_t uploadBytes = 0;  // vertex/index/instance bytes streamed to the GPU
+			uint32_t uploadStalls = 0; // stream fence waits that blocked on the GPU
 		};
 
 		// Statistics
@@ -181,7 +201,7 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		/// Upload a tessellated mesh to GPU for instanced rendering.
 		/// The mesh is uploaded once and reused for all instances.
 		/// @param mesh Tessellated mesh to upload
-		/// @param maxInstances Maximum number of instances to support (default 10000)
+		/// @param maxInstances Maximum instances per draw call (default 10000); larger counts are split
 		/// @return Handle for subsequent draw calls
 		InstancedMeshHandle uploadInstancedMesh(
 			const renderer::TessellatedMesh& mesh,
@@ -193,7 +213,9 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		void releaseInstancedMesh(InstancedMeshHandle& handle);
 
 		/// Draw multiple instances of a mesh with GPU instancing.
-		/// Transforms are computed on GPU using camera uniforms.
+		/// Transforms are computed on GPU using camera uniforms. Copies `instances`
+		/// into the instance stream; callers that build instance data per frame
+		/// can write it in place with beginInstanceWrite() instead.
 		/// @param handle Mesh handle from uploadInstancedMesh
 		/// @param instances Array of per-instance data (world position, rotation, scale, color)
 		/// @param count Number of instances to draw
@@ -209,14 +231,40 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 			float pixelsPerMeter
 		);
 
+		/// Instance data reserved in the per-frame instance stream.
+		struct InstanceWrite {
+			InstanceData* data = nullptr; // write up to `count` instances here
+			uint32_t	  count = 0;
+			GLintptr	  offset = 0; // byte offset in the stream
+		};
+
+		/// Reserve `count` instances to fill in place (no staging copy). Only one
+		/// write may be open; finish it with endInstanceWrite() before drawing.
+		/// data is nullptr if the stream is unavailable.
+		InstanceWrite beginInstanceWrite(uint32_t count);
+
+		/// Close the open write. False if its contents were lost (skip drawing).
+		bool endInstanceWrite(const InstanceWrite& write);
+
+		/// Draw instances [first, first + count) of a committed write.
+		void drawInstanced(
+			const InstancedMeshHandle& handle,
+			const InstanceWrite& write,
+			uint32_t first,
+			uint32_t count,
+			Foundation::Vec2 cameraPosition,
+			float cameraZoom,
+			float pixelsPerMeter
+		);
+
 	  private:
 		// Vertex data (CPU-side accumulation)
 		std::vector<UberVertex>	 vertices;
 		std::vector<uint32_t>	 indices;
 
 		// Per-vertex atlas tag, parallel to `vertices`. 0 = shape (no texture
-		// requirement); non-zero = the MSDF atlas a text vertex must sample from.
-		// flush() uses these to split text into per-atlas draw runs.
+		// requirement); non-zero = the MSDF atlas a text vertex (or the texture
+		// an image vertex) must sample from. flush() uses these to split draw runs.
 		std::vector<GLuint>		 vertexAtlas;
 
 		// Per-draw-call z-order groups. Each add* records one {indexStart, indexCount,
@@ -234,11 +282,31 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		// Record the index range [groupStart, current end) as one z-order group.
 		void recordGroup(uint32_t groupStart, float zIndex);
 
-		// OpenGL resources (RAII wrappers for automatic cleanup)
-		GLVertexArray vao;
-		GLBuffer vbo;
-		GLBuffer ibo;
-		Shader shader;
+		// Drop the accumulated batch (after it is drawn, or at frame start)
+		void clearBatch();
+
+		// Set GL state and uniforms shared by every instanced draw
+		void beginInstancedPass(Foundation::Vec2 cameraPosition, float cameraZoom, float pixelsPerMeter);
+
+		// Draw `count` instances whose data starts at `byteOffset` in the instance stream
+		void drawInstancesAt(const InstancedMeshHandle& handle, GLintptr byteOffset, uint32_t count);
+
+		// One glDrawElements range of flush(): indices sharing a font atlas
+		struct DrawRun {
+			size_t indexStart;
+			size_t indexCount;
+			GLuint atlas;
+		};
+		std::vector<DrawRun> drawRuns;
+
+		// OpenGL resources (RAII wrappers for automatic cleanup). Batched vertices,
+		// indices and per-frame instance data are written straight into
+		// streaming buffers (see StreamingBuffer.h).
+		GLVertexArray	vao;
+		StreamingBuffer vertexStream;
+		StreamingBuffer indexStream;
+		StreamingBuffer instanceStream;
+		Shader			shader;
 
 		// Uniform locations (standard batched rendering)
 		GLint projectionLoc = -1;
@@ -246,6 +314,7 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		GLint atlasLoc = -1;
 		GLint viewportHeightLoc = -1;
 		GLint pixelRatioLoc = -1;
+		GLint clipOriginLoc = -1;
 
 		// Uniform locations (instanced rendering)
 		GLint cameraPositionLoc = -1;
@@ -261,6 +330,13 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 		// Coordinate system (optional, for DPI-aware rendering)
 		CoordinateSystem* coordinateSystem = nullptr;
 
+		// Active offscreen target (see beginOffscreen)
+		struct OffscreenTarget {
+			Foundation::Rect region;
+			float			 pixelRatio = 1.0F;
+		};
+		std::optional<OffscreenTarget> offscreen;
+
 		// Default font atlas: bound for text quads added with atlasTexture == 0.
 		GLuint defaultFontAtlas = 0;
 		float  fontPixelRange = 4.0F;
@@ -53,13 +53,13 @@ static_assert(alignof(InstanceData) == 16, "InstanceData must be 16-byte aligned
 /// Uses RAII for automatic GPU resource cleanup - resources are freed when the handle is destroyed.
 /// Movable but not copyable (GPU resources have single ownership).
 struct InstancedMeshHandle {
-	GLVertexArray vao;			 // VAO with mesh + instance attributes configured
+	GLVertexArray vao;			 // VAO with mesh attributes; instance attributes point into
+								 // BatchRenderer's instance stream at draw time
 	GLBuffer	  meshVBO;		 // Vertex buffer for mesh data (static)
 	GLBuffer	  meshIBO;		 // Index buffer for mesh triangles
-	GLBuffer	  instanceVBO;	 // Instance data buffer (per-instance, divisor=1)
 	uint32_t	  indexCount = 0;	 // Number of indices in mesh
 	uint32_t	  vertexCount = 0;	 // Number of vertices in mesh (for stats)
-	uint32_t	  maxInstances = 0;	 // Capacity of instance buffer
+	uint32_t	  maxInstances = 0;	 // Max instances per draw call (larger counts are split)
 
 	// Default constructor - creates an invalid handle
 	InstancedMeshHandle() = default;
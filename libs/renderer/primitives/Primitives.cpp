@@ -5,6 +5,7 @@
 #include "CoordinateSystem/CoordinateSystem.h"
 #include "graphics/ClipTypes.h"
 #include "primitives/BatchRenderer.h"
+#include "resources/RenderToTexture.h"
 #include <font/FontRenderer.h>
 #include <utils/Log.h>
 #include <GL/glew.h>
@@ -16,6 +17,7 @@
 #include <numbers>
 #include <optional>
 #include <stack>
+#include <string_view>
 #include <vector>
 
 // Text rendering is implemented via the unified uber shader in BatchRenderer.
@@ -217,6 +219,10 @@ namespace Renderer::Primitives {
 
 	// --- Coordinate System Helpers ---
 
+	float getPixelRatio() {
+		return g_coordinateSystem != nullptr ? g_coordinateSystem->getPixelRatio() : 1.0F;
+	}
+
 	Foundation::Mat4 getScreenSpaceProjection() {
 		if (g_coordinateSystem != nullptr) {
 			return g_coordinateSystem->CreateScreenSpaceProjection();
@@ -401,22 +407,34 @@ namespace Renderer::Primitives {
 		// with other glyphs from the same atlas (see BatchRenderer::flush).
 		const GLuint atlasTexture = g_fontRenderer->getAtlasTexture(args.font);
 
-		// CSS text-transform: fold the case once up front so measure and emit agree.
-		std::string effective = args.text;
+		// CSS text-transform: fold the case once up front so measure and emit agree
+		// (only transformed text is copied).
+		std::string		 folded;
+		std::string_view effective = args.text;
 		if (args.transform == Foundation::TextTransform::Uppercase) {
-			for (char& c : effective) {
+			folded = args.text;
+			for (char& c : folded) {
 				c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
 			}
+			effective = folded;
 		}
 
+		// The shaped run (cached by the font renderer, keyed by the interned text)
+		// carries the measured size, so alignment needs no separate measure pass.
+		ui::RetainedGlyphRun		 run;
+		ui::FontRenderer::TextLayout layout;
+		layout.scale = args.scale;
+		layout.family = args.font;
+		layout.letterSpacing = args.letterSpacing;
+		const ui::GlyphRunView glyphs = g_fontRenderer->getGlyphRun(run, effective, layout);
+
 		// CSS text-align within the optional [position, position+box] rect. With no
-		// box, or Left/Top alignment, the origin stays at position (plain top-left)
-		// and we skip the measure entirely (it's the common case, keep it cheap).
+		// box, or Left/Top alignment, the origin stays at position (plain top-left).
 		Foundation::Vec2 origin = args.position;
 		const bool		 needsHAlign = args.boxWidth > 0.0F && args.hAlign != Foundation::HorizontalAlign::Left;
 		const bool		 needsVAlign = args.boxHeight > 0.0F && args.vAlign != Foundation::VerticalAlign::Top;
 		if (needsHAlign || needsVAlign) {
-			const glm::vec2 m = g_fontRenderer->MeasureText(effective, args.scale, args.font, args.letterSpacing);
+			const glm::vec2 m = glyphs.size;
 			if (needsHAlign) {
 				origin.x += (args.hAlign == Foundation::HorizontalAlign::Center) ? (args.boxWidth - m.x) * 0.5F : (args.boxWidth - m.x);
 			}
@@ -429,17 +447,13 @@ namespace Renderer::Primitives {
 		// and the main text so text-shadow is a single inline property, not a
 		// caller-side double draw).
 		const auto emit = [&](Foundation::Vec2 pos, const Foundation::Color& col) {
-			std::vector<ui::FontRenderer::GlyphQuad> quads;
-			g_fontRenderer->generateGlyphQuads(
-				effective, glm::vec2(pos.x, pos.y), args.scale, glm::vec4(col.r, col.g, col.b, col.a), quads, args.font,
-				args.letterSpacing);
-			for (const auto& quad : quads) {
+			for (const auto& quad : glyphs.quads) {
 				g_batchRenderer->addTextQuad(
-					Foundation::Vec2(quad.position.x, quad.position.y),
+					Foundation::Vec2(pos.x + quad.position.x, pos.y + quad.position.y),
 					Foundation::Vec2(quad.size.x, quad.size.y),
 					Foundation::Vec2(quad.uvMin.x, quad.uvMin.y),
 					Foundation::Vec2(quad.uvMax.x, quad.uvMax.y),
-					Foundation::Color(quad.color.r, quad.color.g, quad.color.b, quad.color.a),
+					col,
 					atlasTexture,
 					static_cast<float>(args.zIndex));
 			}
@@ -679,6 +693,41 @@ namespace Renderer::Primitives {
 		return g_currentTransform;
 	}
 
+	// --- Images and Offscreen Targets ---
+
+	void drawImage(const ImageArgs& args) {
+		if (g_batchRenderer == nullptr) {
+			return;
+		}
+		g_batchRenderer->addImageQuad(args.bounds, args.texture, args.tint, args.zIndex);
+	}
+
+	void beginOffscreen(RenderToTexture& target, const Foundation::Rect& region) {
+		if (g_batchRenderer == nullptr || region.width <= 0.0F || region.height <= 0.0F) {
+			return;
+		}
+		// Geometry batched so far belongs to the current target
+		g_batchRenderer->flush();
+		target.begin();
+
+		GLfloat clearColor[4];
+		glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+		glClearColor(0.0F, 0.0F, 0.0F, 0.0F);
+		glClear(GL_COLOR_BUFFER_BIT);
+		glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+
+		g_batchRenderer->beginOffscreen(region, static_cast<float>(target.width()) / region.width);
+	}
+
+	void endOffscreen(RenderToTexture& target) {
+		if (g_batchRenderer == nullptr) {
+			return;
+		}
+		g_batchRenderer->flush();
+		g_batchRenderer->endOffscreen();
+		target.end();
+	}
+
 	// --- Statistics ---
 
 	RenderStats getStats() {
@@ -689,6 +738,8 @@ namespace Renderer::Primitives {
 			stats.drawCalls = batchStats.drawCalls;
 			stats.vertexCount = batchStats.vertexCount;
 			stats.triangleCount = batchStats.triangleCount;
+			stats.uploadBytes = batchStats.uploadBytes;
+			stats.uploadStalls = batchStats.uploadStalls;
 		}
 
 		return stats;
@@ -28,6 +28,7 @@ namespace Renderer { // NOLINT(readability-identifier-naming)
 	class Renderer;
 	class CoordinateSystem;
 	class BatchRenderer;
+	class RenderToTexture;
 
 } // namespace Renderer
 
@@ -130,6 +131,9 @@ namespace Renderer {
 
 		// --- Coordinate System Helpers ---
 
+		// Physical pixels per logical pixel (1 without a coordinate system)
+		float getPixelRatio();
+
 		// Get screen-space projection matrix (requires SetCoordinateSystem)
 		Foundation::Mat4 getScreenSpaceProjection();
 
@@ -245,6 +249,29 @@ namespace Renderer {
 		//   - zIndex: Draw order (higher values drawn later, allows proper layering with shapes)
 		void drawText(const TextArgs& args);
 
+		// Arguments for DrawImage
+		struct ImageArgs {
+			Foundation::Rect  bounds;
+			unsigned int	  texture = 0; // GL texture holding premultiplied RGBA (e.g. RenderToTexture::texture())
+			Foundation::Color tint = Foundation::Color(1.0F, 1.0F, 1.0F, 1.0F);
+			const char*		  id = nullptr;
+			float			  zIndex = 0.0F;
+		};
+
+		// Draw a whole texture stretched over bounds, batched with shapes and text.
+		// Meant for targets rendered with BeginOffscreen (e.g. cached UI layers).
+		void drawImage(const ImageArgs& args);
+
+		// --- Offscreen Rendering ---
+
+		// Render subsequent draws into `target` instead of the screen, until
+		// EndOffscreen. The target covers `region` of the logical screen (its
+		// size in physical pixels is region * pixel ratio); draws keep their
+		// usual screen coordinates. Geometry batched before the call is flushed
+		// to the current target first. Not nestable.
+		void beginOffscreen(RenderToTexture& target, const Foundation::Rect& region);
+		void endOffscreen(RenderToTexture& target);
+
 		// --- State Management ---
 
 		// === Clipping System (Shader-based, batching-friendly) ===
@@ -320,6 +347,8 @@ namespace Renderer {
 			uint32_t drawCalls = 0;
 			uint32_t vertexCount = 0;
 			uint32_t triangleCount = 0;
+			uint64_t uploadBytes = 0;  // Vertex/index/instance bytes streamed to the GPU
+			uint32_t uploadStalls = 0; // Stream fence waits that blocked on the GPU
 		};
 
 		RenderStats getStats();
@@ -1,7 +1,7 @@
 #version 330 core
 
-// Tile pass fragment shader - shades ground tiles from a per-chunk tile-data
-// texture (one RGBA32UI texel per tile, mirroring engine TileRenderData).
+// Tile pass fragment shader - shades ground tiles from per-chunk tile-data
+// textures packed from engine TileRenderData (see TileDataPacking.h).
 // Replaces the per-tile quad path that rebuilt CPU geometry every frame.
 
 #include "includes/tile.glsl"
@@ -10,12 +10,18 @@ in vec2 v_worldPos;
 
 out vec4 FragColor;
 
-// Per-chunk tile data. Texel layout matches TileRenderData (16 bytes, little-endian):
-//   r: surfaceId | edgeMask<<8 | cornerMask<<16 | hardEdgeMask<<24
-//   g: neighborN | neighborE<<8 | neighborS<<16 | neighborW<<24
-//   b: neighborNW | neighborNE<<8 | neighborSE<<16 | neighborSW<<24
-//   a: waterDepth | (padding<<8)
-uniform usampler2D u_tileData;
+// Per-chunk tile data, ~3 bytes per tile:
+//   u_tileSurfaces  RG8UI, (chunk+2)^2: r = surfaceId, g = waterDepth. Tile
+//                   (x, y) is texel (x+1, y+1); the one-texel apron holds the
+//                   surfaces of the adjacent chunks' edge tiles, so all 8
+//                   neighbors are plain fetches.
+//   u_tileMasks     R8UI, chunk^2: edgeMask | cornerMask<<4
+// hardEdgeMask is not stored: it is set wherever a neighbor's surface family
+// differs from this tile's (TileAdjacency::getHardEdgeMaskByFamily).
+uniform usampler2D u_tileSurfaces;
+uniform usampler2D u_tileMasks;
+// SurfaceFamily per surface id (6-bit ids), set once by ChunkRenderer
+uniform int u_surfaceFamily[64];
 uniform vec2 u_chunkOrigin;      // chunk origin in world meters
 uniform ivec2 u_chunkTileOrigin; // chunk origin in world tile coordinates
 
@@ -51,27 +57,29 @@ void main() {
 	// World position -> tile within this chunk. Tiles are 1m, so the intra-tile
 	// UV is just the fractional part (y=0 at the tile's north edge).
 	vec2 local = v_worldPos - u_chunkOrigin;
-	ivec2 tileCoord = clamp(ivec2(floor(local)), ivec2(0), textureSize(u_tileData, 0) - 1);
+	ivec2 tileCoord = clamp(ivec2(floor(local)), ivec2(0), textureSize(u_tileMasks, 0) - 1);
 	vec2 uv = clamp(local - vec2(tileCoord), 0.0, 1.0);
 
-	uvec4 data = texelFetch(u_tileData, tileCoord, 0);
-	uint surfaceId    =  data.r         & 0xFFu;
-	uint edgeMask     = (data.r >> 8u)  & 0xFFu;
-	uint cornerMask   = (data.r >> 16u) & 0xFFu;
-	uint hardEdgeMask = (data.r >> 24u) & 0xFFu;
-	uint neighborN    =  data.g         & 0xFFu;
-	uint neighborE    = (data.g >> 8u)  & 0xFFu;
-	uint neighborS    = (data.g >> 16u) & 0xFFu;
-	uint neighborW    = (data.g >> 24u) & 0xFFu;
-	uint neighborNW   =  data.b         & 0xFFu;
-	uint neighborNE   = (data.b >> 8u)  & 0xFFu;
-	uint neighborSE   = (data.b >> 16u) & 0xFFu;
-	uint neighborSW   = (data.b >> 24u) & 0xFFu;
-	uint waterDepth   =  data.a         & 0xFFu;
+	ivec2 s = tileCoord + ivec2(1); // surface plane has a one-texel apron
+	uvec2 center      = texelFetch(u_tileSurfaces, s, 0).rg;
+	uint surfaceId    = center.r;
+	uint waterDepth   = center.g;
+	uint neighborN    = texelFetch(u_tileSurfaces, s + ivec2( 0, -1), 0).r;
+	uint neighborE    = texelFetch(u_tileSurfaces, s + ivec2( 1,  0), 0).r;
+	uint neighborS    = texelFetch(u_tileSurfaces, s + ivec2( 0,  1), 0).r;
+	uint neighborW    = texelFetch(u_tileSurfaces, s + ivec2(-1,  0), 0).r;
+	uint neighborNW   = texelFetch(u_tileSurfaces, s + ivec2(-1, -1), 0).r;
+	uint neighborNE   = texelFetch(u_tileSurfaces, s + ivec2( 1, -1), 0).r;
+	uint neighborSE   = texelFetch(u_tileSurfaces, s + ivec2( 1,  1), 0).r;
+	uint neighborSW   = texelFetch(u_tileSurfaces, s + ivec2(-1,  1), 0).r;
+	uint masks        = texelFetch(u_tileMasks, tileCoord, 0).r;
+	uint edgeMask     = masks & 0x0Fu;
+	uint cornerMask   = masks >> 4u;
 
 	// PERF: Early-out for INTERIOR TILES (no edge transitions at all).
-	// A tile is truly interior only if ALL 8 neighbors have the same surface.
-	bool isInteriorTile = (edgeMask == 0u && cornerMask == 0u && hardEdgeMask == 0u &&
+	// A tile is truly interior only if ALL 8 neighbors have the same surface
+	// (which also rules out hard edges).
+	bool isInteriorTile = (edgeMask == 0u && cornerMask == 0u &&
 		neighborN == surfaceId && neighborE == surfaceId &&
 		neighborS == surfaceId && neighborW == surfaceId &&
 		neighborNW == surfaceId && neighborNE == surfaceId &&
@@ -85,6 +93,18 @@ void main() {
 		return;
 	}
 
+	// Hard edges: bit per Direction (NW=0, W, SW, S, SE, E, NE, N=7)
+	int family = u_surfaceFamily[int(surfaceId & 63u)];
+	uint hardEdgeMask =
+		(u_surfaceFamily[int(neighborNW & 63u)] != family ? 0x01u : 0u) |
+		(u_surfaceFamily[int(neighborW & 63u)] != family ? 0x02u : 0u) |
+		(u_surfaceFamily[int(neighborSW & 63u)] != family ? 0x04u : 0u) |
+		(u_surfaceFamily[int(neighborS & 63u)] != family ? 0x08u : 0u) |
+		(u_surfaceFamily[int(neighborSE & 63u)] != family ? 0x10u : 0u) |
+		(u_surfaceFamily[int(neighborE & 63u)] != family ? 0x20u : 0u) |
+		(u_surfaceFamily[int(neighborNE & 63u)] != family ? 0x40u : 0u) |
+		(u_surfaceFamily[int(neighborN & 63u)] != family ? 0x80u : 0u);
+
 	int tileX = u_chunkTileOrigin.x + tileCoord.x;
 	int tileY = u_chunkTileOrigin.y + tileCoord.y;
 
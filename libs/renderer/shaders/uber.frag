@@ -12,7 +12,8 @@ in vec4 v_clipBounds;  // Clip rect (minX, minY, maxX, maxY) or (0,0,0,0) for no
 
 out vec4 FragColor;
 
-// MSDF font atlas texture (bound once per frame, ignored for shapes)
+// Texture of the current draw run: the MSDF font atlas for text, or the
+// cached image for image quads (ignored for shapes)
 uniform sampler2D u_atlas;
 
 // Global alpha for baked entity meshes (far-zoom impostor cross-fade).
@@ -24,6 +25,10 @@ uniform float u_bakedAlpha;
 uniform float u_viewportHeight;
 // Pixel ratio for DPI scaling (physical pixels / logical pixels)
 uniform float u_pixelRatio;
+// Logical position of the render target's top-left corner. Zero on screen;
+// the target region's origin while rendering offscreen (clip bounds are in
+// screen coordinates, the target's gl_FragCoord starts at its own corner).
+uniform vec2 u_clipOrigin;
 
 // ============================================================================
 // SHAPE SDF FUNCTIONS (from primitive.frag)
@@ -64,6 +69,7 @@ float screenPxRange(float pixelRange) {
 const float kRenderModeText = -1.0;      // MSDF text rendering
 const float kRenderModeInstanced = -2.0; // Simple solid color (instanced entities)
 const float kRenderModeShadow = -3.0;    // Box-shadow / glow (SDF soft falloff)
+const float kRenderModeImage = -4.0;     // Cached premultiplied RGBA texture
 
 // ============================================================================
 // MAIN - Branch on render mode
@@ -74,6 +80,8 @@ void main() {
 	// - Shapes:    v_data2.w >= 0 (borderPosition: 0=Inside, 1=Center, 2=Outside)
 	// - Text:      v_data2.w == -1.0
 	// - Instanced: v_data2.w == -2.0
+	// - Shadow:    v_data2.w == -3.0
+	// - Image:     v_data2.w == -4.0
 
 	// ========== INSTANCED ENTITY RENDERING (simple solid color) ==========
 	// Exactly mode -2 (shadow is -3 and falls through to the clipped branch below).
@@ -89,7 +97,7 @@ void main() {
 	// A clipBounds of (0,0,0,0) means no clipping (maxX <= minX check detects this)
 	if (v_clipBounds.z > v_clipBounds.x) {
 		// Scale clip bounds from logical pixels to physical pixels for gl_FragCoord comparison
-		vec4 physicalClipBounds = v_clipBounds * u_pixelRatio;
+		vec4 physicalClipBounds = (v_clipBounds - u_clipOrigin.xyxy) * u_pixelRatio;
 
 		// Convert gl_FragCoord.y from OpenGL coordinates (bottom-left origin, physical pixels)
 		// to UI coordinates (top-left origin, physical pixels)
@@ -173,6 +181,18 @@ void main() {
 		// Apply shape boundary alpha
 		FragColor = vec4(finalColor, shapeAlpha * finalAlpha);
 
+	} else if (v_data2.w < -3.5) {
+		// ========== IMAGE (cached render target) ==========
+		// v_texCoord = UV into the bound texture
+		// v_color    = tint (multiplied in, straight alpha)
+		// Texels are premultiplied: offscreen passes accumulate coverage into
+		// alpha. Un-premultiply for the straight-alpha blend every draw uses.
+		vec4 texel = texture(u_atlas, v_texCoord);
+		if (texel.a < 0.001) {
+			discard;
+		}
+		FragColor = vec4(texel.rgb / texel.a, texel.a) * v_color;
+
 	} else if (v_data2.w < -2.5) {
 		// ========== BOX-SHADOW / GLOW (SDF soft falloff) ==========
 		// v_texCoord = rectLocalPos (SDF coords from the shadow-shape center)
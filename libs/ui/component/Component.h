@@ -185,7 +185,12 @@ namespace UI {
 		float getHeight() const override { return size.y + margin * 2.0F; }
 
 		/// Set position (layout containers call this)
-		void setPosition(float x, float y) override { position = {x, y}; }
+		void setPosition(float x, float y) override {
+			if (position.x != x || position.y != y) {
+				position = {x, y};
+				invalidate();
+			}
+		}
 
 		/// Helper: get content position (position + margin) for rendering
 		[[nodiscard]] Foundation::Vec2 getContentPosition() const { return {position.x + margin, position.y + margin}; }
@@ -206,6 +211,7 @@ namespace UI {
 			auto* ptr = arena.allocate<std::decay_t<T>>(std::forward<T>(child));
 			children.push_back(ptr);
 			childrenNeedSorting = true;
+			invalidate();
 
 			uint16_t index = static_cast<uint16_t>(children.size() - 1);
 			return LayerHandle::make(index, generation);
@@ -251,6 +257,7 @@ namespace UI {
 
 		void layout(const Foundation::Rect& newBounds) override {
 			bounds = newBounds;
+			invalidate();
 			for (auto* child : children) {
 				if (auto* layer = dynamic_cast<ILayer*>(child)) {
 					layer->layout(newBounds);
@@ -277,7 +284,44 @@ namespace UI {
 		}
 
 		// Mark children for re-sort (call when a child's zIndex changes)
-		void markChildrenNeedSorting() { childrenNeedSorting = true; }
+		void markChildrenNeedSorting() {
+			childrenNeedSorting = true;
+			invalidate();
+		}
+
+		// ========== Render Invalidation ==========
+		// Cached layers (see LayerCache) keep a subtree's last rendered output and
+		// only re-render it when something in it changed. Components call
+		// invalidate() when their appearance changes outside of render(); the
+		// flag is read through the whole subtree, so a change anywhere below a
+		// cached root reaches it.
+
+		/// Mark this component's rendered output stale
+		void invalidate() { renderDirty = true; }
+
+		/// True if this component or any Component below it was invalidated since clearRenderDirty()
+		[[nodiscard]] bool isRenderDirty() const {
+			if (renderDirty) {
+				return true;
+			}
+			for (const auto* child : children) {
+				const auto* component = dynamic_cast<const Component*>(child);
+				if (component != nullptr && component->isRenderDirty()) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// Clear the invalidation flag of this component and its Component subtree
+		void clearRenderDirty() {
+			renderDirty = false;
+			for (auto* child : children) {
+				if (auto* component = dynamic_cast<Component*>(child)) {
+					component->clearRenderDirty();
+				}
+			}
+		}
 
 		// Read-only access to children for inspection; mutations must go through container APIs.
 		[[nodiscard]] const std::vector<IComponent*>& getChildren() const { return children; }
@@ -290,6 +334,7 @@ namespace UI {
 			arena.clear();
 			generation++; // Invalidate all existing handles
 			childrenNeedSorting = false;
+			invalidate();
 		}
 
 		/// Dispatch an event to children in z-order (highest first).
@@ -331,6 +376,7 @@ namespace UI {
 		Foundation::Rect		 bounds;
 		uint16_t				 generation{0};
 		bool					 childrenNeedSorting{false};
+		bool					 renderDirty{true}; // never rendered yet
 	};
 
 } // namespace UI
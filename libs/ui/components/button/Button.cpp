@@ -105,12 +105,15 @@ namespace UI {
 	}
 
 	void Button::setPosition(float x, float y) {
-		position = {x, y};
+		Component::setPosition(x, y);
 		updateIconPosition();
 	}
 
 	void Button::setLabel(const std::string& newLabel) {
-		label = newLabel;
+		if (label != newLabel) {
+			label = newLabel;
+			invalidate();
+		}
 		updateIconPosition();
 	}
 
@@ -223,7 +226,7 @@ namespace UI {
 		switch (event.type) {
 			case InputEvent::Type::MouseDown:
 				if (containsPoint(event.position) && event.button == engine::MouseButton::Left) {
-					state = State::Pressed;
+					setState(State::Pressed);
 					mouseDown = true;
 					event.consume();
 					return true;
@@ -236,9 +239,9 @@ namespace UI {
 						if (onClick) {
 							onClick();
 						}
-						state = State::Hover;
+						setState(State::Hover);
 					} else {
-						state = State::Normal;
+						setState(State::Normal);
 					}
 					mouseDown = false;
 					event.consume();
@@ -249,7 +252,7 @@ namespace UI {
 			case InputEvent::Type::MouseMove:
 				mouseOver = containsPoint(event.position);
 				if (!mouseDown) {
-					state = mouseOver ? State::Hover : State::Normal;
+					setState(mouseOver ? State::Hover : State::Normal);
 				}
 				break;
 
@@ -261,9 +264,16 @@ namespace UI {
 
 	// IFocusable interface implementation
 
-	void Button::onFocusGained() { focused = true; }
+	void Button::setState(State newState) {
+		if (state != newState) {
+			state = newState;
+			invalidate();
+		}
+	}
+
+	void Button::onFocusGained() { setFocused(true); }
 
-	void Button::onFocusLost() { focused = false; }
+	void Button::onFocusLost() { setFocused(false); }
 
 	void Button::handleKeyInput(engine::Key key, bool /*shift*/, bool /*ctrl*/, bool /*alt*/) {
 		if (disabled) {
@@ -96,8 +96,18 @@ class Button : public Component, public FocusableBase<Button> {
 	[[nodiscard]] const std::string& renderedLabel() const { return label; }
 
 	// State management
-	void setFocused(bool newFocused) { focused = newFocused; }
-	void setDisabled(bool newDisabled) { disabled = newDisabled; }
+	void setFocused(bool newFocused) {
+		if (focused != newFocused) {
+			focused = newFocused;
+			invalidate();
+		}
+	}
+	void setDisabled(bool newDisabled) {
+		if (disabled != newDisabled) {
+			disabled = newDisabled;
+			invalidate();
+		}
+	}
 	bool isFocused() const { return focused; }
 	bool isDisabled() const { return disabled; }
 
@@ -124,6 +134,9 @@ class Button : public Component, public FocusableBase<Button> {
 	float				  iconSize{16.0F};
 
 	void updateIconPosition();
+
+	// Change the interaction state, invalidating the cached render on change
+	void setState(State newState);
 };
 
 } // namespace UI
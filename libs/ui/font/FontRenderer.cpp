@@ -290,59 +290,23 @@ namespace ui {
 		return true;
 	}
 
-	void FontRenderer::generateGlyphQuads(
-		const std::string&		text,
-		const glm::vec2&		position,
-		float					scale,
-		const glm::vec4&		color,
-		std::vector<GlyphQuad>& outQuads,
-		Renderer::FontFamily	family,
-		float					letterSpacing
+	float FontRenderer::shapeLine(
+		std::string_view		   text,
+		const Atlas&			   atlas,
+		float					   fontSize,
+		float					   letterSpacing,
+		glm::vec2				   origin,
+		std::vector<GlyphRunQuad>& out
 	) const {
-		const Atlas&					atlas = atlasFor(family);
 		const std::map<char, SDFGlyph>& sdfGlyphs = atlas.glyphs;
 
-		// Try cache lookup if enabled
-		if (FontRendererConfig::kEnableGlyphQuadCache) {
-			CacheKey key{family, text, scale, letterSpacing};
-			auto	 it = glyphQuadCache.find(key);
-
-			if (it != glyphQuadCache.end()) {
-				// Cache hit! Copy quads and adjust position/color
-				const std::vector<GlyphQuad>& cachedQuads = it->second.quads;
-
-				// Update LRU tracking
-				it->second.lastAccessFrame = currentFrame;
-
-				// Copy quads with position/color adjustment
-				outQuads.reserve(outQuads.size() + cachedQuads.size());
-				for (const auto& cachedQuad : cachedQuads) {
-					GlyphQuad quad = cachedQuad;
-					// Adjust position (cached quads are relative to origin)
-					quad.position += position;
-					// Update color (cached quads have color from first render)
-					quad.color = color;
-					outQuads.push_back(quad);
-				}
-
-				return; // Cache hit, done!
-			}
-		}
-
-		// Cache miss or caching disabled - generate quads
-		size_t startIdx = outQuads.size(); // Track where we started adding
-
 		// Calculate baseline position
 		// IMPORTANT: fontSize should be the REQUESTED rendering size, not atlas glyph size!
 		// The atlas may be generated at higher resolution (e.g., 32px) for quality,
 		// but scale=1.0 should render at BASE_FONT_SIZE (16px), not glyphSize (32px).
 		// The glyph metrics are in EM units, so we scale by the requested pixel size.
-		constexpr float BASE_FONT_SIZE = 16.0F; // scale=1.0 renders at this size
-		float			fontSize = BASE_FONT_SIZE * scale; // Requested rendering size in pixels
-		float			ascenderAtCurrentScale = atlas.metadata.ascender * fontSize;
-
-		glm::vec2 penPosition = glm::vec2(0, 0); // Generate relative to origin for caching
-		penPosition.y += ascenderAtCurrentScale; // Move to baseline
+		glm::vec2 penPosition = origin;
+		penPosition.y += atlas.metadata.ascender * fontSize; // Move to baseline
 
 		for (size_t charIdx = 0; charIdx < text.size(); ++charIdx) {
 			char			currentChar = text[charIdx];
@@ -374,18 +338,10 @@ namespace ui {
 				float w = (glyph.planeBoundsMax.x - glyph.planeBoundsMin.x) * fontSize;
 				float h = (glyph.planeBoundsMax.y - glyph.planeBoundsMin.y) * fontSize;
 
-				// Create glyph quad
 				// Use atlasBounds (actual glyph content) instead of atlas (full cell)
 				// Reference: https://github.com/Chlumsky/msdf-atlas-gen/issues/2
 				// This ensures we only sample the actual glyph pixels, not the empty padding
-				GlyphQuad quad{};
-				quad.position = glm::vec2(xpos, ypos);
-				quad.size = glm::vec2(w, h);
-				quad.uvMin = glyph.atlasBoundsMin;
-				quad.uvMax = glyph.atlasBoundsMax;
-				quad.color = color;
-
-				outQuads.push_back(quad);
+				out.push_back(GlyphRunQuad{glm::vec2(xpos, ypos), glm::vec2(w, h), glyph.atlasBoundsMin, glyph.atlasBoundsMax});
 			}
 
 			// Advance pen position; letter-spacing sits between glyphs, not after
@@ -396,48 +352,109 @@ namespace ui {
 			}
 		}
 
-		// Cache the generated quads if enabled
-		if (FontRendererConfig::kEnableGlyphQuadCache) {
-			// Check if cache is full and needs eviction
-			if (glyphQuadCache.size() >= FontRendererConfig::kMaxGlyphQuadCacheEntries) {
-				// Find and evict the LRU entry
-				auto oldestIt = glyphQuadCache.begin();
-				for (auto it = glyphQuadCache.begin(); it != glyphQuadCache.end(); ++it) {
-					if (it->second.lastAccessFrame < oldestIt->second.lastAccessFrame) {
-						oldestIt = it;
-					}
+		return penPosition.x - origin.x;
+	}
+
+	glm::vec2 FontRenderer::shapeRun(std::string_view text, const TextLayout& layout, std::vector<GlyphRunQuad>& out) const {
+		const Atlas&	atlas = atlasFor(layout.family);
+		constexpr float BASE_FONT_SIZE = 16.0F; // scale=1.0 renders at this size
+		const float		fontSize = BASE_FONT_SIZE * layout.scale;
+
+		if (layout.wrapWidth <= 0.0F) {
+			const float width = shapeLine(text, atlas, fontSize, layout.letterSpacing, glm::vec2(0.0F, 0.0F), out);
+			return glm::vec2(width, atlas.metadata.lineHeight * fontSize);
+		}
+
+		// Wrapped: lay the lines out top to bottom, each aligned within wrapWidth
+		const WrappedTextResult& wrapped = wrapText(std::string(text), layout.scale, layout.wrapWidth, layout.family);
+		float					 lineY = 0.0F;
+		for (size_t lineIdx = 0; lineIdx < wrapped.lines.size(); ++lineIdx) {
+			const std::string& line = wrapped.lines[lineIdx];
+			if (!line.empty()) {
+				float lineX = 0.0F;
+				switch (layout.hAlign) {
+					case Foundation::HorizontalAlign::Center:
+						lineX = (layout.wrapWidth - wrapped.lineWidths[lineIdx]) * 0.5F;
+						break;
+					case Foundation::HorizontalAlign::Right:
+						lineX = layout.wrapWidth - wrapped.lineWidths[lineIdx];
+						break;
+					case Foundation::HorizontalAlign::Left:
+					default:
+						break;
 				}
-				glyphQuadCache.erase(oldestIt);
+				shapeLine(line, atlas, fontSize, layout.letterSpacing, glm::vec2(lineX, lineY), out);
 			}
+			lineY += wrapped.lineHeight;
+		}
+		return glm::vec2(wrapped.totalWidth, wrapped.totalHeight);
+	}
 
-			// Cache the generated quads (relative to origin, before position adjustment)
-			CacheEntry entry;
-			entry.lastAccessFrame = currentFrame;
-			entry.quads.reserve(outQuads.size() - startIdx);
-			for (size_t i = startIdx; i < outQuads.size(); ++i) {
-				entry.quads.push_back(outQuads[i]);
+	GlyphRunView FontRenderer::getGlyphRun(RetainedGlyphRun& run, std::string_view text, const TextLayout& layout) const {
+		// Quantized layout key (the text handle is filled in below)
+		GlyphRunKey key;
+		key.scale = GlyphRunKey::quantizeScale(layout.scale);
+		key.letterSpacing = GlyphRunKey::quantizeScale(layout.letterSpacing);
+		key.wrapWidth = GlyphRunKey::quantizeWidth(layout.wrapWidth);
+		key.family = static_cast<uint8_t>(layout.family);
+		key.hAlign = key.wrapWidth > 0 ? static_cast<uint8_t>(layout.hAlign) : 0; // single lines align at emit
+
+		GlyphRunView view;
+
+		// Retained fast path: same layout and same text as last time (compare, don't hash)
+		key.text = run.key.text;
+		if (key == run.key) {
+			const std::string* interned = textInterner.lookup(run.key.text);
+			if (interned != nullptr && *interned == text && glyphRunCache.resolve(run, currentFrame, view)) {
+				return view;
 			}
+		}
 
-			CacheKey key{family, text, scale, letterSpacing};
-			glyphQuadCache[key] = std::move(entry);
+		key.text = textInterner.intern(text, currentFrame);
+		if (FontRendererConfig::kEnableGlyphQuadCache && glyphRunCache.find(key, currentFrame, run, view)) {
+			return view;
+		}
 
-			// Now adjust positions in outQuads for the caller
-			for (size_t i = startIdx; i < outQuads.size(); ++i) {
-				outQuads[i].position += position;
-			}
-		} else {
-			// No caching - just adjust positions
-			for (size_t i = startIdx; i < outQuads.size(); ++i) {
-				outQuads[i].position += position;
-			}
+		// Cache miss - shape the run (quads relative to origin, before position/color)
+		shapeScratch.clear();
+		const glm::vec2 size = shapeRun(text, layout, shapeScratch);
+		if (!FontRendererConfig::kEnableGlyphQuadCache) {
+			return GlyphRunView{shapeScratch, size};
+		}
+		return glyphRunCache.insert(key, shapeScratch, size, currentFrame, textInterner, run);
+	}
+
+	void FontRenderer::generateGlyphQuads(
+		const std::string&		text,
+		const glm::vec2&		position,
+		float					scale,
+		const glm::vec4&		color,
+		std::vector<GlyphQuad>& outQuads,
+		Renderer::FontFamily	family,
+		float					letterSpacing
+	) const {
+		// Immediate-mode callers hold no retained run; the run cache still serves
+		// them after one hash of the text (interning)
+		RetainedGlyphRun   run;
+		const GlyphRunView view = getGlyphRun(run, text, TextLayout{scale, family, letterSpacing});
+
+		// Cached quads are relative to origin and colorless; place and color them
+		outQuads.reserve(outQuads.size() + view.quads.size());
+		for (const auto& quad : view.quads) {
+			outQuads.push_back(GlyphQuad{quad.position + position, quad.size, quad.uvMin, quad.uvMax, color});
 		}
 	}
 
 	const FontRenderer::WrappedTextResult&
 	FontRenderer::wrapText(const std::string& text, float scale, float maxWidth, Renderer::FontFamily family) const {
 		// Check cache first
-		WrapCacheKey key{family, text, scale, maxWidth};
-		auto		 cacheIt = wrappedTextCache.find(key);
+		WrapCacheKey key{
+			textInterner.intern(text, currentFrame),
+			GlyphRunKey::quantizeScale(scale),
+			GlyphRunKey::quantizeWidth(maxWidth),
+			static_cast<uint8_t>(family)
+		};
+		auto cacheIt = wrappedTextCache.find(key);
 		if (cacheIt != wrappedTextCache.end()) {
 			cacheIt->second.lastAccessFrame = currentFrame;
 			return cacheIt->second.result;
@@ -457,10 +474,7 @@ namespace ui {
 			result.totalWidth = 0.0F;
 			result.totalHeight = result.lineHeight;
 
-			// Cache and return
-			WrapCacheEntry entry{result, currentFrame};
-			wrappedTextCache[key] = std::move(entry);
-			return wrappedTextCache[key].result;
+			return cacheWrapResult(key, std::move(result));
 		}
 
 		// No wrapping case (maxWidth <= 0)
@@ -471,10 +485,7 @@ namespace ui {
 			result.totalWidth = size.x;
 			result.totalHeight = size.y;
 
-			// Cache and return
-			WrapCacheEntry entry{result, currentFrame};
-			wrappedTextCache[key] = std::move(entry);
-			return wrappedTextCache[key].result;
+			return cacheWrapResult(key, std::move(result));
 		}
 
 		// Word-based wrapping algorithm
@@ -546,21 +557,26 @@ namespace ui {
 		}
 		result.totalHeight = static_cast<float>(result.lines.size()) * result.lineHeight;
 
+		return cacheWrapResult(key, std::move(result));
+	}
+
+	const FontRenderer::WrappedTextResult& FontRenderer::cacheWrapResult(const WrapCacheKey& key, WrappedTextResult&& result) const {
 		// Evict oldest entry if cache is full
-		if (wrappedTextCache.size() >= FontRendererConfig::kMaxGlyphQuadCacheEntries) {
+		if (wrappedTextCache.size() >= FontRendererConfig::kMaxWrapCacheEntries) {
 			auto oldestIt = wrappedTextCache.begin();
 			for (auto it = wrappedTextCache.begin(); it != wrappedTextCache.end(); ++it) {
 				if (it->second.lastAccessFrame < oldestIt->second.lastAccessFrame) {
 					oldestIt = it;
 				}
 			}
+			textInterner.release(oldestIt->first.text);
 			wrappedTextCache.erase(oldestIt);
 		}
 
 		// Cache and return
-		WrapCacheEntry entry{result, currentFrame};
-		wrappedTextCache[key] = std::move(entry);
-		return wrappedTextCache[key].result;
+		textInterner.addRef(key.text);
+		auto [it, _] = wrappedTextCache.insert_or_assign(key, WrapCacheEntry{std::move(result), currentFrame});
+		return it->second.result;
 	}
 
 	glm::vec2 FontRenderer::measureTextWithWrapping(const std::string& text, float scale, float maxWidth, Renderer::FontFamily family)
@@ -574,65 +590,29 @@ namespace ui {
 		return glm::vec2(wrapped.totalWidth, wrapped.totalHeight);
 	}
 
-	void FontRenderer::generateWrappedGlyphQuads(
-		const std::vector<std::string>& lines,
-		const glm::vec2&				position,
-		float							scale,
-		const glm::vec4&				color,
-		float							lineHeight,
-		Foundation::HorizontalAlign		hAlign,
-		float							containerWidth,
-		std::vector<GlyphQuad>&			outQuads,
-		Renderer::FontFamily			family
-	) const {
-		float currentY = position.y;
-
-		for (size_t lineIdx = 0; lineIdx < lines.size(); ++lineIdx) {
-			const std::string& line = lines[lineIdx];
-
-			// Calculate X offset for alignment
-			float lineX = position.x;
-			if (containerWidth > 0.0F && !line.empty()) {
-				glm::vec2 lineSize = MeasureText(line, scale, family);
-				switch (hAlign) {
-					case Foundation::HorizontalAlign::Center:
-						lineX += (containerWidth - lineSize.x) * 0.5F;
-						break;
-					case Foundation::HorizontalAlign::Right:
-						lineX += containerWidth - lineSize.x;
-						break;
-					case Foundation::HorizontalAlign::Left:
-					default:
-						// No offset
-						break;
-				}
-			}
-
-			// Generate quads for this line
-			if (!line.empty()) {
-				generateGlyphQuads(line, glm::vec2(lineX, currentY), scale, color, outQuads, family);
-			}
-
-			currentY += lineHeight;
-		}
-	}
-
 	GLuint FontRenderer::getAtlasTexture(Renderer::FontFamily family) const {
 		return atlasFor(family).texture;
 	}
 
 	void FontRenderer::updateFrame() {
 		currentFrame++;
+
+		// Between frames no run views are outstanding, so the arena may evict and compact
+		glyphRunCache.trim(currentFrame, textInterner);
+		if (currentFrame % FontRendererConfig::kInternSweepFrames == 0) {
+			textInterner.sweep(currentFrame, FontRendererConfig::kInternSweepFrames);
+		}
 	}
 
 	void FontRenderer::clearGlyphQuadCache() {
-		glyphQuadCache.clear();
+		glyphRunCache.clear(textInterner);
 		wrappedTextCache.clear();
-		LOG_DEBUG(UI, "Cleared glyph quad cache and wrapped text cache");
+		textInterner.clear();
+		LOG_DEBUG(UI, "Cleared glyph run cache and wrapped text cache");
 	}
 
 	size_t FontRenderer::getGlyphQuadCacheSize() const {
-		return glyphQuadCache.size();
+		return glyphRunCache.runCount();
 	}
 
 } // namespace ui
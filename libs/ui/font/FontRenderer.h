@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "font/GlyphRunCache.h"
 #include "graphics/PrimitiveStyles.h"
 #include "primitives/FontFamily.h"
 #include "shader/Shader.h"
@@ -11,6 +12,7 @@
 #include <array>
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -20,10 +22,16 @@ namespace ui {
 	 * Configuration constants for FontRenderer performance tuning
 	 */
 	namespace FontRendererConfig {
-		// Glyph quad cache settings
-		// Size to handle complex UIs: ~1000 unique strings × ~4 scales = 4000 entries
-		// Memory cost: ~6-8MB max (1.5KB average per entry)
-		constexpr size_t kMaxGlyphQuadCacheEntries = 4096;
+		// Glyph run arena budget. Runs are ~32 bytes per visible glyph, so 1MB holds
+		// ~32k glyphs: several screens of distinct labels at a few sizes each.
+		constexpr size_t kGlyphRunCacheBudgetBytes = 1024 * 1024;
+
+		// Wrapped-layout cache entries (line lists are small; bounded by count)
+		constexpr size_t kMaxWrapCacheEntries = 4096;
+
+		// Interned strings no cached run references are freed after this many
+		// unused frames (per-frame strings like FPS counters come and go)
+		constexpr uint64_t kInternSweepFrames = 300;
 
 		// Runtime toggle for cache (disable for testing/comparison)
 		constexpr bool kEnableGlyphQuadCache = true;
@@ -101,6 +109,27 @@ namespace ui {
 			float					 lineHeight;  // Height per line in pixels
 		};
 
+		/**
+		 * Layout inputs of a glyph run
+		 */
+		struct TextLayout {
+			float						scale = 1.0F;
+			Renderer::FontFamily		family = Renderer::FontFamily::Roboto;
+			float						letterSpacing = 0.0F;
+			float						wrapWidth = 0.0F; // 0 = single line; else word-wrapped (see wrapText)
+			Foundation::HorizontalAlign hAlign = Foundation::HorizontalAlign::Left; // per line, within wrapWidth
+		};
+
+		/**
+		 * Get the shaped glyph run for text (quads relative to the top-left origin,
+		 * no color) plus its laid-out size. `run` is the caller's retained handle:
+		 * while the text and layout are unchanged and the run is still cached, the
+		 * lookup is a slot check plus a string compare (no hashing, no shaping).
+		 * Otherwise the text is interned (hashed once) and the run found or shaped.
+		 * @return View valid until the next glyph-run or glyph-quad call
+		 */
+		GlyphRunView getGlyphRun(RetainedGlyphRun& run, std::string_view text, const TextLayout& layout) const;
+
 		/**
 		 * Generate glyph quads for batched rendering (does not render immediately)
 		 * @param text The string to generate quads for
@@ -149,29 +178,6 @@ namespace ui {
 			Renderer::FontFamily family = Renderer::FontFamily::Roboto
 		) const;
 
-		/**
-		 * Generate glyph quads for wrapped/multi-line text
-		 * @param lines Pre-wrapped lines (from wrapText)
-		 * @param position Top-left position of the text block
-		 * @param scale Scaling factor
-		 * @param color Text color (RGBA 0-1 range)
-		 * @param lineHeight Height per line in pixels
-		 * @param hAlign Horizontal alignment per line
-		 * @param containerWidth Container width for alignment (0 = use line width)
-		 * @param outQuads Output vector to append generated quads to
-		 */
-		void generateWrappedGlyphQuads(
-			const std::vector<std::string>& lines,
-			const glm::vec2&				position,
-			float							scale,
-			const glm::vec4&				color,
-			float							lineHeight,
-			Foundation::HorizontalAlign		hAlign,
-			float							containerWidth,
-			std::vector<GlyphQuad>&			outQuads,
-			Renderer::FontFamily			family = Renderer::FontFamily::Roboto
-		) const;
-
 		/**
 		 * Get the texture ID of a font atlas (for batching)
 		 * @param family Font family whose atlas texture to return (default Roboto)
@@ -180,19 +186,20 @@ namespace ui {
 		GLuint getAtlasTexture(Renderer::FontFamily family = Renderer::FontFamily::Roboto) const;
 
 		/**
-		 * Update the internal frame counter for cache LRU tracking
+		 * Update the internal frame counter for cache LRU tracking, trim the glyph
+		 * run arena to its byte budget and sweep unused interned strings.
 		 * Should be called once per frame from the main application loop
 		 */
 		void updateFrame();
 
 		/**
-		 * Clear the glyph quad cache (e.g., on scene transitions)
+		 * Clear the glyph run and wrapped text caches (e.g., on scene transitions)
 		 */
 		void clearGlyphQuadCache();
 
 		/**
-		 * Get the current size of the glyph quad cache (for debugging/profiling)
-		 * @return Number of entries currently cached
+		 * Get the current size of the glyph run cache (for debugging/profiling)
+		 * @return Number of runs currently cached
 		 */
 		size_t getGlyphQuadCacheSize() const;
 
@@ -253,80 +260,52 @@ namespace ui {
 		 */
 		const Atlas& atlasFor(Renderer::FontFamily family) const;
 
-		/**
-		 * Cache key for glyph quad caching (family + text + scale + letterSpacing)
-		 */
-		struct CacheKey {
-			Renderer::FontFamily family;
-			std::string			 text;
-			float				 scale;
-			float				 letterSpacing;
-
-			bool operator==(const CacheKey& other) const {
-				return family == other.family && text == other.text && std::abs(scale - other.scale) < 0.001F &&
-					std::abs(letterSpacing - other.letterSpacing) < 0.001F;
-			}
-		};
+		// One atlas per FontFamily, indexed by static_cast<int>(family).
+		std::array<Atlas, Renderer::kFontFamilyCount> atlases;
+
+		// Interned strings and shaped glyph runs (mutable for const getGlyphRun)
+		mutable TextInterner			  textInterner;
+		mutable GlyphRunCache			  glyphRunCache{FontRendererConfig::kGlyphRunCacheBudgetBytes};
+		mutable std::vector<GlyphRunQuad> shapeScratch;
+		mutable uint64_t				  currentFrame = 0;
 
 		/**
-		 * Hash function for CacheKey
+		 * Shape a run into `out` (relative to origin)
+		 * @return Laid-out size (widest line, all lines' height)
 		 */
-		struct CacheKeyHash {
-			size_t operator()(const CacheKey& key) const {
-				size_t h1 = std::hash<std::string>{}(key.text);
-				size_t h2 = std::hash<float>{}(key.scale);
-				size_t h3 = std::hash<int>{}(static_cast<int>(key.family));
-				size_t h4 = std::hash<float>{}(key.letterSpacing);
-				return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
-			}
-		};
+		glm::vec2 shapeRun(std::string_view text, const TextLayout& layout, std::vector<GlyphRunQuad>& out) const;
 
 		/**
-		 * Cache entry storing generated quads + LRU tracking
+		 * Shape one line at `origin` (top-left) into `out`
+		 * @return Pen advance (line width)
 		 */
-		struct CacheEntry {
-			std::vector<GlyphQuad> quads;
-			uint64_t			   lastAccessFrame;
-		};
-
-		// One atlas per FontFamily, indexed by static_cast<int>(family).
-		std::array<Atlas, Renderer::kFontFamilyCount> atlases;
-
-		// Glyph quad cache (mutable for const GenerateGlyphQuads)
-		mutable std::unordered_map<CacheKey, CacheEntry, CacheKeyHash> glyphQuadCache;
-		mutable uint64_t											   currentFrame = 0;
+		float shapeLine(
+			std::string_view		   text,
+			const Atlas&			   atlas,
+			float					   fontSize,
+			float					   letterSpacing,
+			glm::vec2				   origin,
+			std::vector<GlyphRunQuad>& out
+		) const;
 
 		/**
-		 * Cache key for text wrapping (text + scale + wrap width)
+		 * Cache key for text wrapping (interned text + quantized scale + wrap width)
 		 */
 		struct WrapCacheKey {
-			Renderer::FontFamily family;
-			std::string			 text;
-			float				 scale;
-			float				 wrapWidth;
-
-			bool operator==(const WrapCacheKey& other) const {
-				return family == other.family && text == other.text && std::abs(scale - other.scale) < 0.001F &&
-					std::abs(wrapWidth - other.wrapWidth) < 0.1F;
-			}
+			TextHandle text;
+			int32_t	   scale;
+			int32_t	   wrapWidth;
+			uint8_t	   family;
+
+			bool operator==(const WrapCacheKey& other) const = default;
 		};
 
 		/**
-		 * Hash function for WrapCacheKey
-		 * Rounds floats to match the precision used in operator== to maintain hash invariant
+		 * Hash function for WrapCacheKey (integers only; the text was hashed when interned)
 		 */
 		struct WrapCacheKeyHash {
 			size_t operator()(const WrapCacheKey& key) const {
-				// Round to same precision as equality comparison
-				// scale uses 0.001 precision, wrapWidth uses 0.1 precision
-				auto roundedScale = std::round(key.scale * 1000.0F) / 1000.0F;
-				auto roundedWidth = std::round(key.wrapWidth * 10.0F) / 10.0F;
-
-				size_t h1 = std::hash<std::string>{}(key.text);
-				size_t h2 = std::hash<float>{}(roundedScale);
-				size_t h3 = std::hash<float>{}(roundedWidth);
-				size_t h4 = std::hash<int>{}(static_cast<int>(key.family));
-				return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
+				return GlyphRunKeyHash{}(GlyphRunKey{key.text, key.scale, 0, key.wrapWidth, key.family, 0});
 			}
 		};
 
@@ -338,7 +317,13 @@ namespace ui {
 			uint64_t		  lastAccessFrame;
 		};
 
-		// Wrapped text cache (mutable for const wrapText)
+		/**
+		 * Insert a wrap result (evicting the LRU entry when full)
+		 */
+		const WrappedTextResult& cacheWrapResult(const WrapCacheKey& key, WrappedTextResult&& result) const;
+
+		// Wrapped text cache (mutable for const wrapText); entries hold a reference
+		// on their interned text
 		mutable std::unordered_map<WrapCacheKey, WrapCacheEntry, WrapCacheKeyHash> wrappedTextCache;
 	};
 
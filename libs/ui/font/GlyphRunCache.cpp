@@ -0,0 +1,231 @@
+// Interned text handles and the glyph run arena (see GlyphRunCache.h)
+
+#include "font/GlyphRunCache.h"
+#include <algorithm>
+#include <utility>
+
+namespace ui {
+
+	// --- TextInterner ---
+
+	TextHandle TextInterner::intern(std::string_view text, uint64_t frame) {
+		auto it = m_ids.find(text);
+		if (it != m_ids.end()) {
+			Entry& entry = m_entries[it->second];
+			entry.lastUseFrame = frame;
+			return TextHandle{it->second, entry.generation};
+		}
+
+		uint32_t index = 0;
+		if (!m_freeEntries.empty()) {
+			index = m_freeEntries.back();
+			m_freeEntries.pop_back();
+		} else {
+			index = static_cast<uint32_t>(m_entries.size());
+			m_entries.emplace_back();
+		}
+		Entry& entry = m_entries[index];
+		entry.text.assign(text);
+		entry.refs = 0;
+		entry.lastUseFrame = frame;
+		entry.live = true;
+		m_ids.emplace(std::string_view(entry.text), index);
+		return TextHandle{index, entry.generation};
+	}
+
+	const TextInterner::Entry* TextInterner::entryFor(TextHandle handle) const {
+		if (handle.index >= m_entries.size()) {
+			return nullptr;
+		}
+		const Entry& entry = m_entries[handle.index];
+		return entry.live && entry.generation == handle.generation ? &entry : nullptr;
+	}
+
+	const std::string* TextInterner::lookup(TextHandle handle) const {
+		const Entry* entry = entryFor(handle);
+		return entry != nullptr ? &entry->text : nullptr;
+	}
+
+	void TextInterner::touch(TextHandle handle, uint64_t frame) {
+		if (entryFor(handle) != nullptr) {
+			m_entries[handle.index].lastUseFrame = frame;
+		}
+	}
+
+	void TextInterner::addRef(TextHandle handle) {
+		if (entryFor(handle) != nullptr) {
+			m_entries[handle.index].refs++;
+		}
+	}
+
+	void TextInterner::release(TextHandle handle) {
+		if (entryFor(handle) != nullptr && m_entries[handle.index].refs > 0) {
+			m_entries[handle.index].refs--;
+		}
+	}
+
+	void TextInterner::sweep(uint64_t frame, uint64_t maxAgeFrames) {
+		for (uint32_t i = 0; i < m_entries.size(); ++i) {
+			Entry& entry = m_entries[i];
+			if (!entry.live || entry.refs > 0 || frame - entry.lastUseFrame <= maxAgeFrames) {
+				continue;
+			}
+			m_ids.erase(std::string_view(entry.text));
+			entry.text.clear();
+			entry.live = false;
+			entry.generation++;
+			m_freeEntries.push_back(i);
+		}
+	}
+
+	void TextInterner::clear() {
+		m_ids.clear();
+		m_freeEntries.clear();
+		for (uint32_t i = 0; i < m_entries.size(); ++i) {
+			Entry& entry = m_entries[i];
+			entry.text.clear();
+			entry.refs = 0;
+			if (entry.live) {
+				entry.live = false;
+				entry.generation++;
+			}
+			m_freeEntries.push_back(i);
+		}
+	}
+
+	// --- GlyphRunCache ---
+
+	GlyphRunView GlyphRunCache::viewOf(const Slot& slot) const {
+		return GlyphRunView{std::span<const GlyphRunQuad>(m_arena.data() + slot.offset, slot.count), slot.size};
+	}
+
+	bool GlyphRunCache::resolve(const RetainedGlyphRun& run, uint64_t frame, GlyphRunView& out) {
+		if (run.slot >= m_slots.size()) {
+			return false;
+		}
+		Slot& slot = m_slots[run.slot];
+		if (!slot.live || slot.generation != run.generation || !(slot.key == run.key)) {
+			return false;
+		}
+		slot.lastUseFrame = frame;
+		out = viewOf(slot);
+		return true;
+	}
+
+	bool GlyphRunCache::find(const GlyphRunKey& key, uint64_t frame, RetainedGlyphRun& run, GlyphRunView& out) {
+		auto it = m_index.find(key);
+		if (it == m_index.end()) {
+			return false;
+		}
+		Slot& slot = m_slots[it->second];
+		slot.lastUseFrame = frame;
+		run.key = key;
+		run.slot = it->second;
+		run.generation = slot.generation;
+		out = viewOf(slot);
+		return true;
+	}
+
+	GlyphRunView GlyphRunCache::insert(
+		const GlyphRunKey&			  key,
+		std::span<const GlyphRunQuad> quads,
+		glm::vec2					  size,
+		uint64_t					  frame,
+		TextInterner&				  interner,
+		RetainedGlyphRun&			  run
+	) {
+		uint32_t slotIndex = 0;
+		if (!m_freeSlots.empty()) {
+			slotIndex = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		} else {
+			slotIndex = static_cast<uint32_t>(m_slots.size());
+			m_slots.emplace_back();
+		}
+
+		Slot& slot = m_slots[slotIndex];
+		slot.key = key;
+		slot.offset = static_cast<uint32_t>(m_arena.size());
+		slot.count = static_cast<uint32_t>(quads.size());
+		slot.size = size;
+		slot.lastUseFrame = frame;
+		slot.live = true;
+		m_arena.insert(m_arena.end(), quads.begin(), quads.end());
+		m_liveQuads += quads.size();
+		m_index.emplace(key, slotIndex);
+		interner.addRef(key.text);
+
+		run.key = key;
+		run.slot = slotIndex;
+		run.generation = slot.generation;
+		return viewOf(slot);
+	}
+
+	void GlyphRunCache::evict(uint32_t slotIndex, TextInterner& interner) {
+		Slot& slot = m_slots[slotIndex];
+		m_index.erase(slot.key);
+		interner.release(slot.key.text);
+		m_liveQuads -= slot.count;
+		slot.live = false;
+		slot.generation++; // invalidates retained references
+		m_freeSlots.push_back(slotIndex);
+	}
+
+	void GlyphRunCache::trim(uint64_t frame, TextInterner& interner) {
+		if (liveBytes() > m_budgetBytes) {
+			// Oldest first; evict down to 3/4 of the budget so trimming isn't needed every frame
+			std::vector<std::pair<uint64_t, uint32_t>> byAge;
+			byAge.reserve(m_index.size());
+			for (uint32_t i = 0; i < m_slots.size(); ++i) {
+				if (m_slots[i].live && m_slots[i].lastUseFrame < frame) {
+					byAge.emplace_back(m_slots[i].lastUseFrame, i);
+				}
+			}
+			std::sort(byAge.begin(), byAge.end());
+			const size_t target = m_budgetBytes / 4 * 3;
+			for (const auto& [lastUse, slotIndex] : byAge) {
+				if (liveBytes() <= target) {
+					break;
+				}
+				evict(slotIndex, interner);
+			}
+		}
+
+		if (m_arena.size() > 1024 && m_liveQuads * 2 < m_arena.size()) {
+			compact();
+		}
+	}
+
+	void GlyphRunCache::compact() {
+		// Slide live runs down in arena order (so moves never overlap a run not yet moved)
+		std::vector<uint32_t> order;
+		order.reserve(m_index.size());
+		for (uint32_t i = 0; i < m_slots.size(); ++i) {
+			if (m_slots[i].live) {
+				order.push_back(i);
+			}
+		}
+		std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return m_slots[a].offset < m_slots[b].offset; });
+
+		uint32_t writeOffset = 0;
+		for (uint32_t slotIndex : order) {
+			Slot& slot = m_slots[slotIndex];
+			if (slot.offset != writeOffset) {
+				std::copy(m_arena.begin() + slot.offset, m_arena.begin() + slot.offset + slot.count, m_arena.begin() + writeOffset);
+				slot.offset = writeOffset;
+			}
+			writeOffset += slot.count;
+		}
+		m_arena.resize(writeOffset);
+	}
+
+	void GlyphRunCache::clear(TextInterner& interner) {
+		for (uint32_t i = 0; i < m_slots.size(); ++i) {
+			if (m_slots[i].live) {
+				evict(i, interner);
+			}
+		}
+		m_arena.clear();
+	}
+
+} // namespace ui
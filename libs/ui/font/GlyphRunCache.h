@@ -0,0 +1,213 @@
+// Interned text handles and a byte-budgeted arena of shaped glyph runs.
+// GL-free storage behind FontRenderer's glyph-run API: FontRenderer shapes,
+// this file stores. Strings are hashed once when interned; after that every
+// lookup is by small integer keys, and a component holding a RetainedGlyphRun
+// reaches its quads without hashing at all.
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ui {
+
+	/**
+	 * Handle to an interned string. Generational: a handle whose string was
+	 * swept reads as stale instead of aliasing whatever reused its slot.
+	 */
+	struct TextHandle {
+		uint32_t index = UINT32_MAX;
+		uint32_t generation = 0;
+
+		bool operator==(const TextHandle& other) const = default;
+	};
+
+	/**
+	 * Deduplicating string table. Entries referenced by cached runs stay alive;
+	 * unreferenced ones are swept after going unused for a while, so per-frame
+	 * strings (FPS counters, timers) don't grow it without bound.
+	 */
+	class TextInterner {
+	  public:
+		/**
+		 * Intern a string (hashes it once) and mark it used this frame
+		 */
+		TextHandle intern(std::string_view text, uint64_t frame);
+
+		/**
+		 * The interned string, or nullptr if the handle is stale
+		 */
+		const std::string* lookup(TextHandle handle) const;
+
+		/**
+		 * Mark an entry used this frame (no-op for stale handles)
+		 */
+		void touch(TextHandle handle, uint64_t frame);
+
+		/**
+		 * Reference counting by the caches holding the handle as a key
+		 */
+		void addRef(TextHandle handle);
+		void release(TextHandle handle);
+
+		/**
+		 * Free unreferenced entries last used more than maxAgeFrames ago
+		 */
+		void sweep(uint64_t frame, uint64_t maxAgeFrames);
+
+		void   clear();
+		size_t size() const { return m_ids.size(); }
+
+	  private:
+		struct Entry {
+			std::string text;
+			uint32_t	generation = 0;
+			uint32_t	refs = 0;
+			uint64_t	lastUseFrame = 0;
+			bool		live = false;
+		};
+
+		const Entry* entryFor(TextHandle handle) const;
+
+		std::deque<Entry>							   m_entries; // deque: growing never moves the strings m_ids views
+		std::vector<uint32_t>						   m_freeEntries;
+		std::unordered_map<std::string_view, uint32_t> m_ids; // views into m_entries[i].text
+	};
+
+	/**
+	 * One glyph of a shaped run, relative to the run's top-left origin.
+	 * Color is applied at emit time, so runs are shared across colors.
+	 */
+	struct GlyphRunQuad {
+		glm::vec2 position;
+		glm::vec2 size;
+		glm::vec2 uvMin;
+		glm::vec2 uvMax;
+	};
+
+	/**
+	 * Layout inputs of a run, quantized so equal-looking floats compare equal
+	 * and hash alike (scale and spacing to 1/1000, wrap width to 1/10 px)
+	 */
+	struct GlyphRunKey {
+		TextHandle text;
+		int32_t	   scale = 0;
+		int32_t	   letterSpacing = 0;
+		int32_t	   wrapWidth = 0; // 0 = single line
+		uint8_t	   family = 0;
+		uint8_t	   hAlign = 0; // wrapped runs: per-line alignment within wrapWidth
+
+		bool operator==(const GlyphRunKey& other) const = default;
+
+		static int32_t quantizeScale(float value) { return static_cast<int32_t>(std::lround(value * 1000.0F)); }
+		static int32_t quantizeWidth(float value) { return value > 0.0F ? static_cast<int32_t>(std::lround(value * 10.0F)) : 0; }
+	};
+
+	struct GlyphRunKeyHash {
+		size_t operator()(const GlyphRunKey& key) const {
+			uint64_t h = (static_cast<uint64_t>(key.text.index) << 32) ^ key.text.generation;
+			h = h * 0x9E3779B97F4A7C15ULL ^ static_cast<uint32_t>(key.scale);
+			h = h * 0x9E3779B97F4A7C15ULL ^ static_cast<uint32_t>(key.letterSpacing);
+			h = h * 0x9E3779B97F4A7C15ULL ^ static_cast<uint32_t>(key.wrapWidth);
+			h = h * 0x9E3779B97F4A7C15ULL ^ (static_cast<uint32_t>(key.family) << 8 | key.hAlign);
+			return static_cast<size_t>(h ^ (h >> 29));
+		}
+	};
+
+	/**
+	 * A component's retained reference to its run. Checked with a slot index
+	 * and generation; stale references (evicted run) simply re-resolve.
+	 */
+	struct RetainedGlyphRun {
+		GlyphRunKey key;
+		uint32_t	slot = UINT32_MAX;
+		uint32_t	generation = 0;
+	};
+
+	/**
+	 * A resolved run: quads relative to the origin, plus the laid-out size
+	 * (width of the widest line, height of all lines). Valid until the next
+	 * call that may add a run.
+	 */
+	struct GlyphRunView {
+		std::span<const GlyphRunQuad> quads;
+		glm::vec2					  size{0.0F, 0.0F};
+	};
+
+	/**
+	 * Shaped runs packed back to back in one shared quad arena, indexed by key
+	 * and by slot. Evicts least-recently-used runs by byte budget; the arena
+	 * compacts once evicted holes outweigh the live runs (slots keep their
+	 * identity, so retained references survive compaction).
+	 */
+	class GlyphRunCache {
+	  public:
+		explicit GlyphRunCache(size_t budgetBytes)
+			: m_budgetBytes(budgetBytes) {}
+
+		/**
+		 * Resolve a retained reference if it still names a live run for its key
+		 */
+		bool resolve(const RetainedGlyphRun& run, uint64_t frame, GlyphRunView& out);
+
+		/**
+		 * Look a key up; on a hit, points `run` at it
+		 */
+		bool find(const GlyphRunKey& key, uint64_t frame, RetainedGlyphRun& run, GlyphRunView& out);
+
+		/**
+		 * Store a shaped run (the key must not be cached yet); points `run` at it.
+		 * Takes a reference on the key's text in `interner`.
+		 */
+		GlyphRunView insert(
+			const GlyphRunKey&			  key,
+			std::span<const GlyphRunQuad> quads,
+			glm::vec2					  size,
+			uint64_t					  frame,
+			TextInterner&				  interner,
+			RetainedGlyphRun&			  run
+		);
+
+		/**
+		 * Evict LRU runs (never those used this frame) until within budget, then
+		 * compact the arena if it is mostly holes
+		 */
+		void trim(uint64_t frame, TextInterner& interner);
+
+		void clear(TextInterner& interner);
+
+		size_t runCount() const { return m_index.size(); }
+		size_t liveBytes() const { return m_liveQuads * sizeof(GlyphRunQuad); }
+		size_t arenaBytes() const { return m_arena.size() * sizeof(GlyphRunQuad); }
+
+	  private:
+		struct Slot {
+			GlyphRunKey key;
+			uint32_t	offset = 0;
+			uint32_t	count = 0;
+			glm::vec2	size{0.0F, 0.0F};
+			uint64_t	lastUseFrame = 0;
+			uint32_t	generation = 0;
+			bool		live = false;
+		};
+
+		GlyphRunView viewOf(const Slot& slot) const;
+		void		 evict(uint32_t slotIndex, TextInterner& interner);
+		void		 compact();
+
+		size_t													 m_budgetBytes;
+		std::vector<GlyphRunQuad>								 m_arena;
+		size_t													 m_liveQuads = 0;
+		std::vector<Slot>										 m_slots;
+		std::vector<uint32_t>									 m_freeSlots;
+		std::unordered_map<GlyphRunKey, uint32_t, GlyphRunKeyHash> m_index;
+	};
+
+} // namespace ui
@@ -0,0 +1,144 @@
+#include "font/GlyphRunCache.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace ui;
+
+namespace {
+
+	std::vector<GlyphRunQuad> makeQuads(size_t count, float x) {
+		std::vector<GlyphRunQuad> quads(count);
+		for (size_t i = 0; i < count; ++i) {
+			quads[i].position = glm::vec2(x + static_cast<float>(i), 0.0F);
+		}
+		return quads;
+	}
+
+	GlyphRunKey keyFor(TextHandle text, float scale = 1.0F) {
+		GlyphRunKey key;
+		key.text = text;
+		key.scale = GlyphRunKey::quantizeScale(scale);
+		return key;
+	}
+
+} // namespace
+
+// ============================================================================
+// TextInterner
+// ============================================================================
+
+TEST(TextInternerTest, SameStringSameHandle) {
+	TextInterner interner;
+	TextHandle	 a = interner.intern("Colonists", 1);
+	TextHandle	 b = interner.intern(std::string("Colon") + "ists", 2);
+	TextHandle	 c = interner.intern("Storage", 2);
+
+	EXPECT_EQ(a, b);
+	EXPECT_FALSE(a == c);
+	EXPECT_EQ(*interner.lookup(a), "Colonists");
+	EXPECT_EQ(interner.size(), 2U);
+}
+
+TEST(TextInternerTest, SweepFreesOnlyUnreferencedStaleStrings) {
+	TextInterner interner;
+	TextHandle	 held = interner.intern("held", 0);
+	TextHandle	 fps = interner.intern("FPS: 59", 0);
+	TextHandle	 fresh = interner.intern("fresh", 100);
+	interner.addRef(held);
+
+	interner.sweep(100, 50);
+	EXPECT_NE(interner.lookup(held), nullptr);
+	EXPECT_EQ(interner.lookup(fps), nullptr); // stale handle reads as gone
+	EXPECT_NE(interner.lookup(fresh), nullptr);
+
+	// A reused slot must not alias the swept handle
+	TextHandle reused = interner.intern("FPS: 60", 101);
+	EXPECT_FALSE(reused == fps);
+	EXPECT_EQ(interner.lookup(fps), nullptr);
+}
+
+// ============================================================================
+// GlyphRunCache
+// ============================================================================
+
+TEST(GlyphRunCacheTest, RetainedRunResolvesUntilEvicted) {
+	TextInterner  interner;
+	GlyphRunCache cache(1024 * 1024);
+	const GlyphRunKey key = keyFor(interner.intern("Hello", 1));
+
+	RetainedGlyphRun run;
+	GlyphRunView	 view;
+	EXPECT_FALSE(cache.find(key, 1, run, view));
+	const auto quads = makeQuads(5, 0.0F);
+	view = cache.insert(key, quads, glm::vec2(40.0F, 16.0F), 1, interner, run);
+	EXPECT_EQ(view.quads.size(), 5U);
+
+	GlyphRunView resolved;
+	ASSERT_TRUE(cache.resolve(run, 2, resolved));
+	EXPECT_EQ(resolved.size.x, 40.0F);
+	EXPECT_EQ(resolved.quads[4].position.x, 4.0F);
+
+	// Any other holder finds the same run by key
+	RetainedGlyphRun other;
+	ASSERT_TRUE(cache.find(key, 2, other, resolved));
+	EXPECT_EQ(other.slot, run.slot);
+
+	cache.clear(interner);
+	EXPECT_FALSE(cache.resolve(run, 3, resolved));
+}
+
+TEST(GlyphRunCacheTest, QuantizedScalesShareARun) {
+	TextHandle text{0, 0};
+	EXPECT_EQ(keyFor(text, 1.0F), keyFor(text, 1.0F + 1e-5F));
+	EXPECT_FALSE(keyFor(text, 1.0F) == keyFor(text, 1.25F));
+	EXPECT_EQ(GlyphRunKeyHash{}(keyFor(text, 0.75F)), GlyphRunKeyHash{}(keyFor(text, 0.75F + 1e-5F)));
+}
+
+TEST(GlyphRunCacheTest, TrimEvictsLeastRecentlyUsedByBytes) {
+	TextInterner  interner;
+	const size_t  runBytes = 100 * sizeof(GlyphRunQuad);
+	GlyphRunCache cache(runBytes * 4);
+
+	std::vector<RetainedGlyphRun> runs(8);
+	for (int i = 0; i < 8; ++i) {
+		const GlyphRunKey key = keyFor(interner.intern("label " + std::to_string(i), static_cast<uint64_t>(i)));
+		const auto		  quads = makeQuads(100, static_cast<float>(i) * 1000.0F);
+		cache.insert(key, quads, glm::vec2(0.0F, 0.0F), static_cast<uint64_t>(i), interner, runs[i]);
+	}
+	EXPECT_EQ(cache.liveBytes(), runBytes * 8);
+
+	// Keep the oldest run alive by touching it this frame
+	GlyphRunView view;
+	ASSERT_TRUE(cache.resolve(runs[0], 10, view));
+	cache.trim(10, interner);
+	EXPECT_LE(cache.liveBytes(), runBytes * 3);
+	EXPECT_TRUE(cache.resolve(runs[0], 10, view));
+	EXPECT_FALSE(cache.resolve(runs[1], 10, view));
+	EXPECT_TRUE(cache.resolve(runs[7], 10, view));
+}
+
+TEST(GlyphRunCacheTest, CompactionKeepsRetainedRunsValid) {
+	TextInterner  interner;
+	const size_t  runBytes = 400 * sizeof(GlyphRunQuad);
+	GlyphRunCache cache(runBytes);
+
+	std::vector<RetainedGlyphRun> runs(6);
+	for (int i = 0; i < 6; ++i) {
+		const GlyphRunKey key = keyFor(interner.intern("run " + std::to_string(i), 1));
+		const auto		  quads = makeQuads(400, static_cast<float>(i) * 1000.0F);
+		cache.insert(key, quads, glm::vec2(0.0F, 0.0F), 1, interner, runs[i]);
+	}
+
+	// Only the last run was used recently; the rest are evicted and the arena compacts
+	GlyphRunView view;
+	ASSERT_TRUE(cache.resolve(runs[5], 2, view));
+	cache.trim(2, interner);
+	EXPECT_EQ(cache.runCount(), 1U);
+	EXPECT_EQ(cache.arenaBytes(), cache.liveBytes());
+
+	ASSERT_TRUE(cache.resolve(runs[5], 3, view));
+	EXPECT_EQ(view.quads.size(), 400U);
+	EXPECT_EQ(view.quads[0].position.x, 5000.0F);
+	EXPECT_EQ(view.quads[399].position.x, 5399.0F);
+}
@@ -0,0 +1,108 @@
+// Offscreen render caching for UI panels (see LayerCache.h)
+
+#include "layer/LayerCache.h"
+
+#include <primitives/Primitives.h>
+#include <resources/RenderToTexture.h>
+#include <utils/Log.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace UI {
+
+	// --- LayerCacheState ---
+
+	void LayerCacheState::observe(const InputEvent& event) {
+		const bool inside = renderedRegion.contains(event.position);
+		if (inside || pointerInside) {
+			dirty = true;
+		}
+		pointerInside = inside;
+	}
+
+	bool LayerCacheState::needsRender(const Foundation::Rect& region) const {
+		return dirty || region.x != renderedRegion.x || region.y != renderedRegion.y || region.width != renderedRegion.width ||
+			   region.height != renderedRegion.height;
+	}
+
+	void LayerCacheState::markRendered(const Foundation::Rect& region) {
+		renderedRegion = region;
+		dirty = false;
+	}
+
+	Foundation::Rect snapToPixels(const Foundation::Rect& region, float pixelRatio) {
+		const float left = std::floor(region.x * pixelRatio) / pixelRatio;
+		const float top = std::floor(region.y * pixelRatio) / pixelRatio;
+		const float right = std::ceil((region.x + region.width) * pixelRatio) / pixelRatio;
+		const float bottom = std::ceil((region.y + region.height) * pixelRatio) / pixelRatio;
+		return {left, top, right - left, bottom - top};
+	}
+
+	// --- LayerCache ---
+
+	LayerCache::LayerCache() = default;
+	LayerCache::~LayerCache() = default;
+
+	bool LayerCache::refresh(const Foundation::Rect& region, bool contentDirty, const std::function<void()>& renderContent) {
+		if (contentDirty) {
+			state.invalidate();
+		}
+		const float			   pixelRatio = Renderer::Primitives::getPixelRatio();
+		const Foundation::Rect snapped = snapToPixels(region, pixelRatio);
+		if (targetFailed || !state.needsRender(snapped)) {
+			return false;
+		}
+		if (snapped.width <= 0.0F || snapped.height <= 0.0F) {
+			release();
+			state.markRendered(snapped);
+			return false;
+		}
+
+		const int width = static_cast<int>(std::lround(snapped.width * pixelRatio));
+		const int height = static_cast<int>(std::lround(snapped.height * pixelRatio));
+		if (target == nullptr || target->width() != width || target->height() != height) {
+			target.reset(); // free the old texture before allocating its replacement
+			try {
+				target = std::make_unique<Renderer::RenderToTexture>(width, height);
+			} catch (const std::runtime_error& e) {
+				LOG_ERROR(UI, "LayerCache: %s (%dx%d); rendering the panel directly", e.what(), width, height);
+				targetFailed = true;
+				return false;
+			}
+		}
+
+		Renderer::Primitives::beginOffscreen(*target, snapped);
+		renderContent();
+		Renderer::Primitives::endOffscreen(*target);
+
+		targetRegion = snapped;
+		state.markRendered(snapped);
+		renders++;
+		return true;
+	}
+
+	bool LayerCache::refresh(Component& root, const Foundation::Rect& region) {
+		const bool rendered = refresh(region, root.isRenderDirty(), [&root]() { root.render(); });
+		if (rendered) {
+			root.clearRenderDirty();
+		}
+		return rendered;
+	}
+
+	bool LayerCache::composite(float zIndex) const {
+		if (targetFailed) {
+			return false;
+		}
+		if (target != nullptr) {
+			Renderer::Primitives::drawImage({.bounds = targetRegion, .texture = target->texture(), .zIndex = zIndex});
+		}
+		return true;
+	}
+
+	void LayerCache::release() {
+		target.reset();
+		state.invalidate();
+	}
+
+} // namespace UI
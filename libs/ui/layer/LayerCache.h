@@ -0,0 +1,121 @@
+#pragma once
+
+// LayerCache - Retained offscreen render of a UI panel.
+//
+// A cached panel renders once into a RenderToTexture and is then drawn every
+// frame as one textured quad. It re-renders only when:
+// - its content was invalidated (Component::invalidate anywhere in its subtree,
+//   or an explicit LayerCache::invalidate from code that changed it),
+// - the pointer interacts with it (hover and press states), or
+// - its screen region moved or resized.
+//
+// Per frame, refresh() every cached panel before any on-screen UI is emitted
+// (a re-render is an offscreen pass, which flushes the batch), then
+// composite() them in the panels' usual draw order.
+//
+// Only cache panels whose pixels stay inside their region (no popups) and
+// that don't animate on their own.
+
+#include "component/Component.h"
+#include "input/InputEvent.h"
+
+#include <graphics/Rect.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Renderer {
+	class RenderToTexture;
+}
+
+namespace UI {
+
+	/**
+	 * GL-free invalidation state of a cached layer
+	 */
+	class LayerCacheState {
+	  public:
+		void invalidate() { dirty = true; }
+
+		/**
+		 * Invalidate on pointer events over the rendered region, and on the
+		 * first one after the pointer leaves it (so hover states clear)
+		 */
+		void observe(const InputEvent& event);
+
+		/**
+		 * True if the content must be re-rendered to cover `region`
+		 */
+		[[nodiscard]] bool needsRender(const Foundation::Rect& region) const;
+
+		/**
+		 * Record that the content was rendered for `region`
+		 */
+		void markRendered(const Foundation::Rect& region);
+
+	  private:
+		Foundation::Rect renderedRegion;
+		bool			 dirty{true};
+		bool			 pointerInside{false};
+	};
+
+	/**
+	 * Grow a logical region to whole physical pixels, so the cached texture
+	 * maps texel-for-pixel onto the screen
+	 */
+	Foundation::Rect snapToPixels(const Foundation::Rect& region, float pixelRatio);
+
+	class LayerCache {
+	  public:
+		LayerCache();
+		~LayerCache();
+
+		LayerCache(const LayerCache&) = delete;
+		LayerCache& operator=(const LayerCache&) = delete;
+
+		void invalidate() { state.invalidate(); }
+
+		/**
+		 * Feed every input event (before dispatch, consumed or not)
+		 */
+		void observe(const InputEvent& event) { state.observe(event); }
+
+		/**
+		 * Re-render `renderContent` into the cache if it is stale or
+		 * `contentDirty`. Returns true if it re-rendered.
+		 */
+		bool refresh(const Foundation::Rect& region, bool contentDirty, const std::function<void()>& renderContent);
+
+		/**
+		 * Cache a Component subtree: its invalidation flags decide staleness and
+		 * are cleared once it has been re-rendered
+		 */
+		bool refresh(Component& root, const Foundation::Rect& region);
+
+		/**
+		 * Draw the cached layer as one textured quad. False if there is nothing
+		 * cached (render target unavailable); the caller then renders directly.
+		 */
+		bool composite(float zIndex = 0.0F) const;
+
+		/**
+		 * Free the render target (e.g. the panel is hidden); the next refresh
+		 * re-creates it
+		 */
+		void release();
+
+		/**
+		 * Number of offscreen re-renders so far (idle panels stop counting)
+		 */
+		[[nodiscard]] uint32_t renderCount() const { return renders; }
+
+	  private:
+		LayerCacheState							   state;
+		std::unique_ptr<Renderer::RenderToTexture> target;
+		Foundation::Rect						   targetRegion; // snapped screen region the target covers
+		uint32_t								   renders{0};
+		bool									   targetFailed{false}; // creation failed; render directly
+	};
+
+} // namespace UI
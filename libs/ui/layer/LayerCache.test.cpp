@@ -0,0 +1,88 @@
+#include "layer/LayerCache.h"
+#include <gtest/gtest.h>
+
+using namespace UI;
+
+// ============================================================================
+// LayerCacheState
+// ============================================================================
+
+TEST(LayerCacheStateTest, CleanAfterRenderUntilRegionChanges) {
+	LayerCacheState		   state;
+	const Foundation::Rect region{10.0F, 10.0F, 100.0F, 40.0F};
+	EXPECT_TRUE(state.needsRender(region)); // never rendered
+
+	state.markRendered(region);
+	EXPECT_FALSE(state.needsRender(region));
+	EXPECT_TRUE(state.needsRender({10.0F, 10.0F, 120.0F, 40.0F}));
+	EXPECT_TRUE(state.needsRender({12.0F, 10.0F, 100.0F, 40.0F}));
+
+	state.invalidate();
+	EXPECT_TRUE(state.needsRender(region));
+}
+
+TEST(LayerCacheStateTest, PointerEventsOverRegionInvalidateIncludingExit) {
+	LayerCacheState		   state;
+	const Foundation::Rect region{0.0F, 0.0F, 100.0F, 40.0F};
+	state.markRendered(region);
+
+	// Elsewhere on screen: the cached panel can't react, stays clean
+	state.observe(InputEvent::mouseMove({300.0F, 300.0F}));
+	EXPECT_FALSE(state.needsRender(region));
+
+	state.observe(InputEvent::mouseMove({50.0F, 20.0F}));
+	EXPECT_TRUE(state.needsRender(region));
+	state.markRendered(region);
+
+	// Leaving clears hover: one more re-render, then clean again
+	state.observe(InputEvent::mouseMove({300.0F, 20.0F}));
+	EXPECT_TRUE(state.needsRender(region));
+	state.markRendered(region);
+	state.observe(InputEvent::mouseMove({310.0F, 20.0F}));
+	EXPECT_FALSE(state.needsRender(region));
+}
+
+TEST(LayerCacheStateTest, SnapToPixelsGrowsToWholePhysicalPixels) {
+	const Foundation::Rect snapped = snapToPixels({10.3F, 5.6F, 20.0F, 10.0F}, 2.0F);
+	EXPECT_FLOAT_EQ(snapped.x, 10.0F);
+	EXPECT_FLOAT_EQ(snapped.y, 5.5F);
+	EXPECT_FLOAT_EQ(snapped.x + snapped.width, 30.5F);
+	EXPECT_FLOAT_EQ(snapped.y + snapped.height, 16.0F);
+}
+
+// ============================================================================
+// Component render invalidation
+// ============================================================================
+
+TEST(ComponentInvalidationTest, DescendantChangesReachTheRoot) {
+	Component	root;
+	Component	middle;
+	LayerHandle leafHandle = middle.addChild(Component{});
+	LayerHandle midHandle = root.addChild(std::move(middle));
+	EXPECT_TRUE(root.isRenderDirty()); // new components start dirty
+
+	root.clearRenderDirty();
+	EXPECT_FALSE(root.isRenderDirty());
+
+	auto* mid = root.getChild<Component>(midHandle);
+	ASSERT_NE(mid, nullptr);
+	auto* leaf = mid->getChild<Component>(leafHandle);
+	ASSERT_NE(leaf, nullptr);
+	leaf->invalidate();
+	EXPECT_TRUE(root.isRenderDirty());
+	EXPECT_TRUE(mid->isRenderDirty());
+
+	root.clearRenderDirty();
+	EXPECT_FALSE(leaf->isRenderDirty());
+}
+
+TEST(ComponentInvalidationTest, OnlyRealMovesInvalidate) {
+	Component leaf;
+	leaf.setPosition(5.0F, 5.0F);
+	leaf.clearRenderDirty();
+
+	leaf.setPosition(5.0F, 5.0F);
+	EXPECT_FALSE(leaf.isRenderDirty());
+	leaf.setPosition(6.0F, 5.0F);
+	EXPECT_TRUE(leaf.isRenderDirty());
+}
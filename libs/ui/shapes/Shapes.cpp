@@ -105,23 +105,29 @@ namespace UI {
 
 		// Determine if we should use wrapped text mode
 		bool shouldWrap = style.wordWrap && width.has_value();
-		glm::vec4 glyphColor(style.color.r, style.color.g, style.color.b, style.color.a);
-		std::vector<ui::FontRenderer::GlyphQuad> glyphs;
 
+		// The retained glyph run is resolved without hashing or re-shaping while the
+		// text and layout are unchanged; quads come back relative to the run origin.
+		ui::FontRenderer::TextLayout layout;
+		layout.scale = scale;
 		if (shouldWrap) {
-			// WRAPPED TEXT MODE
-			const ui::FontRenderer::WrappedTextResult& wrapped = fontRenderer->wrapText(text, scale, *width);
+			layout.wrapWidth = *width;
+			layout.hAlign = style.hAlign;
+		}
+		const ui::GlyphRunView run = fontRenderer->getGlyphRun(glyphRun, text, layout);
+		Foundation::Vec2	   alignedPos = position;
 
+		if (shouldWrap) {
+			// WRAPPED TEXT MODE (lines are aligned within the width inside the run)
 			// Calculate vertical alignment offset for the text block
-			Foundation::Vec2 alignedPos = position;
 			if (height.has_value()) {
 				float boxHeight = *height;
 				switch (style.vAlign) {
 					case Foundation::VerticalAlign::Middle:
-						alignedPos.y += (boxHeight - wrapped.totalHeight) * 0.5F;
+						alignedPos.y += (boxHeight - run.size.y) * 0.5F;
 						break;
 					case Foundation::VerticalAlign::Bottom:
-						alignedPos.y += boxHeight - wrapped.totalHeight;
+						alignedPos.y += boxHeight - run.size.y;
 						break;
 					case Foundation::VerticalAlign::Top:
 					default:
@@ -129,25 +135,10 @@ namespace UI {
 						break;
 				}
 			}
-
-			// Generate quads for all lines with per-line horizontal alignment
-			fontRenderer->generateWrappedGlyphQuads(
-				wrapped.lines,
-				glm::vec2(alignedPos.x, alignedPos.y),
-				scale,
-				glyphColor,
-				wrapped.lineHeight,
-				style.hAlign,
-				*width,
-				glyphs
-			);
 		} else {
 			// SINGLE LINE MODE (original behavior)
-			glm::vec2 textSize = fontRenderer->MeasureText(text, scale);
-			float	  ascent = fontRenderer->getAscent(scale);
-
-			// Calculate aligned position
-			Foundation::Vec2 alignedPos = position;
+			const glm::vec2 textSize = run.size;
+			float			ascent = fontRenderer->getAscent(scale);
 
 			// Check if we're in bounding box mode or point mode
 			if (width.has_value() && height.has_value()) {
@@ -219,19 +210,14 @@ namespace UI {
 						break;
 				}
 			}
-
-			// Generate glyph quads using FontRenderer
-			fontRenderer->generateGlyphQuads(
-				text, glm::vec2(alignedPos.x, alignedPos.y), scale, glyphColor, glyphs
-			);
 		}
 
 		// Add each glyph to the unified batch renderer
 		// Text is interleaved with shapes in submission order, preserving correct z-ordering
 		Foundation::Color textColor(style.color.r, style.color.g, style.color.b, style.color.a);
-		for (const auto& glyph : glyphs) {
+		for (const auto& glyph : run.quads) {
 			batchRenderer->addTextQuad(
-				Foundation::Vec2(glyph.position.x, glyph.position.y),
+				Foundation::Vec2(alignedPos.x + glyph.position.x, alignedPos.y + glyph.position.y),
 				Foundation::Vec2(glyph.size.x, glyph.size.y),
 				Foundation::Vec2(glyph.uvMin.x, glyph.uvMin.y),
 				Foundation::Vec2(glyph.uvMax.x, glyph.uvMax.y),
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "component/Component.h"
+#include "font/GlyphRunCache.h"
 #include "graphics/Color.h"
 #include "graphics/PrimitiveStyles.h"
 #include "math/Types.h"
@@ -195,6 +196,9 @@ namespace UI {
 		mutable std::optional<float> cachedWrapWidth;
 		mutable bool				 cachedWordWrap{false};
 
+		// Retained glyph run (re-resolved by FontRenderer when text/style change)
+		mutable ui::RetainedGlyphRun glyphRun;
+
 		// Ensure cache is valid, recompute if needed
 		void ensureCacheValid() const;
 	};
@@ -74,6 +74,33 @@ enum class WorldField : uint32_t {
 
 inline constexpr uint32_t kAllWorldFields = 0x7FFFFu; // bits 0..18
 
+// Stable lowercase name of a field (matches the WorldData member), for
+// diagnostics and tooling output.
+inline const char* worldFieldName(WorldField field) {
+    switch (field) {
+        case WorldField::Elevation:        return "elevation";
+        case WorldField::TemperatureMean:  return "temperatureMean";
+        case WorldField::TemperatureRange: return "temperatureRange";
+        case WorldField::Precipitation:    return "precipitation";
+        case WorldField::WindDir:          return "windDir";
+        case WorldField::WindSpeed:        return "windSpeed";
+        case WorldField::PlateId:          return "plateId";
+        case WorldField::BoundaryType:     return "boundaryType";
+        case WorldField::BoundaryDistance: return "boundaryDistance";
+        case WorldField::Biome:            return "biome";
+        case WorldField::Flags:            return "flags";
+        case WorldField::WaterDepth:       return "waterDepth";
+        case WorldField::FlowAccum:        return "flowAccum";
+        case WorldField::Downhill:         return "downhill";
+        case WorldField::SnowCover:        return "snowCover";
+        case WorldField::CrustAge:         return "crustAge";
+        case WorldField::OrogenyAge:       return "orogenyAge";
+        case WorldField::IceThickness:     return "iceThickness";
+        case WorldField::IceFlow:          return "iceFlow";
+    }
+    return "unknown";
+}
+
 // SoA world data storage — 33 bytes per tile.
 // All arrays allocated together via allocate(); never resized after that.
 //
@@ -431,9 +431,11 @@ Vec3d SphereGrid::uvToDir(uint32_t r, double u, double v) const {
 namespace {
 // Solve dir against a single rhombus's T1/T2 charts. Returns true + (u,v) on hit.
 // Pulled out so both the full search and the hinted fast path share exact math.
+// minBary is the barycentric acceptance threshold: the default is the search's
+// eps tolerance; a positive value accepts only directions strictly inside.
 inline bool tryRhombusSolve(const double* invT1, const double* invT2, Vec3d dir,
-                            double& outU, double& outV) {
-    constexpr double kEps = -1e-7;
+                            double& outU, double& outV, double minBary = -1e-7) {
+    const double kEps = minBary;
     {
         double bA = invT1[0]*dir.x + invT1[1]*dir.y + invT1[2]*dir.z;
         double bB = invT1[3]*dir.x + invT1[4]*dir.y + invT1[5]*dir.z;
@@ -683,7 +685,35 @@ SphereGrid::HexSample SphereGrid::locateHex(double latDeg, double lonDeg) const
     uint32_t rh{};
     double u{}, v{};
     dirToRhombusUV(dir, rh, u, v);
+    return locateHexInRhombus(dir, rh, u, v);
+}
+
+SphereGrid::HexSample SphereGrid::locateHexHinted(double latDeg, double lonDeg,
+                                                  uint32_t& rhombusHint) const {
+    using foundation::det_math::cos;
+    using foundation::det_math::sin;
+    double lat = latDeg * kPiOver180;
+    double lon = lonDeg * kPiOver180;
+    double cosLat = cos(lat);
+    Vec3d dir = {cosLat * cos(lon), cosLat * sin(lon), sin(lat)};
+
+    // Accept the hint only on a strict interior hit. The margin is 10x the
+    // search's eps, so no other rhombus can also pass the search's eps test and
+    // the full search would have resolved the same rhombus: the result is
+    // bit-identical to locateHex. Directions near a seam or on the T1/T2
+    // diagonal just take the full search.
+    constexpr double kInteriorMargin = 1e-6;
+    uint32_t rh = rhombusHint < 10u ? rhombusHint : 0u;
+    double u{}, v{};
+    if (!tryRhombusSolve(rhombiInvT1[rh].m, rhombiInvT2[rh].m, dir, u, v, kInteriorMargin)) {
+        dirToRhombusUV(dir, rh, u, v);
+    }
+    rhombusHint = rh;
+    return locateHexInRhombus(dir, rh, u, v);
+}
 
+SphereGrid::HexSample SphereGrid::locateHexInRhombus(Vec3d dir, uint32_t rh,
+                                                     double u, double v) const {
     double dn = static_cast<double>(n);
     double fq = u * dn;
     double fr = v * dn;
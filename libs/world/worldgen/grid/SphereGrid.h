@@ -115,6 +115,13 @@ class SphereGrid {
     // the shared Voronoi edge in lattice units.
     HexSample locateHex(double latDeg, double lonDeg) const;
 
+    // Hinted variant for batched sampling of nearby positions (PlanetSampler::
+    // sampleGrid): tries rhombus rhombusHint first and updates it to the
+    // resolved rhombus. Unlike fromUnitVectorHinted, the hint is only taken for
+    // directions strictly inside that rhombus, so the result always equals
+    // locateHex(latDeg, lonDeg), seams included.
+    HexSample locateHexHinted(double latDeg, double lonDeg, uint32_t& rhombusHint) const;
+
     // Approximate tile width in meters on a sphere of the given radius.
     // Uses sqrt of the tile's spherical area as a proxy for width. The vertex's
     // hex cell area is approximated by the quad (i-0.5,j-0.5)..(i+0.5,j+0.5)/n
@@ -228,6 +235,9 @@ class SphereGrid {
     // matrices for a direct barycentric solve with no face lookup.
     void dirToRhombusUV(Vec3d dir, uint32_t& rh, double& u, double& v) const;
 
+    // locateHex once the containing rhombus and (u,v) are known.
+    HexSample locateHexInRhombus(Vec3d dir, uint32_t rh, double u, double v) const;
+
     // Map an (rhombus,i,j) VERTEX (i,j in [0..n], possibly out of range) to its
     // canonical owning rhombus and owned coordinates, or to a pole. Returns the
     // resolved TileId, or kInvalidTile if unmappable.
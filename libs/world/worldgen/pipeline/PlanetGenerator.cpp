@@ -1,6 +1,7 @@
 #include "worldgen/pipeline/PlanetGenerator.h"
 
 #include "worldgen/pipeline/GenerationError.h"
+#include "worldgen/pipeline/WorldUpsample.h"
 #include "worldgen/stages/AtmosphereStage.h"
 #include "worldgen/stages/BiomeStage.h"
 #include "worldgen/stages/CrustStage.h"
@@ -12,11 +13,14 @@
 #include "worldgen/stages/TectonicHistoryStage.h"
 #include "worldgen/stages/TerrainStage.h"
 
+#include <metrics/SystemResources.h>
 #include <random/SplitMix64.h>
 #include <utils/Log.h>
 #include <utils/WorldHash.h>
 
+#include <algorithm>
 #include <bit>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <numeric>
@@ -118,6 +122,10 @@ PlanetGenerator::~PlanetGenerator() {
 // ============================================================================
 
 void PlanetGenerator::start(const PlanetParams& params) {
+    start(params, nullptr);
+}
+
+void PlanetGenerator::start(const PlanetParams& params, std::shared_ptr<const SphereGrid> grid) {
     cancel();
     if (worker.joinable()) worker.join();
 
@@ -126,6 +134,7 @@ void PlanetGenerator::start(const PlanetParams& params) {
     {
         std::lock_guard<std::mutex> lock(snapshotMutex);
         latestSnapshot.reset();
+        latestPreview.reset();
 #ifndef NDEBUG
         lastPublishedChecksum = 0;
 #endif
@@ -134,6 +143,11 @@ void PlanetGenerator::start(const PlanetParams& params) {
         std::lock_guard<std::mutex> lock(failureMutex);
         failureReasonStr.clear();
     }
+    {
+        std::lock_guard<std::mutex> lock(profileMutex);
+        runProfile = {};
+        runProfile.poolThreads = pool.threadCount();
+    }
 
     // Validate inputs synchronously so a bad request surfaces on the calling
     // thread (no worker spawned, state == Failed with a reason) instead of
@@ -165,7 +179,10 @@ void PlanetGenerator::start(const PlanetParams& params) {
     atomicStageFraction.store(0.0f, std::memory_order_release);
     atomicTotalFraction.store(0.0f, std::memory_order_release);
 
-    worker = std::jthread([this, params]() { runPipeline(params); });
+    if (grid && grid->subdivision() != params.gridSubdivision) grid.reset();
+    worker = std::jthread([this, params, grid = std::move(grid)]() {
+        runPipeline(params, grid);
+    });
 }
 
 void PlanetGenerator::cancel() {
@@ -210,6 +227,11 @@ std::shared_ptr<const GeneratedWorld> PlanetGenerator::snapshot() const {
     return latestSnapshot;
 }
 
+std::shared_ptr<const GeneratedWorld> PlanetGenerator::preview() const {
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    return latestPreview;
+}
+
 std::shared_ptr<const GeneratedWorld> PlanetGenerator::takeResult() {
     auto state = static_cast<GenerationProgress::State>(
         atomicState.load(std::memory_order_acquire));
@@ -232,6 +254,11 @@ void PlanetGenerator::fail(const std::string& reason) {
                       std::memory_order_release);
 }
 
+GenerationProfile PlanetGenerator::profile() const {
+    std::lock_guard<std::mutex> lock(profileMutex);
+    return runProfile;
+}
+
 std::string PlanetGenerator::failureReason() const {
     std::lock_guard<std::mutex> lock(failureMutex);
     return failureReasonStr;
@@ -241,195 +268,60 @@ std::string PlanetGenerator::failureReason() const {
 // Pipeline runner
 // ============================================================================
 
-void PlanetGenerator::runPipeline(PlanetParams params) {
+void PlanetGenerator::runPipeline(PlanetParams params, std::shared_ptr<const SphereGrid> grid) {
     // params are pre-validated in start(); tectonicPlateCount is guaranteed in
     // [2, 30] and gridSubdivision in [1, kMaxGridSubdivision] by the time we get
     // here, so the pipeline no longer silently clamps.
     try {
-        // Build the GeneratedWorld
-        auto world = std::make_shared<GeneratedWorld>();
-        world->params  = params;
-        world->derived = derive(params);
-        world->grid    = std::make_shared<SphereGrid>(params.gridSubdivision);
-        world->data.allocate(world->grid->tileCount());
-
-        // The climate tail (temperature-dependent stages) begins at AtmosphereStage;
-        // everything before it (tectonics, terrain, sea-level selection) is unaffected
-        // by ice and never re-runs. The tail is the contiguous index range
-        // [tailStart, end): Atmosphere, Precipitation, Ocean, Biome, Snow, Glacier.
-        // OceanStage sits inside the tail and so re-runs too. It is a pure function of
-        // elevation and sea level, so it reproduces identical ocean tiles, but it has to
-        // re-run because it co-owns waterDepth with PrecipitationStage's lakes, which DO
-        // change under the colder feedback climate.
-        size_t tailStart = stages.size();
-        for (size_t i = 0; i < stages.size(); ++i) {
-            if (std::strcmp(stages[i]->name(), "Atmosphere") == 0) {
-                tailStart = i;
-                break;
-            }
+        // Progressive mode: a whole low-n pass first, published via preview()
+        // before the target-n pass begins. Skipped when the target is already
+        // at or below the preview resolution (the real run is just as fast).
+        if (progressive.load(std::memory_order_acquire) &&
+            params.gridSubdivision > kPreviewSubdivision) {
+            const auto previewStart = std::chrono::steady_clock::now();
+            runPreviewPass(params);
+            const double secs = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - previewStart).count();
+            std::lock_guard<std::mutex> lock(profileMutex);
+            runProfile.previewWallSeconds = secs;
         }
 
-        // Progress reserves a band for the optional feedback pass so the bar reflects
-        // pass-2 work instead of pinning at 100% while it runs. The feedback re-runs the
-        // tail, so the planned work is the full pipeline plus one more tail; pass 1 tops
-        // out at totalWeight/plannedTotalWeight and pass 2 fills the rest. A glacier-free
-        // world skips pass 2, and the final store (at Complete) advances the bar to 1.0.
-        const float reRunTailWeight    = totalWeight - weightPrefixSum[tailStart];
-        const float plannedTotalWeight = totalWeight + reRunTailWeight;
-
-        // Run one stage by index, optionally with the ice-feedback flag set (used
-        // only on the second pass). Reuses deriveSeed(seed, i) so re-running a stage
-        // is bit-identical apart from the feedback it reads.
-        auto runStage = [&](size_t i, bool iceFeedback) {
-            atomicStageIndex.store(static_cast<int>(i), std::memory_order_release);
-            atomicStageFraction.store(0.0f, std::memory_order_release);
-
-            float stageWeightBase = weightPrefixSum[i];
-            // Pass 2 (iceFeedback) re-runs the tail, so its completed-work baseline is
-            // the whole first pass beyond the pre-tail prefix already in stageWeightBase:
-            // reRunTailWeight = totalWeight - weightPrefixSum[tailStart].
-            const float passBase = iceFeedback ? reRunTailWeight : 0.0f;
-
-            // reportProgress lambda: maps [0,1] within stage to totalFraction. Both
-            // stores are monotonic max via CAS loop so out-of-order slab completions
-            // never push progress backwards. Pass 2 continues forward from where pass 1
-            // stopped into the reserved tail band; it never rewinds.
-            auto reportProgress = [&, i, stageWeightBase, passBase](float frac) {
-                float cur = atomicStageFraction.load(std::memory_order_relaxed);
-                while (frac > cur &&
-                       !atomicStageFraction.compare_exchange_weak(
-                           cur, frac, std::memory_order_relaxed)) {}
-
-                float total = (passBase + stageWeightBase + stages[i]->weight() * frac)
-                              / plannedTotalWeight;
-                cur = atomicTotalFraction.load(std::memory_order_relaxed);
-                while (total > cur &&
-                       !atomicTotalFraction.compare_exchange_weak(
-                           cur, total, std::memory_order_relaxed)) {}
-            };
-
-            uint64_t stageSeed = foundation::deriveSeed(params.seed, static_cast<uint64_t>(i));
-
-            StageContext ctx{
-                params,
-                world->derived,
-                *world->grid,
-                world->data,
-                *world,
-                pool,
-                stageSeed,
-                reportProgress,
-                cancelFlag,
-                iceFeedback
-            };
-
-            stages[i]->run(ctx);
-            publishSnapshot(world);
-
-#ifndef NDEBUG
-            // Localize which stage first introduces a non-finite float. Debug
-            // only: the all-builds end-of-pipeline sweep is the shipping guard.
-            {
-                uint32_t badTile = 0;
-                if (const char* field = firstNonFiniteField(world->data, badTile)) {
-                    throw GenerationError(std::string("non-finite ") + field
-                                          + " at tile " + std::to_string(badTile)
-                                          + " after stage " + stages[i]->name());
-                }
-            }
-#endif
-        };
-
-        // Pass 1: the full pipeline, no ice feedback. Capture the validFields set just
-        // before the climate tail so the feedback pass can invalidate exactly the
-        // fields it rewrites.
-        uint32_t preTailValid = 0;
-        for (size_t i = 0; i < stages.size(); ++i) {
-            if (cancelFlag.load(std::memory_order_acquire)) {
-                atomicState.store(
-                    static_cast<int>(GenerationProgress::State::Cancelled),
-                    std::memory_order_release);
-                return;
-            }
-            if (i == tailStart) preTailValid = world->validFields;
-            runStage(i, /*iceFeedback=*/false);
+        const auto   runStart    = std::chrono::steady_clock::now();
+        const double runCpuStart = Foundation::SystemResources::threadCpuSeconds();
+        {
+            const uint64_t peak = Foundation::SystemResources::sampleMemory().memoryPeakBytes;
+            std::lock_guard<std::mutex> lock(profileMutex);
+            runProfile.peakRssStartBytes = peak;
         }
 
-        // Ice -> climate feedback. If pass 1 grew land ice, re-run the temperature-
-        // dependent tail once (a fixed two passes, not a convergence loop): the ice
-        // cools its own surface (elevation lapse + albedo) so temperature, precip,
-        // biomes, snow, and ice re-derive in equilibrium with it. A glacier-free world
-        // skips this and pays nothing.
-        //
-        // Snapshot safety: pass 2 rewrites the climate-tail arrays IN PLACE on the
-        // shared GeneratedWorld. Clear those fields' validFields bits first (and
-        // publish) so concurrent snapshot readers — which treat validFields as the
-        // sole authority for which arrays are safe to read at any instant — skip them
-        // while they are being rewritten; each pass-2 stage re-validates its fields as
-        // it finishes, restoring the full set by the end of the tail.
-        if (worldHasLandIce(*world)) {
-            world->validFields = preTailValid;
-            publishSnapshot(world);
-            for (size_t i = tailStart; i < stages.size(); ++i) {
-                if (cancelFlag.load(std::memory_order_acquire)) {
-                    atomicState.store(
-                        static_cast<int>(GenerationProgress::State::Cancelled),
-                        std::memory_order_release);
-                    return;
-                }
-                runStage(i, /*iceFeedback=*/true);
-            }
-        }
+        auto world = std::make_shared<GeneratedWorld>();
+        world->params  = params;
+        world->derived = derive(params);
+        world->grid    = grid ? std::move(grid)
+                               : std::make_shared<SphereGrid>(params.gridSubdivision);
+        world->data.allocate(world->grid->tileCount());
 
-        // Compute WorldSummary
-        {
-            uint32_t totalTiles = world->grid->tileCount();
-            uint64_t landCount = 0;
-            uint32_t riverTiles = 0;
-            double tempSum = 0.0;
-            for (uint32_t t = 0; t < totalTiles; ++t) {
-                auto idx = static_cast<size_t>(world->data.biome[t]);
-                if (idx < static_cast<size_t>(Biome::Count)) {
-                    world->summary.biomeHistogram[idx]++;
-                }
-                if ((world->data.flags[t] & kFlagOcean) == 0) ++landCount;
-                if (world->data.flags[t] & kFlagRiver) ++riverTiles;
-                tempSum += static_cast<double>(world->data.temperatureMean[t]) * 0.1;
-            }
-            world->summary.landFraction   = static_cast<float>(landCount) / static_cast<float>(totalTiles);
-            world->summary.meanTemperatureC = static_cast<float>(tempSum / totalTiles);
-            world->summary.riverTileCount = riverTiles;
-
-            // Habitability: land-area average of per-biome livability.
-            // Weights — 1.0: forests, grasslands, savanna, wetlands, beach;
-            // 0.5: montane forest, alpine grassland, xeric shrubland
-            // (marginal); 0.0: deserts (hot/cold/semi/polar), tundra
-            // (arctic/alpine), and water biomes (lakes count toward the land
-            // denominator but contribute nothing).
-            double habitable = 0.0;
-            for (size_t i = 0; i < world->summary.biomeHistogram.size(); ++i) {
-                habitable += static_cast<double>(world->summary.biomeHistogram[i]) *
-                             habitabilityWeight(static_cast<Biome>(i));
-            }
-            world->summary.habitability = landCount > 0
-                ? static_cast<float>(habitable / static_cast<double>(landCount))
-                : 0.0f;
-        }
+        generateWorld(world, /*isPreview=*/false);
 
-        // Fail loud on non-finite float output (NaN/Inf in elevation or
-        // flowAccum) rather than baking it into the hash and shipping a corrupt
-        // world. One linear pass in all builds; cheap next to generation.
         {
-            uint32_t badTile = 0;
-            if (const char* field = firstNonFiniteField(world->data, badTile)) {
-                throw GenerationError(std::string("non-finite ") + field + " at tile "
-                                      + std::to_string(badTile));
-            }
+            const double wall = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - runStart).count();
+            const double threadCpu = Foundation::SystemResources::threadCpuSeconds() - runCpuStart;
+            const uint64_t peak = Foundation::SystemResources::sampleMemory().memoryPeakBytes;
+            std::lock_guard<std::mutex> lock(profileMutex);
+            // Pool workers only do stage work, and every target-n stage is profiled
+            double cpu = threadCpu;
+            for (const StageProfile& stage : runProfile.stages) cpu += stage.pool.workerCpuSeconds;
+            runProfile.wallSeconds     = wall;
+            runProfile.cpuSeconds      = cpu;
+            runProfile.peakRssEndBytes = peak;
+            runProfile.tileCount       = world->grid->tileCount();
+            forEachFieldArray(world->data, [&](WorldField field, const auto& arr) {
+                runProfile.fieldBytes.push_back(
+                    {worldFieldName(field), static_cast<uint64_t>(arr.size() * sizeof(arr[0]))});
+            });
         }
 
-        // Compute worldHash: FNV-1a over all valid field arrays in fixed order
-        world->worldHash = computeFieldChecksums(*world);
-
         // Publish the final snapshot BEFORE marking Complete so a poller that
         // sees Complete and calls takeResult() always finds a ready snapshot.
         publishSnapshot(std::move(world));
@@ -454,6 +346,258 @@ void PlanetGenerator::runPipeline(PlanetParams params) {
     }
 }
 
+void PlanetGenerator::runPreviewPass(const PlanetParams& params) {
+    // Same params and seed at a lower n. Every stage derives its seed from
+    // (seed, stageIndex) only, so the preview is deterministic too — but the
+    // tectonic history is simulated on the preview grid (coarseN clamps to n),
+    // so coastlines are an approximation of the final planet, not a crop of it.
+    PlanetParams previewParams    = params;
+    previewParams.gridSubdivision = kPreviewSubdivision;
+
+    auto coarse = std::make_shared<GeneratedWorld>();
+    coarse->params  = previewParams;
+    coarse->derived = derive(previewParams);
+    coarse->grid    = std::make_shared<SphereGrid>(previewParams.gridSubdivision);
+    coarse->data.allocate(coarse->grid->tileCount());
+
+    generateWorld(coarse, /*isPreview=*/true);
+
+    const uint32_t displayN = std::min(params.gridSubdivision, kPreviewDisplaySubdivision);
+    auto displayGrid = std::make_shared<SphereGrid>(displayN);
+    auto display     = upsampleWorld(*coarse, std::move(displayGrid), pool);
+
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    latestPreview = std::move(display);
+}
+
+void PlanetGenerator::generateWorld(const std::shared_ptr<GeneratedWorld>& world,
+                                    bool isPreview) {
+    const PlanetParams& params = world->params;
+
+    // The climate tail (temperature-dependent stages) begins at AtmosphereStage;
+    // everything before it (tectonics, terrain, sea-level selection) is unaffected
+    // by ice and never re-runs. The tail is the contiguous index range
+    // [tailStart, end): Atmosphere, Precipitation, Ocean, Biome, Snow, Glacier.
+    // OceanStage sits inside the tail and so re-runs too. It is a pure function of
+    // elevation and sea level, so it reproduces identical ocean tiles, but it has to
+    // re-run because it co-owns waterDepth with PrecipitationStage's lakes, which DO
+    // change under the colder feedback climate.
+    size_t tailStart = stages.size();
+    for (size_t i = 0; i < stages.size(); ++i) {
+        if (std::strcmp(stages[i]->name(), "Atmosphere") == 0) {
+            tailStart = i;
+            break;
+        }
+    }
+
+    // Progress reserves a band for the optional feedback pass so the bar reflects
+    // pass-2 work instead of pinning at 100% while it runs. The feedback re-runs the
+    // tail, so the planned work is the full pipeline plus one more tail; pass 1 tops
+    // out at totalWeight/plannedTotalWeight and pass 2 fills the rest. A glacier-free
+    // world skips pass 2, and the final store (at Complete) advances the bar to 1.0.
+    const float reRunTailWeight    = totalWeight - weightPrefixSum[tailStart];
+    const float plannedTotalWeight = totalWeight + reRunTailWeight;
+
+    // Run one stage by index, optionally with the ice-feedback flag set (used
+    // only on the second pass). Reuses deriveSeed(seed, i) so re-running a stage
+    // is bit-identical apart from the feedback it reads.
+    //
+    // A preview pass reports no progress and publishes no snapshots: progress()
+    // and snapshot() describe the target-n run only, so the bar never rewinds
+    // when the preview hands over and snapshot readers never see the grid change.
+    auto runStage = [&](size_t i, bool iceFeedback) {
+        if (!isPreview) {
+            atomicStageIndex.store(static_cast<int>(i), std::memory_order_release);
+            atomicStageFraction.store(0.0f, std::memory_order_release);
+        }
+
+        float stageWeightBase = weightPrefixSum[i];
+        // Pass 2 (iceFeedback) re-runs the tail, so its completed-work baseline is
+        // the whole first pass beyond the pre-tail prefix already in stageWeightBase:
+        // reRunTailWeight = totalWeight - weightPrefixSum[tailStart].
+        const float passBase = iceFeedback ? reRunTailWeight : 0.0f;
+
+        // reportProgress lambda: maps [0,1] within stage to totalFraction. Both
+        // stores are monotonic max via CAS loop so out-of-order slab completions
+        // never push progress backwards. Pass 2 continues forward from where pass 1
+        // stopped into the reserved tail band; it never rewinds.
+        auto reportProgress = [&, i, stageWeightBase, passBase](float frac) {
+            if (isPreview) return;
+            float cur = atomicStageFraction.load(std::memory_order_relaxed);
+            while (frac > cur &&
+                   !atomicStageFraction.compare_exchange_weak(
+                       cur, frac, std::memory_order_relaxed)) {}
+
+            float total = (passBase + stageWeightBase + stages[i]->weight() * frac)
+                          / plannedTotalWeight;
+            cur = atomicTotalFraction.load(std::memory_order_relaxed);
+            while (total > cur &&
+                   !atomicTotalFraction.compare_exchange_weak(
+                       cur, total, std::memory_order_relaxed)) {}
+        };
+
+        uint64_t stageSeed = foundation::deriveSeed(params.seed, static_cast<uint64_t>(i));
+
+        StageContext ctx{
+            params,
+            world->derived,
+            *world->grid,
+            world->data,
+            *world,
+            pool,
+            stageSeed,
+            reportProgress,
+            cancelFlag,
+            iceFeedback
+        };
+
+        // Profile target-n stages only. Pool stats are enabled just around
+        // the stage so the preview pass and upsampling never leak into them.
+        // The guard turns them off again (and drops the partial counts) when
+        // a stage throws, so a cancelled or failed run can't leave the
+        // member pool timing every slab of the next generateWorld().
+        struct PoolStatsGuard {
+            foundation::TaskPool& pool;
+            bool                  armed = false;
+            ~PoolStatsGuard() {
+                if (armed) {
+                    pool.setStatsEnabled(false);
+                    (void)pool.takeStats();
+                }
+            }
+        } statsGuard{pool};
+        StageProfile stageProfile;
+        std::chrono::steady_clock::time_point stageStart{};
+        double   cpuStart   = 0.0;
+        uint64_t peakBefore = 0;
+        if (!isPreview) {
+            stageProfile.stageName   = stages[i]->name();
+            stageProfile.iceFeedback = iceFeedback;
+            const auto mem = Foundation::SystemResources::sampleMemory();
+            stageProfile.rssBeforeBytes    = mem.memoryUsedBytes;
+            peakBefore = mem.memoryPeakBytes;
+            pool.setStatsEnabled(true);
+            statsGuard.armed = true;
+            cpuStart   = Foundation::SystemResources::threadCpuSeconds();
+            stageStart = std::chrono::steady_clock::now();
+        }
+
+        stages[i]->run(ctx);
+
+        if (!isPreview) {
+            stageProfile.wallSeconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - stageStart).count();
+            const double threadCpu = Foundation::SystemResources::threadCpuSeconds() - cpuStart;
+            pool.setStatsEnabled(false);
+            statsGuard.armed = false;
+            stageProfile.pool = pool.takeStats();
+            stageProfile.cpuSeconds = threadCpu + stageProfile.pool.workerCpuSeconds;
+            const auto mem = Foundation::SystemResources::sampleMemory();
+            stageProfile.rssAfterBytes = mem.memoryUsedBytes;
+            stageProfile.peakRssDeltaBytes =
+                mem.memoryPeakBytes > peakBefore ? mem.memoryPeakBytes - peakBefore : 0;
+            {
+                std::lock_guard<std::mutex> lock(profileMutex);
+                runProfile.stages.push_back(stageProfile);
+            }
+            publishSnapshot(world);
+        }
+
+#ifndef NDEBUG
+        // Localize which stage first introduces a non-finite float. Debug
+        // only: the all-builds end-of-pipeline sweep is the shipping guard.
+        {
+            uint32_t badTile = 0;
+            if (const char* field = firstNonFiniteField(world->data, badTile)) {
+                throw GenerationError(std::string("non-finite ") + field
+                                      + " at tile " + std::to_string(badTile)
+                                      + " after stage " + stages[i]->name());
+            }
+        }
+#endif
+    };
+
+    // Pass 1: the full pipeline, no ice feedback. Capture the validFields set just
+    // before the climate tail so the feedback pass can invalidate exactly the
+    // fields it rewrites.
+    uint32_t preTailValid = 0;
+    for (size_t i = 0; i < stages.size(); ++i) {
+        if (cancelFlag.load(std::memory_order_acquire)) throw CancelledException{};
+        if (i == tailStart) preTailValid = world->validFields;
+        runStage(i, /*iceFeedback=*/false);
+    }
+
+    // Ice -> climate feedback. If pass 1 grew land ice, re-run the temperature-
+    // dependent tail once (a fixed two passes, not a convergence loop): the ice
+    // cools its own surface (elevation lapse + albedo) so temperature, precip,
+    // biomes, snow, and ice re-derive in equilibrium with it. A glacier-free world
+    // skips this and pays nothing.
+    //
+    // Snapshot safety: pass 2 rewrites the climate-tail arrays IN PLACE on the
+    // shared GeneratedWorld. Clear those fields' validFields bits first (and
+    // publish) so concurrent snapshot readers — which treat validFields as the
+    // sole authority for which arrays are safe to read at any instant — skip them
+    // while they are being rewritten; each pass-2 stage re-validates its fields as
+    // it finishes, restoring the full set by the end of the tail.
+    if (worldHasLandIce(*world)) {
+        world->validFields = preTailValid;
+        if (!isPreview) publishSnapshot(world);
+        for (size_t i = tailStart; i < stages.size(); ++i) {
+            if (cancelFlag.load(std::memory_order_acquire)) throw CancelledException{};
+            runStage(i, /*iceFeedback=*/true);
+        }
+    }
+
+    // Compute WorldSummary
+    {
+        uint32_t totalTiles = world->grid->tileCount();
+        uint64_t landCount = 0;
+        uint32_t riverTiles = 0;
+        double tempSum = 0.0;
+        for (uint32_t t = 0; t < totalTiles; ++t) {
+            auto idx = static_cast<size_t>(world->data.biome[t]);
+            if (idx < static_cast<size_t>(Biome::Count)) {
+                world->summary.biomeHistogram[idx]++;
+            }
+            if ((world->data.flags[t] & kFlagOcean) == 0) ++landCount;
+            if (world->data.flags[t] & kFlagRiver) ++riverTiles;
+            tempSum += static_cast<double>(world->data.temperatureMean[t]) * 0.1;
+        }
+        world->summary.landFraction   = static_cast<float>(landCount) / static_cast<float>(totalTiles);
+        world->summary.meanTemperatureC = static_cast<float>(tempSum / totalTiles);
+        world->summary.riverTileCount = riverTiles;
+
+        // Habitability: land-area average of per-biome livability.
+        // Weights — 1.0: forests, grasslands, savanna, wetlands, beach;
+        // 0.5: montane forest, alpine grassland, xeric shrubland
+        // (marginal); 0.0: deserts (hot/cold/semi/polar), tundra
+        // (arctic/alpine), and water biomes (lakes count toward the land
+        // denominator but contribute nothing).
+        double habitable = 0.0;
+        for (size_t i = 0; i < world->summary.biomeHistogram.size(); ++i) {
+            habitable += static_cast<double>(world->summary.biomeHistogram[i]) *
+                         habitabilityWeight(static_cast<Biome>(i));
+        }
+        world->summary.habitability = landCount > 0
+            ? static_cast<float>(habitable / static_cast<double>(landCount))
+            : 0.0f;
+    }
+
+    // Fail loud on non-finite float output (NaN/Inf in elevation or
+    // flowAccum) rather than baking it into the hash and shipping a corrupt
+    // world. One linear pass in all builds; cheap next to generation.
+    {
+        uint32_t badTile = 0;
+        if (const char* field = firstNonFiniteField(world->data, badTile)) {
+            throw GenerationError(std::string("non-finite ") + field + " at tile "
+                                  + std::to_string(badTile));
+        }
+    }
+
+    // Compute worldHash: FNV-1a over all valid field arrays in fixed order
+    world->worldHash = computeFieldChecksums(*world);
+}
+
 // ============================================================================
 // Checksum
 // ============================================================================
@@ -16,6 +16,14 @@
 //   - snapshot() and takeResult() are mutex-guarded pointer copies — O(1).
 //   - cancel() sets a flag; the running stage must call throwIfCancelled() in
 //     its slab loop to observe the flag within ~100ms wall time.
+//
+// Progressive (coarse-to-fine) mode:
+//   With setProgressive(true), a run whose n exceeds kPreviewSubdivision first
+//   generates the whole pipeline at kPreviewSubdivision, upsamples it onto a
+//   min(n, kPreviewDisplaySubdivision) grid, and publishes it via preview()
+//   before the target-n pipeline starts. progress() and snapshot() cover only
+//   the target-n run (stageIndex stays -1 while the preview pass runs). The
+//   preview is display-only — see WorldUpsample.h.
 
 #include "worldgen/data/GeneratedWorld.h"
 #include "worldgen/data/PlanetParams.h"
@@ -33,6 +41,16 @@
 
 namespace worldgen {
 
+// Grid subdivision of the progressive-mode preview pass. n=32 (10,242 tiles)
+// runs the full pipeline in a few hundred ms on a multi-core machine; the
+// tectonic-history sim dominates and its coarse grid clamps to this n.
+inline constexpr uint32_t kPreviewSubdivision = 32;
+
+// Grid the preview is upsampled onto for display, capped by the target n.
+// Matches PlanetMesh's vertex cap (V = min(n, 128)) so the preview globe has a
+// round silhouette rather than the faceted n=32 mesh.
+inline constexpr uint32_t kPreviewDisplaySubdivision = 128;
+
 struct GenerationProgress {
     enum class State { Idle, Running, Complete, Cancelled, Failed };
 
@@ -43,6 +61,43 @@ struct GenerationProgress {
     State       state{State::Idle};
 };
 
+// Telemetry for one executed stage of the target-n run, in execution order.
+// The optional ice-feedback tail appears as extra entries with iceFeedback set.
+// CPU time is this generator's own (its thread plus its TaskPool workers, read
+// from per-thread clocks). RSS is process-wide: generators running concurrently
+// in one process (worldgen-cli --batch --jobs > 1) inflate each other's figures.
+struct StageProfile {
+    const char* stageName{nullptr};
+    bool        iceFeedback{false};
+    double      wallSeconds{};
+    double      cpuSeconds{};        // user + system, generator thread + pool workers
+    uint64_t    rssBeforeBytes{};
+    uint64_t    rssAfterBytes{};
+    uint64_t    peakRssDeltaBytes{}; // growth of the process peak RSS during the stage
+    foundation::ParallelForStats pool{}; // every parallelFor the stage issued
+};
+
+struct FieldBytes {
+    const char* name{nullptr};
+    uint64_t    bytes{};
+};
+
+// Structured profile of one run (see StageProfile for the process-wide RSS caveat).
+// Totals cover the target-n run only; the progressive preview pass is reported
+// separately as previewWallSeconds.
+struct GenerationProfile {
+    std::vector<StageProfile> stages;
+    double   wallSeconds{};
+    double   cpuSeconds{};
+    double   previewWallSeconds{};
+    uint64_t peakRssStartBytes{};
+    uint64_t peakRssEndBytes{};
+    unsigned poolThreads{};          // TaskPool workers (the generator thread also participates)
+    uint32_t tileCount{};
+    // WorldData array sizes in forEachFieldArray order; filled when the run completes.
+    std::vector<FieldBytes> fieldBytes;
+};
+
 class PlanetGenerator {
   public:
     // threadCount: 0 = hardware_concurrency - 1
@@ -55,6 +110,11 @@ class PlanetGenerator {
     // Start asynchronous generation. Cancels any in-progress run first.
     void start(const PlanetParams& params);
 
+    // As above, reusing a prebuilt grid for the target-n world instead of
+    // constructing one (batch runs share one SphereGrid across planets). Ignored
+    // when null or when its subdivision differs from params.gridSubdivision.
+    void start(const PlanetParams& params, std::shared_ptr<const SphereGrid> grid);
+
     // Request cancellation (non-blocking). Destructor also cancels+joins.
     void cancel();
 
@@ -65,17 +125,39 @@ class PlanetGenerator {
     // The returned shared_ptr is immutable per the contract above.
     std::shared_ptr<const GeneratedWorld> snapshot() const;
 
+    // Enable the progressive preview pass for subsequent start() calls.
+    void setProgressive(bool enabled) {
+        progressive.store(enabled, std::memory_order_release);
+    }
+
+    // Upsampled preview of the current run (nullptr until the preview pass
+    // finishes, and always nullptr when progressive mode is off or n is at or
+    // below kPreviewSubdivision). Cleared by start().
+    std::shared_ptr<const GeneratedWorld> preview() const;
+
     // Take the final result (state must be Complete).
     // Returns nullptr if not complete. Clears the internal reference.
     std::shared_ptr<const GeneratedWorld> takeResult();
 
+    // Profile of the current/last run (cleared by start()). Stages append as
+    // they finish, so a mid-run call returns the completed prefix.
+    GenerationProfile profile() const;
+
     // Human-readable reason for the last Failed state (empty otherwise).
     // Set by input validation, allocation failure, and stage invariant
     // violations. Read by the loading scene to surface why a run failed.
     std::string failureReason() const;
 
   private:
-    void runPipeline(PlanetParams params);
+    void runPipeline(PlanetParams params, std::shared_ptr<const SphereGrid> grid);
+
+    // Generate, upsample, and publish the progressive-mode preview.
+    void runPreviewPass(const PlanetParams& params);
+
+    // Run every stage (plus the optional ice-feedback tail) over a freshly
+    // allocated world, then fill summary and worldHash. A preview run reports no
+    // progress and publishes no snapshots. Throws CancelledException on cancel.
+    void generateWorld(const std::shared_ptr<GeneratedWorld>& world, bool isPreview);
     void publishSnapshot(std::shared_ptr<GeneratedWorld> world);
 
     // Record a reason and transition to Failed. Thread-safe.
@@ -90,6 +172,7 @@ class PlanetGenerator {
 
     std::jthread                  worker;
     std::atomic<bool>             cancelFlag{false};
+    std::atomic<bool>             progressive{false};
 
     // Progress state — all atomic so progress() needs no lock
     std::atomic<int>              atomicStageIndex{-1};
@@ -100,6 +183,11 @@ class PlanetGenerator {
     // Published snapshot — mutex-guarded pointer copy
     mutable std::mutex            snapshotMutex;
     std::shared_ptr<GeneratedWorld> latestSnapshot;
+    std::shared_ptr<GeneratedWorld> latestPreview;
+
+    // Run profile — written by the worker, copied out by profile().
+    mutable std::mutex            profileMutex;
+    GenerationProfile             runProfile;
 
     // Failure reason — guarded separately so progress() stays lock-free.
     mutable std::mutex            failureMutex;
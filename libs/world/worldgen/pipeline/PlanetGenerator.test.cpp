@@ -90,6 +90,57 @@ TEST(PlanetGenerator, AllStagesReported) {
     EXPECT_EQ(maxStageIndex, 9) << "Expected 10 stages (indices 0..9)";
 }
 
+// ============================================================================
+// profile records every executed stage, in order, for the target run
+// ============================================================================
+
+TEST(PlanetGenerator, ProfileRecorded) {
+    PlanetParams params = PlanetParams::preset(Preset::EarthLike);
+    params.gridSubdivision = 16;
+
+    PlanetGenerator gen(2);
+    gen.start(params);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (gen.progress().state != GenerationProgress::State::Running) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQ(gen.progress().state, GenerationProgress::State::Complete);
+
+    GenerationProfile prof = gen.profile();
+    const auto& stages = prof.stages;
+    ASSERT_GE(stages.size(), 10u);
+    EXPECT_STREQ(stages.front().stageName, "TectonicHistory");
+    uint64_t parallelCalls = 0;
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_FALSE(stages[i].iceFeedback) << "pass 1 entry " << i;
+        EXPECT_GE(stages[i].wallSeconds, 0.0);
+        EXPECT_GE(stages[i].cpuSeconds, 0.0);
+        parallelCalls += stages[i].pool.calls;
+    }
+    for (size_t i = 10; i < stages.size(); ++i) {
+        EXPECT_TRUE(stages[i].iceFeedback) << "entries past pass 1 are the feedback tail";
+    }
+    EXPECT_GT(parallelCalls, 0u) << "pool stats are collected during stages";
+    EXPECT_EQ(prof.poolThreads, 2u);
+    EXPECT_EQ(prof.tileCount, 10u * 16u * 16u + 2u);
+    EXPECT_GE(prof.wallSeconds, stages.front().wallSeconds);
+
+    // fieldBytes covers every WorldData array at its element size.
+    WorldData probe;
+    uint64_t bytesPerTile = 0;
+    forEachFieldArray(probe, [&](WorldField, const auto& arr) { bytesPerTile += sizeof(arr[0]); });
+    uint64_t totalBytes = 0;
+    for (const auto& f : prof.fieldBytes) totalBytes += f.bytes;
+    EXPECT_EQ(prof.fieldBytes.size(), static_cast<size_t>(std::popcount(kAllWorldFields)));
+    EXPECT_EQ(totalBytes, static_cast<uint64_t>(prof.tileCount) * bytesPerTile);
+    EXPECT_STREQ(prof.fieldBytes.front().name, "elevation");
+
+    gen.start(params);
+    EXPECT_LT(gen.profile().stages.size(), stages.size()) << "start() clears the profile";
+    gen.cancel();
+}
+
 // ============================================================================
 // validFields has all bits set on completion
 // ============================================================================
@@ -314,6 +365,80 @@ TEST(PlanetGenerator, RerunPublishesFreshWorld) {
         << "First world must retain its own params after the rerun";
 }
 
+// ============================================================================
+// Progressive mode publishes an upsampled, display-only preview before the
+// target-n run, and leaves non-progressive runs without one.
+// ============================================================================
+
+TEST(PlanetGenerator, ProgressivePreviewPublished) {
+    PlanetParams params = PlanetParams::preset(Preset::EarthLike);
+    params.gridSubdivision = 64;
+
+    PlanetGenerator gen;
+    gen.setProgressive(true);
+    gen.start(params);
+
+    std::shared_ptr<const GeneratedWorld> preview;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while (std::chrono::steady_clock::now() < deadline) {
+        preview = gen.preview();
+        if (preview) break;
+        if (gen.progress().state != GenerationProgress::State::Running) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    gen.cancel();
+
+    ASSERT_NE(preview, nullptr) << "progressive run never published a preview";
+    EXPECT_EQ(preview->grid->subdivision(), 64u) << "preview upsamples to min(n, 128)";
+    EXPECT_EQ(preview->validFields & kAllWorldFields, kAllWorldFields);
+    EXPECT_EQ(preview->worldHash, 0u);
+    EXPECT_EQ(preview->params.seed, params.seed);
+}
+
+TEST(PlanetGenerator, NoPreviewAtOrBelowPreviewSubdivision) {
+    PlanetParams params = PlanetParams::preset(Preset::EarthLike);
+    params.gridSubdivision = 16;
+
+    auto world = runToCompletion(params);
+    ASSERT_NE(world, nullptr);
+
+    PlanetGenerator gen;
+    gen.setProgressive(true);
+    gen.start(params); // n <= kPreviewSubdivision: the preview pass is skipped
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (gen.progress().state != GenerationProgress::State::Running) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(gen.preview(), nullptr);
+    auto result = gen.takeResult();
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->worldHash, world->worldHash);
+}
+
+// The preview pass must not perturb the final world: same seed and n give the
+// same worldHash with and without progressive mode.
+TEST(PlanetGeneratorHeavy, ProgressiveFinalMatchesDirect) {
+    PlanetParams params = PlanetParams::preset(Preset::EarthLike);
+    params.gridSubdivision = 48;
+
+    auto direct = runToCompletion(params, 300);
+    ASSERT_NE(direct, nullptr);
+
+    PlanetGenerator gen;
+    gen.setProgressive(true);
+    gen.start(params);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(300);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (gen.progress().state != GenerationProgress::State::Running) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_NE(gen.preview(), nullptr);
+    auto progressive = gen.takeResult();
+    ASSERT_NE(progressive, nullptr);
+    EXPECT_EQ(progressive->worldHash, direct->worldHash);
+}
+
 // ============================================================================
 // DebugImageExporter: writes valid BMP
 // ============================================================================
@@ -0,0 +1,69 @@
+#include "worldgen/pipeline/WorldUpsample.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace worldgen {
+
+namespace {
+
+// Fine tiles per parallelFor slab. Each slab warms its own rhombus hint, so the
+// slab layout (fixed by TaskPool regardless of thread count) fully determines
+// which coarse tile a seam-adjacent fine tile resolves to.
+constexpr size_t kUpsampleSlab = 4096;
+
+} // namespace
+
+std::shared_ptr<GeneratedWorld> upsampleWorld(const GeneratedWorld& coarse,
+                                              std::shared_ptr<const SphereGrid> fineGrid,
+                                              foundation::TaskPool& pool) {
+    auto fine = std::make_shared<GeneratedWorld>();
+    fine->params                 = coarse.params;
+    fine->params.gridSubdivision = fineGrid->subdivision();
+    fine->derived                = coarse.derived;
+    fine->grid                   = fineGrid;
+    fine->seaLevelMeters         = coarse.seaLevelMeters;
+    fine->plates                 = coarse.plates;
+    fine->summary                = coarse.summary;
+    fine->validFields            = coarse.validFields;
+    fine->worldHash              = 0;
+
+    const SphereGrid& cg = *coarse.grid;
+    const SphereGrid& fg = *fineGrid;
+    const uint32_t fineCount = fg.tileCount();
+    fine->data.allocate(fineCount);
+
+    // Resolve every fine tile to its nearest coarse tile once, then gather each
+    // field through the map.
+    std::vector<TileId> source(fineCount);
+    pool.parallelFor(0, fineCount, kUpsampleSlab, [&](size_t b, size_t e) {
+        uint32_t hint = 0;
+        for (size_t t = b; t < e; ++t) {
+            source[t] = cg.fromUnitVectorHinted(fg.tileCenter(static_cast<TileId>(t)), hint);
+        }
+    });
+
+    forEachFieldArray(fine->data, [&](WorldField field, auto& dst) {
+        if ((coarse.validFields & static_cast<uint32_t>(field)) == 0) return;
+        forEachFieldArray(coarse.data, [&](WorldField srcField, const auto& src) {
+            using Dst = std::decay_t<decltype(dst)>;
+            using Src = std::decay_t<decltype(src)>;
+            if constexpr (std::is_same_v<Dst, Src>) {
+                if (srcField != field) return;
+                pool.parallelFor(0, fineCount, kUpsampleSlab, [&](size_t b, size_t e) {
+                    for (size_t t = b; t < e; ++t) dst[t] = src[source[t]];
+                });
+            }
+        });
+    });
+
+    // Neighbor-direction indices are grid-relative; a copied index would point at
+    // an arbitrary fine neighbor. Reset them to "none" (allocate()'s default).
+    std::fill(fine->data.downhill.begin(), fine->data.downhill.end(), uint8_t{0xFF});
+    std::fill(fine->data.iceFlow.begin(), fine->data.iceFlow.end(), uint8_t{0xFF});
+
+    return fine;
+}
+
+} // namespace worldgen
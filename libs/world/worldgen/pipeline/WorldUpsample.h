@@ -0,0 +1,30 @@
+#pragma once
+
+// upsampleWorld: lift a finished coarse GeneratedWorld onto a finer SphereGrid by
+// nearest-tile lookup. Used by PlanetGenerator's progressive mode to turn the
+// fast low-n preview run into a world the planet-view renderer can draw at its
+// full mesh resolution (PlanetMesh caps V at 128, so a raw n=32 preview would
+// render as a visibly faceted polyhedron).
+//
+// The result is DISPLAY-ONLY:
+//   - Per-tile scalar fields (elevation, climate, biome, flags, ...) are copied
+//     from the coarse tile whose center is nearest the fine tile center.
+//   - Neighbor-direction fields (downhill, iceFlow) index into a tile's own
+//     neighbor list, which has no meaning on a different grid, so they are reset
+//     to 0xFF (none).
+//   - worldHash is 0: a preview is never saved, hashed, or landed on.
+
+#include "worldgen/data/GeneratedWorld.h"
+#include "worldgen/grid/SphereGrid.h"
+
+#include <threading/TaskPool.h>
+
+#include <memory>
+
+namespace worldgen {
+
+std::shared_ptr<GeneratedWorld> upsampleWorld(const GeneratedWorld& coarse,
+                                              std::shared_ptr<const SphereGrid> fineGrid,
+                                              foundation::TaskPool& pool);
+
+} // namespace worldgen
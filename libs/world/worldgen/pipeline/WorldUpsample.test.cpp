@@ -0,0 +1,86 @@
+// upsampleWorld tests. The coarse world is built synthetically (arrays filled by
+// hand, validFields set directly); the full pipeline is never run here.
+
+#include "worldgen/pipeline/WorldUpsample.h"
+
+#include "worldgen/data/WorldData.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace worldgen {
+
+namespace {
+
+constexpr uint32_t kCoarseN = 6;
+
+// Coarse world whose per-tile values encode the TileId, so a fine tile's source
+// is recoverable from any field it copied.
+std::shared_ptr<GeneratedWorld> makeCoarseWorld() {
+    auto world = std::make_shared<GeneratedWorld>();
+    world->params.gridSubdivision = kCoarseN;
+    world->derived = derive(world->params);
+    world->grid = std::make_shared<SphereGrid>(kCoarseN);
+    world->data.allocate(world->grid->tileCount());
+    world->seaLevelMeters = 12.5f;
+    world->worldHash = 0xABCDu;
+    world->validFields = static_cast<uint32_t>(WorldField::Elevation) |
+                         static_cast<uint32_t>(WorldField::Biome) |
+                         static_cast<uint32_t>(WorldField::Downhill);
+    for (TileId t = 0; t < world->grid->tileCount(); ++t) {
+        world->data.elevation[t] = static_cast<float>(t);
+        world->data.biome[t]     = static_cast<uint8_t>(t % 200);
+        world->data.downhill[t]  = static_cast<uint8_t>(t % 6);
+        world->data.precipitation[t] = 777; // not in validFields
+    }
+    return world;
+}
+
+} // namespace
+
+TEST(WorldUpsample, SameResolutionIsIdentity) {
+    auto coarse = makeCoarseWorld();
+    foundation::TaskPool pool(2);
+    auto fine = upsampleWorld(*coarse, coarse->grid, pool);
+
+    ASSERT_EQ(fine->data.elevation.size(), coarse->data.elevation.size());
+    for (TileId t = 0; t < coarse->grid->tileCount(); ++t) {
+        EXPECT_EQ(fine->data.elevation[t], coarse->data.elevation[t]) << "tile " << t;
+        EXPECT_EQ(fine->data.biome[t], coarse->data.biome[t]) << "tile " << t;
+    }
+}
+
+TEST(WorldUpsample, CoarseCentersKeepTheirValues) {
+    // At exactly 2x, every coarse tile center is also a fine tile center, so the
+    // fine tile sitting on it must carry that coarse tile's values.
+    auto coarse = makeCoarseWorld();
+    auto fineGrid = std::make_shared<SphereGrid>(kCoarseN * 2);
+    foundation::TaskPool pool(2);
+    auto fine = upsampleWorld(*coarse, fineGrid, pool);
+
+    ASSERT_EQ(fine->data.elevation.size(), fineGrid->tileCount());
+    EXPECT_EQ(fine->params.gridSubdivision, kCoarseN * 2);
+    EXPECT_EQ(fine->grid.get(), fineGrid.get());
+    for (TileId c = 0; c < coarse->grid->tileCount(); ++c) {
+        TileId f = fineGrid->fromUnitVector(coarse->grid->tileCenter(c));
+        EXPECT_EQ(fine->data.elevation[f], static_cast<float>(c)) << "coarse tile " << c;
+    }
+}
+
+TEST(WorldUpsample, DisplayOnlyFields) {
+    auto coarse = makeCoarseWorld();
+    auto fineGrid = std::make_shared<SphereGrid>(kCoarseN * 3);
+    foundation::TaskPool pool(2);
+    auto fine = upsampleWorld(*coarse, fineGrid, pool);
+
+    EXPECT_EQ(fine->worldHash, 0u) << "a preview must never carry a real worldHash";
+    EXPECT_EQ(fine->validFields, coarse->validFields);
+    EXPECT_FLOAT_EQ(fine->seaLevelMeters, coarse->seaLevelMeters);
+    for (TileId t = 0; t < fineGrid->tileCount(); ++t) {
+        EXPECT_EQ(fine->data.downhill[t], 0xFF) << "neighbor dirs are grid-relative";
+        EXPECT_EQ(fine->data.precipitation[t], 0) << "invalid fields are not copied";
+    }
+}
+
+} // namespace worldgen
@@ -0,0 +1,70 @@
+#include "worldgen/sampling/PlanetSampler.h"
+
+#include "worldgen/data/PlanetParams.h"
+#include "worldgen/data/WorldData.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace worldgen {
+
+namespace {
+
+// Synthetic world at a gameplay-scale subdivision. Values are arbitrary but
+// varied so the blend path and both water branches are exercised.
+std::shared_ptr<const GeneratedWorld> makeBenchWorld() {
+    constexpr uint32_t kN = 256;
+    auto world = std::make_shared<GeneratedWorld>();
+    world->params.gridSubdivision = kN;
+    world->derived = derive(world->params);
+    world->grid = std::make_shared<SphereGrid>(kN);
+    world->data.allocate(world->grid->tileCount());
+    world->validFields = static_cast<uint32_t>(WorldField::Elevation) |
+                         static_cast<uint32_t>(WorldField::Biome) |
+                         static_cast<uint32_t>(WorldField::Flags);
+    for (TileId t = 0; t < world->grid->tileCount(); ++t) {
+        world->data.elevation[t] = static_cast<float>(t % 97) * 10.0f - 100.0f;
+        world->data.biome[t] = static_cast<uint8_t>(t % static_cast<uint32_t>(Biome::Count));
+        world->data.flags[t] = (t % 7 == 0) ? kFlagOcean : 0;
+    }
+    return world;
+}
+
+// Chunk-scale batch: a 32x32 lattice over 512 m (the sector grid footprint).
+constexpr uint32_t kGrid    = 32;
+constexpr double   kSpacing = 16.0;
+
+} // namespace
+
+static void BM_PlanetSampler_SampleAtLoop(benchmark::State& state) {
+    PlanetSampler sampler(makeBenchWorld(), 12.0, 34.0);
+    double chunk = 0.0;
+    for (auto _ : state) {
+        for (uint32_t j = 0; j < kGrid; ++j) {
+            for (uint32_t i = 0; i < kGrid; ++i) {
+                auto s = sampler.sampleAt(chunk + i * kSpacing, j * kSpacing);
+                benchmark::DoNotOptimize(s);
+            }
+        }
+        chunk += 512.0;
+    }
+    state.SetItemsProcessed(state.iterations() * kGrid * kGrid);
+}
+BENCHMARK(BM_PlanetSampler_SampleAtLoop);
+
+static void BM_PlanetSampler_SampleGrid(benchmark::State& state) {
+    PlanetSampler sampler(makeBenchWorld(), 12.0, 34.0);
+    std::vector<PlanetSampler::PositionSample> out;
+    double chunk = 0.0;
+    for (auto _ : state) {
+        sampler.sampleGrid(chunk, 0.0, kSpacing, kGrid, kGrid, out);
+        benchmark::DoNotOptimize(out.data());
+        chunk += 512.0;
+    }
+    state.SetItemsProcessed(state.iterations() * kGrid * kGrid);
+}
+BENCHMARK(BM_PlanetSampler_SampleGrid);
+
+} // namespace worldgen
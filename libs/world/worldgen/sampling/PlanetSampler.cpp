@@ -48,23 +48,19 @@ PlanetSampler::TileSample PlanetSampler::resolveTile(TileId t) const {
     return {biome, elevation, water};
 }
 
-PlanetSampler::PositionSample PlanetSampler::sampleAt(double xMeters, double yMeters) const {
-    const SphereGrid& grid = *world->grid;
-
-    LatLon latLon = projection.worldToLatLon(xMeters, yMeters);
-    SphereGrid::HexSample hex = grid.locateHex(latLon.latDeg, latLon.lonDeg);
-    TileId tile = hex.tile;
-
-    TileSample primary = resolveTile(tile);
+template <typename ResolveFn>
+PlanetSampler::PositionSample PlanetSampler::blendHex(const SphereGrid::HexSample& hex,
+                                                      float tileWidth,
+                                                      ResolveFn&& resolve) const {
+    TileSample primary = resolve(hex.tile);
 
     // edgeDistance is 0.5*(d2-d1) in lattice units (half-cell span center to
     // edge); 2*edgeDistance*tileWidth is the metric distance to the Voronoi
     // boundary.
-    float distToBoundary = hex.edgeDistance * 2.0f *
-                           grid.tileWidthMeters(tile, world->derived.planetRadiusMeters);
+    float distToBoundary = hex.edgeDistance * 2.0f * tileWidth;
 
     PositionSample result;
-    result.tile = tile;
+    result.tile = hex.tile;
     result.water = primary.water;
 
     if (hex.neighbor == kInvalidTile || distToBoundary >= kBlendDistanceMeters) {
@@ -76,7 +72,7 @@ PlanetSampler::PositionSample PlanetSampler::sampleAt(double xMeters, double yMe
 
     // Boundary path: blend with the true second-nearest Voronoi center, which
     // is continuous across rhombus edges.
-    TileSample secondary = resolveTile(hex.neighbor);
+    TileSample secondary = resolve(hex.neighbor);
 
     // Continuous across the boundary: 50/50 on the edge itself, pure at the
     // blend distance. (The spec pseudocode assigns the primary t = d/blend,
@@ -100,6 +96,65 @@ PlanetSampler::PositionSample PlanetSampler::sampleAt(double xMeters, double yMe
     return result;
 }
 
+PlanetSampler::PositionSample PlanetSampler::sampleAt(double xMeters, double yMeters) const {
+    const SphereGrid& grid = *world->grid;
+
+    LatLon latLon = projection.worldToLatLon(xMeters, yMeters);
+    SphereGrid::HexSample hex = grid.locateHex(latLon.latDeg, latLon.lonDeg);
+    float tileWidth = grid.tileWidthMeters(hex.tile, world->derived.planetRadiusMeters);
+    return blendHex(hex, tileWidth, [this](TileId t) { return resolveTile(t); });
+}
+
+void PlanetSampler::sampleGrid(double originXMeters, double originYMeters, double spacingMeters,
+                               uint32_t width, uint32_t height,
+                               std::vector<PositionSample>& out) const {
+    const SphereGrid& grid = *world->grid;
+    const size_t count = static_cast<size_t>(width) * height;
+    out.resize(count);
+    if (count == 0) return;
+
+    // Pass 1: project every lattice point. Independent per point and free of
+    // grid lookups, so this loop is the one the compiler can vectorize.
+    std::vector<LatLon> latLons(count);
+    for (uint32_t j = 0; j < height; ++j) {
+        const double y = originYMeters + static_cast<double>(j) * spacingMeters;
+        for (uint32_t i = 0; i < width; ++i) {
+            const double x = originXMeters + static_cast<double>(i) * spacingMeters;
+            latLons[static_cast<size_t>(j) * width + i] = projection.worldToLatLon(x, y);
+        }
+    }
+
+    // Per-tile memo. Worldgen tiles are kilometers wide and a batch spans at
+    // most a few of them, so a small direct-mapped table keyed by TileId
+    // catches nearly every repeat; a collision just recomputes.
+    struct CachedTile {
+        TileId     tile{kInvalidTile};
+        TileSample sample{};
+        float      width{-1.0f}; // < 0: tileWidthMeters not computed yet
+    };
+    constexpr uint32_t kCacheSlots = 32;
+    std::array<CachedTile, kCacheSlots> cache{};
+    auto lookup = [&](TileId t) -> CachedTile& {
+        CachedTile& slot = cache[t % kCacheSlots];
+        if (slot.tile != t) slot = {t, resolveTile(t), -1.0f};
+        return slot;
+    };
+    auto resolveCached = [&](TileId t) { return lookup(t).sample; };
+
+    // Pass 2: locate and blend, row-major so consecutive points share a
+    // rhombus and the hint stays warm.
+    uint32_t rhombusHint = 0;
+    for (size_t k = 0; k < count; ++k) {
+        SphereGrid::HexSample hex =
+            grid.locateHexHinted(latLons[k].latDeg, latLons[k].lonDeg, rhombusHint);
+        CachedTile& home = lookup(hex.tile);
+        if (home.width < 0.0f) {
+            home.width = grid.tileWidthMeters(hex.tile, world->derived.planetRadiusMeters);
+        }
+        out[k] = blendHex(hex, home.width, resolveCached);
+    }
+}
+
 float PlanetSampler::elevationAt(double xMeters, double yMeters) const {
     return sampleAt(xMeters, yMeters).elevationMeters;
 }
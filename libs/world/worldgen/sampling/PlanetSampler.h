@@ -16,6 +16,7 @@
 #include <array>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace worldgen {
 
@@ -43,6 +44,14 @@ class PlanetSampler {
 
     [[nodiscard]] PositionSample sampleAt(double xMeters, double yMeters) const;
 
+    // Batched sampleAt over a w x h lattice: out[j*w + i] is the sample at
+    // (originX + i*spacing, originY + j*spacing). Identical to calling sampleAt
+    // per point, but cheaper for coherent batches (chunk corners, sector grids):
+    // positions are projected in one pass, hex lookup is rhombus-hinted, and
+    // per-tile work (resolveTile, tileWidthMeters) is memoized by TileId.
+    void sampleGrid(double originXMeters, double originYMeters, double spacingMeters,
+                    uint32_t width, uint32_t height, std::vector<PositionSample>& out) const;
+
     // Elevation in meters above sea level (boundary-blended like sampleAt).
     [[nodiscard]] float elevationAt(double xMeters, double yMeters) const;
 
@@ -60,6 +69,13 @@ class PlanetSampler {
 
     [[nodiscard]] TileSample resolveTile(TileId t) const;
 
+    // Shared tail of sampleAt/sampleGrid: boundary-blend a located hex given
+    // its tile width. resolve(TileId) -> TileSample supplies per-tile values
+    // (direct or memoized).
+    template <typename ResolveFn>
+    [[nodiscard]] PositionSample blendHex(const SphereGrid::HexSample& hex, float tileWidth,
+                                          ResolveFn&& resolve) const;
+
     std::shared_ptr<const GeneratedWorld> world;
     SphericalProjection projection;
 };
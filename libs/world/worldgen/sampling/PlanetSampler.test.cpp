@@ -15,6 +15,7 @@
 #include <array>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 namespace worldgen {
 
@@ -220,6 +221,60 @@ TEST(PlanetSampler, IdenticalInputsProduceIdenticalOutputs) {
     }
 }
 
+// sampleGrid must reproduce sampleAt exactly, including across rhombus seams
+// (hinted lookup) and repeated tiles (memoized resolveTile / tile width).
+TEST(PlanetSampler, SampleGridMatchesSampleAt) {
+    auto world = makeWorld(0.0f);
+    TileId center = world->grid->fromLatLon(5.0, 5.0);
+    std::array<TileId, 6> neighborIds{};
+    uint32_t neighborCount = world->grid->neighbors(center, neighborIds);
+    for (uint32_t i = 0; i < neighborCount; ++i) {
+        world->data.biome[neighborIds[i]] = static_cast<uint8_t>(Biome::HotDesert);
+        world->data.elevation[neighborIds[i]] = 600.0f;
+    }
+    const WorldPos2d centerPos = tileCenterPos(*world, center);
+
+    struct Batch {
+        double landLat, landLon, originX, originY, spacing;
+        uint32_t w, h;
+    };
+    const Batch batches[] = {
+        {0.0, 0.0, -1500000.0, -1500000.0, 50000.0, 61, 61},  // spans many tiles and seams
+        {26.57, 36.0, -800000.0, -800000.0, 40000.0, 41, 41},  // near an icosahedron vertex
+        {-40.0, 120.0, -2000000.0, -100000.0, 25000.0, 160, 8},
+        // Dense row east from the grassland tile's center: crosses into its
+        // desert ring through the 500 m blend band.
+        {0.0, 0.0, centerPos.x, centerPos.y, 200.0, 4096, 1},
+    };
+    std::vector<PlanetSampler::PositionSample> out;
+    for (const Batch& b : batches) {
+        PlanetSampler sampler(world, b.landLat, b.landLon);
+        sampler.sampleGrid(b.originX, b.originY, b.spacing, b.w, b.h, out);
+        ASSERT_EQ(out.size(), static_cast<size_t>(b.w) * b.h);
+        uint32_t blendedCount = 0;
+        for (uint32_t j = 0; j < b.h; ++j) {
+            for (uint32_t i = 0; i < b.w; ++i) {
+                const auto& g = out[static_cast<size_t>(j) * b.w + i];
+                auto a = sampler.sampleAt(b.originX + i * b.spacing, b.originY + j * b.spacing);
+                ASSERT_EQ(g.tile, a.tile) << "i=" << i << " j=" << j;
+                ASSERT_EQ(g.water, a.water);
+                ASSERT_EQ(g.elevationMeters, a.elevationMeters);  // bit-identical
+                ASSERT_EQ(g.weightCount, a.weightCount);
+                for (uint32_t k = 0; k < a.weightCount; ++k) {
+                    ASSERT_EQ(g.weights[k].biome, a.weights[k].biome);
+                    ASSERT_EQ(g.weights[k].weight, a.weights[k].weight);
+                }
+                if (g.weightCount == 2) ++blendedCount;
+            }
+        }
+        if (b.h == 1) EXPECT_GT(blendedCount, 0u) << "dense batch should cross a blend band";
+    }
+
+    PlanetSampler sampler(world, 0.0, 0.0);
+    sampler.sampleGrid(0.0, 0.0, 1.0, 0, 5, out);
+    EXPECT_TRUE(out.empty());
+}
+
 TEST(PlanetSampler, TileLookupMatchesSphereGrid) {
     auto world = makeWorld(0.0f);
     PlanetSampler sampler(world, 0.0, 0.0);